@@ -45,6 +45,7 @@
 #include "util/log.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
+#include "util/storage/addrlpm.h"
 #include "services/localzone.h"
 #include "sldns/str2wire.h"
 
@@ -68,6 +69,7 @@ acl_list_delete(struct acl_list* acl)
 {
 	if(!acl) 
 		return;
+	addr_lpm_delete(acl->lpm);
 	regional_destroy(acl->region);
 	free(acl);
 }
@@ -435,6 +437,8 @@ int
 acl_list_apply_cfg(struct acl_list* acl, struct config_file* cfg,
 	struct views* v)
 {
+	addr_lpm_delete(acl->lpm);
+	acl->lpm = NULL;
 	regional_free_all(acl->region);
 	addr_tree_init(&acl->tree);
 	if(!read_acl_list(acl, cfg))
@@ -461,6 +465,10 @@ acl_list_apply_cfg(struct acl_list* acl, struct config_file* cfg,
 			return 0;
 	}
 	addr_tree_init_parents(&acl->tree);
+	if(!(acl->lpm = addr_lpm_create(&acl->tree))) {
+		log_err("out of memory");
+		return 0;
+	}
 	return 1;
 }
 
@@ -475,6 +483,9 @@ struct acl_addr*
 acl_addr_lookup(struct acl_list* acl, struct sockaddr_storage* addr,
         socklen_t addrlen)
 {
+	if(acl->lpm)
+		return (struct acl_addr*)addr_lpm_lookup(acl->lpm,
+			addr, addrlen);
 	return (struct acl_addr*)addr_tree_lookup(&acl->tree,
 		addr, addrlen);
 }
@@ -483,5 +494,6 @@ size_t
 acl_list_get_mem(struct acl_list* acl)
 {
 	if(!acl) return 0;
-	return sizeof(*acl) + regional_get_mem(acl->region);
+	return sizeof(*acl) + regional_get_mem(acl->region) +
+		addr_lpm_get_mem(acl->lpm);
 }
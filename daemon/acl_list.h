@@ -44,6 +44,7 @@
 #define DAEMON_ACL_LIST_H
 #include "util/storage/dnstree.h"
 #include "services/view.h"
+struct addr_lpm;
 struct config_file;
 struct regional;
 
@@ -77,6 +78,8 @@ struct acl_list {
 	 * contents of type acl_addr.
 	 */
 	rbtree_type tree;
+	/** the tree compiled for lookups, NULL when not made */
+	struct addr_lpm* lpm;
 };
 
 /**
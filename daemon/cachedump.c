@@ -232,6 +232,7 @@ copy_msg(struct regional* region, struct lruhash_entry* e,
 		sizeof(struct ub_packed_rrset_key*) * rep->rrset_count);
 	if(!*d)
 		return 0;
+	(*d)->wire = NULL;
 	(*d)->rrsets = (struct ub_packed_rrset_key**)(void *)(
 		(uint8_t*)(&((*d)->ref[0])) + 
 		sizeof(struct rrset_ref) * rep->rrset_count);
@@ -393,7 +394,8 @@ move_into_cache(struct ub_packed_rrset_key* k,
 	ak->entry.data = NULL;
 	ak->rk = k->rk;
 	ak->entry.hash = rrset_key_hash(&k->rk);
-	ak->rk.dname = (uint8_t*)memdup(k->rk.dname, k->rk.dname_len);
+	ak->rk.dname = (uint8_t*)alloc_data_dup(&worker->alloc, k->rk.dname,
+		k->rk.dname_len);
 	if(!ak->rk.dname) {
 		log_warn("error out of memory");
 		ub_packed_rrset_parsedelete(ak, &worker->alloc);
@@ -403,7 +405,7 @@ move_into_cache(struct ub_packed_rrset_key* k,
 		sizeof(time_t))* num;
 	for(i=0; i<num; i++)
 		s += d->rr_len[i];
-	ad = (struct packed_rrset_data*)malloc(s);
+	ad = (struct packed_rrset_data*)alloc_data_obtain(&worker->alloc, s);
 	if(!ad) {
 		log_warn("error out of memory");
 		ub_packed_rrset_parsedelete(ak, &worker->alloc);
@@ -452,7 +452,9 @@ daemon_create_workers(struct daemon* daemon)
 		fatal_exit("out of memory during daemon init");
 	if(daemon->cfg->dnstap) {
 #ifdef USE_DNSTAP
-		daemon->dtenv = dt_create(daemon->cfg->dnstap_socket_path,
+		/* stop the dnstap thread of the previous config */
+		dt_delete(daemon->dtenv);
+		daemon->dtenv = dt_create(daemon->cfg,
 			(unsigned int)daemon->num);
 		if (!daemon->dtenv)
 			fatal_exit("dt_create failed");
@@ -706,6 +708,7 @@ daemon_cleanup(struct daemon* daemon)
 	daemon->num = 0;
 #ifdef USE_DNSTAP
 	dt_delete(daemon->dtenv);
+	daemon->dtenv = NULL;
 #endif
 #ifdef USE_DNSCRYPT
 	dnsc_delete(daemon->dnscenv);
@@ -812,7 +815,29 @@ void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg)
 	if((daemon->env->rrset_cache = rrset_cache_adjust(
 		daemon->env->rrset_cache, cfg, &daemon->superalloc)) == 0)
 		fatal_exit("malloc failure updating config settings");
+	slabhash_set_hugepage(daemon->env->msg_cache, cfg->cache_huge_pages);
+	slabhash_set_hugepage(&daemon->env->rrset_cache->table,
+		cfg->cache_huge_pages);
+	if(cfg->cache_huge_pages && daemon->superalloc.depot &&
+		!slab_depot_set_arena(daemon->superalloc.depot,
+		cfg->rrset_cache_size))
+		log_warn("cache-huge-pages: no huge pages, the cache is "
+			"malloced");
 	if((daemon->env->infra_cache = infra_adjust(daemon->env->infra_cache,
 		cfg))==0)
 		fatal_exit("malloc failure updating config settings");
 }
+
+size_t daemon_get_hugepage_mem(struct daemon* daemon)
+{
+	size_t s, asize, aused;
+	int atype;
+	s = slabhash_get_hugepage_mem(daemon->env->msg_cache) +
+		slabhash_get_hugepage_mem(&daemon->env->rrset_cache->table);
+	if(daemon->superalloc.depot) {
+		slab_depot_hugepage(daemon->superalloc.depot, &asize, &aused,
+			&atype);
+		s += aused;
+	}
+	return s;
+}
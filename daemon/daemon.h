@@ -177,4 +177,12 @@ void daemon_delete(struct daemon* daemon);
  */
 void daemon_apply_cfg(struct daemon* daemon, struct config_file* cfg);
 
+/**
+ * Get the memory of the caches that is in huge pages, the slabs in the
+ * huge page arena and the hash arrays in huge pages.
+ * @param daemon: the daemon.
+ * @return memory in bytes.
+ */
+size_t daemon_get_hugepage_mem(struct daemon* daemon);
+
 #endif /* DAEMON_H */
@@ -85,6 +85,8 @@
 #include "sldns/parseutil.h"
 #include "sldns/wire2str.h"
 #include "sldns/sbuffer.h"
+#include "util/storage/topk.h"
+#include "util/hugepage.h"
 
 #ifdef HAVE_SYS_TYPES_H
 #  include <sys/types.h>
@@ -764,6 +766,10 @@ print_stats(SSL* ssl, const char* nm, struct ub_stats_info* s)
 		(unsigned long)s->svr.num_query_dnscrypt_cleartext)) return 0;
 	if(!ssl_printf(ssl, "%s.num.dnscrypt.malformed"SQ"%lu\n", nm,
 		(unsigned long)s->svr.num_query_dnscrypt_crypted_malformed)) return 0;
+#endif
+#ifdef USE_DNSTAP
+	if(!ssl_printf(ssl, "%s.num.dnstap.dropped"SQ"%lu\n", nm,
+		(unsigned long)s->svr.dnstap_dropped)) return 0;
 #endif
 	if(!ssl_printf(ssl, "%s.requestlist.avg"SQ"%g\n", nm,
 		(s->svr.num_queries_missed_cache+s->svr.num_queries_prefetch)?
@@ -791,6 +797,18 @@ print_stats(SSL* ssl, const char* nm, struct ub_stats_info* s)
 		s->mesh_time_median)) return 0;
 	if(!ssl_printf(ssl, "%s.tcpusage"SQ"%lu\n", nm,
 		(unsigned long)s->svr.tcp_accept_usage)) return 0;
+	if(!ssl_printf(ssl, "%s.alloc.obj.reused"SQ"%lu\n", nm,
+		(unsigned long)s->svr.alloc_obj_reused)) return 0;
+	if(!ssl_printf(ssl, "%s.alloc.obj.malloced"SQ"%lu\n", nm,
+		(unsigned long)s->svr.alloc_obj_malloced)) return 0;
+	if(!ssl_printf(ssl, "%s.alloc.obj.freed"SQ"%lu\n", nm,
+		(unsigned long)s->svr.alloc_obj_freed)) return 0;
+	if(!ssl_printf(ssl, "%s.alloc.chunk.reused"SQ"%lu\n", nm,
+		(unsigned long)s->svr.alloc_chunk_reused)) return 0;
+	if(!ssl_printf(ssl, "%s.alloc.chunk.malloced"SQ"%lu\n", nm,
+		(unsigned long)s->svr.alloc_chunk_malloced)) return 0;
+	if(!ssl_printf(ssl, "%s.alloc.chunk.freed"SQ"%lu\n", nm,
+		(unsigned long)s->svr.alloc_chunk_freed)) return 0;
 	return 1;
 }
 
@@ -823,7 +841,7 @@ print_longnum(SSL* ssl, const char* desc, size_t x)
 static int
 print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 {
-	size_t msg, rrset, val, iter, respip;
+	size_t msg, rrset, val, iter, respip, hugepage;
 #ifdef CLIENT_SUBNET
 	size_t subnet = 0;
 #endif /* CLIENT_SUBNET */
@@ -836,6 +854,7 @@ print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 #endif /* USE_DNSCRYPT */
 	msg = slabhash_get_mem(daemon->env->msg_cache);
 	rrset = slabhash_get_mem(&daemon->env->rrset_cache->table);
+	hugepage = daemon_get_hugepage_mem(daemon);
 	val = mod_get_mem(&worker->env, "validator");
 	iter = mod_get_mem(&worker->env, "iterator");
 	respip = mod_get_mem(&worker->env, "respip");
@@ -857,6 +876,8 @@ print_mem(SSL* ssl, struct worker* worker, struct daemon* daemon)
 		return 0;
 	if(!print_longnum(ssl, "mem.cache.message"SQ, msg))
 		return 0;
+	if(!print_longnum(ssl, "mem.cache.hugepage"SQ, hugepage))
+		return 0;
 	if(!print_longnum(ssl, "mem.mod.iterator"SQ, iter))
 		return 0;
 	if(!print_longnum(ssl, "mem.mod.validator"SQ, val))
@@ -929,6 +950,81 @@ print_hist(SSL* ssl, struct ub_stats_info* s)
 	return 1;
 }
 
+/** print a latency histogram as count and quantiles */
+static int
+print_lat(SSL* ssl, const char* nm, long long* array)
+{
+	if(!ssl_printf(ssl, "latency.%s.count"SQ"%lu\n", nm,
+		(unsigned long)lathist_count(array))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p50"SQ"%g\n", nm,
+		lathist_quantile(array, 0.50))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p90"SQ"%g\n", nm,
+		lathist_quantile(array, 0.90))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p99"SQ"%g\n", nm,
+		lathist_quantile(array, 0.99))) return 0;
+	if(!ssl_printf(ssl, "latency.%s.p999"SQ"%g\n", nm,
+		lathist_quantile(array, 0.999))) return 0;
+	return 1;
+}
+
+/** print the latency histograms */
+static int
+print_latency(SSL* ssl, struct worker* worker, struct ub_stats_ext* ext)
+{
+	int i;
+	char nm[64];
+	struct module_stack* mods = &worker->env.mesh->mods;
+	if(!print_lat(ssl, "cache", ext->lat_cache)) return 0;
+	if(!print_lat(ssl, "local", ext->lat_local)) return 0;
+	if(!print_lat(ssl, "recursion", ext->lat_recursion)) return 0;
+	if(!print_lat(ssl, "upstream", ext->lat_upstream)) return 0;
+	for(i=0; i<mods->num && i<UB_STATS_MODULE_NUM; i++) {
+		snprintf(nm, sizeof(nm), "module.%s", mods->mod[i]->name);
+		if(!print_lat(ssl, nm, ext->lat_module[i])) return 0;
+	}
+	return 1;
+}
+
+/** print the operate call accounting of the modules */
+static int
+print_modules(SSL* ssl, struct worker* worker, struct ub_stats_ext* ext)
+{
+	int i, m;
+	struct module_stack* mods = &worker->env.mesh->mods;
+	for(i=0; i<mods->num && i<UB_STATS_MODULE_NUM; i++) {
+		const char* nm = mods->mod[i]->name;
+		long long calls = 0, usec = 0, alloc = 0;
+		for(m=0; m<UB_STATS_MODSTATE_NUM; m++) {
+			calls += ext->mod_calls[i][m];
+			usec += ext->mod_usec[i][m];
+			alloc += ext->mod_alloc[i][m];
+		}
+		if(!ssl_printf(ssl, "module.%s.calls"SQ"%lu\n", nm,
+			(unsigned long)calls)) return 0;
+		if(!ssl_printf(ssl, "module.%s.time"SQ"%g\n", nm,
+			(double)usec/1000000.)) return 0;
+		if(!ssl_printf(ssl, "module.%s.alloc"SQ"%lu\n", nm,
+			(unsigned long)alloc)) return 0;
+		for(m=0; m<UB_STATS_MODSTATE_NUM; m++) {
+			/* the state name without the module_ prefix */
+			const char* st = strextstate((enum module_ext_state)m)
+				+ strlen("module_");
+			if(ext->mod_calls[i][m] == 0)
+				continue;
+			if(!ssl_printf(ssl, "module.%s.%s.calls"SQ"%lu\n", nm,
+				st, (unsigned long)ext->mod_calls[i][m]))
+				return 0;
+			if(!ssl_printf(ssl, "module.%s.%s.time"SQ"%g\n", nm,
+				st, (double)ext->mod_usec[i][m]/1000000.))
+				return 0;
+			if(!ssl_printf(ssl, "module.%s.%s.alloc"SQ"%lu\n", nm,
+				st, (unsigned long)ext->mod_alloc[i][m]))
+				return 0;
+		}
+	}
+	return 1;
+}
+
 /** print extended stats */
 static int
 print_ext(SSL* ssl, struct ub_stats_info* s)
@@ -1044,6 +1140,12 @@ print_ext(SSL* ssl, struct ub_stats_info* s)
 	/* iteration */
 	if(!ssl_printf(ssl, "num.query.ratelimited"SQ"%lu\n", 
 		(unsigned long)s->svr.queries_ratelimited)) return 0;
+	if(!ssl_printf(ssl, "num.query.race.sent"SQ"%lu\n", 
+		(unsigned long)s->svr.race_sent)) return 0;
+	if(!ssl_printf(ssl, "num.query.race.won"SQ"%lu\n", 
+		(unsigned long)s->svr.race_won)) return 0;
+	if(!ssl_printf(ssl, "num.query.race.wasted"SQ"%lu\n", 
+		(unsigned long)s->svr.race_wasted)) return 0;
 	/* validation */
 	if(!ssl_printf(ssl, "num.answer.secure"SQ"%lu\n", 
 		(unsigned long)s->svr.ans_secure)) return 0;
@@ -1085,31 +1187,53 @@ do_stats(SSL* ssl, struct daemon_remote* rc, int reset)
 	struct daemon* daemon = rc->worker->daemon;
 	struct ub_stats_info total;
 	struct ub_stats_info s;
+	struct ub_stats_ext* ext = NULL, *ext_total = NULL;
 	int i;
 	log_assert(daemon->num > 0);
+	if(daemon->cfg->stat_extended) {
+		ext = (struct ub_stats_ext*)malloc(sizeof(*ext));
+		ext_total = (struct ub_stats_ext*)calloc(1,
+			sizeof(*ext_total));
+		if(!ext || !ext_total) {
+			free(ext);
+			free(ext_total);
+			(void)ssl_printf(ssl, "error out of memory\n");
+			return;
+		}
+	}
 	/* gather all thread statistics in one place */
 	for(i=0; i<daemon->num; i++) {
-		server_stats_obtain(rc->worker, daemon->workers[i], &s, reset);
+		server_stats_obtain(rc->worker, daemon->workers[i], &s, ext,
+			reset);
 		if(!print_thread_stats(ssl, i, &s))
-			return;
+			goto out;
 		if(i == 0)
 			total = s;
 		else	server_stats_add(&total, &s);
+		if(ext)
+			server_stats_ext_add(ext_total, ext);
 	}
 	/* print the thread statistics */
 	total.mesh_time_median /= (double)daemon->num;
 	if(!print_stats(ssl, "total", &total)) 
-		return;
+		goto out;
 	if(!print_uptime(ssl, rc->worker, reset))
-		return;
+		goto out;
 	if(daemon->cfg->stat_extended) {
 		if(!print_mem(ssl, rc->worker, daemon)) 
-			return;
+			goto out;
 		if(!print_hist(ssl, &total))
-			return;
+			goto out;
+		if(!print_latency(ssl, rc->worker, ext_total))
+			goto out;
+		if(!print_modules(ssl, rc->worker, ext_total))
+			goto out;
 		if(!print_ext(ssl, &total))
-			return;
+			goto out;
 	}
+out:
+	free(ext);
+	free(ext_total);
 }
 
 /** parse commandline argument domain name */
@@ -2325,7 +2449,8 @@ static void
 do_dump_requestlist(SSL* ssl, struct worker* worker)
 {
 	struct mesh_area* mesh;
-	struct mesh_state* m;
+	struct mesh_state* m, **list;
+	size_t i, listnum;
 	int num = 0;
 	char buf[257];
 	char timebuf[32];
@@ -2337,9 +2462,16 @@ do_dump_requestlist(SSL* ssl, struct worker* worker)
 	/* show worker mesh contents */
 	mesh = worker->env.mesh;
 	if(!mesh) return;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
-		char* t = sldns_wire2str_type(m->s.qinfo.qtype);
-		char* c = sldns_wire2str_class(m->s.qinfo.qclass);
+	list = mesh_list_sorted(mesh, &listnum);
+	if(!list && mesh->all_count != 0) {
+		(void)ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	for(i=0; i<listnum; i++) {
+		char* t, *c;
+		m = list[i];
+		t = sldns_wire2str_type(m->s.qinfo.qtype);
+		c = sldns_wire2str_class(m->s.qinfo.qclass);
 		dname_str(m->s.qinfo.qname, buf);
 		get_mesh_age(m, timebuf, sizeof(timebuf), &worker->env);
 		get_mesh_status(mesh, m, statbuf, sizeof(statbuf));
@@ -2348,12 +2480,14 @@ do_dump_requestlist(SSL* ssl, struct worker* worker)
 			statbuf)) {
 			free(t);
 			free(c);
+			free(list);
 			return;
 		}
 		num++;
 		free(t);
 		free(c);
 	}
+	free(list);
 }
 
 /** structure for argument data for dump infra host */
@@ -2705,12 +2839,99 @@ do_ip_ratelimit_list(SSL* ssl, struct worker* worker, char* arg)
 	arg = skipwhite(arg);
 	if(strcmp(arg, "+a") == 0)
 		a.all = 1;
+	if(a.infra->client_ip_sketch) {
+		(void)ssl_printf(ssl, "error ip_ratelimit_list is not "
+			"available with ip-ratelimit-sketch\n");
+		return;
+	}
 	if(a.infra->client_ip_rates==NULL ||
 		(a.all == 0 && infra_ip_ratelimit == 0))
 		return;
 	slabhash_traverse(a.infra->client_ip_rates, 0, ip_rate_list, &a);
 }
 
+/** do the heavy_hitters command */
+static void
+do_heavy_hitters(SSL* ssl, struct worker* worker, char* arg)
+{
+	struct topk* merged[UB_STATS_HEAVY_CAT_NUM];
+	struct topk_entry** list;
+	char buf[LDNS_MAX_DOMAINLEN+1];
+	size_t i, n, num = 10;
+	int c;
+	arg = skipwhite(arg);
+	if(*arg) {
+		if(atoi(arg) <= 0) {
+			ssl_printf(ssl, "error expected a number\n");
+			return;
+		}
+		num = (size_t)atoi(arg);
+	}
+	if(!worker->heavy[0]) {
+		ssl_printf(ssl, "error heavy-hitters-size is 0\n");
+		return;
+	}
+	if(!server_stats_heavy_merge(worker, merged)) {
+		ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	list = (struct topk_entry**)malloc(sizeof(*list)*merged[0]->max);
+	if(!list) {
+		for(c=0; c<UB_STATS_HEAVY_CAT_NUM; c++)
+			topk_delete(merged[c]);
+		ssl_printf(ssl, "error out of memory\n");
+		return;
+	}
+	for(c=0; c<UB_STATS_HEAVY_CAT_NUM; c++) {
+		n = topk_sorted(merged[c], list);
+		for(i=0; i<n && i<num; i++) {
+			server_stats_heavy_str(c, list[i], buf, sizeof(buf));
+			if(!ssl_printf(ssl, "%s %s %lld error %lld\n",
+				server_stats_heavy_cat(c), buf,
+				list[i]->count, list[i]->err))
+				break;
+		}
+		topk_delete(merged[c]);
+	}
+	free(list);
+}
+
+/** do the slab_stats command */
+static void
+do_slab_stats(SSL* ssl, struct worker* worker)
+{
+	struct slab_depot* d = worker->daemon->superalloc.depot;
+	struct slab_class_stats st[SLAB_CLASSES];
+	size_t used, mem = 0, mem_used = 0, asize, aused;
+	int c, atype;
+	if(!d) {
+		ssl_printf(ssl, "error no slab depot\n");
+		return;
+	}
+	slab_depot_stats(d, st);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		if(st[c].slabs == 0)
+			continue;
+		used = st[c].objects - st[c].free_slab - st[c].free_mag;
+		if(!ssl_printf(ssl, "size %u slabs %u objects %u used %u "
+			"free %u magazine %u\n", (unsigned)st[c].size,
+			(unsigned)st[c].slabs, (unsigned)st[c].objects,
+			(unsigned)used, (unsigned)st[c].free_slab,
+			(unsigned)st[c].free_mag))
+			return;
+		mem += st[c].slabs*SLAB_SIZE;
+		mem_used += used*st[c].size;
+	}
+	if(!ssl_printf(ssl, "total memory %u used %u fragmentation %.2f%%\n",
+		(unsigned)mem, (unsigned)mem_used,
+		mem?100.0*(double)(mem-mem_used)/(double)mem:0.0))
+		return;
+	slab_depot_hugepage(d, &asize, &aused, &atype);
+	(void)ssl_printf(ssl, "hugepage %s arena %u used %u coverage %.2f%%\n",
+		hugepage_type_str(atype), (unsigned)asize, (unsigned)aused,
+		mem?100.0*(double)aused/(double)mem:0.0);
+}
+
 /** tell other processes to execute the command */
 static void
 distribute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd)
@@ -2792,6 +3013,12 @@ execute_cmd(struct daemon_remote* rc, SSL* ssl, char* cmd,
 	} else if(cmdcmp(p, "ip_ratelimit_list", 17)) {
 		do_ip_ratelimit_list(ssl, worker, p+17);
 		return;
+	} else if(cmdcmp(p, "heavy_hitters", 13)) {
+		do_heavy_hitters(ssl, worker, p+13);
+		return;
+	} else if(cmdcmp(p, "slab_stats", 10)) {
+		do_slab_stats(ssl, worker);
+		return;
 	} else if(cmdcmp(p, "stub_add", 8)) {
 		/* must always distribute this cmd */
 		if(rc) distribute_cmd(rc, ssl, cmd);
@@ -45,6 +45,7 @@
 #endif
 #include <sys/time.h>
 #include <sys/types.h>
+#include <stddef.h>
 #include "daemon/stats.h"
 #include "daemon/worker.h"
 #include "daemon/daemon.h"
@@ -53,8 +54,11 @@
 #include "services/listen_dnsport.h"
 #include "util/config_file.h"
 #include "util/tube.h"
+#include "util/locks.h"
 #include "util/timehist.h"
 #include "util/net_help.h"
+#include "util/data/dname.h"
+#include "util/storage/topk.h"
 #include "validator/validator.h"
 #include "iterator/iterator.h"
 #include "sldns/sbuffer.h"
@@ -76,27 +80,76 @@ stats_timeval_add(long long* d_sec, long long* d_usec, long long add_sec, long l
 #endif
 }
 
+/** number of counters in the extended stats block, it has only
+ * long long counters */
+#define STATS_EXT_NUM (sizeof(struct ub_stats_ext)/sizeof(long long))
+/** number of counters in the server stats before the extended flag */
+#define STATS_SVR_HEAD_NUM (offsetof(struct ub_server_stats, extended) \
+	/sizeof(long long))
+/** number of counters in the server stats after the extended flag */
+#define STATS_SVR_TAIL_NUM ((sizeof(struct ub_server_stats) - \
+	offsetof(struct ub_server_stats, qtype))/sizeof(long long))
+
+/** copy counters, that the thread that owns them can be counting */
+static void
+stats_copy_ll(long long* d, long long* s, size_t num)
+{
+	size_t i;
+	for(i=0; i<num; i++)
+		d[i] = stat_get(s[i]);
+}
+
+/** zero counters, that other threads can be reading */
+static void
+stats_zero_ll(long long* d, size_t num)
+{
+	size_t i;
+	for(i=0; i<num; i++)
+		stat_set(d[i], 0);
+}
+
 void server_stats_init(struct ub_server_stats* stats, struct config_file* cfg)
 {
-	memset(stats, 0, sizeof(*stats));
-	stats->extended = cfg->stat_extended;
+	stats_zero_ll((long long*)stats, STATS_SVR_HEAD_NUM);
+	stat_set(stats->extended, cfg->stat_extended);
+	stats_zero_ll(&stats->qtype[0], STATS_SVR_TAIL_NUM);
+}
+
+void server_stats_ext_clear(struct ub_stats_ext* ext)
+{
+	stats_zero_ll((long long*)ext, STATS_EXT_NUM);
+}
+
+/** account the query list size in the max, that starts again after a
+ * statistics reset by remote control */
+static void
+server_stats_max_list(struct ub_server_stats* stats, struct worker* worker)
+{
+	unsigned int max_reset = stat_get(worker->stats_max_reset);
+	if(max_reset != worker->stats_max_reset_seen) {
+		stat_set(worker->stats_max_reset_seen, max_reset);
+		stat_set(stats->max_query_list_size, 0);
+	}
+	if((long long)worker->env.mesh->all_count > stats->max_query_list_size)
+		stat_set(stats->max_query_list_size,
+			(long long)worker->env.mesh->all_count);
 }
 
 void server_stats_querymiss(struct ub_server_stats* stats, struct worker* worker)
 {
-	stats->num_queries_missed_cache++;
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if((long long)worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = (long long)worker->env.mesh->all.count;
+	stat_inc(stats->num_queries_missed_cache);
+	stat_add(stats->sum_query_list_size,
+		(long long)worker->env.mesh->all_count);
+	server_stats_max_list(stats, worker);
 }
 
 void server_stats_prefetch(struct ub_server_stats* stats, struct worker* worker)
 {
-	stats->num_queries_prefetch++;
+	stat_inc(stats->num_queries_prefetch);
 	/* changes the query list size so account that, like a querymiss */
-	stats->sum_query_list_size += worker->env.mesh->all.count;
-	if((long long)worker->env.mesh->all.count > stats->max_query_list_size)
-		stats->max_query_list_size = (long long)worker->env.mesh->all.count;
+	stat_add(stats->sum_query_list_size,
+		(long long)worker->env.mesh->all_count);
+	server_stats_max_list(stats, worker);
 }
 
 void server_stats_log(struct ub_server_stats* stats, struct worker* worker,
@@ -158,6 +211,31 @@ get_queries_ratelimit(struct worker* worker, int reset)
 	return r;
 }
 
+/** get the upstream race counters from iterator */
+static void
+get_race_stats(struct worker* worker, struct ub_server_stats* svr, int reset)
+{
+	int m = modstack_find(&worker->env.mesh->mods, "iterator");
+	struct iter_env* ie;
+	if(m == -1) {
+		svr->race_sent = 0;
+		svr->race_won = 0;
+		svr->race_wasted = 0;
+		return;
+	}
+	ie = (struct iter_env*)worker->env.modinfo[m];
+	lock_basic_lock(&ie->race_lock);
+	svr->race_sent = (long long)ie->num_race_sent;
+	svr->race_won = (long long)ie->num_race_won;
+	svr->race_wasted = (long long)ie->num_race_wasted;
+	if(reset && !worker->env.cfg->stat_cumulative) {
+		ie->num_race_sent = 0;
+		ie->num_race_won = 0;
+		ie->num_race_wasted = 0;
+	}
+	lock_basic_unlock(&ie->race_lock);
+}
+
 #ifdef USE_DNSCRYPT
 /** get the number of shared secret cache miss */
 static size_t
@@ -191,41 +269,119 @@ get_dnscrypt_replay(struct worker* worker, int reset)
 }
 #endif /* USE_DNSCRYPT */
 
-void
-server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
+/** the median of the reply times in an exported histogram */
+static double
+stats_hist_median(long long* array)
+{
+	double m = 0.0;
+	struct timehist* hist = timehist_setup();
+	if(hist) {
+		timehist_import(hist, array, NUM_BUCKETS_HIST);
+		m = timehist_quartile(hist, 0.50);
+		timehist_delete(hist);
+	}
+	return m;
+}
+
+/** read the counters of a worker, that can be running in another thread,
+ * without clearing them */
+static void
+server_stats_read(struct worker* worker, struct ub_stats_info* s,
+	struct ub_stats_ext* ext)
 {
 	int i;
 	struct listen_list* lp;
+	struct mesh_area* mesh = worker->env.mesh;
 
-	s->svr = worker->stats;
-	s->mesh_num_states = (long long)worker->env.mesh->all.count;
-	s->mesh_num_reply_states = (long long)worker->env.mesh->num_reply_states;
-	s->mesh_jostled = (long long)worker->env.mesh->stats_jostled;
-	s->mesh_dropped = (long long)worker->env.mesh->stats_dropped;
-	s->mesh_replies_sent = (long long)worker->env.mesh->replies_sent;
-	s->mesh_replies_sum_wait_sec = (long long)worker->env.mesh->replies_sum_wait.tv_sec;
-	s->mesh_replies_sum_wait_usec = (long long)worker->env.mesh->replies_sum_wait.tv_usec;
-	s->mesh_time_median = timehist_quartile(worker->env.mesh->histogram,
-		0.50);
+	stats_copy_ll((long long*)&s->svr, (long long*)worker->stats,
+		STATS_SVR_HEAD_NUM);
+	s->svr.extended = stat_get(worker->stats->extended);
+	stats_copy_ll(&s->svr.qtype[0], &worker->stats->qtype[0],
+		STATS_SVR_TAIL_NUM);
+	s->mesh_num_states = (long long)stat_get(mesh->all_count);
+	s->mesh_num_reply_states = (long long)stat_get(mesh->num_reply_states);
+	s->mesh_jostled = (long long)stat_get(mesh->stats_jostled);
+	s->mesh_dropped = (long long)stat_get(mesh->stats_dropped);
+	s->mesh_replies_sent = (long long)stat_get(mesh->replies_sent);
+	s->mesh_replies_sum_wait_sec = (long long)stat_get(
+		mesh->replies_sum_wait.tv_sec);
+	s->mesh_replies_sum_wait_usec = (long long)stat_get(
+		mesh->replies_sum_wait.tv_usec);
 
 	/* add in the values from the mesh */
-	s->svr.ans_secure += (long long)worker->env.mesh->ans_secure;
-	s->svr.ans_bogus += (long long)worker->env.mesh->ans_bogus;
-	s->svr.ans_rcode_nodata += (long long)worker->env.mesh->ans_nodata;
+	s->svr.ans_secure += (long long)stat_get(mesh->ans_secure);
+	s->svr.ans_bogus += (long long)stat_get(mesh->ans_bogus);
+	s->svr.ans_rcode_nodata += (long long)stat_get(mesh->ans_nodata);
 	for(i=0; i<16; i++)
-		s->svr.ans_rcode[i] += (long long)worker->env.mesh->ans_rcode[i];
-	timehist_export(worker->env.mesh->histogram, s->svr.hist, 
-		NUM_BUCKETS_HIST);
+		s->svr.ans_rcode[i] += (long long)stat_get(mesh->ans_rcode[i]);
+	timehist_export(mesh->histogram, s->svr.hist, NUM_BUCKETS_HIST);
+	s->mesh_time_median = stats_hist_median(s->svr.hist);
+	if(ext) {
+		if(worker->stats_ext)
+			stats_copy_ll((long long*)ext,
+				(long long*)worker->stats_ext, STATS_EXT_NUM);
+		else	memset(ext, 0, sizeof(*ext));
+		/* latency histograms of the mesh, for the first modules */
+		stats_copy_ll(ext->lat_recursion, mesh->lat_recursion,
+			NUM_BUCKETS_LATHIST);
+		for(i=0; i<UB_STATS_MODULE_NUM && i<MAX_MODULE; i++) {
+			int m;
+			stats_copy_ll(ext->lat_module[i], mesh->lat_module
+				+ i*NUM_BUCKETS_LATHIST, NUM_BUCKETS_LATHIST);
+			for(m=0; m<UB_STATS_MODSTATE_NUM &&
+				m<MESH_MOD_STATE_NUM; m++) {
+				struct mesh_mod_stat* st = &mesh->mod_stat[i][m];
+				ext->mod_calls[i][m] = (long long)stat_get(
+					st->calls);
+				ext->mod_usec[i][m] = stat_get(st->usec);
+				ext->mod_alloc[i][m] = (long long)stat_get(
+					st->alloc);
+			}
+		}
+	}
 	/* values from outside network */
-	s->svr.unwanted_replies = (long long)worker->back->unwanted_replies;
-	s->svr.qtcp_outgoing = (long long)worker->back->num_tcp_outgoing;
+	s->svr.unwanted_replies = (long long)stat_get(
+		worker->back->unwanted_replies);
+	s->svr.qtcp_outgoing = (long long)stat_get(
+		worker->back->num_tcp_outgoing);
+
+	/* the object cache of the thread alloc */
+	s->svr.alloc_obj_reused = (long long)stat_get(worker->alloc.obj_reused);
+	s->svr.alloc_obj_malloced = (long long)stat_get(
+		worker->alloc.obj_malloced);
+	s->svr.alloc_obj_freed = (long long)stat_get(worker->alloc.obj_freed);
+	/* the regional chunk cache of the thread alloc */
+	s->svr.alloc_chunk_reused = (long long)stat_get(
+		worker->alloc.reg_cache.reused);
+	s->svr.alloc_chunk_malloced = (long long)stat_get(
+		worker->alloc.reg_cache.malloced);
+	s->svr.alloc_chunk_freed = (long long)stat_get(
+		worker->alloc.reg_cache.freed);
+
+	/* get tcp accept usage */
+	s->svr.tcp_accept_usage = 0;
+	for(lp = worker->front->cps; lp; lp = lp->next) {
+		if(lp->com->type == comm_tcp_accept)
+			s->svr.tcp_accept_usage += (long long)stat_get(
+				lp->com->cur_tcp_count);
+	}
+}
 
+/** read the counters that the modules and caches keep for all threads,
+ * they are reset where they are kept */
+static void
+server_stats_read_modules(struct worker* worker, struct ub_stats_info* s,
+	int reset)
+{
 	/* get and reset validator rrset bogus number */
 	s->svr.rrset_bogus = (long long)get_rrset_bogus(worker, reset);
 
 	/* get and reset iterator query ratelimit number */
 	s->svr.queries_ratelimited = (long long)get_queries_ratelimit(worker, reset);
 
+	/* get and reset iterator upstream race numbers */
+	get_race_stats(worker, &s->svr, reset);
+
 	/* get cache sizes */
 	s->svr.msg_cache_count = (long long)count_slabhash_entries(worker->env.msg_cache);
 	s->svr.rrset_cache_count = (long long)count_slabhash_entries(&worker->env.rrset_cache->table);
@@ -256,27 +412,198 @@ server_stats_compile(struct worker* worker, struct ub_stats_info* s, int reset)
 	s->svr.nonce_cache_count = 0;
 	s->svr.num_query_dnscrypt_replay = 0;
 #endif /* USE_DNSCRYPT */
+#ifdef USE_DNSTAP
+	s->svr.dnstap_dropped = (long long)dt_get_dropped(&worker->dtenv,
+		reset && !worker->env.cfg->stat_cumulative);
+#else
+	s->svr.dnstap_dropped = 0;
+#endif /* USE_DNSTAP */
+}
 
-	/* get tcp accept usage */
-	s->svr.tcp_accept_usage = 0;
-	for(lp = worker->front->cps; lp; lp = lp->next) {
-		if(lp->com->type == comm_tcp_accept)
-			s->svr.tcp_accept_usage += (long long)lp->com->cur_tcp_count;
-	}
-
+void
+server_stats_compile(struct worker* worker, struct ub_stats_info* s,
+	struct ub_stats_ext* ext, int reset)
+{
+	server_stats_read(worker, s, ext);
+	server_stats_read_modules(worker, s, reset);
 	if(reset && !worker->env.cfg->stat_cumulative) {
 		worker_stats_clear(worker);
 	}
 }
 
+#ifdef STATS_SHARED
+/** subtract timers, the values do not become negative */
+static void
+stats_timeval_subtract(long long* d_sec, long long* d_usec, long long sub_sec,
+	long long sub_usec)
+{
+	*d_sec -= sub_sec;
+	*d_usec -= sub_usec;
+	if(*d_usec < 0) {
+		*d_usec += 1000000;
+		(*d_sec)--;
+	}
+	if(*d_sec < 0) {
+		*d_sec = 0;
+		*d_usec = 0;
+	}
+}
+
+/** subtract the counters in base from s, the gauges, like cache counts,
+ * and the counters that are reset where they are kept are left alone */
+static void
+server_stats_subtract(struct ub_stats_info* s, struct ub_stats_info* base)
+{
+	int i;
+	s->svr.num_queries -= base->svr.num_queries;
+	s->svr.num_queries_ip_ratelimited -=
+		base->svr.num_queries_ip_ratelimited;
+	s->svr.num_queries_missed_cache -= base->svr.num_queries_missed_cache;
+	s->svr.num_queries_prefetch -= base->svr.num_queries_prefetch;
+	s->svr.sum_query_list_size -= base->svr.sum_query_list_size;
+#ifdef USE_DNSCRYPT
+	s->svr.num_query_dnscrypt_crypted -=
+		base->svr.num_query_dnscrypt_crypted;
+	s->svr.num_query_dnscrypt_cert -= base->svr.num_query_dnscrypt_cert;
+	s->svr.num_query_dnscrypt_cleartext -=
+		base->svr.num_query_dnscrypt_cleartext;
+	s->svr.num_query_dnscrypt_crypted_malformed -=
+		base->svr.num_query_dnscrypt_crypted_malformed;
+#endif /* USE_DNSCRYPT */
+	s->svr.qtype_big -= base->svr.qtype_big;
+	s->svr.qclass_big -= base->svr.qclass_big;
+	s->svr.qtcp -= base->svr.qtcp;
+	s->svr.qtcp_outgoing -= base->svr.qtcp_outgoing;
+	s->svr.qipv6 -= base->svr.qipv6;
+	s->svr.qbit_QR -= base->svr.qbit_QR;
+	s->svr.qbit_AA -= base->svr.qbit_AA;
+	s->svr.qbit_TC -= base->svr.qbit_TC;
+	s->svr.qbit_RD -= base->svr.qbit_RD;
+	s->svr.qbit_RA -= base->svr.qbit_RA;
+	s->svr.qbit_Z -= base->svr.qbit_Z;
+	s->svr.qbit_AD -= base->svr.qbit_AD;
+	s->svr.qbit_CD -= base->svr.qbit_CD;
+	s->svr.qEDNS -= base->svr.qEDNS;
+	s->svr.qEDNS_DO -= base->svr.qEDNS_DO;
+	s->svr.ans_rcode_nodata -= base->svr.ans_rcode_nodata;
+	s->svr.zero_ttl_responses -= base->svr.zero_ttl_responses;
+	s->svr.ans_secure -= base->svr.ans_secure;
+	s->svr.ans_bogus -= base->svr.ans_bogus;
+	s->svr.unwanted_replies -= base->svr.unwanted_replies;
+	s->svr.unwanted_queries -= base->svr.unwanted_queries;
+	s->svr.alloc_obj_reused -= base->svr.alloc_obj_reused;
+	s->svr.alloc_obj_malloced -= base->svr.alloc_obj_malloced;
+	s->svr.alloc_obj_freed -= base->svr.alloc_obj_freed;
+	s->svr.alloc_chunk_reused -= base->svr.alloc_chunk_reused;
+	s->svr.alloc_chunk_malloced -= base->svr.alloc_chunk_malloced;
+	s->svr.alloc_chunk_freed -= base->svr.alloc_chunk_freed;
+	for(i=0; i<UB_STATS_QTYPE_NUM; i++)
+		s->svr.qtype[i] -= base->svr.qtype[i];
+	for(i=0; i<UB_STATS_QCLASS_NUM; i++)
+		s->svr.qclass[i] -= base->svr.qclass[i];
+	for(i=0; i<UB_STATS_OPCODE_NUM; i++)
+		s->svr.qopcode[i] -= base->svr.qopcode[i];
+	for(i=0; i<UB_STATS_RCODE_NUM; i++)
+		s->svr.ans_rcode[i] -= base->svr.ans_rcode[i];
+	for(i=0; i<NUM_BUCKETS_HIST; i++)
+		s->svr.hist[i] -= base->svr.hist[i];
+
+	s->mesh_jostled -= base->mesh_jostled;
+	s->mesh_dropped -= base->mesh_dropped;
+	s->mesh_replies_sent -= base->mesh_replies_sent;
+	stats_timeval_subtract(&s->mesh_replies_sum_wait_sec,
+		&s->mesh_replies_sum_wait_usec, base->mesh_replies_sum_wait_sec,
+		base->mesh_replies_sum_wait_usec);
+	/* the median of the replies since the base */
+	s->mesh_time_median = stats_hist_median(s->svr.hist);
+}
+
+/** subtract the base from the extended counters, and if reset, store
+ * the counters that were read as the new base */
+static void
+server_stats_ext_rebase(struct ub_stats_ext* ext, struct ub_stats_ext* base,
+	int sub, int reset)
+{
+	long long* e = (long long*)ext;
+	long long* b = (long long*)base;
+	size_t i;
+	for(i=0; i<STATS_EXT_NUM; i++) {
+		long long raw = e[i];
+		if(sub)
+			e[i] -= b[i];
+		if(reset)
+			b[i] = raw;
+	}
+}
+
+/** read the counters of a running worker, that counts on in its own
+ * thread, and report them from the base on.  With reset, the counters
+ * that were read are the new base */
+static void
+server_stats_fetch(struct worker* who, struct ub_stats_info* s,
+	struct ub_stats_ext* ext, struct worker_stats_base* base, int reset,
+	int modreset)
+{
+	struct ub_stats_info raw;
+	unsigned int gen;
+	int tries = 0, sub;
+	/* read the counters, if the worker clears them halfway, read
+	 * again */
+	do {
+		gen = stat_get_acquire(who->stats_gen);
+		server_stats_read(who, &raw, ext);
+		stat_fence_acquire();
+	} while(((gen&1) || gen != stat_get(who->stats_gen)) &&
+		++tries < 10);
+	/* once, after the read, the counters that are reset where they
+	 * are kept */
+	server_stats_read_modules(who, &raw, modreset);
+	*s = raw;
+	if(who->env.cfg->stat_cumulative)
+		return;
+	/* a clear by the worker itself, on the stats timer or with
+	 * flush_stats, makes the base stale */
+	sub = (base->set && base->gen == gen);
+	if(sub)
+		server_stats_subtract(s, &base->info);
+	if(ext && base->ext)
+		server_stats_ext_rebase(ext, base->ext, sub, reset);
+	/* the worker has not sampled the list size since the reset */
+	if(stat_get(who->stats_max_reset) !=
+		stat_get(who->stats_max_reset_seen))
+		s->svr.max_query_list_size = 0;
+	if(reset) {
+		server_stats_heavy_clear(who);
+		stat_set(who->stats_max_reset, who->stats_max_reset+1);
+		base->info = raw;
+		base->gen = gen;
+		base->set = 1;
+	}
+}
+
+void server_stats_obtain(struct worker* ATTR_UNUSED(worker),
+	struct worker* who, struct ub_stats_info* s, struct ub_stats_ext* ext,
+	int reset)
+{
+	server_stats_fetch(who, s, ext, &who->stats_base, reset, reset);
+}
+
+void server_stats_shm(struct worker* who, struct ub_stats_info* s,
+	struct ub_stats_ext* ext)
+{
+	server_stats_fetch(who, s, ext, &who->shm_base,
+		!who->env.cfg->stat_cumulative, 0);
+}
+#else /* !STATS_SHARED */
 void server_stats_obtain(struct worker* worker, struct worker* who,
-	struct ub_stats_info* s, int reset)
+	struct ub_stats_info* s, struct ub_stats_ext* ext, int reset)
 {
 	uint8_t *reply = NULL;
 	uint32_t len = 0;
+	size_t want = sizeof(*s) + (ext?sizeof(*ext):0);
 	if(worker == who) {
 		/* just fill it in */
-		server_stats_compile(worker, s, reset);
+		server_stats_compile(worker, s, ext, reset);
 		return;
 	}
 	/* communicate over tube */
@@ -287,22 +614,31 @@ void server_stats_obtain(struct worker* worker, struct worker* who,
 	verbose(VERB_ALGO, "wait for stats reply");
 	if(!tube_read_msg(worker->cmd, &reply, &len, 0))
 		fatal_exit("failed to read stats over cmd channel");
-	if(len != (uint32_t)sizeof(*s))
+	if(len != (uint32_t)want)
 		fatal_exit("stats on cmd channel wrong length %d %d",
-			(int)len, (int)sizeof(*s));
-	memcpy(s, reply, (size_t)len);
+			(int)len, (int)want);
+	memcpy(s, reply, sizeof(*s));
+	if(ext)
+		memcpy(ext, reply+sizeof(*s), sizeof(*ext));
 	free(reply);
 }
 
 void server_stats_reply(struct worker* worker, int reset)
 {
-	struct ub_stats_info s;
-	server_stats_compile(worker, &s, reset);
+	uint8_t* reply;
+	size_t len = sizeof(struct ub_stats_info) +
+		(worker->stats_ext?sizeof(struct ub_stats_ext):0);
+	if(!(reply = (uint8_t*)malloc(len)))
+		fatal_exit("out of memory for stat values");
+	server_stats_compile(worker, (struct ub_stats_info*)reply,
+		worker->stats_ext?(struct ub_stats_ext*)(reply+
+		sizeof(struct ub_stats_info)):NULL, reset);
 	verbose(VERB_ALGO, "write stats replymsg");
-	if(!tube_write_msg(worker->daemon->workers[0]->cmd, 
-		(uint8_t*)&s, sizeof(s), 0))
+	if(!tube_write_msg(worker->daemon->workers[0]->cmd, reply, len, 0))
 		fatal_exit("could not write stat values over cmd channel");
+	free(reply);
 }
+#endif /* STATS_SHARED */
 
 void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 {
@@ -319,6 +655,15 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 	total->svr.num_query_dnscrypt_crypted_malformed += \
 		a->svr.num_query_dnscrypt_crypted_malformed;
 #endif /* USE_DNSCRYPT */
+#ifdef USE_DNSTAP
+	total->svr.dnstap_dropped += a->svr.dnstap_dropped;
+#endif /* USE_DNSTAP */
+	total->svr.alloc_obj_reused += a->svr.alloc_obj_reused;
+	total->svr.alloc_obj_malloced += a->svr.alloc_obj_malloced;
+	total->svr.alloc_obj_freed += a->svr.alloc_obj_freed;
+	total->svr.alloc_chunk_reused += a->svr.alloc_chunk_reused;
+	total->svr.alloc_chunk_malloced += a->svr.alloc_chunk_malloced;
+	total->svr.alloc_chunk_freed += a->svr.alloc_chunk_freed;
 	/* the max size reached is upped to higher of both */
 	if(a->svr.max_query_list_size > total->svr.max_query_list_size)
 		total->svr.max_query_list_size = a->svr.max_query_list_size;
@@ -371,42 +716,51 @@ void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a)
 	total->mesh_time_median += a->mesh_time_median;
 }
 
+void server_stats_ext_add(struct ub_stats_ext* total, struct ub_stats_ext* a)
+{
+	long long* t = (long long*)total;
+	long long* e = (long long*)a;
+	size_t i;
+	for(i=0; i<STATS_EXT_NUM; i++)
+		t[i] += e[i];
+}
+
 void server_stats_insquery(struct ub_server_stats* stats, struct comm_point* c,
 	uint16_t qtype, uint16_t qclass, struct edns_data* edns,
 	struct comm_reply* repinfo)
 {
 	uint16_t flags = sldns_buffer_read_u16_at(c->buffer, 2);
 	if(qtype < UB_STATS_QTYPE_NUM)
-		stats->qtype[qtype]++;
-	else	stats->qtype_big++;
+		stat_inc(stats->qtype[qtype]);
+	else	stat_inc(stats->qtype_big);
 	if(qclass < UB_STATS_QCLASS_NUM)
-		stats->qclass[qclass]++;
-	else	stats->qclass_big++;
-	stats->qopcode[ LDNS_OPCODE_WIRE(sldns_buffer_begin(c->buffer)) ]++;
+		stat_inc(stats->qclass[qclass]);
+	else	stat_inc(stats->qclass_big);
+	stat_inc(stats->qopcode[ LDNS_OPCODE_WIRE(sldns_buffer_begin(c->buffer)) ]);
 	if(c->type != comm_udp)
-		stats->qtcp++;
+		stat_inc(stats->qtcp);
 	if(repinfo && addr_is_ip6(&repinfo->addr, repinfo->addrlen))
-		stats->qipv6++;
+		stat_inc(stats->qipv6);
 	if( (flags&BIT_QR) )
-		stats->qbit_QR++;
+		stat_inc(stats->qbit_QR);
 	if( (flags&BIT_AA) )
-		stats->qbit_AA++;
+		stat_inc(stats->qbit_AA);
 	if( (flags&BIT_TC) )
-		stats->qbit_TC++;
+		stat_inc(stats->qbit_TC);
 	if( (flags&BIT_RD) )
-		stats->qbit_RD++;
+		stat_inc(stats->qbit_RD);
 	if( (flags&BIT_RA) )
-		stats->qbit_RA++;
+		stat_inc(stats->qbit_RA);
 	if( (flags&BIT_Z) )
-		stats->qbit_Z++;
+		stat_inc(stats->qbit_Z);
 	if( (flags&BIT_AD) )
-		stats->qbit_AD++;
+		stat_inc(stats->qbit_AD);
 	if( (flags&BIT_CD) )
-		stats->qbit_CD++;
+		stat_inc(stats->qbit_CD);
 	if(edns->edns_present) {
-		stats->qEDNS++;
+		stat_inc(stats->qEDNS);
 		if( (edns->bits & EDNS_DO) )
-			stats->qEDNS_DO++;
+			stat_inc(stats->qEDNS_DO);
 	}
 }
 
@@ -414,8 +768,156 @@ void server_stats_insrcode(struct ub_server_stats* stats, sldns_buffer* buf)
 {
 	if(stats->extended && sldns_buffer_limit(buf) != 0) {
 		int r = (int)LDNS_RCODE_WIRE( sldns_buffer_begin(buf) );
-		stats->ans_rcode[r] ++;
+		stat_inc(stats->ans_rcode[r]);
 		if(r == 0 && LDNS_ANCOUNT( sldns_buffer_begin(buf) ) == 0)
-			stats->ans_rcode_nodata ++;
+			stat_inc(stats->ans_rcode_nodata);
+	}
+}
+
+/** make the heavy hitter key for an address, the port is kept if asked,
+ * for a client it is different for every query */
+static size_t
+heavy_addr_key(struct sockaddr_storage* addr, socklen_t addrlen,
+	int keep_port, uint8_t* key)
+{
+	struct sockaddr_storage k;
+	memset(&k, 0, sizeof(k));
+	if(addr_is_ip6(addr, addrlen)) {
+		struct sockaddr_in6* in6 = (struct sockaddr_in6*)&k;
+		in6->sin6_family = AF_INET6;
+		in6->sin6_addr = ((struct sockaddr_in6*)addr)->sin6_addr;
+		if(keep_port)
+			in6->sin6_port = ((struct sockaddr_in6*)addr)->sin6_port;
+	} else if(((struct sockaddr_in*)addr)->sin_family == AF_INET) {
+		struct sockaddr_in* in = (struct sockaddr_in*)&k;
+		in->sin_family = AF_INET;
+		in->sin_addr = ((struct sockaddr_in*)addr)->sin_addr;
+		if(keep_port)
+			in->sin_port = ((struct sockaddr_in*)addr)->sin_port;
+	} else	memmove(&k, addr, addrlen);
+	if(addrlen > TOPK_KEY_MAX)
+		addrlen = TOPK_KEY_MAX;
+	memmove(key, &k, addrlen);
+	return (size_t)addrlen;
+}
+
+/** copy the name, lowercased, as heavy hitter key */
+static size_t
+heavy_name_key(uint8_t* name, size_t len, uint8_t* key)
+{
+	memmove(key, name, len);
+	query_dname_tolower(key);
+	return len;
+}
+
+void server_stats_heavy_query(struct worker* worker,
+	struct comm_reply* repinfo, struct query_info* qinfo)
+{
+	uint8_t key[TOPK_KEY_MAX];
+	uint8_t* d = qinfo->qname;
+	size_t dlen = qinfo->qname_len;
+	int labs;
+	if(!worker->heavy[UB_STATS_HEAVY_CLIENT])
+		return;
+	lock_basic_lock(&worker->heavy_lock);
+	topk_add(worker->heavy[UB_STATS_HEAVY_CLIENT], key,
+		heavy_addr_key(&repinfo->addr, repinfo->addrlen, 0, key),
+		1, 0);
+	topk_add(worker->heavy[UB_STATS_HEAVY_QNAME], key,
+		heavy_name_key(qinfo->qname, qinfo->qname_len, key), 1, 0);
+	/* the domain is the last two labels, there is no list of public
+	 * suffixes, for names under a suffix like co.uk it is that suffix */
+	labs = dname_count_labels(qinfo->qname);
+	while(labs-- > 3)
+		dname_remove_label(&d, &dlen);
+	topk_add(worker->heavy[UB_STATS_HEAVY_DOMAIN], key,
+		heavy_name_key(d, dlen, key), 1, 0);
+	lock_basic_unlock(&worker->heavy_lock);
+}
+
+void server_stats_heavy_upstream(struct worker* worker,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	uint8_t key[TOPK_KEY_MAX];
+	if(!worker->heavy[UB_STATS_HEAVY_UPSTREAM])
+		return;
+	lock_basic_lock(&worker->heavy_lock);
+	topk_add(worker->heavy[UB_STATS_HEAVY_UPSTREAM], key,
+		heavy_addr_key(addr, addrlen, 1, key), 1, 0);
+	lock_basic_unlock(&worker->heavy_lock);
+}
+
+void server_stats_heavy_clear(struct worker* worker)
+{
+	int i;
+	if(!worker->heavy[0])
+		return;
+	lock_basic_lock(&worker->heavy_lock);
+	for(i=0; i<UB_STATS_HEAVY_CAT_NUM; i++)
+		topk_clear(worker->heavy[i]);
+	lock_basic_unlock(&worker->heavy_lock);
+}
+
+int server_stats_heavy_merge(struct worker* worker, struct topk** merged)
+{
+	struct daemon* daemon = worker->daemon;
+	int i, c;
+	memset(merged, 0, sizeof(*merged)*UB_STATS_HEAVY_CAT_NUM);
+	if(!worker->heavy[0])
+		return 0;
+	/* large enough for the entries of all threads, so that the sum is
+	 * not evicted while merging */
+	for(c=0; c<UB_STATS_HEAVY_CAT_NUM; c++) {
+		merged[c] = topk_create(worker->heavy[0]->max*daemon->num);
+		if(!merged[c]) {
+			while(c-- > 0)
+				topk_delete(merged[c]);
+			return 0;
+		}
+	}
+	for(i=0; i<daemon->num; i++) {
+		struct worker* w = daemon->workers[i];
+		if(!w || !w->heavy[0])
+			continue;
+		lock_basic_lock(&w->heavy_lock);
+		for(c=0; c<UB_STATS_HEAVY_CAT_NUM; c++)
+			topk_merge(merged[c], w->heavy[c]);
+		lock_basic_unlock(&w->heavy_lock);
+	}
+	return 1;
+}
+
+void server_stats_heavy_str(int cat, struct topk_entry* e, char* buf,
+	size_t len)
+{
+	if(cat == UB_STATS_HEAVY_CLIENT || cat == UB_STATS_HEAVY_UPSTREAM) {
+		struct sockaddr_storage addr;
+		socklen_t addrlen = (socklen_t)e->len;
+		char ip[128];
+		memset(&addr, 0, sizeof(addr));
+		memmove(&addr, e->key, e->len);
+		addr_to_str(&addr, addrlen, ip, sizeof(ip));
+		if(cat == UB_STATS_HEAVY_UPSTREAM)
+			snprintf(buf, len, "%s@%d", ip,
+				(int)ntohs(((struct sockaddr_in*)&addr)->sin_port));
+		else	snprintf(buf, len, "%s", ip);
+		return;
+	}
+	if(len < LDNS_MAX_DOMAINLEN+1) {
+		snprintf(buf, len, "?");
+		return;
+	}
+	dname_str(e->key, buf);
+}
+
+const char* server_stats_heavy_cat(int cat)
+{
+	switch(cat) {
+	case UB_STATS_HEAVY_CLIENT: return "client";
+	case UB_STATS_HEAVY_QNAME: return "qname";
+	case UB_STATS_HEAVY_DOMAIN: return "domain";
+	case UB_STATS_HEAVY_UPSTREAM: return "upstream";
+	default: break;
 	}
+	return "unknown";
 }
@@ -49,6 +49,9 @@ struct comm_point;
 struct comm_reply;
 struct edns_data;
 struct sldns_buffer;
+struct query_info;
+struct topk;
+struct topk_entry;
 
 /* stats struct */
 #include "libunbound/unbound.h"
@@ -60,6 +63,12 @@ struct sldns_buffer;
  */
 void server_stats_init(struct ub_server_stats* stats, struct config_file* cfg);
 
+/**
+ * Initialize extended stats to 0.
+ * @param ext: what to clear.
+ */
+void server_stats_ext_clear(struct ub_stats_ext* ext);
+
 /** add query if it missed the cache */
 void server_stats_querymiss(struct ub_server_stats* stats, struct worker* worker);
 
@@ -71,40 +80,64 @@ void server_stats_log(struct ub_server_stats* stats, struct worker* worker,
 	int threadnum);
 
 /**
- * Obtain the stats info for a given thread. Uses pipe to communicate.
+ * Obtain the stats info for a given thread. With STATS_SHARED the counters
+ * of the thread are read while it keeps running, it is not interrupted. A
+ * reset does not clear the counters of the thread, but sets a base that
+ * later values are reported from. Without it, the thread is asked for its
+ * statistics over its command pipe, and it clears them on a reset.
  * @param worker: the worker that is executing (the first worker).
  * @param who: on who to get the statistics info.
  * @param s: the stats block to fill in.
+ * @param ext: the extended stats block to fill in, or NULL.
  * @param reset: if stats can be reset.
  */
 void server_stats_obtain(struct worker* worker, struct worker* who,
-	struct ub_stats_info* s, int reset);
+	struct ub_stats_info* s, struct ub_stats_ext* ext, int reset);
+
+/**
+ * Obtain the stats info of a given thread for SHM, with STATS_SHARED.
+ * The counters are read while the thread keeps running, and without
+ * statistics-cumulative they are reported from the previous SHM interval on.
+ * @param who: on who to get the statistics info.
+ * @param s: the stats block to fill in.
+ * @param ext: the extended stats block to fill in, or NULL.
+ */
+void server_stats_shm(struct worker* who, struct ub_stats_info* s,
+	struct ub_stats_ext* ext);
+
+/**
+ * Compile stats into structure for this thread worker, and send them to
+ * the first worker over its command pipe. Without STATS_SHARED.
+ * @param worker: the worker that is executing, the stats of it are sent.
+ * @param reset: if the stats can be reset.
+ */
+void server_stats_reply(struct worker* worker, int reset);
 
 /**
  * Compile stats into structure for this thread worker.
  * Also clears the statistics counters (if that is set by config file).
  * @param worker: the worker to compile stats for, also the executing worker.
  * @param s: stats block.
+ * @param ext: extended stats block, or NULL.
  * @param reset: if true, depending on config stats are reset.
  * 	if false, statistics are not reset.
  */
 void server_stats_compile(struct worker* worker, struct ub_stats_info* s, 
-	int reset);
+	struct ub_stats_ext* ext, int reset);
 
 /**
- * Send stats over comm tube in reply to query cmd
- * @param worker: this worker.
- * @param reset: if true, depending on config stats are reset.
- * 	if false, statistics are not reset.
+ * Addup stat blocks.
+ * @param total: sum of the two entries.
+ * @param a: to add to it.
  */
-void server_stats_reply(struct worker* worker, int reset);
+void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a);
 
 /**
- * Addup stat blocks.
+ * Addup extended stat blocks.
  * @param total: sum of the two entries.
  * @param a: to add to it.
  */
-void server_stats_add(struct ub_stats_info* total, struct ub_stats_info* a);
+void server_stats_ext_add(struct ub_stats_ext* total, struct ub_stats_ext* a);
 
 /**
  * Add stats for this query
@@ -126,4 +159,54 @@ void server_stats_insquery(struct ub_server_stats* stats, struct comm_point* c,
  */
 void server_stats_insrcode(struct ub_server_stats* stats, struct sldns_buffer* buf);
 
+/**
+ * Count the query for the client, query name and domain heavy hitters.
+ * @param worker: the worker with the heavy hitter trackers.
+ * @param repinfo: reply info with the client address.
+ * @param qinfo: the query.
+ */
+void server_stats_heavy_query(struct worker* worker,
+	struct comm_reply* repinfo, struct query_info* qinfo);
+
+/**
+ * Count the query to an upstream server for the heavy hitters.
+ * @param worker: the worker with the heavy hitter trackers.
+ * @param addr: the server address.
+ * @param addrlen: length of addr.
+ */
+void server_stats_heavy_upstream(struct worker* worker,
+	struct sockaddr_storage* addr, socklen_t addrlen);
+
+/**
+ * Clear the heavy hitters of the worker.
+ * @param worker: the worker.
+ */
+void server_stats_heavy_clear(struct worker* worker);
+
+/**
+ * Combine the heavy hitters of all the workers.
+ * @param worker: a worker of the daemon.
+ * @param merged: array of UB_STATS_HEAVY_CAT_NUM, returns new trackers
+ *	with the heavy hitters of all the threads, the caller deletes them.
+ * @return false if not enabled or on malloc failure.
+ */
+int server_stats_heavy_merge(struct worker* worker, struct topk** merged);
+
+/**
+ * Print the heavy hitter key as text.
+ * @param cat: the UB_STATS_HEAVY category.
+ * @param e: the tracker entry.
+ * @param buf: returns the text.
+ * @param len: length of buf.
+ */
+void server_stats_heavy_str(int cat, struct topk_entry* e, char* buf,
+	size_t len);
+
+/**
+ * Get the name of the heavy hitter category.
+ * @param cat: the UB_STATS_HEAVY category.
+ * @return a static string, like "client".
+ */
+const char* server_stats_heavy_cat(int cat);
+
 #endif /* DAEMON_STATS_H */
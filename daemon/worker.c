@@ -65,6 +65,8 @@
 #include "util/data/msgencode.h"
 #include "util/data/dname.h"
 #include "util/fptr_wlist.h"
+#include "util/timehist.h"
+#include "util/storage/topk.h"
 #include "util/tube.h"
 #include "iterator/iter_fwd.h"
 #include "iterator/iter_hints.h"
@@ -85,6 +87,7 @@
 #include <netdb.h>
 #endif
 #include <signal.h>
+#include <sys/time.h>
 #ifdef UB_ON_WINDOWS
 #include "winrc/win_svc.h"
 #endif
@@ -393,6 +396,7 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 		verbose(VERB_ALGO, "got control cmd quit");
 		comm_base_exit(worker->base);
 		break;
+#ifndef STATS_SHARED
 	case worker_cmd_stats:
 		verbose(VERB_ALGO, "got control cmd stats");
 		server_stats_reply(worker, 1);
@@ -401,6 +405,7 @@ worker_handle_control_cmd(struct tube* ATTR_UNUSED(tube), uint8_t* msg,
 		verbose(VERB_ALGO, "got control cmd stats_noreset");
 		server_stats_reply(worker, 0);
 		break;
+#endif /* STATS_SHARED */
 	case worker_cmd_remote:
 		verbose(VERB_ALGO, "got control cmd remote");
 		daemon_remote_exec(worker);
@@ -509,9 +514,9 @@ answer_norec_from_cache(struct worker* worker, struct query_info* qinfo,
 					return 0;
 			error_encode(repinfo->c->buffer, LDNS_RCODE_SERVFAIL, 
 				&msg->qinfo, id, flags, edns);
-			if(worker->stats.extended) {
-				worker->stats.ans_bogus++;
-				worker->stats.ans_rcode[LDNS_RCODE_SERVFAIL]++;
+			if(worker->stats->extended) {
+				stat_inc(worker->stats->ans_bogus);
+				stat_inc(worker->stats->ans_rcode[LDNS_RCODE_SERVFAIL]);
 			}
 			return 1;
 		case sec_status_secure:
@@ -547,9 +552,9 @@ answer_norec_from_cache(struct worker* worker, struct query_info* qinfo,
 		error_encode(repinfo->c->buffer, LDNS_RCODE_SERVFAIL, 
 			&msg->qinfo, id, flags, edns);
 	}
-	if(worker->stats.extended) {
-		if(secure) worker->stats.ans_secure++;
-		server_stats_insrcode(&worker->stats, repinfo->c->buffer);
+	if(worker->stats->extended) {
+		if(secure) stat_inc(worker->stats->ans_secure);
+		server_stats_insrcode(worker->stats, repinfo->c->buffer);
 	}
 	return 1;
 }
@@ -626,7 +631,7 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 		 * the response */
 		/* This response was served with zero TTL */
 		if (timenow >= rep->ttl) {
-			worker->stats.zero_ttl_responses++;
+			stat_inc(worker->stats->zero_ttl_responses);
 		}
 	} else {
 		/* see if it is possible */
@@ -668,9 +673,9 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 			qinfo, id, flags, edns);
 		rrset_array_unlock_touch(worker->env.rrset_cache, 
 			worker->scratchpad, rep->ref, rep->rrset_count);
-		if(worker->stats.extended) {
-			worker->stats.ans_bogus ++;
-			worker->stats.ans_rcode[LDNS_RCODE_SERVFAIL] ++;
+		if(worker->stats->extended) {
+			stat_inc(worker->stats->ans_bogus);
+			stat_inc(worker->stats->ans_rcode[LDNS_RCODE_SERVFAIL]);
 		}
 		return 1;
 	} else if( rep->security == sec_status_unchecked && must_validate) {
@@ -736,9 +741,9 @@ answer_from_cache(struct worker* worker, struct query_info* qinfo,
 	 * is bad while holding locks. */
 	rrset_array_unlock_touch(worker->env.rrset_cache, worker->scratchpad,
 		rep->ref, rep->rrset_count);
-	if(worker->stats.extended) {
-		if(secure) worker->stats.ans_secure++;
-		server_stats_insrcode(&worker->stats, repinfo->c->buffer);
+	if(worker->stats->extended) {
+		if(secure) stat_inc(worker->stats->ans_secure);
+		server_stats_insrcode(worker->stats, repinfo->c->buffer);
 	}
 	/* go and return this buffer to the client */
 	return 1;
@@ -756,7 +761,7 @@ reply_and_prefetch(struct worker* worker, struct query_info* qinfo,
 	 * as small as a cachereply */
 	if(sldns_buffer_limit(repinfo->c->buffer) != 0)
 		comm_point_send_reply(repinfo);
-	server_stats_prefetch(&worker->stats, worker);
+	server_stats_prefetch(worker->stats, worker);
 	
 	/* create the prefetch in the mesh as a normal lookup without
 	 * client addrs waiting, which has the cache blacklisted (to bypass
@@ -947,15 +952,15 @@ deny_refuse(struct comm_point* c, enum acl_access acl,
 {
 	if(acl == deny) {
 		comm_point_drop_reply(repinfo);
-		if(worker->stats.extended)
-			worker->stats.unwanted_queries++;
+		if(worker->stats->extended)
+			stat_inc(worker->stats->unwanted_queries);
 		return 0;
 	} else if(acl == refuse) {
 		log_addr(VERB_ALGO, "refused query from",
 			&repinfo->addr, repinfo->addrlen);
 		log_buf(VERB_ALGO, "refuse", c->buffer);
-		if(worker->stats.extended)
-			worker->stats.unwanted_queries++;
+		if(worker->stats->extended)
+			stat_inc(worker->stats->unwanted_queries);
 		if(worker_check_request(c->buffer, worker) == -1) {
 			comm_point_drop_reply(repinfo);
 			return 0; /* discard this */
@@ -993,8 +998,8 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct comm_reply* repinfo)
 {
 	struct worker* worker = (struct worker*)arg;
-	int ret;
-	hashvalue_type h;
+	int ret, fast;
+	hashvalue_type h, fast_h = 0;
 	struct lruhash_entry* e;
 	struct query_info qinfo;
 	struct edns_data edns;
@@ -1010,7 +1015,12 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 	struct query_info* lookup_qinfo = &qinfo;
 	struct query_info qinfo_tmp; /* placeholdoer for lookup_qinfo */
 	struct respip_client_info* cinfo = NULL, cinfo_tmp;
+	/* for the latency histograms */
+	struct timeval start_tv = {0, 0};
+	int from_cache = 0;
 	memset(&qinfo, 0, sizeof(qinfo));
+	if(worker->stats->extended)
+		gettimeofday(&start_tv, NULL);
 
 	if(error != NETEVENT_NOERROR) {
 		/* some bad tcp query DNS formats give these error calls */
@@ -1020,7 +1030,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 #ifdef USE_DNSCRYPT
 	repinfo->max_udp_size = worker->daemon->cfg->max_udp_size;
 	if(!dnsc_handle_curved_request(worker->daemon->dnscenv, repinfo)) {
-		worker->stats.num_query_dnscrypt_crypted_malformed++;
+		stat_inc(worker->stats->num_query_dnscrypt_crypted_malformed);
 		return 0;
 	}
 	if(c->dnscrypt && !repinfo->is_dnscrypted) {
@@ -1052,13 +1062,13 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 				sldns_rr_descript(qinfo.qtype)->_name,
 				buf);
 			comm_point_drop_reply(repinfo);
-			worker->stats.num_query_dnscrypt_cleartext++;
+			stat_inc(worker->stats->num_query_dnscrypt_cleartext);
 			return 0;
 		}
-		worker->stats.num_query_dnscrypt_cert++;
+		stat_inc(worker->stats->num_query_dnscrypt_cert);
 		sldns_buffer_rewind(c->buffer);
 	} else if(c->dnscrypt && repinfo->is_dnscrypted) {
-		worker->stats.num_query_dnscrypt_crypted++;
+		stat_inc(worker->stats->num_query_dnscrypt_crypted);
 	}
 #endif
 #ifdef USE_DNSTAP
@@ -1075,7 +1085,12 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			goto send_reply;
 		return ret;
 	}
-	if((ret=worker_check_request(c->buffer, worker)) != 0) {
+	/* a query with one question and perhaps an OPT record is parsed
+	 * in one pass, other packets by the general parse */
+	fast = sldns_buffer_limit(c->buffer) <= NORMAL_UDP_SIZE &&
+		parse_query_fast(c->buffer, &qinfo, &edns, &fast_h,
+		worker->scratchpad);
+	if(!fast && (ret=worker_check_request(c->buffer, worker)) != 0) {
 		verbose(VERB_ALGO, "worker check request: bad query.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
 		if(ret != -1) {
@@ -1087,7 +1102,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		return 0;
 	}
 
-	worker->stats.num_queries++;
+	stat_inc(worker->stats->num_queries);
 
 	/* check if this query should be dropped based on source ip rate limiting */
 	if(!infra_ip_ratelimit_inc(worker->env.infra_cache, repinfo,
@@ -1103,14 +1118,15 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		  verbose(VERB_OPS, "ip_ratelimit allowed through for ip address %s ",
 				  addrbuf);
 		} else {
-			worker->stats.num_queries_ip_ratelimited++;
+			stat_inc(worker->stats->num_queries_ip_ratelimited);
+			regional_free_all(worker->scratchpad);
 			comm_point_drop_reply(repinfo);
 			return 0;
 		}
 	}
 
 	/* see if query is in the cache */
-	if(!query_info_parse(&qinfo, c->buffer)) {
+	if(!fast && !query_info_parse(&qinfo, c->buffer)) {
 		verbose(VERB_ALGO, "worker parse request: formerror.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
 		memset(&qinfo, 0, sizeof(qinfo)); /* zero qinfo.qname */
@@ -1122,7 +1138,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		LDNS_QR_SET(sldns_buffer_begin(c->buffer));
 		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), 
 			LDNS_RCODE_FORMERR);
-		server_stats_insrcode(&worker->stats, c->buffer);
+		server_stats_insrcode(worker->stats, c->buffer);
 		goto send_reply;
 	}
 	if(worker->env.cfg->log_queries) {
@@ -1130,6 +1146,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		addr_to_str(&repinfo->addr, repinfo->addrlen, ip, sizeof(ip));
 		log_nametypeclass(0, ip, qinfo.qname, qinfo.qtype, qinfo.qclass);
 	}
+	server_stats_heavy_query(worker, repinfo, &qinfo);
 	if(qinfo.qtype == LDNS_RR_TYPE_AXFR || 
 		qinfo.qtype == LDNS_RR_TYPE_IXFR) {
 		verbose(VERB_ALGO, "worker request: refused zone transfer.");
@@ -1138,9 +1155,9 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		LDNS_QR_SET(sldns_buffer_begin(c->buffer));
 		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), 
 			LDNS_RCODE_REFUSED);
-		if(worker->stats.extended) {
-			worker->stats.qtype[qinfo.qtype]++;
-			server_stats_insrcode(&worker->stats, c->buffer);
+		if(worker->stats->extended) {
+			stat_inc(worker->stats->qtype[qinfo.qtype]);
+			server_stats_insrcode(worker->stats, c->buffer);
 		}
 		goto send_reply;
 	}
@@ -1160,13 +1177,14 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		LDNS_QR_SET(sldns_buffer_begin(c->buffer));
 		LDNS_RCODE_SET(sldns_buffer_begin(c->buffer), 
 			LDNS_RCODE_FORMERR);
-		if(worker->stats.extended) {
-			worker->stats.qtype[qinfo.qtype]++;
-			server_stats_insrcode(&worker->stats, c->buffer);
+		if(worker->stats->extended) {
+			stat_inc(worker->stats->qtype[qinfo.qtype]);
+			server_stats_insrcode(worker->stats, c->buffer);
 		}
 		goto send_reply;
 	}
-	if((ret=parse_edns_from_pkt(c->buffer, &edns, worker->scratchpad)) != 0) {
+	if(!fast && (ret=parse_edns_from_pkt(c->buffer, &edns,
+		worker->scratchpad)) != 0) {
 		struct edns_data reply_edns;
 		verbose(VERB_ALGO, "worker parse edns: formerror.");
 		log_addr(VERB_CLIENT,"from",&repinfo->addr, repinfo->addrlen);
@@ -1178,7 +1196,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
 			sldns_buffer_read_u16_at(c->buffer, 2), &reply_edns);
 		regional_free_all(worker->scratchpad);
-		server_stats_insrcode(&worker->stats, c->buffer);
+		server_stats_insrcode(worker->stats, c->buffer);
 		goto send_reply;
 	}
 	if(edns.edns_present && edns.edns_version != 0) {
@@ -1227,14 +1245,14 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		regional_free_all(worker->scratchpad);
 		goto send_reply;
 	}
-	if(worker->stats.extended)
-		server_stats_insquery(&worker->stats, c, qinfo.qtype,
+	if(worker->stats->extended)
+		server_stats_insquery(worker->stats, c, qinfo.qtype,
 			qinfo.qclass, &edns, repinfo);
 	if(c->type != comm_udp)
 		edns.udp_size = 65535; /* max size for TCP replies */
 	if(qinfo.qclass == LDNS_RR_CLASS_CH && answer_chaos(worker, &qinfo,
 		&edns, c->buffer)) {
-		server_stats_insrcode(&worker->stats, c->buffer);
+		server_stats_insrcode(worker->stats, c->buffer);
 		regional_free_all(worker->scratchpad);
 		goto send_reply;
 	}
@@ -1249,7 +1267,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			comm_point_drop_reply(repinfo);
 			return 0;
 		}
-		server_stats_insrcode(&worker->stats, c->buffer);
+		server_stats_insrcode(worker->stats, c->buffer);
 		goto send_reply;
 	}
 	if(worker->env.auth_zones &&
@@ -1265,7 +1283,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 		if(LDNS_RD_WIRE(sldns_buffer_begin(c->buffer)) &&
 		   acl != acl_deny_non_local && acl != acl_refuse_non_local)
 			LDNS_RA_SET(sldns_buffer_begin(c->buffer));
-		server_stats_insrcode(&worker->stats, c->buffer);
+		server_stats_insrcode(worker->stats, c->buffer);
 		goto send_reply;
 	}
 
@@ -1287,7 +1305,7 @@ worker_handle_request(struct comm_point* c, void* arg, int error,
 			*(uint16_t*)(void *)sldns_buffer_begin(c->buffer),
 			sldns_buffer_read_u16_at(c->buffer, 2), NULL);
 		regional_free_all(worker->scratchpad);
-		server_stats_insrcode(&worker->stats, c->buffer);
+		server_stats_insrcode(worker->stats, c->buffer);
 		log_addr(VERB_ALGO, "refused nonrec (cache snoop) query from",
 			&repinfo->addr, repinfo->addrlen);
 		goto send_reply;
@@ -1336,7 +1354,12 @@ lookup_cache:
 	 * each pass.  We should still pass the original qinfo to
 	 * answer_from_cache(), however, since it's used to build the reply. */
 	if(!edns_bypass_cache_stage(edns.opt_list, &worker->env)) {
-		h = query_info_hash(lookup_qinfo, sldns_buffer_read_u16_at(c->buffer, 2));
+		/* the fast parse has hashed the query, if it is not
+		 * replaced by an alias */
+		if(fast && lookup_qinfo == &qinfo && !qinfo.local_alias)
+			h = fast_h;
+		else	h = query_info_hash(lookup_qinfo,
+				sldns_buffer_read_u16_at(c->buffer, 2));
 		if((e=slabhash_lookup(worker->env.msg_cache, h, lookup_qinfo, 0))) {
 			/* answer from cache - we have acquired a readlock on it */
 			if(answer_from_cache(worker, &qinfo,
@@ -1363,11 +1386,13 @@ lookup_cache:
 						repinfo, leeway);
 					if(!partial_rep) {
 						rc = 0;
+						from_cache = 1;
 						regional_free_all(worker->scratchpad);
 						goto send_reply_rc;
 					}
 				} else if(!partial_rep) {
 					lock_rw_unlock(&e->lock);
+					from_cache = 1;
 					regional_free_all(worker->scratchpad);
 					goto send_reply;
 				} else {
@@ -1402,6 +1427,7 @@ lookup_cache:
 				*(uint16_t*)(void *)sldns_buffer_begin(c->buffer), 
 				sldns_buffer_read_u16_at(c->buffer, 2), repinfo, 
 				&edns)) {
+				from_cache = 1;
 				regional_free_all(worker->scratchpad);
 				goto send_reply;
 			}
@@ -1410,7 +1436,7 @@ lookup_cache:
 		}
 	}
 	sldns_buffer_rewind(c->buffer);
-	server_stats_querymiss(&worker->stats, worker);
+	server_stats_querymiss(worker->stats, worker);
 
 	if(verbosity >= VERB_CLIENT) {
 		if(c->type == comm_udp)
@@ -1435,6 +1461,12 @@ send_reply_rc:
 		comm_point_drop_reply(repinfo);
 		return 0;
 	}
+	if(worker->stats->extended) {
+		struct timeval end_tv;
+		gettimeofday(&end_tv, NULL);
+		lathist_insert_diff(from_cache?worker->stats_ext->lat_cache:
+			worker->stats_ext->lat_local, &start_tv, &end_tv);
+	}
 #ifdef USE_DNSTAP
 	if(worker->dtenv.log_client_response_messages)
 		dt_msg_send_client_response(&worker->dtenv, &repinfo->addr,
@@ -1503,14 +1535,25 @@ worker_restart_timer(struct worker* worker)
 void worker_stat_timer_cb(void* arg)
 {
 	struct worker* worker = (struct worker*)arg;
-	server_stats_log(&worker->stats, worker, worker->thread_num);
+	server_stats_log(worker->stats, worker, worker->thread_num);
 	mesh_stats(worker->env.mesh, "mesh has");
 	worker_mem_report(worker, NULL);
 	/* SHM is enabled, process data to SHM */
 	if (worker->daemon->cfg->shm_enable) {
+#ifdef STATS_SHARED
+		/* the first thread reads the counters of all the threads,
+		 * the interval is kept with a base, and not cleared */
+		if(worker->thread_num == 0)
+			shm_main_run(worker);
+#else
 		shm_main_run(worker);
+#endif
 	}
-	if(!worker->daemon->cfg->stat_cumulative) {
+	if(!worker->daemon->cfg->stat_cumulative
+#ifdef STATS_SHARED
+		&& !worker->daemon->cfg->shm_enable
+#endif
+		) {
 		worker_stats_clear(worker);
 	}
 	/* start next timer */
@@ -1537,9 +1580,20 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 		sizeof(struct worker));
 	if(!worker) 
 		return NULL;
+	/* the statistics block, on its own cache lines */
+	worker->stats_alloc = calloc(1, sizeof(struct ub_server_stats) +
+		2*WORKER_STATS_ALIGN);
+	if(!worker->stats_alloc) {
+		free(worker);
+		return NULL;
+	}
+	worker->stats = (struct ub_server_stats*)(((uintptr_t)
+		worker->stats_alloc + WORKER_STATS_ALIGN) &
+		~(uintptr_t)(WORKER_STATS_ALIGN-1));
 	worker->numports = n;
 	worker->ports = (int*)memdup(ports, sizeof(int)*n);
 	if(!worker->ports) {
+		free(worker->stats_alloc);
 		free(worker);
 		return NULL;
 	}
@@ -1547,6 +1601,7 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 	worker->thread_num = id;
 	if(!(worker->cmd = tube_create())) {
 		free(worker->ports);
+		free(worker->stats_alloc);
 		free(worker);
 		return NULL;
 	}
@@ -1559,10 +1614,21 @@ worker_create(struct daemon* daemon, int id, int* ports, int n)
 		log_err("could not init random numbers.");
 		tube_delete(worker->cmd);
 		free(worker->ports);
+		free(worker->stats_alloc);
 		free(worker);
 		return NULL;
 	}
 	seed = 0;
+	lock_basic_init(&worker->heavy_lock);
+	if(daemon->cfg->heavy_hitters_size != 0) {
+		int i;
+		for(i=0; i<UB_STATS_HEAVY_CAT_NUM; i++) {
+			if(!(worker->heavy[i] = topk_create(
+				daemon->cfg->heavy_hitters_size)))
+				fatal_exit("could not create heavy hitters");
+		}
+	}
+	lock_protect(&worker->heavy_lock, worker->heavy, sizeof(worker->heavy));
 #ifdef USE_DNSTAP
 	if(daemon->cfg->dnstap) {
 		log_assert(daemon->dtenv != NULL);
@@ -1584,7 +1650,7 @@ worker_init(struct worker* worker, struct config_file *cfg,
 	void* dtenv = NULL;
 #endif
 	worker->need_to_exit = 0;
-	worker->base = comm_base_create(do_sigs);
+	worker->base = comm_base_create_daemon(do_sigs);
 	if(!worker->base) {
 		log_err("could not create event handling base");
 		worker_delete(worker);
@@ -1654,6 +1720,21 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		worker_delete(worker);
 		return 0;
 	}
+	if(cfg->stat_extended) {
+		worker->stats_ext = (struct ub_stats_ext*)calloc(1,
+			sizeof(*worker->stats_ext));
+		worker->stats_base.ext = (struct ub_stats_ext*)calloc(1,
+			sizeof(*worker->stats_base.ext));
+		worker->shm_base.ext = (struct ub_stats_ext*)calloc(1,
+			sizeof(*worker->shm_base.ext));
+		if(!worker->stats_ext || !worker->stats_base.ext ||
+			!worker->shm_base.ext) {
+			log_err("malloc failure");
+			worker_delete(worker);
+			return 0;
+		}
+		worker->back->lat_upstream = worker->stats_ext->lat_upstream;
+	}
 	/* start listening to commands */
 	if(!tube_setup_bg_listen(worker->cmd, worker->base,
 		&worker_handle_control_cmd, worker)) {
@@ -1676,7 +1757,7 @@ worker_init(struct worker* worker, struct config_file *cfg,
 		return 0;
 	}
 
-	server_stats_init(&worker->stats, cfg);
+	server_stats_init(worker->stats, cfg);
 	alloc_init(&worker->alloc, &worker->daemon->superalloc, 
 		worker->thread_num);
 	alloc_set_id_cleanup(&worker->alloc, &worker_alloc_cleanup, worker);
@@ -1769,10 +1850,11 @@ worker_work(struct worker* worker)
 void 
 worker_delete(struct worker* worker)
 {
+	int i;
 	if(!worker) 
 		return;
 	if(worker->env.mesh && verbosity >= VERB_OPS) {
-		server_stats_log(&worker->stats, worker, worker->thread_num);
+		server_stats_log(worker->stats, worker, worker->thread_num);
 		mesh_stats(worker->env.mesh, "mesh has");
 		worker_mem_report(worker, NULL);
 	}
@@ -1799,6 +1881,13 @@ worker_delete(struct worker* worker)
 	alloc_clear(&worker->alloc);
 	regional_destroy(worker->env.scratch);
 	regional_destroy(worker->scratchpad);
+	for(i=0; i<UB_STATS_HEAVY_CAT_NUM; i++)
+		topk_delete(worker->heavy[i]);
+	lock_basic_destroy(&worker->heavy_lock);
+	free(worker->stats_ext);
+	free(worker->stats_base.ext);
+	free(worker->shm_base.ext);
+	free(worker->stats_alloc);
 	free(worker);
 }
 
@@ -1809,16 +1898,19 @@ worker_send_query(struct query_info* qinfo, uint16_t flags, int dnssec,
 	struct module_qstate* q)
 {
 	struct worker* worker = q->env->worker;
-	struct outbound_entry* e = (struct outbound_entry*)regional_alloc(
-		q->region, sizeof(*e));
-	if(!e) 
+	struct outbound_entry* e = (struct outbound_entry*)alloc_obj_obtain(
+		q->env->alloc, sizeof(*e));
+	if(!e)
 		return NULL;
 	e->qstate = q;
+	e->race = 0;
+	server_stats_heavy_upstream(worker, addr, addrlen);
 	e->qsent = outnet_serviced_query(worker->back, qinfo, flags, dnssec,
 		want_dnssec, nocaps, q->env->cfg->tcp_upstream,
 		ssl_upstream, addr, addrlen, zone, zonelen, q,
 		worker_handle_service_reply, e, worker->back->udp_buff, q->env);
 	if(!e->qsent) {
+		alloc_obj_release(q->env->alloc, e, sizeof(*e));
 		return NULL;
 	}
 	return e;
@@ -1834,10 +1926,24 @@ worker_alloc_cleanup(void* arg)
 
 void worker_stats_clear(struct worker* worker)
 {
-	server_stats_init(&worker->stats, worker->env.cfg);
+	/* the generation is odd during the clear, for the readers of the
+	 * counters in other threads */
+	stat_set(worker->stats_gen, worker->stats_gen+1);
+	stat_fence_release();
+	server_stats_init(worker->stats, worker->env.cfg);
+	if(worker->stats_ext)
+		server_stats_ext_clear(worker->stats_ext);
 	mesh_stats_clear(worker->env.mesh);
-	worker->back->unwanted_replies = 0;
-	worker->back->num_tcp_outgoing = 0;
+	stat_set(worker->back->unwanted_replies, 0);
+	stat_set(worker->back->num_tcp_outgoing, 0);
+	stat_set(worker->alloc.obj_reused, 0);
+	stat_set(worker->alloc.obj_malloced, 0);
+	stat_set(worker->alloc.obj_freed, 0);
+	stat_set(worker->alloc.reg_cache.reused, 0);
+	stat_set(worker->alloc.reg_cache.malloced, 0);
+	stat_set(worker->alloc.reg_cache.freed, 0);
+	server_stats_heavy_clear(worker);
+	stat_set_release(worker->stats_gen, worker->stats_gen+1);
 }
 
 void worker_start_accept(void* arg)
@@ -62,12 +62,34 @@ struct regional;
 struct tube;
 struct daemon_remote;
 struct query_info;
+struct topk;
+
+/** the statistics block of a worker starts on a cache line of this size,
+ * and does not share the cache line with other data */
+#define WORKER_STATS_ALIGN 64
+
+/**
+ * The statistics of a worker at a reset by a reader in another thread.
+ * The worker counts on, and the reader subtracts the base.
+ */
+struct worker_stats_base {
+	/** the statistics at the reset */
+	struct ub_stats_info info;
+	/** the extended statistics at the reset, NULL without
+	 * extended-statistics */
+	struct ub_stats_ext* ext;
+	/** if the base is set */
+	int set;
+	/** stats_gen of the worker when the base was taken, a clear by the
+	 * worker itself makes the base stale */
+	unsigned int gen;
+};
 
 /** worker commands */
 enum worker_commands {
 	/** make the worker quit */
 	worker_cmd_quit,
-	/** obtain statistics */
+	/** obtain statistics, if they are not read by other threads */
 	worker_cmd_stats,
 	/** obtain statistics without statsclear */
 	worker_cmd_stats_noreset,
@@ -115,8 +137,14 @@ struct worker {
 	int need_to_exit;
 	/** allocation cache for this thread */
 	struct alloc_cache alloc;
-	/** per thread statistics */
-	struct ub_server_stats stats;
+	/** per thread statistics, in stats_alloc.  The block starts on a
+	 * cache line of its own, with STATS_SHARED other threads read it */
+	struct ub_server_stats* stats;
+	/** the allocation of the statistics block, it is aligned in it */
+	void* stats_alloc;
+	/** per thread extended statistics, NULL without
+	 * extended-statistics */
+	struct ub_stats_ext* stats_ext;
 	/** thread scratch regional */
 	struct regional* scratchpad;
 
@@ -127,6 +155,30 @@ struct worker {
 	/** dnstap environment, changed for this thread */
 	struct dt_env dtenv;
 #endif
+
+	/** incremented by the worker when it clears its statistics, it is
+	 * odd while the clear is in progress */
+	unsigned int stats_gen;
+	/** values at the last statistics reset by remote control, that
+	 * reads the statistics of the running worker and reports them
+	 * from this base on. Owned by the remote control thread. */
+	struct worker_stats_base stats_base;
+	/** values at the last statistics interval in SHM, the first thread
+	 * reads the statistics of all threads into SHM from this base on */
+	struct worker_stats_base shm_base;
+	/** incremented by remote control, or the SHM interval, on a
+	 * statistics reset.  The requestlist max cannot be subtracted from
+	 * the base, the worker starts a new max when it sees this change */
+	unsigned int stats_max_reset;
+	/** the stats_max_reset value the worker has started its max at */
+	unsigned int stats_max_reset_seen;
+
+	/** lock on the heavy hitter trackers, the remote control reads
+	 * them while the worker counts */
+	lock_basic_type heavy_lock;
+	/** heavy hitter trackers, for every UB_STATS_HEAVY category, NULL
+	 * if heavy-hitters-size is 0 */
+	struct topk* heavy[UB_STATS_HEAVY_CAT_NUM];
 };
 
 /**
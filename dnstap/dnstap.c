@@ -38,11 +38,17 @@
 
 #include "config.h"
 #include <string.h>
+#include <errno.h>
 #include <sys/time.h>
+#ifdef HAVE_UNISTD_H
+#include <unistd.h>
+#endif
 #include "sldns/sbuffer.h"
+#include "sldns/pkthdr.h"
 #include "util/config_file.h"
 #include "util/net_help.h"
 #include "util/netevent.h"
+#include "util/locks.h"
 #include "util/log.h"
 
 #include <fstrm.h>
@@ -53,6 +59,17 @@
 
 #define DNSTAP_CONTENT_TYPE		"protobuf:dnstap.Dnstap"
 #define DNSTAP_INITIAL_BUF_SIZE		256
+/** smallest ring buffer of a worker, in bytes, it fits the largest
+ * message with room to spare */
+#define DNSTAP_RING_MIN			(128*1024)
+/** entries in the ring buffer are aligned to 8 bytes */
+#define DNSTAP_RING_ALIGN(x)		(((x)+7)&~((size_t)7))
+
+#if defined(HAVE_PTHREAD) || defined(HAVE_SOLARIS_THREADS)
+/** the messages are encoded and written by the dnstap thread, without
+ * threads they are encoded by the worker itself */
+#define DNSTAP_ASYNC 1
+#endif
 
 struct dt_msg {
 	void		*buf;
@@ -61,6 +78,105 @@ struct dt_msg {
 	Dnstap__Message	m;
 };
 
+/**
+ * A message as the worker copies it into its ring buffer.  It is followed
+ * by the zone and then by the DNS message, in wire format.
+ */
+struct dt_raw {
+	/** length of the entry in the ring, aligned; 0 marks that the rest
+	 * of the ring is not used and the next entry is at the start */
+	uint32_t len;
+	/** the Dnstap__Message__Type */
+	uint32_t type;
+	/** comm_udp or comm_tcp */
+	uint32_t cptype;
+	/** if the query time is set */
+	uint8_t has_qtime;
+	/** if the response time is set */
+	uint8_t has_rtime;
+	/** query time */
+	struct timeval qtime;
+	/** response time */
+	struct timeval rtime;
+	/** address of the client, or of the upstream server */
+	struct sockaddr_storage addr;
+	/** length of the zone, 0 if none */
+	size_t zone_len;
+	/** length of the DNS message */
+	size_t msg_len;
+};
+
+/**
+ * Ring buffer of a worker.  The worker appends messages and the dnstap
+ * thread takes them off.  The lock is held by the worker to copy a message
+ * in, and by the dnstap thread to update the positions; the encoding is
+ * done without the lock, on the entries between tail and tail+used, that
+ * the worker does not write to.
+ */
+struct dt_ring {
+	/** lock on the positions and the counter */
+	lock_basic_type lock;
+	/** the buffer, NULL if the worker encodes the messages itself */
+	uint8_t *buf;
+	/** size of the buffer */
+	size_t size;
+	/** position where the next entry is written */
+	size_t head;
+	/** position of the first entry to encode */
+	size_t tail;
+	/** bytes in use from tail onwards, with the skipped space at the
+	 * end of the buffer */
+	size_t used;
+	/** number of messages dropped */
+	size_t dropped;
+};
+
+/**
+ * The dnstap I/O, shared by the workers.
+ */
+struct dt_io {
+	/** the environment with the identity and version fields */
+	struct dt_env *env;
+	/** fstrm I/O thread, that writes to the socket or TCP collector,
+	 * NULL for file output */
+	struct fstrm_iothr *iothr;
+	/** input queue of the fstrm I/O thread */
+	struct fstrm_iothr_queue *ioq;
+	/** file output path, NULL if not writing to a file */
+	char *file_path;
+	/** writer for the file output, the file is written directly by the
+	 * dnstap thread, NULL if the file could not be opened */
+	struct fstrm_writer *fw;
+	/** bytes written to the current file */
+	size_t file_size;
+	/** time the current file was opened */
+	time_t file_start;
+	/** rotate the file after this many bytes, 0 is off */
+	size_t rotate_size;
+	/** rotate the file after this many seconds, 0 is off */
+	int rotate_interval;
+	/** sequence number for the rotated file names */
+	unsigned file_seq;
+	/** size of the ring buffer of a worker, in bytes */
+	size_t ring_size;
+	/** lock on the ring list and want_quit */
+	lock_basic_type lock;
+	/** ring buffers of the workers */
+	struct dt_ring **rings;
+	/** number of rings in the list */
+	unsigned num_rings;
+	/** size of the rings array */
+	unsigned max_rings;
+#ifdef DNSTAP_ASYNC
+	/** the dnstap thread */
+	ub_thread_type tid;
+	/** pipe that wakes up the dnstap thread, read and write end */
+	int wake[2];
+	/** if the dnstap thread has to exit */
+	int want_quit;
+#endif
+};
+
 static int
 dt_pack(const Dnstap__Dnstap *d, void **buf, size_t *sz)
 {
@@ -83,16 +199,105 @@ dt_pack(const Dnstap__Dnstap *d, void **buf, size_t *sz)
 	return 1;
 }
 
+/** create the writer options, with the dnstap content type */
+static struct fstrm_writer_options *
+dt_writer_options(void)
+{
+#ifdef UNBOUND_DEBUG
+	fstrm_res res;
+#endif
+	struct fstrm_writer_options *fwopt = fstrm_writer_options_init();
+#ifdef UNBOUND_DEBUG
+	res =
+#else
+	(void)
+#endif
+	    fstrm_writer_options_add_content_type(fwopt,
+		DNSTAP_CONTENT_TYPE, sizeof(DNSTAP_CONTENT_TYPE) - 1);
+	log_assert(res == fstrm_res_success);
+	return fwopt;
+}
+
+/** open the dnstap output file, NULL on failure */
+static struct fstrm_writer *
+dt_file_open(const char *path)
+{
+	struct fstrm_writer_options *fwopt = dt_writer_options();
+	struct fstrm_file_options *ffopt = fstrm_file_options_init();
+	struct fstrm_writer *fw;
+
+	fstrm_file_options_set_file_path(ffopt, path);
+	fw = fstrm_file_writer_init(ffopt, fwopt);
+	if (fw != NULL && fstrm_writer_open(fw) != fstrm_res_success) {
+		log_err("dnstap: could not open file %s", path);
+		fstrm_writer_destroy(&fw);
+		fw = NULL;
+	}
+	fstrm_file_options_destroy(&ffopt);
+	fstrm_writer_options_destroy(&fwopt);
+	return fw;
+}
+
+/** close the dnstap output file, move it aside to the name with the
+ * current time, and start a new file */
 static void
-dt_send(const struct dt_env *env, void *buf, size_t len_buf)
+dt_file_rotate(struct dt_io *io)
+{
+	char buf[1024];
+	time_t now = time(NULL);
+
+	/* writes the stop frame and closes the file */
+	fstrm_writer_destroy(&io->fw);
+	snprintf(buf, sizeof(buf), "%s.%lld.%u", io->file_path,
+		(long long)now, io->file_seq++);
+	if (rename(io->file_path, buf) != 0)
+		log_err("dnstap: rename %s to %s: %s", io->file_path, buf,
+			strerror(errno));
+	else	verbose(VERB_OPS, "dnstap file rotated to %s", buf);
+	io->fw = dt_file_open(io->file_path);
+	io->file_size = 0;
+	io->file_start = now;
+}
+
+/** write a frame to the dnstap output file, rotate it when it is too big
+ * or too old; buf is freed */
+static int
+dt_file_write(struct dt_io *io, void *buf, size_t len_buf)
+{
+	fstrm_res res;
+	if (io->fw != NULL && ((io->rotate_size != 0 &&
+		io->file_size >= io->rotate_size) ||
+		(io->rotate_interval != 0 &&
+		time(NULL) >= io->file_start + io->rotate_interval)))
+		dt_file_rotate(io);
+	if (io->fw == NULL) {
+		free(buf);
+		return 0;
+	}
+	res = fstrm_writer_write(io->fw, buf, len_buf);
+	free(buf);
+	if (res != fstrm_res_success)
+		return 0;
+	/* the frame has a 32bit length in front */
+	io->file_size += len_buf + 4;
+	return 1;
+}
+
+static int
+dt_send(struct dt_io *io, void *buf, size_t len_buf)
 {
 	fstrm_res res;
 	if (!buf)
-		return;
-	res = fstrm_iothr_submit(env->iothr, env->ioq, buf, len_buf,
+		return 0;
+	if (io->file_path != NULL)
+		return dt_file_write(io, buf, len_buf);
+	res = fstrm_iothr_submit(io->iothr, io->ioq, buf, len_buf,
 				 fstrm_free_wrapper, NULL);
-	if (res != fstrm_res_success)
+	if (res != fstrm_res_success) {
 		free(buf);
+		return 0;
+	}
+	return 1;
 }
 
 static void
@@ -118,56 +323,165 @@ dt_msg_init(const struct dt_env *env,
 	}
 }
 
-struct dt_env *
-dt_create(const char *socket_path, unsigned num_workers)
+#ifdef DNSTAP_ASYNC
+static void *dt_io_thread(void *arg);
+#endif
+
+/** create the writer for the TCP collector at "ip@port" */
+static struct fstrm_writer *
+dt_tcp_writer(const char *ip)
 {
-#ifdef UNBOUND_DEBUG
-	fstrm_res res;
+#ifdef HAVE_FSTRM_TCP_WRITER_OPTIONS_INIT
+	char addr[256];
+	char *port;
+	struct fstrm_writer_options *fwopt;
+	struct fstrm_tcp_writer_options *ftwopt;
+	struct fstrm_writer *fw;
+
+	(void)strlcpy(addr, ip, sizeof(addr));
+	port = strchr(addr, '@');
+	if (port == NULL) {
+		log_err("dnstap-ip: %s has no @port", ip);
+		return NULL;
+	}
+	*port++ = 0;
+	fwopt = dt_writer_options();
+	ftwopt = fstrm_tcp_writer_options_init();
+	fstrm_tcp_writer_options_set_socket_address(ftwopt, addr);
+	fstrm_tcp_writer_options_set_socket_port(ftwopt, port);
+	fw = fstrm_tcp_writer_init(ftwopt, fwopt);
+	fstrm_tcp_writer_options_destroy(&ftwopt);
+	fstrm_writer_options_destroy(&fwopt);
+	return fw;
+#else
+	log_err("dnstap-ip: %s, the fstrm library has no TCP writer, "
+		"fstrm 0.4 or later is needed", ip);
+	return NULL;
 #endif
+}
+
+/** create the writer for the unix socket */
+static struct fstrm_writer *
+dt_unix_writer(const char *socket_path)
+{
+	struct fstrm_writer_options *fwopt = dt_writer_options();
+	struct fstrm_unix_writer_options *fuwopt;
+	struct fstrm_writer *fw;
+
+	fuwopt = fstrm_unix_writer_options_init();
+	fstrm_unix_writer_options_set_socket_path(fuwopt, socket_path);
+	fw = fstrm_unix_writer_init(fuwopt, fwopt);
+	fstrm_unix_writer_options_destroy(&fuwopt);
+	fstrm_writer_options_destroy(&fwopt);
+	return fw;
+}
+
+struct dt_env *
+dt_create(struct config_file *cfg, unsigned num_workers)
+{
 	struct dt_env *env;
+	struct dt_io *io;
 	struct fstrm_iothr_options *fopt;
-	struct fstrm_unix_writer_options *fuwopt;
 	struct fstrm_writer *fw;
-	struct fstrm_writer_options *fwopt;
 
-	verbose(VERB_OPS, "attempting to connect to dnstap socket %s",
-		socket_path);
-	log_assert(socket_path != NULL);
 	log_assert(num_workers > 0);
 
 	env = (struct dt_env *) calloc(1, sizeof(struct dt_env));
 	if (!env)
 		return NULL;
-
-	fwopt = fstrm_writer_options_init();
-#ifdef UNBOUND_DEBUG
-	res = 
-#else
-	(void)
+	io = (struct dt_io *) calloc(1, sizeof(struct dt_io));
+	if (!io) {
+		free(env);
+		return NULL;
+	}
+	io->rings = (struct dt_ring **) calloc(num_workers,
+		sizeof(struct dt_ring *));
+	if (!io->rings) {
+		free(io);
+		free(env);
+		return NULL;
+	}
+	io->max_rings = num_workers;
+	io->env = env;
+#ifdef DNSTAP_ASYNC
+	io->wake[0] = -1;
+	io->wake[1] = -1;
 #endif
-	    fstrm_writer_options_add_content_type(fwopt,
-		DNSTAP_CONTENT_TYPE, sizeof(DNSTAP_CONTENT_TYPE) - 1);
-	log_assert(res == fstrm_res_success);
-
-	fuwopt = fstrm_unix_writer_options_init();
-	fstrm_unix_writer_options_set_socket_path(fuwopt, socket_path);
-
-	fw = fstrm_unix_writer_init(fuwopt, fwopt);
-	log_assert(fw != NULL);
+	env->io = io;
+	io->ring_size = DNSTAP_RING_ALIGN(cfg->dnstap_ring_size);
+	if (io->ring_size < DNSTAP_RING_MIN) {
+		log_warn("dnstap-ring-size %u too small, using %u",
+			(unsigned)cfg->dnstap_ring_size,
+			(unsigned)DNSTAP_RING_MIN);
+		io->ring_size = DNSTAP_RING_MIN;
+	}
+	lock_basic_init(&io->lock);
+	lock_protect(&io->lock, &io->num_rings, sizeof(io->num_rings));
+
+	if (cfg->dnstap_file != NULL && cfg->dnstap_file[0] != 0) {
+		/* the file is written by the dnstap thread itself */
+		verbose(VERB_OPS, "opening dnstap file %s", cfg->dnstap_file);
+		io->file_path = strdup(cfg->dnstap_file);
+		if (io->file_path == NULL) {
+			dt_delete(env);
+			return NULL;
+		}
+		io->rotate_size = cfg->dnstap_file_rotate_size;
+		io->rotate_interval = cfg->dnstap_file_rotate_interval;
+		io->file_start = time(NULL);
+		io->fw = dt_file_open(io->file_path);
+		if (io->fw == NULL) {
+			dt_delete(env);
+			return NULL;
+		}
+	} else {
+		if (cfg->dnstap_ip != NULL && cfg->dnstap_ip[0] != 0) {
+			verbose(VERB_OPS, "attempting to connect to dnstap "
+				"collector %s", cfg->dnstap_ip);
+			fw = dt_tcp_writer(cfg->dnstap_ip);
+		} else {
+			verbose(VERB_OPS, "attempting to connect to dnstap "
+				"socket %s", cfg->dnstap_socket_path);
+			log_assert(cfg->dnstap_socket_path != NULL);
+			fw = dt_unix_writer(cfg->dnstap_socket_path);
+		}
+		if (fw == NULL) {
+			dt_delete(env);
+			return NULL;
+		}
 
-	fopt = fstrm_iothr_options_init();
-	fstrm_iothr_options_set_num_input_queues(fopt, num_workers);
-	env->iothr = fstrm_iothr_init(fopt, &fw);
-	if (env->iothr == NULL) {
-		verbose(VERB_DETAIL, "dt_create: fstrm_iothr_init() failed");
-		fstrm_writer_destroy(&fw);
-		free(env);
-		env = NULL;
+		/* one input queue, the messages are submitted by the dnstap
+		 * thread, or by the only worker if there are no threads */
+		fopt = fstrm_iothr_options_init();
+		fstrm_iothr_options_set_num_input_queues(fopt, 1);
+		io->iothr = fstrm_iothr_init(fopt, &fw);
+		if (io->iothr == NULL) {
+			verbose(VERB_DETAIL, "dt_create: fstrm_iothr_init() "
+				"failed");
+			fstrm_writer_destroy(&fw);
+		} else {
+			io->ioq = fstrm_iothr_get_input_queue(io->iothr);
+			if (io->ioq == NULL)
+				verbose(VERB_DETAIL, "dt_create: "
+					"fstrm_iothr_get_input_queue() failed");
+		}
+		fstrm_iothr_options_destroy(&fopt);
+		if (io->iothr == NULL || io->ioq == NULL) {
+			dt_delete(env);
+			return NULL;
+		}
 	}
-	fstrm_iothr_options_destroy(&fopt);
-	fstrm_unix_writer_options_destroy(&fuwopt);
-	fstrm_writer_options_destroy(&fwopt);
 
+#ifdef DNSTAP_ASYNC
+	if (pipe(io->wake) == -1) {
+		log_err("dt_create: pipe: %s", strerror(errno));
+		dt_delete(env);
+		return NULL;
+	}
+	/* the workers never block on the wakeup */
+	fd_set_nonblock(io->wake[1]);
+	ub_thread_create(&io->tid, dt_io_thread, io);
+#endif
 	return env;
 }
 
@@ -250,29 +564,106 @@ dt_apply_cfg(struct dt_env *env, struct config_file *cfg)
 	{
 		verbose(VERB_OPS, "dnstap Message/FORWARDER_RESPONSE enabled");
 	}
+	env->sample_rate[0] = (unsigned)cfg->dnstap_sample_resolver_query_messages;
+	env->sample_rate[1] = (unsigned)cfg->dnstap_sample_resolver_response_messages;
+	env->sample_rate[2] = (unsigned)cfg->dnstap_sample_client_query_messages;
+	env->sample_rate[3] = (unsigned)cfg->dnstap_sample_client_response_messages;
+	env->sample_rate[4] = (unsigned)cfg->dnstap_sample_forwarder_query_messages;
+	env->sample_rate[5] = (unsigned)cfg->dnstap_sample_forwarder_response_messages;
+	env->sample_keep_servfail = (unsigned int)
+		cfg->dnstap_sample_keep_servfail;
 }
 
 int
 dt_init(struct dt_env *env)
 {
-	env->ioq = fstrm_iothr_get_input_queue(env->iothr);
-	if (env->ioq == NULL)
+	struct dt_io *io = env->io;
+	struct dt_ring *r = (struct dt_ring *) calloc(1, sizeof(*r));
+	if (r == NULL)
+		return 0;
+#ifdef DNSTAP_ASYNC
+	r->size = io->ring_size;
+	r->buf = (uint8_t *) malloc(r->size);
+	if (r->buf == NULL) {
+		free(r);
 		return 0;
+	}
+#endif
+	lock_basic_init(&r->lock);
+	lock_protect(&r->lock, &r->head, sizeof(r->head));
+	lock_protect(&r->lock, &r->tail, sizeof(r->tail));
+	lock_protect(&r->lock, &r->used, sizeof(r->used));
+	lock_protect(&r->lock, &r->dropped, sizeof(r->dropped));
+	lock_basic_lock(&io->lock);
+	if (io->num_rings >= io->max_rings) {
+		lock_basic_unlock(&io->lock);
+		lock_basic_destroy(&r->lock);
+		free(r->buf);
+		free(r);
+		return 0;
+	}
+	io->rings[io->num_rings++] = r;
+	lock_basic_unlock(&io->lock);
+	env->ring = r;
 	return 1;
 }
 
 void
 dt_delete(struct dt_env *env)
 {
+	struct dt_io *io;
+	unsigned i;
 	if (!env)
 		return;
+	io = env->io;
 	verbose(VERB_OPS, "closing dnstap socket");
-	fstrm_iothr_destroy(&env->iothr);
+#ifdef DNSTAP_ASYNC
+	if (io->wake[1] != -1) {
+		/* stop the dnstap thread, it writes out what is queued */
+		lock_basic_lock(&io->lock);
+		io->want_quit = 1;
+		lock_basic_unlock(&io->lock);
+		if (write(io->wake[1], "q", 1) == -1)
+			log_err("dt_delete: write: %s", strerror(errno));
+		ub_thread_join(io->tid);
+	}
+	if (io->wake[0] != -1)
+		close(io->wake[0]);
+	if (io->wake[1] != -1)
+		close(io->wake[1]);
+#endif
+	if (io->iothr != NULL)
+		fstrm_iothr_destroy(&io->iothr);
+	if (io->fw != NULL)
+		fstrm_writer_destroy(&io->fw);
+	free(io->file_path);
+	for (i = 0; i < io->num_rings; i++) {
+		lock_basic_destroy(&io->rings[i]->lock);
+		free(io->rings[i]->buf);
+		free(io->rings[i]);
+	}
+	lock_basic_destroy(&io->lock);
+	free(io->rings);
+	free(io);
 	free(env->identity);
 	free(env->version);
 	free(env);
 }
 
+size_t
+dt_get_dropped(struct dt_env *env, int reset)
+{
+	size_t r;
+	if (env->ring == NULL)
+		return 0;
+	lock_basic_lock(&env->ring->lock);
+	r = env->ring->dropped;
+	if (reset)
+		env->ring->dropped = 0;
+	lock_basic_unlock(&env->ring->lock);
+	return r;
+}
+
 static void
 dt_fill_timeval(const struct timeval *tv,
 		uint64_t *time_sec, protobuf_c_boolean *has_time_sec,
@@ -287,11 +678,12 @@ dt_fill_timeval(const struct timeval *tv,
 }
 
 static void
-dt_fill_buffer(sldns_buffer *b, ProtobufCBinaryData *p, protobuf_c_boolean *has)
+dt_fill_buffer(uint8_t *data, size_t len, ProtobufCBinaryData *p,
+	protobuf_c_boolean *has)
 {
-	log_assert(b != NULL);
-	p->len = sldns_buffer_limit(b);
-	p->data = sldns_buffer_begin(b);
+	log_assert(data != NULL);
+	p->len = len;
+	p->data = data;
 	*has = 1;
 }
 
@@ -347,36 +739,257 @@ dt_msg_fill_net(struct dt_msg *dm,
 	}
 }
 
+/** encode a copied message and submit it to the I/O thread,
+ * returns false if it is dropped */
+static int
+dt_raw_send(struct dt_io *io, struct dt_raw *raw, uint8_t *zone,
+	uint8_t *msg)
+{
+	struct dt_msg dm;
+	int client = (raw->type == DNSTAP__MESSAGE__TYPE__CLIENT_QUERY ||
+		raw->type == DNSTAP__MESSAGE__TYPE__CLIENT_RESPONSE);
+	int query = (raw->type == DNSTAP__MESSAGE__TYPE__CLIENT_QUERY ||
+		raw->type == DNSTAP__MESSAGE__TYPE__RESOLVER_QUERY ||
+		raw->type == DNSTAP__MESSAGE__TYPE__FORWARDER_QUERY);
+
+	/* type */
+	dt_msg_init(io->env, &dm, (Dnstap__Message__Type)raw->type);
+
+	/* query_zone, for the messages to upstream servers */
+	if (!client) {
+		dm.m.query_zone.data = zone;
+		dm.m.query_zone.len = raw->zone_len;
+		dm.m.has_query_zone = 1;
+	}
+
+	/* query_time_sec, query_time_nsec */
+	if (raw->has_qtime)
+		dt_fill_timeval(&raw->qtime,
+			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
+			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
+
+	/* response_time_sec, response_time_nsec */
+	if (raw->has_rtime)
+		dt_fill_timeval(&raw->rtime,
+			&dm.m.response_time_sec, &dm.m.has_response_time_sec,
+			&dm.m.response_time_nsec, &dm.m.has_response_time_nsec);
+
+	/* query_message or response_message */
+	if (query)
+		dt_fill_buffer(msg, raw->msg_len, &dm.m.query_message,
+			&dm.m.has_query_message);
+	else	dt_fill_buffer(msg, raw->msg_len, &dm.m.response_message,
+			&dm.m.has_response_message);
+
+	/* socket_family, socket_protocol, and the address and port, of the
+	 * client in the query fields, of the server in the response fields */
+	if (client)
+		dt_msg_fill_net(&dm, &raw->addr,
+			(enum comm_point_type)raw->cptype,
+			&dm.m.query_address, &dm.m.has_query_address,
+			&dm.m.query_port, &dm.m.has_query_port);
+	else	dt_msg_fill_net(&dm, &raw->addr,
+			(enum comm_point_type)raw->cptype,
+			&dm.m.response_address, &dm.m.has_response_address,
+			&dm.m.response_port, &dm.m.has_response_port);
+
+	if (!dt_pack(&dm.d, &dm.buf, &dm.len_buf))
+		return 0;
+	return dt_send(io, dm.buf, dm.len_buf);
+}
+
+#ifdef DNSTAP_ASYNC
+/** copy a message into the ring buffer of the worker, and wake up the
+ * dnstap thread if the ring was empty */
+static void
+dt_ring_put(struct dt_io *io, struct dt_ring *r, struct dt_raw *raw,
+	uint8_t *zone, uint8_t *msg)
+{
+	size_t need = DNSTAP_RING_ALIGN(sizeof(*raw) + raw->zone_len +
+		raw->msg_len);
+	size_t skip = 0;
+	int wake;
+	lock_basic_lock(&r->lock);
+	if (r->head + need > r->size)
+		skip = r->size - r->head;
+	if (r->used + skip + need > r->size) {
+		r->dropped++;
+		lock_basic_unlock(&r->lock);
+		return;
+	}
+	if (skip != 0 || r->head == r->size) {
+		/* mark the end of the buffer as not used, if there is room
+		 * for the mark; it is aligned so then there is room */
+		if (skip != 0)
+			memset(r->buf + r->head, 0, sizeof(raw->len));
+		r->head = 0;
+	}
+	raw->len = (uint32_t)need;
+	memcpy(r->buf + r->head, raw, sizeof(*raw));
+	if (raw->zone_len != 0)
+		memcpy(r->buf + r->head + sizeof(*raw), zone, raw->zone_len);
+	memcpy(r->buf + r->head + sizeof(*raw) + raw->zone_len, msg,
+		raw->msg_len);
+	r->head += need;
+	wake = (r->used == 0);
+	r->used += skip + need;
+	lock_basic_unlock(&r->lock);
+	if (wake && write(io->wake[1], "w", 1) == -1 &&
+		errno != EAGAIN && errno != EWOULDBLOCK)
+		verbose(VERB_ALGO, "dnstap wakeup: %s", strerror(errno));
+}
+
+/** encode the messages in the ring buffer, returns the number of
+ * messages taken off */
+static size_t
+dt_ring_drain(struct dt_io *io, struct dt_ring *r)
+{
+	struct dt_raw raw;
+	uint32_t len;
+	size_t pos, avail, done = 0, num = 0, fail = 0;
+	lock_basic_lock(&r->lock);
+	pos = r->tail;
+	avail = r->used;
+	lock_basic_unlock(&r->lock);
+	while (done < avail) {
+		if (pos == r->size)
+			pos = 0;
+		memcpy(&len, r->buf + pos, sizeof(len));
+		if (len == 0) {
+			/* the rest of the buffer is skipped */
+			done += r->size - pos;
+			pos = 0;
+			continue;
+		}
+		memcpy(&raw, r->buf + pos, sizeof(raw));
+		if (!dt_raw_send(io, &raw, r->buf + pos + sizeof(raw),
+			r->buf + pos + sizeof(raw) + raw.zone_len))
+			fail++;
+		num++;
+		pos += len;
+		done += len;
+	}
+	if (done == 0)
+		return 0;
+	lock_basic_lock(&r->lock);
+	r->tail = pos;
+	r->used -= done;
+	r->dropped += fail;
+	lock_basic_unlock(&r->lock);
+	return num;
+}
+
+/** encode the messages in all the ring buffers */
+static size_t
+dt_io_drain(struct dt_io *io)
+{
+	size_t num = 0;
+	unsigned i, n;
+	lock_basic_lock(&io->lock);
+	n = io->num_rings;
+	lock_basic_unlock(&io->lock);
+	for (i = 0; i < n; i++)
+		num += dt_ring_drain(io, io->rings[i]);
+	return num;
+}
+
+/** the dnstap thread, it encodes the messages from the ring buffers
+ * and submits them to the fstrm I/O thread */
+static void *
+dt_io_thread(void *arg)
+{
+	struct dt_io *io = (struct dt_io *) arg;
+	char buf[64];
+	int quit;
+	ub_thread_blocksigs();
+	while (1) {
+		if (dt_io_drain(io) != 0)
+			continue;
+		lock_basic_lock(&io->lock);
+		quit = io->want_quit;
+		lock_basic_unlock(&io->lock);
+		if (quit)
+			break;
+		/* wait until a worker puts a message in an empty ring */
+		if (read(io->wake[0], buf, sizeof(buf)) == -1 &&
+			errno != EINTR) {
+			log_err("dnstap thread: read: %s", strerror(errno));
+			break;
+		}
+	}
+	(void)dt_io_drain(io);
+	return NULL;
+}
+#endif /* DNSTAP_ASYNC */
+
+/** hand a message to the dnstap thread, or encode it here if there are
+ * no threads */
+static void
+dt_submit(struct dt_env *env, struct dt_raw *raw, uint8_t *zone,
+	sldns_buffer *msg)
+{
+	raw->msg_len = sldns_buffer_limit(msg);
+	log_assert(env->ring != NULL);
+#ifdef DNSTAP_ASYNC
+	dt_ring_put(env->io, env->ring, raw, zone, sldns_buffer_begin(msg));
+#else
+	if (!dt_raw_send(env->io, raw, zone, sldns_buffer_begin(msg))) {
+		lock_basic_lock(&env->ring->lock);
+		env->ring->dropped++;
+		lock_basic_unlock(&env->ring->lock);
+	}
+#endif
+}
+
+/** see if the message is logged, with the sample rate of its type;
+ * SERVFAIL responses are logged if configured so */
+static int
+dt_sample(struct dt_env *env, uint32_t type, sldns_buffer *msg)
+{
+	unsigned i = (unsigned)type - DNSTAP__MESSAGE__TYPE__RESOLVER_QUERY;
+	log_assert(i < DT_SAMPLE_NUM);
+	if (env->sample_rate[i] >= 100)
+		return 1;
+	if (env->sample_keep_servfail &&
+		(type == DNSTAP__MESSAGE__TYPE__RESOLVER_RESPONSE ||
+		type == DNSTAP__MESSAGE__TYPE__CLIENT_RESPONSE ||
+		type == DNSTAP__MESSAGE__TYPE__FORWARDER_RESPONSE) &&
+		sldns_buffer_limit(msg) >= LDNS_HEADER_SIZE &&
+		LDNS_RCODE_WIRE(sldns_buffer_begin(msg)) ==
+		LDNS_RCODE_SERVFAIL)
+		return 1;
+	/* log rate out of every 100 messages, evenly spread */
+	env->sample_acc[i] += env->sample_rate[i];
+	if (env->sample_acc[i] < 100)
+		return 0;
+	env->sample_acc[i] -= 100;
+	return 1;
+}
+
 void
 dt_msg_send_client_query(struct dt_env *env,
 			 struct sockaddr_storage *qsock,
 			 enum comm_point_type cptype,
 			 sldns_buffer *qmsg)
 {
-	struct dt_msg dm;
-	struct timeval qtime;
-
-	gettimeofday(&qtime, NULL);
+	struct dt_raw raw;
 
-	/* type */
-	dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__CLIENT_QUERY);
+	if (!dt_sample(env, DNSTAP__MESSAGE__TYPE__CLIENT_QUERY, qmsg))
+		return;
+	memset(&raw, 0, sizeof(raw));
+	raw.type = DNSTAP__MESSAGE__TYPE__CLIENT_QUERY;
 
 	/* query_time */
-	dt_fill_timeval(&qtime,
-			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
-			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
-
-	/* query_message */
-	dt_fill_buffer(qmsg, &dm.m.query_message, &dm.m.has_query_message);
+	gettimeofday(&raw.qtime, NULL);
+	raw.has_qtime = 1;
 
 	/* socket_family, socket_protocol, query_address, query_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, qsock, cptype,
-			&dm.m.query_address, &dm.m.has_query_address,
-			&dm.m.query_port, &dm.m.has_query_port);
+	raw.cptype = (uint32_t)cptype;
+	memcpy(&raw.addr, qsock, sizeof(raw.addr));
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	/* query_message */
+	dt_submit(env, &raw, NULL, qmsg);
 }
 
 void
@@ -385,30 +998,24 @@ dt_msg_send_client_response(struct dt_env *env,
 			    enum comm_point_type cptype,
 			    sldns_buffer *rmsg)
 {
-	struct dt_msg dm;
-	struct timeval rtime;
-
-	gettimeofday(&rtime, NULL);
+	struct dt_raw raw;
 
-	/* type */
-	dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__CLIENT_RESPONSE);
+	if (!dt_sample(env, DNSTAP__MESSAGE__TYPE__CLIENT_RESPONSE, rmsg))
+		return;
+	memset(&raw, 0, sizeof(raw));
+	raw.type = DNSTAP__MESSAGE__TYPE__CLIENT_RESPONSE;
 
 	/* response_time */
-	dt_fill_timeval(&rtime,
-			&dm.m.response_time_sec, &dm.m.has_response_time_sec,
-			&dm.m.response_time_nsec, &dm.m.has_response_time_nsec);
-
-	/* response_message */
-	dt_fill_buffer(rmsg, &dm.m.response_message, &dm.m.has_response_message);
+	gettimeofday(&raw.rtime, NULL);
+	raw.has_rtime = 1;
 
 	/* socket_family, socket_protocol, query_address, query_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, qsock, cptype,
-			&dm.m.query_address, &dm.m.has_query_address,
-			&dm.m.query_port, &dm.m.has_query_port);
+	raw.cptype = (uint32_t)cptype;
+	memcpy(&raw.addr, qsock, sizeof(raw.addr));
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	/* response_message */
+	dt_submit(env, &raw, NULL, rmsg);
 }
 
 void
@@ -418,45 +1025,40 @@ dt_msg_send_outside_query(struct dt_env *env,
 			  uint8_t *zone, size_t zone_len,
 			  sldns_buffer *qmsg)
 {
-	struct dt_msg dm;
-	struct timeval qtime;
+	struct dt_raw raw;
 	uint16_t qflags;
 
-	gettimeofday(&qtime, NULL);
 	qflags = sldns_buffer_read_u16_at(qmsg, 2);
 
 	/* type */
 	if (qflags & BIT_RD) {
 		if (!env->log_forwarder_query_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__FORWARDER_QUERY);
+		memset(&raw, 0, sizeof(raw));
+		raw.type = DNSTAP__MESSAGE__TYPE__FORWARDER_QUERY;
 	} else {
 		if (!env->log_resolver_query_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__RESOLVER_QUERY);
+		memset(&raw, 0, sizeof(raw));
+		raw.type = DNSTAP__MESSAGE__TYPE__RESOLVER_QUERY;
 	}
+	if (!dt_sample(env, raw.type, qmsg))
+		return;
 
 	/* query_zone */
-	dm.m.query_zone.data = zone;
-	dm.m.query_zone.len = zone_len;
-	dm.m.has_query_zone = 1;
+	raw.zone_len = zone_len;
 
 	/* query_time_sec, query_time_nsec */
-	dt_fill_timeval(&qtime,
-			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
-			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
-
-	/* query_message */
-	dt_fill_buffer(qmsg, &dm.m.query_message, &dm.m.has_query_message);
+	gettimeofday(&raw.qtime, NULL);
+	raw.has_qtime = 1;
 
 	/* socket_family, socket_protocol, response_address, response_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, rsock, cptype,
-			&dm.m.response_address, &dm.m.has_response_address,
-			&dm.m.response_port, &dm.m.has_response_port);
+	raw.cptype = (uint32_t)cptype;
+	memcpy(&raw.addr, rsock, sizeof(raw.addr));
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	/* query_message */
+	dt_submit(env, &raw, zone, qmsg);
 }
 
 void
@@ -469,7 +1071,7 @@ dt_msg_send_outside_response(struct dt_env *env,
 			     const struct timeval *rtime,
 			     sldns_buffer *rmsg)
 {
-	struct dt_msg dm;
+	struct dt_raw raw;
 	uint16_t qflags;
 
 	log_assert(qbuf_len >= sizeof(qflags));
@@ -480,39 +1082,35 @@ dt_msg_send_outside_response(struct dt_env *env,
 	if (qflags & BIT_RD) {
 		if (!env->log_forwarder_response_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__FORWARDER_RESPONSE);
+		memset(&raw, 0, sizeof(raw));
+		raw.type = DNSTAP__MESSAGE__TYPE__FORWARDER_RESPONSE;
 	} else {
 		if (!env->log_resolver_response_messages)
 			return;
-		dt_msg_init(env, &dm, DNSTAP__MESSAGE__TYPE__RESOLVER_RESPONSE);
+		memset(&raw, 0, sizeof(raw));
+		raw.type = DNSTAP__MESSAGE__TYPE__RESOLVER_RESPONSE;
 	}
+	if (!dt_sample(env, raw.type, rmsg))
+		return;
 
 	/* query_zone */
-	dm.m.query_zone.data = zone;
-	dm.m.query_zone.len = zone_len;
-	dm.m.has_query_zone = 1;
+	raw.zone_len = zone_len;
 
 	/* query_time_sec, query_time_nsec */
-	dt_fill_timeval(qtime,
-			&dm.m.query_time_sec, &dm.m.has_query_time_sec,
-			&dm.m.query_time_nsec, &dm.m.has_query_time_nsec);
+	raw.qtime = *qtime;
+	raw.has_qtime = 1;
 
 	/* response_time_sec, response_time_nsec */
-	dt_fill_timeval(rtime,
-			&dm.m.response_time_sec, &dm.m.has_response_time_sec,
-			&dm.m.response_time_nsec, &dm.m.has_response_time_nsec);
-
-	/* response_message */
-	dt_fill_buffer(rmsg, &dm.m.response_message, &dm.m.has_response_message);
+	raw.rtime = *rtime;
+	raw.has_rtime = 1;
 
 	/* socket_family, socket_protocol, response_address, response_port */
 	log_assert(cptype == comm_udp || cptype == comm_tcp);
-	dt_msg_fill_net(&dm, rsock, cptype,
-			&dm.m.response_address, &dm.m.has_response_address,
-			&dm.m.response_port, &dm.m.has_response_port);
+	raw.cptype = (uint32_t)cptype;
+	memcpy(&raw.addr, rsock, sizeof(raw.addr));
 
-	if (dt_pack(&dm.d, &dm.buf, &dm.len_buf))
-		dt_send(env, dm.buf, dm.len_buf);
+	/* response_message */
+	dt_submit(env, &raw, zone, rmsg);
 }
 
 #endif /* USE_DNSTAP */
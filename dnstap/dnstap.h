@@ -40,16 +40,22 @@
 #ifdef USE_DNSTAP
 
 struct config_file;
-struct fstrm_io;
-struct fstrm_queue;
 struct sldns_buffer;
+struct dt_io;
+struct dt_ring;
+
+/** number of message types with a sample rate, from RESOLVER_QUERY up to
+ * and including FORWARDER_RESPONSE */
+#define DT_SAMPLE_NUM 6
 
 struct dt_env {
-	/** dnstap I/O thread */
-	struct fstrm_iothr *iothr;
+	/** dnstap I/O, with the thread that encodes and writes the
+	 * messages, shared by the copies of the environment */
+	struct dt_io *io;
 
-	/** dnstap I/O thread input queue */
-	struct fstrm_iothr_queue *ioq;
+	/** ring buffer that this worker copies the messages into, NULL if
+	 * the environment is not initialised with dt_init() */
+	struct dt_ring *ring;
 
 	/** dnstap "identity" field, NULL if disabled */
 	char *identity;
@@ -75,21 +81,31 @@ struct dt_env {
 	unsigned log_forwarder_query_messages : 1;
 	/** whether to log Message/FORWARDER_RESPONSE */
 	unsigned log_forwarder_response_messages : 1;
+	/** whether to log SERVFAIL responses regardless of the sample rate */
+	unsigned sample_keep_servfail : 1;
+
+	/** percentage of the messages that is logged, per message type */
+	unsigned sample_rate[DT_SAMPLE_NUM];
+	/** sample accumulator per message type, a message is logged when
+	 * it reaches 100; the copy of the worker has its own */
+	unsigned sample_acc[DT_SAMPLE_NUM];
 };
 
 /**
  * Create dnstap environment object. Afterwards, call dt_apply_cfg() to fill in
  * the config variables and dt_init() to fill in the per-worker state. Each
- * worker needs a copy of this object but with its own I/O queue (the fq field
- * of the structure) to ensure lock-free access to its own per-worker circular
- * queue.  Duplicate the environment object if more than one worker needs to
- * share access to the dnstap I/O socket.
- * @param socket_path: path to dnstap logging socket, must be non-NULL.
+ * worker needs a copy of this object but with its own ring buffer (the ring
+ * field of the structure).  The workers copy the wire format messages into
+ * their ring buffer, the protobuf encoding and the writes to the dnstap
+ * output are done by a dnstap thread, that is started here.
+ * The output is the dnstap-file if configured, with rotation, or else the
+ * TCP collector at dnstap-ip, or else the dnstap-socket-path.
+ * @param cfg: config with the dnstap output settings.
  * @param num_workers: number of worker threads, must be > 0.
  * @return dt_env object, NULL on failure.
  */
 struct dt_env *
-dt_create(const char *socket_path, unsigned num_workers);
+dt_create(struct config_file *cfg, unsigned num_workers);
 
 /**
  * Apply config settings.
@@ -108,12 +124,22 @@ int
 dt_init(struct dt_env *env);
 
 /**
- * Delete dnstap environment object. Closes dnstap I/O socket and deletes all
- * per-worker I/O queues.
+ * Delete dnstap environment object. Stops the dnstap thread, closes dnstap
+ * I/O socket and deletes all per-worker ring buffers.
  */
 void
 dt_delete(struct dt_env *env);
 
+/**
+ * Get the number of messages that were dropped, because the ring buffer
+ * of the worker was full or the I/O queue could not take them.
+ * @param env: dnstap environment object, initialised with dt_init().
+ * @param reset: if true, the counter is set to zero.
+ * @return the number of dropped messages.
+ */
+size_t
+dt_get_dropped(struct dt_env *env, int reset);
+
 /**
  * Create and send a new dnstap "Message" event of type CLIENT_QUERY.
  * @param env: dnstap environment object.
@@ -42,54 +42,21 @@
 #include "util/module.h"
 #include "addrtree.h"
 
-/** 
- * Create a new edge
- * @param node: Child node this edge will connect to.
- * @param addr: full key to this edge.
- * @param addrlen: length of relevant part of key for this node
- * @param parent_node: Parent node for node
- * @param parent_index: Index of child node at parent node
- * @return new addredge or NULL on failure
- */
-static struct addredge * 
-edge_create(struct addrnode *node, const addrkey_t *addr, 
-	addrlen_t addrlen, struct addrnode *parent_node, int parent_index)
-{
-	size_t n;
-	struct addredge *edge = (struct addredge *)malloc( sizeof (*edge) );
-	if (!edge)
-		return NULL;
-	edge->node = node;
-	edge->len = addrlen;
-	edge->parent_index = parent_index;
-	edge->parent_node = parent_node;
-	/* ceil() */
-	n = (size_t)((addrlen / KEYWIDTH) + ((addrlen % KEYWIDTH != 0)?1:0));
-	edge->str = (addrkey_t *)calloc(n, sizeof (addrkey_t));
-	if (!edge->str) {
-		free(edge);
-		return NULL;
-	}
-	memcpy(edge->str, addr, n * sizeof (addrkey_t));
-	/* Only manipulate other objects after successful alloc */
-	node->parent_edge = edge;
-	log_assert(parent_node->edge[parent_index] == NULL);
-	parent_node->edge[parent_index] = edge;
-	return edge;
-}
-
 /** 
  * Create a new node
  * @param tree: Tree the node lives in.
  * @param elem: Element to store at this node
  * @param scope: Scopemask from server reply
  * @param ttl: Element is valid up to this time. Absolute, seconds
+ * @param addr: full key to this node.
+ * @param addrlen: length of relevant part of key for this node
  * @return new addrnode or NULL on failure
  */
 static struct addrnode * 
 node_create(struct addrtree *tree, void *elem, addrlen_t scope, 
-	time_t ttl)
+	time_t ttl, const addrkey_t *addr, addrlen_t addrlen)
 {
+	size_t n;
 	struct addrnode* node = (struct addrnode *)malloc( sizeof (*node) );
 	if (!node)
 		return NULL;
@@ -97,15 +64,37 @@ node_create(struct addrtree *tree, void *elem, addrlen_t scope,
 	tree->node_count++;
 	node->scope = scope;
 	node->ttl = ttl;
-	node->edge[0] = NULL;
-	node->edge[1] = NULL;
-	node->parent_edge = NULL;
+	node->len = addrlen;
+	node->parent_index = 0;
+	node->child[0] = NULL;
+	node->child[1] = NULL;
+	node->parent = NULL;
 	node->next = NULL;
 	node->prev = NULL;
+	/* ceil() */
+	n = (size_t)((addrlen / KEYWIDTH) + ((addrlen % KEYWIDTH != 0)?1:0));
+	log_assert(n <= ADDRTREE_KEYSIZE);
+	memset(node->key, 0, sizeof(node->key));
+	if (n)
+		memcpy(node->key, addr, n * sizeof (addrkey_t));
 	return node;
 }
 
-/** Size in bytes of node and parent edge
+/** 
+ * Attach node as a child of parent
+ * @param node: Child node.
+ * @param parent: Parent for node
+ * @param index: Index of child node at parent node
+ */
+static void
+node_link(struct addrnode *node, struct addrnode *parent, int index)
+{
+	node->parent = parent;
+	node->parent_index = (uint8_t)index;
+	parent->child[index] = node;
+}
+
+/** Size in bytes of node, the key is stored inline.
  * @param tree: tree the node lives in
  * @param n: node which size must be calculated 
  * @return size in bytes.
@@ -113,8 +102,7 @@ node_create(struct addrtree *tree, void *elem, addrlen_t scope,
 static inline size_t 
 node_size(const struct addrtree *tree, const struct addrnode *n)
 {
-	return sizeof *n + sizeof *n->parent_edge + n->parent_edge->len + 
-		(n->elem?tree->sizefunc(n->elem):0);
+	return sizeof *n + (n->elem?tree->sizefunc(n->elem):0);
 }
 
 struct addrtree * 
@@ -127,7 +115,7 @@ addrtree_create(addrlen_t max_depth, void (*delfunc)(void *, void *),
 	tree = (struct addrtree *)calloc(1, sizeof(*tree));
 	if (!tree)
 		return NULL;
-	tree->root = node_create(tree, NULL, 0, 0);
+	tree->root = node_create(tree, NULL, 0, 0, NULL, 0);
 	if (!tree->root) {
 		free(tree);
 		return NULL;
@@ -204,32 +192,27 @@ lru_update(struct addrtree *tree, struct addrnode *node)
 }
 
 /** 
- * Purge a node from the tree. Node and parentedge are cleaned and 
- * free'd.
+ * Purge a node from the tree. Node is cleaned and free'd.
  * @param tree: Tree the node lives in.
  * @param node: Node to be freed
  */
 static void
 purge_node(struct addrtree *tree, struct addrnode *node)
 {
-	struct addredge *parent_edge, *child_edge = NULL;
+	struct addrnode *parent, *child;
 	int index;
-	int keep = node->edge[0] && node->edge[1];
+	int keep = node->child[0] && node->child[1];
 	
 	clean_node(tree, node);
-	parent_edge = node->parent_edge;
-	if (keep || !parent_edge) return;
+	parent = node->parent;
+	if (keep || !parent) return;
 	tree->node_count--;
-	index = parent_edge->parent_index;
-	child_edge = node->edge[!node->edge[0]];
-	if (child_edge) {
-		child_edge->parent_node  = parent_edge->parent_node;
-		child_edge->parent_index = index;
-	}
-	parent_edge->parent_node->edge[index] = child_edge;
+	index = node->parent_index;
+	child = node->child[!node->child[0]];
+	if (child)
+		node_link(child, parent, index);
+	else parent->child[index] = NULL;
 	tree->size_bytes -= node_size(tree, node);
-	free(parent_edge->str);
-	free(parent_edge);
 	lru_pop(tree, node);
 	free(node);
 }
@@ -247,20 +230,20 @@ lru_cleanup(struct addrtree *tree)
 	while (tree->node_count > tree->max_node_count) {
 		n = tree->first;
 		if (!n) break;
-		children = (n->edge[0] != NULL) + (n->edge[1] != NULL);
+		children = (n->child[0] != NULL) + (n->child[1] != NULL);
 		/** Don't remove this node, it is either the root or we can't
 		 * do without it because it has 2 children */
-		if (children == 2 || !n->parent_edge) {
+		if (children == 2 || !n->parent) {
 			lru_update(tree, n);
 			continue;
 		}
-		p = n->parent_edge->parent_node;
+		p = n->parent;
 		purge_node(tree, n);
 		/** Since we removed n, n's parent p is eligible for deletion
 		 * if it is not the root node, caries no data and has only 1
 		 * child */
-		children = (p->edge[0] != NULL) + (p->edge[1] != NULL);
-		if (!p->elem && children == 1 && p->parent_edge) {
+		children = (p->child[0] != NULL) + (p->child[1] != NULL);
+		if (!p->elem && children == 1 && p->parent) {
 			purge_node(tree, p);
 		}
 	}
@@ -283,8 +266,6 @@ void addrtree_delete(struct addrtree *tree)
 		tree->first = n->next;
 		clean_node(tree, n);
 		tree->size_bytes -= node_size(tree, n);
-		free(n->parent_edge->str);
-		free(n->parent_edge);
 		free(n);
 	}
 	log_assert(sizeof *tree == addrtree_size(tree));
@@ -331,10 +312,27 @@ bits_common(const addrkey_t *s1, addrlen_t l1,
 	const addrkey_t *s2, addrlen_t l2, addrlen_t skip)
 {
 	addrlen_t len, i;
+	size_t b;
+	addrkey_t c;
 	len = (l1 > l2) ? l2 : l1;
 	log_assert(skip < len);
-	for (i = skip; i < len; i++) {
-		if (cmpbit(s1, s2, i)) return i;
+	/* compare a whole key unit at a time, the bits before skip in the
+	 * first unit are already known to be equal */
+	b = skip/KEYWIDTH;
+	c = (s1[b] ^ s2[b]) & (addrkey_t)(0xFF >> (skip%KEYWIDTH));
+	while (1) {
+		if (c) {
+			i = (addrlen_t)(b*KEYWIDTH);
+			while (!(c & 0x80)) {
+				c <<= 1;
+				i++;
+			}
+			return (i < len) ? i : len;
+		}
+		b++;
+		if (b*KEYWIDTH >= (size_t)len)
+			break;
+		c = s1[b] ^ s2[b];
 	}
 	return len;
 } 
@@ -360,8 +358,7 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 	addrlen_t sourcemask, addrlen_t scope, void *elem, time_t ttl, 
 	time_t now)
 {
-	struct addrnode *newnode, *node;
-	struct addredge *edge;
+	struct addrnode *newnode, *node, *child;
 	int index;
 	addrlen_t common, depth;
 
@@ -372,6 +369,7 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 	if (tree->max_depth < scope) scope = tree->max_depth;
 	/* Server answer was less specific than question */
 	if (scope < sourcemask) sourcemask = scope;
+	log_assert(sourcemask <= ADDRTREE_KEYSIZE*KEYWIDTH);
 
 	depth = 0;
 	while (1) {
@@ -387,60 +385,46 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 			return;
 		}
 		index = getbit(addr, sourcemask, depth);
-		/* Get an edge to an unexpired node */
-		edge = node->edge[index];
-		while (edge) {
+		/* Get an unexpired child node */
+		child = node->child[index];
+		while (child) {
 			/* Purge all expired nodes on path */
-			if (!edge->node->elem || edge->node->ttl >= now)
+			if (!child->elem || child->ttl >= now)
 				break;
-			purge_node(tree, edge->node);
-			edge = node->edge[index];
+			purge_node(tree, child);
+			child = node->child[index];
 		}
 		/* Case 2: New leafnode */
-		if (!edge) {
-			newnode = node_create(tree, elem, scope, ttl);
+		if (!child) {
+			newnode = node_create(tree, elem, scope, ttl, addr,
+				sourcemask);
 			if (!newnode) return;
-			if (!edge_create(newnode, addr, sourcemask, node,
-				index)) {
-				clean_node(tree, newnode);
-				tree->node_count--;
-				free(newnode);
-				return;
-			}
+			node_link(newnode, node, index);
 			tree->size_bytes += node_size(tree, newnode);
 			lru_push(tree, newnode);
 			lru_cleanup(tree);
 			return;
 		}
-		/* Case 3: Traverse edge */
-		common = bits_common(edge->str, edge->len, addr, sourcemask,
+		/* Case 3: Traverse to child */
+		common = bits_common(child->key, child->len, addr, sourcemask,
 			depth);
-		if (common == edge->len) {
+		if (common == child->len) {
 			/* We update the scope of intermediate nodes. Apparently
 			 * the * authority changed its mind. If we would not do
 			 * this we might not be able to reach our new node. */
 			node->scope = scope;
-			depth = edge->len;
-			node = edge->node;
+			depth = child->len;
+			node = child;
 			continue;
 		}
 		/* Case 4: split. */
-		if (!(newnode = node_create(tree, NULL, 0, 0)))
-			return;
-		node->edge[index] = NULL;
-		if (!edge_create(newnode, addr, common, node, index)) {
-			node->edge[index] = edge;
-			clean_node(tree, newnode);
-			tree->node_count--;
-			free(newnode);
+		if (!(newnode = node_create(tree, NULL, 0, 0, addr, common)))
 			return;
-		}
+		node_link(newnode, node, index);
 		lru_push(tree, newnode);
 		/* connect existing child to our new node */
-		index = getbit(edge->str, edge->len, common);
-		newnode->edge[index] = edge;
-		edge->parent_node = newnode;
-		edge->parent_index = (int)index;
+		index = getbit(child->key, child->len, common);
+		node_link(child, newnode, index);
 		
 		if (common == sourcemask) {
 			/* Data is stored in the node */
@@ -454,14 +438,15 @@ addrtree_insert(struct addrtree *tree, const addrkey_t *addr,
 		if (common != sourcemask) {
 			/* Data is stored in other leafnode */
 			node = newnode;
-			newnode = node_create(tree, elem, scope, ttl);
-			if (!edge_create(newnode, addr, sourcemask, node,
-				index^1)) {
-				clean_node(tree, newnode);
-				tree->node_count--;
-				free(newnode);
+			newnode = node_create(tree, elem, scope, ttl, addr,
+				sourcemask);
+			if (!newnode) {
+				/* the split node is not needed with one
+				 * child and no data */
+				purge_node(tree, node);
 				return;
 			}
+			node_link(newnode, node, index^1);
 			tree->size_bytes += node_size(tree, newnode);
 			lru_push(tree, newnode);
 		}
@@ -475,7 +460,7 @@ addrtree_find(struct addrtree *tree, const addrkey_t *addr,
 	addrlen_t sourcemask, time_t now)
 {
 	struct addrnode *node = tree->root;
-	struct addredge *edge = NULL;
+	struct addrnode *child = NULL;
 	addrlen_t depth = 0;
 
 	log_assert(node != NULL);
@@ -499,17 +484,17 @@ addrtree_find(struct addrtree *tree, const addrkey_t *addr,
 		/* This is our final depth, but we haven't found an answer. */
 		if (depth == sourcemask)
 			return NULL;
-		/* Find an edge to traverse */
-		edge = node->edge[getbit(addr, sourcemask, depth)];
-		if (!edge || !edge->node)
+		/* Find a child to descend into */
+		child = node->child[getbit(addr, sourcemask, depth)];
+		if (!child)
 			return NULL;
-		if (edge->len > sourcemask )
+		if (child->len > sourcemask )
 			return NULL;
-		if (!issub(edge->str, edge->len, addr, sourcemask, depth))
+		if (!issub(child->key, child->len, addr, sourcemask, depth))
 			return NULL;
-		log_assert(depth < edge->len);
-		depth = edge->len;
-		node = edge->node;
+		log_assert(depth < child->len);
+		depth = child->len;
+		node = child;
 	}
 }
 
@@ -61,6 +61,8 @@
 typedef uint8_t addrlen_t;
 typedef uint8_t addrkey_t;
 #define KEYWIDTH 8
+/** Maximum size of a key in bytes, large enough for an IPv6 address */
+#define ADDRTREE_KEYSIZE 16
 
 struct addrtree {
 	struct addrnode *root;
@@ -95,27 +97,21 @@ struct addrnode {
 	time_t ttl;
 	/** Number of significant bits in address. */
 	addrlen_t scope;
-	/** A node can have 0-2 edges, set to NULL for unused */
-	struct addredge *edge[2];
-	/** edge between this node and parent */
-	struct addredge *parent_edge;
+	/** length in bits of the prefix in key */
+	addrlen_t len;
+	/** Index of this node in the child array of parent */
+	uint8_t parent_index;
+	/** A node can have 0-2 children, set to NULL for unused */
+	struct addrnode *child[2];
+	/** parent node, NULL for the root */
+	struct addrnode *parent;
 	/** previous node in LRU list */
 	struct addrnode *prev;
 	/** next node in LRU list */
 	struct addrnode *next;
-};
-
-struct addredge {
-	/** address of connected node */
-	addrkey_t *str;
-	/** length in bits of str */
-	addrlen_t len;
-	/** child node this edge is connected to */
-	struct addrnode *node;
-	/** Parent node this ege is connected to */
-	struct addrnode *parent_node;
-	/** Index of this edge in parent_node */
-	int parent_index;
+	/** Prefix from the root to this node, stored inline so that a node
+	 * is a single allocation. Only the first len bits are significant */
+	addrkey_t key[ADDRTREE_KEYSIZE];
 };
 
 /**
@@ -581,8 +581,9 @@ store_rrset(sldns_buffer* pkt, struct msg_parse* msg, struct module_env* env,
 	if(!k)
 		return;
 	k->entry.data = NULL;
-	if(!parse_copy_decompress_rrset(pkt, msg, rrset, NULL, k)) {
-		alloc_special_release(env->alloc, k);
+	if(!parse_copy_decompress_rrset(pkt, msg, rrset, env->alloc, NULL,
+		k)) {
+		ub_packed_rrset_parsedelete(k, env->alloc);
 		return;
 	}
 	d = (struct packed_rrset_data*)k->entry.data;
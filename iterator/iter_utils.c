@@ -468,6 +468,29 @@ iter_server_selection(struct iter_env* iter_env,
 	return a;
 }
 
+struct delegpt_addr*
+iter_race_selection(struct iter_env* iter_env, struct module_env* env,
+	struct delegpt* dp, uint8_t* name, size_t namelen, uint16_t qtype,
+	struct sock_list* blacklist)
+{
+	int best_rtt = 0;
+	struct delegpt_addr* a, *sel = NULL;
+	if(!iter_fill_rtt(iter_env, env, name, namelen, qtype, *env->now, dp,
+		&best_rtt, blacklist))
+		return NULL;
+	for(a=dp->result_list; a; a = a->next_result) {
+		/* skip servers already queried, and nonpreferred ones */
+		if(a->attempts != 0 || a->sel_rtt == -1 ||
+			a->sel_rtt >= USEFUL_SERVER_TOP_TIMEOUT)
+			continue;
+		if(!sel || a->sel_rtt < sel->sel_rtt)
+			sel = a;
+	}
+	if(sel)
+		sel->attempts++;
+	return sel;
+}
+
 struct dns_msg* 
 dns_alloc_msg(sldns_buffer* pkt, struct msg_parse* msg, 
 	struct regional* region)
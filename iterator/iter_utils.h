@@ -95,6 +95,24 @@ struct delegpt_addr* iter_server_selection(struct iter_env* iter_env,
 	size_t namelen, uint16_t qtype, int* dnssec_lame,
 	int* chase_to_rd, int open_target, struct sock_list* blacklist);
 
+/**
+ * Select a target for a race query, the fastest server in the result list
+ * that has not been sent a query yet.  Lame, dnssec lame, recursion lame
+ * and unresponsive servers are not used.
+ *
+ * @param iter_env: iterator module global state.
+ * @param env: environment with infra cache (lameness, rtt info).
+ * @param dp: delegation point with result list.
+ * @param name: zone name (for lameness check).
+ * @param namelen: length of name.
+ * @param qtype: query type that we want to send.
+ * @param blacklist: the IP blacklist to use.
+ * @return target or NULL if there is no suitable second server.
+ */
+struct delegpt_addr* iter_race_selection(struct iter_env* iter_env,
+	struct module_env* env, struct delegpt* dp, uint8_t* name,
+	size_t namelen, uint16_t qtype, struct sock_list* blacklist);
+
 /**
  * Allocate dns_msg from parsed msg, in regional.
  * @param pkt: packet.
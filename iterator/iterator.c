@@ -54,6 +54,7 @@
 #include "services/cache/dns.h"
 #include "services/cache/infra.h"
 #include "services/authzone.h"
+#include "services/mesh.h"
 #include "util/module.h"
 #include "util/netevent.h"
 #include "util/net_help.h"
@@ -84,6 +85,15 @@ iter_init(struct module_env* env, int id)
 	lock_protect(&iter_env->queries_ratelimit_lock,
 			&iter_env->num_queries_ratelimited,
 		sizeof(iter_env->num_queries_ratelimited));
+	lock_basic_init(&iter_env->race_lock);
+	lock_protect(&iter_env->race_lock, &iter_env->race_outstanding,
+		sizeof(iter_env->race_outstanding));
+	lock_protect(&iter_env->race_lock, &iter_env->num_race_sent,
+		sizeof(iter_env->num_race_sent));
+	lock_protect(&iter_env->race_lock, &iter_env->num_race_won,
+		sizeof(iter_env->num_race_won));
+	lock_protect(&iter_env->race_lock, &iter_env->num_race_wasted,
+		sizeof(iter_env->num_race_wasted));
 
 	if(!iter_apply_cfg(iter_env, env->cfg)) {
 		log_err("iterator: could not apply configuration settings.");
@@ -111,6 +121,7 @@ iter_deinit(struct module_env* env, int id)
 		return;
 	iter_env = (struct iter_env*)env->modinfo[id];
 	lock_basic_destroy(&iter_env->queries_ratelimit_lock);
+	lock_basic_destroy(&iter_env->race_lock);
 	free(iter_env->target_fetch_policy);
 	priv_delete(iter_env->priv);
 	donotq_delete(iter_env->donotq);
@@ -1977,6 +1988,202 @@ processDSNSFind(struct module_qstate* qstate, struct iter_qstate* iq, int id)
 	return 0;
 }
 	
+/** send the query in qinfo_out to the target, returns the outbound entry
+ * or NULL on failure */
+static struct outbound_entry*
+send_to_target(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie, struct delegpt_addr* target)
+{
+	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
+	return (*qstate->env->send_query)(&iq->qinfo_out,
+		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), 
+		/* unset CD if to forwarder(RD set) and not dnssec retry
+		 * (blacklist nonempty) and no trust-anchors are configured
+		 * above the qname or on the first attempt when dnssec is on */
+		EDNS_DO| ((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
+		!qstate->blacklist&&(!iter_qname_indicates_dnssec(qstate->env,
+		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD), 
+		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
+		ie, iq), &target->addr, target->addrlen,
+		iq->dp->name, iq->dp->namelen,
+		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream), qstate);
+}
+
+/**
+ * Start the race timer, after a query is sent to target.  The delay is
+ * the smoothed rtt plus twice the rtt variance of the target, so that
+ * it fires when the reply is late, compared to the usual variation.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param target: the server the query was sent to.
+ */
+static void
+race_timer_start(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct delegpt_addr* target)
+{
+	struct rtt_info rtt;
+	struct timeval tv;
+	int delay, tA = 0, tAAAA = 0, tother = 0, msec;
+	if(!qstate->env->cfg->upstream_race || !qstate->env->worker_base ||
+		iq->race_count >= qstate->env->cfg->upstream_race_max ||
+		iq->caps_fallback || iq->chase_to_rd || iq->dnssec_lame_query)
+		return;
+	if(infra_get_host_rto(qstate->env->infra_cache, &target->addr,
+		target->addrlen, iq->dp->name, iq->dp->namelen, &rtt, &delay,
+		*qstate->env->now, &tA, &tAAAA, &tother) >= 0)
+		msec = rtt.srtt + 2*rtt.rttvar;
+	else	msec = UNKNOWN_SERVER_NICENESS/2;
+	if(msec < qstate->env->cfg->upstream_race_delay)
+		msec = qstate->env->cfg->upstream_race_delay;
+	if(!iq->race_timer) {
+		iq->race_timer = comm_timer_create(qstate->env->worker_base,
+			iter_race_timer_cb, qstate);
+		if(!iq->race_timer) {
+			log_err("iterator race timer: out of memory");
+			return;
+		}
+	}
+#ifndef S_SPLINT_S
+	tv.tv_sec = msec/1000;
+	tv.tv_usec = (msec%1000)*1000;
+#endif
+	verbose(VERB_ALGO, "race timer in %d msec", msec);
+	comm_timer_set(iq->race_timer, &tv);
+}
+
+/** release race budget for a number of race queries */
+static void
+race_release(struct iter_env* ie, int num)
+{
+	if(num <= 0)
+		return;
+	lock_basic_lock(&ie->race_lock);
+	log_assert(ie->race_outstanding >= (size_t)num);
+	ie->race_outstanding -= (size_t)num;
+	lock_basic_unlock(&ie->race_lock);
+}
+
+/**
+ * Send a race query, the same query to the next best server, while the
+ * query to the selected server is still outstanding.
+ * @param qstate: query state.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ */
+static void
+race_send(struct module_qstate* qstate, struct iter_qstate* iq,
+	struct iter_env* ie)
+{
+	struct delegpt_addr* target;
+	struct outbound_entry* outq;
+	lock_basic_lock(&ie->race_lock);
+	if(ie->race_outstanding >= (size_t)qstate->env->cfg->
+		upstream_race_budget) {
+		lock_basic_unlock(&ie->race_lock);
+		verbose(VERB_ALGO, "race budget exhausted, no race");
+		return;
+	}
+	ie->race_outstanding++;
+	lock_basic_unlock(&ie->race_lock);
+
+	target = iter_race_selection(ie, qstate->env, iq->dp, iq->dp->name,
+		iq->dp->namelen, iq->qchase.qtype, qstate->blacklist);
+	if(!target) {
+		verbose(VERB_ALGO, "no second server to race");
+		race_release(ie, 1);
+		return;
+	}
+	if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok &&
+		!infra_ratelimit_inc(qstate->env->infra_cache, iq->dp->name,
+		iq->dp->namelen, *qstate->env->now)) {
+		verbose(VERB_ALGO, "race query exceeded ratelimits");
+		race_release(ie, 1);
+		return;
+	}
+	if(verbosity >= VERB_QUERY) {
+		log_query_info(VERB_QUERY, "sending race query:",
+			&iq->qinfo_out);
+		log_name_addr(VERB_QUERY, "sending to race target:",
+			iq->dp->name, &target->addr, target->addrlen);
+	}
+	outq = send_to_target(qstate, iq, ie, target);
+	if(!outq) {
+		log_addr(VERB_DETAIL, "error sending race query to auth server",
+			&target->addr, target->addrlen);
+		if(!(iq->chase_flags & BIT_RD) && !iq->ratelimit_ok)
+		    infra_ratelimit_dec(qstate->env->infra_cache, iq->dp->name,
+			iq->dp->namelen, *qstate->env->now);
+		race_release(ie, 1);
+		return;
+	}
+	outq->race = 1;
+	outbound_list_insert(&iq->outlist, outq);
+	iq->num_current_queries++;
+	iq->sent_count++;
+	iq->race_num++;
+	iq->race_count++;
+	lock_basic_lock(&ie->race_lock);
+	ie->num_race_sent++;
+	lock_basic_unlock(&ie->race_lock);
+	/* if the cap allows, race another server if this one is slow too */
+	race_timer_start(qstate, iq, target);
+}
+
+void
+iter_race_timer_cb(void* arg)
+{
+	struct module_qstate* qstate = (struct module_qstate*)arg;
+	int id = qstate->curmod;
+	struct iter_qstate* iq;
+	/* the iterator must still be waiting for the raced query */
+	if(qstate->env->mesh->mods.mod[id] != iter_get_funcblock() ||
+		qstate->ext_state[id] != module_wait_reply)
+		return;
+	iq = (struct iter_qstate*)qstate->minfo[id];
+	if(!iq || !iq->dp || iq->num_current_queries == 0 ||
+		iq->state != QUERYTARGETS_STATE)
+		return;
+	race_send(qstate, iq, (struct iter_env*)qstate->env->modinfo[id]);
+}
+
+/**
+ * The first good answer has arrived, drop the other outstanding queries
+ * of the race.
+ * @param iq: iterator query state.
+ * @param ie: iterator shared global environment.
+ * @param outbound: the query that answered.
+ */
+static void
+race_finish(struct iter_qstate* iq, struct iter_env* ie,
+	struct outbound_entry* outbound)
+{
+	struct outbound_entry* e = iq->outlist.first, *next;
+	int wasted = 0, won = 0, released = 0;
+	if(iq->race_num == 0)
+		return;
+	if(outbound->race)
+		won = 1;
+	while(e) {
+		next = e->next;
+		if(e != outbound) {
+			if(e->race)
+				released++;
+			outbound_list_remove(&iq->outlist, e);
+			iq->num_current_queries--;
+			wasted++;
+		}
+		e = next;
+	}
+	verbose(VERB_ALGO, "race finished, %s answered first, dropped %d",
+		won?"race query":"selected server", wasted);
+	iq->race_num -= released;
+	race_release(ie, released);
+	lock_basic_lock(&ie->race_lock);
+	ie->num_race_won += won;
+	ie->num_race_wasted += wasted;
+	lock_basic_unlock(&ie->race_lock);
+}
+
 /** 
  * This is the request event state where the request will be sent to one of
  * its current query targets. This state also handles issuing target lookup
@@ -2286,8 +2493,11 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 				int qs = 0;
 				verbose(VERB_ALGO, "querying for next "
 					"missing target");
+				/* when racing, resolve two targets in
+				 * parallel, so there is a second server */
 				if(!query_for_targets(qstate, iq, ie, id, 
-					1, &qs)) {
+					qstate->env->cfg->upstream_race?2:1,
+					&qs)) {
 					return error_response(qstate, id,
 						LDNS_RCODE_SERVFAIL);
 				}
@@ -2371,19 +2581,7 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 			iq->dnssec_expected?"expected": "not expected",
 			iq->dnssec_lame_query?" but lame_query anyway": "");
 	}
-	fptr_ok(fptr_whitelist_modenv_send_query(qstate->env->send_query));
-	outq = (*qstate->env->send_query)(&iq->qinfo_out,
-		iq->chase_flags | (iq->chase_to_rd?BIT_RD:0), 
-		/* unset CD if to forwarder(RD set) and not dnssec retry
-		 * (blacklist nonempty) and no trust-anchors are configured
-		 * above the qname or on the first attempt when dnssec is on */
-		EDNS_DO| ((iq->chase_to_rd||(iq->chase_flags&BIT_RD)!=0)&&
-		!qstate->blacklist&&(!iter_qname_indicates_dnssec(qstate->env,
-		&iq->qinfo_out)||target->attempts==1)?0:BIT_CD), 
-		iq->dnssec_expected, iq->caps_fallback || is_caps_whitelisted(
-		ie, iq), &target->addr, target->addrlen,
-		iq->dp->name, iq->dp->namelen,
-		(iq->dp->ssl_upstream || qstate->env->cfg->ssl_upstream), qstate);
+	outq = send_to_target(qstate, iq, ie, target);
 	if(!outq) {
 		log_addr(VERB_DETAIL, "error sending query to auth server", 
 			&target->addr, target->addrlen);
@@ -2398,6 +2596,8 @@ processQueryTargets(struct module_qstate* qstate, struct iter_qstate* iq,
 	iq->num_current_queries++;
 	iq->sent_count++;
 	qstate->ext_state[id] = module_wait_reply;
+	if(qstate->env->cfg->upstream_race)
+		race_timer_start(qstate, iq, target);
 
 	return 0;
 }
@@ -3411,6 +3611,8 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 	sldns_buffer* pkt;
 
 	verbose(VERB_ALGO, "process_response: new external response event");
+	if(iq->race_timer)
+		comm_timer_disable(iq->race_timer);
 	iq->response = NULL;
 	iq->state = QUERY_RESP_STATE;
 	if(event == module_event_noreply || event == module_event_error) {
@@ -3561,8 +3763,15 @@ process_response(struct module_qstate* qstate, struct iter_qstate* iq,
 		}
 	}
 	iq->caps_fallback = 0; /* if we were in fallback, 0x20 is OK now */
+	if(FLAGS_GET_RCODE(iq->response->rep->flags) == LDNS_RCODE_NOERROR ||
+		FLAGS_GET_RCODE(iq->response->rep->flags) == LDNS_RCODE_NXDOMAIN)
+		race_finish(iq, ie, outbound);
 
 handle_it:
+	if(outbound->race) {
+		iq->race_num--;
+		race_release(ie, 1);
+	}
 	outbound_list_remove(&iq->outlist, outbound);
 	iter_handle(qstate, iq, ie, id);
 }
@@ -3618,6 +3827,11 @@ iter_clear(struct module_qstate* qstate, int id)
 		return;
 	iq = (struct iter_qstate*)qstate->minfo[id];
 	if(iq) {
+		comm_timer_delete(iq->race_timer);
+		iq->race_timer = NULL;
+		race_release((struct iter_env*)qstate->env->modinfo[id],
+			iq->race_num);
+		iq->race_num = 0;
 		outbound_list_clear(&iq->outlist);
 		if(iq->target_count && --iq->target_count[0] == 0)
 			free(iq->target_count);
@@ -52,6 +52,7 @@ struct iter_donotq;
 struct iter_prep_list;
 struct iter_priv;
 struct rbtree_type;
+struct comm_timer;
 
 /** max number of targets spawned for a query and its subqueries */
 #define MAX_TARGET_COUNT	64
@@ -134,6 +135,17 @@ struct iter_env {
 	lock_basic_type queries_ratelimit_lock;
 	/** number of queries that have been ratelimited */
 	size_t num_queries_ratelimited;
+
+	/** lock on the upstream race counters */
+	lock_basic_type race_lock;
+	/** number of race queries outstanding, for the race budget */
+	size_t race_outstanding;
+	/** number of race queries sent */
+	size_t num_race_sent;
+	/** number of races where a race query answered first */
+	size_t num_race_won;
+	/** number of queries dropped because another answered first */
+	size_t num_race_wasted;
 };
 
 /**
@@ -392,6 +404,15 @@ struct iter_qstate {
 	int auth_zone_response;
 	/** True if the auth_zones should not be consulted for the query */
 	int auth_zone_avoid;
+
+	/** timer that sends a race query if the reply is slow, or NULL */
+	struct comm_timer* race_timer;
+	/** number of race queries outstanding for this query, the
+	 * entries in the outlist with the race flag, and the race queries
+	 * dropped with the outlist, until they are released */
+	int race_num;
+	/** number of race queries sent for this query */
+	int race_count;
 };
 
 /**
@@ -450,6 +471,9 @@ void iter_inform_super(struct module_qstate* qstate, int id,
 /** iterator cleanup query state */
 void iter_clear(struct module_qstate* qstate, int id);
 
+/** iterator race timer callback, sends a race query, arg is the qstate */
+void iter_race_timer_cb(void* arg);
+
 /** iterator alloc size routine */
 size_t iter_get_mem(struct module_env* env, int id);
 
@@ -86,6 +86,14 @@ context_finalize(struct ub_ctx* ctx)
 		ctx->env->cfg, ctx->env->alloc);
 	if(!ctx->env->rrset_cache)
 		return UB_NOMEM;
+	slabhash_set_hugepage(ctx->env->msg_cache, cfg->cache_huge_pages);
+	slabhash_set_hugepage(&ctx->env->rrset_cache->table,
+		cfg->cache_huge_pages);
+	if(cfg->cache_huge_pages && ctx->superalloc.depot &&
+		!slab_depot_set_arena(ctx->superalloc.depot,
+		cfg->rrset_cache_size))
+		log_warn("cache-huge-pages: no huge pages, the cache is "
+			"malloced");
 	ctx->env->infra_cache = infra_adjust(ctx->env->infra_cache, cfg);
 	if(!ctx->env->infra_cache)
 		return UB_NOMEM;
@@ -128,19 +136,12 @@ find_id(struct ub_ctx* ctx, int* id)
 	return 1;
 }
 
-struct ctx_query* 
-context_new(struct ub_ctx* ctx, const char* name, int rrtype, int rrclass, 
+struct ctx_query*
+context_query_alloc(const char* name, int rrtype, int rrclass,
 	ub_callback_type cb, void* cbarg)
 {
 	struct ctx_query* q = (struct ctx_query*)calloc(1, sizeof(*q));
 	if(!q) return NULL;
-	lock_basic_lock(&ctx->cfglock);
-	if(!find_id(ctx, &q->querynum)) {
-		lock_basic_unlock(&ctx->cfglock);
-		free(q);
-		return NULL;
-	}
-	lock_basic_unlock(&ctx->cfglock);
 	q->node.key = &q->querynum;
 	q->async = (cb != NULL);
 	q->cb = cb;
@@ -158,12 +159,34 @@ context_new(struct ub_ctx* ctx, const char* name, int rrtype, int rrclass,
 	}
 	q->res->qtype = rrtype;
 	q->res->qclass = rrclass;
+	return q;
+}
 
-	/* add to query list */
-	lock_basic_lock(&ctx->cfglock);
+int
+context_query_add(struct ub_ctx* ctx, struct ctx_query* q)
+{
+	if(!find_id(ctx, &q->querynum))
+		return 0;
 	if(q->async)
 		ctx->num_async ++;
 	(void)rbtree_insert(&ctx->queries, &q->node);
+	return 1;
+}
+
+struct ctx_query* 
+context_new(struct ub_ctx* ctx, const char* name, int rrtype, int rrclass, 
+	ub_callback_type cb, void* cbarg)
+{
+	struct ctx_query* q = context_query_alloc(name, rrtype, rrclass,
+		cb, cbarg);
+	if(!q) return NULL;
+	/* add to query list */
+	lock_basic_lock(&ctx->cfglock);
+	if(!context_query_add(ctx, q)) {
+		lock_basic_unlock(&ctx->cfglock);
+		context_query_delete(q);
+		return NULL;
+	}
 	lock_basic_unlock(&ctx->cfglock);
 	return q;
 }
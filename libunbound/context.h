@@ -50,6 +50,7 @@ struct libworker;
 struct tube;
 struct sldns_buffer;
 struct ub_event_base;
+struct ctx_bg_thread;
 
 /**
  * The context structure
@@ -83,11 +84,23 @@ struct ub_ctx {
 	int created_bg;
 	/** pid of bg worker process */
 	pid_t bg_pid;
-	/** tid of bg worker thread */
-	ub_thread_type bg_tid;
+	/** bg worker threads, num_bg of them, if dothread */
+	struct ctx_bg_thread* bg_threads;
+	/** number of bg worker threads */
+	int num_bg;
+	/** next bg worker thread to hand a query to, round robin */
+	int bg_next;
+	/** mutex on the result queue of the bg worker threads */
+	lock_basic_type res_lock;
+	/** answered queries from the bg worker threads, linked by their
+	 * next member. When the queue becomes nonempty a wakeup message
+	 * is written on the rr_pipe. */
+	struct ctx_query* res_first, *res_last;
 
 	/** do threading (instead of forking) for async resolution */
 	int dothread;
+	/** number of bg worker threads to start, if dothread */
+	int num_async_threads;
 	/** next thread number for new threads */
 	int thr_next_num;
 	/** if logfile is overridden */
@@ -117,6 +130,9 @@ struct ub_ctx {
 	struct ub_event_base* event_base;
 	/** libworker for event based interface */
 	struct libworker* event_worker;
+	/** idle foreground workers, for reuse by ub_resolve, linked by
+	 * their next member. protected by cfglock */
+	struct libworker* fg_pool;
 
 	/** next query number (to try) to use */
 	int next_querynum;
@@ -165,6 +181,28 @@ struct ctx_query {
 	/** result structure, also contains original query, type, class.
 	 * malloced ptr ready to hand to the client. */
 	struct ub_result* res;
+
+	/** next in the queue of a bg worker thread, or in the result queue */
+	struct ctx_query* next;
+	/** error code for the answer, from a bg worker thread */
+	int err;
+};
+
+/**
+ * A bg worker thread, used for async resolution with dothread.
+ * The query queue and wakeup tube are owned by the context, the worker
+ * deletes itself when it exits.
+ */
+struct ctx_bg_thread {
+	/** thread id */
+	ub_thread_type tid;
+	/** mutex on the query queue */
+	lock_basic_type lock;
+	/** new queries for the thread, linked by their next member */
+	struct ctx_query* first, *last;
+	/** wakeup tube, a NEWQUERY command is written when the queue
+	 * becomes nonempty, and the QUIT command stops the thread */
+	struct tube* wake;
 };
 
 /**
@@ -231,6 +269,27 @@ int context_query_cmp(const void* a, const void* b);
  */
 void context_query_delete(struct ctx_query* q);
 
+/**
+ * Allocate a new query, it has no querynum yet and is not in the list.
+ * @param name: query name
+ * @param rrtype: type
+ * @param rrclass: class
+ * @param cb: callback for async, or NULL for sync.
+ * @param cbarg: user arg for async queries.
+ * @return new ctx_query or NULL for malloc failure.
+ */
+struct ctx_query* context_query_alloc(const char* name, int rrtype,
+	int rrclass, ub_callback_type cb, void* cbarg);
+
+/**
+ * Give a query a free querynum and add it to the querynum list.
+ * Caller holds the cfglock, so many queries can be added in one go.
+ * @param ctx: context
+ * @param q: query from context_query_alloc.
+ * @return false if no free querynum could be found.
+ */
+int context_query_add(struct ub_ctx* ctx, struct ctx_query* q);
+
 /**
  * Create new query in context, add to querynum list.
  * @param ctx: context
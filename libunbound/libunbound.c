@@ -119,6 +119,9 @@ static struct ub_ctx* ub_ctx_create_nopipe(void)
 	lock_basic_init(&ctx->qqpipe_lock);
 	lock_basic_init(&ctx->rrpipe_lock);
 	lock_basic_init(&ctx->cfglock);
+	lock_basic_init(&ctx->res_lock);
+	lock_protect(&ctx->res_lock, &ctx->res_first, sizeof(ctx->res_first));
+	lock_protect(&ctx->res_lock, &ctx->res_last, sizeof(ctx->res_last));
 	ctx->env = (struct module_env*)calloc(1, sizeof(*ctx->env));
 	if(!ctx->env) {
 		ub_randfree(ctx->seed_rnd);
@@ -156,6 +159,7 @@ static struct ub_ctx* ub_ctx_create_nopipe(void)
 	ctx->env->alloc = &ctx->superalloc;
 	ctx->env->worker = NULL;
 	ctx->env->need_to_validate = 0;
+	ctx->num_async_threads = 1;
 	modstack_init(&ctx->mods);
 	rbtree_init(&ctx->queries, &context_query_cmp);
 	return ctx;
@@ -238,7 +242,29 @@ static void ub_stop_bg(struct ub_ctx* ctx)
 {
 	/* stop the bg thread */
 	lock_basic_lock(&ctx->cfglock);
-	if(ctx->created_bg) {
+	if(ctx->created_bg && ctx->dothread) {
+		int i;
+		uint32_t cmd = UB_LIBCMD_QUIT;
+		lock_basic_unlock(&ctx->cfglock);
+		/* tell all bg threads to quit, then wait for them to exit,
+		 * so that all resources are really gone. */
+		for(i=0; i<ctx->num_bg; i++) {
+			struct ctx_bg_thread* bg = &ctx->bg_threads[i];
+			lock_basic_lock(&bg->lock);
+			(void)tube_write_msg(bg->wake, (uint8_t*)&cmd,
+				(uint32_t)sizeof(cmd), 0);
+			lock_basic_unlock(&bg->lock);
+		}
+		for(i=0; i<ctx->num_bg; i++) {
+			struct ctx_bg_thread* bg = &ctx->bg_threads[i];
+			ub_thread_join(bg->tid);
+			tube_delete(bg->wake);
+			lock_basic_destroy(&bg->lock);
+		}
+		free(ctx->bg_threads);
+		ctx->bg_threads = NULL;
+		ctx->num_bg = 0;
+	} else if(ctx->created_bg) {
 		uint8_t* msg;
 		uint32_t len;
 		uint32_t cmd = UB_LIBCMD_QUIT;
@@ -258,21 +284,13 @@ static void ub_stop_bg(struct ub_ctx* ctx)
 		}
 		lock_basic_unlock(&ctx->rrpipe_lock);
 
-		/* if bg worker is a thread, wait for it to exit, so that all
-	 	 * resources are really gone. */
-		lock_basic_lock(&ctx->cfglock);
-		if(ctx->dothread) {
-			lock_basic_unlock(&ctx->cfglock);
-			ub_thread_join(ctx->bg_tid);
-		} else {
-			lock_basic_unlock(&ctx->cfglock);
+		/* wait for the bg worker process to exit */
 #ifndef UB_ON_WINDOWS
-			if(waitpid(ctx->bg_pid, NULL, 0) == -1) {
-				if(verbosity > 2)
-					log_err("waitpid: %s", strerror(errno));
-			}
-#endif
+		if(waitpid(ctx->bg_pid, NULL, 0) == -1) {
+			if(verbosity > 2)
+				log_err("waitpid: %s", strerror(errno));
 		}
+#endif
 	}
 	else {
 		lock_basic_unlock(&ctx->cfglock);
@@ -291,15 +309,19 @@ ub_ctx_delete(struct ub_ctx* ctx)
 	/* for processes the read pipe is closed and we see that on read */
 #ifdef HAVE_PTHREAD
 	if(ctx->created_bg && ctx->dothread) {
-		if(pthread_kill(ctx->bg_tid, 0) == ESRCH) {
-			/* thread has been killed */
-			do_stop = 0;
+		int i;
+		for(i=0; i<ctx->num_bg; i++) {
+			if(pthread_kill(ctx->bg_threads[i].tid, 0) == ESRCH) {
+				/* thread has been killed */
+				do_stop = 0;
+			}
 		}
 	}
 #endif /* HAVE_PTHREAD */
 	if(do_stop)
 		ub_stop_bg(ctx);
 	libworker_delete_event(ctx->event_worker);
+	libworker_fg_pool_delete(ctx);
 
 	modstack_desetup(&ctx->mods, ctx->env);
 	a = ctx->alloc_list;
@@ -314,6 +336,7 @@ ub_ctx_delete(struct ub_ctx* ctx)
 	lock_basic_destroy(&ctx->qqpipe_lock);
 	lock_basic_destroy(&ctx->rrpipe_lock);
 	lock_basic_destroy(&ctx->cfglock);
+	lock_basic_destroy(&ctx->res_lock);
 	tube_delete(ctx->qq_pipe);
 	tube_delete(ctx->rr_pipe);
 	if(ctx->env) {
@@ -496,6 +519,21 @@ ub_ctx_async(struct ub_ctx* ctx, int dothread)
 	return UB_NOERROR;
 }
 
+int
+ub_ctx_async_threads(struct ub_ctx* ctx, int num)
+{
+	if(num < 1)
+		return UB_SYNTAX;
+	lock_basic_lock(&ctx->cfglock);
+	if(ctx->finalized) {
+		lock_basic_unlock(&ctx->cfglock);
+		return UB_AFTERFINAL;
+	}
+	ctx->num_async_threads = num;
+	lock_basic_unlock(&ctx->cfglock);
+	return UB_NOERROR;
+}
+
 int 
 ub_poll(struct ub_ctx* ctx)
 {
@@ -509,29 +547,13 @@ ub_fd(struct ub_ctx* ctx)
 	return tube_read_fd(ctx->rr_pipe);
 }
 
-/** process answer from bg worker */
-static int
-process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
+/** fill the result for an answered async query and delete the query,
+ * caller holds the cfglock */
+static void
+answer_query_result(struct ub_ctx* ctx, struct ctx_query* q,
 	ub_callback_type* cb, void** cbarg, int* err,
 	struct ub_result** res)
 {
-	struct ctx_query* q;
-	if(context_serial_getcmd(msg, len) != UB_LIBCMD_ANSWER) {
-		log_err("error: bad data from bg worker %d",
-			(int)context_serial_getcmd(msg, len));
-		return 0;
-	}
-
-	lock_basic_lock(&ctx->cfglock);
-	q = context_deserialize_answer(ctx, msg, len, err);
-	if(!q) {
-		lock_basic_unlock(&ctx->cfglock);
-		/* probably simply the lookup that failed, i.e.
-		 * response returned before cancel was sent out, so noerror */
-		return 1;
-	}
-	log_assert(q->async);
-
 	/* grab cb while locked */
 	if(q->cancelled) {
 		*cb = NULL;
@@ -567,6 +589,48 @@ process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
 	(void)rbtree_delete(&ctx->queries, q->node.key);
 	ctx->num_async--;
 	context_query_delete(q);
+}
+
+/** process answer from bg worker */
+static int
+process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
+	ub_callback_type* cb, void** cbarg, int* err,
+	struct ub_result** res)
+{
+	struct ctx_query* q;
+	if(context_serial_getcmd(msg, len) != UB_LIBCMD_ANSWER) {
+		log_err("error: bad data from bg worker %d",
+			(int)context_serial_getcmd(msg, len));
+		return 0;
+	}
+
+	lock_basic_lock(&ctx->cfglock);
+	q = context_deserialize_answer(ctx, msg, len, err);
+	if(!q) {
+		lock_basic_unlock(&ctx->cfglock);
+		/* probably simply the lookup that failed, i.e.
+		 * response returned before cancel was sent out, so noerror */
+		return 1;
+	}
+	log_assert(q->async);
+	answer_query_result(ctx, q, cb, cbarg, err, res);
+	lock_basic_unlock(&ctx->cfglock);
+
+	if(*cb) return 2;
+	ub_resolve_free(*res);
+	return 1;
+}
+
+/** process an answered query from the result queue of the bg threads,
+ * same return values as process_answer_detail */
+static int
+process_answer_queued(struct ub_ctx* ctx, struct ctx_query* q,
+	ub_callback_type* cb, void** cbarg, int* err,
+	struct ub_result** res)
+{
+	lock_basic_lock(&ctx->cfglock);
+	*err = q->err;
+	answer_query_result(ctx, q, cb, cbarg, err, res);
 	lock_basic_unlock(&ctx->cfglock);
 
 	if(*cb) return 2;
@@ -574,6 +638,60 @@ process_answer_detail(struct ub_ctx* ctx, uint8_t* msg, uint32_t len,
 	return 1;
 }
 
+/** take the first answered query from the result queue, or NULL */
+static struct ctx_query*
+result_queue_pop(struct ub_ctx* ctx)
+{
+	struct ctx_query* q;
+	lock_basic_lock(&ctx->res_lock);
+	q = ctx->res_first;
+	if(q) {
+		ctx->res_first = q->next;
+		if(!ctx->res_first)
+			ctx->res_last = NULL;
+		q->next = NULL;
+	}
+	lock_basic_unlock(&ctx->res_lock);
+	return q;
+}
+
+/** read and discard the wakeup messages on the rr_pipe, caller holds
+ * the rrpipe_lock. returns false if the pipe is broken. */
+static int
+drain_wakeups(struct ub_ctx* ctx)
+{
+	uint8_t* msg;
+	uint32_t len;
+	int r;
+	while((r = tube_read_msg(ctx->rr_pipe, &msg, &len, 1)) == 1)
+		free(msg);
+	return r != 0;
+}
+
+/** process the result queue of the bg threads, for ub_process */
+static int
+process_result_queue(struct ub_ctx* ctx)
+{
+	int err;
+	ub_callback_type cb;
+	void* cbarg;
+	struct ub_result* res;
+	struct ctx_query* q;
+	int r;
+	lock_basic_lock(&ctx->rrpipe_lock);
+	r = drain_wakeups(ctx);
+	lock_basic_unlock(&ctx->rrpipe_lock);
+	if(!r)
+		return UB_PIPE;
+	while((q = result_queue_pop(ctx)) != NULL) {
+		/* no locks held while calling callback, so that library
+		 * is re-entrant. */
+		if(process_answer_queued(ctx, q, &cb, &cbarg, &err, &res) == 2)
+			(*cb)(cbarg, err, res);
+	}
+	return UB_NOERROR;
+}
+
 /** process answer from bg worker */
 static int
 process_answer(struct ub_ctx* ctx, uint8_t* msg, uint32_t len)
@@ -600,6 +718,8 @@ ub_process(struct ub_ctx* ctx)
 	int r;
 	uint8_t* msg;
 	uint32_t len;
+	if(ctx->dothread)
+		return process_result_queue(ctx);
 	while(1) {
 		msg = NULL;
 		lock_basic_lock(&ctx->rrpipe_lock);
@@ -640,6 +760,28 @@ ub_wait(struct ub_ctx* ctx)
 		}
 		lock_basic_unlock(&ctx->cfglock);
 
+		if(ctx->dothread) {
+			/* answers are on the result queue, the rr_pipe
+			 * only carries wakeups. Decrement num_async while
+			 * the rrpipe is locked, like below. */
+			struct ctx_query* q = result_queue_pop(ctx);
+			if(!q) {
+				if(tube_wait(ctx->rr_pipe) &&
+					!drain_wakeups(ctx)) {
+					lock_basic_unlock(&ctx->rrpipe_lock);
+					return UB_PIPE;
+				}
+				lock_basic_unlock(&ctx->rrpipe_lock);
+				continue;
+			}
+			r = process_answer_queued(ctx, q, &cb, &cbarg,
+				&err, &res);
+			lock_basic_unlock(&ctx->rrpipe_lock);
+			if(r == 2)
+				(*cb)(cbarg, err, res);
+			continue;
+		}
+
 		/* keep rrpipe locked, while
 		 * 	o waiting for pipe readable
 		 * 	o parsing message
@@ -759,16 +901,10 @@ ub_resolve_event(struct ub_ctx* ctx, const char* name, int rrtype,
 }
 
 
-int 
-ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
-	int rrclass, void* mydata, ub_callback_type callback, int* async_id)
+/** finalize the context and start the bg worker, if not done yet */
+static int
+ub_ctx_start_bg(struct ub_ctx* ctx)
 {
-	struct ctx_query* q;
-	uint8_t* msg = NULL;
-	uint32_t len = 0;
-
-	if(async_id)
-		*async_id = 0;
 	lock_basic_lock(&ctx->cfglock);
 	if(!ctx->finalized) {
 		int r = context_finalize(ctx);
@@ -791,19 +927,91 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	} else {
 		lock_basic_unlock(&ctx->cfglock);
 	}
+	return UB_NOERROR;
+}
+
+/** put a list of queries, linked by their next member, on the queue of
+ * a bg thread. Returns false if the thread could not be woken up, the
+ * list is then not queued. */
+static int
+bg_queue_append(struct ctx_bg_thread* bg, struct ctx_query* first,
+	struct ctx_query* last)
+{
+	lock_basic_lock(&bg->lock);
+	if(bg->last)
+		bg->last->next = first;
+	else {
+		/* the queue was empty, wake up the thread */
+		uint8_t cmd[sizeof(uint32_t)];
+		sldns_write_uint32(cmd, UB_LIBCMD_NEWQUERY);
+		if(!tube_write_msg(bg->wake, cmd, (uint32_t)sizeof(cmd), 0)) {
+			lock_basic_unlock(&bg->lock);
+			return 0;
+		}
+		bg->first = first;
+	}
+	bg->last = last;
+	lock_basic_unlock(&bg->lock);
+	return 1;
+}
+
+/** remove async queries that were not started from the list and delete
+ * them, caller holds the cfglock */
+static void
+queries_remove(struct ub_ctx* ctx, struct ctx_query** qs, int num)
+{
+	int i;
+	for(i=0; i<num; i++) {
+		(void)rbtree_delete(&ctx->queries, qs[i]->node.key);
+		ctx->num_async--;
+		context_query_delete(qs[i]);
+	}
+}
+
+int 
+ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
+	int rrclass, void* mydata, ub_callback_type callback, int* async_id)
+{
+	struct ctx_query* q;
+	uint8_t* msg = NULL;
+	uint32_t len = 0;
+	int r;
+
+	if(async_id)
+		*async_id = 0;
+	if((r=ub_ctx_start_bg(ctx)) != UB_NOERROR)
+		return r;
 
 	/* create new ctx_query and attempt to add to the list */
 	q = context_new(ctx, name, rrtype, rrclass, callback, mydata);
 	if(!q)
 		return UB_NOMEM;
 
+	if(ctx->dothread) {
+		/* put it on the queue of the next bg thread */
+		struct ctx_bg_thread* bg;
+		lock_basic_lock(&ctx->cfglock);
+		if(async_id)
+			*async_id = q->querynum;
+		bg = &ctx->bg_threads[ctx->bg_next];
+		ctx->bg_next = (ctx->bg_next+1) % ctx->num_bg;
+		lock_basic_unlock(&ctx->cfglock);
+		if(!bg_queue_append(bg, q, q)) {
+			lock_basic_lock(&ctx->cfglock);
+			queries_remove(ctx, &q, 1);
+			lock_basic_unlock(&ctx->cfglock);
+			if(async_id)
+				*async_id = 0;
+			return UB_PIPE;
+		}
+		return UB_NOERROR;
+	}
+
 	/* write over pipe to background worker */
 	lock_basic_lock(&ctx->cfglock);
 	msg = context_serialize_new_query(q, &len);
 	if(!msg) {
-		(void)rbtree_delete(&ctx->queries, q->node.key);
-		ctx->num_async--;
-		context_query_delete(q);
+		queries_remove(ctx, &q, 1);
 		lock_basic_unlock(&ctx->cfglock);
 		return UB_NOMEM;
 	}
@@ -822,6 +1030,143 @@ ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype,
 	return UB_NOERROR;
 }
 
+/** hand a batch of queries, that are in the list, to the bg threads.
+ * Every thread gets a run of consecutive queries, with one wakeup. */
+static int
+batch_to_threads(struct ub_ctx* ctx, struct ub_batch_query* queries,
+	struct ctx_query** qs, int num)
+{
+	int i, j, chunk, first_bg, ret = UB_NOERROR;
+	lock_basic_lock(&ctx->cfglock);
+	chunk = (num + ctx->num_bg - 1) / ctx->num_bg;
+	first_bg = ctx->bg_next;
+	ctx->bg_next = (ctx->bg_next + (num + chunk - 1)/chunk) % ctx->num_bg;
+	lock_basic_unlock(&ctx->cfglock);
+	for(i=0; i<num; i+=chunk) {
+		int n = (num-i < chunk)?num-i:chunk;
+		struct ctx_bg_thread* bg = &ctx->bg_threads[
+			(first_bg + i/chunk) % ctx->num_bg];
+		for(j=i; j<i+n-1; j++)
+			qs[j]->next = qs[j+1];
+		if(!bg_queue_append(bg, qs[i], qs[i+n-1])) {
+			for(j=i; j<i+n; j++) {
+				qs[j]->next = NULL;
+				queries[j].async_id = 0;
+			}
+			lock_basic_lock(&ctx->cfglock);
+			queries_remove(ctx, qs+i, n);
+			lock_basic_unlock(&ctx->cfglock);
+			ret = UB_PIPE;
+		}
+	}
+	return ret;
+}
+
+/** serialize a batch of queries, that are in the list, and write them
+ * to the forked bg worker */
+static int
+batch_to_pipe(struct ub_ctx* ctx, struct ub_batch_query* queries,
+	struct ctx_query** qs, int num)
+{
+	uint8_t** msgs;
+	uint32_t* lens;
+	int i, written;
+	msgs = (uint8_t**)calloc((size_t)num, sizeof(*msgs));
+	lens = (uint32_t*)calloc((size_t)num, sizeof(*lens));
+	lock_basic_lock(&ctx->cfglock);
+	for(i=0; msgs && lens && i<num; i++) {
+		if(!(msgs[i] = context_serialize_new_query(qs[i], &lens[i])))
+			break;
+	}
+	if(!msgs || !lens || i<num) {
+		queries_remove(ctx, qs, num);
+		lock_basic_unlock(&ctx->cfglock);
+		for(i=0; i<num; i++) {
+			queries[i].async_id = 0;
+			if(msgs) free(msgs[i]);
+		}
+		free(msgs);
+		free(lens);
+		return UB_NOMEM;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+
+	lock_basic_lock(&ctx->qqpipe_lock);
+	for(i=0; i<num; i++) {
+		if(!tube_write_msg(ctx->qq_pipe, msgs[i], lens[i], 0))
+			break;
+	}
+	lock_basic_unlock(&ctx->qqpipe_lock);
+	written = i;
+	if(written < num) {
+		/* the rest is not started */
+		lock_basic_lock(&ctx->cfglock);
+		queries_remove(ctx, qs+written, num-written);
+		lock_basic_unlock(&ctx->cfglock);
+		for(i=written; i<num; i++)
+			queries[i].async_id = 0;
+	}
+	for(i=0; i<num; i++)
+		free(msgs[i]);
+	free(msgs);
+	free(lens);
+	return (written<num)?UB_PIPE:UB_NOERROR;
+}
+
+int 
+ub_resolve_batch(struct ub_ctx* ctx, struct ub_batch_query* queries,
+	int num, ub_callback_type callback)
+{
+	struct ctx_query** qs;
+	int i, r;
+
+	for(i=0; i<num; i++)
+		queries[i].async_id = 0;
+	if(num <= 0)
+		return UB_NOERROR;
+	if((r=ub_ctx_start_bg(ctx)) != UB_NOERROR)
+		return r;
+
+	/* create all the queries, and add them to the list in one go */
+	qs = (struct ctx_query**)calloc((size_t)num, sizeof(*qs));
+	if(!qs)
+		return UB_NOMEM;
+	for(i=0; i<num; i++) {
+		qs[i] = context_query_alloc(queries[i].name, queries[i].rrtype,
+			queries[i].rrclass, callback, queries[i].mydata);
+		if(!qs[i]) {
+			while(i--)
+				context_query_delete(qs[i]);
+			free(qs);
+			return UB_NOMEM;
+		}
+	}
+	lock_basic_lock(&ctx->cfglock);
+	for(i=0; i<num; i++) {
+		if(!context_query_add(ctx, qs[i]))
+			break;
+		queries[i].async_id = qs[i]->querynum;
+	}
+	if(i < num) {
+		int j;
+		queries_remove(ctx, qs, i);
+		lock_basic_unlock(&ctx->cfglock);
+		for(j=i; j<num; j++)
+			context_query_delete(qs[j]);
+		for(j=0; j<num; j++)
+			queries[j].async_id = 0;
+		free(qs);
+		return UB_NOMEM;
+	}
+	lock_basic_unlock(&ctx->cfglock);
+
+	if(ctx->dothread)
+		r = batch_to_threads(ctx, queries, qs, num);
+	else	r = batch_to_pipe(ctx, queries, qs, num);
+	free(qs);
+	return r;
+}
+
 int 
 ub_cancel(struct ub_ctx* ctx, int async_id)
 {
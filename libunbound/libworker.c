@@ -62,6 +62,7 @@
 #include "util/random.h"
 #include "util/config_file.h"
 #include "util/netevent.h"
+#include "util/ub_event.h"
 #include "util/storage/lookup3.h"
 #include "util/storage/slabhash.h"
 #include "util/net_help.h"
@@ -76,6 +77,8 @@
 
 /** handle new query command for bg worker */
 static void handle_newq(struct libworker* w, uint8_t* buf, uint32_t len);
+/** start resolution of a new query in the bg worker */
+static void handle_newq_query(struct libworker* w, struct ctx_query* q);
 
 /** delete libworker env */
 static void
@@ -130,6 +133,7 @@ libworker_setup(struct ub_ctx* ctx, int is_bg, struct ub_event_base* eb)
 	if(!w) return NULL;
 	w->is_bg = is_bg;
 	w->ctx = ctx;
+	w->pid = getpid();
 	w->env = (struct module_env*)malloc(sizeof(*w->env));
 	if(!w->env) {
 		free(w);
@@ -272,14 +276,7 @@ struct libworker* libworker_create_event(struct ub_ctx* ctx,
 static void
 handle_cancel(struct libworker* w, uint8_t* buf, uint32_t len)
 {
-	struct ctx_query* q;
-	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
-		q = context_deserialize_cancel(w->ctx, buf, len);
-		lock_basic_unlock(&w->ctx->cfglock);
-	} else {
-		q = context_deserialize_cancel(w->ctx, buf, len);
-	}
+	struct ctx_query* q = context_deserialize_cancel(w->ctx, buf, len);
 	if(!q) {
 		/* probably simply lookup failed, i.e. the message had been
 		 * processed and answered before the cancel arrived */
@@ -289,6 +286,25 @@ handle_cancel(struct libworker* w, uint8_t* buf, uint32_t len)
 	free(buf);
 }
 
+/** take the queued queries of a bg worker thread, frees the wakeup msg */
+static void
+handle_bg_queue(struct libworker* w, uint8_t* msg)
+{
+	struct ctx_query* q, *next;
+	free(msg);
+	lock_basic_lock(&w->bg->lock);
+	q = w->bg->first;
+	w->bg->first = NULL;
+	w->bg->last = NULL;
+	lock_basic_unlock(&w->bg->lock);
+	while(q) {
+		next = q->next;
+		q->next = NULL;
+		handle_newq_query(w, q);
+		q = next;
+	}
+}
+
 /** do control command coming into bg server */
 static void
 libworker_do_cmd(struct libworker* w, uint8_t* msg, uint32_t len)
@@ -305,7 +321,9 @@ libworker_do_cmd(struct libworker* w, uint8_t* msg, uint32_t len)
 			comm_base_exit(w->base);
 			break;
 		case UB_LIBCMD_NEWQUERY:
-			handle_newq(w, msg, len);
+			if(w->bg)
+				handle_bg_queue(w, msg);
+			else	handle_newq(w, msg, len);
 			break;
 		case UB_LIBCMD_CANCEL:
 			handle_cancel(w, msg, len);
@@ -350,6 +368,21 @@ libworker_dobg(void* arg)
 	tube_close_write(ctx->qq_pipe);
 	tube_close_read(ctx->rr_pipe);
 #endif
+	if(w->bg) {
+		/* one of the bg threads, queries arrive on the queue and
+		 * answers are put on the ctx result queue */
+		struct tube* wake = w->bg->wake;
+		if(!tube_setup_bg_listen(wake, w->base, 
+			libworker_handle_control_cmd, w)) {
+			log_err("libunbound bg worker init failed, no bglisten");
+			return NULL;
+		}
+		comm_base_dispatch(w->base);
+		w->want_quit = 1;
+		tube_remove_bg_listen(wake);
+		libworker_delete(w);
+		return NULL;
+	}
 	if(!tube_setup_bg_listen(ctx->qq_pipe, w->base, 
 		libworker_handle_control_cmd, w)) {
 		log_err("libunbound bg worker init failed, no bglisten");
@@ -385,14 +418,38 @@ int libworker_bg(struct ub_ctx* ctx)
 	/* fork or threadcreate */
 	lock_basic_lock(&ctx->cfglock);
 	if(ctx->dothread) {
+		int i, num = ctx->num_async_threads;
 		lock_basic_unlock(&ctx->cfglock);
-		w = libworker_setup(ctx, 1, NULL);
-		if(!w) return UB_NOMEM;
-		w->is_bg_thread = 1;
+		ctx->bg_threads = (struct ctx_bg_thread*)calloc((size_t)num,
+			sizeof(struct ctx_bg_thread));
+		if(!ctx->bg_threads)
+			return UB_NOMEM;
+		for(i=0; i<num; i++) {
+			struct ctx_bg_thread* bg = &ctx->bg_threads[i];
+			if(!(bg->wake = tube_create()))
+				break;
+			w = libworker_setup(ctx, 1, NULL);
+			if(!w) {
+				tube_delete(bg->wake);
+				bg->wake = NULL;
+				break;
+			}
+			w->is_bg_thread = 1;
+			w->bg = bg;
 #ifdef ENABLE_LOCK_CHECKS
-		w->thread_num = 1; /* for nicer DEBUG checklocks */
+			w->thread_num = 1+i; /* for nicer DEBUG checklocks */
 #endif
-		ub_thread_create(&ctx->bg_tid, libworker_dobg, w);
+			lock_basic_init(&bg->lock);
+			lock_protect(&bg->lock, &bg->first, sizeof(bg->first));
+			lock_protect(&bg->lock, &bg->last, sizeof(bg->last));
+			ctx->num_bg = i+1;
+			ub_thread_create(&bg->tid, libworker_dobg, w);
+		}
+		if(ctx->num_bg == 0) {
+			free(ctx->bg_threads);
+			ctx->bg_threads = NULL;
+			return UB_NOMEM;
+		}
 	} else {
 		lock_basic_unlock(&ctx->cfglock);
 #ifndef HAVE_FORK
@@ -579,16 +636,69 @@ setup_qinfo_edns(struct libworker* w, struct ctx_query* q,
 	return 1;
 }
 
+/** get an idle fg worker from the pool, or setup a fresh one */
+static struct libworker*
+libworker_fg_obtain(struct ub_ctx* ctx)
+{
+	struct libworker* w;
+	while(1) {
+		lock_basic_lock(&ctx->cfglock);
+		w = ctx->fg_pool;
+		if(w)
+			ctx->fg_pool = w->next;
+		lock_basic_unlock(&ctx->cfglock);
+		if(!w)
+			return libworker_setup(ctx, 0, NULL);
+		if(w->pid == getpid())
+			break;
+		/* created before a fork, do not share it with the parent */
+		libworker_delete(w);
+	}
+	w->next = NULL;
+	/* the time was last updated when it was used before */
+	ub_comm_base_now(w->base);
+	return w;
+}
+
+/** put the fg worker back in the pool of the ctx, for the next query */
+static void
+libworker_fg_release(struct libworker* w)
+{
+	struct ub_ctx* ctx = w->ctx;
+	/* remove leftover states, such as subqueries that did not finish,
+	 * this also stops their outstanding queries */
+	if(w->env->mesh->all_count != 0)
+		mesh_delete_all(w->env->mesh);
+	regional_free_all(w->env->scratch);
+	lock_basic_lock(&ctx->cfglock);
+	w->next = ctx->fg_pool;
+	ctx->fg_pool = w;
+	lock_basic_unlock(&ctx->cfglock);
+}
+
+void
+libworker_fg_pool_delete(struct ub_ctx* ctx)
+{
+	struct libworker* w, *n;
+	w = ctx->fg_pool;
+	ctx->fg_pool = NULL;
+	while(w) {
+		n = w->next;
+		libworker_delete(w);
+		w = n;
+	}
+}
+
 int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 {
-	struct libworker* w = libworker_setup(ctx, 0, NULL);
+	struct libworker* w = libworker_fg_obtain(ctx);
 	uint16_t qflags, qid;
 	struct query_info qinfo;
 	struct edns_data edns;
 	if(!w)
 		return UB_INITFAIL;
 	if(!setup_qinfo_edns(w, q, &qinfo, &edns)) {
-		libworker_delete(w);
+		libworker_fg_release(w);
 		return UB_SYNTAX;
 	}
 	qid = 0;
@@ -603,7 +713,7 @@ int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 		regional_free_all(w->env->scratch);
 		libworker_fillup_fg(q, LDNS_RCODE_NOERROR, 
 			w->back->udp_buff, sec_status_insecure, NULL);
-		libworker_delete(w);
+		libworker_fg_release(w);
 		free(qinfo.qname);
 		return UB_NOERROR;
 	}
@@ -612,13 +722,14 @@ int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 		regional_free_all(w->env->scratch);
 		libworker_fillup_fg(q, LDNS_RCODE_NOERROR, 
 			w->back->udp_buff, sec_status_insecure, NULL);
-		libworker_delete(w);
+		libworker_fg_release(w);
 		free(qinfo.qname);
 		return UB_NOERROR;
 	}
 	/* process new query */
 	if(!mesh_new_callback(w->env->mesh, &qinfo, qflags, &edns, 
 		w->back->udp_buff, qid, libworker_fg_done_cb, q)) {
+		libworker_fg_release(w);
 		free(qinfo.qname);
 		return UB_NOMEM;
 	}
@@ -627,7 +738,7 @@ int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q)
 	/* wait for reply */
 	comm_base_dispatch(w->base);
 
-	libworker_delete(w);
+	libworker_fg_release(w);
 	return UB_NOERROR;
 }
 
@@ -719,20 +830,36 @@ add_bg_result(struct libworker* w, struct ctx_query* q, sldns_buffer* pkt,
 		return;
 	}
 	/* serialize and delete unneeded q */
-	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
+	if(w->bg) {
+		/* put it on the result queue, no need to serialize */
+		struct ub_ctx* ctx = w->ctx;
+		lock_basic_lock(&ctx->cfglock);
 		if(reason)
 			q->res->why_bogus = strdup(reason);
+		q->err = err;
 		if(pkt) {
 			q->msg_len = sldns_buffer_remaining(pkt);
 			q->msg = memdup(sldns_buffer_begin(pkt), q->msg_len);
 			if(!q->msg)
-				msg = context_serialize_answer(q, UB_NOMEM, 
-				NULL, &len);
-			else	msg = context_serialize_answer(q, err, 
-				NULL, &len);
-		} else msg = context_serialize_answer(q, err, NULL, &len);
-		lock_basic_unlock(&w->ctx->cfglock);
+				q->err = UB_NOMEM;
+		}
+		lock_basic_unlock(&ctx->cfglock);
+		lock_basic_lock(&ctx->res_lock);
+		if(ctx->res_last)
+			ctx->res_last->next = q;
+		else {
+			/* the queue was empty, wake up the reader; the
+			 * res_lock serializes the writers on the pipe */
+			uint8_t cmd[sizeof(uint32_t)];
+			sldns_write_uint32(cmd, UB_LIBCMD_ANSWER);
+			ctx->res_first = q;
+			if(!tube_write_msg(ctx->rr_pipe, cmd,
+				(uint32_t)sizeof(cmd), 0))
+				log_err("could not write wakeup for answer");
+		}
+		ctx->res_last = q;
+		lock_basic_unlock(&ctx->res_lock);
+		return;
 	} else {
 		if(reason)
 			q->res->why_bogus = strdup(reason);
@@ -785,22 +912,22 @@ libworker_bg_done_cb(void* arg, int rcode, sldns_buffer* buf, enum sec_status s,
 static void
 handle_newq(struct libworker* w, uint8_t* buf, uint32_t len)
 {
-	uint16_t qflags, qid;
-	struct query_info qinfo;
-	struct edns_data edns;
-	struct ctx_query* q;
-	if(w->is_bg_thread) {
-		lock_basic_lock(&w->ctx->cfglock);
-		q = context_lookup_new_query(w->ctx, buf, len);
-		lock_basic_unlock(&w->ctx->cfglock);
-	} else {
-		q = context_deserialize_new_query(w->ctx, buf, len);
-	}
+	struct ctx_query* q = context_deserialize_new_query(w->ctx, buf, len);
 	free(buf);
 	if(!q) {
 		log_err("failed to deserialize newq");
 		return;
 	}
+	handle_newq_query(w, q);
+}
+
+/** start resolution of a new query in the bg worker */
+static void
+handle_newq_query(struct libworker* w, struct ctx_query* q)
+{
+	uint16_t qflags, qid;
+	struct query_info qinfo;
+	struct edns_data edns;
 	if(!setup_qinfo_edns(w, q, &qinfo, &edns)) {
 		add_bg_result(w, q, NULL, UB_SYNTAX, NULL);
 		return;
@@ -849,16 +976,18 @@ struct outbound_entry* libworker_send_query(struct query_info* qinfo,
 	size_t zonelen, int ssl_upstream, struct module_qstate* q)
 {
 	struct libworker* w = (struct libworker*)q->env->worker;
-	struct outbound_entry* e = (struct outbound_entry*)regional_alloc(
-		q->region, sizeof(*e));
+	struct outbound_entry* e = (struct outbound_entry*)alloc_obj_obtain(
+		q->env->alloc, sizeof(*e));
 	if(!e)
 		return NULL;
 	e->qstate = q;
+	e->race = 0;
 	e->qsent = outnet_serviced_query(w->back, qinfo, flags, dnssec,
 		want_dnssec, nocaps, q->env->cfg->tcp_upstream, ssl_upstream,
 		addr, addrlen, zone, zonelen, q, libworker_handle_service_reply,
 		e, w->back->udp_buff, q->env);
 	if(!e->qsent) {
+		alloc_obj_release(q->env->alloc, e, sizeof(*e));
 		return NULL;
 	}
 	return e;
@@ -60,6 +60,7 @@ struct tube;
 struct sldns_buffer;
 struct ub_event_base;
 struct query_info;
+struct ctx_bg_thread;
 
 /** 
  * The library-worker status structure
@@ -77,6 +78,8 @@ struct libworker {
 	int is_bg_thread;
 	/** want to quit, stop handling new content */
 	int want_quit;
+	/** the query queue, if this is one of the bg worker threads */
+	struct ctx_bg_thread* bg;
 
 	/** copy of the module environment with worker local entries. */
 	struct module_env* env;
@@ -88,6 +91,11 @@ struct libworker {
 	struct ub_randstate* rndstate;
 	/** sslcontext for SSL wrapped DNS over TCP queries */
 	void* sslctx;
+	/** next idle foreground worker in the ctx pool */
+	struct libworker* next;
+	/** process that created the worker, a pooled worker is not
+	 * reused in a forked child */
+	pid_t pid;
 };
 
 /**
@@ -105,12 +113,21 @@ int libworker_bg(struct ub_ctx* ctx);
  * This worker will join the threadpool of resolver threads.
  * It exits when the query answer has been obtained (or error).
  * This routine blocks until the worker is finished.
+ * The worker is taken from the pool of idle foreground workers in the
+ * ctx if there is one, and put back there afterwards, so that the
+ * setup of event base, outside network and mesh is done once.
  * @param ctx: new allocation cache obtained and returned to it.
  * @param q: query (result is stored in here).
  * @return 0 if finished OK, else error.
  */
 int libworker_fg(struct ub_ctx* ctx, struct ctx_query* q);
 
+/**
+ * Delete the idle foreground workers of the ctx.
+ * @param ctx: context, the fg_pool is emptied.
+ */
+void libworker_fg_pool_delete(struct ub_ctx* ctx);
+
 /**
  * create worker for event-based interface.
  * @param ctx: context with config.
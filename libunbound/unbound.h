@@ -225,6 +225,23 @@ struct ub_result {
  */
 typedef void (*ub_callback_type)(void*, int, struct ub_result*);
 
+/**
+ * A query for ub_resolve_batch.
+ */
+struct ub_batch_query {
+	/** domain name in text format (a string) */
+	const char* name;
+	/** type of RR in host order, 1 is A */
+	int rrtype;
+	/** class of RR in host order, 1 is IN (for internet) */
+	int rrclass;
+	/** your own data, passed to the callback for this query */
+	void* mydata;
+	/** set by ub_resolve_batch to the identifier number of the query,
+	 * that can be used to cancel it, or 0 if it was not started */
+	int async_id;
+};
+
 /**
  * Create a resolving and validation context.
  * The information from /etc/resolv.conf and /etc/hosts is not utilised by
@@ -436,6 +453,18 @@ int ub_ctx_debuglevel(struct ub_ctx* ctx, int d);
  */
 int ub_ctx_async(struct ub_ctx* ctx, int dothread);
 
+/**
+ * Set the number of threads that handle work in the background, when
+ * threading is enabled with ub_ctx_async.  The num-threads option of a
+ * config file is not used for this.
+ * @param ctx: context.
+ * @param num: number of threads, 1 or more, the default is 1.
+ *	Queries are handed to the threads in turn.  After the first
+ *	resolve_async() call the setting can no longer be changed.
+ * @return 0 if OK, else error.
+ */
+int ub_ctx_async_threads(struct ub_ctx* ctx, int num);
+
 /**
  * Poll a context to see if it has any new results
  * Do not poll in a loop, instead extract the fd below to poll for readiness,
@@ -521,6 +550,28 @@ int ub_resolve(struct ub_ctx* ctx, const char* name, int rrtype,
 int ub_resolve_async(struct ub_ctx* ctx, const char* name, int rrtype, 
 	int rrclass, void* mydata, ub_callback_type callback, int* async_id);
 
+/**
+ * Perform resolution and validation of a batch of targets, asynchronously.
+ * Like ub_resolve_async for every query in the array, but the queries are
+ * added to the context and handed to the background in one operation,
+ * which is cheaper when there are many of them.
+ * The results are delivered one by one, with ub_process() or ub_wait(),
+ * by calling the callback with the mydata of the query.
+ *
+ * @param ctx: context.
+ *	The context is finalized, and can no longer accept config changes.
+ * @param queries: array of queries, with name, type, class and mydata.
+ *	The async_id of every query is set, it can be used to cancel it.
+ * @param num: number of queries in the array.
+ * @param callback: called on completion of every query, like for
+ *	ub_resolve_async.
+ * @return 0 if OK, else error.  On an error the queries with a zero
+ *	async_id have not been started, if it is a pipe error, other
+ *	queries may be started and their callbacks are called.
+ */
+int ub_resolve_batch(struct ub_ctx* ctx, struct ub_batch_query* queries,
+	int num, ub_callback_type callback);
+
 /**
  * Cancel an async query in progress.
  * Its callback will not be called.
@@ -601,6 +652,30 @@ int ub_ctx_data_remove(struct ub_ctx* ctx, const char *data);
  */
 const char* ub_version(void);
 
+/** number of heavy hitter categories */
+#define UB_STATS_HEAVY_CAT_NUM 4
+/** heavy hitter category of the client addresses */
+#define UB_STATS_HEAVY_CLIENT 0
+/** heavy hitter category of the query names */
+#define UB_STATS_HEAVY_QNAME 1
+/** heavy hitter category of the domains, the last two labels of the
+ * query name */
+#define UB_STATS_HEAVY_DOMAIN 2
+/** heavy hitter category of the upstream server addresses */
+#define UB_STATS_HEAVY_UPSTREAM 3
+/** number of heavy hitters per category in shared memory */
+#define UB_STATS_HEAVY_NUM 10
+
+/** a heavy hitter in shared memory */
+struct ub_shm_heavy_hitter {
+	/** the address or domain name, as text */
+	char name[256];
+	/** number of queries, can be too high by err */
+	long long count;
+	/** the count can be this much too high */
+	long long err;
+};
+
 /** 
  * Some global statistics that are not in struct stats_info,
  * this struct is shared on a shm segment (shm-key in unbound.conf)
@@ -624,7 +699,12 @@ struct ub_shm_stat_info {
 		long long respip;
 		long long dnscrypt_shared_secret;
 		long long dnscrypt_nonce;
+		long long hugepage;
 	} mem;
+
+	/** heavy hitters of all threads together, per category, with
+	 * the highest count first, unused entries have count 0 */
+	struct ub_shm_heavy_hitter heavy[UB_STATS_HEAVY_CAT_NUM][UB_STATS_HEAVY_NUM];
 };
 
 /** number of qtype that is stored for in array */
@@ -637,6 +717,12 @@ struct ub_shm_stat_info {
 #define UB_STATS_OPCODE_NUM 16
 /** number of histogram buckets */
 #define UB_STATS_BUCKET_NUM 40
+/** number of buckets in the log-linear latency histograms */
+#define UB_STATS_LAT_NUM 232
+/** number of modules in the module stack that latency is kept for */
+#define UB_STATS_MODULE_NUM 8
+/** number of module states, the module_ext_state values */
+#define UB_STATS_MODSTATE_NUM 7
 
 /** per worker statistics. */
 struct ub_server_stats {
@@ -747,6 +833,28 @@ struct ub_server_stats {
 	long long num_query_dnscrypt_replay;
 	/** number of dnscrypt nonces cache entries */
 	long long nonce_cache_count;
+	/** number of race queries sent upstream */
+	long long race_sent;
+	/** number of races where the race query answered first */
+	long long race_won;
+	/** number of upstream queries dropped, another answered first */
+	long long race_wasted;
+	/** number of dnstap messages dropped, the ring buffer was full */
+	long long dnstap_dropped;
+	/** number of fixed size objects, mesh states, replies and outbound
+	 * entries, that were reused from the alloc object cache */
+	long long alloc_obj_reused;
+	/** number of fixed size objects that had to be malloced */
+	long long alloc_obj_malloced;
+	/** number of fixed size objects freed, the object cache was full */
+	long long alloc_obj_freed;
+	/** number of regional chunks of query states reused from the
+	 * chunk cache of the alloc */
+	long long alloc_chunk_reused;
+	/** number of regional chunks that had to be malloced */
+	long long alloc_chunk_malloced;
+	/** number of regional chunks freed, the chunk cache was full */
+	long long alloc_chunk_freed;
 };
 
 /** 
@@ -774,6 +882,37 @@ struct ub_stats_info {
 	double mesh_time_median;
 };
 
+/**
+ * The large extended statistics of a thread, kept with
+ * extended-statistics.  They are not in struct ub_server_stats, so that
+ * its layout, and the size of struct ub_stats_info, do not depend on
+ * them.  In shm, if extended-statistics is enabled, (number+1) of these
+ * follow the array of struct ub_stats_info, with first as total.
+ */
+struct ub_stats_ext {
+	/** latency histograms, in microseconds, every power of two is
+	 * split in 8 buckets.
+	 * reply latency for answers from the cache */
+	long long lat_cache[UB_STATS_LAT_NUM];
+	/** reply latency for answers from local data, auth zones and
+	 * errors that are made without recursion */
+	long long lat_local[UB_STATS_LAT_NUM];
+	/** reply latency for answers after recursion */
+	long long lat_recursion[UB_STATS_LAT_NUM];
+	/** roundtrip time of the queries to upstream servers */
+	long long lat_upstream[UB_STATS_LAT_NUM];
+	/** time in the operate call, per module in the module stack */
+	long long lat_module[UB_STATS_MODULE_NUM][UB_STATS_LAT_NUM];
+	/** number of operate calls, per module and by the module state
+	 * that the call returned */
+	long long mod_calls[UB_STATS_MODULE_NUM][UB_STATS_MODSTATE_NUM];
+	/** time in microseconds in the operate calls, per module and state */
+	long long mod_usec[UB_STATS_MODULE_NUM][UB_STATS_MODSTATE_NUM];
+	/** bytes allocated in the query region by the operate calls, per
+	 * module and state */
+	long long mod_alloc[UB_STATS_MODULE_NUM][UB_STATS_MODSTATE_NUM];
+};
+
 #ifdef __cplusplus
 }
 #endif
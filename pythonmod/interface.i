@@ -275,9 +275,9 @@ struct packed_rrset_data {
   uint32_t ttl;
 
   /* number of rrs */
-  size_t count;
+  uint32_t count;
   /* number of rrsigs */
-  size_t rrsig_count;
+  uint32_t rrsig_count;
 
   enum rrset_trust trust;
   enum sec_status security;
@@ -21,6 +21,7 @@
 #include "util/regional.h"
 #include "util/data/msgreply.h"
 #include "util/storage/dnstree.h"
+#include "util/storage/addrlpm.h"
 #include "respip/respip.h"
 #include "services/view.h"
 #include "sldns/rrdef.h"
@@ -32,6 +33,7 @@
 struct respip_set {
 	struct regional* region;
 	struct rbtree_type ip_tree;
+	struct addr_lpm* lpm;	/* ip_tree compiled for lookups, or NULL */
 	char* const* tagname;	/* shallow copy of tag names, for logging */
 	int num_tags;		/* number of tagname entries */
 };
@@ -96,6 +98,7 @@ respip_set_delete(struct respip_set* set)
 {
 	if(!set)
 		return;
+	addr_lpm_delete(set->lpm);
 	regional_destroy(set->region);
 	free(set);
 }
@@ -359,6 +362,13 @@ respip_set_apply_cfg(struct respip_set* set, char* const* tagname, int num_tags,
 		pd = np;
 	}
 
+	/* compile the tree for the lookups, it does not change after this */
+	addr_tree_init_parents(&set->ip_tree);
+	addr_lpm_delete(set->lpm);
+	if(!(set->lpm = addr_lpm_create(&set->ip_tree))) {
+		log_err("out of memory");
+		return 0;
+	}
 	return 1;
 }
 
@@ -547,7 +557,7 @@ rdata2sockaddr(const struct packed_rrset_data* rd, uint16_t rtype, size_t i,
 }
 
 /**
- * Search the given 'iptree' for response address information that matches
+ * Search the given 'set' for response address information that matches
  * any of the IP addresses in an AAAA or A in the answer section of the
  * response (stored in 'rep').  If found, a pointer to the matched resp_addr
  * structure will be returned, and '*rrset_id' is set to the index in
@@ -556,7 +566,7 @@ rdata2sockaddr(const struct packed_rrset_data* rd, uint16_t rtype, size_t i,
  * chain or type-ANY response).
  */
 static const struct resp_addr*
-respip_addr_lookup(const struct reply_info *rep, struct rbtree_type* iptree,
+respip_addr_lookup(const struct reply_info *rep, struct respip_set* set,
 	size_t* rrset_id)
 {
 	size_t i;
@@ -575,8 +585,11 @@ respip_addr_lookup(const struct reply_info *rep, struct rbtree_type* iptree,
 		for(j = 0; j < rd->count; j++) {
 			if(!rdata2sockaddr(rd, rtype, j, &ss, &addrlen))
 				continue;
-			ra = (struct resp_addr*)addr_tree_lookup(iptree, &ss,
-				addrlen);
+			if(set->lpm)
+				ra = (struct resp_addr*)addr_lpm_lookup(
+					set->lpm, &ss, addrlen);
+			else	ra = (struct resp_addr*)addr_tree_lookup(
+					&set->ip_tree, &ss, addrlen);
 			if(ra) {
 				*rrset_id = i;
 				return ra;
@@ -854,7 +867,7 @@ respip_rewrite_reply(const struct query_info* qinfo,
 		lock_rw_rdlock(&view->lock);
 		if(view->respip_set) {
 			if((raddr = respip_addr_lookup(rep,
-				&view->respip_set->ip_tree, &rrset_id))) {
+				view->respip_set, &rrset_id))) {
 				/** for per-view respip directives the action
 				 * can only be direct (i.e. not tag-based) */
 				action = raddr->action;
@@ -863,7 +876,7 @@ respip_rewrite_reply(const struct query_info* qinfo,
 		if(!raddr && !view->isfirst)
 			goto done;
 	}
-	if(!raddr && ipset && (raddr = respip_addr_lookup(rep, &ipset->ip_tree,
+	if(!raddr && ipset && (raddr = respip_addr_lookup(rep, ipset,
 		&rrset_id))) {
 		action = (enum respip_action)local_data_find_tag_action(
 			raddr->taglist, raddr->taglen, ctaglist, ctaglen,
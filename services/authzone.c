@@ -409,6 +409,48 @@ auth_zone_create(struct auth_zones* az, uint8_t* nm, size_t nmlen,
 	return z;
 }
 
+/**
+ * Setup a shadow zone.  It is not in the zone tree and has no lock, new
+ * zone contents are built up in it while the zone itself keeps answering
+ * queries.  When done, the data is swapped into the zone.
+ * @param shadow: the shadow zone to initialise.
+ * @param nm: zone name, the shadow refers to it, it is not copied.
+ * @param nmlen: length of nm.
+ * @param dclass: class of the zone.
+ * @param zonefile: zonefile name for error printout, or NULL.
+ */
+static void
+auth_zone_shadow_init(struct auth_zone* shadow, uint8_t* nm, size_t nmlen,
+	uint16_t dclass, char* zonefile)
+{
+	memset(shadow, 0, sizeof(*shadow));
+	shadow->node.key = shadow;
+	shadow->name = nm;
+	shadow->namelen = nmlen;
+	shadow->namelabs = dname_count_labels(nm);
+	shadow->dclass = dclass;
+	shadow->zonefile = zonefile;
+	rbtree_init(&shadow->data, &auth_data_cmp);
+}
+
+/** swap the data of the shadow zone into z, caller holds z writelock.
+ * The shadow has the old data of z afterwards. */
+static void
+auth_zone_shadow_swap(struct auth_zone* z, struct auth_zone* shadow)
+{
+	rbtree_type old = z->data;
+	z->data = shadow->data;
+	shadow->data = old;
+}
+
+/** delete the data in the shadow zone */
+static void
+auth_zone_shadow_clear(struct auth_zone* shadow)
+{
+	traverse_postorder(&shadow->data, auth_data_del, NULL);
+	rbtree_init(&shadow->data, &auth_data_cmp);
+}
+
 struct auth_zone*
 auth_zone_find(struct auth_zones* az, uint8_t* nm, size_t nmlen,
 	uint16_t dclass)
@@ -1523,6 +1565,7 @@ auth_zone_read_zonefile(struct auth_zone* z)
 {
 	uint8_t rr[LDNS_RR_BUF_SIZE];
 	struct sldns_file_parse_state state;
+	struct auth_zone shadow;
 	FILE* in;
 	if(!z || !z->zonefile || z->zonefile[0]==0)
 		return 1; /* no file, or "", nothing to read */
@@ -1554,16 +1597,22 @@ auth_zone_read_zonefile(struct auth_zone* z)
 		memcpy(state.origin, z->name, z->namelen);
 		state.origin_len = z->namelen;
 	}
-	/* parse the (toplevel) file */
-	if(!az_parse_file(z, in, rr, sizeof(rr), &state)) {
+	/* parse the (toplevel) file into a shadow zone, so that on failure
+	 * the zone keeps its old contents */
+	auth_zone_shadow_init(&shadow, z->name, z->namelen, z->dclass,
+		z->zonefile);
+	if(!az_parse_file(&shadow, in, rr, sizeof(rr), &state)) {
 		char* n = sldns_wire2str_dname(z->name, z->namelen);
 		log_err("error parsing zonefile %s for %s",
 			z->zonefile, n?n:"error");
 		free(n);
 		fclose(in);
+		auth_zone_shadow_clear(&shadow);
 		return 0;
 	}
 	fclose(in);
+	auth_zone_shadow_swap(z, &shadow);
+	auth_zone_shadow_clear(&shadow);
 	return 1;
 }
 
@@ -1684,41 +1733,145 @@ int auth_zone_write_file(struct auth_zone* z, const char* fname)
 	return 1;
 }
 
-/** read all auth zones from file (if they have) */
+/** the zonefile load threads share this to pick the next zone to read */
+struct auth_zones_load {
+	/** lock on next and fail */
+	lock_basic_type lock;
+	/** the zones to read, array of num */
+	struct auth_zone** zones;
+	/** number of zones in the array */
+	size_t num;
+	/** index of the next zone to read */
+	size_t next;
+	/** set if a zone failed to load, the others stop */
+	int fail;
+};
+
+/** read zonefiles from the load list until it is done or fails */
+static void*
+auth_zones_load_thread(void* arg)
+{
+	struct auth_zones_load* ld = (struct auth_zones_load*)arg;
+	struct auth_zone* z;
+	while(1) {
+		lock_basic_lock(&ld->lock);
+		if(ld->fail || ld->next >= ld->num) {
+			lock_basic_unlock(&ld->lock);
+			break;
+		}
+		z = ld->zones[ld->next++];
+		lock_basic_unlock(&ld->lock);
+
+		lock_rw_wrlock(&z->lock);
+		if(!auth_zone_read_zonefile(z)) {
+			lock_rw_unlock(&z->lock);
+			lock_basic_lock(&ld->lock);
+			ld->fail = 1;
+			lock_basic_unlock(&ld->lock);
+			break;
+		}
+		lock_rw_unlock(&z->lock);
+	}
+	return NULL;
+}
+
+/** read all auth zones from file (if they have).  The zonefiles are read
+ * by up to num_threads threads, one zone per thread at a time.  A zonefile
+ * is not split over threads, the $ORIGIN, $TTL and $INCLUDE lines and
+ * the owner name of the previous RR make every line depend on the ones
+ * before it. */
 static int
-auth_zones_read_zones(struct auth_zones* az)
+auth_zones_read_zones(struct auth_zones* az, int num_threads)
 {
+	struct auth_zones_load ld;
 	struct auth_zone* z;
+	ub_thread_type* thr;
+	size_t i, nthr;
+	memset(&ld, 0, sizeof(ld));
 	lock_rw_wrlock(&az->lock);
 	RBTREE_FOR(z, struct auth_zone*, &az->ztree) {
-		lock_rw_wrlock(&z->lock);
-		if(!auth_zone_read_zonefile(z)) {
+		if(z->zonefile && z->zonefile[0]!=0)
+			ld.num++;
+	}
+#ifndef THREADS_DISABLED
+	nthr = (num_threads > 1)?(size_t)num_threads:1;
+	if(nthr > ld.num)
+		nthr = ld.num;
+#else
+	(void)num_threads;
+	nthr = 1;
+#endif
+	if(nthr <= 1) {
+		/* read them one after the other */
+		RBTREE_FOR(z, struct auth_zone*, &az->ztree) {
+			lock_rw_wrlock(&z->lock);
+			if(!auth_zone_read_zonefile(z)) {
+				lock_rw_unlock(&z->lock);
+				lock_rw_unlock(&az->lock);
+				return 0;
+			}
 			lock_rw_unlock(&z->lock);
-			lock_rw_unlock(&az->lock);
-			return 0;
 		}
-		lock_rw_unlock(&z->lock);
+		lock_rw_unlock(&az->lock);
+		return 1;
 	}
+
+	ld.zones = (struct auth_zone**)calloc(ld.num, sizeof(*ld.zones));
+	thr = (ub_thread_type*)calloc(nthr, sizeof(*thr));
+	if(!ld.zones || !thr) {
+		log_err("out of memory");
+		free(ld.zones);
+		free(thr);
+		lock_rw_unlock(&az->lock);
+		return 0;
+	}
+	i = 0;
+	RBTREE_FOR(z, struct auth_zone*, &az->ztree) {
+		if(z->zonefile && z->zonefile[0]!=0)
+			ld.zones[i++] = z;
+	}
+	lock_basic_init(&ld.lock);
+	lock_protect(&ld.lock, &ld.next, sizeof(ld.next));
+	lock_protect(&ld.lock, &ld.fail, sizeof(ld.fail));
+	verbose(VERB_ALGO, "read %d zonefiles with %d threads", (int)ld.num,
+		(int)nthr);
+	/* this thread reads zonefiles too */
+	for(i=1; i<nthr; i++)
+		ub_thread_create(&thr[i], auth_zones_load_thread, &ld);
+	(void)auth_zones_load_thread(&ld);
+	for(i=1; i<nthr; i++)
+		ub_thread_join(thr[i]);
+	lock_basic_destroy(&ld.lock);
+	free(ld.zones);
+	free(thr);
 	lock_rw_unlock(&az->lock);
-	return 1;
+	return !ld.fail;
 }
 
-/** Find auth_zone SOA and populate the values in xfr(soa values). */
-static int
-xfr_find_soa(struct auth_zone* z, struct auth_xfer* xfr)
+/** Find the auth_zone SOA rdata, return NULL if there is none, or if it
+ * is too short */
+static struct packed_rrset_data*
+az_find_soa_data(struct auth_zone* z)
 {
 	struct auth_data* apex;
 	struct auth_rrset* soa;
-	struct packed_rrset_data* d;
 	apex = az_find_name(z, z->name, z->namelen);
-	if(!apex) return 0;
+	if(!apex) return NULL;
 	soa = az_domain_rrset(apex, LDNS_RR_TYPE_SOA);
 	if(!soa || soa->data->count==0)
-		return 0; /* no RRset or no RRs in rrset */
-	if(soa->data->rr_len[0] < 2+4*5) return 0; /* SOA too short */
+		return NULL; /* no RRset or no RRs in rrset */
+	if(soa->data->rr_len[0] < 2+4*5) return NULL; /* SOA too short */
+	return soa->data;
+}
+
+/** Find auth_zone SOA and populate the values in xfr(soa values). */
+static int
+xfr_find_soa(struct auth_zone* z, struct auth_xfer* xfr)
+{
+	struct packed_rrset_data* d = az_find_soa_data(z);
+	if(!d) return 0;
 	/* SOA record ends with serial, refresh, retry, expiry, minimum,
 	 * as 4 byte fields */
-	d = soa->data;
 	xfr->have_zone = 1;
 	xfr->serial = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-20));
 	xfr->refresh = sldns_read_uint32(d->rr_data[0]+(d->rr_len[0]-16));
@@ -1854,7 +2007,7 @@ int auth_zones_apply_cfg(struct auth_zones* az, struct config_file* cfg,
 			return 0;
 		}
 	}
-	if(!auth_zones_read_zones(az))
+	if(!auth_zones_read_zones(az, cfg->num_threads))
 		return 0;
 	if(setup) {
 		if(!auth_zones_setup_zones(az))
@@ -4219,7 +4372,8 @@ apply_ixfr(struct auth_xfer* xfr, struct auth_zone* z,
 	return 1;
 }
 
-/** apply AXFR to zone in memory. z is locked. false on failure(mallocfail) */
+/** apply AXFR to zone in memory. z is a shadow zone with empty data.
+ * false on failure(mallocfail) */
 static int
 apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	struct sldns_buffer* scratch_buffer)
@@ -4230,16 +4384,11 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 	uint8_t* rr_dname, *rr_rdata;
 	uint16_t rr_type, rr_class, rr_rdlen;
 	uint32_t rr_ttl;
-	uint32_t serial = 0;
 	size_t rr_nextpos;
 	size_t rr_counter = 0;
 	int have_end_soa = 0;
 
-	/* clear the data tree */
-	traverse_postorder(&z->data, auth_data_del, NULL);
-	rbtree_init(&z->data, &auth_data_cmp);
-	xfr->have_zone = 0;
-	xfr->serial = 0;
+	log_assert(z->data.count == 0);
 
 	/* insert all RRs in to the zone */
 	/* insert the SOA only once, skip the last one */
@@ -4261,7 +4410,6 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 				break;
 			}
 			if(rr_rdlen < 22) return 0; /* bad SOA rdlen */
-			serial = sldns_read_uint32(rr_rdata+rr_rdlen-20);
 		}
 
 		/* add this RR */
@@ -4279,13 +4427,11 @@ apply_axfr(struct auth_xfer* xfr, struct auth_zone* z,
 		log_err("no end SOA record for AXFR");
 		return 0;
 	}
-
-	xfr->serial = serial;
-	xfr->have_zone = 1;
 	return 1;
 }
 
-/** apply HTTP to zone in memory. z is locked. false on failure(mallocfail) */
+/** apply HTTP to zone in memory. z is a shadow zone with empty data.
+ * false on failure(mallocfail) */
 static int
 apply_http(struct auth_xfer* xfr, struct auth_zone* z,
 	struct sldns_buffer* scratch_buffer)
@@ -4331,11 +4477,7 @@ apply_http(struct auth_xfer* xfr, struct auth_zone* z,
 		return 0;
 	}
 
-	/* clear the data tree */
-	traverse_postorder(&z->data, auth_data_del, NULL);
-	rbtree_init(&z->data, &auth_data_cmp);
-	xfr->have_zone = 0;
-	xfr->serial = 0;
+	log_assert(z->data.count == 0);
 
 	chunk = xfr->task_transfer->chunks_first;
 	chunk_pos = 0;
@@ -4418,6 +4560,41 @@ xfr_write_after_update(struct auth_xfer* xfr, struct module_env* env)
 	lock_rw_unlock(&z->lock);
 }
 
+/** build the zone contents from an AXFR or HTTP download in a shadow
+ * zone.  No zone lock is held, queries are answered from the old
+ * contents meanwhile.  caller holds xfr.lock.  The SOA values in xfr are
+ * not changed, that is done when the shadow is swapped in.
+ * return false if it did not work, and the shadow is empty */
+static int
+xfr_build_shadow(struct auth_xfer* xfr, struct module_env* env,
+	struct auth_zone* shadow)
+{
+	auth_zone_shadow_init(shadow, xfr->name, xfr->namelen, xfr->dclass,
+		NULL);
+	if(xfr->task_transfer->master->http) {
+		if(!apply_http(xfr, shadow, env->scratch_buffer)) {
+			auth_zone_shadow_clear(shadow);
+			verbose(VERB_ALGO, "http from %s: could not store data",
+				xfr->task_transfer->master->host);
+			return 0;
+		}
+	} else {
+		if(!apply_axfr(xfr, shadow, env->scratch_buffer)) {
+			auth_zone_shadow_clear(shadow);
+			verbose(VERB_ALGO, "xfr from %s: could not store AXFR"
+				" data", xfr->task_transfer->master->host);
+			return 0;
+		}
+	}
+	if(!az_find_soa_data(shadow)) {
+		auth_zone_shadow_clear(shadow);
+		verbose(VERB_ALGO, "xfr from %s: no SOA in zone after update"
+			" (or malformed RR)", xfr->task_transfer->master->host);
+		return 0;
+	}
+	return 1;
+}
+
 /** process chunk list and update zone in memory,
  * return false if it did not work */
 static int
@@ -4425,6 +4602,15 @@ xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 	int* ixfr_fail)
 {
 	struct auth_zone* z;
+	struct auth_zone shadow;
+	int full = xfr->task_transfer->master->http ||
+		!xfr->task_transfer->on_ixfr ||
+		xfr->task_transfer->on_ixfr_is_axfr;
+
+	/* a full zone is built beside the current contents, and then
+	 * swapped in, the zone lock is only held for the swap */
+	if(full && !xfr_build_shadow(xfr, env, &shadow))
+		return 0;
 
 	/* obtain locks and structures */
 	/* release xfr lock, then, while holding az->lock grab both
@@ -4437,6 +4623,8 @@ xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 		lock_rw_unlock(&env->auth_zones->lock);
 		/* the zone is gone, ignore xfr results */
 		lock_basic_lock(&xfr->lock);
+		if(full)
+			auth_zone_shadow_clear(&shadow);
 		return 0;
 	}
 	lock_rw_wrlock(&z->lock);
@@ -4444,15 +4632,12 @@ xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 	lock_rw_unlock(&env->auth_zones->lock);
 
 	/* apply data */
-	if(xfr->task_transfer->master->http) {
-		if(!apply_http(xfr, z, env->scratch_buffer)) {
-			lock_rw_unlock(&z->lock);
-			verbose(VERB_ALGO, "http from %s: could not store data",
-				xfr->task_transfer->master->host);
-			return 0;
-		}
-	} else if(xfr->task_transfer->on_ixfr &&
-		!xfr->task_transfer->on_ixfr_is_axfr) {
+	if(full) {
+		auth_zone_shadow_swap(z, &shadow);
+		/* the shadow was checked to have a SOA */
+		(void)xfr_find_soa(z, xfr);
+	} else {
+		/* IXFR changes the zone in place */
 		if(!apply_ixfr(xfr, z, env->scratch_buffer)) {
 			lock_rw_unlock(&z->lock);
 			verbose(VERB_ALGO, "xfr from %s: could not store IXFR"
@@ -4460,27 +4645,24 @@ xfr_process_chunk_list(struct auth_xfer* xfr, struct module_env* env,
 			*ixfr_fail = 1;
 			return 0;
 		}
-	} else {
-		if(!apply_axfr(xfr, z, env->scratch_buffer)) {
+		if(!xfr_find_soa(z, xfr)) {
 			lock_rw_unlock(&z->lock);
-			verbose(VERB_ALGO, "xfr from %s: could not store AXFR"
-				" data", xfr->task_transfer->master->host);
+			verbose(VERB_ALGO, "xfr from %s: no SOA in zone after "
+				"update (or malformed RR)",
+				xfr->task_transfer->master->host);
 			return 0;
 		}
 	}
 	xfr->zone_expired = 0;
 	z->zone_expired = 0;
-	if(!xfr_find_soa(z, xfr)) {
-		lock_rw_unlock(&z->lock);
-		verbose(VERB_ALGO, "xfr from %s: no SOA in zone after update"
-			" (or malformed RR)", xfr->task_transfer->master->host);
-		return 0;
-	}
 	if(xfr->have_zone)
 		xfr->lease_time = *env->now;
 
 	/* unlock */
 	lock_rw_unlock(&z->lock);
+	/* the old contents are deleted without holding the zone lock */
+	if(full)
+		auth_zone_shadow_clear(&shadow);
 
 	if(verbosity >= VERB_QUERY && xfr->have_zone) {
 		char zname[256];
@@ -45,6 +45,7 @@
 #include "services/cache/dns.h"
 #include "services/cache/rrset.h"
 #include "util/data/msgreply.h"
+#include "util/data/msgencode.h"
 #include "util/data/packed_rrset.h"
 #include "util/data/dname.h"
 #include "util/module.h"
@@ -53,6 +54,24 @@
 #include "util/config_file.h"
 #include "sldns/sbuffer.h"
 
+/** copy the superior rrset from the cache into the region reply */
+static void
+use_cached_rrset(struct ub_packed_rrset_key* key, struct reply_info* qrep,
+	size_t i, struct regional* region, time_t now)
+{
+	struct ub_packed_rrset_key* ck;
+	lock_rw_rdlock(&key->entry.lock);
+	/* if deleted rrset, do not copy it */
+	if(key->id == 0)
+		ck = NULL;
+	else 	ck = packed_rrset_copy_region(key, region, now);
+	lock_rw_unlock(&key->entry.lock);
+	if(ck) {
+		/* use cached copy if memory allows */
+		qrep->rrsets[i] = ck;
+	}
+}
+
 /** store rrsets in the rrset cache. 
  * @param env: module environment with caches.
  * @param rep: contains list of rrsets to store.
@@ -84,20 +103,9 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
 		case 0: /* ref unchanged, item inserted */
 			break;
 		case 2: /* ref updated, cache is superior */
-			if(region) {
-				struct ub_packed_rrset_key* ck;
-				lock_rw_rdlock(&rep->ref[i].key->entry.lock);
-				/* if deleted rrset, do not copy it */
-				if(rep->ref[i].key->id == 0)
-					ck = NULL;
-				else 	ck = packed_rrset_copy_region(
-					rep->ref[i].key, region, now);
-				lock_rw_unlock(&rep->ref[i].key->entry.lock);
-				if(ck) {
-					/* use cached copy if memory allows */
-					qrep->rrsets[i] = ck;
-				}
-			}
+			if(region)
+				use_cached_rrset(rep->ref[i].key, qrep, i,
+					region, now);
 			/* no break: also copy key item */
 			/* the line below is matched by gcc regex and silences
 			 * the fallthrough warning */
@@ -108,6 +116,47 @@ store_rrsets(struct module_env* env, struct reply_info* rep, time_t now,
         }
 }
 
+/**
+ * Store rrsets from the reply in the rrset cache, without copying them
+ * first; only the rrsets that are inserted in the cache are copied.
+ * @param env: module environment with the caches.
+ * @param rep: malloced reply that gets the references to the cached
+ *	rrsets, its rrsets point to the rrsets in qrep.
+ * @param now: current time.
+ * @param leeway: during prefetch how much leeway to update TTLs.
+ * @param pside: if from parentside discovered NS.
+ * @param qrep: the reply with region allocated rrsets, with relative
+ *	TTLs. Updated with the cached rrset if the cache is better.
+ * @param region: for qrep allocs.
+ * @return false on alloc failure.
+ */
+static int
+store_rrsets_copy(struct module_env* env, struct reply_info* rep,
+	time_t now, time_t leeway, int pside, struct reply_info* qrep,
+	struct regional* region)
+{
+	size_t i;
+	for(i=0; i<rep->rrset_count; i++) {
+		rep->ref[i].key = qrep->rrsets[i];
+		rep->ref[i].id = 0;
+		switch(rrset_cache_update_copy(env->rrset_cache, &rep->ref[i],
+			env->alloc, now, now + ((ntohs(rep->ref[i].key->rk.type)
+			==LDNS_RR_TYPE_NS && !pside)?0:leeway))) {
+		case -1:
+			return 0;
+		case 2: /* cache is superior, and rdata equal */
+			if(region)
+				use_cached_rrset(rep->ref[i].key, qrep, i,
+					region, now);
+			break;
+		default:
+			break;
+		}
+		rep->rrsets[i] = rep->ref[i].key;
+	}
+	return 1;
+}
+
 /** delete message from message cache */
 static void
 msg_cache_remove(struct module_env* env, uint8_t* qname, size_t qnamelen, 
@@ -150,25 +199,21 @@ msg_del_servfail(struct module_env* env, struct query_info* qinfo,
 		qinfo->qclass, flags);
 }
 
-void 
-dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
-	hashvalue_type hash, struct reply_info* rep, time_t leeway, int pside,
-	struct reply_info* qrep, uint32_t flags, struct regional* region)
+/**
+ * Store the message in the msg cache, its rrsets have been stored.
+ * @param env: module environment with the caches.
+ * @param qinfo: query info, the qname is taken over when stored.
+ * @param hash: hash of the query info.
+ * @param rep: malloced reply, with absolute TTLs. Taken over or freed.
+ * @param ttl: the relative TTL of the reply.
+ * @param flags: DNSCACHE_STORE flags.
+ */
+static void
+store_msg_entry(struct module_env* env, struct query_info* qinfo,
+	hashvalue_type hash, struct reply_info* rep, time_t ttl,
+	uint32_t flags)
 {
 	struct msgreply_entry* e;
-	time_t ttl = rep->ttl;
-	size_t i;
-
-	/* store RRsets */
-        for(i=0; i<rep->rrset_count; i++) {
-		rep->ref[i].key = rep->rrsets[i];
-		rep->ref[i].id = rep->rrsets[i]->id;
-	}
-
-	/* there was a reply_info_sortref(rep) here but it seems to be
-	 * unnecessary, because the cache gets locked per rrset. */
-	reply_info_set_ttls(rep, *env->now);
-	store_rrsets(env, rep, *env->now, leeway, pside, qrep, region);
 	if(ttl == 0 && !(flags & DNSCACHE_STORE_ZEROTTL)) {
 		/* we do not store the message, but we did store the RRs,
 		 * which could be useful for delegation information */
@@ -185,13 +230,41 @@ dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
 
 	/* store msg in the cache */
 	reply_info_sortref(rep);
+	if(env->cfg->msg_cache_wireformat && env->scratch &&
+		rrset_array_lock(rep->ref, rep->rrset_count, *env->now)) {
+		/* precompute the wireformat, for faster replies */
+		rep->wire = reply_wire_create(qinfo, rep, env->scratch);
+		rrset_array_unlock(rep->ref, rep->rrset_count);
+	}
 	if(!(e = query_info_entrysetup(qinfo, rep, hash))) {
 		log_err("store_msg: malloc failed");
+		reply_info_delete(rep, NULL);
 		return;
 	}
 	slabhash_insert(env->msg_cache, hash, &e->entry, rep, env->alloc);
 }
 
+void 
+dns_cache_store_msg(struct module_env* env, struct query_info* qinfo,
+	hashvalue_type hash, struct reply_info* rep, time_t leeway, int pside,
+	struct reply_info* qrep, uint32_t flags, struct regional* region)
+{
+	time_t ttl = rep->ttl;
+	size_t i;
+
+	/* store RRsets */
+        for(i=0; i<rep->rrset_count; i++) {
+		rep->ref[i].key = rep->rrsets[i];
+		rep->ref[i].id = rep->rrsets[i]->id;
+	}
+
+	/* there was a reply_info_sortref(rep) here but it seems to be
+	 * unnecessary, because the cache gets locked per rrset. */
+	reply_info_set_ttls(rep, *env->now);
+	store_rrsets(env, rep, *env->now, leeway, pside, qrep, region);
+	store_msg_entry(env, qinfo, hash, rep, ttl, flags);
+}
+
 /** find closest NS or DNAME and returns the rrset (locked) */
 static struct ub_packed_rrset_key*
 find_closest_of_type(struct module_env* env, uint8_t* qname, size_t qnamelen, 
@@ -520,6 +593,7 @@ gen_dns_msg(struct regional* region, struct query_info* q, size_t num)
 		sizeof(struct reply_info) - sizeof(struct rrset_ref));
 	if(!msg->rep)
 		return NULL;
+	msg->rep->wire = NULL;
 	if(num > RR_COUNT_MAX)
 		return NULL; /* integer overflow protection */
 	msg->rep->rrsets = (struct ub_packed_rrset_key**)
@@ -924,41 +998,53 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 	struct regional* region, uint32_t flags)
 {
 	struct reply_info* rep = NULL;
-	/* alloc, malloc properly (not in region, like msg is) */
-	rep = reply_info_copy(msgrep, env->alloc, NULL);
-	if(!rep)
-		return 0;
 	/* ttl must be relative ;i.e. 0..86400 not  time(0)+86400.
 	 * the env->now is added to message and RRsets in this routine. */
 	/* the leeway is used to invalidate other rrsets earlier */
 
 	if(is_referral) {
-		/* store rrsets */
+		/* store rrsets, they are copied with malloc (not in
+		 * region, like msg is) when inserted in the cache */
 		struct rrset_ref ref;
 		size_t i;
-		for(i=0; i<rep->rrset_count; i++) {
-			packed_rrset_ttl_add((struct packed_rrset_data*)
-				rep->rrsets[i]->entry.data, *env->now);
-			ref.key = rep->rrsets[i];
-			ref.id = rep->rrsets[i]->id;
-			/*ignore ret: it was in the cache, ref updated */
+		for(i=0; i<msgrep->rrset_count; i++) {
+			ref.key = msgrep->rrsets[i];
+			ref.id = 0;
+			/* ignore ret, other than alloc failure */
 			/* no leeway for typeNS */
-			(void)rrset_cache_update(env->rrset_cache, &ref, 
-				env->alloc, *env->now + 
+			if(rrset_cache_update_copy(env->rrset_cache, &ref,
+				env->alloc, *env->now, *env->now +
 				((ntohs(ref.key->rk.type)==LDNS_RR_TYPE_NS
-				 && !pside) ? 0:leeway));
+				 && !pside) ? 0:leeway)) == -1)
+				return 0;
 		}
-		free(rep);
 		return 1;
 	} else {
 		/* store msg, and rrsets */
 		struct query_info qinf;
 		hashvalue_type h;
+		time_t ttl = msgrep->ttl;
 
+		/* the reply is malloced, its rrsets are set to the
+		 * cached rrsets by store_rrsets_copy */
+		rep = construct_reply_info_base(NULL, msgrep->flags,
+			msgrep->qdcount, msgrep->ttl, msgrep->prefetch_ttl,
+			msgrep->an_numrrsets, msgrep->ns_numrrsets,
+			msgrep->ar_numrrsets, msgrep->rrset_count,
+			msgrep->security);
+		if(!rep)
+			return 0;
+		rep->ttl += *env->now;
+		rep->prefetch_ttl += *env->now;
+		if(!store_rrsets_copy(env, rep, *env->now, leeway, pside,
+			msgrep, region)) {
+			free(rep);
+			return 0;
+		}
 		qinf = *msgqinf;
 		qinf.qname = memdup(msgqinf->qname, msgqinf->qname_len);
 		if(!qinf.qname) {
-			reply_info_parsedelete(rep, env->alloc);
+			free(rep);
 			return 0;
 		}
 		/* fixup flags to be sensible for a reply based on the cache */
@@ -967,8 +1053,7 @@ dns_cache_store(struct module_env* env, struct query_info* msgqinf,
 		rep->flags |= (BIT_RA | BIT_QR);
 		rep->flags &= ~(BIT_AA | BIT_CD);
 		h = query_info_hash(&qinf, (uint16_t)flags);
-		dns_cache_store_msg(env, &qinf, h, rep, leeway, pside, msgrep,
-			flags, region);
+		store_msg_entry(env, &qinf, h, rep, ttl, flags);
 		/* qname is used inside query_info_entrysetup, and set to 
 		 * NULL. If it has not been used, free it. free(0) is safe. */
 		free(qinf.qname);
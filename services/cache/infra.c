@@ -43,6 +43,7 @@
 #include "sldns/str2wire.h"
 #include "services/cache/infra.h"
 #include "util/storage/slabhash.h"
+#include "util/storage/ratesketch.h"
 #include "util/storage/lookup3.h"
 #include "util/data/dname.h"
 #include "util/log.h"
@@ -249,6 +250,15 @@ infra_create(struct config_file* cfg)
 		name_tree_init_parents(&infra->domain_limits);
 	}
 	infra_ip_ratelimit = cfg->ip_ratelimit;
+	if(cfg->ip_ratelimit_sketch) {
+		infra->client_ip_sketch = rate_sketch_create(
+			cfg->ip_ratelimit_slabs, cfg->ip_ratelimit_size);
+		if(!infra->client_ip_sketch) {
+			infra_delete(infra);
+			return NULL;
+		}
+		return infra;
+	}
 	infra->client_ip_rates = slabhash_create(cfg->ip_ratelimit_slabs,
 	    INFRA_HOST_STARTSIZE, cfg->ip_ratelimit_size, &ip_rate_sizefunc,
 	    &ip_rate_compfunc, &ip_rate_delkeyfunc, &ip_rate_deldatafunc, NULL);
@@ -277,6 +287,7 @@ infra_delete(struct infra_cache* infra)
 	slabhash_delete(infra->domain_rates);
 	traverse_postorder(&infra->domain_limits, domain_limit_free, NULL);
 	slabhash_delete(infra->client_ip_rates);
+	rate_sketch_delete(infra->client_ip_sketch);
 	free(infra);
 }
 
@@ -290,7 +301,8 @@ infra_adjust(struct infra_cache* infra, struct config_file* cfg)
 	maxmem = cfg->infra_cache_numhosts * (sizeof(struct infra_key)+
 		sizeof(struct infra_data)+INFRA_BYTES_NAME);
 	if(maxmem != slabhash_get_size(infra->hosts) ||
-		cfg->infra_cache_slabs != infra->hosts->size) {
+		cfg->infra_cache_slabs != infra->hosts->size ||
+		cfg->ip_ratelimit_sketch != (infra->client_ip_sketch != NULL)) {
 		infra_delete(infra);
 		infra = infra_create(cfg);
 	}
@@ -962,6 +974,8 @@ infra_get_mem(struct infra_cache* infra)
 	size_t s = sizeof(*infra) + slabhash_get_mem(infra->hosts);
 	if(infra->domain_rates) s += slabhash_get_mem(infra->domain_rates);
 	if(infra->client_ip_rates) s += slabhash_get_mem(infra->client_ip_rates);
+	if(infra->client_ip_sketch)
+		s += rate_sketch_get_mem(infra->client_ip_sketch);
 	/* ignore domain_limits because walk through tree is big */
 	return s;
 }
@@ -976,6 +990,21 @@ int infra_ip_ratelimit_inc(struct infra_cache* infra,
 	if(!infra_ip_ratelimit) {
 		return 1;
 	}
+	if(infra->client_ip_sketch) {
+		/* count in the sketch, no entries to create or evict */
+		int premax;
+		max = rate_sketch_inc(infra->client_ip_sketch,
+			hash_addr(&repinfo->addr, repinfo->addrlen, 0),
+			timenow, &premax);
+		if(premax < infra_ip_ratelimit && max >= infra_ip_ratelimit) {
+			char client_ip[128];
+			addr_to_str((struct sockaddr_storage *)&repinfo->addr,
+				repinfo->addrlen, client_ip, sizeof(client_ip));
+			verbose(VERB_OPS, "ratelimit exceeded %s %d", client_ip,
+				infra_ip_ratelimit);
+		}
+		return (max <= infra_ip_ratelimit);
+	}
 	/* find or insert ratedata */
 	entry = infra_find_ip_ratedata(infra, repinfo, 1);
 	if(entry) {
@@ -50,6 +50,7 @@
 #include "util/netevent.h"
 #include "util/data/msgreply.h"
 struct slabhash;
+struct rate_sketch;
 struct config_file;
 
 /**
@@ -118,8 +119,12 @@ struct infra_cache {
 	struct slabhash* domain_rates;
 	/** ratelimit settings for domains, struct domain_limit_data */
 	rbtree_type domain_limits;
-	/** hash table with query rates per client ip: ip_rate_key, ip_rate_data */
+	/** hash table with query rates per client ip: ip_rate_key, ip_rate_data,
+	 * NULL if client_ip_sketch is used */
 	struct slabhash* client_ip_rates;
+	/** count-min sketch with query rates per client ip, NULL if not
+	 * configured */
+	struct rate_sketch* client_ip_sketch;
 };
 
 /** ratelimit, unless overridden by domain_limits, 0 is off */
@@ -238,6 +238,38 @@ rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref,
 	return 0;
 }
 
+int
+rrset_cache_update_copy(struct rrset_cache* r, struct rrset_ref* ref,
+	struct alloc_cache* alloc, time_t now, time_t timenow)
+{
+	struct lruhash_entry* e;
+	struct ub_packed_rrset_key* k = ref->key;
+	log_assert(k->rk.dname != NULL);
+	/* check the cache before making a copy; the superior cached
+	 * rrset is kept, so that copy would be deleted again */
+	if((e=slabhash_lookup(&r->table, k->entry.hash, k, 0)) != 0) {
+		int equal = rrsetdata_equal((struct packed_rrset_data*)k->
+			entry.data, (struct packed_rrset_data*)e->data);
+		/* pass ns=0, the passed rrset must not be changed; for type
+		 * NS the outcome is the same, rrset_cache_update adjusts
+		 * the TTL of the copy */
+		if(!need_to_update_rrset(k->entry.data, e->data, timenow,
+			equal, 0)) {
+			ref->key = (struct ub_packed_rrset_key*)e->key;
+			ref->id = ref->key->id;
+			lock_rw_unlock(&e->lock);
+			if(equal) return 2;
+			return 3;
+		}
+		lock_rw_unlock(&e->lock);
+	}
+	if(!(k = packed_rrset_copy_alloc(k, alloc, now)))
+		return -1;
+	ref->key = k;
+	ref->id = k->id;
+	return rrset_cache_update(r, ref, alloc, timenow);
+}
+
 void rrset_cache_update_wildcard(struct rrset_cache* rrset_cache, 
 	struct ub_packed_rrset_key* rrset, uint8_t* ce, size_t ce_len,
 	struct alloc_cache* alloc, time_t timenow)
@@ -255,10 +287,13 @@ void rrset_cache_update_wildcard(struct rrset_cache* rrset_cache,
 	wc_dname[1] = (uint8_t)'*';
 	memmove(wc_dname+2, ce, ce_len);
 
+	alloc_data_release(alloc, rrset->rk.dname, rrset->rk.dname_len);
 	rrset->rk.dname_len = ce_len + 2;
-	rrset->rk.dname = (uint8_t*)memdup(wc_dname, rrset->rk.dname_len);
+	rrset->rk.dname = (uint8_t*)alloc_data_dup(alloc, wc_dname,
+		rrset->rk.dname_len);
 	if(!rrset->rk.dname) {
 		log_err("memdup failure in rrset_cache_update_wildcard");
+		ub_packed_rrset_parsedelete(rrset, alloc);
 		return;
 	}
 
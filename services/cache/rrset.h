@@ -133,6 +133,31 @@ void rrset_cache_touch(struct rrset_cache* r, struct ub_packed_rrset_key* key,
 int rrset_cache_update(struct rrset_cache* r, struct rrset_ref* ref, 
 	struct alloc_cache* alloc, time_t timenow);
 
+/**
+ * Update an rrset in the rrset cache from an rrset that is not allocated
+ * for the cache, like the region allocated rrsets from a parsed reply.
+ * The cache is checked first; if the item in the cache is superior the
+ * passed rrset is not copied at all. Otherwise a malloced copy is made
+ * and passed to rrset_cache_update.
+ *
+ * @param r: the rrset cache.
+ * @param ref: reference to the rrset. Pass with key set to the rrset,
+ *	with relative TTLs, that is left untouched.
+ *	On return the key and id are that of the rrset in the cache
+ *	(the copy or the cached rrset).
+ * @param alloc: how to allocate (and deallocate) the special rrset key.
+ * @param now: added to the TTLs of the copy, to make them absolute.
+ * @param timenow: current time (to see if ttl in cache is expired).
+ * @return -1 on alloc failure, or:
+ * 	0: rrset copied, and inserted in cache.
+ * 	1: rrset copied, ref updated, item is inserted in cache.
+ * 	2: not copied, ref updated, item in cache is superior and the
+ *	   rdata is equal.
+ * 	3: not copied, ref updated, item in cache is superior.
+ */
+int rrset_cache_update_copy(struct rrset_cache* r, struct rrset_ref* ref,
+	struct alloc_cache* alloc, time_t now, time_t timenow);
+
 /**
  * Update or add an rrset in the rrset cache using a wildcard dname.
  * Generates wildcard dname by prepending the wildcard label to the closest
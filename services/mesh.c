@@ -43,6 +43,7 @@
  * send back to clients.
  */
 #include "config.h"
+#include <sys/time.h>
 #include "services/mesh.h"
 #include "services/outbound_list.h"
 #include "services/cache/dns.h"
@@ -52,9 +53,11 @@
 #include "util/regional.h"
 #include "util/data/msgencode.h"
 #include "util/timehist.h"
+#include "util/locks.h"
 #include "util/fptr_wlist.h"
 #include "util/alloc.h"
 #include "util/config_file.h"
+#include "util/storage/lookup3.h"
 #include "sldns/sbuffer.h"
 #include "sldns/wire2str.h"
 #include "services/localzone.h"
@@ -223,6 +226,119 @@ mesh_state_ref_compare(const void* ap, const void* bp)
 	return mesh_state_compare(a->s, b->s);
 }
 
+/** hash the mesh state key, the parts of mesh_state_compare except
+ * the unique pointer and client info, those are resolved by the compare */
+static hashvalue_type
+mesh_state_hash(struct module_qstate* s)
+{
+	uint16_t bits = (s->query_flags&(BIT_RD|BIT_CD)) |
+		(s->is_priming?0x1:0) | (s->is_valrec?0x2:0);
+	hashvalue_type h = query_info_hash(&s->qinfo, s->query_flags);
+	return hashlittle(&bits, sizeof(bits), h);
+}
+
+/** double the size of the mesh all table, returns false on alloc failure,
+ * the table is then left as it was, with longer bucket lists */
+static int
+mesh_all_grow(struct mesh_area* mesh)
+{
+	size_t i, newsize = mesh->all_size*2;
+	struct mesh_state** newtab = (struct mesh_state**)calloc(newsize,
+		sizeof(struct mesh_state*));
+	if(!newtab)
+		return 0;
+	for(i=0; i<mesh->all_size; i++) {
+		struct mesh_state* m = mesh->all[i], *nx;
+		while(m) {
+			nx = m->hnext;
+			m->hnext = newtab[m->hash&(newsize-1)];
+			newtab[m->hash&(newsize-1)] = m;
+			m = nx;
+		}
+	}
+	free(mesh->all);
+	mesh->all = newtab;
+	mesh->all_size = newsize;
+	return 1;
+}
+
+void
+mesh_all_insert(struct mesh_area* mesh, struct mesh_state* m)
+{
+#ifdef UNBOUND_DEBUG
+	struct mesh_state* p;
+#endif
+	m->hash = mesh_state_hash(&m->s);
+#ifdef UNBOUND_DEBUG
+	for(p = mesh->all[m->hash&(mesh->all_size-1)]; p; p = p->hnext) {
+		log_assert(p->hash != m->hash || mesh_state_compare(p, m) != 0);
+	}
+#endif
+	if(mesh->all_count >= mesh->all_size)
+		(void)mesh_all_grow(mesh);
+	m->hnext = mesh->all[m->hash&(mesh->all_size-1)];
+	mesh->all[m->hash&(mesh->all_size-1)] = m;
+	stat_inc(mesh->all_count);
+}
+
+/** remove mesh state from the all table */
+static void
+mesh_all_remove(struct mesh_area* mesh, struct mesh_state* m)
+{
+	struct mesh_state** pp = &mesh->all[m->hash&(mesh->all_size-1)];
+	while(*pp) {
+		if(*pp == m) {
+			*pp = m->hnext;
+			m->hnext = NULL;
+			stat_dec(mesh->all_count);
+			return;
+		}
+		pp = &(*pp)->hnext;
+	}
+}
+
+/** qsort compare routine for mesh state pointers */
+static int
+mesh_state_ptr_compare(const void* ap, const void* bp)
+{
+	return mesh_state_compare(*(struct mesh_state* const*)ap,
+		*(struct mesh_state* const*)bp);
+}
+
+struct mesh_state**
+mesh_list_sorted(struct mesh_area* mesh, size_t* num)
+{
+	struct mesh_state** list, *m;
+	size_t i, n = 0;
+	*num = 0;
+	if(mesh->all_count == 0)
+		return NULL;
+	list = (struct mesh_state**)malloc(sizeof(struct mesh_state*)*
+		mesh->all_count);
+	if(!list)
+		return NULL;
+	for(i=0; i<mesh->all_size; i++)
+		for(m = mesh->all[i]; m; m = m->hnext)
+			list[n++] = m;
+	log_assert(n == mesh->all_count);
+	qsort(list, n, sizeof(*list), &mesh_state_ptr_compare);
+	*num = n;
+	return list;
+}
+
+/** lookup mesh state in the all table */
+static struct mesh_state*
+mesh_all_lookup(struct mesh_area* mesh, struct mesh_state* key)
+{
+	struct mesh_state* p;
+	key->hash = mesh_state_hash(&key->s);
+	for(p = mesh->all[key->hash&(mesh->all_size-1)]; p; p = p->hnext) {
+		if(p->hash == key->hash && mesh_state_compare(p, key) == 0)
+			return p;
+	}
+	return NULL;
+}
+
 struct mesh_area* 
 mesh_create(struct module_stack* stack, struct module_env* env)
 {
@@ -232,8 +348,20 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 		return NULL;
 	}
 	mesh->histogram = timehist_setup();
+	mesh->lat_recursion = (long long*)calloc((1+MAX_MODULE)*
+		NUM_BUCKETS_LATHIST, sizeof(long long));
+	if(mesh->lat_recursion)
+		mesh->lat_module = mesh->lat_recursion + NUM_BUCKETS_LATHIST;
 	mesh->qbuf_bak = sldns_buffer_new(env->cfg->msg_buffer_size);
-	if(!mesh->histogram || !mesh->qbuf_bak) {
+	mesh->all_size = MESH_ALL_START_SIZE;
+	mesh->all = (struct mesh_state**)calloc(mesh->all_size,
+		sizeof(struct mesh_state*));
+	if(!mesh->histogram || !mesh->lat_recursion || !mesh->qbuf_bak ||
+		!mesh->all) {
+		timehist_delete(mesh->histogram);
+		free(mesh->lat_recursion);
+		sldns_buffer_free(mesh->qbuf_bak);
+		free(mesh->all);
 		free(mesh);
 		log_err("mesh area alloc: out of memory");
 		return NULL;
@@ -241,7 +369,7 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 	mesh->mods = *stack;
 	mesh->env = env;
 	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	mesh->all_count = 0;
 	mesh->num_reply_addrs = 0;
 	mesh->num_reply_states = 0;
 	mesh->num_detached_states = 0;
@@ -260,15 +388,16 @@ mesh_create(struct module_stack* stack, struct module_env* env)
 
 /** help mesh delete delete mesh states */
 static void
-mesh_delete_helper(rbnode_type* n)
+mesh_delete_helper(struct mesh_area* mesh)
 {
-	struct mesh_state* mstate = (struct mesh_state*)n->key;
-	/* perform a full delete, not only 'cleanup' routine,
-	 * because other callbacks expect a clean state in the mesh.
-	 * For 're-entrant' calls */
-	mesh_state_delete(&mstate->s);
-	/* but because these delete the items from the tree, postorder
-	 * traversal and rbtree rebalancing do not work together */
+	size_t i;
+	for(i=0; i<mesh->all_size; i++) {
+		/* perform a full delete, not only 'cleanup' routine,
+		 * because other callbacks expect a clean state in the mesh.
+		 * For 're-entrant' calls. This removes it from the bucket */
+		while(mesh->all[i])
+			mesh_state_delete(&mesh->all[i]->s);
+	}
 }
 
 void 
@@ -277,10 +406,11 @@ mesh_delete(struct mesh_area* mesh)
 	if(!mesh)
 		return;
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
+	mesh_delete_helper(mesh);
 	timehist_delete(mesh->histogram);
+	free(mesh->lat_recursion);
 	sldns_buffer_free(mesh->qbuf_bak);
+	free(mesh->all);
 	free(mesh);
 }
 
@@ -288,14 +418,13 @@ void
 mesh_delete_all(struct mesh_area* mesh)
 {
 	/* free all query states */
-	while(mesh->all.count)
-		mesh_delete_helper(mesh->all.root);
-	mesh->stats_dropped += mesh->num_reply_addrs;
+	mesh_delete_helper(mesh);
+	stat_add(mesh->stats_dropped, mesh->num_reply_addrs);
 	/* clear mesh area references */
 	rbtree_init(&mesh->run, &mesh_state_compare);
-	rbtree_init(&mesh->all, &mesh_state_compare);
+	stat_set(mesh->all_count, 0);
 	mesh->num_reply_addrs = 0;
-	mesh->num_reply_states = 0;
+	stat_set(mesh->num_reply_states, 0);
 	mesh->num_detached_states = 0;
 	mesh->num_forever_states = 0;
 	mesh->forever_first = NULL;
@@ -331,7 +460,7 @@ int mesh_make_new_space(struct mesh_area* mesh, sldns_buffer* qbuf)
 				m->s.return_rcode = LDNS_RCODE_SERVFAIL;
 				mesh_walk_supers(mesh, m);
 			}
-			mesh->stats_jostled ++;
+			stat_inc(mesh->stats_jostled);
 			mesh_state_delete(&m->s);
 			/* restore the query - note that the qinfo ptr to
 			 * the querybuffer is then correct again. */
@@ -360,7 +489,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			verbose(VERB_ALGO, "Too many queries. dropping "
 				"incoming query.");
 			comm_point_drop_reply(rep);
-			mesh->stats_dropped ++;
+			stat_inc(mesh->stats_dropped);
 			return;
 		}
 		/* for this new reply state, the reply address is free,
@@ -370,16 +499,13 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 		if(mesh->num_reply_addrs > mesh->max_reply_states*16) {
 			verbose(VERB_ALGO, "Too many requests queued. "
 				"dropping incoming query.");
-			mesh->stats_dropped++;
+			stat_inc(mesh->stats_dropped);
 			comm_point_drop_reply(rep);
 			return;
 		}
 	}
 	/* see if it already exists, if not, create one */
 	if(!s) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		s = mesh_state_create(mesh->env, qinfo, cinfo,
 			qflags&(BIT_RD|BIT_CD), 0, 0);
 		if(!s) {
@@ -410,13 +536,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 			}
 		}
 
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &s->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, s);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		added = 1;
@@ -444,7 +564,7 @@ void mesh_new_client(struct mesh_area* mesh, struct query_info* qinfo,
 		mesh->num_detached_states--;
 	}
 	if(was_noreply) {
-		mesh->num_reply_states ++;
+		stat_inc(mesh->num_reply_states);
 	}
 	mesh->num_reply_addrs++;
 	if(s->list_select == mesh_no_list) {
@@ -481,9 +601,6 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 
 	/* see if it already exists, if not, create one */
 	if(!s) {
-#ifdef UNBOUND_DEBUG
-		struct rbnode_type* n;
-#endif
 		s = mesh_state_create(mesh->env, qinfo, NULL,
 			qflags&(BIT_RD|BIT_CD), 0, 0);
 		if(!s) {
@@ -498,13 +615,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 				return 0;
 			}
 		}
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &s->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, s);
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		added = 1;
@@ -525,7 +636,7 @@ mesh_new_callback(struct mesh_area* mesh, struct query_info* qinfo,
 		mesh->num_detached_states--;
 	}
 	if(was_noreply) {
-		mesh->num_reply_states ++;
+		stat_inc(mesh->num_reply_states);
 	}
 	mesh->num_reply_addrs++;
 	if(added)
@@ -567,7 +678,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 	}
 	if(!mesh_make_new_space(mesh, NULL)) {
 		verbose(VERB_ALGO, "Too many queries. dropped prefetch.");
-		mesh->stats_dropped ++;
+		stat_inc(mesh->stats_dropped);
 		return;
 	}
 
@@ -577,13 +688,7 @@ static void mesh_schedule_prefetch(struct mesh_area* mesh,
 		log_err("prefetch mesh_state_create: out of memory");
 		return;
 	}
-#ifdef UNBOUND_DEBUG
-	n =
-#else
-	(void)
-#endif
-	rbtree_insert(&mesh->all, &s->node);
-	log_assert(n != NULL);
+	mesh_all_insert(mesh, s);
 	/* set detached (it is now) */
 	mesh->num_detached_states++;
 	/* make it ignore the cache */
@@ -641,16 +746,15 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	int i;
 	if(!region)
 		return NULL;
-	mstate = (struct mesh_state*)regional_alloc(region, 
+	mstate = (struct mesh_state*)alloc_obj_obtain(env->alloc,
 		sizeof(struct mesh_state));
 	if(!mstate) {
 		alloc_reg_release(env->alloc, region);
 		return NULL;
 	}
 	memset(mstate, 0, sizeof(*mstate));
-	mstate->node = *RBTREE_NULL;
+	mstate->hnext = NULL;
 	mstate->run_node = *RBTREE_NULL;
-	mstate->node.key = mstate;
 	mstate->run_node.key = mstate;
 	mstate->reply_list = NULL;
 	mstate->list_select = mesh_no_list;
@@ -668,6 +772,7 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 		qinfo->qname_len);
 	if(!mstate->s.qinfo.qname) {
 		alloc_reg_release(env->alloc, region);
+		alloc_obj_release(env->alloc, mstate, sizeof(*mstate));
 		return NULL;
 	}
 	if(cinfo) {
@@ -675,6 +780,7 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 			sizeof(*cinfo));
 		if(!mstate->s.client_info) {
 			alloc_reg_release(env->alloc, region);
+			alloc_obj_release(env->alloc, mstate, sizeof(*mstate));
 			return NULL;
 		}
 	}
@@ -693,6 +799,9 @@ mesh_state_create(struct module_env* env, struct query_info* qinfo,
 	mstate->s.no_cache_lookup = 0;
 	mstate->s.no_cache_store = 0;
 	mstate->s.need_refetch = 0;
+	if(env->cfg->log_module_time)
+		mstate->mod_time = (struct mesh_mod_stat*)regional_alloc_zero(
+			region, sizeof(struct mesh_mod_stat)*env->mesh->mods.num);
 
 	/* init modules */
 	for(i=0; i<env->mesh->mods.num; i++) {
@@ -720,17 +829,41 @@ mesh_state_make_unique(struct mesh_state* mstate)
 	mstate->unique = mstate;
 }
 
+/** log the operate calls of the query, for log-module-time */
+static void
+mesh_log_module_time(struct mesh_area* mesh, struct mesh_state* mstate)
+{
+	char buf[1024], qn[LDNS_MAX_DOMAINLEN+1], ts[16], cs[16];
+	size_t len = 0;
+	int i;
+	dname_str(mstate->s.qinfo.qname, qn);
+	sldns_wire2str_type_buf(mstate->s.qinfo.qtype, ts, sizeof(ts));
+	sldns_wire2str_class_buf(mstate->s.qinfo.qclass, cs, sizeof(cs));
+	buf[0] = 0;
+	for(i=0; i<mesh->mods.num && len < sizeof(buf); i++) {
+		struct mesh_mod_stat* st = &mstate->mod_time[i];
+		snprintf(buf+len, sizeof(buf)-len, " %s %u calls "
+			ARG_LL "d.%6.6d sec %u bytes", mesh->mods.mod[i]->name,
+			(unsigned)st->calls, st->usec/1000000,
+			(int)(st->usec%1000000), (unsigned)st->alloc);
+		len += strlen(buf+len);
+	}
+	log_info("module time %s %s %s:%s", qn, ts, cs, buf);
+}
+
 void 
 mesh_state_cleanup(struct mesh_state* mstate)
 {
 	struct mesh_area* mesh;
+	struct mesh_reply* rep, *nrep;
+	struct alloc_cache* alloc;
 	int i;
 	if(!mstate)
 		return;
 	mesh = mstate->s.env->mesh;
+	alloc = mstate->s.env->alloc;
 	/* drop unsent replies */
 	if(!mstate->replies_sent) {
-		struct mesh_reply* rep;
 		struct mesh_cb* cb;
 		for(rep=mstate->reply_list; rep; rep=rep->next) {
 			comm_point_drop_reply(&rep->query_reply);
@@ -744,6 +877,9 @@ mesh_state_cleanup(struct mesh_state* mstate)
 		}
 	}
 
+	if(mstate->mod_time)
+		mesh_log_module_time(mesh, mstate);
+
 	/* de-init modules */
 	for(i=0; i<mesh->mods.num; i++) {
 		fptr_ok(fptr_whitelist_mod_clear(mesh->mods.mod[i]->clear));
@@ -751,7 +887,12 @@ mesh_state_cleanup(struct mesh_state* mstate)
 		mstate->s.minfo[i] = NULL;
 		mstate->s.ext_state[i] = module_finished;
 	}
-	alloc_reg_release(mstate->s.env->alloc, mstate->s.region);
+	for(rep=mstate->reply_list; rep; rep=nrep) {
+		nrep = rep->next;
+		alloc_obj_release(alloc, rep, sizeof(*rep));
+	}
+	alloc_reg_release(alloc, mstate->s.region);
+	alloc_obj_release(alloc, mstate, sizeof(*mstate));
 }
 
 void 
@@ -780,7 +921,7 @@ mesh_state_delete(struct module_qstate* qstate)
 	}
 	if(mstate->reply_list || mstate->cb_list) {
 		log_assert(mesh->num_reply_states > 0);
-		mesh->num_reply_states--;
+		stat_dec(mesh->num_reply_states);
 	}
 	ref.node.key = &ref;
 	ref.s = mstate;
@@ -788,7 +929,7 @@ mesh_state_delete(struct module_qstate* qstate)
 		(void)rbtree_delete(&super->s->sub_set, &ref);
 	}
 	(void)rbtree_delete(&mesh->run, mstate);
-	(void)rbtree_delete(&mesh->all, mstate);
+	mesh_all_remove(mesh, mstate);
 	mesh_state_cleanup(mstate);
 }
 
@@ -843,7 +984,7 @@ void mesh_detach_subs(struct module_qstate* qstate)
 			&& ref->s->super_set.count == 0) {
 			mesh->num_detached_states++;
 			log_assert(mesh->num_detached_states + 
-				mesh->num_reply_states <= mesh->all.count);
+				mesh->num_reply_states <= mesh->all_count);
 		}
 	}
 	rbtree_init(&qstate->mesh_info->sub_set, &mesh_state_ref_compare);
@@ -872,13 +1013,7 @@ int mesh_add_sub(struct module_qstate* qstate, struct query_info* qinfo,
 			log_err("mesh_attach_sub: out of memory");
 			return 0;
 		}
-#ifdef UNBOUND_DEBUG
-		n =
-#else
-		(void)
-#endif
-		rbtree_insert(&mesh->all, &(*sub)->node);
-		log_assert(n != NULL);
+		mesh_all_insert(mesh, (*sub));
 		/* set detached (it is now) */
 		mesh->num_detached_states++;
 		/* set new query state to run */
@@ -1033,6 +1168,7 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 {
 	struct timeval end_time;
 	struct timeval duration;
+	struct timeval sum_wait;
 	int secure;
 	/* Copy the client's EDNS for later restore, to make sure the edns
 	 * compare is with the correct edns options. */
@@ -1043,7 +1179,7 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 		rep->security <= sec_status_bogus) {
 		rcode = LDNS_RCODE_SERVFAIL;
 		if(m->s.env->cfg->stat_extended) 
-			m->s.env->mesh->ans_bogus++;
+			stat_inc(m->s.env->mesh->ans_bogus);
 	}
 	if(rep && rep->security == sec_status_secure)
 		secure = 1;
@@ -1118,17 +1254,21 @@ mesh_send_reply(struct mesh_state* m, int rcode, struct reply_info* rep,
 	timeval_subtract(&duration, &end_time, &r->start_time);
 	verbose(VERB_ALGO, "query took " ARG_LL "d.%6.6d sec",
 		(long long)duration.tv_sec, (int)duration.tv_usec);
-	m->s.env->mesh->replies_sent++;
-	timeval_add(&m->s.env->mesh->replies_sum_wait, &duration);
+	stat_inc(m->s.env->mesh->replies_sent);
+	sum_wait = m->s.env->mesh->replies_sum_wait;
+	timeval_add(&sum_wait, &duration);
+	stat_set(m->s.env->mesh->replies_sum_wait.tv_sec, sum_wait.tv_sec);
+	stat_set(m->s.env->mesh->replies_sum_wait.tv_usec, sum_wait.tv_usec);
 	timehist_insert(m->s.env->mesh->histogram, &duration);
 	if(m->s.env->cfg->stat_extended) {
 		uint16_t rc = FLAGS_GET_RCODE(sldns_buffer_read_u16_at(r->
 			query_reply.c->buffer, 2));
-		if(secure) m->s.env->mesh->ans_secure++;
-		m->s.env->mesh->ans_rcode[ rc ] ++;
+		lathist_insert(m->s.env->mesh->lat_recursion, &duration);
+		if(secure) stat_inc(m->s.env->mesh->ans_secure);
+		stat_inc(m->s.env->mesh->ans_rcode[ rc ]);
 		if(rc == 0 && LDNS_ANCOUNT(sldns_buffer_begin(r->
 			query_reply.c->buffer)) == 0)
-			m->s.env->mesh->ans_nodata++;
+			stat_inc(m->s.env->mesh->ans_nodata);
 	}
 	/* Log reply sent */
 	if(m->s.env->cfg->log_replies) {
@@ -1194,7 +1334,6 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 	struct mesh_state key;
 	struct mesh_state* result;
 
-	key.node.key = &key;
 	key.s.is_priming = prime;
 	key.s.is_valrec = valrec;
 	key.s.qinfo = *qinfo;
@@ -1205,7 +1344,7 @@ struct mesh_state* mesh_area_find(struct mesh_area* mesh,
 	key.unique = NULL;
 	key.s.client_info = cinfo;
 	
-	result = (struct mesh_state*)rbtree_search(&mesh->all, &key);
+	result = mesh_all_lookup(mesh, &key);
 	return result;
 }
 
@@ -1236,14 +1375,13 @@ int mesh_state_add_cb(struct mesh_state* s, struct edns_data* edns,
 
 }
 
-int mesh_state_add_reply(struct mesh_state* s, struct edns_data* edns,
-        struct comm_reply* rep, uint16_t qid, uint16_t qflags,
-        const struct query_info* qinfo)
+/** copy the reply information into the (pooled) mesh_reply, the
+ * variable sized parts are allocated in the mesh state region */
+static int
+mesh_reply_copy(struct mesh_state* s, struct mesh_reply* r,
+	struct edns_data* edns, struct comm_reply* rep, uint16_t qid,
+	uint16_t qflags, const struct query_info* qinfo)
 {
-	struct mesh_reply* r = regional_alloc(s->s.region, 
-		sizeof(struct mesh_reply));
-	if(!r)
-		return 0;
 	r->query_reply = *rep;
 	r->edns = *edns;
 	if(edns->opt_list) {
@@ -1255,7 +1393,6 @@ int mesh_state_add_reply(struct mesh_state* s, struct edns_data* edns,
 	r->qid = qid;
 	r->qflags = qflags;
 	r->start_time = *s->s.env->now_tv;
-	r->next = s->reply_list;
 	r->qname = regional_alloc_init(s->s.region, qinfo->qname,
 		s->s.qinfo.qname_len);
 	if(!r->qname)
@@ -1311,7 +1448,22 @@ int mesh_state_add_reply(struct mesh_state* s, struct edns_data* edns,
 			return 0;
 	} else
 		r->local_alias = NULL;
+	return 1;
+}
 
+int mesh_state_add_reply(struct mesh_state* s, struct edns_data* edns,
+        struct comm_reply* rep, uint16_t qid, uint16_t qflags,
+        const struct query_info* qinfo)
+{
+	struct mesh_reply* r = (struct mesh_reply*)alloc_obj_obtain(
+		s->s.env->alloc, sizeof(struct mesh_reply));
+	if(!r)
+		return 0;
+	if(!mesh_reply_copy(s, r, edns, rep, qid, qflags, qinfo)) {
+		alloc_obj_release(s->s.env->alloc, r, sizeof(*r));
+		return 0;
+	}
+	r->next = s->reply_list;
 	s->reply_list = r;
 	return 1;
 }
@@ -1436,6 +1588,51 @@ mesh_continue(struct mesh_area* mesh, struct mesh_state* mstate,
 	return 0;
 }
 
+/** bytes in use in the region, for the module accounting */
+static size_t
+mesh_region_used(struct regional* r)
+{
+	return regional_get_mem(r) - r->available;
+}
+
+/** run the operate call of the current module, and account the time
+ * and memory it takes, for the statistics and log-module-time */
+static void
+mesh_operate_timed(struct mesh_area* mesh, struct mesh_state* mstate,
+	enum module_ev ev, struct outbound_entry* e)
+{
+	/* curmod is not changed by the module */
+	int m = mstate->s.curmod;
+	size_t used = mesh_region_used(mstate->s.region), alloc;
+	struct timeval start, end;
+	long long usec;
+	int s;
+	gettimeofday(&start, NULL);
+	(*mesh->mods.mod[m]->operate)(&mstate->s, ev, m, e);
+	gettimeofday(&end, NULL);
+	usec = ((long long)end.tv_sec - (long long)start.tv_sec)*1000000 +
+		((long long)end.tv_usec - (long long)start.tv_usec);
+	if(usec < 0)
+		usec = 0;
+	alloc = mesh_region_used(mstate->s.region);
+	alloc = (alloc > used)?alloc - used:0;
+	if(mesh->env->cfg->stat_extended) {
+		lathist_insert_diff(mesh->lat_module + m*NUM_BUCKETS_LATHIST,
+			&start, &end);
+		s = (int)mstate->s.ext_state[m];
+		if(s >= 0 && s < MESH_MOD_STATE_NUM) {
+			stat_inc(mesh->mod_stat[m][s].calls);
+			stat_add(mesh->mod_stat[m][s].usec, usec);
+			stat_add(mesh->mod_stat[m][s].alloc, alloc);
+		}
+	}
+	if(mstate->mod_time) {
+		mstate->mod_time[m].calls++;
+		mstate->mod_time[m].usec += usec;
+		mstate->mod_time[m].alloc += alloc;
+	}
+}
+
 void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 	enum module_ev ev, struct outbound_entry* e)
 {
@@ -1445,8 +1642,12 @@ void mesh_run(struct mesh_area* mesh, struct mesh_state* mstate,
 		/* run the module */
 		fptr_ok(fptr_whitelist_mod_operate(
 			mesh->mods.mod[mstate->s.curmod]->operate));
-		(*mesh->mods.mod[mstate->s.curmod]->operate)
-			(&mstate->s, ev, mstate->s.curmod, e);
+		if(mesh->env->cfg->stat_extended || mstate->mod_time) {
+			mesh_operate_timed(mesh, mstate, ev, e);
+		} else {
+			(*mesh->mods.mod[mstate->s.curmod]->operate)
+				(&mstate->s, ev, mstate->s.curmod, e);
+		}
 
 		/* examine results */
 		mstate->s.reply = NULL;
@@ -1477,19 +1678,23 @@ mesh_log_list(struct mesh_area* mesh)
 {
 	char buf[30];
 	struct mesh_state* m;
+	size_t i;
 	int num = 0;
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
-		snprintf(buf, sizeof(buf), "%d%s%s%s%s%s%s mod%d %s%s", 
-			num++, (m->s.is_priming)?"p":"",  /* prime */
-			(m->s.is_valrec)?"v":"",  /* prime */
-			(m->s.query_flags&BIT_RD)?"RD":"",
-			(m->s.query_flags&BIT_CD)?"CD":"",
-			(m->super_set.count==0)?"d":"", /* detached */
-			(m->sub_set.count!=0)?"c":"",  /* children */
-			m->s.curmod, (m->reply_list)?"rep":"", /*hasreply*/
-			(m->cb_list)?"cb":"" /* callbacks */
-			); 
-		log_query_info(VERB_ALGO, buf, &m->s.qinfo);
+	for(i=0; i<mesh->all_size; i++) {
+		for(m = mesh->all[i]; m; m = m->hnext) {
+			snprintf(buf, sizeof(buf), "%d%s%s%s%s%s%s mod%d %s%s", 
+				num++, (m->s.is_priming)?"p":"",  /* prime */
+				(m->s.is_valrec)?"v":"",  /* prime */
+				(m->s.query_flags&BIT_RD)?"RD":"",
+				(m->s.query_flags&BIT_CD)?"CD":"",
+				(m->super_set.count==0)?"d":"", /* detached */
+				(m->sub_set.count!=0)?"c":"",  /* children */
+				m->s.curmod,
+				(m->reply_list)?"rep":"", /*hasreply*/
+				(m->cb_list)?"cb":"" /* callbacks */
+				); 
+			log_query_info(VERB_ALGO, buf, &m->s.qinfo);
+		}
 	}
 }
 
@@ -1499,7 +1704,7 @@ mesh_stats(struct mesh_area* mesh, const char* str)
 	verbose(VERB_DETAIL, "%s %u recursion states (%u with reply, "
 		"%u detached), %u waiting replies, %u recursion replies "
 		"sent, %d replies dropped, %d states jostled out", 
-		str, (unsigned)mesh->all.count, 
+		str, (unsigned)mesh->all_count, 
 		(unsigned)mesh->num_reply_states,
 		(unsigned)mesh->num_detached_states,
 		(unsigned)mesh->num_reply_addrs,
@@ -1521,30 +1726,49 @@ mesh_stats(struct mesh_area* mesh, const char* str)
 void 
 mesh_stats_clear(struct mesh_area* mesh)
 {
+	size_t i, j;
 	if(!mesh)
 		return;
-	mesh->replies_sent = 0;
-	mesh->replies_sum_wait.tv_sec = 0;
-	mesh->replies_sum_wait.tv_usec = 0;
-	mesh->stats_jostled = 0;
-	mesh->stats_dropped = 0;
+	stat_set(mesh->replies_sent, 0);
+	stat_set(mesh->replies_sum_wait.tv_sec, 0);
+	stat_set(mesh->replies_sum_wait.tv_usec, 0);
+	stat_set(mesh->stats_jostled, 0);
+	stat_set(mesh->stats_dropped, 0);
 	timehist_clear(mesh->histogram);
-	mesh->ans_secure = 0;
-	mesh->ans_bogus = 0;
-	memset(&mesh->ans_rcode[0], 0, sizeof(size_t)*16);
-	mesh->ans_nodata = 0;
+	stat_set(mesh->ans_secure, 0);
+	stat_set(mesh->ans_bogus, 0);
+	for(i=0; i<16; i++)
+		stat_set(mesh->ans_rcode[i], 0);
+	stat_set(mesh->ans_nodata, 0);
+	for(i=0; i<(1+MAX_MODULE)*NUM_BUCKETS_LATHIST; i++)
+		stat_set(mesh->lat_recursion[i], 0);
+	for(i=0; i<MAX_MODULE; i++)
+		for(j=0; j<MESH_MOD_STATE_NUM; j++) {
+			stat_set(mesh->mod_stat[i][j].calls, 0);
+			stat_set(mesh->mod_stat[i][j].usec, 0);
+			stat_set(mesh->mod_stat[i][j].alloc, 0);
+		}
 }
 
 size_t 
 mesh_get_mem(struct mesh_area* mesh)
 {
 	struct mesh_state* m;
+	size_t i;
 	size_t s = sizeof(*mesh) + sizeof(struct timehist) +
 		sizeof(struct th_buck)*mesh->histogram->num +
-		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak);
-	RBTREE_FOR(m, struct mesh_state*, &mesh->all) {
-		/* all, including m itself allocated in qstate region */
-		s += regional_get_mem(m->s.region);
+		sizeof(long long)*(1+MAX_MODULE)*NUM_BUCKETS_LATHIST +
+		sizeof(sldns_buffer) + sldns_buffer_capacity(mesh->qbuf_bak) +
+		sizeof(struct mesh_state*)*mesh->all_size;
+	for(i=0; i<mesh->all_size; i++) {
+		for(m = mesh->all[i]; m; m = m->hnext) {
+			struct mesh_reply* r;
+			/* m and its replies come from the alloc object cache,
+			 * the rest is allocated in the qstate region */
+			s += sizeof(*m) + regional_get_mem(m->s.region);
+			for(r = m->reply_list; r; r = r->next)
+				s += sizeof(*r);
+		}
 	}
 	return s;
 }
@@ -74,6 +74,24 @@ struct respip_client_info;
  */
 #define MESH_MAX_SUBSUB 1024
 
+/** initial number of buckets in the mesh all table, power of 2 */
+#define MESH_ALL_START_SIZE 256
+
+/** number of module_ext_state values, for the module accounting */
+#define MESH_MOD_STATE_NUM 7
+
+/**
+ * Accounting of the operate calls of a module.
+ */
+struct mesh_mod_stat {
+	/** number of calls */
+	size_t calls;
+	/** time spent in the calls, in microseconds */
+	long long usec;
+	/** bytes allocated in the query region by the calls */
+	size_t alloc;
+};
+
 /** 
  * Mesh of query states
  */
@@ -85,8 +103,13 @@ struct mesh_area {
 
 	/** set of runnable queries (mesh_state.run_node) */
 	rbtree_type run;
-	/** rbtree of all current queries (mesh_state.node)*/
-	rbtree_type all;
+	/** hash table of all current queries, array of bucket lists
+	 * (mesh_state.hnext), indexed with mesh_state.hash. Unordered. */
+	struct mesh_state** all;
+	/** number of buckets in the all table, power of 2 */
+	size_t all_size;
+	/** number of mesh states in the all table */
+	size_t all_count;
 
 	/** count of the total number of mesh_reply entries */
 	size_t num_reply_addrs;
@@ -124,6 +147,16 @@ struct mesh_area {
 	size_t ans_rcode[16];
 	/** (extended stats) rcode nodata in replies */
 	size_t ans_nodata;
+	/** (extended stats) log-linear histogram of the reply times, with
+	 * NUM_BUCKETS_LATHIST counters, see util/timehist.h */
+	long long* lat_recursion;
+	/** (extended stats) log-linear histograms of the time spent in the
+	 * operate call, NUM_BUCKETS_LATHIST counters for every module in
+	 * the stack, up to MAX_MODULE */
+	long long* lat_module;
+	/** (extended stats) operate calls per module, by the module state
+	 * that the call returned */
+	struct mesh_mod_stat mod_stat[MAX_MODULE][MESH_MOD_STATE_NUM];
 
 	/** backup of query if other operations recurse and need the
 	 * network buffers */
@@ -150,12 +183,17 @@ struct mesh_area {
  * And RD / CD flag; in case a client turns it off.
  * And priming queries are different from ordinary queries (because of hints).
  *
- * The entire structure is allocated in a region, this region is the qstate
- * region. All parts (rbtree nodes etc) are also allocated in the region.
+ * The structure itself is obtained from the fixed size object cache of the
+ * thread alloc (alloc_obj_obtain), so that it is recycled without malloc.
+ * All parts (rbtree nodes etc) are allocated in the qstate region, that
+ * is also recycled by the alloc.
  */
 struct mesh_state {
-	/** node in mesh_area all tree, key is this struct. Must be first. */
-	rbnode_type node;
+	/** next in the mesh_area all table bucket list */
+	struct mesh_state* hnext;
+	/** hash of the query name, type, class and flags, for the
+	 * mesh_area all table */
+	hashvalue_type hash;
 	/** node in mesh_area runnable tree, key is this struct */
 	rbnode_type run_node;
 	/** the query state. Note that the qinfo and query_flags 
@@ -183,6 +221,9 @@ struct mesh_state {
 		mesh_jostle_list } list_select;
 	/** pointer to this state for uniqueness or NULL */
 	struct mesh_state* unique;
+	/** with log-module-time, the operate calls for this query, per
+	 * module, allocated in the region; NULL if not kept */
+	struct mesh_mod_stat* mod_time;
 
 	/** true if replies have been sent out (at end for alignment) */
 	uint8_t replies_sent;
@@ -200,7 +241,8 @@ struct mesh_state_ref {
 };
 
 /**
- * Reply to a client
+ * Reply to a client. Obtained from the alloc object cache, the qname
+ * and edns options are allocated in the qstate region.
  */
 struct mesh_reply {
 	/** next in reply list */
@@ -598,6 +640,24 @@ int mesh_detect_cycle(struct module_qstate* qstate, struct query_info* qinfo,
 /** compare two mesh_states */
 int mesh_state_compare(const void* ap, const void* bp);
 
+/**
+ * Insert a new mesh state into the mesh area all table.
+ * @param mesh: the mesh area.
+ * @param m: the mesh state, with qinfo, flags, unique and client_info set.
+ *	It must not be present in the table already.
+ */
+void mesh_all_insert(struct mesh_area* mesh, struct mesh_state* m);
+
+/**
+ * Get the list of all mesh states, sorted with mesh_state_compare.
+ * The all table is unordered, this is for the requestlist dump.
+ * @param mesh: the mesh area.
+ * @param num: returns number of states in the list.
+ * @return malloced array of mesh states, caller frees. NULL on malloc
+ * 	failure or if there are no states.
+ */
+struct mesh_state** mesh_list_sorted(struct mesh_area* mesh, size_t* num);
+
 /** compare two mesh references */
 int mesh_state_ref_compare(const void* ap, const void* bp);
 
@@ -43,6 +43,8 @@
 #include <sys/time.h>
 #include "services/outbound_list.h"
 #include "services/outside_network.h"
+#include "util/module.h"
+#include "util/alloc.h"
 
 void 
 outbound_list_init(struct outbound_list* list)
@@ -58,7 +60,7 @@ outbound_list_clear(struct outbound_list* list)
 	while(p) {
 		np = p->next;
 		outnet_serviced_query_stop(p->qsent, p);
-		/* in region, no free needed */
+		alloc_obj_release(p->qstate->env->alloc, p, sizeof(*p));
 		p = np;
 	}
 	outbound_list_init(list);
@@ -85,5 +87,5 @@ outbound_list_remove(struct outbound_list* list, struct outbound_entry* e)
 	if(e->prev)
 		e->prev->next = e->next;
 	else	list->first = e->next;
-	/* in region, no free needed */
+	alloc_obj_release(e->qstate->env->alloc, e, sizeof(*e));
 }
@@ -67,6 +67,9 @@ struct outbound_entry {
 	struct serviced_query* qsent;
 	/** the module query state that sent it */
 	struct module_qstate* qstate;
+	/** if the query is a race query of the iterator, it holds one
+	 * unit of the upstream race budget until it is removed */
+	int race;
 };
 
 /**
@@ -84,7 +87,9 @@ void outbound_list_init(struct outbound_list* list);
 void outbound_list_clear(struct outbound_list* list);
 
 /**
- * Insert new entry into the list. Caller must allocate the entry with malloc.
+ * Insert new entry into the list. Caller must allocate the entry with
+ * alloc_obj_obtain from the alloc of the qstate env, because the list
+ * puts it back there when the entry is removed.
  * qstate and qsent are set by caller.
  * @param list: the list to add to.
  * @param e: entry to add, it is only half initialised at call start, fully
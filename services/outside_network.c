@@ -57,6 +57,8 @@
 #include "util/net_help.h"
 #include "util/random.h"
 #include "util/fptr_wlist.h"
+#include "util/timehist.h"
+#include "util/locks.h"
 #include "sldns/sbuffer.h"
 #include "dnstap/dnstap.h"
 #ifdef HAVE_OPENSSL_SSL_H
@@ -368,7 +370,7 @@ outnet_tcp_take_into_use(struct waiting_tcp* w, uint8_t* pkt, size_t pkt_len)
 	w->pkt = NULL;
 	w->next_waiting = (void*)pend;
 	pend->id = LDNS_ID_WIRE(pkt);
-	w->outnet->num_tcp_outgoing++;
+	stat_inc(w->outnet->num_tcp_outgoing);
 	w->outnet->tcp_free = pend->next_free;
 	pend->next_free = NULL;
 	pend->query = w;
@@ -535,7 +537,7 @@ outnet_udp_cb(struct comm_point* c, void* arg, int error,
 	if(!p) {
 		verbose(VERB_QUERY, "received unwanted or unsolicited udp reply dropped.");
 		log_buf(VERB_ALGO, "dropped message", c->buffer);
-		outnet->unwanted_replies++;
+		stat_inc(outnet->unwanted_replies);
 		if(outnet->unwanted_threshold && ++outnet->unwanted_total 
 			>= outnet->unwanted_threshold) {
 			log_warn("unwanted reply total reached threshold (%u)"
@@ -555,7 +557,7 @@ outnet_udp_cb(struct comm_point* c, void* arg, int error,
 	if(p->pc->cp != c) {
 		verbose(VERB_QUERY, "received reply id,addr on wrong port. "
 			"dropped.");
-		outnet->unwanted_replies++;
+		stat_inc(outnet->unwanted_replies);
 		if(outnet->unwanted_threshold && ++outnet->unwanted_total 
 			>= outnet->unwanted_threshold) {
 			log_warn("unwanted reply total reached threshold (%u)"
@@ -1792,6 +1794,9 @@ serviced_tcp_callback(struct comm_point* c, void* arg, int error,
 		  + ((int)now.tv_usec - (int)sq->last_sent_time.tv_usec)/1000;
 		verbose(VERB_ALGO, "measured TCP-time at %d msec", roundtime);
 		log_assert(roundtime >= 0);
+		if(sq->outnet->lat_upstream)
+			lathist_insert_diff(sq->outnet->lat_upstream,
+				&sq->last_sent_time, &now);
 		/* only store if less then AUTH_TIMEOUT seconds, it could be
 		 * huge due to system-hibernated and we woke up */
 		if(roundtime < TCP_AUTH_QUERY_TIMEOUT*1000) {
@@ -2023,6 +2028,9 @@ serviced_udp_callback(struct comm_point* c, void* arg, int error,
 		  + ((int)now.tv_usec - (int)sq->last_sent_time.tv_usec)/1000;
 		verbose(VERB_ALGO, "measured roundtrip at %d msec", roundtime);
 		log_assert(roundtime >= 0);
+		if(outnet->lat_upstream)
+			lathist_insert_diff(outnet->lat_upstream,
+				&sq->last_sent_time, &now);
 		/* in case the system hibernated, do not enter a huge value,
 		 * above this value gives trouble with server selection */
 		if(roundtime < 60000) {
@@ -86,6 +86,9 @@ struct outside_network {
 	/** outside network wants to quit. Stop queued msgs from sent. */
 	int want_to_quit;
 
+	/** (extended stats) log-linear histogram of the roundtrip times,
+	 * see util/timehist.h, or NULL if not kept */
+	long long* lat_upstream;
 	/** number of unwanted replies received (for statistics) */
 	size_t unwanted_replies;
 	/** cumulative total of unwanted replies (for defense) */
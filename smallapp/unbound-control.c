@@ -60,6 +60,8 @@
 #include "util/net_help.h"
 #include "util/shm_side/shm_main.h"
 #include "daemon/stats.h"
+#include "util/module.h"
+#include "dnstap/dnstap_config.h"
 #include "sldns/wire2str.h"
 #include "sldns/pkthdr.h"
 
@@ -142,6 +144,8 @@ usage(void)
 	printf("  ratelimit_list [+a]		list ratelimited domains\n");
 	printf("  ip_ratelimit_list [+a]	list ratelimited ip addresses\n");
 	printf("		+a		list all, also not ratelimited\n");
+	printf("  heavy_hitters [number]	list busiest clients, names and upstreams\n");
+	printf("  slab_stats			show cache storage slabs and fragmentation\n");
 	printf("  view_list_local_zones	view	list local-zones in view\n");
 	printf("  view_list_local_data	view	list local-data RRs in view\n");
 	printf("  view_local_zone view name type  	add local-zone in view\n");
@@ -208,6 +212,9 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
     PR_UL_NM("num.dnscrypt.malformed",
              s->svr.num_query_dnscrypt_crypted_malformed);
 #endif /* USE_DNSCRYPT */
+#ifdef USE_DNSTAP
+	PR_UL_NM("num.dnstap.dropped", s->svr.dnstap_dropped);
+#endif /* USE_DNSTAP */
 	printf("%s.requestlist.avg"SQ"%g\n", nm,
 		(s->svr.num_queries_missed_cache+s->svr.num_queries_prefetch)?
 			(double)s->svr.sum_query_list_size/
@@ -227,6 +234,12 @@ static void pr_stats(const char* nm, struct ub_stats_info* s)
 	PR_TIMEVAL("recursion.time.avg", avg);
 	printf("%s.recursion.time.median"SQ"%g\n", nm, s->mesh_time_median);
 	PR_UL_NM("tcpusage", s->svr.tcp_accept_usage);
+	PR_UL_NM("alloc.obj.reused", s->svr.alloc_obj_reused);
+	PR_UL_NM("alloc.obj.malloced", s->svr.alloc_obj_malloced);
+	PR_UL_NM("alloc.obj.freed", s->svr.alloc_obj_freed);
+	PR_UL_NM("alloc.chunk.reused", s->svr.alloc_chunk_reused);
+	PR_UL_NM("alloc.chunk.malloced", s->svr.alloc_chunk_malloced);
+	PR_UL_NM("alloc.chunk.freed", s->svr.alloc_chunk_freed);
 }
 
 /** print uptime */
@@ -242,6 +255,7 @@ static void print_mem(struct ub_shm_stat_info* shm_stat)
 {
 	PR_LL("mem.cache.rrset", shm_stat->mem.rrset);
 	PR_LL("mem.cache.message", shm_stat->mem.msg);
+	PR_LL("mem.cache.hugepage", shm_stat->mem.hugepage);
 	PR_LL("mem.mod.iterator", shm_stat->mem.iter);
 	PR_LL("mem.mod.validator", shm_stat->mem.val);
 	PR_LL("mem.mod.respip", shm_stat->mem.respip);
@@ -279,6 +293,69 @@ static void print_hist(struct ub_stats_info* s)
 	timehist_delete(hist);
 }
 
+/** print a latency histogram as count and quantiles */
+static void pr_lat(const char* nm, long long* array)
+{
+	printf("latency.%s.count=%lu\n", nm,
+		(unsigned long)lathist_count(array));
+	printf("latency.%s.p50=%g\n", nm, lathist_quantile(array, 0.50));
+	printf("latency.%s.p90=%g\n", nm, lathist_quantile(array, 0.90));
+	printf("latency.%s.p99=%g\n", nm, lathist_quantile(array, 0.99));
+	printf("latency.%s.p999=%g\n", nm, lathist_quantile(array, 0.999));
+}
+
+/** print the latency histograms, module names from the config */
+static void print_latency(struct config_file* cfg, struct ub_stats_ext* ext)
+{
+	const char* str = cfg->module_conf;
+	char mod[32], nm[64];
+	int i, n;
+	pr_lat("cache", ext->lat_cache);
+	pr_lat("local", ext->lat_local);
+	pr_lat("recursion", ext->lat_recursion);
+	pr_lat("upstream", ext->lat_upstream);
+	for(i=0; i<UB_STATS_MODULE_NUM &&
+		sscanf(str, " %31s%n", mod, &n) == 1; i++) {
+		str += n;
+		snprintf(nm, sizeof(nm), "module.%s", mod);
+		pr_lat(nm, ext->lat_module[i]);
+	}
+}
+
+/** print the operate call accounting of the modules */
+static void print_modules(struct config_file* cfg, struct ub_stats_ext* ext)
+{
+	const char* str = cfg->module_conf;
+	char nm[32];
+	int i, m, n;
+	for(i=0; i<UB_STATS_MODULE_NUM &&
+		sscanf(str, " %31s%n", nm, &n) == 1; i++) {
+		long long calls = 0, usec = 0, alloc = 0;
+		str += n;
+		for(m=0; m<UB_STATS_MODSTATE_NUM; m++) {
+			calls += ext->mod_calls[i][m];
+			usec += ext->mod_usec[i][m];
+			alloc += ext->mod_alloc[i][m];
+		}
+		printf("module.%s.calls=%lu\n", nm, (unsigned long)calls);
+		printf("module.%s.time=%g\n", nm, (double)usec/1000000.);
+		printf("module.%s.alloc=%lu\n", nm, (unsigned long)alloc);
+		for(m=0; m<UB_STATS_MODSTATE_NUM; m++) {
+			/* the state name without the module_ prefix */
+			const char* st = strextstate((enum module_ext_state)m)
+				+ strlen("module_");
+			if(ext->mod_calls[i][m] == 0)
+				continue;
+			printf("module.%s.%s.calls=%lu\n", nm, st,
+				(unsigned long)ext->mod_calls[i][m]);
+			printf("module.%s.%s.time=%g\n", nm, st,
+				(double)ext->mod_usec[i][m]/1000000.);
+			printf("module.%s.%s.alloc=%lu\n", nm, st,
+				(unsigned long)ext->mod_alloc[i][m]);
+		}
+	}
+}
+
 /** print extended */
 static void print_extended(struct ub_stats_info* s)
 {
@@ -345,6 +422,9 @@ static void print_extended(struct ub_stats_info* s)
 	}
 	/* iteration */
 	PR_UL("num.query.ratelimited", s->svr.queries_ratelimited);
+	PR_UL("num.query.race.sent", s->svr.race_sent);
+	PR_UL("num.query.race.won", s->svr.race_won);
+	PR_UL("num.query.race.wasted", s->svr.race_wasted);
 	/* validation */
 	PR_UL("num.answer.secure", s->svr.ans_secure);
 	PR_UL("num.answer.bogus", s->svr.ans_bogus);
@@ -370,7 +450,7 @@ static void print_extended(struct ub_stats_info* s)
 
 /** print statistics out of memory structures */
 static void do_stats_shm(struct config_file* cfg, struct ub_stats_info* stats,
-	struct ub_shm_stat_info* shm_stat)
+	struct ub_stats_ext* ext, struct ub_shm_stat_info* shm_stat)
 {
 	int i;
 	char nm[32];
@@ -383,6 +463,10 @@ static void do_stats_shm(struct config_file* cfg, struct ub_stats_info* stats,
 	if(cfg->stat_extended) {
 		print_mem(shm_stat);
 		print_hist(stats);
+		if(ext) {
+			print_latency(cfg, ext);
+			print_modules(cfg, ext);
+		}
 		print_extended(stats);
 	}
 }
@@ -394,7 +478,9 @@ static void print_stats_shm(const char* cfgfile)
 #ifdef HAVE_SHMGET
 	struct config_file* cfg;
 	struct ub_stats_info* stats;
+	struct ub_stats_ext* ext = NULL;
 	struct ub_shm_stat_info* shm_stat;
+	struct shmid_ds ds;
 	int id_ctl, id_arr;
 	/* read config */
 	if(!(cfg = config_create()))
@@ -418,9 +504,14 @@ static void print_stats_shm(const char* cfgfile)
 	if(stats == (void*)-1) {
 		fatal_exit("shmat(%d): %s", id_arr, strerror(errno));
 	}
+	/* the extended stats follow the array, if the segment has them */
+	if(cfg->stat_extended && shmctl(id_arr, IPC_STAT, &ds) == 0 &&
+		(size_t)ds.shm_segsz >= (sizeof(struct ub_stats_info) +
+		sizeof(struct ub_stats_ext)) * (size_t)(cfg->num_threads + 1))
+		ext = (struct ub_stats_ext*)(stats + cfg->num_threads + 1);
 
 	/* print the stats */
-	do_stats_shm(cfg, stats, shm_stat);
+	do_stats_shm(cfg, stats, ext, shm_stat);
 
 	/* shutdown */
 	shmdt(shm_stat);
@@ -44,10 +44,12 @@
 #ifdef HAVE_GETOPT_H
 #include <getopt.h>
 #endif
+#include <sys/time.h>
 #include "libunbound/unbound.h"
 #include "libunbound/context.h"
 #include "util/locks.h"
 #include "util/log.h"
+#include "util/tube.h"
 #include "sldns/rrdef.h"
 #ifdef UNBOUND_ALLOC_LITE
 #undef malloc
@@ -89,12 +91,19 @@ static void usage(char* argv[])
 {
 	printf("usage: %s [options] name ...\n", argv[0]);
 	printf("names are looked up at the same time, asynchronously.\n");
+	printf("	-a num : time num async lookups of every name, after\n");
+	printf("	         a first lookup that fills the cache\n");
 	printf("	-b : use blocking requests\n");
+	printf("	-B num : like -a but submit with ub_resolve_batch\n");
 	printf("	-c : cancel the requests\n");
 	printf("	-d : enable debug output\n");
 	printf("	-f addr : use addr, forward to that server\n");
 	printf("	-h : this help message\n");
 	printf("	-H fname : read hosts from fname\n");
+	printf("	-n num : number of resolver threads for -t\n");
+	printf("	-P : test a failed pipe write of ub_resolve_batch\n");
+	printf("	-p num : time num blocking lookups of every name, after\n");
+	printf("	         a first lookup that fills the cache\n");
 	printf("	-r fname : read resolv.conf from fname\n");
 	printf("	-t : use a resolver thread instead of forking a process\n");
 	printf("	-x : perform extended threaded test\n");
@@ -378,6 +387,182 @@ ext_test(struct ub_ctx* ctx, int argc, char** argv)
 	return 0;
 }
 
+/** time blocking lookups of the names, that are answered from the cache
+ * or local data after the first lookup */
+static int
+perf_test(struct ub_ctx* ctx, int argc, char** argv, int num)
+{
+	struct ub_result* result;
+	struct timeval start, end;
+	double dt;
+	int i, j, r;
+	for(i=0; i<argc; i++) {
+		r = ub_resolve(ctx, argv[i], LDNS_RR_TYPE_A,
+			LDNS_RR_CLASS_IN, &result);
+		checkerr("ub_resolve", r);
+		ub_resolve_free(result);
+		if(gettimeofday(&start, NULL) < 0) {
+			printf("gettimeofday: %s\n", strerror(errno));
+			return 1;
+		}
+		for(j=0; j<num; j++) {
+			r = ub_resolve(ctx, argv[i], LDNS_RR_TYPE_A,
+				LDNS_RR_CLASS_IN, &result);
+			checkerr("ub_resolve", r);
+			ub_resolve_free(result);
+		}
+		if(gettimeofday(&end, NULL) < 0) {
+			printf("gettimeofday: %s\n", strerror(errno));
+			return 1;
+		}
+		dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+			((double)end.tv_usec - (double)start.tv_usec)/1000.;
+		printf("%s: did %d in %g msec for %g lookups/sec, "
+			"%g usec per lookup\n", argv[i], num, dt,
+			(double)num / (dt/1000.), dt*1000./(double)num);
+	}
+	ub_ctx_delete(ctx);
+	checklock_stop();
+	return 0;
+}
+
+/** callback for the async perf test, counts answers */
+static void
+perf_async_cb(void* mydata, int err, struct ub_result* result)
+{
+	int* done = (int*)mydata;
+	checkerr("perf async callback", err);
+	(*done)++;
+	ub_resolve_free(result);
+}
+
+/** time async lookups of the names, all outstanding at the same time,
+ * answered from the cache or local data after the first lookup.
+ * With batch, they are submitted with one ub_resolve_batch call. */
+static int
+perf_async_test(struct ub_ctx* ctx, int argc, char** argv, int num,
+	int batch)
+{
+	struct ub_result* result;
+	struct ub_batch_query* qs = NULL;
+	struct timeval start, mid, end;
+	double dt, dsub;
+	int i, j, r, done;
+	if(batch) {
+		qs = (struct ub_batch_query*)calloc((size_t)num, sizeof(*qs));
+		if(!qs) {
+			printf("out of memory\n");
+			return 1;
+		}
+	}
+	for(i=0; i<argc; i++) {
+		r = ub_resolve(ctx, argv[i], LDNS_RR_TYPE_A,
+			LDNS_RR_CLASS_IN, &result);
+		checkerr("ub_resolve", r);
+		ub_resolve_free(result);
+		done = 0;
+		if(gettimeofday(&start, NULL) < 0) {
+			printf("gettimeofday: %s\n", strerror(errno));
+			return 1;
+		}
+		if(batch) {
+			for(j=0; j<num; j++) {
+				qs[j].name = argv[i];
+				qs[j].rrtype = LDNS_RR_TYPE_A;
+				qs[j].rrclass = LDNS_RR_CLASS_IN;
+				qs[j].mydata = &done;
+			}
+			r = ub_resolve_batch(ctx, qs, num, perf_async_cb);
+			checkerr("ub_resolve_batch", r);
+		} else for(j=0; j<num; j++) {
+			r = ub_resolve_async(ctx, argv[i], LDNS_RR_TYPE_A,
+				LDNS_RR_CLASS_IN, &done, perf_async_cb, NULL);
+			checkerr("ub_resolve_async", r);
+		}
+		if(gettimeofday(&mid, NULL) < 0) {
+			printf("gettimeofday: %s\n", strerror(errno));
+			return 1;
+		}
+		r = ub_wait(ctx);
+		checkerr("ub_wait", r);
+		if(gettimeofday(&end, NULL) < 0) {
+			printf("gettimeofday: %s\n", strerror(errno));
+			return 1;
+		}
+		if(done != num) {
+			printf("%s: only %d of %d answered\n", argv[i],
+				done, num);
+			return 1;
+		}
+		dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+			((double)end.tv_usec - (double)start.tv_usec)/1000.;
+		dsub = (double)(mid.tv_sec - start.tv_sec)*1000. +
+			((double)mid.tv_usec - (double)start.tv_usec)/1000.;
+		printf("%s: did %d %s in %g msec for %g lookups/sec, "
+			"%g usec per lookup, submit %g usec per lookup\n",
+			argv[i], num, batch?"batched":"async", dt,
+			(double)num / (dt/1000.), dt*1000./(double)num,
+			dsub*1000./(double)num);
+	}
+	free(qs);
+	ub_ctx_delete(ctx);
+	checklock_stop();
+	return 0;
+}
+
+/** test that ub_resolve_batch reports a failed write to the background
+ * process.  The names are looked up once to start the process, then the
+ * query pipe is closed, so that the batch cannot be written to it. */
+static int
+batch_pipefail_test(struct ub_ctx* ctx, int argc, char** argv)
+{
+	struct ub_batch_query* qs;
+	int i, r, done = 0;
+	if(ctx->dothread) {
+		printf("-P needs a forked background process, not -t\n");
+		return 1;
+	}
+	qs = (struct ub_batch_query*)calloc((size_t)argc, sizeof(*qs));
+	if(!qs) {
+		printf("out of memory\n");
+		return 1;
+	}
+	for(i=0; i<argc; i++) {
+		qs[i].name = argv[i];
+		qs[i].rrtype = LDNS_RR_TYPE_A;
+		qs[i].rrclass = LDNS_RR_CLASS_IN;
+		qs[i].mydata = &done;
+	}
+	r = ub_resolve_batch(ctx, qs, argc, perf_async_cb);
+	checkerr("ub_resolve_batch", r);
+	r = ub_wait(ctx);
+	checkerr("ub_wait", r);
+
+	/* the background process sees the pipe closed and exits */
+#ifndef USE_WINSOCK
+	close(ctx->qq_pipe->sw);
+	ctx->qq_pipe->sw = -1;
+#endif
+	r = ub_resolve_batch(ctx, qs, argc, perf_async_cb);
+	if(r != UB_PIPE) {
+		printf("batch pipe failure: returned %s, not %s\n",
+			ub_strerror(r), ub_strerror(UB_PIPE));
+		return 1;
+	}
+	for(i=0; i<argc; i++) {
+		if(qs[i].async_id != 0) {
+			printf("batch pipe failure: %s has async_id %d\n",
+				argv[i], qs[i].async_id);
+			return 1;
+		}
+	}
+	printf("batch pipe failure: OK\n");
+	free(qs);
+	ub_ctx_delete(ctx);
+	checklock_stop();
+	return 0;
+}
+
 /** getopt global, in case header files fail to declare it. */
 extern int optind;
 /** getopt global, in case header files fail to declare it. */
@@ -389,7 +574,8 @@ int main(int argc, char** argv)
 	int c;
 	struct ub_ctx* ctx;
 	struct lookinfo* lookups;
-	int i, r, cancel=0, blocking=0, ext=0;
+	int i, r, cancel=0, blocking=0, ext=0, perf=0, perf_async=0,
+		perf_batch=0, pipefail=0;
 
 	/* init log now because solaris thr_key_create() is not threadsafe */
 	log_init(0,0,0);
@@ -407,7 +593,7 @@ int main(int argc, char** argv)
 	if(argc == 1) {
 		usage(argv);
 	}
-	while( (c=getopt(argc, argv, "bcdf:hH:r:tx")) != -1) {
+	while( (c=getopt(argc, argv, "a:bB:cdf:hH:n:Pp:r:tx")) != -1) {
 		switch(c) {
 			case 'd':
 				r = ub_ctx_debuglevel(ctx, 3);
@@ -447,9 +633,38 @@ int main(int argc, char** argv)
 				r = ub_ctx_set_fwd(ctx, optarg);
 				checkerr("ub_ctx_set_fwd", r);
 				break;
+			case 'p':
+				perf = atoi(optarg);
+				if(perf <= 0) {
+					printf("-p needs a number > 0\n");
+					return 1;
+				}
+				break;
+			case 'a':
+				perf_async = atoi(optarg);
+				if(perf_async <= 0) {
+					printf("-a needs a number > 0\n");
+					return 1;
+				}
+				break;
+			case 'B':
+				perf_async = atoi(optarg);
+				perf_batch = 1;
+				if(perf_async <= 0) {
+					printf("-B needs a number > 0\n");
+					return 1;
+				}
+				break;
+			case 'n':
+				r = ub_ctx_async_threads(ctx, atoi(optarg));
+				checkerr("ub_ctx_async_threads", r);
+				break;
 			case 'x':
 				ext = 1;
 				break;
+			case 'P':
+				pipefail = 1;
+				break;
 			case 'h':
 			case '?':
 			default:
@@ -461,6 +676,13 @@ int main(int argc, char** argv)
 
 	if(ext)
 		return ext_test(ctx, argc, argv);
+	if(pipefail)
+		return batch_pipefail_test(ctx, argc, argv);
+	if(perf)
+		return perf_test(ctx, argc, argv, perf);
+	if(perf_async)
+		return perf_async_test(ctx, argc, argv, perf_async,
+			perf_batch);
 
 	/* allocate array for results. */
 	lookups = (struct lookinfo*)calloc((size_t)argc, 
@@ -896,6 +896,12 @@ comm_base_create(int ATTR_UNUSED(sigs))
 	return (struct comm_base*)runtime;
 }
 
+struct comm_base* 
+comm_base_create_daemon(int sigs)
+{
+	return comm_base_create(sigs);
+}
+
 void 
 comm_base_delete(struct comm_base* b)
 {
@@ -1392,6 +1398,13 @@ void comm_point_udp_callback(int ATTR_UNUSED(fd), short ATTR_UNUSED(event),
 	log_assert(0);
 }
 
+void comm_point_udp_recv(struct comm_point* ATTR_UNUSED(c),
+	uint8_t* ATTR_UNUSED(data), size_t ATTR_UNUSED(len),
+	struct sockaddr* ATTR_UNUSED(addr), socklen_t ATTR_UNUSED(addrlen))
+{
+	log_assert(0);
+}
+
 void comm_point_udp_ancil_callback(int ATTR_UNUSED(fd), 
 	short ATTR_UNUSED(event), void* ATTR_UNUSED(arg))
 {
@@ -42,7 +42,9 @@
 #include "testcode/unitmain.h"
 #include "util/regional.h"
 #include "util/net_help.h"
+#include "util/config_file.h"
 #include "util/data/msgreply.h"
+#include "util/data/dname.h"
 #include "services/cache/dns.h"
 #include "sldns/str2wire.h"
 #include "sldns/wire2str.h"
@@ -870,6 +872,109 @@ authzone_query_test(void)
 	check_queries("example.com", zone_example_com, example_com_queries);
 }
 
+/** number of zones for the load test */
+#define LOAD_TEST_ZONES 8
+
+/** create zonefile text with a SOA and num A records for the zone */
+static char*
+load_test_zone(const char* name, int num)
+{
+	char* zone;
+	size_t len = 1024 + (size_t)num*64, pos;
+	int i;
+	zone = (char*)malloc(len);
+	if(!zone) fatal_exit("out of memory");
+	snprintf(zone, len, "%s.	3600	IN	SOA	ns.%s. "
+		"hostmaster.%s. 1 3600 900 86400 3600\n", name, name, name);
+	pos = strlen(zone);
+	for(i=0; i<num; i++) {
+		snprintf(zone+pos, len-pos, "h%d.%s.	3600	IN	A	"
+			"10.0.%d.%d\n", i, name, (i>>8)&0xff, i&0xff);
+		pos += strlen(zone+pos);
+	}
+	return zone;
+}
+
+/** Test authzone load of several zones with threads, and reread of
+ * a zonefile that replaces the contents of the zone */
+static void
+authzone_load_test(void)
+{
+	struct auth_zones* az;
+	struct auth_zone* z;
+	struct config_file* cfg;
+	struct config_auth* a;
+	char* fname[LOAD_TEST_ZONES];
+	char name[64];
+	char* zone;
+	int i;
+	size_t count;
+	if(vbmp) printf("Testing threaded load of auth zones\n");
+	cfg = config_create();
+	unit_assert(cfg);
+	cfg->num_threads = 4;
+	for(i=0; i<LOAD_TEST_ZONES; i++) {
+		snprintf(name, sizeof(name), "zone%d.example", i);
+		zone = load_test_zone(name, 100*(i+1));
+		fname[i] = create_tmp_file(zone);
+		free(zone);
+		a = (struct config_auth*)calloc(1, sizeof(*a));
+		unit_assert(a);
+		a->name = strdup(name);
+		a->zonefile = strdup(fname[i]);
+		unit_assert(a->name && a->zonefile);
+		a->for_downstream = 1;
+		a->next = cfg->auths;
+		cfg->auths = a;
+	}
+	az = auth_zones_create();
+	unit_assert(az);
+	unit_assert(auth_zones_apply_cfg(az, cfg, 1));
+	i = 0;
+	RBTREE_FOR(z, struct auth_zone*, &az->ztree) {
+		/* the apex and the h* names, the name is \005zoneN */
+		unit_assert(z->data.count == 1 + (size_t)100*(
+			(z->name[5]-'0')+1));
+		i++;
+	}
+	unit_assert(i == LOAD_TEST_ZONES);
+
+	/* reread replaces the zone contents */
+	z = (struct auth_zone*)az->ztree.root->key;
+	lock_rw_wrlock(&z->lock);
+	count = z->data.count;
+	unit_assert(auth_zone_write_file(z, z->zonefile));
+	dname_str(z->name, name);
+	name[strlen(name)-1] = 0; /* remove trailing dot */
+	zone = load_test_zone(name, 10);
+	{
+		FILE* out = fopen(z->zonefile, "w");
+		unit_assert(out);
+		unit_assert(fwrite(zone, 1, strlen(zone), out) ==
+			strlen(zone));
+		fclose(out);
+	}
+	free(zone);
+	unit_assert(auth_zone_read_zonefile(z));
+	unit_assert(z->data.count == 11);
+	/* a parse failure keeps the old contents */
+	{
+		FILE* out = fopen(z->zonefile, "w");
+		unit_assert(out);
+		fprintf(out, "h1.%s. 3600 IN A 10.0.0.1\nbad!\n", name);
+		fclose(out);
+	}
+	if(vbmp) printf("the parse error that follows is expected\n");
+	unit_assert(!auth_zone_read_zonefile(z));
+	unit_assert(z->data.count == 11 && count > 11);
+	lock_rw_unlock(&z->lock);
+
+	auth_zones_delete(az);
+	config_delete(cfg);
+	for(i=0; i<LOAD_TEST_ZONES; i++)
+		del_tmp_file(fname[i]);
+}
+
 /** test authzone code */
 void 
 authzone_test(void)
@@ -879,4 +984,5 @@ authzone_test(void)
 	authzone_compare_serial();
 	authzone_read_test();
 	authzone_query_test();
+	authzone_load_test();
 }
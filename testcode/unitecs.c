@@ -43,6 +43,7 @@
 
 #ifdef CLIENT_SUBNET
 
+#include <sys/time.h>
 #include "util/log.h"
 #include "util/module.h"
 #include "testcode/unitmain.h"
@@ -64,7 +65,7 @@
 
 	void print_tree(struct addrnode* node, int indent, int maxdepth)
 	{
-		struct addredge* edge;
+		struct addrnode* child;
 		int i, s, byte;
 		if (indent == 0) printf("-----Tree-----\n");
 		if (indent > maxdepth) {
@@ -73,12 +74,12 @@
 		}
 		printf("[node elem:%d] (%d)\n", node->elem != NULL, node);
 		for (i = 0; i<2; i++) {
-			if (node->edge[i]) {
+			if ((child = node->child[i])) {
 				for (s = 0; s < indent; s++) printf(" ");
-				printkey(node->edge[i]->str, node->edge[i]->len);
-				printf("(len %d bits, %d bytes) ", node->edge[i]->len, 
-					node->edge[i]->len/8 + ((node->edge[i]->len%8)>0));
-				print_tree(node->edge[i]->node, indent+1, maxdepth);
+				printkey(child->key, child->len);
+				printf("(len %d bits, %d bytes) ", child->len, 
+					child->len/8 + ((child->len%8)>0));
+				print_tree(child, indent+1, maxdepth);
 			}
 		}	
 		if (indent == 0) printf("-----Tree-----");
@@ -92,25 +93,24 @@
  * edge must be longer than parent edge
  * */
 static int addrtree_inconsistent_subtree(struct addrtree* tree, 
-	struct addredge* parent_edge, addrlen_t depth)
+	struct addrnode* node, addrlen_t depth)
 {
-	struct addredge* edge;
-	struct addrnode* node = parent_edge->node;
+	struct addrnode* child;
 	int childcount, i, r;
 	if (depth > tree->max_depth) return 15;
-	childcount = (node->edge[0] != NULL) + (node->edge[1] != NULL);
+	childcount = (node->child[0] != NULL) + (node->child[1] != NULL);
 	/* Only nodes with 2 children should possibly have no element. */
 	if (childcount < 2 && !node->elem) return 10;
 	for (i = 0; i<2; i++) {
-		edge = node->edge[i];
-		if (!edge) continue;
-		if (!edge->node) return 11;
-		if (!edge->str) return 12;
-		if (edge->len <= parent_edge->len) return 13;
-		if (!unittest_wrapper_addrtree_issub(parent_edge->str,
-				parent_edge->len, edge->str, edge->len, 0))
+		child = node->child[i];
+		if (!child) continue;
+		if (child->parent != node) return 11;
+		if (child->parent_index != i) return 12;
+		if (child->len <= node->len) return 13;
+		if (!unittest_wrapper_addrtree_issub(node->key,
+				node->len, child->key, child->len, 0))
 			return 14;
-		if ((r = addrtree_inconsistent_subtree(tree, edge, depth+1)) != 0)
+		if ((r = addrtree_inconsistent_subtree(tree, child, depth+1)) != 0)
 			return 100+r;
 	}
 	return 0;
@@ -118,23 +118,37 @@ static int addrtree_inconsistent_subtree(struct addrtree* tree,
 
 static int addrtree_inconsistent(struct addrtree* tree)
 {
-	struct addredge* edge;
+	struct addrnode* child;
 	int i, r;
 	
 	if (!tree) return 0;
 	if (!tree->root) return 1;
+	if (tree->root->parent) return 2;
 	
 	for (i = 0; i<2; i++) {
-		edge = tree->root->edge[i];
-		if (!edge) continue;
-		if (!edge->node) return 3;
-		if (!edge->str) return 4;
-		if ((r = addrtree_inconsistent_subtree(tree, edge, 1)) != 0)
+		child = tree->root->child[i];
+		if (!child) continue;
+		if (child->parent != tree->root) return 3;
+		if (child->parent_index != i) return 4;
+		if ((r = addrtree_inconsistent_subtree(tree, child, 1)) != 0)
 			return r;
 	}
 	return 0;
 }
 
+/** sum of the sizes of node and the nodes below it */
+static size_t addrtree_walk_size(struct addrnode* node)
+{
+	size_t s = sizeof(*node);
+	if (node->elem)
+		s += unittest_wrapper_subnetmod_sizefunc(node->elem);
+	if (node->child[0])
+		s += addrtree_walk_size(node->child[0]);
+	if (node->child[1])
+		s += addrtree_walk_size(node->child[1]);
+	return s;
+}
+
 static addrlen_t randomkey(addrkey_t **k, int maxlen)
 {
 	int byte;
@@ -180,6 +194,8 @@ static void consistency_test(void)
 		count = t->node_count;
 		free(k);
 		unit_assert( !addrtree_inconsistent(t) );
+		unit_assert( addrtree_size(t) ==
+			sizeof(*t) + addrtree_walk_size(t->root) );
 	}
 	addrtree_delete(t);
 
@@ -192,6 +208,8 @@ static void consistency_test(void)
 		addrtree_insert(t, k, l, 64, elem, i + 10, i);
 		free(k);
 		unit_assert( !addrtree_inconsistent(t) );
+		unit_assert( addrtree_size(t) ==
+			sizeof(*t) + addrtree_walk_size(t->root) );
 	}
 	addrtree_delete(t);
 
@@ -205,6 +223,8 @@ static void consistency_test(void)
 		unit_assert( t->node_count <= 27);
 		free(k);
 		unit_assert( !addrtree_inconsistent(t) );
+		unit_assert( addrtree_size(t) ==
+			sizeof(*t) + addrtree_walk_size(t->root) );
 	}
 	addrtree_delete(t);
 }
@@ -271,6 +291,61 @@ static void cmpbit_test(void)
 	}
 }
 
+/** number of prefixes in the lookup benchmark */
+#define ADDRTREE_PERF_NUM 10000
+/** number of lookups in the lookup benchmark */
+#define ADDRTREE_PERF_LOOKUPS 1000000
+
+static void perf_test(void)
+{
+	addrkey_t (*k)[ADDRTREE_KEYSIZE];
+	addrkey_t q[ADDRTREE_KEYSIZE];
+	struct addrtree* t;
+	struct module_env env;
+	struct reply_info *elem;
+	struct timeval start, end;
+	double dt;
+	int i, j, found = 0;
+	unit_show_func("edns-subnet/addrtree.h", "addrtree_find performance");
+	srand(4171);
+
+	k = calloc(ADDRTREE_PERF_NUM, sizeof(*k));
+	unit_assert(k);
+	t = addrtree_create(128, &elemfree, &unittest_wrapper_subnetmod_sizefunc, &env, 0);
+	unit_assert(t);
+	/* /56 scopes, like a CDN answering for IPv6 customer prefixes */
+	for (i = 0; i < ADDRTREE_PERF_NUM; i++) {
+		for (j = 0; j < 7; j++)
+			k[i][j] = (addrkey_t)(rand() & 0xFF);
+		elem = (struct reply_info *) calloc(1, sizeof(struct reply_info));
+		addrtree_insert(t, k[i], 56, 56, elem, 10, 0);
+	}
+	unit_assert( !addrtree_inconsistent(t) );
+	unit_assert( addrtree_size(t) ==
+		sizeof(*t) + addrtree_walk_size(t->root) );
+
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for (i = 0; i < ADDRTREE_PERF_LOOKUPS; i++) {
+		/* client queries with a /64 inside the cached /56 */
+		memcpy(q, k[i%ADDRTREE_PERF_NUM], sizeof(q));
+		q[7] = (addrkey_t)i;
+		if (addrtree_find(t, q, 64, 0))
+			found++;
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	unit_assert(found == ADDRTREE_PERF_LOOKUPS);
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	printf("addrtree find: did %u in %g msec for %f lookups/sec, "
+		"%u nodes in %u bytes\n", (unsigned)ADDRTREE_PERF_LOOKUPS, dt,
+		(double)ADDRTREE_PERF_LOOKUPS / (dt/1000.),
+		(unsigned)t->node_count, (unsigned)addrtree_size(t));
+	addrtree_delete(t);
+	free(k);
+}
+
 void ecs_test(void)
 {
 	unit_show_feature("ecs");
@@ -279,6 +354,7 @@ void ecs_test(void)
 	getbit_test();
 	issub_test();
 	consistency_test();
+	perf_test();
 }
 #endif /* CLIENT_SUBNET */
 
@@ -0,0 +1,251 @@
+/*
+ * testcode/unitlpm.c - unit test for the compiled address lookup.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * \file
+ * Tests the compiled longest prefix match against the address tree, and
+ * compares their speed.
+ */
+
+#include "config.h"
+#include <sys/time.h>
+#include <errno.h>
+#include "testcode/unitmain.h"
+#include "util/log.h"
+#include "util/net_help.h"
+#include "util/storage/dnstree.h"
+#include "util/storage/addrlpm.h"
+
+/** number of lookups in the speed test */
+#define LPM_SPEED_LOOKUPS 1000000
+
+/** simple random numbers, the same every run */
+static uint32_t
+lpm_rand(uint32_t* state)
+{
+	uint32_t x = *state;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	*state = x;
+	return x;
+}
+
+/** make an address from random numbers, ip6 or ip4 */
+static void
+lpm_rand_addr(uint32_t* state, int ip6, struct sockaddr_storage* addr,
+	socklen_t* addrlen)
+{
+	memset(addr, 0, sizeof(*addr));
+	if(ip6) {
+		struct sockaddr_in6* in6 = (struct sockaddr_in6*)addr;
+		uint32_t r[4];
+		int i;
+		for(i=0; i<4; i++)
+			r[i] = lpm_rand(state);
+		/* keep the first bits in a small space, so netblocks nest */
+		r[0] = 0x20010db8 ^ (r[0] & 0x1ff);
+		in6->sin6_family = AF_INET6;
+		memmove(&in6->sin6_addr, r, 16);
+		*addrlen = (socklen_t)sizeof(*in6);
+	} else {
+		struct sockaddr_in* in = (struct sockaddr_in*)addr;
+		uint32_t r = lpm_rand(state);
+		in->sin_family = AF_INET;
+		/* 10.0.0.0/12 in part, so netblocks nest */
+		if((r&1))
+			r = 0x0a000000 | (r >> 12);
+		in->sin_addr.s_addr = htonl(r);
+		*addrlen = (socklen_t)sizeof(*in);
+	}
+}
+
+/** fill the tree with random netblocks */
+static struct addr_tree_node*
+lpm_fill(rbtree_type* tree, uint32_t* state, size_t num, int minnet4,
+	int minnet6)
+{
+	struct addr_tree_node* nodes = (struct addr_tree_node*)calloc(num,
+		sizeof(*nodes));
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	size_t i;
+	int ip6, net;
+	unit_assert(nodes);
+	addr_tree_init(tree);
+	for(i=0; i<num; i++) {
+		ip6 = (lpm_rand(state)%4 == 0);
+		lpm_rand_addr(state, ip6, &addr, &addrlen);
+		if(i == 0)
+			net = 0;
+		else if(ip6)
+			net = minnet6 + (int)(lpm_rand(state)%(129-minnet6));
+		else	net = minnet4 + (int)(lpm_rand(state)%(33-minnet4));
+		addr_mask(&addr, addrlen, net);
+		(void)addr_tree_insert(tree, &nodes[i], &addr, addrlen, net);
+	}
+	addr_tree_init_parents(tree);
+	return nodes;
+}
+
+/** check that the lookups are the same as the tree */
+static void
+lpm_check(rbtree_type* tree, struct addr_lpm* lpm, uint32_t* state,
+	size_t num)
+{
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	struct addr_tree_node* node;
+	size_t i;
+	for(i=0; i<num; i++) {
+		lpm_rand_addr(state, (int)(i&1), &addr, &addrlen);
+		unit_assert(addr_lpm_lookup(lpm, &addr, addrlen) ==
+			addr_tree_lookup(tree, &addr, addrlen));
+	}
+	/* the netblocks themselves, the first and the last address */
+	RBTREE_FOR(node, struct addr_tree_node*, tree) {
+		memmove(&addr, &node->addr, node->addrlen);
+		unit_assert(addr_lpm_lookup(lpm, &addr, node->addrlen) ==
+			addr_tree_lookup(tree, &addr, node->addrlen));
+		if(addr_is_ip6(&addr, node->addrlen)) {
+			uint8_t* s = (uint8_t*)&((struct sockaddr_in6*)&addr)
+				->sin6_addr;
+			int b;
+			for(b=node->net; b<128; b++)
+				s[b/8] |= (uint8_t)(0x80 >> (b%8));
+		} else {
+			struct sockaddr_in* in = (struct sockaddr_in*)&addr;
+			if(node->net < 32)
+				in->sin_addr.s_addr |= htonl(
+					0xffffffffU >> node->net);
+		}
+		unit_assert(addr_lpm_lookup(lpm, &addr, node->addrlen) ==
+			addr_tree_lookup(tree, &addr, node->addrlen));
+	}
+}
+
+/** the time since start in msec */
+static double
+lpm_msec(struct timeval* start)
+{
+	struct timeval end;
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start->tv_sec)*1000. +
+		((double)end.tv_usec - (double)start->tv_usec)/1000.;
+}
+
+/** compare the speed of the tree and the compiled tree, with a large
+ * list of netblocks, like a response-ip block list, for unittest -b */
+static void
+lpm_speed(void)
+{
+	rbtree_type tree;
+	struct addr_tree_node* nodes;
+	struct addr_lpm* lpm;
+	struct sockaddr_storage* addrs;
+	socklen_t* addrlens;
+	struct timeval start;
+	uint32_t state = 4711;
+	size_t i, found = 0, found2 = 0;
+	double dt_tree, dt_lpm, dt_build;
+
+	nodes = lpm_fill(&tree, &state, 200000, 16, 32);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	lpm = addr_lpm_create(&tree);
+	dt_build = lpm_msec(&start);
+	unit_assert(lpm);
+	addrs = (struct sockaddr_storage*)malloc(sizeof(*addrs)*
+		LPM_SPEED_LOOKUPS);
+	addrlens = (socklen_t*)malloc(sizeof(*addrlens)*LPM_SPEED_LOOKUPS);
+	unit_assert(addrs && addrlens);
+	for(i=0; i<LPM_SPEED_LOOKUPS; i++)
+		lpm_rand_addr(&state, (i%4 == 0), &addrs[i], &addrlens[i]);
+
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<LPM_SPEED_LOOKUPS; i++)
+		if(addr_tree_lookup(&tree, &addrs[i], addrlens[i]))
+			found++;
+	dt_tree = lpm_msec(&start);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<LPM_SPEED_LOOKUPS; i++)
+		if(addr_lpm_lookup(lpm, &addrs[i], addrlens[i]))
+			found2++;
+	dt_lpm = lpm_msec(&start);
+	unit_assert(found == found2);
+	printf("addr lookup: %u netblocks, %u lookups, tree %g msec, "
+		"compiled %g msec (%g msec to compile, %u bytes)\n",
+		(unsigned)tree.count, (unsigned)LPM_SPEED_LOOKUPS, dt_tree,
+		dt_lpm, dt_build, (unsigned)addr_lpm_get_mem(lpm));
+	free(addrs);
+	free(addrlens);
+	addr_lpm_delete(lpm);
+	free(nodes);
+}
+
+void addrlpm_test(void)
+{
+	rbtree_type tree;
+	struct addr_tree_node* nodes;
+	struct addr_lpm* lpm;
+	struct sockaddr_storage addr;
+	socklen_t addrlen;
+	uint32_t state = 12345;
+	int n;
+	unit_show_feature("compiled address lookup");
+
+	/* an empty tree matches nothing */
+	addr_tree_init(&tree);
+	lpm = addr_lpm_create(&tree);
+	unit_assert(lpm);
+	unit_assert(ipstrtoaddr("192.0.2.1", 0, &addr, &addrlen));
+	unit_assert(addr_lpm_lookup(lpm, &addr, addrlen) == NULL);
+	addr_lpm_delete(lpm);
+
+	/* small and large netblock sizes, that nest */
+	for(n=0; n<4; n++) {
+		nodes = lpm_fill(&tree, &state, 50+(size_t)n*1000,
+			n*8, n*32);
+		lpm = addr_lpm_create(&tree);
+		unit_assert(lpm);
+		lpm_check(&tree, lpm, &state, 10000);
+		addr_lpm_delete(lpm);
+		free(nodes);
+	}
+	if(unit_bench)
+		lpm_speed();
+}
@@ -68,6 +68,8 @@
 
 /** number of tests done */
 int testcount = 0;
+/** if the timed benchmarks are run */
+int unit_bench = 0;
 
 #include "util/alloc.h"
 /** test alloc code */
@@ -108,6 +110,436 @@ alloc_test(void) {
 	alloc_clear(&major);
 }
 
+#include <sys/time.h>
+#include "util/slaballoc.h"
+#include "util/random.h"
+/** number of live objects in the slab churn test */
+#define SLAB_TEST_NUM 100000
+/** number of replacements in the slab churn benchmark */
+#define SLAB_TEST_CHURN 2000000
+/** number of replacements in the slab churn check */
+#define SLAB_TEST_CHURN_CHECK 200000
+/** object size for the slab churn test, like rrset data and names */
+static size_t
+slab_test_size(struct ub_randstate* rnd)
+{
+	if(ub_random_max(rnd, 2) == 0)
+		return 8 + ub_random_max(rnd, 40); /* owner name */
+	return 80 + ub_random_max(rnd, 600); /* rrset data */
+}
+
+/** replace objects at random, with two threads, with unittest -b it is
+ * timed */
+static void
+slab_churn(struct slab_cache* sc1, struct slab_cache* sc2, void** obj,
+	size_t* sz, size_t* ck, size_t* csz, size_t churn, const char* desc)
+{
+	struct timeval start, end;
+	double dt;
+	size_t i, k;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<churn; i++) {
+		k = ck[i];
+		/* freed by the other thread */
+		slab_free((i&1)?sc2:sc1, obj[k], sz[k]);
+		sz[k] = csz[i];
+		obj[k] = slab_alloc((i&1)?sc1:sc2, sz[k]);
+		unit_assert(obj[k]);
+		((uint8_t*)obj[k])[0] = (uint8_t)(k&0xff);
+		((uint8_t*)obj[k])[sz[k]-1] = (uint8_t)(k&0xff);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(unit_bench)
+		printf("slab churn %s: %u replaced in %g msec, %g/sec\n",
+			desc, (unsigned)churn, dt, (double)churn/(dt/1000.));
+}
+
+/** test slab allocator */
+static void
+slab_test(void)
+{
+	struct slab_depot* d;
+	struct slab_cache sc1, sc2, shared, plain;
+	struct slab_class_stats st[SLAB_CLASSES];
+	struct ub_randstate* rnd = ub_initstate(1234, NULL);
+	size_t churn = unit_bench?SLAB_TEST_CHURN:SLAB_TEST_CHURN_CHECK;
+	void** obj = (void**)calloc(SLAB_TEST_NUM, sizeof(void*));
+	size_t* sz = (size_t*)calloc(SLAB_TEST_NUM, sizeof(size_t));
+	size_t* ck = (size_t*)calloc(churn, sizeof(size_t));
+	size_t* csz = (size_t*)calloc(churn, sizeof(size_t));
+	size_t i, used, mem, req;
+	int c;
+	unit_show_feature("slab allocator");
+	unit_assert(rnd && obj && sz && ck && csz);
+	for(i=0; i<churn; i++) {
+		ck[i] = (size_t)ub_random_max(rnd, SLAB_TEST_NUM);
+		csz[i] = slab_test_size(rnd);
+	}
+	unit_assert(slab_obj_size(1) == 16);
+	unit_assert(slab_obj_size(128) == 128);
+	unit_assert(slab_obj_size(129) == 160);
+	unit_assert(slab_obj_size(257) == 320);
+	unit_assert(slab_obj_size(SLAB_OBJ_MAX) == SLAB_OBJ_MAX);
+	unit_assert(slab_obj_size(SLAB_OBJ_MAX+1) == SLAB_OBJ_MAX+1);
+	for(i=1; i<=SLAB_OBJ_MAX; i++)
+		unit_assert(slab_obj_size(i) >= i && slab_obj_size(i) < i+i/4+16);
+
+	d = slab_depot_create();
+	unit_assert(d);
+	slab_cache_init(&sc1, d, 0);
+	slab_cache_init(&sc2, d, 0);
+	slab_cache_init(&shared, d, 1);
+	slab_cache_init(&plain, NULL, 0);
+
+	/* fill, with some too large for the slabs */
+	for(i=0; i<SLAB_TEST_NUM; i++) {
+		sz[i] = (i%1000==0)?SLAB_OBJ_MAX+100:slab_test_size(rnd);
+		obj[i] = slab_alloc((i&1)?&sc1:&shared, sz[i]);
+		unit_assert(obj[i]);
+		memset(obj[i], (int)(i&0xff), sz[i]);
+	}
+	slab_churn(&sc1, &sc2, obj, sz, ck, csz, churn, "slabs");
+	/* the objects are not overwritten by other objects */
+	for(i=0; i<SLAB_TEST_NUM; i++) {
+		unit_assert(((uint8_t*)obj[i])[0] == (uint8_t)(i&0xff));
+		unit_assert(((uint8_t*)obj[i])[sz[i]-1] == (uint8_t)(i&0xff));
+	}
+	/* the slabs hold the objects and the free objects, and the memory
+	 * is close to the rounded up size of the objects */
+	slab_depot_stats(d, st);
+	used = 0;
+	mem = 0;
+	req = 0;
+	for(i=0; i<SLAB_TEST_NUM; i++)
+		if(sz[i] <= SLAB_OBJ_MAX)
+			req += slab_obj_size(sz[i]);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		unit_assert(st[c].objects >= st[c].free_slab + st[c].free_mag);
+		used += (st[c].objects - st[c].free_slab - st[c].free_mag) *
+			st[c].size;
+		mem += st[c].slabs * SLAB_SIZE;
+	}
+	unit_assert(used >= req);
+	printf("slab memory %u used %u objects %u fragmentation %.2f%%\n",
+		(unsigned)mem, (unsigned)used, (unsigned)req,
+		100.0*(double)(mem-req)/(double)mem);
+	unit_assert(mem < req + req/4);
+
+	/* free all, the slabs are released */
+	for(i=0; i<SLAB_TEST_NUM; i++)
+		slab_free((i&1)?&shared:&sc2, obj[i], sz[i]);
+	slab_cache_clear(&sc1);
+	slab_cache_clear(&sc2);
+	slab_depot_stats(d, st);
+	used = 0;
+	for(c=0; c<SLAB_CLASSES; c++) {
+		unit_assert(st[c].free_mag == 0);
+		unit_assert(st[c].objects == st[c].free_slab);
+		unit_assert(st[c].slabs <= 1);
+		used += st[c].slabs * SLAB_SIZE;
+	}
+	unit_assert(used < mem/10);
+	unit_assert(slab_depot_get_mem(d) >= used);
+
+	/* the same with malloc and free */
+	for(i=0; i<SLAB_TEST_NUM; i++) {
+		obj[i] = slab_alloc(&plain, sz[i]);
+		unit_assert(obj[i]);
+	}
+	slab_churn(&plain, &plain, obj, sz, ck, csz, churn, "malloc");
+	for(i=0; i<SLAB_TEST_NUM; i++)
+		slab_free(&plain, obj[i], sz[i]);
+
+	slab_depot_delete(d);
+	ub_randfree(rnd);
+	free(obj);
+	free(sz);
+	free(ck);
+	free(csz);
+}
+
+#include "util/hugepage.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/rrset.h"
+#include "util/data/packed_rrset.h"
+#include "util/data/msgreply.h"
+#include "util/config_file.h"
+#include "sldns/sbuffer.h"
+/** number of rrsets in the huge page lookup benchmark */
+#define HUGEPAGE_TEST_NUM 500000
+/** number of lookups in the huge page lookup benchmark */
+#define HUGEPAGE_TEST_LOOKUPS 1000000
+/** number of rrsets in the huge page check, in one slab it is enough
+ * to grow the bin array past HUGEPAGE_SIZE */
+#define HUGEPAGE_CHECK_NUM 70000
+
+/** make the owner name for rrset i of the lookup benchmark */
+static size_t
+hugepage_test_name(uint8_t* nm, size_t i)
+{
+	int n = snprintf((char*)nm+1, 32, "h%u", (unsigned)i);
+	nm[0] = (uint8_t)n;
+	memmove(nm+n+1, "\007example\003com\000", 13);
+	return (size_t)n+1+13;
+}
+
+/** fill a rrset cache with A records and look them up, if look is
+ * NULL every rrset is looked up once, otherwise the lookups are timed */
+static void
+hugepage_lookup(int huge, size_t num, size_t* look, size_t lookups)
+{
+	struct alloc_cache super, alloc;
+	struct config_file* cfg = config_create();
+	struct rrset_cache* r;
+	struct ub_packed_rrset_key k, *e;
+	struct packed_rrset_data* d;
+	struct timeval start, end;
+	uint8_t nm[64];
+	size_t i, asize = 0, aused = 0, found = 0;
+	int type = HUGEPAGE_NONE;
+	double dt;
+	unit_assert(cfg);
+	if(look) {
+		cfg->rrset_cache_size = 256*1024*1024;
+	} else {
+		cfg->rrset_cache_size = 32*1024*1024;
+		cfg->rrset_cache_slabs = 1;
+	}
+	alloc_init(&super, NULL, 0);
+	alloc_init(&alloc, &super, 1);
+	r = rrset_cache_create(cfg, &alloc);
+	unit_assert(r);
+	if(huge) {
+		slabhash_set_hugepage(&r->table, 1);
+		if(!slab_depot_set_arena(super.depot, cfg->rrset_cache_size)) {
+			printf("hugepage lookup: no huge pages available\n");
+			rrset_cache_delete(r);
+			alloc_clear(&alloc);
+			alloc_clear(&super);
+			config_delete(cfg);
+			return;
+		}
+	}
+
+	/* one A record, the copy into the cache fixes up the pointers */
+	d = (struct packed_rrset_data*)calloc(1, sizeof(*d) +
+		sizeof(size_t) + sizeof(uint8_t*) + sizeof(time_t) + 6);
+	unit_assert(d);
+	d->ttl = 3600;
+	d->count = 1;
+	d->trust = rrset_trust_ans_noAA;
+	d->security = sec_status_unchecked;
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	d->rr_len[0] = 6;
+	packed_rrset_ptr_fixup(d);
+	d->rr_ttl[0] = 3600;
+	sldns_write_uint16(d->rr_data[0], 4);
+	memset(&k, 0, sizeof(k));
+	k.entry.key = &k;
+	k.entry.data = d;
+	k.rk.dname = nm;
+	k.rk.type = htons(LDNS_RR_TYPE_A);
+	k.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	for(i=0; i<num; i++) {
+		struct rrset_ref ref;
+		k.rk.dname_len = hugepage_test_name(nm, i);
+		k.entry.hash = rrset_key_hash(&k.rk);
+		sldns_write_uint32(d->rr_data[0]+2, (uint32_t)i);
+		ref.key = &k;
+		ref.id = 0;
+		unit_assert(rrset_cache_update_copy(r, &ref, &alloc, 0, 0)
+			== 0);
+	}
+
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<lookups; i++) {
+		size_t n = look?look[i]:i;
+		size_t len = hugepage_test_name(nm, n);
+		if((e=rrset_cache_lookup(r, nm, len, LDNS_RR_TYPE_A,
+			LDNS_RR_CLASS_IN, 0, 0, 0)) != NULL) {
+			if(sldns_read_uint32(((struct packed_rrset_data*)e->
+				entry.data)->rr_data[0]+2) == (uint32_t)n)
+				found++;
+			lock_rw_unlock(&e->entry.lock);
+		}
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	unit_assert(found == lookups);
+	slab_depot_hugepage(super.depot, &asize, &aused, &type);
+	if(look)
+		printf("hugepage lookup %s: %u lookups in %g msec, %g "
+			"ns/lookup, arena %u used %u, bins %u\n",
+			hugepage_type_str(type), (unsigned)lookups, dt,
+			dt*1000000./(double)lookups, (unsigned)asize,
+			(unsigned)aused,
+			(unsigned)slabhash_get_hugepage_mem(&r->table));
+	if(huge) {
+		unit_assert(aused > 0 && aused <= asize);
+		unit_assert(slabhash_get_hugepage_mem(&r->table) > 0);
+	} else {
+		unit_assert(asize == 0 && aused == 0);
+		unit_assert(slabhash_get_hugepage_mem(&r->table) == 0);
+	}
+
+	rrset_cache_delete(r);
+	alloc_clear(&alloc);
+	alloc_clear(&super);
+	free(d);
+	config_delete(cfg);
+}
+
+/** test huge page arenas, and cache lookups with and without them */
+static void
+hugepage_test(void)
+{
+	struct hugepage_arena* a;
+	size_t i, n;
+	uint8_t* p;
+	void* c[64];
+	int type;
+	unit_show_feature("huge pages");
+
+	/* large arrays are zeroed, with or without huge pages */
+	p = (uint8_t*)hugepage_calloc(2*HUGEPAGE_SIZE, &type);
+	unit_assert(p);
+	for(i=0; i<2*HUGEPAGE_SIZE; i+=4096)
+		unit_assert(p[i] == 0);
+	p[2*HUGEPAGE_SIZE-1] = 1;
+	hugepage_free(p, 2*HUGEPAGE_SIZE, type);
+	p = (uint8_t*)hugepage_calloc(1024, &type);
+	unit_assert(p && type == HUGEPAGE_NONE);
+	hugepage_free(p, 1024, type);
+
+	/* the arena hands out aligned chunks until it is full */
+	a = hugepage_arena_create(1, SLAB_SIZE);
+	if(a) {
+		n = HUGEPAGE_SIZE/SLAB_SIZE;
+		unit_assert(a->size == HUGEPAGE_SIZE && n <= 64);
+		for(i=0; i<n; i++) {
+			c[i] = hugepage_arena_alloc(a);
+			unit_assert(c[i]);
+			unit_assert(((size_t)c[i] & (SLAB_SIZE-1)) == 0);
+		}
+		unit_assert(hugepage_arena_alloc(a) == NULL);
+		unit_assert(hugepage_arena_get_used(a) == HUGEPAGE_SIZE);
+		unit_assert(!hugepage_arena_free(a, &n));
+		unit_assert(hugepage_arena_free(a, c[3]));
+		unit_assert(hugepage_arena_alloc(a) == c[3]);
+		for(i=0; i<n; i++)
+			unit_assert(hugepage_arena_free(a, c[i]));
+		unit_assert(hugepage_arena_get_used(a) == 0);
+		hugepage_arena_delete(a);
+	}
+
+	hugepage_lookup(0, HUGEPAGE_CHECK_NUM, NULL, HUGEPAGE_CHECK_NUM);
+	hugepage_lookup(1, HUGEPAGE_CHECK_NUM, NULL, HUGEPAGE_CHECK_NUM);
+	if(unit_bench) {
+		struct ub_randstate* rnd = ub_initstate(4321, NULL);
+		size_t* look = (size_t*)calloc(HUGEPAGE_TEST_LOOKUPS,
+			sizeof(size_t));
+		unit_assert(rnd && look);
+		for(i=0; i<HUGEPAGE_TEST_LOOKUPS; i++)
+			look[i] = (size_t)ub_random_max(rnd, HUGEPAGE_TEST_NUM);
+		hugepage_lookup(0, HUGEPAGE_TEST_NUM, look,
+			HUGEPAGE_TEST_LOOKUPS);
+		hugepage_lookup(1, HUGEPAGE_TEST_NUM, look,
+			HUGEPAGE_TEST_LOOKUPS);
+		ub_randfree(rnd);
+		free(look);
+	}
+}
+
+/** number of rrsets per shape in the cache memory test */
+#define RRSET_MEM_TEST_NUM 10000
+
+/** store rrsets of one shape in a cache, return the memory per entry */
+static size_t
+rrset_mem_shape(size_t count, size_t rdlen, size_t* data)
+{
+	struct alloc_cache super, alloc;
+	struct rrset_cache* r;
+	struct ub_packed_rrset_key k;
+	struct packed_rrset_data* d;
+	uint8_t nm[64];
+	size_t i, used = 0;
+	alloc_init(&super, NULL, 0);
+	alloc_init(&alloc, &super, 1);
+	r = rrset_cache_create(NULL, &alloc);
+	unit_assert(r);
+	d = (struct packed_rrset_data*)calloc(1, sizeof(*d) + count*(
+		sizeof(size_t) + sizeof(uint8_t*) + sizeof(time_t) + 2 +
+		rdlen));
+	unit_assert(d);
+	d->ttl = 3600;
+	d->count = (uint32_t)count;
+	d->trust = rrset_trust_ans_noAA;
+	d->security = sec_status_unchecked;
+	d->rr_len = (size_t*)((uint8_t*)d + sizeof(*d));
+	for(i=0; i<count; i++)
+		d->rr_len[i] = 2 + rdlen;
+	packed_rrset_ptr_fixup(d);
+	for(i=0; i<count; i++) {
+		d->rr_ttl[i] = 3600;
+		sldns_write_uint16(d->rr_data[i], (uint16_t)rdlen);
+		memset(d->rr_data[i]+2, (int)i, rdlen);
+	}
+	*data = packed_rrset_sizeof(d);
+	memset(&k, 0, sizeof(k));
+	k.entry.key = &k;
+	k.entry.data = d;
+	k.rk.dname = nm;
+	k.rk.type = htons(LDNS_RR_TYPE_A);
+	k.rk.rrset_class = htons(LDNS_RR_CLASS_IN);
+	for(i=0; i<RRSET_MEM_TEST_NUM; i++) {
+		struct rrset_ref ref;
+		k.rk.dname_len = hugepage_test_name(nm, i);
+		k.entry.hash = rrset_key_hash(&k.rk);
+		ref.key = &k;
+		ref.id = 0;
+		unit_assert(rrset_cache_update_copy(r, &ref, &alloc, 0, 0)
+			== 0);
+	}
+	for(i=0; i<r->table.size; i++)
+		used += r->table.array[i]->space_used;
+	rrset_cache_delete(r);
+	alloc_clear(&alloc);
+	alloc_clear(&super);
+	free(d);
+	return used / RRSET_MEM_TEST_NUM;
+}
+
+/** test the memory per entry in the rrset cache for small rrsets */
+static void
+rrset_mem_test(void)
+{
+	/* one and two A, one AAAA, NS rrsets with 20 byte names */
+	size_t count[] = {1, 2, 1, 2, 4};
+	size_t rdlen[] = {4, 4, 16, 20, 20};
+	size_t i, entry, data, wide;
+	unit_show_feature("rrset cache memory");
+	for(i=0; i<sizeof(count)/sizeof(count[0]); i++) {
+		entry = rrset_mem_shape(count[i], rdlen[i], &data);
+		/* with 64 bit counts the header is 8 bytes longer */
+		wide = entry - slab_obj_size(data) + slab_obj_size(data+8);
+		printf("rrset cache memory %u rr rdata %u: %u bytes/entry, "
+			"data %u, with 64 bit counts %u bytes/entry\n",
+			(unsigned)count[i], (unsigned)rdlen[i],
+			(unsigned)entry, (unsigned)data, (unsigned)wide);
+		unit_assert(entry <= wide);
+	}
+	/* a single A record fits in the 80 byte size class */
+	unit_assert(sizeof(struct packed_rrset_data) + sizeof(size_t) +
+		sizeof(uint8_t*) + sizeof(time_t) + 6 <= 80);
+}
+
 #include "util/net_help.h"
 /** test net code */
 static void 
@@ -404,6 +836,7 @@ config_tag_test(void)
 	
 #include "util/rtt.h"
 #include "util/timehist.h"
+#include "util/module.h"
 #include "libunbound/unbound.h"
 /** test RTT code */
 static void
@@ -432,6 +865,48 @@ rtt_test(void)
 	unit_assert(UB_STATS_BUCKET_NUM == NUM_BUCKETS_HIST);
 }
 
+/** test log-linear latency histogram */
+static void
+lathist_test(void)
+{
+	long long a[NUM_BUCKETS_LATHIST];
+	unsigned long long v;
+	size_t i;
+	struct timeval tv;
+	double q;
+	unit_show_func("util/timehist.c", "lathist_bucket");
+	unit_assert(UB_STATS_LAT_NUM == NUM_BUCKETS_LATHIST);
+	unit_assert(UB_STATS_MODSTATE_NUM == module_finished+1);
+	/* buckets are contiguous and contain their lower bound */
+	for(i=0; i+1<NUM_BUCKETS_LATHIST; i++) {
+		unit_assert(lathist_lower(i) < lathist_lower(i+1));
+		unit_assert(lathist_bucket(lathist_lower(i)) == i);
+		unit_assert(lathist_bucket(lathist_lower(i+1)-1) == i);
+	}
+	/* values within 12.5% of the bucket bound */
+	for(v=16; v<100000000; v = v*3+1) {
+		i = lathist_bucket(v);
+		unit_assert(lathist_lower(i) <= v);
+		unit_assert(v - lathist_lower(i) <= v/8);
+	}
+	unit_assert(lathist_bucket(0xffffffffffffULL) ==
+		NUM_BUCKETS_LATHIST-1);
+
+	unit_show_func("util/timehist.c", "lathist_quantile");
+	memset(a, 0, sizeof(a));
+	unit_assert(lathist_quantile(a, 0.5) == 0.);
+	tv.tv_sec = 0;
+	for(i=1; i<=1000; i++) {
+		tv.tv_usec = (long)i*100;
+		lathist_insert(a, &tv);
+	}
+	unit_assert(lathist_count(a) == 1000);
+	q = lathist_quantile(a, 0.5);
+	unit_assert(q > 0.050*0.875 && q < 0.050*1.125);
+	q = lathist_quantile(a, 0.99);
+	unit_assert(q > 0.099*0.875 && q < 0.099*1.125);
+}
+
 #include "services/cache/infra.h"
 
 /* lookup and get key and data structs easily */
@@ -529,6 +1004,236 @@ infra_test(void)
 	config_delete(cfg);
 }
 
+#include "util/storage/ratesketch.h"
+#include "util/netevent.h"
+#include <sys/time.h>
+#include <errno.h>
+/** number of source addresses in the ip ratelimit flood benchmark */
+#define RATELIMIT_FLOOD_NUM 1000000
+/** number of source addresses in the ip ratelimit flood check */
+#define RATELIMIT_FLOOD_CHECK 20000
+
+/** set the comm_reply to an IPv4 address */
+static void
+ratelimit_addr(struct comm_reply* rep, uint32_t a)
+{
+	struct sockaddr_in* in = (struct sockaddr_in*)&rep->addr;
+	memset(rep, 0, sizeof(*rep));
+	in->sin_family = AF_INET;
+	in->sin_addr.s_addr = htonl(a);
+	rep->addrlen = (socklen_t)sizeof(*in);
+}
+
+/** flood the ip ratelimit with queries from different addresses, the
+ * sketch does not grow; with unittest -b it is timed */
+static void
+ratelimit_flood_test(struct config_file* cfg, int sketch)
+{
+	struct infra_cache* infra;
+	struct comm_reply rep;
+	struct timeval start, end;
+	double dt;
+	uint32_t i, num = unit_bench?RATELIMIT_FLOOD_NUM:RATELIMIT_FLOOD_CHECK;
+	size_t mem;
+	cfg->ip_ratelimit_sketch = sketch;
+	infra = infra_create(cfg);
+	unit_assert(infra);
+	mem = infra_get_mem(infra);
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<num; i++) {
+		ratelimit_addr(&rep, 0x0a000000 + i);
+		/* 100k addresses per second */
+		(void)infra_ip_ratelimit_inc(infra, &rep,
+			(time_t)(1000 + i/100000));
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(unit_bench)
+		printf("ip ratelimit %s: %u addresses in %g msec for %f "
+			"queries/sec, %u bytes\n", sketch?"sketch":"cache",
+			(unsigned)num, dt, (double)num / (dt/1000.),
+			(unsigned)infra_get_mem(infra));
+	if(sketch)
+		unit_assert(infra_get_mem(infra) == mem);
+	else	unit_assert(infra_get_mem(infra) > mem);
+	infra_delete(infra);
+}
+
+/** test the rate sketch and the ip ratelimit with it */
+static void
+ratelimit_test(void)
+{
+	struct config_file* cfg = config_create();
+	struct infra_cache* infra;
+	struct rate_sketch* sk;
+	struct comm_reply one, two;
+	int i, j, premax;
+	unit_show_feature("ip ratelimit sketch");
+
+	/* a single key is counted exactly */
+	sk = rate_sketch_create(1, 0);
+	unit_assert(sk && sk->width == RATE_SKETCH_MIN_WIDTH);
+	for(i=0; i<5; i++)
+		unit_assert(rate_sketch_inc(sk, 12345, 100, &premax) == i+1
+			&& premax == i);
+	unit_assert(rate_sketch_get(sk, 12345, 100) == 5);
+	/* the previous second is remembered, then forgotten */
+	unit_assert(rate_sketch_get(sk, 12345, 101) == 5);
+	unit_assert(rate_sketch_inc(sk, 12345, 101, NULL) == 5);
+	unit_assert(rate_sketch_get(sk, 12345, 102) == 1);
+	unit_assert(rate_sketch_get(sk, 12345, 104) == 0);
+	rate_sketch_delete(sk);
+
+	/* more keys than counters, the counts are never too low */
+	sk = rate_sketch_create(2, 0);
+	unit_assert(sk);
+	for(i=0; i<1000; i++)
+		for(j=0; j<=i%7; j++)
+			(void)rate_sketch_inc(sk, (hashvalue_type)i*2654435761U,
+				100, NULL);
+	for(i=0; i<1000; i++)
+		unit_assert(rate_sketch_get(sk, (hashvalue_type)i*2654435761U,
+			100) >= i%7+1);
+	rate_sketch_delete(sk);
+
+	/* ten queries per second are allowed for an address */
+	cfg->ip_ratelimit = 10;
+	cfg->ip_ratelimit_sketch = 1;
+	infra = infra_create(cfg);
+	unit_assert(infra && infra->client_ip_sketch && !infra->client_ip_rates);
+	ratelimit_addr(&one, 0x7f000001);
+	ratelimit_addr(&two, 0x7f000002);
+	for(i=0; i<10; i++)
+		unit_assert(infra_ip_ratelimit_inc(infra, &one, 100));
+	unit_assert(!infra_ip_ratelimit_inc(infra, &one, 100));
+	unit_assert(infra_ip_ratelimit_inc(infra, &two, 100));
+	unit_assert(!infra_ip_ratelimit_inc(infra, &one, 101));
+	unit_assert(infra_ip_ratelimit_inc(infra, &one, 104));
+	infra_delete(infra);
+
+	ratelimit_flood_test(cfg, 0);
+	ratelimit_flood_test(cfg, 1);
+	config_delete(cfg);
+	infra_ip_ratelimit = 0;
+}
+
+#include "util/storage/topk.h"
+/** number of updates for the top-K speed test */
+#define TOPK_SPEED_NUM 1000000
+
+/** check that the entries are in the table and in heap order */
+static void
+topk_check(struct topk* t)
+{
+	size_t i, n = t->num;
+	for(i=0; i<t->num; i++) {
+		struct topk_entry* e = &t->entries[t->heap[i]];
+		unit_assert(e->heap == i);
+		if(i > 0)
+			unit_assert(e->count >=
+				t->entries[t->heap[(i-1)/2]].count);
+		/* a count of 0 for a tracked key changes nothing */
+		topk_add(t, e->key, e->len, 0, 0);
+		unit_assert(t->num == n && e->heap == i);
+	}
+}
+
+/** count a number as key */
+static void
+topk_addnum(struct topk* t, uint32_t k, long long count)
+{
+	topk_add(t, (uint8_t*)&k, sizeof(k), count, 0);
+}
+
+/** test the top-K tracker */
+static void
+topk_test(void)
+{
+	struct topk* t, *t2, *m;
+	struct topk_entry* list[512];
+	struct timeval start, end;
+	double dt;
+	uint32_t i, j;
+	size_t n;
+	unit_show_feature("topk");
+
+	/* when it fits, the counts are exact */
+	t = topk_create(8);
+	unit_assert(t);
+	for(i=0; i<8; i++)
+		topk_addnum(t, i, (long long)(i*10+1));
+	for(i=0; i<8; i++)
+		topk_addnum(t, i, 1);
+	topk_check(t);
+	n = topk_sorted(t, list);
+	unit_assert(n == 8);
+	for(i=0; i<8; i++)
+		unit_assert(list[i]->count == (long long)((7-i)*10+2) &&
+			list[i]->err == 0);
+	/* a new key takes the place of the lowest */
+	topk_addnum(t, 100, 1);
+	topk_check(t);
+	n = topk_sorted(t, list);
+	unit_assert(n == 8 && list[7]->count == 3 && list[7]->err == 2 &&
+		*(uint32_t*)list[7]->key == 100);
+	topk_clear(t);
+	unit_assert(topk_sorted(t, list) == 0);
+	topk_delete(t);
+
+	/* heavy keys in a stream of keys that are seen once, with more than
+	 * N/K the key is tracked */
+	t = topk_create(256);
+	unit_assert(t);
+	for(i=0; i<100000; i++) {
+		topk_addnum(t, 1000000+i, 1);
+		if(i%100 == 0)
+			for(j=0; j<50; j++)
+				topk_addnum(t, j, 1);
+	}
+	topk_check(t);
+	n = topk_sorted(t, list);
+	for(j=0; j<50; j++) {
+		unit_assert(*(uint32_t*)list[j]->key < 50);
+		unit_assert(list[j]->count >= 1000 &&
+			list[j]->count - list[j]->err <= 1000);
+	}
+
+	/* merge two threads */
+	t2 = topk_create(128);
+	m = topk_create(384);
+	unit_assert(t2 && m);
+	for(i=0; i<20000; i++)
+		topk_addnum(t2, i%10, 1);
+	topk_merge(m, t);
+	topk_merge(m, t2);
+	topk_check(m);
+	n = topk_sorted(m, list);
+	unit_assert(n == 256);
+	for(j=0; j<10; j++)
+		unit_assert(*(uint32_t*)list[j]->key < 10 &&
+			list[j]->count >= 3000);
+	topk_delete(m);
+	topk_delete(t2);
+
+	/* speed of updates, with a few heavy keys */
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<TOPK_SPEED_NUM; i++)
+		topk_addnum(t, (i&1)?(i%32):i, 1);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	printf("topk: %u updates in %g msec for %f updates/sec, %u bytes\n",
+		(unsigned)TOPK_SPEED_NUM, dt,
+		(double)TOPK_SPEED_NUM / (dt/1000.),
+		(unsigned)topk_get_mem(t));
+	topk_delete(t);
+}
+
 #include "util/random.h"
 /** test randomness */
 static void
@@ -863,9 +1568,12 @@ int
 main(int argc, char* argv[])
 {
 	log_init(NULL, 0, NULL);
-	if(argc != 1) {
-		printf("usage: %s\n", argv[0]);
+	if(argc == 2 && strcmp(argv[1], "-b") == 0) {
+		unit_bench = 1;
+	} else if(argc != 1) {
+		printf("usage: %s [-b]\n", argv[0]);
 		printf("\tperforms unit tests.\n");
+		printf("\t-b also runs the timed benchmarks.\n");
 		return 1;
 	}
 	printf("Start of %s unit test.\n", PACKAGE_STRING);
@@ -894,14 +1602,22 @@ main(int argc, char* argv[])
 	config_tag_test();
 	dname_test();
 	rtt_test();
+	lathist_test();
 	anchors_test();
 	alloc_test();
+	slab_test();
+	hugepage_test();
+	rrset_mem_test();
 	regional_test();
 	lruhash_test();
 	slabhash_test();
 	infra_test();
+	ratelimit_test();
+	topk_test();
+	addrlpm_test();
 	ldns_test();
 	msgparse_test();
+	mesh_test();
 #ifdef CLIENT_SUBNET
 	ecs_test();
 #endif /* CLIENT_SUBNET */
@@ -44,6 +44,8 @@
 
 /** number of tests done */
 extern int testcount;
+/** if the timed benchmarks are run, with unittest -b */
+extern int unit_bench;
 /** test bool x, exits on failure, increases testcount. */
 #ifdef DEBUG_UNBOUND
 #define unit_assert(x) do {testcount++; log_assert(x);} while(0)
@@ -80,5 +82,9 @@ void ecs_test(void);
 void ldns_test(void);
 /** unit test for auth zone functions */
 void authzone_test(void);
+/** unit test for the compiled address lookup */
+void addrlpm_test(void);
+/** unit test for mesh state allocation */
+void mesh_test(void);
 
 #endif /* TESTCODE_UNITMAIN_H */
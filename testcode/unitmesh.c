@@ -0,0 +1,404 @@
+/*
+ * testcode/unitmesh.c - unit test for mesh state allocation.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * \file
+ * Tests the mesh state allocation, and the alloc fixed size object cache
+ * it uses. Also performance tests mesh state creation and teardown, and
+ * tests the per module statistics of the mesh.
+ */
+
+#include "config.h"
+#include <sys/time.h>
+#include "testcode/unitmain.h"
+#include "util/log.h"
+#include "util/alloc.h"
+#include "util/module.h"
+#include "util/regional.h"
+#include "util/config_file.h"
+#include "util/netevent.h"
+#include "util/timehist.h"
+#include "util/data/msgreply.h"
+#include "services/mesh.h"
+#include "services/modstack.h"
+#include "sldns/rrdef.h"
+#include "util/net_help.h"
+
+/** test the fixed size object cache of the alloc */
+static void
+alloc_obj_test(void)
+{
+	struct alloc_cache super, alloc;
+	void* a, *b, *c;
+	unit_show_func("util/alloc.c", "alloc_obj_obtain");
+	alloc_init(&super, NULL, 0);
+	alloc_init(&alloc, &super, 1);
+
+	a = alloc_obj_obtain(&alloc, 100);
+	b = alloc_obj_obtain(&alloc, 100);
+	unit_assert(a && b && a != b);
+	unit_assert(alloc.obj_malloced == 2 && alloc.obj_reused == 0);
+	alloc_obj_release(&alloc, a, 100);
+	/* same size class is reused */
+	c = alloc_obj_obtain(&alloc, 120);
+	unit_assert(c == a);
+	unit_assert(alloc.obj_reused == 1);
+	/* other size class is not */
+	alloc_obj_release(&alloc, b, 100);
+	a = alloc_obj_obtain(&alloc, 10);
+	unit_assert(a != b);
+	unit_assert(alloc.obj_malloced == 3);
+	alloc_obj_release(&alloc, a, 10);
+	alloc_obj_release(&alloc, c, 120);
+	unit_assert(alloc.obj_num[0] == 1 && alloc.obj_num[1] == 2);
+
+	/* large objects are not cached */
+	a = alloc_obj_obtain(&alloc, ALLOC_OBJ_GRAIN*ALLOC_OBJ_CLASSES+1);
+	unit_assert(a);
+	alloc_obj_release(&alloc, a, ALLOC_OBJ_GRAIN*ALLOC_OBJ_CLASSES+1);
+	unit_assert(alloc.obj_freed == 1);
+
+	/* freelist limit */
+	alloc.max_obj = 2;
+	a = alloc_obj_obtain(&alloc, 10);
+	b = alloc_obj_obtain(&alloc, 10);
+	c = alloc_obj_obtain(&alloc, 10);
+	alloc_obj_release(&alloc, a, 10);
+	alloc_obj_release(&alloc, b, 10);
+	alloc_obj_release(&alloc, c, 10);
+	unit_assert(alloc.obj_num[0] == 2);
+	unit_assert(alloc.obj_freed == 2);
+
+	alloc_clear(&alloc);
+	unit_assert(alloc.obj_num[0] == 0 && alloc.obj_list[0] == NULL);
+	alloc_clear(&super);
+}
+
+/** mesh test setup, a mesh with an optional module stack */
+struct mesh_test {
+	/** config */
+	struct config_file* cfg;
+	/** module env */
+	struct module_env env;
+	/** the thread alloc */
+	struct alloc_cache alloc;
+	/** super alloc */
+	struct alloc_cache superalloc;
+	/** module stack, empty if no modules are set up */
+	struct module_stack mods;
+	/** time */
+	struct timeval now_tv;
+	/** udp comm point for replies */
+	struct comm_point c;
+};
+
+/** setup the mesh test, with the module-config string, or NULL for no
+ * modules */
+static void
+mesh_test_setup(struct mesh_test* t, const char* modules)
+{
+	memset(t, 0, sizeof(*t));
+	t->cfg = config_create();
+	unit_assert(t->cfg);
+	alloc_init(&t->superalloc, NULL, 0);
+	alloc_init(&t->alloc, &t->superalloc, 1);
+	modstack_init(&t->mods);
+	t->env.cfg = t->cfg;
+	t->env.alloc = &t->alloc;
+	t->env.now_tv = &t->now_tv;
+	t->env.scratch = regional_create();
+	unit_assert(t->env.scratch);
+	if(modules)
+		unit_assert(modstack_setup(&t->mods, modules, &t->env));
+	t->env.mesh = mesh_create(&t->mods, &t->env);
+	unit_assert(t->env.mesh);
+	t->c.type = comm_udp;
+}
+
+/** delete the mesh test setup */
+static void
+mesh_test_delete(struct mesh_test* t)
+{
+	mesh_delete(t->env.mesh);
+	modstack_desetup(&t->mods, &t->env);
+	regional_destroy(t->env.scratch);
+	alloc_clear(&t->alloc);
+	alloc_clear(&t->superalloc);
+	config_delete(t->cfg);
+}
+
+/** create a mesh state with a reply, like a new client query does */
+static struct mesh_state*
+mesh_test_add(struct mesh_test* t, int num)
+{
+	uint8_t qname[] = "\003www\007example\003com";
+	struct query_info qinfo;
+	struct edns_data edns;
+	struct comm_reply rep;
+	struct mesh_state* s;
+	memset(&qinfo, 0, sizeof(qinfo));
+	memset(&edns, 0, sizeof(edns));
+	memset(&rep, 0, sizeof(rep));
+	/* make the qname unique */
+	qname[1] = 'a' + (num%26);
+	qname[2] = 'a' + ((num/26)%26);
+	qname[3] = 'a' + ((num/(26*26))%26);
+	qinfo.qname = qname;
+	qinfo.qname_len = sizeof(qname);
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	rep.c = &t->c;
+	s = mesh_state_create(&t->env, &qinfo, NULL, BIT_RD, 0, 0);
+	unit_assert(s);
+	mesh_all_insert(t->env.mesh, s);
+	unit_assert(mesh_state_add_reply(s, &edns, &rep, (uint16_t)num,
+		BIT_RD, &qinfo));
+	t->env.mesh->num_reply_states++;
+	t->env.mesh->num_reply_addrs++;
+	return s;
+}
+
+/** test mesh state creation and deletion */
+static void
+mesh_state_test(void)
+{
+	struct mesh_test t;
+	struct mesh_state* s, *s2;
+	unit_show_func("services/mesh.c", "mesh_state_create");
+	mesh_test_setup(&t, NULL);
+
+	s = mesh_test_add(&t, 0);
+	unit_assert(s->reply_list && s->reply_list->qid == 0);
+	unit_assert(mesh_area_find(t.env.mesh, NULL, &s->s.qinfo, BIT_RD,
+		0, 0) == s);
+	mesh_state_delete(&s->s);
+	unit_assert(t.env.mesh->all_count == 0);
+	unit_assert(t.env.mesh->num_reply_states == 0);
+
+	/* the next state recycles the state and reply */
+	s2 = mesh_test_add(&t, 1);
+	unit_assert(s2 == s);
+	unit_assert(t.alloc.obj_reused >= 2);
+	mesh_state_delete(&s2->s);
+
+	mesh_test_delete(&t);
+}
+
+/** number of states in the mesh lookup test, all unique qnames */
+#define MESH_FIND_NUM 10000
+
+/** test the mesh all table lookups, with table growth */
+static void
+mesh_find_test(void)
+{
+	struct mesh_test t;
+	struct mesh_state** s, *u, **list;
+	struct timeval start, end;
+	size_t listnum;
+	double dt;
+	int i;
+	unit_show_func("services/mesh.c", "mesh_area_find");
+	mesh_test_setup(&t, NULL);
+	s = (struct mesh_state**)calloc(MESH_FIND_NUM, sizeof(*s));
+	unit_assert(s);
+	for(i=0; i<MESH_FIND_NUM; i++)
+		s[i] = mesh_test_add(&t, i);
+	unit_assert(t.env.mesh->all_count == MESH_FIND_NUM);
+	unit_assert(t.env.mesh->all_size >= MESH_FIND_NUM);
+
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<MESH_FIND_NUM; i++) {
+		unit_assert(mesh_area_find(t.env.mesh, NULL, &s[i]->s.qinfo,
+			BIT_RD, 0, 0) == s[i]);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	printf("mesh find: did %u in %g msec for %f lookups/sec, "
+		"%u buckets\n", (unsigned)MESH_FIND_NUM, dt,
+		(double)MESH_FIND_NUM / (dt/1000.),
+		(unsigned)t.env.mesh->all_size);
+
+	/* other flags do not match */
+	unit_assert(mesh_area_find(t.env.mesh, NULL, &s[0]->s.qinfo,
+		BIT_RD|BIT_CD, 0, 0) == NULL);
+	unit_assert(mesh_area_find(t.env.mesh, NULL, &s[0]->s.qinfo,
+		BIT_RD, 1, 0) == NULL);
+
+	/* a unique state with the same query is not found */
+	u = mesh_state_create(&t.env, &s[0]->s.qinfo, NULL, BIT_RD, 0, 0);
+	unit_assert(u);
+	mesh_state_make_unique(u);
+	mesh_all_insert(t.env.mesh, u);
+	t.env.mesh->num_detached_states++;
+	unit_assert(mesh_area_find(t.env.mesh, NULL, &s[0]->s.qinfo,
+		BIT_RD, 0, 0) == s[0]);
+
+	/* the sorted list has them all, in order */
+	list = mesh_list_sorted(t.env.mesh, &listnum);
+	unit_assert(list && listnum == MESH_FIND_NUM+1);
+	for(i=1; i<(int)listnum; i++)
+		unit_assert(mesh_state_compare(list[i-1], list[i]) < 0);
+	free(list);
+
+	/* delete half, the others remain */
+	mesh_state_delete(&u->s);
+	for(i=0; i<MESH_FIND_NUM; i+=2)
+		mesh_state_delete(&s[i]->s);
+	for(i=0; i<MESH_FIND_NUM; i++) {
+		unit_assert(mesh_area_find(t.env.mesh, NULL, &s[i|1]->s.qinfo,
+			BIT_RD, 0, 0) == s[i|1]);
+	}
+	unit_assert(t.env.mesh->all_count == MESH_FIND_NUM/2);
+	free(s);
+	mesh_test_delete(&t);
+}
+
+/** number of states in a mesh creation and teardown batch */
+#define MESH_PERF_BATCH 1000
+/** number of batches in the performance test */
+#define MESH_PERF_ROUNDS 20
+
+/** performance test mesh state creation and teardown */
+static void
+mesh_perf_test(size_t max_obj)
+{
+	struct mesh_test t;
+	struct mesh_state* s[MESH_PERF_BATCH];
+	struct timeval start, end;
+	double dt;
+	int i, r;
+	mesh_test_setup(&t, NULL);
+	t.alloc.max_obj = max_obj;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(r=0; r<MESH_PERF_ROUNDS; r++) {
+		for(i=0; i<MESH_PERF_BATCH; i++)
+			s[i] = mesh_test_add(&t, i);
+		for(i=0; i<MESH_PERF_BATCH; i++)
+			mesh_state_delete(&s[i]->s);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	/* time in millisec */
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	printf("mesh %s: did %u in %g msec for %f states/sec, "
+		"%u reused %u malloced\n",
+		max_obj?"object cache":"malloc",
+		(unsigned)MESH_PERF_BATCH*MESH_PERF_ROUNDS, dt,
+		(double)MESH_PERF_BATCH*MESH_PERF_ROUNDS / (dt/1000.),
+		(unsigned)t.alloc.obj_reused, (unsigned)t.alloc.obj_malloced);
+	if(max_obj) {
+		/* only the first batch had to be malloced */
+		unit_assert(t.alloc.obj_malloced <= 2*MESH_PERF_BATCH + 2);
+	} else {
+		unit_assert(t.alloc.obj_reused == 0);
+	}
+	mesh_test_delete(&t);
+}
+
+/** number of queries in the module statistics test */
+#define MESH_MODSTAT_NUM 3
+
+/** test the per module and per state operate call statistics */
+static void
+mesh_modstat_test(int extended)
+{
+	struct mesh_test t;
+	struct mesh_state* s;
+	struct mesh_area* mesh;
+	struct query_info qinfo;
+	uint8_t qname[] = "\003www\007example\003com";
+	int i, m, st;
+	unit_show_func("services/mesh.c", "mesh_run");
+	memset(&qinfo, 0, sizeof(qinfo));
+	qinfo.qname = qname;
+	qinfo.qname_len = sizeof(qname);
+	qinfo.qtype = LDNS_RR_TYPE_A;
+	qinfo.qclass = LDNS_RR_CLASS_IN;
+	mesh_test_setup(&t, "respip dns64");
+	mesh = t.env.mesh;
+	t.cfg->stat_extended = extended;
+	unit_assert(mesh->mods.num == 2);
+
+	for(i=0; i<MESH_MODSTAT_NUM; i++) {
+		/* the query is done by the modules below dns64, it
+		 * finishes, and passes the locus of control back up to
+		 * respip, that finishes the query */
+		s = mesh_state_create(&t.env, &qinfo, NULL, BIT_RD, 0, 0);
+		unit_assert(s);
+		mesh_all_insert(mesh, s);
+		mesh->num_detached_states++;
+		s->s.curmod = 1;
+		mesh_run(mesh, s, module_event_moddone, NULL);
+	}
+	unit_assert(mesh->all_count == 0);
+
+	for(m=0; m<2; m++) {
+		for(st=0; st<MESH_MOD_STATE_NUM; st++) {
+			long long expect = (extended &&
+				st == (int)module_finished)?MESH_MODSTAT_NUM:0;
+			unit_assert(mesh->mod_stat[m][st].calls == expect);
+			if(!expect)
+				unit_assert(mesh->mod_stat[m][st].usec == 0 &&
+					mesh->mod_stat[m][st].alloc == 0);
+		}
+		unit_assert(lathist_count(mesh->lat_module +
+			m*NUM_BUCKETS_LATHIST) ==
+			(extended?MESH_MODSTAT_NUM:0));
+	}
+	/* the other modules in the array are not called */
+	for(st=0; st<MESH_MOD_STATE_NUM; st++)
+		unit_assert(mesh->mod_stat[2][st].calls == 0);
+
+	mesh_stats_clear(mesh);
+	unit_assert(mesh->mod_stat[0][module_finished].calls == 0);
+	mesh_test_delete(&t);
+}
+
+void mesh_test(void)
+{
+	unit_show_feature("mesh state allocation");
+	alloc_obj_test();
+	mesh_state_test();
+	mesh_find_test();
+	mesh_perf_test(0);
+	mesh_perf_test(ALLOC_OBJ_MAX);
+	mesh_modstat_test(0);
+	mesh_modstat_test(1);
+}
@@ -40,6 +40,7 @@
 
 #include "config.h"
 #include <sys/time.h>
+#include <ctype.h>
 #include "util/log.h"
 #include "testcode/unitmain.h"
 #include "util/data/msgparse.h"
@@ -49,6 +50,12 @@
 #include "util/alloc.h"
 #include "util/regional.h"
 #include "util/net_help.h"
+#include "util/storage/lookup3.h"
+#include "util/config_file.h"
+#include "util/module.h"
+#include "util/storage/slabhash.h"
+#include "services/cache/dns.h"
+#include "services/cache/rrset.h"
 #include "testcode/readhex.h"
 #include "testcode/testpkts.h"
 #include "sldns/sbuffer.h"
@@ -495,6 +502,961 @@ testfromdrillfile(sldns_buffer* pkt, struct alloc_cache* alloc,
 	fclose(in);
 }
 
+/** max number of packets that are read from a file for the cache store,
+ * wireformat and parse tests */
+#define STORE_MAX_PKT 4096
+
+/** read the hex packets of a pcat file, every packet in a buffer of its
+ * own, at most STORE_MAX_PKT of them. Free with pkts_delete. */
+static sldns_buffer**
+pkts_read(const char* fname, size_t* num)
+{
+	FILE* in = fopen(fname, "r");
+	char buf[102400];
+	sldns_buffer* pkt = sldns_buffer_new(65553);
+	sldns_buffer** pkts;
+	if(!in || !pkt) {
+		perror(fname);
+		exit(1);
+	}
+	pkts = (sldns_buffer**)calloc(STORE_MAX_PKT, sizeof(*pkts));
+	unit_assert(pkts);
+	*num = 0;
+	while(*num < STORE_MAX_PKT && fgets(buf, (int)sizeof(buf), in)) {
+		if(buf[0] == ';' || strlen(buf) < 10)
+			continue;
+		hex_to_buf(pkt, buf);
+		if(sldns_buffer_limit(pkt) <= LDNS_HEADER_SIZE)
+			continue;
+		pkts[*num] = sldns_buffer_new(sldns_buffer_limit(pkt));
+		unit_assert(pkts[*num]);
+		sldns_buffer_write(pkts[*num], sldns_buffer_begin(pkt),
+			sldns_buffer_limit(pkt));
+		sldns_buffer_flip(pkts[*num]);
+		(*num)++;
+	}
+	fclose(in);
+	sldns_buffer_free(pkt);
+	return pkts;
+}
+
+/** free the packets from pkts_read */
+static void
+pkts_delete(sldns_buffer** pkts, size_t num)
+{
+	size_t i;
+	for(i=0; i<num; i++)
+		sldns_buffer_free(pkts[i]);
+	free(pkts);
+}
+
+/** parse packet into region, like the iterator does for upstream replies */
+static int
+parse_region(sldns_buffer* pkt, struct regional* region,
+	struct query_info* qi, struct reply_info** rep)
+{
+	struct msg_parse* msg = (struct msg_parse*)regional_alloc(region,
+		sizeof(*msg));
+	if(!msg)
+		return 0;
+	memset(msg, 0, sizeof(*msg));
+	if(parse_packet(pkt, msg, region) != LDNS_RCODE_NOERROR)
+		return 0;
+	return parse_create_msg(pkt, msg, NULL, qi, rep, region);
+}
+
+/** size of the malloced copy of an rrset */
+static size_t
+rrset_copy_size(struct ub_packed_rrset_key* k)
+{
+	return sizeof(*k) + k->rk.dname_len + packed_rrset_sizeof(
+		(struct packed_rrset_data*)k->entry.data);
+}
+
+/** store region replies in the cache, by copying the whole reply first */
+static void
+store_copy_all(struct module_env* env, struct reply_info** reps, size_t num,
+	size_t* copies, size_t* bytes)
+{
+	size_t i, j;
+	for(i=0; i<num; i++) {
+		struct reply_info* rep = reply_info_copy(reps[i], env->alloc,
+			NULL);
+		unit_assert(rep);
+		for(j=0; j<rep->rrset_count; j++) {
+			struct rrset_ref ref;
+			(*copies)++;
+			(*bytes) += rrset_copy_size(rep->rrsets[j]);
+			packed_rrset_ttl_add((struct packed_rrset_data*)
+				rep->rrsets[j]->entry.data, *env->now);
+			ref.key = rep->rrsets[j];
+			ref.id = rep->rrsets[j]->id;
+			(void)rrset_cache_update(env->rrset_cache, &ref,
+				env->alloc, *env->now);
+		}
+		free(rep);
+	}
+}
+
+/** store region replies in the cache, copying only inserted rrsets */
+static void
+store_copy_insert(struct module_env* env, struct reply_info** reps,
+	size_t num, size_t* copies, size_t* bytes)
+{
+	size_t i, j;
+	for(i=0; i<num; i++) {
+		for(j=0; j<reps[i]->rrset_count; j++) {
+			struct rrset_ref ref;
+			int r;
+			ref.key = reps[i]->rrsets[j];
+			ref.id = 0;
+			r = rrset_cache_update_copy(env->rrset_cache, &ref,
+				env->alloc, *env->now, *env->now);
+			unit_assert(r != -1);
+			if(r == 0 || r == 1) {
+				(*copies)++;
+				(*bytes) += rrset_copy_size(reps[i]->rrsets[j]);
+			}
+		}
+	}
+}
+
+/** time a cache store method */
+static void
+store_perf(const char* desc, struct module_env* env, struct reply_info** reps,
+	size_t num, int rounds, void (*f)(struct module_env*,
+	struct reply_info**, size_t, size_t*, size_t*), size_t* copies)
+{
+	struct timeval start, end;
+	double dt;
+	size_t bytes = 0;
+	int i;
+	*copies = 0;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<rounds; i++)
+		(*f)(env, reps, num, copies, &bytes);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(unit_bench)
+		printf("cache store %s: %u replies in %g msec, %u rrset "
+			"copies %u bytes\n", desc, (unsigned)num*rounds, dt,
+			(unsigned)*copies, (unsigned)bytes);
+}
+
+/** test storing parsed replies in the cache, pcat file */
+static void
+cachestore_test(struct alloc_cache* alloc, const char* fname)
+{
+	struct config_file* cfg = config_create();
+	struct regional* region = regional_create();
+	struct regional* scratch = regional_create();
+	sldns_buffer** pkts;
+	struct reply_info** reps;
+	struct query_info* qis;
+	struct module_env env;
+	time_t now = 1500000000;
+	size_t i, n, num = 0, numpkt, copy_all, copy_insert;
+	int rounds = unit_bench?10:1;
+	unit_assert(cfg && region && scratch);
+	unit_show_func("services/cache/dns.c", "dns_cache_store");
+	pkts = pkts_read(fname, &numpkt);
+	reps = (struct reply_info**)calloc(STORE_MAX_PKT, sizeof(*reps));
+	qis = (struct query_info*)calloc(STORE_MAX_PKT, sizeof(*qis));
+	unit_assert(reps && qis);
+	memset(&env, 0, sizeof(env));
+	cfg->rrset_cache_size = 64*1024*1024;
+	cfg->msg_cache_size = 64*1024*1024;
+	env.cfg = cfg;
+	env.now = &now;
+	env.alloc = alloc;
+	env.rrset_cache = rrset_cache_create(cfg, alloc);
+	env.msg_cache = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare,
+		query_entry_delete, reply_info_delete, NULL);
+	unit_assert(env.rrset_cache && env.msg_cache);
+
+	for(n=0; n<numpkt; n++) {
+		if(!parse_region(pkts[n], region, &qis[num], &reps[num]))
+			continue;
+		if(!qis[num].qname || reps[num]->rrset_count == 0)
+			continue;
+		/* store the reply and get it back from the cache */
+		unit_assert(dns_cache_store(&env, &qis[num], reps[num], 0, 0,
+			0, region, 0));
+		if(reps[num]->ttl != 0) {
+			struct dns_msg* m = dns_cache_lookup(&env,
+				qis[num].qname, qis[num].qname_len,
+				qis[num].qtype, qis[num].qclass, 0, region,
+				scratch, 0);
+			unit_assert(m);
+			unit_assert(m->rep->rrset_count ==
+				reps[num]->rrset_count);
+			unit_assert(m->rep->flags & BIT_QR);
+		}
+		regional_free_all(scratch);
+		num++;
+	}
+	pkts_delete(pkts, numpkt);
+
+	/* replies for content that is in the cache, like referrals and
+	 * the same answers again; the cached rrsets are not replaced */
+	store_perf("copy reply", &env, reps, num, rounds, &store_copy_all,
+		&copy_all);
+	store_perf("copy on insert", &env, reps, num, rounds,
+		&store_copy_insert, &copy_insert);
+	unit_assert(copy_insert < copy_all);
+	/* the passed region rrsets have not been changed */
+	for(i=0; i<num; i++)
+		unit_assert(((struct packed_rrset_data*)reps[i]->rrsets[0]->
+			entry.data)->ttl < now);
+
+	slabhash_delete(env.msg_cache);
+	rrset_cache_delete(env.rrset_cache);
+	free(reps);
+	free(qis);
+	regional_destroy(region);
+	regional_destroy(scratch);
+	config_delete(cfg);
+}
+
+/** encode a cached reply, with the precomputed wireformat or without */
+static void
+wire_encode(struct query_info* qi, struct reply_info* rep, int wire,
+	sldns_buffer* out, time_t now, struct regional* region, int dnssec)
+{
+	struct reply_wire* w = rep->wire;
+	if(!wire)
+		rep->wire = NULL;
+	unit_assert(reply_info_encode(qi, rep, 0x1234, BIT_QR|BIT_RA, out,
+		now, region, 65535, dnssec));
+	rep->wire = w;
+	regional_free_all(region);
+}
+
+/** check that the wireformat encodes the same packet as the tree */
+static void
+wire_check_same(struct query_info* qi, struct reply_info* rep,
+	sldns_buffer* out, sldns_buffer* out2, time_t now,
+	struct regional* region)
+{
+	int dnssec, minimal;
+	for(minimal=0; minimal<2; minimal++) {
+		MINIMAL_RESPONSES = minimal;
+		for(dnssec=0; dnssec<2; dnssec++) {
+			wire_encode(qi, rep, 0, out, now, region, dnssec);
+			wire_encode(qi, rep, 1, out2, now, region, dnssec);
+			unit_assert(sldns_buffer_limit(out) ==
+				sldns_buffer_limit(out2));
+			unit_assert(memcmp(sldns_buffer_begin(out),
+				sldns_buffer_begin(out2),
+				sldns_buffer_limit(out)) == 0);
+		}
+	}
+	MINIMAL_RESPONSES = 0;
+}
+
+/** change the rdata of the rrsets of a reply in place, without changing
+ * the length; for the types with domain names, the case of a label */
+static void
+wire_change_rdata(struct reply_info* rep)
+{
+	size_t i, j;
+	for(i=0; i<rep->rrset_count; i++) {
+		struct packed_rrset_data* d = (struct packed_rrset_data*)
+			rep->rrsets[i]->entry.data;
+		const sldns_rr_descriptor* desc = sldns_rr_descript(
+			ntohs(rep->rrsets[i]->rk.type));
+		for(j=0; j<d->count; j++) {
+			if(d->rr_len[j] < 4)
+				continue;
+			if(desc && desc->_compress == LDNS_RR_COMPRESS &&
+				desc->_wireformat[0] == LDNS_RDF_TYPE_DNAME) {
+				if(isalpha((unsigned char)d->rr_data[j][3]))
+					d->rr_data[j][3] ^= 0x20;
+			} else	d->rr_data[j][d->rr_len[j]-1] ^= 0x01;
+		}
+	}
+}
+
+/** time encoding of the cached replies */
+static double
+wire_perf(struct query_info* qis, struct reply_info** reps, size_t num,
+	int rounds, int wire, sldns_buffer* out, time_t now,
+	struct regional* region)
+{
+	struct timeval start, end;
+	size_t i;
+	int r;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(r=0; r<rounds; r++)
+		for(i=0; i<num; i++)
+			wire_encode(&qis[i], reps[i], wire, out, now, region,
+				1);
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+}
+
+/** test the precomputed wireformat of cached replies, pcat file */
+static void
+wire_test(struct alloc_cache* alloc, const char* fname)
+{
+	struct config_file* cfg = config_create();
+	struct regional* region = regional_create();
+	struct regional* scratch = regional_create();
+	sldns_buffer* out = sldns_buffer_new(65553);
+	sldns_buffer* out2 = sldns_buffer_new(65553);
+	sldns_buffer** pkts;
+	struct reply_info** reps;
+	struct query_info* qis;
+	struct module_env env;
+	time_t now = 1500000000;
+	size_t i, n, num = 0, numpkt, numwire = 0, numboth = 0;
+	double dt_tree, dt_wire;
+	unit_assert(cfg && region && scratch && out && out2);
+	unit_show_func("util/data/msgencode.c", "reply_wire_create");
+	pkts = pkts_read(fname, &numpkt);
+	reps = (struct reply_info**)calloc(STORE_MAX_PKT, sizeof(*reps));
+	qis = (struct query_info*)calloc(STORE_MAX_PKT, sizeof(*qis));
+	unit_assert(reps && qis);
+	memset(&env, 0, sizeof(env));
+	cfg->rrset_cache_size = 64*1024*1024;
+	cfg->msg_cache_size = 64*1024*1024;
+	unit_assert(cfg->msg_cache_wireformat);
+	env.cfg = cfg;
+	env.now = &now;
+	env.alloc = alloc;
+	env.scratch = scratch;
+	env.rrset_cache = rrset_cache_create(cfg, alloc);
+	env.msg_cache = slabhash_create(cfg->msg_cache_slabs,
+		HASH_DEFAULT_STARTARRAY, cfg->msg_cache_size,
+		msgreply_sizefunc, query_info_compare,
+		query_entry_delete, reply_info_delete, NULL);
+	unit_assert(env.rrset_cache && env.msg_cache);
+
+	for(n=0; n<numpkt; n++) {
+		struct msgreply_entry* e;
+		if(!parse_region(pkts[n], region, &qis[num], &reps[num]))
+			continue;
+		if(!qis[num].qname || reps[num]->rrset_count == 0)
+			continue;
+		unit_assert(dns_cache_store(&env, &qis[num], reps[num], 0, 0,
+			0, region, 0));
+		e = msg_cache_lookup(&env, qis[num].qname, qis[num].qname_len,
+			qis[num].qtype, qis[num].qclass, 0, now, 0);
+		regional_free_all(scratch);
+		if(!e)
+			continue;
+		lock_rw_unlock(&e->entry.lock);
+		num++;
+	}
+	pkts_delete(pkts, numpkt);
+	/* get the cached replies, a later reply for the same query has
+	 * replaced the entry; the test is single threaded, so the entries
+	 * stay in the cache */
+	for(i=0; i<num; i++) {
+		struct msgreply_entry* e = msg_cache_lookup(&env,
+			qis[i].qname, qis[i].qname_len, qis[i].qtype,
+			qis[i].qclass, 0, now, 0);
+		unit_assert(e);
+		lock_rw_unlock(&e->entry.lock);
+		reps[i] = (struct reply_info*)e->entry.data;
+		if(!reps[i]->wire)
+			continue;
+		numwire++;
+		if(reps[i]->wire->both)
+			numboth++;
+		wire_check_same(&qis[i], reps[i], out, out2, now, scratch);
+		wire_check_same(&qis[i], reps[i], out, out2, now+100, scratch);
+	}
+	unit_assert(numwire > 0);
+
+	/* encode the replies */
+	if(unit_bench) {
+		dt_tree = wire_perf(qis, reps, num, 20, 0, out, now, scratch);
+		dt_wire = wire_perf(qis, reps, num, 20, 1, out, now, scratch);
+		printf("encode %u cached replies (%u precomputed, %u same "
+			"with DO bit): compression tree %g msec, wireformat "
+			"%g msec, %.2fx\n", (unsigned)num*20,
+			(unsigned)numwire, (unsigned)numboth, dt_tree, dt_wire,
+			dt_wire>0?dt_tree/dt_wire:0.);
+	}
+
+	/* rrsets are updated in place, the reply stays the same as the
+	 * compression tree makes it */
+	for(i=0; i<num; i++) {
+		wire_change_rdata(reps[i]);
+		wire_check_same(&qis[i], reps[i], out, out2, now, scratch);
+	}
+
+	slabhash_delete(env.msg_cache);
+	rrset_cache_delete(env.rrset_cache);
+	free(reps);
+	free(qis);
+	regional_destroy(region);
+	regional_destroy(scratch);
+	sldns_buffer_free(out);
+	sldns_buffer_free(out2);
+	config_delete(cfg);
+}
+
+/** max number of packets for the parse fuzz test */
+#define FUZZ_MAX_PKT 256
+/** number of mutated copies of a packet in the parse fuzz test */
+#define FUZZ_ROUNDS 32
+/** max number of names in a packet that are compared with each other */
+#define FUZZ_MAX_NAMES 64
+
+/** dname length from the packet, label by label, the reference for the
+ * fuzz test */
+static size_t
+ref_pkt_dname_len(sldns_buffer* pkt)
+{
+	size_t len = 0;
+	int ptrcount = 0;
+	uint8_t labellen;
+	size_t endpos = 0;
+
+	while(1) {
+		if(sldns_buffer_remaining(pkt) < 1)
+			return 0;
+		labellen = sldns_buffer_read_u8(pkt);
+		if(LABEL_IS_PTR(labellen)) {
+			uint16_t ptr;
+			if(sldns_buffer_remaining(pkt) < 1)
+				return 0;
+			ptr = PTR_OFFSET(labellen, sldns_buffer_read_u8(pkt));
+			if(ptrcount++ > MAX_COMPRESS_PTRS)
+				return 0;
+			if(sldns_buffer_limit(pkt) <= ptr)
+				return 0;
+			if(!endpos)
+				endpos = sldns_buffer_position(pkt);
+			sldns_buffer_set_position(pkt, ptr);
+		} else {
+			if(labellen > 0x3f)
+				return 0;
+			len += 1 + labellen;
+			if(len > LDNS_MAX_DOMAINLEN)
+				return 0;
+			if(labellen == 0)
+				break;
+			if(sldns_buffer_remaining(pkt) < labellen)
+				return 0;
+			sldns_buffer_skip(pkt, (ssize_t)labellen);
+		}
+	}
+	if(endpos)
+		sldns_buffer_set_position(pkt, endpos);
+	return len;
+}
+
+/** dname compare in the packet, octet by octet, the reference for the
+ * fuzz test */
+static int
+ref_dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
+{
+	uint8_t len1, len2;
+	len1 = *d1++;
+	len2 = *d2++;
+	while( len1 != 0 || len2 != 0 ) {
+		if(LABEL_IS_PTR(len1)) {
+			d1 = sldns_buffer_at(pkt, PTR_OFFSET(len1, *d1));
+			len1 = *d1++;
+			continue;
+		}
+		if(LABEL_IS_PTR(len2)) {
+			d2 = sldns_buffer_at(pkt, PTR_OFFSET(len2, *d2));
+			len2 = *d2++;
+			continue;
+		}
+		if(len1 != len2) {
+			if(len1 < len2) return -1;
+			return 1;
+		}
+		while(len1--) {
+			if(tolower((unsigned char)*d1) != tolower((unsigned char)*d2)) {
+				if(tolower((unsigned char)*d1) < tolower((unsigned char)*d2))
+					return -1;
+				return 1;
+			}
+			d1++;
+			d2++;
+		}
+		len1 = *d1++;
+		len2 = *d2++;
+	}
+	return 0;
+}
+
+/** dname hash in the packet, octet by octet, the reference for the fuzz
+ * test */
+static hashvalue_type
+ref_dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
+{
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
+	uint8_t lablen;
+	int i;
+	lablen = *dname++;
+	while(lablen) {
+		if(LABEL_IS_PTR(lablen)) {
+			dname = sldns_buffer_at(pkt, PTR_OFFSET(lablen, *dname));
+			lablen = *dname++;
+			continue;
+		}
+		labuf[0] = lablen;
+		i=0;
+		while(lablen--) {
+			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
+			dname++;
+		}
+		h = hashlittle(labuf, labuf[0] + 1, h);
+		lablen = *dname++;
+	}
+	return h;
+}
+
+/** random number for the fuzz test, the same sequence every run */
+static uint32_t
+fuzz_random(uint32_t* state)
+{
+	*state = *state * 1103515245 + 12345;
+	return (*state >> 8);
+}
+
+/** change some octets in the packet, often to compression pointers and
+ * to the other case of letters */
+static void
+fuzz_mutate(sldns_buffer* pkt, uint32_t* state)
+{
+	size_t len = sldns_buffer_limit(pkt);
+	uint8_t* d = sldns_buffer_begin(pkt);
+	int i, num = 1 + (int)(fuzz_random(state)%4);
+	for(i=0; i<num; i++) {
+		size_t p = LDNS_HEADER_SIZE + fuzz_random(state)%
+			(len-LDNS_HEADER_SIZE);
+		size_t ptr;
+		switch(fuzz_random(state)%4) {
+		case 0:
+			d[p] = (uint8_t)fuzz_random(state);
+			break;
+		case 1:
+			if(p+1 >= len)
+				break;
+			ptr = fuzz_random(state)%len;
+			d[p] = (uint8_t)(0xc0 | (ptr>>8));
+			d[p+1] = (uint8_t)ptr;
+			break;
+		case 2:
+			if(isalpha((unsigned char)d[p]))
+				d[p] ^= 0x20;
+			break;
+		default:
+			d[p] = (uint8_t)(fuzz_random(state)%0x40);
+			break;
+		}
+	}
+}
+
+/** check the names at every position in the packet with the reference */
+static void
+fuzz_names(sldns_buffer* pkt)
+{
+	size_t names[FUZZ_MAX_NAMES];
+	size_t i, j, p, num = 0, len, end;
+	hashvalue_type h;
+	int ptrs, c;
+	for(p=LDNS_HEADER_SIZE; p<sldns_buffer_limit(pkt); p++) {
+		sldns_buffer_set_position(pkt, p);
+		len = ref_pkt_dname_len(pkt);
+		end = sldns_buffer_position(pkt);
+		sldns_buffer_set_position(pkt, p);
+		unit_assert(pkt_dname_len(pkt) == len);
+		sldns_buffer_set_position(pkt, p);
+		h = 0xab;
+		unit_assert(pkt_dname_len_hash(pkt, &h, &ptrs) == len);
+		if(len == 0)
+			continue;
+		unit_assert(sldns_buffer_position(pkt) == end);
+		unit_assert(h == ref_dname_pkt_hash(pkt,
+			sldns_buffer_at(pkt, p), 0xab));
+		unit_assert(h == dname_pkt_hash(pkt, sldns_buffer_at(pkt, p),
+			0xab));
+		if(num < FUZZ_MAX_NAMES)
+			names[num++] = p;
+	}
+	for(i=0; i<num; i++) {
+		for(j=0; j<num; j++) {
+			uint8_t* d1 = sldns_buffer_at(pkt, names[i]);
+			uint8_t* d2 = sldns_buffer_at(pkt, names[j]);
+			c = ref_dname_pkt_compare(pkt, d1, d2);
+			unit_assert(dname_pkt_compare(pkt, d1, d2) == c);
+		}
+	}
+}
+
+/** check the owner names and hashes of the parsed rrsets */
+static void
+fuzz_parse(sldns_buffer* pkt, struct regional* region)
+{
+	struct msg_parse* msg = (struct msg_parse*)regional_alloc(region,
+		sizeof(*msg));
+	struct rrset_parse* rrset;
+	unit_assert(msg);
+	memset(msg, 0, sizeof(*msg));
+	sldns_buffer_set_position(pkt, 0);
+	if(parse_packet(pkt, msg, region) != LDNS_RCODE_NOERROR)
+		return;
+	for(rrset = msg->rrset_first; rrset; rrset = rrset->rrset_all_next) {
+		hashvalue_type h = ref_dname_pkt_hash(pkt, rrset->dname,
+			0xab);
+		h = hashlittle(&rrset->type, sizeof(rrset->type), h);
+		h = hashlittle(&rrset->rrset_class, sizeof(rrset->rrset_class),
+			h);
+		h = hashlittle(&rrset->flags, sizeof(uint32_t), h);
+		unit_assert(rrset->hash == h);
+		sldns_buffer_set_position(pkt, (size_t)(rrset->dname -
+			sldns_buffer_begin(pkt)));
+		unit_assert(rrset->dname_len == ref_pkt_dname_len(pkt));
+	}
+}
+
+/** parse the packets many times, for the timing */
+static double
+parse_perf(sldns_buffer** pkts, size_t num, int rounds,
+	struct regional* region)
+{
+	struct timeval start, end;
+	struct msg_parse* msg;
+	size_t i;
+	int r;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(r=0; r<rounds; r++) {
+		for(i=0; i<num; i++) {
+			msg = (struct msg_parse*)regional_alloc(region,
+				sizeof(*msg));
+			unit_assert(msg);
+			memset(msg, 0, sizeof(*msg));
+			sldns_buffer_set_position(pkts[i], 0);
+			(void)parse_packet(pkts[i], msg, region);
+			regional_free_all(region);
+		}
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+}
+
+/** make an answer with a large rrset, with the owner names compressed to
+ * the query name, or with distinct owner names for every RR */
+static sldns_buffer*
+parse_large_pkt(int num, int distinct)
+{
+	sldns_buffer* pkt = sldns_buffer_new(65535);
+	int i;
+	unit_assert(pkt);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0x8180);
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, (uint16_t)num);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write(pkt, "\007EXAMPLE\003com\000", 13);
+	sldns_buffer_write_u16(pkt, distinct?LDNS_RR_TYPE_NSEC3:
+		LDNS_RR_TYPE_TXT);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	for(i=0; i<num; i++) {
+		if(distinct) {
+			char lab[40];
+			snprintf(lab, sizeof(lab), "%032X", (unsigned)i*2654435761U);
+			sldns_buffer_write_u8(pkt, 32);
+			sldns_buffer_write(pkt, lab, 32);
+		}
+		sldns_buffer_write_u16(pkt, 0xc00c);
+		sldns_buffer_write_u16(pkt, distinct?LDNS_RR_TYPE_NSEC3:
+			LDNS_RR_TYPE_TXT);
+		sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+		sldns_buffer_write_u32(pkt, 3600);
+		sldns_buffer_write_u16(pkt, 12);
+		sldns_buffer_write_u8(pkt, 11);
+		sldns_buffer_write_u16(pkt, (uint16_t)i);
+		sldns_buffer_write(pkt, "abcdefghi", 9);
+	}
+	sldns_buffer_flip(pkt);
+	return pkt;
+}
+
+/** fuzz the dname functions and the parse with changed packets, and
+ * check them with the reference versions, and time the parse */
+static void
+parse_fuzz_test(const char* fname)
+{
+	struct regional* region = regional_create();
+	sldns_buffer** pkts;
+	sldns_buffer* large[2];
+	sldns_buffer* fz = sldns_buffer_new(65553);
+	size_t i, num = 0;
+	uint32_t state = 1;
+	int r;
+	double dt, dt_large, dt_distinct;
+	unit_assert(region && fz);
+	unit_show_func("util/data/msgparse.c", "parse_packet fuzz");
+	pkts = pkts_read(fname, &num);
+
+	for(i=0; i<num && i<FUZZ_MAX_PKT; i++) {
+		for(r=0; r<FUZZ_ROUNDS; r++) {
+			sldns_buffer_clear(fz);
+			sldns_buffer_write(fz, sldns_buffer_begin(pkts[i]),
+				sldns_buffer_limit(pkts[i]));
+			sldns_buffer_flip(fz);
+			if(r != 0)
+				fuzz_mutate(fz, &state);
+			fuzz_names(fz);
+			fuzz_parse(fz, region);
+			regional_free_all(region);
+		}
+	}
+
+	large[0] = parse_large_pkt(1000, 0);
+	large[1] = parse_large_pkt(1000, 1);
+	fuzz_names(large[0]);
+	fuzz_parse(large[0], region);
+	fuzz_parse(large[1], region);
+	regional_free_all(region);
+	if(unit_bench) {
+		dt = parse_perf(pkts, num, 20, region);
+		dt_large = parse_perf(&large[0], 1, 2000, region);
+		dt_distinct = parse_perf(&large[1], 1, 2000, region);
+		printf("parse %u packets: %g msec, 2000 x 1000 RRs with "
+			"compressed owner: %g msec, 2000 x 1000 RRs with "
+			"distinct owner: %g msec\n", (unsigned)num*20, dt,
+			dt_large, dt_distinct);
+	}
+
+	pkts_delete(pkts, num);
+	sldns_buffer_free(large[0]);
+	sldns_buffer_free(large[1]);
+	sldns_buffer_free(fz);
+	regional_destroy(region);
+}
+
+/** the general parse of a query in the worker: the header checks, the
+ * question, the meta types and the EDNS record.  Returns false if the
+ * worker does not answer it from the parse. */
+static int
+query_general_parse(sldns_buffer* pkt, struct query_info* qinfo,
+	struct edns_data* edns, struct regional* region)
+{
+	uint8_t* p = sldns_buffer_begin(pkt);
+	sldns_buffer_set_position(pkt, 0);
+	if(sldns_buffer_limit(pkt) < LDNS_HEADER_SIZE || LDNS_QR_WIRE(p) ||
+		LDNS_TC_WIRE(p) || LDNS_OPCODE_WIRE(p) != LDNS_PACKET_QUERY ||
+		LDNS_QDCOUNT(p) != 1 || LDNS_ANCOUNT(p) != 0 ||
+		LDNS_NSCOUNT(p) != 0 || LDNS_ARCOUNT(p) > 1)
+		return 0;
+	if(!query_info_parse(qinfo, pkt))
+		return 0;
+	if(qinfo->qtype == LDNS_RR_TYPE_AXFR ||
+		qinfo->qtype == LDNS_RR_TYPE_IXFR ||
+		qinfo->qtype == LDNS_RR_TYPE_OPT ||
+		qinfo->qtype == LDNS_RR_TYPE_TSIG ||
+		qinfo->qtype == LDNS_RR_TYPE_TKEY ||
+		qinfo->qtype == LDNS_RR_TYPE_MAILA ||
+		qinfo->qtype == LDNS_RR_TYPE_MAILB ||
+		(qinfo->qtype >= 128 && qinfo->qtype <= 248))
+		return 0;
+	if(parse_edns_from_pkt(pkt, edns, region) != 0)
+		return 0;
+	return 1;
+}
+
+/** make a query for the name, with an OPT record if edns */
+static void
+query_make(sldns_buffer* pkt, uint8_t* qname, size_t qname_len,
+	uint16_t qtype, int edns, int num)
+{
+	sldns_buffer_clear(pkt);
+	sldns_buffer_write_u16(pkt, (uint16_t)num);
+	sldns_buffer_write_u16(pkt, BIT_RD | ((num&1)?BIT_CD:0));
+	sldns_buffer_write_u16(pkt, 1);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, 0);
+	sldns_buffer_write_u16(pkt, edns?1:0);
+	sldns_buffer_write(pkt, qname, qname_len);
+	sldns_buffer_write_u16(pkt, qtype);
+	sldns_buffer_write_u16(pkt, LDNS_RR_CLASS_IN);
+	if(edns) {
+		sldns_buffer_write_u8(pkt, 0);
+		sldns_buffer_write_u16(pkt, LDNS_RR_TYPE_OPT);
+		sldns_buffer_write_u16(pkt, 1232);
+		sldns_buffer_write_u8(pkt, 0);
+		sldns_buffer_write_u8(pkt, 0);
+		sldns_buffer_write_u16(pkt, (num&2)?EDNS_DO:0);
+		if(edns == 2) {
+			/* a client cookie */
+			sldns_buffer_write_u16(pkt, 12);
+			sldns_buffer_write_u16(pkt, 10);
+			sldns_buffer_write_u16(pkt, 8);
+			sldns_buffer_write(pkt, "cookie00", 8);
+		} else	sldns_buffer_write_u16(pkt, 0);
+	}
+	sldns_buffer_flip(pkt);
+}
+
+/** check the fast parse of the query with the general parse */
+static void
+query_check_fast(sldns_buffer* pkt, int standard, struct regional* region)
+{
+	struct query_info q1, q2;
+	struct edns_data e1, e2;
+	struct edns_option* o1, *o2;
+	hashvalue_type h = 0;
+	int fast;
+	size_t pos;
+	memset(&q1, 0, sizeof(q1));
+	memset(&e1, 0, sizeof(e1));
+	sldns_buffer_set_position(pkt, 0);
+	fast = parse_query_fast(pkt, &q1, &e1, &h, region);
+	pos = sldns_buffer_position(pkt);
+	if(standard)
+		unit_assert(fast);
+	if(!fast) {
+		unit_assert(pos == 0);
+		return;
+	}
+	unit_assert(query_general_parse(pkt, &q2, &e2, region));
+	unit_assert(sldns_buffer_position(pkt) == pos);
+	unit_assert(q1.qname == q2.qname && q1.qname_len == q2.qname_len);
+	unit_assert(q1.qtype == q2.qtype && q1.qclass == q2.qclass);
+	unit_assert(q1.local_alias == NULL);
+	unit_assert(h == query_info_hash(&q2,
+		sldns_buffer_read_u16_at(pkt, 2)));
+	unit_assert(e1.edns_present == e2.edns_present);
+	unit_assert(e1.ext_rcode == e2.ext_rcode);
+	unit_assert(e1.edns_version == e2.edns_version);
+	unit_assert(e1.bits == e2.bits && e1.udp_size == e2.udp_size);
+	for(o1 = e1.opt_list, o2 = e2.opt_list; o1 && o2;
+		o1 = o1->next, o2 = o2->next) {
+		unit_assert(o1->opt_code == o2->opt_code);
+		unit_assert(o1->opt_len == o2->opt_len);
+		unit_assert(o1->opt_len == 0 ||
+			memcmp(o1->opt_data, o2->opt_data, o1->opt_len) == 0);
+	}
+	unit_assert(o1 == NULL && o2 == NULL);
+}
+
+/** time the parse of the queries, the fast one or the general one */
+static double
+query_perf(sldns_buffer** pkts, size_t num, int rounds, int fast,
+	struct regional* region)
+{
+	struct timeval start, end;
+	struct query_info qinfo;
+	struct edns_data edns;
+	hashvalue_type h;
+	size_t i;
+	int r;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(r=0; r<rounds; r++) {
+		for(i=0; i<num; i++) {
+			sldns_buffer_set_position(pkts[i], 0);
+			if(fast) {
+				unit_assert(parse_query_fast(pkts[i], &qinfo,
+					&edns, &h, region));
+			} else {
+				unit_assert(query_general_parse(pkts[i],
+					&qinfo, &edns, region));
+				h = query_info_hash(&qinfo,
+					sldns_buffer_read_u16_at(pkts[i], 2));
+				(void)h;
+			}
+			regional_free_all(region);
+		}
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	return ((double)end.tv_sec - (double)start.tv_sec)*1000. +
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+}
+
+/** check the fast parse of queries, with the query names from the
+ * packets, and with changed queries, and time it */
+static void
+query_fast_test(const char* fname)
+{
+	struct regional* region = regional_create();
+	sldns_buffer* fz = sldns_buffer_new(65553);
+	sldns_buffer** pkts;
+	sldns_buffer** qs;
+	size_t n, num = 0, numpkt;
+	uint32_t state = 1;
+	int r;
+	double dt_general, dt_fast;
+	unit_assert(region && fz);
+	unit_show_func("util/data/msgparse.c", "parse_query_fast");
+	pkts = pkts_read(fname, &numpkt);
+	qs = (sldns_buffer**)calloc(STORE_MAX_PKT, sizeof(*qs));
+	unit_assert(qs);
+	for(n=0; n<numpkt; n++) {
+		struct query_info qinfo;
+		sldns_buffer* pkt = pkts[n];
+		if(LDNS_QDCOUNT(sldns_buffer_begin(pkt)) != 1 ||
+			!query_info_parse(&qinfo, pkt) ||
+			qinfo.qtype == LDNS_RR_TYPE_AXFR ||
+			qinfo.qtype == LDNS_RR_TYPE_IXFR ||
+			qinfo.qtype == LDNS_RR_TYPE_OPT ||
+			qinfo.qtype == LDNS_RR_TYPE_TSIG ||
+			qinfo.qtype == LDNS_RR_TYPE_TKEY ||
+			qinfo.qtype == LDNS_RR_TYPE_MAILA ||
+			qinfo.qtype == LDNS_RR_TYPE_MAILB ||
+			(qinfo.qtype >= 128 && qinfo.qtype <= 248))
+			continue;
+		qs[num] = sldns_buffer_new(512);
+		unit_assert(qs[num]);
+		query_make(qs[num], qinfo.qname, qinfo.qname_len, qinfo.qtype,
+			(int)(num%3), (int)num);
+		query_check_fast(qs[num], 1, region);
+		for(r=0; r<FUZZ_ROUNDS; r++) {
+			sldns_buffer_clear(fz);
+			sldns_buffer_write(fz, sldns_buffer_begin(qs[num]),
+				sldns_buffer_limit(qs[num]));
+			sldns_buffer_flip(fz);
+			fuzz_mutate(fz, &state);
+			query_check_fast(fz, 0, region);
+			/* also cut short */
+			sldns_buffer_set_limit(fz, LDNS_HEADER_SIZE +
+				fuzz_random(&state)%(sldns_buffer_limit(fz)-
+				LDNS_HEADER_SIZE+1));
+			query_check_fast(fz, 0, region);
+			regional_free_all(region);
+		}
+		num++;
+	}
+	pkts_delete(pkts, numpkt);
+	unit_assert(num > 0);
+
+	if(unit_bench) {
+		dt_general = query_perf(qs, num, 100, 0, region);
+		dt_fast = query_perf(qs, num, 100, 1, region);
+		printf("parse %u queries: general %g msec, fast %g msec, "
+			"%.2fx\n", (unsigned)num*100, dt_general, dt_fast,
+			dt_fast>0?dt_general/dt_fast:0.);
+	}
+
+	pkts_delete(qs, num);
+	sldns_buffer_free(fz);
+	regional_destroy(region);
+}
+
 void msgparse_test(void)
 {
 	time_t origttl = MAX_NEG_TTL;
@@ -533,6 +1495,11 @@ void msgparse_test(void)
 	check_nosameness = 0;
 	check_rrsigs = 0;
 
+	cachestore_test(&alloc, "testdata/test_packets.1");
+	wire_test(&alloc, "testdata/test_packets.1");
+	parse_fuzz_test("testdata/test_packets.1");
+	query_fast_test("testdata/test_packets.1");
+
 	/* cleanup */
 	alloc_clear(&alloc);
 	alloc_clear(&super_a);
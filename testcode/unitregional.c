@@ -42,6 +42,9 @@
 #include "testcode/unitmain.h"
 #include "util/log.h"
 #include "util/regional.h"
+#include "util/alloc.h"
+#include <sys/time.h>
+#include <errno.h>
 
 /** test regional corner cases, zero, one, end of structure */
 static void
@@ -236,9 +239,113 @@ random_burden(void)
 		burden_test(max_alloc);
 }
 
+/** test the chunk cache */
+static void
+chunk_cache_test(void)
+{
+	struct regional_cache c;
+	struct regional* r = regional_create();
+	void* a;
+	int i;
+	regional_cache_init(&c, 2);
+	regional_set_cache(r, &c);
+	/* three chunks and a large object that fits in a chunk */
+	for(i=0; i<3*8; i++) {
+		a = regional_alloc(r, 1024);
+		unit_assert(a);
+		memset(a, 0x42, 1024);
+	}
+	a = regional_alloc(r, 4000);
+	unit_assert(a);
+	memset(a, 0x42, 4000);
+	unit_assert(r->large_list == NULL && r->total_large == 0);
+	unit_assert(c.malloced == 4 && c.reused == 0);
+	regional_free_all(r);
+	unit_assert(c.num == 2 && c.freed == 2);
+	/* the kept chunks are reused */
+	for(i=0; i<3*8; i++)
+		unit_assert(regional_alloc(r, 1024));
+	unit_assert(c.reused == 2 && c.malloced == 5 && c.num == 0);
+	/* larger than a chunk is malloced by itself */
+	a = regional_alloc(r, 10240);
+	unit_assert(a);
+	unit_assert(r->large_list != NULL);
+	regional_destroy(r);
+	unit_assert(c.num == 2);
+	regional_cache_clear(&c);
+	unit_assert(c.num == 0 && c.list == NULL);
+}
+
+/** number of query states in the regional throughput test */
+#define REGIONAL_PERF_NUM 200000
+/** number of query states in the regional chunk reuse check */
+#define REGIONAL_CHECK_NUM 2000
+
+/** allocate like a query state, mostly small, some deep (DNSSEC) queries
+ * use more chunks and large objects */
+static void
+regional_perf_query(struct regional* r, int deep)
+{
+	size_t i, n = deep?400:40;
+	void* a;
+	for(i=0; i<n; i++) {
+		a = regional_alloc(r, (i%10==9)?(deep?3000:500):64+(i%8)*32);
+		unit_assert(a);
+		*(char*)a = 0;
+	}
+}
+
+/** regionals for query states, with and without chunk cache, with
+ * unittest -b it is timed */
+static void
+regional_perf(int cache)
+{
+	struct alloc_cache super, alloc;
+	struct regional* r;
+	struct timeval start, end;
+	double dt;
+	int i, num = unit_bench?REGIONAL_PERF_NUM:REGIONAL_CHECK_NUM;
+	alloc_init(&super, NULL, 0);
+	alloc_init(&alloc, &super, 1);
+	if(!cache)
+		alloc.reg_cache.max = 0;
+	if(gettimeofday(&start, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	for(i=0; i<num; i++) {
+		r = alloc_reg_obtain(&alloc);
+		unit_assert(r);
+		regional_perf_query(r, (i%4==0));
+		alloc_reg_release(&alloc, r);
+	}
+	if(gettimeofday(&end, NULL) < 0)
+		fatal_exit("gettimeofday: %s", strerror(errno));
+	dt = (double)(end.tv_sec - start.tv_sec)*1000. + 
+		((double)end.tv_usec - (double)start.tv_usec)/1000.;
+	if(unit_bench)
+		printf("regional %s: %u query states in %g msec, %g/sec, "
+			"%u chunks reused %u malloced, first chunk %u\n",
+			cache?"chunk cache":"malloc", (unsigned)num, dt,
+			(double)num/(dt/1000.),
+			(unsigned)alloc.reg_cache.reused,
+			(unsigned)alloc.reg_cache.malloced,
+			(unsigned)alloc.reg_size);
+	if(cache) {
+		unit_assert(alloc.reg_cache.reused > alloc.reg_cache.malloced);
+	} else {
+		unit_assert(alloc.reg_cache.reused == 0);
+	}
+	/* the first chunk is sized for the deep queries */
+	unit_assert(alloc.reg_size > 16384);
+	alloc_clear(&alloc);
+	alloc_clear(&super);
+}
+
 void regional_test(void)
 {
 	unit_show_feature("regional");
 	specific_cases();
 	random_burden();
+	chunk_cache_test();
+	regional_perf(0);
+	regional_perf(1);
 }
@@ -45,11 +45,48 @@
 #include "util/data/packed_rrset.h"
 #include "util/fptr_wlist.h"
 
-/** custom size of cached regional blocks */
+/** custom size of cached regional blocks, the smallest first chunk */
 #define ALLOC_REG_SIZE	16384
+/** largest first chunk of regional blocks */
+#define ALLOC_REG_MAX	32768
+/** the first chunk size is a multiple of this */
+#define ALLOC_REG_GRAIN	4096
+/** the recent peak use of regional blocks decays by 1/this per release */
+#define ALLOC_REG_DECAY	64
+/** max number of free regional chunks kept per thread */
+#define ALLOC_REG_CHUNKS 128
 /** number of bits for ID part of uint64, rest for number of threads. */
 #define THRNUM_SHIFT	48	/* for 65k threads, 2^48 rrsets per thr. */
 
+/** size class for fixed size objects, ALLOC_OBJ_CLASSES if too large */
+static size_t
+alloc_obj_class(size_t size)
+{
+	if(size == 0)
+		return 0;
+	if(size > ALLOC_OBJ_GRAIN*ALLOC_OBJ_CLASSES)
+		return ALLOC_OBJ_CLASSES;
+	return (size-1)/ALLOC_OBJ_GRAIN;
+}
+
+/** free the fixed size objects on the freelists */
+static void
+alloc_obj_clear(struct alloc_cache* alloc)
+{
+	size_t i;
+	void* p, *np;
+	for(i=0; i<ALLOC_OBJ_CLASSES; i++) {
+		p = alloc->obj_list[i];
+		while(p) {
+			np = *(void**)p;
+			free(p);
+			p = np;
+		}
+		alloc->obj_list[i] = NULL;
+		alloc->obj_num[i] = 0;
+	}
+}
+
 /** setup new special type */
 static void
 alloc_setup_special(alloc_special_type* t)
@@ -88,11 +125,12 @@ prealloc_blocks(struct alloc_cache* alloc, size_t num)
 	size_t i;
 	struct regional* r;
 	for(i=0; i<num; i++) {
-		r = regional_create_custom(ALLOC_REG_SIZE);
+		r = regional_create_custom(alloc->reg_size);
 		if(!r) {
 			log_err("prealloc blocks: out of memory");
 			return;
 		}
+		regional_set_cache(r, &alloc->reg_cache);
 		r->next = (char*)alloc->reg_list;
 		alloc->reg_list = r;
 		alloc->num_reg_blocks ++;
@@ -116,14 +154,21 @@ alloc_init(struct alloc_cache* alloc, struct alloc_cache* super,
 	alloc->max_reg_blocks = 100;
 	alloc->num_reg_blocks = 0;
 	alloc->reg_list = NULL;
+	alloc->reg_size = ALLOC_REG_SIZE;
+	alloc->reg_peak = 0;
+	regional_cache_init(&alloc->reg_cache, ALLOC_REG_CHUNKS);
 	alloc->cleanup = NULL;
 	alloc->cleanup_arg = NULL;
+	alloc->max_obj = ALLOC_OBJ_MAX;
 	if(alloc->super)
 		prealloc_blocks(alloc, alloc->max_reg_blocks);
 	if(!alloc->super) {
+		if(!(alloc->depot = slab_depot_create()))
+			log_err("alloc_init: out of memory, no slab depot");
+		slab_cache_init(&alloc->slab, alloc->depot, 1);
 		lock_quick_init(&alloc->lock);
 		lock_protect(&alloc->lock, alloc, sizeof(*alloc));
-	}
+	} else	slab_cache_init(&alloc->slab, alloc->super->depot, 0);
 }
 
 void 
@@ -167,6 +212,13 @@ alloc_clear(struct alloc_cache* alloc)
 	}
 	alloc->reg_list = NULL;
 	alloc->num_reg_blocks = 0;
+	regional_cache_clear(&alloc->reg_cache);
+	alloc_obj_clear(alloc);
+	slab_cache_clear(&alloc->slab);
+	if(!alloc->super) {
+		slab_depot_delete(alloc->depot);
+		alloc->depot = NULL;
+	}
 }
 
 uint64_t
@@ -283,12 +335,26 @@ alloc_stats(struct alloc_cache* alloc)
 {
 	log_info("%salloc: %d in cache, %d blocks.", alloc->super?"":"sup",
 		(int)alloc->num_quar, (int)alloc->num_reg_blocks);
+	if(alloc->super) {
+		log_info("alloc objects: %u reused, %u malloced, %u freed.",
+			(unsigned)alloc->obj_reused,
+			(unsigned)alloc->obj_malloced,
+			(unsigned)alloc->obj_freed);
+		log_info("alloc regional chunks: %u reused, %u malloced, "
+			"%u freed, %u kept, first chunk %u.",
+			(unsigned)alloc->reg_cache.reused,
+			(unsigned)alloc->reg_cache.malloced,
+			(unsigned)alloc->reg_cache.freed,
+			(unsigned)alloc->reg_cache.num,
+			(unsigned)alloc->reg_size);
+	}
 }
 
 size_t alloc_get_mem(struct alloc_cache* alloc)
 {
 	alloc_special_type* p;
-	size_t s = sizeof(*alloc);
+	struct regional* r;
+	size_t s = sizeof(*alloc), i;
 	if(!alloc->super) { 
 		lock_quick_lock(&alloc->lock); /* superalloc needs locking */
 	}
@@ -296,7 +362,14 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 	for(p = alloc->quar; p; p = alloc_special_next(p)) {
 		s += lock_get_mem(&p->entry.lock);
 	}
-	s += alloc->num_reg_blocks * ALLOC_REG_SIZE;
+	for(r = alloc->reg_list; r; r = (struct regional*)r->next)
+		s += r->first_size;
+	s += regional_cache_get_mem(&alloc->reg_cache);
+	for(i=0; i<ALLOC_OBJ_CLASSES; i++)
+		s += alloc->obj_num[i] * (i+1) * ALLOC_OBJ_GRAIN;
+	for(i=0; i<SLAB_CLASSES; i++)
+		if(alloc->slab.mag[i])
+			s += sizeof(struct slab_mag);
 	if(!alloc->super) {
 		lock_quick_unlock(&alloc->lock);
 	}
@@ -306,24 +379,50 @@ size_t alloc_get_mem(struct alloc_cache* alloc)
 struct regional* 
 alloc_reg_obtain(struct alloc_cache* alloc)
 {
+	struct regional* r;
 	if(alloc->num_reg_blocks > 0) {
-		struct regional* r = alloc->reg_list;
+		r = alloc->reg_list;
 		alloc->reg_list = (struct regional*)r->next;
 		r->next = NULL;
 		alloc->num_reg_blocks--;
 		return r;
 	}
-	return regional_create_custom(ALLOC_REG_SIZE);
+	r = regional_create_custom(alloc->reg_size);
+	if(r)
+		regional_set_cache(r, &alloc->reg_cache);
+	return r;
+}
+
+/** learn the first chunk size of regional blocks from the recent peak
+ * use, so that most query states fit in their first chunk */
+static void
+alloc_reg_learn(struct alloc_cache* alloc, struct regional* r)
+{
+	size_t used = regional_get_mem(r);
+	alloc->reg_peak -= alloc->reg_peak/ALLOC_REG_DECAY;
+	if(used > alloc->reg_peak)
+		alloc->reg_peak = used;
+	alloc->reg_size = (alloc->reg_peak + ALLOC_REG_GRAIN - 1) &
+		~((size_t)ALLOC_REG_GRAIN - 1);
+	if(alloc->reg_size < ALLOC_REG_SIZE)
+		alloc->reg_size = ALLOC_REG_SIZE;
+	if(alloc->reg_size > ALLOC_REG_MAX)
+		alloc->reg_size = ALLOC_REG_MAX;
 }
 
 void 
 alloc_reg_release(struct alloc_cache* alloc, struct regional* r)
 {
-	if(alloc->num_reg_blocks >= alloc->max_reg_blocks) {
+	if(!r) return;
+	alloc_reg_learn(alloc, r);
+	/* blocks that are too small or too large for the learned size
+	 * are replaced by new blocks */
+	if(alloc->num_reg_blocks >= alloc->max_reg_blocks ||
+		r->first_size < alloc->reg_size ||
+		r->first_size > alloc->reg_size*2) {
 		regional_destroy(r);
 		return;
 	}
-	if(!r) return;
 	regional_free_all(r);
 	log_assert(r->next == NULL);
 	r->next = (char*)alloc->reg_list;
@@ -331,6 +430,63 @@ alloc_reg_release(struct alloc_cache* alloc, struct regional* r)
 	alloc->num_reg_blocks++;
 }
 
+void*
+alloc_obj_obtain(struct alloc_cache* alloc, size_t size)
+{
+	size_t c = alloc_obj_class(size);
+	void* p;
+	log_assert(alloc->super);
+	if(c < ALLOC_OBJ_CLASSES && alloc->obj_list[c]) {
+		p = alloc->obj_list[c];
+		alloc->obj_list[c] = *(void**)p;
+		alloc->obj_num[c]--;
+		stat_inc(alloc->obj_reused);
+		return p;
+	}
+	stat_inc(alloc->obj_malloced);
+	/* malloc the full class size, so it can be reused for the class */
+	if(c < ALLOC_OBJ_CLASSES)
+		return malloc((c+1)*ALLOC_OBJ_GRAIN);
+	return malloc(size);
+}
+
+void
+alloc_obj_release(struct alloc_cache* alloc, void* obj, size_t size)
+{
+	size_t c = alloc_obj_class(size);
+	if(!obj)
+		return;
+	if(c >= ALLOC_OBJ_CLASSES || alloc->obj_num[c] >= alloc->max_obj) {
+		stat_inc(alloc->obj_freed);
+		free(obj);
+		return;
+	}
+	*(void**)obj = alloc->obj_list[c];
+	alloc->obj_list[c] = obj;
+	alloc->obj_num[c]++;
+}
+
+void*
+alloc_data_obtain(struct alloc_cache* alloc, size_t size)
+{
+	return slab_alloc(&alloc->slab, size);
+}
+
+void*
+alloc_data_dup(struct alloc_cache* alloc, const void* data, size_t size)
+{
+	void* p = slab_alloc(&alloc->slab, size);
+	if(p)
+		memcpy(p, data, size);
+	return p;
+}
+
+void
+alloc_data_release(struct alloc_cache* alloc, void* data, size_t size)
+{
+	slab_free(&alloc->slab, data, size);
+}
+
 void 
 alloc_set_id_cleanup(struct alloc_cache* alloc, void (*cleanup)(void*),
         void* arg)
@@ -49,8 +49,9 @@
 #define UTIL_ALLOC_H
 
 #include "util/locks.h"
+#include "util/slaballoc.h"
+#include "util/regional.h"
 struct ub_packed_rrset_key;
-struct regional;
 
 /** The special type, packed rrset. Not allowed to be used for other memory */
 typedef struct ub_packed_rrset_key alloc_special_type;
@@ -65,6 +66,13 @@ typedef struct ub_packed_rrset_key alloc_special_type;
 /** how many blocks to cache locally. */
 #define ALLOC_SPECIAL_MAX 10
 
+/** size granularity of the fixed size object freelists */
+#define ALLOC_OBJ_GRAIN 64
+/** number of fixed size object classes, larger objects are malloced */
+#define ALLOC_OBJ_CLASSES 16
+/** default max number of objects kept on a fixed size object freelist */
+#define ALLOC_OBJ_MAX 1024
+
 /**
  * Structure that provides allocation. Use one per thread.
  * The one on top has a NULL super pointer.
@@ -95,6 +103,37 @@ struct alloc_cache {
 	size_t num_reg_blocks;
 	/** linked list of regional blocks, using regional->next */
 	struct regional* reg_list;
+	/** first chunk size of new regional blocks, learned from the
+	 * recent peak use of the blocks */
+	size_t reg_size;
+	/** recent peak memory use of the released regional blocks, it
+	 * decays a little with every release */
+	size_t reg_peak;
+	/** cache of free chunks for the regional blocks, the chunks after
+	 * the first are reused by the next query states */
+	struct regional_cache reg_cache;
+
+	/** freelists of fixed size objects (mesh states, replies, outbound
+	 * entries), per size class. The next pointer is stored in the
+	 * first bytes of the free object. Only for thread local allocs. */
+	void* obj_list[ALLOC_OBJ_CLASSES];
+	/** number of free objects on each freelist */
+	size_t obj_num[ALLOC_OBJ_CLASSES];
+	/** max number of objects to keep per freelist, 0 disables it */
+	size_t max_obj;
+	/** stats, number of objects handed out from the freelists */
+	size_t obj_reused;
+	/** stats, number of objects that had to be malloced */
+	size_t obj_malloced;
+	/** stats, number of objects freed because the freelist was full */
+	size_t obj_freed;
+
+	/** slab depot for the cache storage, only in the super, the
+	 * other allocs use the depot of their super. */
+	struct slab_depot* depot;
+	/** slab allocator with the magazines of this thread, for the
+	 * super it is shared and locks the depot. */
+	struct slab_cache slab;
 };
 
 /**
@@ -153,19 +192,71 @@ size_t alloc_get_mem(struct alloc_cache* alloc);
 void alloc_stats(struct alloc_cache* alloc);
 
 /**
- * Get a new regional for query states
+ * Get a new regional for query states.  Its first chunk is sized from
+ * the recent peak use of the regionals, and the other chunks come from
+ * the chunk cache of the alloc.
  * @param alloc: where to alloc it.
  * @return regional for use or NULL on alloc failure.
  */
 struct regional* alloc_reg_obtain(struct alloc_cache* alloc);
 
 /**
- * Put regional for query states back into alloc cache.
+ * Put regional for query states back into alloc cache.  Its chunks go
+ * to the chunk cache, and its memory use is taken into the first chunk
+ * size of new regionals.
  * @param alloc: where to alloc it.
  * @param r: regional to put back.
  */
 void alloc_reg_release(struct alloc_cache* alloc, struct regional* r);
 
+/**
+ * Get a fixed size object. Objects of the same size class are recycled
+ * from a thread local freelist, so that query states that are created
+ * and deleted at a high rate do not need malloc and free.
+ * Not for the super alloc, there is no locking.
+ * @param alloc: where to alloc it.
+ * @param size: size of the object, pass the same size to release.
+ * @return object (not zeroed) or NULL on alloc failure.
+ */
+void* alloc_obj_obtain(struct alloc_cache* alloc, size_t size);
+
+/**
+ * Put a fixed size object back into the alloc cache.
+ * @param alloc: where to alloc it.
+ * @param obj: the object from alloc_obj_obtain, if NULL nothing happens.
+ * @param size: size of the object, as passed to alloc_obj_obtain.
+ */
+void alloc_obj_release(struct alloc_cache* alloc, void* obj, size_t size);
+
+/**
+ * Get memory for cache storage, the rrset data and owner name. It is
+ * allocated from the slabs for its size class, and can be released with
+ * another alloc that has the same super.
+ * @param alloc: where to alloc it.
+ * @param size: size of the memory.
+ * @return memory (not zeroed) or NULL on alloc failure.
+ */
+void* alloc_data_obtain(struct alloc_cache* alloc, size_t size);
+
+/**
+ * Get memory for cache storage, with a copy of the data.
+ * @param alloc: where to alloc it.
+ * @param data: the data to copy.
+ * @param size: size of the data.
+ * @return memory or NULL on alloc failure.
+ */
+void* alloc_data_dup(struct alloc_cache* alloc, const void* data,
+	size_t size);
+
+/**
+ * Release memory for cache storage.
+ * @param alloc: where to alloc it, with the same super as the alloc that
+ *	the memory was obtained from.
+ * @param data: the memory, if NULL nothing happens.
+ * @param size: size of the memory, as passed to alloc_data_obtain.
+ */
+void alloc_data_release(struct alloc_cache* alloc, void* data, size_t size);
+
 /**
  * Set cleanup on ID overflow callback function. This should remove all
  * RRset ID references from the program. Clear the caches.
@@ -94,6 +94,7 @@ config_create(void)
 	cfg->stat_interval = 0;
 	cfg->stat_cumulative = 0;
 	cfg->stat_extended = 0;
+	cfg->heavy_hitters_size = 32;
 	cfg->num_threads = 1;
 	cfg->port = UNBOUND_DNS_PORT;
 	cfg->do_ip4 = 1;
@@ -114,6 +115,7 @@ config_create(void)
 	cfg->log_time_ascii = 0;
 	cfg->log_queries = 0;
 	cfg->log_replies = 0;
+	cfg->log_module_time = 0;
 #ifndef USE_WINSOCK
 #  ifdef USE_MINI_EVENT
 	/* select max 1024 sockets */
@@ -136,9 +138,11 @@ config_create(void)
 	cfg->msg_buffer_size = 65552; /* 64 k + a small margin */
 	cfg->msg_cache_size = 4 * 1024 * 1024;
 	cfg->msg_cache_slabs = 4;
+	cfg->msg_cache_wireformat = 1;
 	cfg->jostle_time = 200;
 	cfg->rrset_cache_size = 4 * 1024 * 1024;
 	cfg->rrset_cache_slabs = 4;
+	cfg->cache_huge_pages = 0;
 	cfg->host_ttl = 900;
 	cfg->bogus_ttl = 60;
 	cfg->min_ttl = 0;
@@ -266,6 +270,14 @@ config_create(void)
 	if(!(cfg->dnstap_socket_path = strdup(DNSTAP_SOCKET_PATH)))
 		goto error_exit;
 #endif
+	cfg->dnstap_ring_size = 1024*1024;
+	cfg->dnstap_sample_resolver_query_messages = 100;
+	cfg->dnstap_sample_resolver_response_messages = 100;
+	cfg->dnstap_sample_client_query_messages = 100;
+	cfg->dnstap_sample_client_response_messages = 100;
+	cfg->dnstap_sample_forwarder_query_messages = 100;
+	cfg->dnstap_sample_forwarder_response_messages = 100;
+	cfg->dnstap_sample_keep_servfail = 1;
 	cfg->disable_dnssec_lame_check = 0;
 	cfg->ip_ratelimit = 0;
 	cfg->ratelimit = 0;
@@ -279,6 +291,10 @@ config_create(void)
 	cfg->ratelimit_factor = 10;
 	cfg->qname_minimisation = 0;
 	cfg->qname_minimisation_strict = 0;
+	cfg->upstream_race = 0;
+	cfg->upstream_race_delay = 30;
+	cfg->upstream_race_max = 2;
+	cfg->upstream_race_budget = 100;
 	cfg->shm_enable = 0;
 	cfg->shm_key = 11777;
 	cfg->dnscrypt = 0;
@@ -430,6 +446,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_STR("log-identity:", log_identity)
 	else S_YNO("extended-statistics:", stat_extended)
 	else S_YNO("statistics-cumulative:", stat_cumulative)
+	else S_SIZET_OR_ZERO("heavy-hitters-size:", heavy_hitters_size)
 	else S_YNO("shm-enable:", shm_enable)
 	else S_NUMBER_OR_ZERO("shm-key:", shm_key)
 	else S_YNO("do-ip4:", do_ip4)
@@ -458,6 +475,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_SIZET_NONZERO("msg-buffer-size:", msg_buffer_size)
 	else S_MEMSIZE("msg-cache-size:", msg_cache_size)
 	else S_POW2("msg-cache-slabs:", msg_cache_slabs)
+	else S_YNO("msg-cache-wireformat:", msg_cache_wireformat)
 	else S_SIZET_NONZERO("num-queries-per-thread:",num_queries_per_thread)
 	else S_SIZET_OR_ZERO("jostle-timeout:", jostle_time)
 	else S_MEMSIZE("so-rcvbuf:", so_rcvbuf)
@@ -467,6 +485,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("ip-freebind:", ip_freebind)
 	else S_MEMSIZE("rrset-cache-size:", rrset_cache_size)
 	else S_POW2("rrset-cache-slabs:", rrset_cache_slabs)
+	else S_YNO("cache-huge-pages:", cache_huge_pages)
 	else S_YNO("prefetch:", prefetch)
 	else S_YNO("prefetch-key:", prefetch_key)
 	else if(strcmp(opt, "cache-max-ttl:") == 0)
@@ -522,6 +541,7 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_YNO("val-log-squelch:", val_log_squelch)
 	else S_YNO("log-queries:", log_queries)
 	else S_YNO("log-replies:", log_replies)
+	else S_YNO("log-module-time:", log_module_time)
 	else S_YNO("val-permissive-mode:", val_permissive_mode)
 	else S_YNO("aggressive-nsec:", aggressive_nsec)
 	else S_YNO("ignore-cd-flag:", ignore_cd)
@@ -576,6 +596,43 @@ int config_set_option(struct config_file* cfg, const char* opt,
 		dnstap_log_forwarder_query_messages)
 	else S_YNO("dnstap-log-forwarder-response-messages:",
 		dnstap_log_forwarder_response_messages)
+	else S_STR("dnstap-ip:", dnstap_ip)
+	else S_STR("dnstap-file:", dnstap_file)
+	else S_MEMSIZE("dnstap-file-rotate-size:", dnstap_file_rotate_size)
+	else S_MEMSIZE("dnstap-ring-size:", dnstap_ring_size)
+	else S_NUMBER_OR_ZERO("dnstap-file-rotate-interval:",
+		dnstap_file_rotate_interval)
+	else if(strcmp(opt, "dnstap-sample-resolver-query-messages:") == 0) {
+		IS_NUMBER_OR_ZERO;
+		if(atoi(val) < 0 || atoi(val) > 100) return 0;
+		cfg->dnstap_sample_resolver_query_messages = atoi(val);
+	}
+	else if(strcmp(opt, "dnstap-sample-resolver-response-messages:") == 0) {
+		IS_NUMBER_OR_ZERO;
+		if(atoi(val) < 0 || atoi(val) > 100) return 0;
+		cfg->dnstap_sample_resolver_response_messages = atoi(val);
+	}
+	else if(strcmp(opt, "dnstap-sample-client-query-messages:") == 0) {
+		IS_NUMBER_OR_ZERO;
+		if(atoi(val) < 0 || atoi(val) > 100) return 0;
+		cfg->dnstap_sample_client_query_messages = atoi(val);
+	}
+	else if(strcmp(opt, "dnstap-sample-client-response-messages:") == 0) {
+		IS_NUMBER_OR_ZERO;
+		if(atoi(val) < 0 || atoi(val) > 100) return 0;
+		cfg->dnstap_sample_client_response_messages = atoi(val);
+	}
+	else if(strcmp(opt, "dnstap-sample-forwarder-query-messages:") == 0) {
+		IS_NUMBER_OR_ZERO;
+		if(atoi(val) < 0 || atoi(val) > 100) return 0;
+		cfg->dnstap_sample_forwarder_query_messages = atoi(val);
+	}
+	else if(strcmp(opt, "dnstap-sample-forwarder-response-messages:") == 0) {
+		IS_NUMBER_OR_ZERO;
+		if(atoi(val) < 0 || atoi(val) > 100) return 0;
+		cfg->dnstap_sample_forwarder_response_messages = atoi(val);
+	}
+	else S_YNO("dnstap-sample-keep-servfail:", dnstap_sample_keep_servfail)
 #endif
 #ifdef USE_DNSCRYPT
 	else S_YNO("dnscrypt-enable:", dnscrypt)
@@ -604,11 +661,16 @@ int config_set_option(struct config_file* cfg, const char* opt,
 	else S_MEMSIZE("ip-ratelimit-size:", ip_ratelimit_size)
 	else S_MEMSIZE("ratelimit-size:", ratelimit_size)
 	else S_POW2("ip-ratelimit-slabs:", ip_ratelimit_slabs)
+	else S_YNO("ip-ratelimit-sketch:", ip_ratelimit_sketch)
 	else S_POW2("ratelimit-slabs:", ratelimit_slabs)
 	else S_NUMBER_OR_ZERO("ip-ratelimit-factor:", ip_ratelimit_factor)
 	else S_NUMBER_OR_ZERO("ratelimit-factor:", ratelimit_factor)
 	else S_YNO("qname-minimisation:", qname_minimisation)
 	else S_YNO("qname-minimisation-strict:", qname_minimisation_strict)
+	else S_YNO("upstream-race:", upstream_race)
+	else S_NUMBER_OR_ZERO("upstream-race-delay:", upstream_race_delay)
+	else S_NUMBER_OR_ZERO("upstream-race-max:", upstream_race_max)
+	else S_NUMBER_OR_ZERO("upstream-race-budget:", upstream_race_budget)
 #ifdef USE_IPSECMOD
 	else S_YNO("ipsecmod-enabled:", ipsecmod_enabled)
 	else S_YNO("ipsecmod-ignore-bogus:", ipsecmod_ignore_bogus)
@@ -807,6 +869,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	O_DEC(opt, "verbosity", verbosity)
 	else O_DEC(opt, "statistics-interval", stat_interval)
 	else O_YNO(opt, "statistics-cumulative", stat_cumulative)
+	else O_DEC(opt, "heavy-hitters-size", heavy_hitters_size)
 	else O_YNO(opt, "extended-statistics", stat_extended)
 	else O_YNO(opt, "shm-enable", shm_enable)
 	else O_DEC(opt, "shm-key", shm_key)
@@ -825,6 +888,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "msg-buffer-size", msg_buffer_size)
 	else O_MEM(opt, "msg-cache-size", msg_cache_size)
 	else O_DEC(opt, "msg-cache-slabs", msg_cache_slabs)
+	else O_YNO(opt, "msg-cache-wireformat", msg_cache_wireformat)
 	else O_DEC(opt, "num-queries-per-thread", num_queries_per_thread)
 	else O_UNS(opt, "jostle-timeout", jostle_time)
 	else O_MEM(opt, "so-rcvbuf", so_rcvbuf)
@@ -834,6 +898,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_YNO(opt, "ip-freebind", ip_freebind)
 	else O_MEM(opt, "rrset-cache-size", rrset_cache_size)
 	else O_DEC(opt, "rrset-cache-slabs", rrset_cache_slabs)
+	else O_YNO(opt, "cache-huge-pages", cache_huge_pages)
 	else O_YNO(opt, "prefetch-key", prefetch_key)
 	else O_YNO(opt, "prefetch", prefetch)
 	else O_DEC(opt, "cache-max-ttl", max_ttl)
@@ -866,6 +931,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_STR(opt, "logfile", logfile)
 	else O_YNO(opt, "log-queries", log_queries)
 	else O_YNO(opt, "log-replies", log_replies)
+	else O_YNO(opt, "log-module-time", log_module_time)
 	else O_STR(opt, "pidfile", pidfile)
 	else O_YNO(opt, "hide-identity", hide_identity)
 	else O_YNO(opt, "hide-version", hide_version)
@@ -950,6 +1016,26 @@ config_get_option(struct config_file* cfg, const char* opt,
 		dnstap_log_forwarder_query_messages)
 	else O_YNO(opt, "dnstap-log-forwarder-response-messages",
 		dnstap_log_forwarder_response_messages)
+	else O_STR(opt, "dnstap-ip", dnstap_ip)
+	else O_STR(opt, "dnstap-file", dnstap_file)
+	else O_MEM(opt, "dnstap-file-rotate-size", dnstap_file_rotate_size)
+	else O_MEM(opt, "dnstap-ring-size", dnstap_ring_size)
+	else O_DEC(opt, "dnstap-file-rotate-interval",
+		dnstap_file_rotate_interval)
+	else O_DEC(opt, "dnstap-sample-resolver-query-messages",
+		dnstap_sample_resolver_query_messages)
+	else O_DEC(opt, "dnstap-sample-resolver-response-messages",
+		dnstap_sample_resolver_response_messages)
+	else O_DEC(opt, "dnstap-sample-client-query-messages",
+		dnstap_sample_client_query_messages)
+	else O_DEC(opt, "dnstap-sample-client-response-messages",
+		dnstap_sample_client_response_messages)
+	else O_DEC(opt, "dnstap-sample-forwarder-query-messages",
+		dnstap_sample_forwarder_query_messages)
+	else O_DEC(opt, "dnstap-sample-forwarder-response-messages",
+		dnstap_sample_forwarder_response_messages)
+	else O_YNO(opt, "dnstap-sample-keep-servfail",
+		dnstap_sample_keep_servfail)
 #endif
 #ifdef USE_DNSCRYPT
 	else O_YNO(opt, "dnscrypt-enable", dnscrypt)
@@ -977,6 +1063,7 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_MEM(opt, "ip-ratelimit-size", ip_ratelimit_size)
 	else O_MEM(opt, "ratelimit-size", ratelimit_size)
 	else O_DEC(opt, "ip-ratelimit-slabs", ip_ratelimit_slabs)
+	else O_YNO(opt, "ip-ratelimit-sketch", ip_ratelimit_sketch)
 	else O_DEC(opt, "ratelimit-slabs", ratelimit_slabs)
 	else O_LS2(opt, "ratelimit-for-domain", ratelimit_for_domain)
 	else O_LS2(opt, "ratelimit-below-domain", ratelimit_below_domain)
@@ -986,6 +1073,10 @@ config_get_option(struct config_file* cfg, const char* opt,
 	else O_DEC(opt, "val-sig-skew-max", val_sig_skew_max)
 	else O_YNO(opt, "qname-minimisation", qname_minimisation)
 	else O_YNO(opt, "qname-minimisation-strict", qname_minimisation_strict)
+	else O_YNO(opt, "upstream-race", upstream_race)
+	else O_DEC(opt, "upstream-race-delay", upstream_race_delay)
+	else O_DEC(opt, "upstream-race-max", upstream_race_max)
+	else O_DEC(opt, "upstream-race-budget", upstream_race_budget)
 	else O_IFC(opt, "define-tag", num_tags, tagname)
 	else O_LTG(opt, "local-zone-tag", local_zone_tags)
 	else O_LTG(opt, "access-control-tag", acl_tags)
@@ -1326,6 +1417,8 @@ config_delete(struct config_file* cfg)
 	free(cfg->dnstap_socket_path);
 	free(cfg->dnstap_identity);
 	free(cfg->dnstap_version);
+	free(cfg->dnstap_ip);
+	free(cfg->dnstap_file);
 	config_deldblstrlist(cfg->ratelimit_for_domain);
 	config_deldblstrlist(cfg->ratelimit_below_domain);
 #ifdef USE_IPSECMOD
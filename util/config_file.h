@@ -67,6 +67,8 @@ struct config_file {
 	int stat_cumulative;
 	/** if true, the statistics are kept in greater detail */
 	int stat_extended;
+	/** number of heavy hitters tracked per category per thread */
+	size_t heavy_hitters_size;
 
 	/** number of threads to create */
 	int num_threads;
@@ -122,6 +124,8 @@ struct config_file {
 	size_t msg_cache_size;
 	/** slabs in the message cache. */
 	size_t msg_cache_slabs;
+	/** precompute the wireformat of the replies in the message cache */
+	int msg_cache_wireformat;
 	/** number of queries every thread can service */
 	size_t num_queries_per_thread;
 	/** number of msec to wait before items can be jostled out */
@@ -130,6 +134,8 @@ struct config_file {
 	size_t rrset_cache_size;
 	/** slabs in the rrset cache */
 	size_t rrset_cache_slabs;
+	/** allocate the caches from huge pages */
+	int cache_huge_pages;
 	/** host cache ttl in seconds */
 	int host_ttl;
 	/** number of slabs in the infra host cache */
@@ -254,6 +260,8 @@ struct config_file {
 	int log_queries;
 	/** log replies with one line per reply */
 	int log_replies;
+	/** log the time spent per module, for every query */
+	int log_module_time;
 	/** log identity to report */
 	char* log_identity;
 
@@ -429,6 +437,31 @@ struct config_file {
 	int dnstap_log_forwarder_query_messages;
 	/** true to log dnstap FORWARDER_RESPONSE message events */
 	int dnstap_log_forwarder_response_messages;
+	/** dnstap TCP collector, "ip@port", if set used instead of the
+	 * socket path */
+	char* dnstap_ip;
+	/** dnstap output file, if set used instead of the socket */
+	char* dnstap_file;
+	/** size in bytes after which the dnstap file is rotated, 0 is off */
+	size_t dnstap_file_rotate_size;
+	/** seconds after which the dnstap file is rotated, 0 is off */
+	int dnstap_file_rotate_interval;
+	/** size in bytes of the dnstap ring buffer of a thread */
+	size_t dnstap_ring_size;
+	/** percentage of dnstap RESOLVER_QUERY message events that is logged */
+	int dnstap_sample_resolver_query_messages;
+	/** percentage of dnstap RESOLVER_RESPONSE message events that is logged */
+	int dnstap_sample_resolver_response_messages;
+	/** percentage of dnstap CLIENT_QUERY message events that is logged */
+	int dnstap_sample_client_query_messages;
+	/** percentage of dnstap CLIENT_RESPONSE message events that is logged */
+	int dnstap_sample_client_response_messages;
+	/** percentage of dnstap FORWARDER_QUERY message events that is logged */
+	int dnstap_sample_forwarder_query_messages;
+	/** percentage of dnstap FORWARDER_RESPONSE message events that is logged */
+	int dnstap_sample_forwarder_response_messages;
+	/** true to log SERVFAIL responses regardless of the sample rate */
+	int dnstap_sample_keep_servfail;
 
 	/** true to disable DNSSEC lameness check in iterator */
 	int disable_dnssec_lame_check;
@@ -439,6 +472,8 @@ struct config_file {
 	size_t ip_ratelimit_slabs;
 	/** memory size in bytes for ip_ratelimit cache */
 	size_t ip_ratelimit_size;
+	/** track the ip rates in a count-min sketch instead of a cache */
+	int ip_ratelimit_sketch;
 	/** ip_ratelimit factor, 0 blocks all, 10 allows 1/10 of traffic */
 	int ip_ratelimit_factor;
 
@@ -459,6 +494,14 @@ struct config_file {
 	/** minimise QNAME in strict mode, minimise according to RFC.
 	 *  Do not apply fallback */
 	int qname_minimisation_strict;
+	/** race a second upstream server if the first is slow to answer */
+	int upstream_race;
+	/** minimum delay before the race query is sent, in msec */
+	int upstream_race_delay;
+	/** max number of race queries per query */
+	int upstream_race_max;
+	/** max number of race queries outstanding, for all threads */
+	int upstream_race_budget;
 	/** SHM data - true if shm is enabled */
 	int shm_enable;
 	/** SHM data - key for the shm */
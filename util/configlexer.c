@@ -1,7 +1,7 @@
 #include "config.h"
 #include "util/configyyrename.h"
 
-#line 3 "<stdout>"
+#line 5 "<stdout>"
 
 #define  YY_INT_ALIGNED short int
 
@@ -363,8 +363,8 @@ static void yynoreturn yy_fatal_error (yyconst char* msg  );
 	*yy_cp = '\0'; \
 	(yy_c_buf_p) = yy_cp;
 
-#define YY_NUM_RULES 259
-#define YY_END_OF_BUFFER 260
+#define YY_NUM_RULES 280
+#define YY_END_OF_BUFFER 281
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -372,2024 +372,2651 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static yyconst flex_int16_t yy_accept[2563] =
+static yyconst flex_int16_t yy_accept[2867] =
     {   0,
-        1,    1,  241,  241,  245,  245,  249,  249,  253,  253,
-        1,    1,  260,  257,    1,  239,  239,  258,    2,  258,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  241,  242,  242,  243,  258,  245,  246,  246,
-      247,  258,  252,  249,  250,  250,  251,  258,  253,  254,
-      254,  255,  258,  256,  240,    2,  244,  258,  256,  257,
-        0,    1,    2,    2,    2,    2,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  241,    0,
-      245,    0,  252,    0,  249,  253,    0,  256,    0,    2,
-        2,  256,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  256,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  101,  257,  257,  257,  257,
-      257,  257,  257,  256,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,   85,  257,
-
-      257,  257,  257,  257,  257,    8,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  105,  257,  256,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      256,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,   45,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  188,  257,   14,   15,  257,   18,
-       17,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  100,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  174,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,    3,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  256,  257,  257,  257,  257,  257,  257,
-      233,  257,  257,  232,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  248,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,   48,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,   49,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  163,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,   20,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  120,  257,  257,
-      248,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  215,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  138,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  119,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,   83,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,   28,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,   29,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,   46,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,   99,  257,  257,  257,  257,   98,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,   47,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  139,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,   36,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  203,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,   40,  257,   41,  257,  257,
-      257,  257,   86,  257,   87,  257,  257,  257,   84,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,    7,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  181,  257,  257,
-      257,  257,  122,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,   37,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  155,  257,  154,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,   16,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,   50,  257,  257,
-      257,  257,  257,  257,  257,  162,  257,  257,  257,  257,
-      257,   89,   88,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  149,  257,  257,  257,
-      257,  257,  257,  257,  257,  106,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,   68,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-       72,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,   44,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  152,  153,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,    6,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  213,  257,  257,  234,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,   34,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      145,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  167,  257,  146,  257,  257,  179,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,   35,  257,  257,  257,
-      257,  257,  257,  103,   93,  257,   94,  257,  257,   92,
-      257,  257,  257,  257,  257,  257,  257,  257,  117,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      202,  257,  257,  257,  257,  257,  257,  257,  257,  147,
-      257,  257,  257,  257,  257,  150,  257,  257,  178,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,   82,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,   42,  257,  257,  257,   22,  257,  257,
-      257,  257,  257,   19,  257,  257,  257,   23,  257,  127,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,   57,   59,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  217,  257,  257,  257,  189,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,   95,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  116,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  228,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  121,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  173,  257,  257,  257,  257,
-      257,  257,  257,  257,  237,  257,  257,  257,  257,  257,
-      257,  257,  137,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  132,  257,  140,  257,  257,  257,  257,
-      257,  109,  257,  257,  257,  257,  257,   78,  257,  257,
-
-      257,  257,  165,  257,  257,  257,  257,  257,  180,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  194,  257,  257,  257,  257,  257,  257,  102,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  136,  257,
-      257,  257,  257,  257,   60,   61,  257,  257,  257,  257,
-      257,   43,  257,  257,  257,  257,  257,   67,  141,  257,
-      156,  257,  182,  151,  257,  257,  257,   53,  257,  143,
-      257,  257,  257,  257,  257,    9,  257,  257,  257,   81,
-      257,  257,  257,  257,  207,  257,  257,  257,  164,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  135,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  123,  216,  257,  257,
-      257,  257,  193,  257,  257,  257,  257,  257,  257,  257,
-      257,  175,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  231,  257,  142,
-      257,  257,  257,   52,   54,  257,  257,  257,  257,  257,
-      257,  257,   80,  257,  257,  257,  257,  205,  257,  257,
-
-      257,  212,  257,  257,  257,  257,  257,  169,   30,   24,
-       26,  257,  257,  257,  257,  257,   31,   25,   27,  257,
-      257,  257,  257,  257,  257,   77,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  171,  168,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,   51,  257,
-      104,  257,  257,  257,  257,  257,  257,  257,  257,  118,
-       13,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      226,  257,  229,  257,  257,  257,  257,  257,  257,   12,
-      257,  257,   21,  257,  257,  257,  211,  257,  257,  257,
-
-      214,   55,  257,  177,  257,  170,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  131,  130,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  172,  166,  257,  257,  257,  218,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-       62,  257,  257,  257,  206,  257,  257,  257,  257,  257,
-      176,  257,  257,  257,  257,  257,  257,  257,  257,  235,
-      236,   56,  257,  257,  257,   90,   91,  257,  124,  257,
-      126,  257,  157,  257,  257,  257,  129,  257,  257,  183,
-
-      257,  257,  257,  257,  257,  257,  257,  111,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  190,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  158,  257,  257,  204,  257,  230,
-      257,  257,  257,   38,  257,  257,  257,  257,    4,  257,
-      257,  110,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  186,   32,   33,  257,  257,  257,  257,
-      257,  257,  257,  219,  257,  257,  257,  257,  257,  257,
-      192,  257,  257,  161,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,   65,  257,   39,  210,  257,  187,  257,
-
-      257,   11,  257,  257,  257,  257,  257,  257,  159,   69,
-      257,  257,  257,  257,  257,  134,  257,  257,  257,  257,
-      257,  113,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  191,  107,  257,   96,   97,  257,  257,  257,   71,
-       75,   70,  257,   63,  257,  257,  257,   10,  257,  257,
-      257,  208,  257,  257,  257,  257,  133,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,   76,   74,  257,   64,  227,  257,
-      257,  257,  148,  257,  257,  160,  257,  257,  257,  257,
-      257,  257,  125,   58,  257,  257,  257,  257,  257,  220,
-
-      257,  257,  257,  257,  257,  257,  257,  108,   73,  114,
-      115,   66,  257,  209,  128,  257,  257,  257,  257,  185,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,   79,  257,  184,  257,  201,  224,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,    5,  257,  257,  257,
-      225,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  112,  257,  257,  257,  257,  257,  257,  257,
-
-      257,  257,  144,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  221,  257,  257,  257,  257,  257,  257,  257,
-      257,  257,  257,  257,  257,  257,  257,  257,  257,  257,
-      238,  257,  257,  197,  257,  257,  257,  257,  257,  222,
-      257,  257,  257,  257,  257,  257,  223,  257,  257,  257,
-      195,  257,  198,  199,  257,  257,  257,  257,  257,  196,
-      200,    0
+       1,    1,  262,  262,  266,  266,  270,  270,  274,  274,
+       1,    1,  281,  278,    1,  260,  260,  279,    2,  279,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  262,  263,  263,  264,  279,  266,  267,  267,
+     268,  279,  273,  270,  271,  271,  272,  279,  274,  275,
+     275,  276,  279,  277,  261,    2,  265,  279,  277,  278,
+       0,    1,    2,    2,    2,    2,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  262,    0,  262,  266,    0,  266,  273,    0,  270,
+     273,  274,    0,  274,  277,    0,    2,    2,  277,  277,
+       2,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,    2,  277,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  107,
+     278,  278,  278,  278,  278,  278,  278,  277,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,   91,  278,  278,  278,  278,  278,
+     278,   12,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  111,  278,  277,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     277,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,   49,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  196,  278,   18,   19,  278,   22,
+      21,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     106,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  182,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,    3,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  277,  278,  278,  278,
+     278,  278,  278,  254,  278,  278,  253,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  269,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,   52,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,   53,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  171,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+      24,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  126,  278,  278,  269,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  236,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  144,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     125,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,   89,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,   32,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,   33,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,   50,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  105,  278,  278,  278,  278,
+     104,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,   51,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  209,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  145,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,   40,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  223,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,   44,  278,   45,  278,  278,  278,  278,
+
+      92,  278,   93,  278,  278,  278,   90,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,   11,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  189,  278,  278,  278,
+     278,  128,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+      41,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  162,  278,  161,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,   20,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+      54,  278,  278,  278,  278,  278,  278,  278,  170,  278,
+     278,  278,  278,  278,   95,   94,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     155,  278,  278,  278,  278,  278,  278,  278,  278,  112,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,   74,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  210,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,   78,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,   48,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     158,  159,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,   10,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  234,  278,  278,  255,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,   38,  278,  278,  278,  278,  278,  278,  278,  278,
+     151,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  175,  278,  152,  278,  278,  187,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,   39,  278,
+     278,  278,  278,  278,  278,  109,   99,  278,  100,  278,
+
+     278,   98,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  123,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  222,  278,  278,  278,  278,  278,  278,
+     278,  278,  153,  278,  278,  278,  278,  278,  156,  278,
+     278,  278,  186,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,   88,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,   46,  278,  278,
+     278,   26,  278,  278,  278,  278,  278,   23,  278,  278,
+     278,   27,  278,  133,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,   63,   65,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  238,  278,  278,
+     278,  197,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  101,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  122,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  249,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     127,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  181,  278,  278,  278,  278,  278,
+     278,  278,  278,  258,  278,  278,  278,  278,  278,  278,
+     278,  143,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,    6,  278,  138,  278,  146,  278,  278,  278,
+     278,  278,  115,  278,  278,  278,  278,  278,   84,  278,
+     278,  278,  278,  173,  278,  278,  278,  278,  278,  188,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  202,  278,  278,
+     278,  278,  278,  278,  108,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  142,  278,  278,  278,  278,
+     278,   66,   67,  278,  278,  278,  278,  278,  278,   47,
+     278,  278,  278,  278,  278,   73,  147,  278,  163,  278,
+     190,  278,  157,  278,  278,  278,   57,  278,  149,  278,
+     278,  278,  278,  278,   13,  278,  278,  278,   87,  278,
+     278,  278,  278,  228,  278,  278,  278,  172,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  141,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  129,  237,
+     278,  278,  278,  278,  278,  201,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  183,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  252,  278,  148,  278,
+     160,  278,  278,   56,   58,  278,  278,  278,  278,  278,
+     278,  278,   86,  278,  278,  278,  278,  226,  278,  278,
+     278,  233,  278,  278,  278,  278,  278,  177,   34,   28,
+      30,  278,  278,  278,  278,  278,   35,   29,   31,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,   83,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  179,  176,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,   55,  278,  110,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  124,   17,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     247,  278,  250,  278,  278,  278,  278,  278,  278,   16,
+     278,  278,   25,  278,  278,  278,  232,  278,  278,  278,
+     235,   60,  278,  185,  278,  178,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  137,  136,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  180,  174,  278,  278,  278,
+     239,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,   68,
+     278,  278,  278,  227,  278,  278,  278,  278,  278,  278,
+     184,  278,  278,  278,  278,  278,  278,  278,  278,  256,
+     257,   61,  278,  278,  278,   96,   97,  278,  130,  278,
+     132,  278,  164,  278,  278,  278,    8,  278,  278,  135,
+
+     278,  278,  191,  278,  278,  278,  278,  278,  278,  278,
+     117,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  198,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  168,
+     278,  278,  278,  165,  278,  278,  278,  224,  278,  251,
+     278,  278,  278,   42,  278,  278,  278,  278,    4,  278,
+     278,  116,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  194,   36,   37,  278,  278,
+     278,  278,  278,  278,  278,  240,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  200,  278,
+
+     278,  169,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,   71,  278,   43,  231,  225,  278,  195,  278,  278,
+      15,  278,  278,  278,  278,  278,  278,  166,   75,  278,
+     278,  278,  278,    7,  278,  278,  140,  278,  278,  278,
+     278,  278,  119,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  199,  113,
+     278,  102,  103,  278,  278,  278,   77,   81,   76,  278,
+      69,  278,  278,  278,   14,  278,  278,  278,  229,  278,
+     278,  278,  278,    9,  139,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,   82,
+      80,  278,   70,  248,  278,  278,  278,  154,  278,  278,
+     167,  278,  278,  278,  278,  278,  278,  131,   64,  278,
+     278,  278,  278,  278,  241,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  114,
+      79,  120,  121,   72,  278,  230,  134,  278,  278,  278,
+     278,  193,  278,  278,  278,  278,  278,  278,  278,  211,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  278,  278,  278,   85,
+     278,  192,  278,  221,  245,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,    5,  278,  278,  278,  246,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  213,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  220,
+     278,  278,  278,  278,  118,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     150,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+
+     278,  278,  278,  278,  278,  278,  242,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  259,  278,  278,  205,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  243,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  244,  278,  278,  278,  203,  278,
+     278,  278,  278,  278,  278,  278,  206,  207,  278,  278,
+     216,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  204,  278,  278,  278,  214,  278,
+
+     208,  217,  218,  278,  278,  278,  278,  278,  215,  219,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,   62,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,   59,  278,  278,
+     278,  278,  278,  278,  278,  278,  278,  278,  278,  278,
+     278,  278,  278,  278,  212,    0
     } ;
 
 static yyconst YY_CHAR yy_ec[256] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
-        1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    2,    1,    5,    6,    1,    1,    1,    7,    1,
-        1,    1,    1,    1,    8,    1,    1,    1,    9,    1,
-       10,   11,    1,   12,    1,    1,    1,   13,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,   14,    1,    1,    1,    1,   15,   16,   17,   18,
-
-       19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
-       29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
-       39,   40,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1
+       1,    1,    1,    1,    1,    1,    1,    1,    2,    3,
+       1,    1,    4,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    2,    1,    5,    6,    1,    1,    1,    7,    1,
+       1,    1,    1,    1,    8,    1,    1,    1,    9,    1,
+      10,   11,    1,   12,    1,    1,    1,   13,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,   14,    1,    1,    1,    1,   15,   16,   17,   18,
+
+      19,   20,   21,   22,   23,   24,   25,   26,   27,   28,
+      29,   30,   31,   32,   33,   34,   35,   36,   37,   38,
+      39,   40,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1
     } ;
 
 static yyconst YY_CHAR yy_meta[41] =
     {   0,
-        1,    2,    3,    4,    5,    1,    6,    1,    1,    1,
-        1,    1,    7,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static yyconst flex_uint16_t yy_base[2577] =
+static yyconst flex_int16_t yy_base[2867] =
     {   0,
-        0,    0,   38,   41,   44,   46,   59,   65,   71,   77,
-       90,  112, 2573, 2166,   81, 5015, 5015, 5015,   96,   52,
-      106,   63,  107,  111,   70,  117,  128,  131,   57,   88,
-       76,  133,  139,  130,  141,  143,  153,  162,  172,  174,
-      186,  149, 2061, 5015, 5015, 5015,  107, 2030, 5015, 5015,
-     5015,  186, 1893, 1643, 5015, 5015, 5015,  206, 1567, 5015,
-     5015, 5015,  210,  977, 5015,  214, 5015,  218,  155,  758,
-      222,  173,    0,  229,    0,    0,  180,  185,   85,  198,
-      223,  224,  216,  230,  231,  232,  233,  114,  235,  242,
-      243,  241,  237,  246,  247,  256,  253,  259,  263,  268,
-
-      267,  270,  271,  272,  276,  277,  285,  280,  294,  284,
-      279,  288,  298,  289,  300,  303,  310,  304,  308,  313,
-      314,  316,  318,  326,  317,  335,  322,  325,  332,  337,
-      338,  342,  343,  345,  347,  339,  348,  346,  451,  371,
-      421,  359,  394,  376,  327,  250,  380,  163,  384,  388,
-        0,  380,  363,  390,  373,  385,  386,  387,  382,  389,
-      398,  392,  396,  408,  406,  413,  416,  417,  418,  423,
-      407,  425,  428,  419,  435,  436,  441,  434,  442,  444,
-      443,  445,  447,  454,  462,  449,  463,  470,  465,  477,
-      453,  481,  476,  468,  484,  482,  486,  494,  490,  491,
-
-      492,  493,  495,  203,  499,  496,  500,  502,  503,  506,
-      508,  510,  512,  516,  514,  523,  519,  527,  524,  529,
-      525,  539,  540,  526,  541,  542,  546,  549,  556,  557,
-      553,  543,  558,  552,  559,  560,  561,  562,  571,  575,
-      577,  579,  576,  573,  580,  583,  585,  587,  586,  589,
-      591,  596,  603,  590,  604,  606,  598,  602,  609,  615,
-      613,  616,  618,  626,  621,  624,  629,  631,  633,  634,
-      625,  635,  637,  638,  641,  640,  642,  647,  648,  651,
-      652,  659,  663,  661,  660,  666,  653,  668,  667,  674,
-      677,  676,  681,  682,  690,  691,  692,  693,  695,  698,
-
-      696,  699,  700,  704,  708,  709,  711,  718,  713,  715,
-      723,  719,  725,  732,  728,  731,  739,  744,  740,  741,
-      753,  743,  746,  749,  751, 5015,  757,  759,  777,  755,
-      766,  784,  781,  761,  771,  785,  786,  788,  768,  797,
-      798,  805,  801,  802,  803,  804,  806,  810,  814,  813,
-      815,  816,  826,  818,  821,  829,  838,  828,  831,  839,
-      832,  840,  841,  849,  721,  844,  850,  851,  856,  852,
-      854,  857,  860,  858,  871,  873,  875,  876,  877,  878,
-      883,  879,  885,  886,  887,  895,  893,  891,  896,  900,
-      902,  903,  904,  906,  907,  913,  905,  919, 5015,  922,
-
-      911,  917,  915,  927,  928, 5015,  930,  929,  931,  939,
-      934,  941,  937,  938,  936,  957,  946,  953,  960,  955,
-      958,  959,  961,  964,  962,  965,  970,  971,  972,  992,
-      974,  976,  973,  979,  986,  983,  990, 1002,  997, 1014,
-      985, 1003,  999, 1009, 1015, 1016, 1019, 1020, 1021, 1022,
-     1023, 1025, 1026, 1029, 5015, 1031, 1033, 1042, 1038, 1045,
-     1046, 1047, 1048, 1049, 1051, 1052, 1055, 1057, 1067, 1058,
-     1074, 1059, 1069, 1073, 1075, 1076, 1077, 1078, 1087, 1082,
-     1084, 1090, 1091, 1098, 1100, 1107, 1092, 1103, 1102, 1104,
-     1106, 1105, 1110, 1111, 1120, 1118, 1116, 1119, 1117, 1131,
-
-     1127, 1126, 1130, 1123, 1135, 1139, 1143, 1144, 1145, 1146,
-     1153, 1151, 1152, 1150, 1158, 1162, 1156, 1164, 1165, 1169,
-     1166, 1171, 1173, 1180, 1178, 1179, 1183, 1188, 1181, 1189,
-     1196, 1192, 1200, 1195, 1201, 1208, 1191, 1205, 1209, 1216,
-     1211, 1212, 1214, 1219, 1215, 1220, 1237, 1222, 1224, 1233,
-     1226, 1238, 1234, 1239, 1241, 1242, 1243, 1244, 1246, 1247,
-     1250, 1251, 1253, 1254, 1264, 1256, 1260, 1266, 1267, 1271,
-     1272, 1273, 1276, 1277, 1281, 1278, 1282, 1286, 1287, 1288,
-     1294, 1290, 1301, 1302, 1293, 1303, 1304, 1308, 1309, 1312,
-     1314, 1317, 1321, 1315, 1323, 1316, 1326, 1328, 1333, 1336,
-
-     1331, 5015, 1337, 1344, 1339, 1341, 1343, 1346, 1354, 1349,
-     1350, 1351, 1352, 1358, 5015, 1360, 5015, 5015, 1361, 5015,
-     5015, 1353, 1365, 1369, 1381, 1383, 1374, 1379, 1366, 1394,
-     1395, 1387, 1389, 1390, 1391, 1398, 1404, 1405, 1417, 1400,
-     1419, 1406, 1421, 1422, 1423, 1426, 1409, 1429, 1430, 1432,
-     1431, 1434, 1437, 1440, 1441, 1436, 1442, 1444, 5015, 1453,
-     1455, 1462, 1457, 1461, 1463, 1464, 1465, 1468, 1469, 1466,
-     1446, 1470, 1474, 1481, 1477, 5015, 1478, 1480, 1486, 1484,
-     1492, 1494, 1488, 1497, 1490, 1500, 1501, 1503, 1504, 5015,
-     1506, 1512, 1509, 1513, 1514, 1516, 1517, 1520, 1521, 1522,
-
-     1524, 1525, 1526, 1523, 1534, 1529, 1533, 1538, 1540, 1549,
-     1550, 1551, 1552, 1553, 1554, 1561, 1556, 1563, 1558, 1559,
-     1560, 1577, 1564, 1565, 1581, 1583, 1579, 1587, 1590, 1588,
-     1592, 1589, 1593, 1595, 1596, 1599, 1601, 1604, 1605, 1606,
-     5015, 1609, 1613, 5015, 1612, 1614, 1636, 1615, 1617, 1619,
-     1618, 1620, 1622, 1623, 1630, 1654, 1642, 1646, 1640, 1658,
-     1659, 1651, 1649, 1660, 1661, 1668, 1672, 1680, 1682, 1666,
-     1669, 1688, 1678, 1679, 1677, 1681, 1697, 1695, 1701, 1692,
-     1683, 1686, 1704, 1711, 5015, 1716, 1717, 1699, 1712, 1719,
-     1721, 1722, 1629, 1723, 1724, 1733, 1728, 1729, 1730, 1731,
-
-     1736, 1734, 1738, 1743, 1745, 5015, 1742, 1744, 1746, 1753,
-     1755, 1757, 1761, 1749, 1769, 1765, 1767, 5015, 1771, 1778,
-     1775, 1781, 1774, 1773, 1782, 1783, 1786, 1791, 1789, 1792,
-     1790, 1794, 1797, 1798, 1803, 1805, 1804, 5015, 1806, 1807,
-     1813, 1821, 1818, 1820, 1822, 1824, 1825, 1826, 1828, 1831,
-     1836, 1838, 1834, 1837, 5015, 1833, 1841, 1847, 1849, 1850,
-     1852, 1853, 1854, 1857, 1862, 1865, 1860, 1861, 1871, 1863,
-     1867, 1873, 1878, 1876, 1877, 1879, 1880, 5015, 1883, 1888,
-      124, 1889, 1884, 1892, 1890, 1897, 1891, 1906, 1907, 1908,
-     1910, 1909, 1915, 1916, 1917, 1918, 1919, 1920, 1921, 1923,
-
-     1925, 1926, 1928, 1931, 1932, 1934, 5015, 1943, 1949, 1951,
-     1941, 1956, 1945, 1957, 1960, 1961, 1962, 1964, 5015, 1969,
-     1970, 1971, 1972, 1974, 1973, 1979, 1976, 1935, 1981, 1985,
-     1986, 1984, 1987, 1988, 1993, 1989, 1990, 1997, 2000, 5015,
-     2007, 2002, 2005, 2011, 2014, 2012, 2021, 2018, 2022, 2025,
-     2026, 2039, 2028, 2023, 2035, 2033, 2040, 2042, 2049, 2050,
-     2056, 2043, 2059, 2060, 2053, 2046, 2072, 2075, 2071, 2070,
-     2073, 2077, 2081, 2083, 5015, 2080, 2085, 2086, 2088, 2096,
-     2092, 2098, 2099, 2101, 2102, 2107, 2105, 2106, 2108, 2109,
-     2112, 2116, 2120, 2124, 2117, 2127, 2129, 5015, 2133, 2134,
-
-     2128, 2138, 2135, 2143, 2140, 2144, 2146, 2149, 2150, 2151,
-     2152, 5015, 2157, 2153, 2161, 2159, 2163, 2171, 2162, 2173,
-     2174, 2175, 5015, 2182, 2183, 2184, 2191, 2178, 2186, 2190,
-     2193, 2194, 5015, 2195, 2196, 2203, 2204, 5015, 2206, 2202,
-     2207, 2199, 2209, 2208, 2212, 2210, 2217, 2218, 2220, 2229,
-     2221, 2232, 5015, 2224, 2239, 2231, 2241, 2234, 2235, 2245,
-     2246, 2253, 2247, 2258, 2262, 2256, 2257, 2259, 2264, 2265,
-     2268, 2269, 5015, 2273, 2272, 2274, 2277, 2278, 2279, 2271,
-     2280, 2288, 2291, 2292, 2284, 2295, 2294, 2304, 2293, 2305,
-     2312, 2308, 2310, 2297, 2315, 2325, 2327, 2328, 2330, 5015,
-
-     2333, 2322, 2334, 2317, 2324, 2336, 2337, 2339, 2341, 2342,
-     2347, 2345, 2346, 2354, 2363, 2349, 2355, 2356, 2358, 2366,
-     2364, 2367, 2370, 2378, 2368, 2373, 2379, 2380, 2371, 2381,
-     2382, 2383, 2388, 2389, 2394, 2395, 2403, 2396, 2404, 2405,
-     2406, 5015, 2410, 2411, 2414, 2416, 2420, 2417, 2423, 2424,
-     2421, 2429, 2430, 2437, 2436, 5015, 2433, 5015, 2438, 2439,
-     2442, 2446, 5015, 2449, 5015, 2453, 2445, 2454, 5015, 2455,
-     2456, 2460, 2462, 2463, 2465, 2466, 2468, 2471, 2472, 2473,
-     2475, 2478, 2476, 2483, 2479, 2486, 2489, 2487, 2490, 5015,
-     2499, 2492, 2494, 2500, 2502, 2503, 2507, 2505, 2509, 2513,
-
-     2518, 2511, 2515, 2521, 2530, 2514, 2533, 5015, 2528, 2536,
-     2532, 2537, 5015, 2538, 2539, 2544, 2541, 2546, 2548, 2547,
-     2552, 2549, 2554, 2565, 2566, 2567, 2569, 2570, 2556, 2573,
-     2585, 2557, 2586, 2577, 2580, 2584, 2588, 2589, 2596, 2597,
-     2594, 2598, 2595, 2600, 2604, 2601, 2608, 2610, 2611, 2613,
-     2614, 2612, 2616, 2621, 2617, 2619, 2620, 2622, 5015, 2633,
-     2625, 2635, 2641, 2623, 2636, 2644, 2646, 2647, 2648, 2651,
-     2653, 2654, 5015, 2652, 5015, 2649, 2660, 2676, 2666, 2661,
-     2673, 2655, 2677, 2679, 2681, 2682, 2689, 2685, 2687, 2688,
-     2692, 2694, 2695, 2697, 5015, 2696, 2699, 2702, 2700, 2704,
-
-     2714, 2705, 2715, 2712, 2718, 2722, 2729, 5015, 2731, 2726,
-     2733, 2741, 2737, 2749, 2745, 5015, 2734, 2736, 2752, 2747,
-     2753, 5015, 5015, 2738, 2748, 2755, 2758, 2759, 2770, 2761,
-     2765, 2766, 2768, 2775, 2772, 2776, 5015, 2778, 2779, 2780,
-     2782, 2786, 2790, 2789, 2792, 5015, 2793, 2797, 2800, 2801,
-     2802, 2803, 2804, 2806, 2810, 2805, 2807, 2820, 2816, 2812,
-     2823, 2826, 2831, 2833, 5015, 2835, 2836, 2838, 2839, 2841,
-     2844, 2842, 2846, 2848, 2849, 2850, 2852, 2853, 2854, 2858,
-     2864, 2856, 2857, 2860, 2877, 2870, 2874, 2875, 2878, 2881,
-     2884, 2888, 2879, 2890, 2885, 2892, 2897, 2894, 2907, 2900,
-
-     5015, 2908, 2904, 2911, 2909, 2912, 2917, 2918, 2920, 2923,
-     2910, 2921, 2931, 2924, 5015, 2933, 2926, 2943, 2928, 2938,
-     2952, 2947, 2929, 2948, 2951, 2954, 2957, 2955, 2959, 2960,
-     2963, 5015, 5015, 2964, 2965, 2967, 2968, 2970, 2976, 2971,
-     2978, 2972, 2974, 5015, 2982, 2994, 2984, 2989, 2999, 3001,
-     2992, 3000, 3002, 3003, 3006, 3007, 3009, 3008, 3010, 3013,
-     3021, 3017, 3016, 3018, 5015, 3020, 3027, 5015, 3024, 3028,
-     3029, 3040, 3034, 3041, 3044, 3047, 3030, 3048, 3050, 3052,
-     3059, 3057, 3054, 3063, 3065, 3067, 3075, 3077, 3068, 3073,
-     3082, 5015, 3078, 3080, 3081, 3083, 3092, 3087, 3095, 3088,
-
-     5015, 3091, 3096, 3097, 3098, 3104, 3107, 3111, 3099, 3118,
-     3114, 3116, 3117, 3113, 5015, 3124, 5015, 3125, 3126, 5015,
-     3127, 3130, 3131, 3133, 3134, 3135, 3141, 3145, 3137, 3147,
-     3148, 3149, 3150, 3153, 3161, 3151, 5015, 3159, 3152, 3163,
-     3164, 3162, 3167, 5015, 5015, 3176, 5015, 3169, 3177, 5015,
-     3179, 3178, 3187, 3182, 3183, 3186, 3190, 3195, 5015, 3191,
-     3196, 3200, 3197, 3202, 3205, 3207, 3208, 3204, 3209, 3212,
-     5015, 3213, 3210, 3215, 3211, 3221, 3225, 3227, 3226, 5015,
-     3234, 3235, 3236, 3238, 3240, 5015, 3242, 3248, 5015, 3244,
-     3253, 3245, 3255, 3257, 3256, 3262, 3263, 3249, 3270, 3268,
-
-     3265, 3266, 5015, 3272, 3275, 3277, 3279, 3282, 3283, 3290,
-     3287, 3286, 3285, 3295, 3296, 3298, 3304, 3300, 3311, 3302,
-     3307, 3310, 3314, 5015, 3315, 3316, 3317, 5015, 3318, 3320,
-     3324, 3325, 3328, 5015, 3329, 3330, 3332, 5015, 3333, 5015,
-     3345, 3334, 3338, 3336, 3346, 3348, 3349, 3360, 3350, 3362,
-     3363, 3354, 3371, 3378, 3379, 3374, 3356, 3375, 5015, 5015,
-     3381, 3382, 3376, 3387, 3388, 3384, 3391, 3398, 3394, 3401,
-     3402, 3410, 5015, 3411, 3393, 3412, 5015, 3403, 3414, 3406,
-     3390, 3417, 3418, 3421, 3424, 3426, 3420, 3427, 3425, 3431,
-     3433, 3440, 5015, 3434, 3441, 3442, 3443, 3444, 3445, 3446,
-
-     3447, 5015, 3449, 3455, 3456, 3448, 3457, 3462, 3469, 3473,
-     3477, 3474, 3478, 3479, 3481, 3483, 3487, 5015, 3494, 3484,
-     3485, 3486, 3496, 3501, 3488, 3503, 3497, 3509, 3511, 3506,
-     3512, 5015, 3513, 3517, 3514, 3522, 3519, 3523, 3524, 3525,
-     3535, 3528, 3530, 3532, 3539, 5015, 3536, 3540, 3542, 3544,
-     3550, 3543, 3546, 3552, 5015, 3554, 3555, 3558, 3559, 3568,
-     3564, 3570, 5015, 3566, 3571, 3574, 3577, 3580, 3560, 3582,
-     3583, 3584, 3586, 3590, 3591, 3592, 3594, 3597, 3598, 3599,
-     3596, 3615, 3600, 5015, 3611, 5015, 3612, 3613, 3623, 3618,
-     3620, 5015, 3622, 3625, 3629, 3624, 3626, 5015, 3632, 3630,
-
-     3633, 3637, 5015, 3647, 3651, 3634, 3643, 3653, 5015, 3658,
-     3659, 3660, 3667, 3669, 3671, 3664, 3672, 3668, 3674, 3666,
-     3675, 5015, 3677, 3679, 3684, 3686, 3687, 3689, 5015, 3690,
-     3692, 3694, 3695, 3696, 3697, 3704, 3700, 3701, 5015, 3705,
-     3709, 3717, 3715, 3718, 5015, 5015, 3713, 3724, 3726, 3722,
-     3730, 5015, 3728, 3739, 3734, 3736, 3636, 5015, 5015, 3738,
-     5015, 3740, 5015, 5015, 3742, 3744, 3751, 5015, 3753, 5015,
-     3760, 3755, 3741, 3743, 3759, 5015, 3761, 3762, 3767, 5015,
-     3763, 3775, 3768, 3770, 5015, 3777, 3771, 3773, 5015, 3778,
-     3782, 3783, 3787, 3784, 3792, 3794, 3796, 3801, 3803, 3805,
-
-     3797, 3793, 3807, 3812, 3810, 3815, 3817, 3819, 3820, 3821,
-     3823, 3824, 3825, 3826, 3834, 3827, 3829, 3831, 3837, 3838,
-     3839, 3840, 3843, 3842, 3845, 5015, 3847, 3848, 3849, 3856,
-     3854, 3858, 3861, 3874, 3876, 3877, 5015, 5015, 3879, 3864,
-     3881, 3867, 5015, 3869, 3883, 3871, 3884, 3885, 3887, 3888,
-     3890, 5015, 3896, 3899, 3898, 3900, 3902, 3903, 3909, 3905,
-     3911, 3912, 3913, 3915, 3917, 3925, 3921, 3922, 3926, 3930,
-     3927, 3931, 3933, 3934, 3941, 3942, 3949, 5015, 3943, 5015,
-     3946, 3950, 3952, 5015, 5015, 3953, 3954, 3959, 3960, 3956,
-     3964, 3961, 5015, 3966, 3968, 3977, 3967, 5015, 3969, 3978,
-
-     3983, 5015, 3985, 3986, 3988, 3990, 3992, 5015, 5015, 5015,
-     5015, 3993, 3979, 3996, 3997, 3999, 5015, 5015, 5015, 4002,
-     4000, 4006, 4004, 4003, 4013, 5015, 4015, 4018, 4019, 4016,
-     4026, 4028, 4029, 4032, 4017, 4020, 4039, 4040, 4041, 4034,
-     4043, 4047, 4051, 5015, 5015, 4044, 4052, 4059, 4056, 4060,
-     4068, 4063, 4064, 4066, 4070, 4071, 4072, 4074, 5015, 4073,
-     5015, 4078, 4082, 4080, 4081, 4084, 4088, 4089, 4091, 5015,
-     5015, 4092, 4095, 4099, 4102, 4103, 4096, 4104, 4107, 4108,
-     5015, 4109, 5015, 4110, 4112, 4120, 4126, 4113, 4123, 5015,
-     4129, 4131, 5015, 4132, 4133, 4134, 5015, 4139, 4142, 4146,
-
-     5015, 5015, 4151, 5015, 4117, 5015, 4135, 4152, 4157, 4159,
-     4160, 4162, 4164, 4167, 4154, 4171, 4168, 4173, 4178, 4175,
-     4176, 5015, 5015, 4183, 4179, 4181, 4184, 4185, 4194, 4189,
-     4192, 4198, 5015, 5015, 4143, 4195, 4190, 5015, 4199, 4205,
-     4200, 4206, 4207, 4209, 4212, 4216, 4213, 4219, 4220, 4221,
-     4230, 4233, 4235, 4228, 4237, 4223, 4238, 4240, 4241, 4245,
-     5015, 4247, 4248, 4250, 5015, 4253, 4255, 4257, 4254, 4258,
-     5015, 4260, 4270, 4271, 4263, 4266, 4280, 4273, 4276, 5015,
-     5015, 5015, 4283, 4284, 4277, 5015, 5015, 4287, 5015, 4288,
-     5015, 4290, 5015, 4291, 4294, 4292, 5015, 4297, 4303, 5015,
-
-     4299, 4306, 4309, 4310, 4313, 4315, 4316, 5015, 4320, 4317,
-     4318, 4325, 4326, 4327, 4330, 4328, 4337, 4329, 4339, 5015,
-     4332, 4340, 4342, 4336, 4343, 4353, 4350, 4345, 4347, 4352,
-     4358, 4362, 4365, 4367, 5015, 4369, 4371, 5015, 4372, 5015,
-     4374, 4375, 4376, 5015, 4378, 4379, 4380, 4382, 5015, 4383,
-     4390, 5015, 4385, 4395, 4397, 4389, 4392, 4387, 4402, 4400,
-     4409, 4410, 4415, 5015, 5015, 5015, 4405, 4411, 4424, 4422,
-     4423, 4425, 4427, 5015, 4428, 4429, 4430, 4438, 4435, 4437,
-     5015, 4440, 4441, 5015, 4443, 4447, 4450, 4444, 4451, 4462,
-     4464, 4466, 4454, 5015, 4468, 5015, 5015, 4457, 5015, 4448,
-
-     4471, 5015, 4474, 4469, 4475, 4477, 4479, 4480, 5015, 5015,
-     4482, 4487, 4484, 4489, 4493, 5015, 4490, 4491, 4494, 4497,
-     4500, 5015, 4504, 4501, 4502, 4503, 4507, 4505, 4513, 4508,
-     4514, 5015, 5015, 4515, 5015, 5015, 4517, 4527, 4524, 5015,
-     5015, 5015, 4533, 5015, 4537, 4541, 4540, 5015, 4543, 4534,
-     4545, 5015, 4547, 4548, 4549, 4550, 5015, 4551, 4554, 4556,
-     4561, 4567, 4558, 4570, 4562, 4578, 4582, 4564, 4568, 4579,
-     4580, 4581, 4584, 4588, 5015, 5015, 4591, 5015, 5015, 4593,
-     4595, 4597, 5015, 4598, 4602, 5015, 4605, 4599, 4606, 4608,
-     4610, 4612, 5015, 5015, 4613, 4616, 4615, 4620, 4617, 5015,
-
-     4623, 4628, 4624, 4627, 4629, 4633, 4630, 5015, 5015, 5015,
-     5015, 5015, 4634, 5015, 5015, 4636, 4639, 4640, 4642, 5015,
-     4644, 4647, 4645, 4652, 4649, 4661, 4653, 4655, 4657, 4663,
-     4665, 4668, 4669, 4670, 4672, 4673, 4677, 4680, 4686, 4688,
-     4678, 4691, 4692, 4693, 4694, 4696, 4700, 4707, 4702, 4704,
-     4705, 5015, 4708, 5015, 4709, 5015, 5015, 4713, 4717, 4706,
-     4710, 4725, 4726, 4722, 4728, 4730, 5015, 4731, 4732, 4733,
-     5015, 4734, 4735, 4738, 4739, 4742, 4743, 4745, 4748, 4747,
-     4744, 4759, 4756, 4766, 4767, 4764, 4770, 4771, 4772, 4779,
-     4777, 4781, 5015, 4774, 4783, 4785, 4784, 4786, 4793, 4788,
-
-     4795, 4789, 5015, 4797, 4800, 4794, 4798, 4801, 4806, 4810,
-     4813, 4814, 5015, 4804, 4815, 4821, 4822, 4824, 4826, 4828,
-     4829, 4833, 4834, 4836, 4842, 4837, 4843, 4845, 4846, 4847,
-     5015, 4853, 4849, 5015, 4854, 4855, 4856, 4857, 4861, 5015,
-     4870, 4858, 4863, 4871, 4874, 4878, 5015, 4880, 4884, 4881,
-     5015, 4886, 5015, 5015, 4887, 4889, 4890, 4894, 4896, 5015,
-     5015, 5015, 4923, 4930, 4937, 4944, 4951,   88, 4958, 4965,
-     4972, 4979, 4986, 4993, 5000, 5007
+    6690, 6731,   42,   82,  122,  162,  202,  242,  282,  322,
+     362,  402, 4927,  443,  484, 4927, 4927, 4927,  487,  527,
+     551,  194,  555,  559,  553,  560,  575,  574,  220,  345,
+     336,  578,  561,  331,  580,  376,  591,  595,  601,  604,
+     616,  377,  639, 4927, 4927, 4927,  679,  719, 4927, 4927,
+    4927,  759,  799,  445, 4927, 4927, 4927,  839,  879, 4927,
+    4927, 4927,  919,  959, 4927,  999, 4927, 1039, 1079,    1,
+    1119,    1, 1159, 1199, 1239, 1279,    1,  388,  428,  427,
+     416,  439,  583,  453,  464,  502,  618,  541,  543,  550,
+    1312,  569,  571,  600,  576,  589,  615,  597,  623,  654,
+
+    1304, 1314,  610, 1306,  705,  768,  695,  744,  781,  776,
+     783,  815,  848,  851,  866,  890,  943,  927,  948,  930,
+    1308,  973, 1009, 1316, 1054, 1074, 1057, 1315, 1052, 1056,
+    1089, 1127, 1172, 1318, 1209, 1256, 1309, 1297, 1295, 1310,
+    1303, 1350, 1390, 1430, 1470, 1510, 1550, 1590, 1630,    1,
+    1670, 1710, 1750, 1790, 1830, 1870, 1910, 1950, 1990, 2030,
+    2070, 1313, 2103, 1311, 1320, 1321, 1331, 1307, 1325, 1317,
+    1359, 1410, 2104, 1415, 1420, 1465, 2101, 2097, 1459, 1444,
+    1494, 1534, 1528, 2106, 1539, 1556, 1574, 1566, 1568, 1646,
+    1563, 1614, 1654, 2102, 1655, 1643, 1683, 1706, 1700, 2108,
+
+    1719, 1785, 1771, 1760, 1824, 1814, 1826, 1827, 1816, 1846,
+    1893, 1919, 1972, 1957, 1973, 1967, 1978, 2009, 2004, 2005,
+    2000, 2018, 2041, 2105, 2085, 2116, 2107, 2119, 2095, 2114,
+    2112, 2129, 2130, 2109, 2133, 2118, 2131, 2111, 2134, 2140,
+    2141, 2135, 2113, 2136, 2169, 2209, 2120, 2132, 2122, 2138,
+    2144, 2150, 2142, 2143, 2151, 2137, 2139, 2128, 2183, 2147,
+    2124, 2148, 2196, 2149, 2202, 2182, 2201, 2235, 2221, 2223,
+    2236, 2237, 2231, 2248, 2229, 2250, 2243, 2242, 2246, 2244,
+    2225, 2254, 2232, 2233, 2234, 2240, 2253, 2255, 2238, 2256,
+    2239, 2258, 2247, 2259, 2249, 2270, 2263, 2257, 2261, 2262,
+
+    2267, 2264, 2260, 2265, 2273, 2269, 2277, 2266, 2272, 2275,
+    2279, 2283, 2284, 2289, 2276, 2287, 2281, 2278, 2274, 2280,
+    2302, 2282, 2293, 2305, 2295, 2296, 2300, 2290, 2303, 2299,
+    2315, 2306, 2297, 2309, 2294, 2292, 2301, 2307, 2308, 4927,
+    2312, 2313, 2330, 2314, 2311, 2340, 2317, 2356, 2298, 2320,
+    2327, 2318, 2321, 2363, 2324, 2390, 2362, 2366, 2367, 2325,
+    2336, 2373, 2395, 2370, 2379, 2378, 2399, 2371, 2381, 2393,
+    2402, 2375, 2385, 2386, 2389, 2403, 2400, 2404, 2405, 2392,
+    2394, 2391, 2397, 2418, 2406, 2407, 2408, 2410, 2409, 2423,
+    2398, 2414, 2417, 2419, 2411, 2421, 2412, 2422, 2416, 2429,
+
+    2438, 2430, 2420, 2415, 2428, 2431, 2425, 2424, 2426, 2435,
+    2440, 2439, 2427, 2442, 4927, 2444, 2432, 2441, 2437, 2434,
+    2443, 4927, 2445, 2436, 2433, 2456, 2448, 2457, 2447, 2446,
+    2450, 2465, 2449, 2458, 2468, 2452, 2459, 2451, 2453, 2463,
+    2466, 2455, 2467, 2460, 2461, 2476, 2469, 2462, 2471, 2470,
+    2464, 2473, 2472, 2489, 2474, 2482, 2477, 2486, 2492, 2475,
+    2497, 2484, 2491, 2490, 2485, 2479, 2501, 2498, 2493, 2494,
+    2502, 4927, 2504, 2523, 2517, 2538, 2499, 2532, 2537, 2535,
+    2512, 2541, 2553, 2548, 2558, 2564, 2547, 2566, 2549, 2559,
+    2550, 2561, 2560, 2551, 2552, 2570, 2562, 2572, 2573, 2579,
+
+    2575, 2577, 2583, 2557, 2574, 2563, 2576, 2578, 2565, 2567,
+    2581, 2586, 2582, 2585, 2569, 2587, 2571, 2589, 2588, 2454,
+    2591, 2580, 2594, 2584, 2592, 2595, 2590, 2593, 2602, 2596,
+    2598, 2603, 2601, 2605, 2606, 2597, 2599, 2609, 2611, 2607,
+    2604, 2610, 2621, 2612, 2614, 2616, 2618, 2608, 2613, 2627,
+    2619, 2631, 2625, 2626, 2636, 2620, 2623, 2622, 2638, 2615,
+    2628, 2635, 2645, 2632, 2640, 2649, 2639, 2624, 2644, 2633,
+    2648, 2629, 2637, 2641, 2642, 2634, 2647, 2651, 2643, 2646,
+    2650, 2653, 2652, 2662, 2654, 2655, 2657, 2658, 2659, 2660,
+    2656, 2664, 2661, 2667, 2665, 2670, 2666, 2668, 2671, 2674,
+
+    2678, 2679, 2680, 2683, 2672, 2682, 2663, 2677, 2684, 2685,
+    2707, 2689, 2691, 2686, 2687, 2720, 2714, 2699, 2735, 2738,
+    2729, 4927, 2721, 2669, 2719, 2737, 2730, 2725, 2751, 2739,
+    2728, 2723, 2731, 2744, 4927, 2740, 4927, 4927, 2741, 4927,
+    4927, 2743, 2748, 2753, 2758, 2759, 2750, 2754, 2742, 2770,
+    2768, 2756, 2762, 2752, 2760, 2746, 2771, 2777, 2772, 2776,
+    2766, 2781, 2778, 2782, 2779, 2786, 2780, 2774, 2785, 2775,
+    2783, 2788, 2789, 2784, 2787, 2773, 2790, 2791, 2792, 2799,
+    4927, 2795, 2797, 2810, 2802, 2800, 2801, 2803, 2794, 2805,
+    2806, 2796, 2808, 2807, 2809, 2820, 2804, 4927, 2811, 2812,
+
+    2813, 2815, 2816, 2817, 2814, 2824, 2818, 2819, 2821, 2822,
+    2823, 4927, 2825, 2830, 2826, 2827, 2828, 2831, 2832, 2833,
+    2834, 2835, 2836, 2838, 2829, 2841, 2845, 2839, 2846, 2837,
+    2840, 2842, 2843, 2844, 2847, 2848, 2851, 2859, 2850, 2865,
+    2857, 2853, 2852, 2855, 2867, 2856, 2872, 2880, 2873, 2860,
+    2866, 2886, 2861, 2883, 2868, 2878, 2897, 2870, 2884, 2889,
+    2902, 2882, 2906, 4927, 2903, 2912, 4927, 2908, 2909, 2926,
+    2931, 2929, 2919, 2911, 2934, 2924, 2935, 2927, 2949, 2930,
+    2936, 2942, 2937, 2948, 2945, 2940, 2938, 2941, 2950, 2957,
+    2958, 2965, 2967, 2943, 2946, 2964, 2954, 2962, 2955, 2956,
+
+    2970, 2968, 2966, 2959, 2961, 2963, 2969, 2977, 2973, 4927,
+    2984, 2978, 2972, 2974, 2986, 2980, 2975, 2983, 2987, 2979,
+    2992, 2988, 2981, 2993, 2982, 2985, 2989, 2991, 2995, 2996,
+    2999, 4927, 2994, 2997, 2971, 2998, 3001, 3002, 3005, 3003,
+    3000, 3017, 3004, 4927, 3006, 3020, 3014, 3018, 3009, 3007,
+    3008, 3011, 3010, 3026, 3012, 3025, 3013, 3024, 3028, 3015,
+    3030, 3031, 3027, 4927, 3032, 3021, 3034, 3036, 3042, 3033,
+    3029, 3040, 3035, 3037, 3038, 3039, 3050, 3051, 3041, 3043,
+    4927, 3044, 3055, 3052, 3045, 3046, 3047, 3048, 3049, 3053,
+    3061, 3063, 3066, 3054, 3056, 3064, 3057, 3058, 3059, 2849,
+
+    3060, 3065, 3062, 3067, 4927, 3068, 3069, 3099, 3070, 3073,
+    3071, 3072, 3074, 3106, 3076, 3081, 3075, 3077, 3080, 3113,
+    3114, 3084, 3115, 3110, 3083, 3116, 3117, 3133, 3119, 3120,
+    3128, 3121, 3130, 4927, 3136, 3127, 3135, 3143, 3138, 3134,
+    3129, 3079, 3132, 3139, 3146, 3137, 3147, 3140, 4927, 3154,
+    3149, 3141, 3150, 3153, 3151, 3148, 3145, 3155, 3156, 3158,
+    3157, 3159, 3152, 3144, 3160, 3161, 3162, 3163, 3164, 3165,
+    4927, 3174, 3166, 3167, 3168, 3172, 3169, 3191, 3170, 3173,
+    3178, 3171, 3187, 3180, 3177, 3176, 3193, 3192, 3189, 3194,
+    3196, 3197, 3202, 3184, 3198, 3200, 3195, 3190, 3185, 3217,
+
+    3207, 3209, 3205, 3214, 3218, 3206, 4927, 3216, 3203, 3204,
+    3215, 3232, 3208, 3222, 3219, 3220, 3213, 3226, 3221, 3223,
+    3224, 3227, 3225, 3212, 3234, 3241, 3229, 3242, 3240, 4927,
+    3243, 3244, 3228, 3246, 3230, 3249, 3247, 3233, 3235, 3252,
+    3237, 3248, 3253, 4927, 3255, 3254, 3256, 3257, 3258, 3259,
+    3250, 3251, 3260, 3263, 3261, 4927, 3267, 3271, 3262, 3277,
+    3264, 3265, 3266, 3273, 3268, 4927, 3269, 3270, 3281, 3282,
+    4927, 3284, 3272, 3274, 3275, 3276, 3278, 3279, 3280, 3283,
+    3285, 3286, 3296, 3287, 3292, 4927, 3288, 3305, 3289, 3293,
+    3291, 3294, 3297, 3306, 3300, 3301, 3299, 4927, 3322, 3142,
+
+    3313, 3307, 3302, 3298, 3304, 3314, 3308, 3303, 4927, 3311,
+    3309, 3319, 3324, 3312, 3310, 3320, 3315, 3317, 3318, 3321,
+    3316, 3332, 3331, 3334, 3323, 3335, 3333, 3342, 3329, 3339,
+    3325, 3343, 3353, 3355, 3349, 3350, 4927, 3354, 3348, 3345,
+    3337, 3344, 3341, 3352, 3356, 3340, 3357, 3358, 3347, 3351,
+    3368, 3370, 3346, 3374, 3359, 3360, 3361, 3377, 3362, 3363,
+    3366, 3379, 3364, 3365, 3367, 3371, 3373, 3372, 3376, 3375,
+    3378, 3380, 3386, 3369, 3385, 3381, 3387, 3382, 3395, 4927,
+    3393, 3384, 3383, 3388, 3401, 3397, 3402, 3403, 3389, 3390,
+    3391, 3411, 3413, 4927, 3392, 4927, 3394, 3408, 3415, 3423,
+
+    4927, 3419, 4927, 3420, 3404, 3405, 4927, 3421, 3422, 3406,
+    3417, 3424, 3414, 3407, 3425, 3416, 3426, 3427, 3418, 3435,
+    3431, 3428, 3436, 3429, 3430, 3432, 3433, 3434, 4927, 3439,
+    3437, 3440, 3438, 3442, 3441, 3444, 3443, 3445, 3450, 3448,
+    3446, 3458, 3456, 3449, 3447, 3451, 4927, 3454, 3463, 3452,
+    3464, 4927, 3453, 3468, 3471, 3459, 3457, 3461, 3475, 3473,
+    3467, 3486, 3462, 3478, 3474, 3470, 3482, 3479, 3484, 3465,
+    3480, 3497, 3491, 3492, 3489, 3485, 3477, 3481, 3483, 3503,
+    3505, 3496, 3508, 3487, 3499, 3506, 3501, 3490, 3493, 3494,
+    3495, 3500, 3502, 3507, 3498, 3513, 3504, 3509, 3511, 3488,
+
+    4927, 3518, 3510, 3515, 3517, 3512, 3514, 3516, 3519, 3522,
+    3520, 3525, 3524, 3523, 4927, 3526, 4927, 3527, 3528, 3535,
+    3539, 3540, 3530, 3521, 3529, 3533, 3531, 3542, 3538, 3550,
+    3554, 3536, 3544, 3537, 3545, 3546, 3548, 4927, 3541, 3543,
+    3557, 3547, 3555, 3560, 3566, 3559, 3551, 3549, 3556, 3578,
+    4927, 3579, 3558, 3576, 3584, 3574, 3586, 3577, 4927, 3562,
+    3570, 3591, 3573, 3585, 4927, 4927, 3568, 3571, 3581, 3580,
+    3582, 3597, 3587, 3583, 3588, 3589, 3598, 3590, 3592, 3593,
+    4927, 3599, 3594, 3595, 3600, 3603, 3604, 3601, 3596, 4927,
+    3602, 3605, 3606, 3608, 3607, 3609, 3611, 3610, 3612, 3613,
+
+    3614, 3618, 3615, 3617, 3622, 3616, 3626, 3631, 4927, 3628,
+    3627, 3632, 3625, 3619, 3635, 3620, 3575, 3621, 3623, 3637,
+    3629, 4927, 3634, 3633, 3636, 3639, 3641, 3640, 3630, 3638,
+    3649, 3658, 3642, 3645, 3646, 3652, 3654, 3657, 3659, 3647,
+    3660, 3644, 3648, 3661, 3653, 3667, 3665, 4927, 3676, 3655,
+    3677, 3656, 3651, 3669, 3675, 3678, 3683, 3668, 3663, 3664,
+    3684, 3666, 4927, 3691, 3674, 3687, 3680, 3679, 3698, 3686,
+    3673, 3681, 3697, 3671, 3699, 3685, 3682, 3700, 3704, 3689,
+    4927, 4927, 3690, 3688, 3707, 3692, 3701, 3702, 3693, 3709,
+    3694, 3696, 4927, 3708, 3720, 3695, 3710, 3722, 3724, 3723,
+
+    3716, 3714, 3705, 3711, 3712, 3725, 3713, 3703, 3726, 3732,
+    3715, 3717, 3729, 4927, 3718, 3719, 4927, 3721, 3734, 3730,
+    3733, 3740, 3737, 3735, 3744, 3727, 3731, 3736, 3738, 3750,
+    3748, 3746, 3741, 3754, 3760, 3761, 3766, 3739, 3749, 3757,
+    3769, 4927, 3752, 3762, 3755, 3743, 3775, 3751, 3776, 3759,
+    4927, 3763, 3753, 3771, 3774, 3773, 3779, 3780, 3764, 3786,
+    3777, 3781, 3782, 3772, 4927, 3784, 4927, 3787, 3770, 4927,
+    3783, 3785, 3788, 3792, 3778, 3789, 3791, 3793, 3790, 3765,
+    3794, 3795, 3796, 3804, 3797, 3799, 3805, 3798, 4927, 3806,
+    3801, 3800, 3802, 3808, 3803, 4927, 4927, 3807, 4927, 3809,
+
+    3810, 4927, 3812, 3814, 3816, 3813, 3820, 3815, 3828, 3824,
+    3821, 4927, 3817, 3811, 3831, 3825, 3818, 3823, 3826, 3829,
+    3819, 3822, 3827, 4927, 3830, 3832, 3837, 3833, 3834, 3839,
+    3835, 3836, 4927, 3838, 3845, 3840, 3843, 3842, 4927, 3844,
+    3846, 3850, 4927, 3847, 3854, 3841, 3855, 3857, 3858, 3859,
+    3848, 3849, 3868, 3860, 3861, 3862, 4927, 3852, 3863, 3869,
+    3871, 3864, 3853, 3881, 3873, 3874, 3872, 3882, 3870, 3883,
+    3884, 3877, 3885, 3875, 3891, 3886, 3879, 4927, 3880, 3878,
+    3888, 4927, 3887, 3889, 3876, 3890, 3894, 4927, 3892, 3893,
+    3896, 4927, 3897, 4927, 3899, 3895, 3898, 3900, 3903, 3902,
+
+    3907, 3905, 3908, 3901, 3911, 3912, 3906, 3927, 3918, 3928,
+    3920, 3916, 3909, 4927, 4927, 3929, 3926, 3921, 3932, 3931,
+    3922, 3915, 3941, 3933, 3937, 3934, 3943, 4927, 3936, 3923,
+    3938, 4927, 3924, 3925, 3940, 3930, 3939, 3945, 3942, 3944,
+    3948, 3947, 3951, 3946, 3952, 3949, 3950, 3953, 3960, 4927,
+    3954, 3955, 3956, 3957, 3958, 3959, 3964, 3961, 3965, 4927,
+    3963, 3966, 3967, 3970, 3935, 3972, 3971, 3968, 3969, 3973,
+    3974, 3985, 3980, 3991, 3988, 4927, 3989, 3975, 3976, 3986,
+    3998, 4000, 3981, 4002, 3984, 4004, 3999, 4006, 3992, 3990,
+    4927, 4003, 4008, 3993, 4011, 3995, 4005, 4012, 4013, 4017,
+
+    4001, 4007, 4009, 4018, 4927, 4010, 3996, 4016, 3962, 4019,
+    4014, 4020, 4021, 4927, 4022, 4023, 4025, 3997, 4024, 4015,
+    4032, 4927, 4026, 4034, 4035, 4027, 4028, 4029, 4037, 4039,
+    4040, 4031, 4042, 4030, 4036, 4044, 4045, 4047, 4048, 4046,
+    3977, 4057, 4927, 4033, 4927, 4038, 4927, 4053, 4050, 4054,
+    4062, 4052, 4927, 4049, 4051, 4065, 4058, 4059, 4927, 4063,
+    4060, 4064, 4066, 4927, 4074, 4061, 4067, 4068, 4070, 4927,
+    4082, 4079, 4078, 4090, 4091, 4085, 4089, 4075, 4092, 4080,
+    4083, 4076, 4093, 4094, 4086, 4071, 4095, 4927, 4097, 4099,
+    4098, 4100, 4084, 4102, 4927, 4087, 4088, 4096, 4105, 4101,
+
+    4106, 4109, 4107, 4103, 4104, 4927, 4108, 4110, 4120, 4111,
+    4114, 4927, 4927, 4112, 4116, 4115, 4113, 4118, 4119, 4927,
+    4121, 4133, 4117, 4129, 4122, 4927, 4927, 4131, 4927, 4123,
+    4927, 4134, 4927, 4127, 4130, 4135, 4927, 4137, 4927, 4143,
+    4139, 4126, 4072, 4138, 4927, 4125, 4136, 4146, 4927, 4140,
+    4144, 4128, 4132, 4927, 4151, 4141, 4145, 4927, 4150, 4153,
+    4148, 4152, 4142, 4147, 4154, 4156, 4158, 4159, 4163, 4155,
+    4157, 4164, 4165, 4160, 4169, 4170, 4171, 4161, 4167, 4166,
+    4162, 4172, 4168, 4173, 4174, 4175, 4181, 4176, 4177, 4178,
+    4179, 4180, 4182, 4183, 4184, 4149, 4185, 4927, 4187, 4186,
+
+    4188, 4192, 4193, 4194, 4196, 4190, 4191, 4201, 4927, 4927,
+    4205, 4195, 4198, 4197, 4199, 4927, 4200, 4203, 4202, 4206,
+    4204, 4207, 4208, 4209, 4214, 4210, 4213, 4216, 4927, 4211,
+    4217, 4215, 4218, 4219, 4221, 4220, 4222, 4223, 4226, 4224,
+    4212, 4233, 4234, 4189, 4227, 4229, 4228, 4241, 4230, 4231,
+    4243, 4232, 4237, 4235, 4247, 4254, 4927, 4236, 4927, 4245,
+    4927, 4238, 4240, 4927, 4927, 4242, 4253, 4258, 4246, 4248,
+    4261, 4259, 4927, 4249, 4263, 4266, 4255, 4927, 4250, 4251,
+    4270, 4927, 4273, 4256, 4274, 4269, 4277, 4927, 4927, 4927,
+    4927, 4276, 4257, 4265, 4267, 4272, 4927, 4927, 4927, 4278,
+
+    4268, 4279, 4280, 4271, 4281, 4282, 4275, 4283, 4927, 4284,
+    4286, 4287, 4285, 4294, 4295, 4288, 4291, 4290, 4292, 4303,
+    4293, 4300, 4289, 4297, 4304, 4306, 4927, 4927, 4296, 4308,
+    4318, 4301, 4309, 4310, 4319, 4312, 4313, 4314, 4262, 4305,
+    4307, 4311, 4315, 4316, 4320, 4317, 4927, 4323, 4927, 4322,
+    4326, 4321, 4324, 4325, 4327, 4331, 4329, 4328, 4927, 4927,
+    4330, 4332, 4334, 4336, 4335, 4333, 4340, 4341, 4338, 4337,
+    4927, 4342, 4927, 4339, 4343, 4349, 4345, 4350, 4346, 4927,
+    4351, 4348, 4927, 4344, 4352, 4347, 4927, 4362, 4365, 4366,
+    4927, 4927, 4368, 4927, 4353, 4927, 4354, 4367, 4370, 4371,
+
+    4369, 4372, 4374, 4377, 4363, 4378, 4361, 4373, 4380, 4383,
+    4375, 4356, 4384, 4381, 4927, 4927, 4392, 4364, 4376, 4379,
+    4382, 4390, 4298, 4386, 4393, 4927, 4927, 4388, 4387, 4391,
+    4927, 4385, 4394, 4404, 4389, 4395, 4396, 4397, 4400, 4408,
+    4401, 4398, 4402, 4405, 4403, 4407, 4406, 4411, 4416, 4418,
+    4419, 4410, 4422, 4409, 4302, 4424, 4399, 4412, 4413, 4927,
+    4425, 4427, 4417, 4927, 4420, 4432, 4414, 4435, 4431, 4428,
+    4927, 4421, 4439, 4436, 4433, 4426, 4449, 4434, 4437, 4927,
+    4927, 4927, 4445, 4440, 4438, 4927, 4927, 4429, 4927, 4441,
+    4927, 4430, 4927, 4447, 4450, 4442, 4927, 4444, 4448, 4927,
+
+    4451, 4457, 4927, 4460, 4461, 4463, 4454, 4446, 4452, 4459,
+    4927, 4415, 4464, 4465, 4466, 4455, 4467, 4453, 4470, 4462,
+    4474, 4458, 4469, 4471, 4472, 4456, 4473, 4927, 4476, 4468,
+    4478, 4475, 4479, 4480, 4482, 4477, 4481, 4488, 4484, 4927,
+    4483, 4486, 4485, 4927, 4498, 4499, 4500, 4927, 4487, 4927,
+    4502, 4489, 4497, 4927, 4504, 4490, 4491, 4492, 4927, 4505,
+    4493, 4927, 4494, 4513, 4514, 4506, 4501, 4503, 4507, 4518,
+    4508, 4509, 4519, 4516, 4522, 4927, 4927, 4927, 4512, 4510,
+    4531, 4527, 4525, 4537, 4515, 4927, 4529, 4521, 4523, 4532,
+    4517, 4544, 4524, 4545, 4536, 4538, 4539, 4546, 4927, 4547,
+
+    4528, 4927, 4549, 4550, 4548, 4540, 4551, 4552, 4553, 4556,
+    4554, 4927, 4558, 4927, 4927, 4927, 4541, 4927, 4542, 4557,
+    4927, 4562, 4555, 4530, 4559, 4563, 4560, 4927, 4927, 4561,
+    4569, 4564, 4567, 4927, 4568, 4565, 4927, 4566, 4570, 4571,
+    4572, 4573, 4927, 4574, 4575, 4576, 4577, 4578, 4579, 4581,
+    4584, 4585, 4580, 4582, 4589, 4583, 4586, 4590, 4927, 4927,
+    4591, 4927, 4927, 4592, 4593, 4605, 4927, 4927, 4927, 4594,
+    4927, 4596, 4615, 4606, 4927, 4616, 4598, 4600, 4927, 4618,
+    4611, 4617, 4604, 4927, 4927, 4602, 4613, 4588, 4624, 4625,
+    4610, 4621, 4619, 4633, 4587, 4628, 4629, 4612, 4614, 4609,
+
+    4630, 4631, 4620, 4622, 4635, 4623, 4626, 4644, 4643, 4927,
+    4927, 4645, 4927, 4927, 4646, 4647, 4648, 4927, 4640, 4651,
+    4927, 4652, 4637, 4641, 4653, 4642, 4656, 4927, 4927, 4638,
+    4655, 4634, 4658, 4649, 4927, 4659, 4650, 4662, 4669, 4657,
+    4660, 4654, 4661, 4664, 4665, 4663, 4670, 4666, 4667, 4927,
+    4927, 4927, 4927, 4927, 4671, 4927, 4927, 4668, 4672, 4673,
+    4674, 4927, 4675, 4676, 4678, 4679, 4677, 4685, 4680, 4927,
+    4681, 4682, 4686, 4683, 4684, 4688, 4687, 4690, 4693, 4689,
+    4691, 4692, 4694, 4699, 4696, 4698, 4697, 4707, 4701, 4716,
+    4700, 4702, 4713, 4717, 4712, 4715, 4703, 4706, 4695, 4709,
+
+    4704, 4710, 4705, 4719, 4718, 4725, 4714, 4732, 4720, 4927,
+    4721, 4927, 4722, 4927, 4927, 4733, 4734, 4726, 4729, 4723,
+    4743, 4744, 4730, 4735, 4724, 4751, 4736, 4741, 4728, 4737,
+    4738, 4739, 4927, 4731, 4740, 4748, 4927, 4742, 4752, 4754,
+    4745, 4746, 4747, 4749, 4753, 4756, 4750, 4755, 4757, 4760,
+    4766, 4758, 4762, 4761, 4759, 4767, 4764, 4773, 4927, 4769,
+    4768, 4775, 4776, 4763, 4777, 4779, 4780, 4765, 4771, 4927,
+    4778, 4774, 4782, 4790, 4927, 4787, 4781, 4785, 4783, 4784,
+    4799, 4786, 4788, 4789, 4800, 4801, 4792, 4791, 4793, 4795,
+    4927, 4798, 4802, 4794, 4796, 4797, 4804, 4806, 4805, 4803,
+
+    4807, 4808, 4809, 4813, 4814, 4810, 4927, 4772, 4812, 4811,
+    4823, 4824, 4821, 4820, 4815, 4828, 4826, 4827, 4830, 4817,
+    4839, 4838, 4833, 4837, 4841, 4834, 4835, 4825, 4840, 4829,
+    4836, 4831, 4832, 4852, 4842, 4843, 4927, 4848, 4844, 4927,
+    4847, 4849, 4845, 4846, 4854, 4853, 4850, 4851, 4855, 4856,
+    4857, 4927, 4860, 4858, 4859, 4865, 4861, 4864, 4862, 4866,
+    4871, 4868, 4867, 4863, 4927, 4876, 4877, 4872, 4927, 4875,
+    4884, 4878, 4879, 4869, 4882, 4870, 4927, 4927, 4885, 4873,
+    4927, 4886, 4888, 4880, 4881, 4883, 4887, 4895, 4889, 4890,
+    4894, 4897, 4891, 4898, 4927, 4902, 4903, 4896, 4927, 4899,
+
+    4927, 4927, 4927, 4900, 4892, 4893, 4908, 4911, 4927, 4927,
+    5050, 5091, 5132, 5173, 5214, 5255, 5296, 5337, 5378, 5419,
+    5460, 5501, 5542, 5583, 5624, 5665, 5706, 5829, 5870, 5911,
+    5952, 5993, 6034, 6075, 6116, 6157, 6198, 6239, 6280, 6321,
+    6362, 6403, 6444, 6485, 6526, 6567, 6608, 6649, 6772, 6813,
+    6854, 6895, 6936, 6977, 7018, 7059, 7100, 7141, 7182, 7223,
+    7264, 7305, 7346, 7387, 7428, 4927
     } ;
 
-static yyconst flex_int16_t yy_def[2577] =
+static yyconst flex_int16_t yy_def[2867] =
     {   0,
-     2562,    1, 2563, 2563, 2564, 2564, 2565, 2565, 2566, 2566,
-     2567, 2567, 2562, 2568, 2562, 2562, 2562, 2562, 2569, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2570, 2562, 2562, 2562, 2570, 2571, 2562, 2562,
-     2562, 2571, 2572, 2562, 2562, 2562, 2562, 2572, 2573, 2562,
-     2562, 2562, 2573, 2574, 2562, 2575, 2562, 2574, 2574, 2568,
-     2568, 2562, 2576, 2569, 2576, 2569, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2570, 2570,
-     2571, 2571, 2572, 2572, 2562, 2573, 2573, 2574, 2574, 2575,
-     2575, 2574, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2574, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2574, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2574, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2574, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2562, 2562, 2568, 2562,
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2574, 2568, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2574, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2562, 2568, 2568,
-     2568, 2568, 2562, 2568, 2562, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2562, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2562, 2568, 2562, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2562, 2568, 2568, 2568, 2562, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2562, 2562, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2562, 2562, 2568,
-     2562, 2568, 2562, 2562, 2568, 2568, 2568, 2562, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2562, 2562, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2562,
-     2568, 2568, 2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2562, 2562, 2562,
-     2562, 2568, 2568, 2568, 2568, 2568, 2562, 2562, 2562, 2568,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568,
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2562, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-
-     2562, 2562, 2568, 2562, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2562, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2562, 2562, 2568, 2568, 2568, 2562, 2562, 2568, 2562, 2568,
-     2562, 2568, 2562, 2568, 2568, 2568, 2562, 2568, 2568, 2562,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2568, 2568, 2562, 2568, 2562,
-     2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2562, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2562, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2562, 2568, 2562, 2562, 2568, 2562, 2568,
-
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2562,
-     2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2562, 2568, 2562, 2562, 2568, 2568, 2568, 2562,
-     2562, 2562, 2568, 2562, 2568, 2568, 2568, 2562, 2568, 2568,
-     2568, 2562, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2562, 2562, 2568, 2562, 2562, 2568,
-     2568, 2568, 2562, 2568, 2568, 2562, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568, 2562,
-
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2562, 2562, 2562,
-     2562, 2562, 2568, 2562, 2562, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2562, 2568, 2562, 2568, 2562, 2562, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568, 2568,
-     2562, 2568, 2568, 2562, 2568, 2568, 2568, 2568, 2568, 2562,
-     2568, 2568, 2568, 2568, 2568, 2568, 2562, 2568, 2568, 2568,
-     2562, 2568, 2562, 2562, 2568, 2568, 2568, 2568, 2568, 2562,
-     2562,    0, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562
+    2866, 2866,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1, 2866, 2866, 2866, 2866, 2866, 2866,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866, 2866, 2866,   14,   14, 2866, 2866,
+    2866,   14,   14, 2866, 2866, 2866, 2866,   14,   14, 2866,
+    2866, 2866,   14,   14, 2866,   14, 2866,   14,   14,   14,
+      14,   15,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   54,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866,   14, 2866, 2866,   14, 2866,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14, 2866,   14,   14,   14,   14,
+
+    2866,   14, 2866,   14,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14, 2866, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866,   14, 2866,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14, 2866, 2866,   14, 2866,   14,
+
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14, 2866,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14, 2866,   14, 2866,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14, 2866,   14, 2866,   14, 2866,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14,   14,   14,   14, 2866,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+      14, 2866, 2866,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14, 2866, 2866,   14, 2866,   14,
+    2866,   14, 2866,   14,   14,   14, 2866,   14, 2866,   14,
+      14,   14,   14,   14, 2866,   14,   14,   14, 2866,   14,
+      14,   14,   14, 2866,   14,   14,   14, 2866,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14, 2866, 2866,
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866,   14, 2866,   14,
+    2866,   14,   14, 2866, 2866,   14,   14,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14,   14, 2866,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14, 2866, 2866, 2866,
+    2866,   14,   14,   14,   14,   14, 2866, 2866, 2866,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866, 2866,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14, 2866,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14, 2866,   14,   14,   14, 2866,   14,   14,   14,
+    2866, 2866,   14, 2866,   14, 2866,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14, 2866, 2866,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14, 2866,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+    2866, 2866,   14,   14,   14, 2866, 2866,   14, 2866,   14,
+    2866,   14, 2866,   14,   14,   14, 2866,   14,   14, 2866,
+
+      14,   14, 2866,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14, 2866,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14, 2866,   14,   14,   14, 2866,   14, 2866,
+      14,   14,   14, 2866,   14,   14,   14,   14, 2866,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14, 2866, 2866, 2866,   14,   14,
+      14,   14,   14,   14,   14, 2866,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14, 2866, 2866, 2866,   14, 2866,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14, 2866, 2866,   14,
+      14,   14,   14, 2866,   14,   14, 2866,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866, 2866,
+      14, 2866, 2866,   14,   14,   14, 2866, 2866, 2866,   14,
+    2866,   14,   14,   14, 2866,   14,   14,   14, 2866,   14,
+      14,   14,   14, 2866, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+    2866,   14, 2866, 2866,   14,   14,   14, 2866,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14, 2866, 2866,   14,
+      14,   14,   14,   14, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+    2866, 2866, 2866, 2866,   14, 2866, 2866,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14, 2866,   14, 2866, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14, 2866,   14,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14, 2866,
+      14,   14,   14,   14, 2866,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+
+      14,   14,   14,   14,   14,   14, 2866,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14, 2866,   14,   14, 2866,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14, 2866,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866,   14,   14,   14, 2866,   14,
+      14,   14,   14,   14,   14,   14, 2866, 2866,   14,   14,
+    2866,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14, 2866,   14,   14,   14, 2866,   14,
+
+    2866, 2866, 2866,   14,   14,   14,   14,   14, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866,    0
     } ;
 
-static yyconst flex_uint16_t yy_nxt[5056] =
+static yyconst flex_int16_t yy_nxt[7469] =
     {   0,
-       14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
-       14,   14,   18,   20,   21,   22,   23,   24,   25,   26,
-       14,   27,   28,   29,   30,   31,   32,   33,   34,   35,
-       36,   37,   38,   39,   40,   41,   14,   14,   14,   42,
-       44,   45,   46,   44,   45,   46,   49,   50,   49,   50,
-       51,   47,   51,   70,   47,   70,   70,   52,   70,   52,
-       54,   55,   56,   57,   70,   18,   54,   55,   56,   57,
-       71,   18,   58,   60,   61,   62,   71,   81,   58,   60,
-       61,   62,   72,   71,   63,  101,   73,   91,   70,   71,
-       63,   15,   16,   17,   65,   66,   67,   75,   71,   75,
-
-       75,   71,   75,   68,  103,  155,  102,   92,   75,   76,
-      139,  139,   69,   15,   16,   17,   65,   66,   67,   71,
-       71,   82,   77,   78,   71,   68,   79,   71,   83,   86,
-       71,   93,   84,   87,   69,   85,   88,  149,   89,   90,
-       80,   71,   95,   71,   71,   94,   71,  104,   97,  167,
-       96,   98,   71,  108,   71,  105,   71,  109,   99,  112,
-      100,  106,   71,  113,  111,  107,   71,  118,  149,  114,
-      117,  119,  115,  110,   72,   71,  149,  138,   73,  116,
-      122,  120,  152,  123,  121,   71,  127,   71,  128,  141,
-      124,  131,  141,   71,  125,  126,  153,  129,   71,   71,
-
-      135,  132,  154,  130,  136,  133,  134,  143,  137,  143,
-      143,   71,  143,  146,  146,   75,   71,   75,   75,  148,
-       75,  148,  148,   70,  148,   70,   70,  151,   70,   71,
-       75,  156,   75,   75,   70,   75,   71,   71,  301,  157,
-      158,   75,   76,   71,   71,   71,   71,  160,   71,  169,
-       71,  163,  161,  159,   71,   71,   71,  164,  162,   71,
-       71,  173,  174,  147,  165,  166,   71,  168,  170,   71,
-      171,  178,   71,  177,  172,  184,   71,  175,  176,  180,
-       71,   71,  181,   71,   71,   71,  179,  189,  187,   71,
-       71,  190,   71,   71,  194,  182,  183,   71,   71,  186,
-
-      185,   71,   71,  193,  191,  195,  196,   71,  188,  192,
-      198,   71,  199,   71,  197,  201,   71,   71,  203,  200,
-      202,   71,  204,   71,  206,  208,   71,   71,  145,   71,
-       71,   71,  213,  217,  209,   71,  205,  207,   71,   71,
-      210,  211,  218,  214,  216,   71,  212,  215,   71,  219,
-       71,   71,   71,  221,  222,   71,   71,  226,   71,   71,
-       71,   71,  141,  229,  223,  141,  232,  225,  228,  220,
-      231,  224,  230,  233,  139,  139,   71,  143,  227,  143,
-      143,  235,  143,  146,  146,  148,   71,  148,  148,   75,
-      148,   75,   75,  149,   75,   71,  234,  236,   71,   71,
-
-       71,  151,   71,   71,  238,   71,  239,  144,  242,   71,
-      241,   71,  237,  240,  243,  248,  245,  244,  247,   71,
-       71,   71,  249,  252,  250,  246,   71,  251,  253,   71,
-       71,   71,   71,  254,  142,  256,   71,  261,   71,  262,
-      257,   71,  266,  263,  265,  258,  264,   71,   71,   71,
-      255,  259,  260,  268,   71,   71,   71,   71,   71,  269,
-       71,  270,   71,  275,  140,  276,   71,   71,  277,  272,
-      271,  267,  273,  278,  274,   71,   71,  284,   71,  285,
-      281,   71,  282,   71,  286,  279,  288,  280,  289,   71,
-       71,  292,  283,  294,   71,   71,  287,   71,  290,   71,
-
-      293,  295,  291,   71,   71,   71,   71,   71,   71,   71,
-      296,  298,   71,   71,  300,   71,   71,  297,  304,   71,
-      302,   71,  303,   71,  305,   71,  299,   71,  309,   71,
-      313,  306,   71,  311,  316,  307,   71,   71,   71,   71,
-       71,  308,   71,  310,  318,  319,  320,  321,  323,  312,
-      314,  315,   71,   71,   71,   71,   71,  317,  322,   71,
-      325,  326,   71,  327,  329,  149,   71,  324,  330,   71,
-       71,   71,   71,   71,   71,   71,  333,  334,  339,  332,
-      338,  336,  340,  343,   71,  331,   71,  328,   71,   71,
-       71,  335,   71,   71,  337,  341,   71,  342,   71,   71,
-
-       71,  344,   71,   71,   71,  350,  351,  345,  348,   71,
-      352,   71,  347,  353,  346,   71,   71,   71,  355,   71,
-      356,  354,   71,  362,  349,  359,   71,  357,   71,   71,
-      358,   71,  360,  364,   71,  361,  365,   71,   71,   71,
-      370,  366,   71,  368,   71,  363,   71,   71,   71,  369,
-       71,   71,  375,   71,   71,   71,  372,  376,  367,  378,
-       71,   71,  380,  374,   71,   71,   71,  371,  382,  373,
-      384,  377,   71,   71,   71,  391,   71,  385,  379,   71,
-       71,   71,  381,  393,  383,  386,  392,   71,  387,   71,
-       71,  397,  398,  399,   71,   71,  388,  389,  400,  390,
-
-      395,  394,  396,   71,   71,   71,   71,  406,   71,   71,
-      408,   71,   71,   71,  404,  405,  407,   71,  410,  403,
-      401,   71,   71,  402,   71,  415,   71,  409,   71,  411,
-      418,   71,   71,  417,   71,  491,   71,  419,   71,  414,
-      412,   71,  413,  420,   71,   71,  416,  425,  422,  421,
-      423,  430,   71,   71,   71,  424,   71,   71,  431,   71,
-      426,  429,   71,  427,   71,  428,   71,  432,   71,  434,
-       71,   71,   71,  442,  149,  433,  438,  440,  441,   71,
-      439,   71,  435,  452,   71,  436,  444,  437,  453,  443,
-       71,  454,  445,  446,   71,  457,  455,   71,   71,   71,
-
-      456,   71,  447,  458,  448,  449,  450,  462,  460,  451,
-       71,   71,  465,  459,   71,   71,   71,   71,   71,   71,
-      461,  473,  466,   71,  471,  464,   71,   71,   71,   71,
-      463,   71,  470,  477,   71,  468,  469,  467,  472,   71,
-      475,   71,   71,  476,   71,   71,  474,  480,  481,  482,
-      479,   71,   71,   71,   71,  487,  478,   71,  488,  486,
-      484,  483,   71,   71,   71,   71,  489,   71,  485,   71,
-       71,   71,  492,   71,  496,  500,  499,  501,  503,  493,
-      502,  490,  494,  495,   71,  497,   71,  498,   71,   71,
-       71,   71,   71,  506,  505,  507,   71,  509,   71,   71,
-
-       71,  513,  514,  511,   71,  510,   71,  504,   71,   71,
-      515,  508,  512,   71,  517,   71,   71,   71,   71,   71,
-       71,  523,  518,  522,   71,  516,   71,  519,   71,  521,
-       71,  524,   71,  526,  520,   71,  527,  530,  529,  525,
-       71,   71,   71,   71,   71,  528,  537,   71,  539,   71,
-       71,   71,   71,  532,   71,  540,  538,  542,  536,   71,
-      531,  533,  535,  534,  543,  541,   71,  546,   71,  545,
-       71,   71,   71,   71,   71,   71,  549,   71,   71,  544,
-      553,  552,  548,   71,   71,   71,   71,   71,  555,   71,
-      149,  547,   71,  554,  550,  551,   71,  568,   71,   71,
-
-      556,  570,  567,   71,  557,   71,  558,  565,  566,  572,
-       71,  559,   71,  560,  569,   71,   71,  577,  576,  571,
-      573,  561,   71,  579,  562,  563,  574,   71,   71,   71,
-      575,  564,   71,   71,   71,   71,   71,  578,   71,   71,
-      585,  581,   71,  580,   71,  586,  149,  582,  589,  592,
-      591,   71,  583,  590,  588,   71,  584,  587,   71,   71,
-       71,   71,   71,  593,   71,   71,  598,  600,   71,  602,
-       71,   71,   71,  594,  603,  596,  601,  599,  595,  597,
-       71,  605,   71,  604,  606,  607,   71,   71,   71,   71,
-       71,   71,  610,  609,  614,   71,  617,   71,  619,  615,
-
-       71,  608,  618,   71,   71,   71,  611,  613,  616,  612,
-      620,   71,  621,   71,  622,   71,   71,   71,   71,   71,
-       71,  624,  627,   71,   71,  626,  623,  631,  630,   71,
-       71,   71,   71,   71,  625,  632,   71,  634,  636,   71,
-       71,  628,  629,   71,   71,  637,  639,  633,   71,  643,
-      635,  640,   71,  638,  642,  641,   71,   71,   71,   71,
-      649,  645,  646,   71,   71,   71,   71,  652,  651,   71,
-      644,   71,  647,  650,  648,   71,  654,   71,   71,   71,
-      655,  659,   71,  658,   71,  656,   71,  663,  660,  653,
-      657,   71,   71,   71,   71,  665,   71,  664,  662,  666,
-
-      661,   71,   71,  670,   71,   71,  667,  672,   71,   71,
-      671,  673,  668,   71,   71,  675,  669,  677,   71,  674,
-      676,   71,   71,  681,   71,   71,  686,   71,   71,   71,
-      684,  678,   71,   71,  683,   71,  691,   71,  688,   71,
-      687,  679,  680,  682,  689,  685,   71,   71,  693,  690,
-       71,   71,   71,  695,   71,   71,   71,   71,  694,   71,
-       71,  701,  692,   71,   71,  696,   71,   71,  702,   71,
-      697,  708,  698,   71,  699,  703,  700,   71,  706,   71,
-       71,  704,  707,  705,   71,   71,   71,  715,  709,   71,
-       71,   71,  710,  716,   71,   71,  719,  711,  712,   71,
-
-       71,   71,  713,   71,  714,  718,   71,   71,  723,  717,
-      725,  720,  724,  722,   71,   71,   71,   71,  721,  726,
-      727,   71,   71,  729,  728,   71,  730,  149,   71,   71,
-       71,  732,  734,  735,   71,  731,   71,  733,  736,   71,
-      741,   71,  737,  739,   71,  738,   71,  742,  744,   71,
-       71,  747,   71,  745,   71,  743,   71,   71,  749,   71,
-      740,  752,   71,   71,   71,   71,   71,   71,  750,  746,
-      753,   71,  748,   71,   71,  764,  757,  751,   71,   71,
-      758,  754,   71,  759,  765,  756,  766,   71,  762,  755,
-      760,  763,   71,  761,   71,  767,   71,  768,  769,  771,
-
-       71,  772,   71,   71,   71,  780,  770,   71,   71,  773,
-      774,   71,  775,   71,  784,  776,  785,   71,   71,   71,
-      777,  782,   71,  781,  790,  786,  778,  779,  788,  783,
-       71,  787,   71,  789,   71,   71,   71,  791,  793,   71,
-      792,  795,   71,   71,   71,   71,  796,   71,  800,   71,
-       71,  794,  799,   71,   71,   71,  806,   71,  818,   71,
-      805,  804,  808,  797,  798,  801,   71,  802,   71,  809,
-       71,  807,  803,  810,   71,   71,   71,   71,   71,   71,
-      811,   71,   71,   71,  812,  813,  815,   71,  821,  816,
-       71,   71,  819,   71,   71,  820,  814,   71,  817,   71,
-
-      823,   71,  824,   71,  825,   71,  826,   71,  827,  822,
-       71,  830,  828,   71,   71,  829,   71,   71,  831,   71,
-      835,  837,   71,  833,  838,   71,   71,   71,  836,   71,
-       71,  840,  832,   71,   71,   71,   71,   71,   71,   71,
-      834,  847,   71,  839,  846,  850,   71,   71,  841,  842,
-      843,   71,  855,   71,  845,  844,  848,  854,  849,  851,
-      853,  852,   71,   71,   71,   71,   71,   71,  862,   71,
-      864,   71,   71,   71,   71,  865,   71,   71,   71,  871,
-      147,  861,  856,  857,  858,  867,  860,  859,  872,  863,
-       71,  866,   71,  868,   71,  869,   71,  876,  870,  873,
-
-       71,   71,   71,   71,  878,   71,   71,  881,  149,   71,
-      874,  880,   71,  875,   71,  884,  883,   71,   71,   71,
-      879,  877,   71,  886,  882,   71,   71,   71,   71,  898,
-       71,   71,   71,   71,  899,   71,   71,  902,  887,  885,
-      889,  904,   71,   71,  145,  890,  888,  900,  891,   71,
-      903,  949,  892,   71,  893,   71,  901,  905,  894,   71,
-      895,  906,   71,  909,   71,  896,  907,   71,  910,  908,
-      897,   71,   71,   71,   71,  918,  911,  913,  914,   71,
-      917,   71,   71,  915,  919,   71,  912,  916,  920,  921,
-       71,   71,   71,   71,   71,   71,   71,  931,  922,   71,
-
-      923,   71,  924,  930,  932,   71,  933,  925,   71,  926,
-       71,  934,   71,  935,   71,  938,  940,   71,  939,  937,
-      927,  928,  936,  942,   71,   71,  946,  929,  941,   71,
-       71,  944,   71,  943,   71,   71,   71,   71,  945,  947,
-      952,   71,   71,   71,   71,  950,   71,   71,  955,   71,
-      953,   71,  961,  951,  948,   71,   71,   71,   71,   71,
-      959,  954,   71,  957,  956,  960,   71,  958,   71,  962,
-       71,  969,  971,  966,   71,  967,  963,  964,   71,  968,
-       71,  965,   71,  970,   71,  974,   71,   71,   71,  976,
-      975,   71,  977,  972,   71,   71,   71,  978,  984,   71,
-
-      973,  979,   71,   71,   71,   71,  980,   71,  986,  982,
-       71,   71,  988,  981,  983,  989,   71,   71,   71,   71,
-       71,  991,  985,  992,  987,  994,   71,  990,  997,  993,
-      998,   71,  996,   71,   71,   71,  995,   71,   71,   71,
-     1001,   71,  999, 1006,   71, 1007,   71,   71, 1011,   71,
-       71,   71, 1008, 1000,   71, 1009, 1002, 1005, 1003, 1012,
-       71, 1004,   71,   71, 1010,   71,   71,   71, 1015, 1019,
-       71, 1013, 1020,   71,   71,   71,   71, 1016,   71, 1022,
-       71, 1014, 1018, 1023,   71, 1017,   71, 1027, 1021,   71,
-       71,   71,   71,   71, 1025, 1024,   71,   71, 1026, 1029,
-
-     1033,   71,   71,   71,   71,   71,  144, 1028, 1037, 1038,
-       71, 1030, 1035, 1040, 1041, 1032, 1034, 1036, 1031,   71,
-       71,   71,   71,   71, 1039, 1043, 1042, 1044,   71,   71,
-       71,   71,   71,   71,   71, 1047,   71, 1053,   71,   71,
-     1050,   71, 1045, 1046,   71,   71, 1048,   71,   71, 1051,
-     1056, 1049, 1058, 1054,   71, 1052,   71, 1062,   71, 1055,
-     1081, 1059,   71, 1060,   71, 1057, 1061, 1063, 1065,   71,
-       71, 1064, 1066,   71,   71,   71, 1067,   71, 1069, 1068,
-     1071, 1073,   71,   71,   71,   71,   71,   71, 1074,   71,
-     1076, 1077,   71, 1070,   71, 1078, 1072,   71,   71,   71,
-
-       71,   71,   71,   71, 1075, 1083,   71, 1079, 1080, 1082,
-       71, 1084, 1088,   71, 1093,   71, 1085, 1089,   71, 1087,
-       71, 1086, 1092, 1090,   71,   71, 1095,   71, 1099, 1094,
-     1091,   71, 1097, 1100,   71,   71,   71, 1098,   71,   71,
-     1104,   71, 1113,  142, 1096, 1112,   71, 1114,   71, 1102,
-     1101, 1103,   71,   71, 1111,   71,   71, 1105, 1115,   71,
-     1106, 1107,   71,   71, 1116, 1108,   71, 1117, 1118,   71,
-     1119, 1109,   71,   71,  140, 1110, 1120, 1124, 1122, 1125,
-     1123, 1121, 1126,   71,   71,   71,   71, 1128,   71, 1127,
-       71, 1134, 1135,   71,   71, 1129,   71, 1137,   71,   71,
-
-     1130,   71, 1131, 1141, 1132,   71, 1133, 1136, 1142,   71,
-     1140,   71,   71, 1138,   71,   71, 1144, 1139,   71,   71,
-       71,   71,   71, 1146, 1150,   71, 1145, 1143, 1148,   71,
-       71, 1152, 1149,   71, 1147, 1151, 1156,   71, 1155, 1158,
-       71,   71,   71, 1153, 1159, 1157,   71,   71,   71, 1160,
-     1163,   71, 1161,   71, 1154, 1165,   71,   71, 1166,   71,
-     1162, 1169,   71,   71,   71,   71,   71, 1172, 1164, 1171,
-       71, 1174,   71, 1173,   71,   71,   71, 1176, 1167,   71,
-     1168, 1177, 1175, 1170,   71, 1178,   71,   71,   71, 1183,
-     1184,   71, 1180, 1179, 1181,   71,   71,   71, 1186,   71,
-
-     1187, 1182, 1185,   71,   71, 1190,   71,   71,   71,   71,
-     1194, 1195,   71, 1196, 1189,   71,   71,   71, 1188,   71,
-       71,   71,   71,   71, 1200,   71, 1203, 1191, 1192, 1197,
-       71,   71, 1193,   71,   71, 1198, 1201,   71, 1207, 1202,
-     1199, 1208,   71, 1204,   71,   71, 1212,   71,   71, 1206,
-     1210, 1213,   71, 1214,   71, 1205, 1211, 1209,   71,   71,
-       71, 1216, 1215, 1217, 1220, 1224,   71, 1221, 1222,   71,
-       71,   71,   71, 1218, 1223,   71, 1219,   71,   71, 1225,
-     1226,   71,   71, 1230,   71,   71,   71,   71, 1235, 1227,
-       71,   71,   71,   71, 1236, 1229, 1239,   71, 1228, 1231,
-
-     1233,   71, 1232, 1234,   71,   71,   71,   71,   71, 1237,
-       71, 1238, 1240, 1245, 1246, 1241, 1244,   71,   71, 1242,
-     1243,   71, 1247,   71, 1248,   71, 1250, 1249,   71, 1252,
-       71, 1253, 1255, 1254, 1256,   71, 1251,   71,   71, 1260,
-       71,   71, 1257,   71, 1258, 1259,   71,   71, 1262,   71,
-       71, 1263,   71, 1266,   71,   71, 1261, 1265,   71,   71,
-       71, 1272,   71, 1268, 1264, 1269, 1273,   71,   71,   71,
-     1274,   71, 1270, 1280, 1267, 1275,   71,   71, 1271,   71,
-       71,   71, 1276,   71,   71, 1284,   71, 1277, 1278, 1283,
-     1279,   71,   71,   71,   71,   71,   71, 1292, 1289, 1282,
-
-     1285,   71,   71, 1281, 1293, 1286, 1295,   71,   71,   71,
-     1291, 1287, 1288, 1296, 1294, 1290,   71,   71,   71,   71,
-     1297, 1301, 1298,   71,   71, 1302, 1299,   71, 1304,   71,
-       71, 1300, 1308,   71,   71, 1309,   71,   71, 1303, 1305,
-     1310, 1311,   71,   71, 1315, 1307,   71, 1306, 1316,   71,
-       71,   71,   71, 1321, 1312,   71, 1320, 1319,   71,   71,
-     1313, 1322,   71, 1314, 1317, 1323,   71,   71,   71,   71,
-     1327, 1326, 1318,   71, 1324,   71,   71, 1330,   71,   71,
-     1329,   71, 1333, 1325,   71,   71,   71, 1337,   71,   71,
-     1335,   71,   71, 1331, 1328, 1338,   71, 1340, 1334,   71,
-
-       71, 1336,   71,   71, 1332,   71, 1343,   71, 1345, 1339,
-     1342, 1346,   71,   71, 1341,   71,   71, 1352,   71, 1344,
-       71, 1348,   71, 1347,   71, 1353,   71,   71,   71, 1351,
-     1359,   71, 1349, 1350,   71, 1356, 1357, 1361, 1354, 1360,
-     1363,   71, 1355,   71, 1358,   71,   71, 1362, 1365,   71,
-       71,   71,   71, 1369,   71, 1364, 1367,   71, 1370,   71,
-       71,   71,   71, 1374, 1366,   71, 1375,   71, 1371,   71,
-       71, 1388, 2562, 1381, 1376, 1368, 1373, 1372,   71,   71,
-       71, 1378,   71,   71, 1379, 1382,   71, 1377, 1384, 1386,
-       71, 1383, 1387,   71, 1385, 1390, 1380,   71,   71,   71,
-
-     1389,   71,   71, 1395, 1396, 1398, 1391,   71,   71,   71,
-       71,   71, 1397,   71,   71, 1392, 1401,   71, 1400, 1402,
-     1393,   71, 1394,   71,   71,   71,   71,   71, 1410,   71,
-       71, 1399,   71,   71,   71,   71,   71, 1408,   71, 1403,
-     1406, 1407, 1409, 1404, 1405, 1415,   71, 1413,   71,   71,
-     1411, 1419, 1412, 1417,   71, 1418, 1414,   71, 1416,   71,
-       71,   71,   71, 1420,   71,   71,   71,   71,   71, 1423,
-     2562, 1425, 1432,   71,   71, 1426, 1424, 1422, 1427,   71,
-     1429, 1421, 1434, 1428, 1437, 1430,   71, 1431, 1433,   71,
-       71, 1436,   71, 1435,   71,   71, 1443, 1444,   71, 1438,
-
-       71,   71,   71, 1440, 1442,   71, 1441,   71,   71,   71,
-       71, 1439,   71,   71, 1446,   71, 1453,   71,   71, 1457,
-     1445, 1448, 1450, 1447, 1449,   71, 1455,   71,   71, 1454,
-     1452,   71, 1456, 1458, 1451,   71, 1464, 1459, 1466,   71,
-     1460, 1465,   71, 1461,   71, 1468,   71,   71, 1469,   71,
-       71,   71, 1462, 1463,   71, 1470, 1471, 1467,   71, 1475,
-       71,   71,   71, 1474, 1472,   71,   71, 1473,   71, 1477,
-     1479,   71,   71, 1476,   71, 1478, 1481, 1484,   71,   71,
-     1480,   71, 1489,   71, 1482,   71, 1483, 1485,   71,   71,
-     1492,   71,   71,   71, 1488,   71, 1486, 1494, 1487,   71,
-
-     1495, 1490,   71,   71, 1496,   71,   71, 1491, 1497, 1501,
-       71, 1498, 1493,   71,   71,   71,   71,   71,   71,   71,
-       71, 1500, 2562,   71, 1506,   71, 1503, 1511, 1499,   71,
-     1505, 1507, 1502,   71, 1504, 1508,   71, 1509, 1515,   71,
-     1510, 1512, 1514, 1513,   71, 1517,   71, 1516,   71,   71,
-     1520,   71,   71, 1518,   71,   71, 1522,   71, 1519,   71,
-     1523,   71,   71,   71, 1521,   71,   71,   71, 1528,   71,
-       71,   71, 1537,   71, 1529, 1524, 1532,   71, 1530, 1526,
-     1527, 1525, 1531,   71, 1538, 1536, 1533,   71,   71, 1535,
-       71,   71,   71, 1542,   71, 1543, 1544,   71,   71, 1534,
-
-     1545,   71, 1547,   71, 1539,   71, 1540,   71, 1541, 1550,
-       71, 1551, 1546,   71, 1552, 1554, 1553,   71, 1556, 1548,
-       71,   71,   71,   71,   71,   71, 1549, 1561, 1558, 1559,
-       71,   71, 1560,   71,   71, 1555,   71,   71, 1568,   71,
-     1570,   71,   71, 1566,   71, 1571,   71, 1557, 1562, 1563,
-     1564,   71, 1574, 1572, 1567, 1565,   71, 1569, 1573, 1576,
-       71,   71, 1578, 1580,   71,   71, 1575,   71,   71, 1577,
-       71, 1582,   71,   71, 1585, 1586,   71,   71,   71, 1589,
-       71,   71, 1579,   71,   71,   71, 1587,   71, 1583,   71,
-     1591,   71, 1594, 1581, 1584,   71, 1590,   71, 1592, 1588,
-
-     1597, 1598,   71, 1596, 1603,   71, 1601,   71, 1602, 1600,
-     1593, 1595,   71,   71,   71,   71,   71, 1599, 1604,   71,
-       71,   71,   71,   71, 1605, 1609,   71, 1612, 1613,   71,
-       71,   71, 1608,   71,   71, 1616, 1606,   71, 1607, 1610,
-       71,   71,   71,   71, 1615, 1621, 1624,   71, 1622, 1611,
-     1614, 1617, 1618,   71,   71, 1619, 1620,   71, 1625, 1628,
-       71,   71, 1623,   71, 1629,   71, 1633,   71, 1626, 1634,
-       71, 1635,   71, 1627, 1639, 1630,   71, 1638,   71, 1640,
-       71,   71, 1641, 1631, 1642, 1632,   71, 1636,   71, 1645,
-       71,   71, 1637,   71,   71,   71,   71, 1647, 1644, 1650,
-
-       71,   71, 1652, 1646,   71,   71, 1648, 1643,   71,   71,
-       71,   71,   71, 1653, 1657, 1656, 1654,   71, 1658, 1659,
-       71, 1649, 1651, 1660,   71, 1662,   71,   71, 1655,   71,
-       71,   71, 1661, 1663, 1664, 1666, 1665,   71,   71,   71,
-       71, 1668, 1667,   71,   71, 1673,   71,   71,   71, 1672,
-       71, 1669, 1670, 1675,   71, 1671, 1674, 1677,   71, 1676,
-       71,   71,   71,   71,   71,   71,   71, 1682, 1684, 1679,
-     1678, 1683,   71, 1686,   71,   71,   71,   71, 1685, 1680,
-       71, 1681,   71, 1688, 1687, 1689, 1690, 1691, 1693,   71,
-       71,   71,   71, 1692, 1698,   71,   71, 1700, 1694,   71,
-
-       71, 1701, 1702,   71,   71, 1697, 1695, 1696,   71,   71,
-       71, 1704, 1699,   71, 1706,   71, 1703,   71,   71, 1707,
-       71,   71,   71,   71,   71,   71,   71, 1718,   71, 1705,
-     1709, 1714, 1710, 1711,   71, 1717, 1708, 1713,   71,   71,
-       71, 1721, 1719, 1712, 1715, 1722, 1716,   71,   71,   71,
-     1725,   71, 1724,   71, 1720,   71, 1727,   71,   71, 1723,
-     1728,   71,   71, 1730, 1729, 1732,   71, 1726,   71,   71,
-       71, 1731, 1735, 1734, 1736,   71,   71, 1740,   71,   71,
-     1737,   71, 1739,   71, 1733,   71, 1741, 1743,   71, 1746,
-       71, 1742,   71, 1747, 1738,   71,   71, 1750,   71,   71,
-
-       71, 1752, 1745,   71, 1744, 1751, 1753, 1755,   71,   71,
-     1748,   71, 1757,   71, 1754,   71, 1749,   71, 1758, 1763,
-       71, 1756, 1759,   71,   71, 1760, 1761,   71,   71,   71,
-       71,   71, 1764,   71, 1767, 1768, 1762,   71,   71, 1765,
-     1766,   71,   71,   71, 1769,   71,   71,   71, 1775,   71,
-     1776,   71, 1777, 1770, 1774, 1771, 1772, 1773,   71,   71,
-     1784,   71,   71,   71, 1779, 1778, 1781,   71, 1783,   71,
-     1780, 1785, 1786,   71, 1782,   71,   71, 1796, 1791, 1788,
-     1790, 1789, 1787, 1792,   71, 1793, 1794,   71,   71,   71,
-     1795,   71,   71, 1798,   71,   71, 1799,   71, 1802, 1803,
-
-       71,   71, 1804,   71,   71, 1807,   71,   71, 1797, 1805,
-     1800,   71, 1808, 1809,   71,   71,   71, 1811, 1818,   71,
-     1810, 1801, 1806,   71,   71,   71, 1813,   71, 1812, 1814,
-       71,   71, 1816,   71,   71, 1819, 1822,   71,   71,   71,
-       71, 1815, 1817, 1823,   71, 1825,   71,   71, 1824, 1820,
-     1821, 1828, 1829,   71,   71,   71,   71,   71,   71,   71,
-       71,   71,   71, 1827, 1826, 2562, 1830, 1839,   71,   71,
-       71, 1836, 1840, 1831, 1841,   71, 1834, 1838, 1832, 1835,
-     1833, 1837,   71, 1844, 1842, 1845,   71,   71, 1843, 1846,
-       71,   71,   71, 1849,   71, 1852,   71,   71,   71,   71,
-
-       71,   71, 1847, 1850, 1848, 1853, 1851,   71, 1858,   71,
-       71, 1857, 1854, 1859,   71, 1861,   71, 1855, 1856,   71,
-     1860, 1863,   71, 1864,   71,   71,   71,   71, 1862, 1868,
-       71, 1867,   71, 1865, 1870,   71,   71,   71,   71, 1874,
-     1873,   71, 1872,   71, 1866,   71, 1869, 1876,   71,   71,
-     1871, 1880,   71,   71, 1875,   71,   71,   71, 1878,   71,
-     1877, 1884, 1885,   71, 1879,   71, 1889,   71,   71, 1881,
-     1883,   71,   71,   71, 1887, 1886, 1882,   71, 1891,   71,
-     1888,   71, 1893,   71,   71, 1895, 1894,   71, 1890, 1897,
-       71, 1896, 1898,   71, 1901,   71,   71,   71, 1892,   71,
-
-     1902, 1903, 1904,   71,   71,   71, 1900,   71, 1906,   71,
-       71,   71,   71,   71, 1905, 1899, 1909, 1915, 1908, 1910,
-     1911, 1912, 1914, 1913,   71,   71,   71, 1918,   71, 1907,
-     1919,   71, 1920,   71, 1917,   71,   71,   71,   71,   71,
-     1921, 1926,   71,   71, 1916,   71,   71,   71, 1928,   71,
-       71, 1924, 1927, 1922, 1925, 1923,   71, 1929, 1979, 1930,
-       71, 1931, 1932, 1933,   71, 1937,   71, 1935, 1936, 1934,
-     1938,   71,   71,   71, 1941, 1939, 1942,   71, 1940,   71,
-       71,   71,   71, 1943,   71,   71, 1945,   71,   71, 1949,
-       71, 1944,   71, 1946, 1950, 1951, 1952,   71, 1948,   71,
-
-       71, 1947,   71,   71, 1953,   71, 1955,   71,   71,   71,
-       71, 1962, 1959,   71,   71, 1961, 2562,   71,   71, 1963,
-     1954, 1958,   71, 1956, 1967, 1957,   71, 1966,   71, 1960,
-       71,   71, 1964, 1969, 1965,   71, 1968,   71, 1971,   71,
-     1970,   71, 1972,   71, 1974, 1975, 1976,   71, 1978,   71,
-     1980,   71,   71,   71,   71,   71,   71,   71, 2562, 1977,
-     1982, 1973, 1983, 1984,   71, 1985,   71, 1986,   71, 1987,
-     1988, 1981,   71,   71,   71,   71,   71, 1990, 1989, 1993,
-       71,   71, 1995,   71,   71, 1994,   71, 1992,   71, 1998,
-       71,   71, 2001, 1991, 2002,   71,   71,   71, 1997, 1996,
-
-       71, 2003, 2004, 1999, 2000,   71,   71,   71, 2008,   71,
-       71, 2005, 2007, 2009,   71, 2010,   71, 2011,   71, 2006,
-       71, 2014, 2012,   71, 2013,   71, 2015, 2017,   71, 2018,
-       71, 2019,   71,   71,   71, 2016,   71,   71,   71,   71,
-       71, 2021,   71, 2024,   71, 2020, 2026,   71, 2022, 2027,
-       71,   71,   71,   71, 2033,   71,   71, 2023,   71, 2025,
-       71,   71,   71, 2030, 2029, 2034, 2032,   71, 2028,   71,
-     2035,   71, 2040, 2036,   71, 2031, 2042,   71, 2037, 2043,
-       71, 2041,   71, 2038,   71, 2039, 2044,   71, 2045,   71,
-       71, 2046,   71, 2047,   71, 2048,   71,   71,   71, 2050,
-
-       71,   71, 2051,   71, 2058, 2049, 2053, 2055, 2059,   71,
-     2061,   71,   71,   71, 2052,   71,   71, 2054,   71, 2057,
-     2056, 2060,   71, 2064,   71,   71,   71, 2070,   71, 2071,
-       71, 2062, 2072, 2063,   71,   71, 2066, 2065,   71,   71,
-       71, 2068, 2067,   71,   71, 2069,   71,   71, 2076, 2080,
-     2074, 2079, 2073, 2081,   71,   71,   71, 2082, 2075,   71,
-     2077, 2083,   71,   71, 2078,   71,   71,   71, 2085,   71,
-     2089, 2090,   71,   71,   71, 2084, 2093,   71, 2094,   71,
-       71,   71,   71, 2086, 2087, 2096, 2088, 2092, 2091, 2097,
-       71,   71,   71, 2098, 2095, 2101,   71, 2102,   71,   71,
-
-     2104,   71, 2099,   71, 2106,   71,   71, 2107, 2105,   71,
-       71, 2100,   71,   71, 2108,   71,   71,   71, 2103,   71,
-     2112, 2111, 2109, 2110, 2114, 2115,   71, 2113,   71,   71,
-       71,   71,   71,   71, 2117, 2116, 2119, 2120, 2122,   71,
-     2123,   71,   71, 2118, 2121,   71, 2128,   71, 2126, 2124,
-     2125, 2127,   71,   71,   71, 2130,   71,   71, 2129, 2133,
-       71, 2132, 2131, 2134,   71,   71, 2137, 2562, 2136,   71,
-     2135, 2138,   71,   71, 2139, 2141,   71,   71, 2140,   71,
-     2142,   71, 2143,   71,   71,   71,   71,   71, 2144, 2149,
-     2147,   71, 2146,   71,   71,   71, 2150,   71, 2145, 2148,
-
-     2151,   71,   71, 2156,   71,   71, 2154, 2153,   71,   71,
-     2155, 2152,   71, 2157, 2161,   71,   71,   71, 2163, 2165,
-       71,   71,   71,   71, 2158,   71,   71, 2170, 2159, 2169,
-       71, 2160, 2164,   71, 2172, 2162,   71, 2167, 2171,   71,
-     2166, 2173,   71, 2168,   71,   71,   71,   71,   71, 2176,
-     2183, 2174,   71, 2179, 2180,   71,   71, 2175, 2181,   71,
-     2177, 2209, 2178, 2182,   71,   71, 2185,   71, 2184, 2186,
-       71, 2187,   71,   71, 2189,   71, 2188,   71, 2190, 2191,
-       71,   71, 2192, 2193,   71, 2196,   71, 2197,   71,   71,
-     2199,   71,   71, 2198,   71, 2200,   71,   71,   71, 2194,
-
-     2195, 2205,   71,   71, 2204,   71, 2211,   71,   71, 2207,
-     2208,   71,   71,   71, 2202, 2201, 2210, 2203,   71,   71,
-       71, 2213,   71, 2562, 2216,   71,   71, 2206, 2220,   71,
-     2214, 2215,   71,   71,   71, 2224,   71, 2212, 2217, 2219,
-     2222,   71, 2218,   71, 2225, 2221,   71, 2226,   71, 2227,
-       71,   71, 2223,   71,   71, 2229, 2230, 2228,   71, 2235,
-       71,   71, 2232,   71, 2236, 2238,   71,   71,   71, 2240,
-       71,   71, 2241,   71, 2233, 2239,   71, 2231, 2234,   71,
-     2242, 2237, 2244,   71,   71, 2246,   71, 2248, 2245,   71,
-       71, 2243, 2249,   71, 2247, 2252,   71,   71, 2251, 2250,
-
-       71,   71, 2254,   71,   71,   71, 2253,   71, 2259, 2258,
-       71, 2264,   71, 2256, 2260, 2261,   71, 2262, 2265,   71,
-     2263, 2266,   71,   71, 2257, 2255,   71, 2271,   71,   71,
-       71,   71, 2267,   71, 2270, 2272, 2273, 2274,   71,   71,
-       71,   71,   71,   71, 2279,   71, 2268, 2269, 2277,   71,
-       71, 2281,   71,   71, 2284,   71,   71, 2275,   71, 2278,
-       71, 2276, 2285,   71, 2282,   71,   71, 2280, 2283, 2286,
-     2287,   71, 2288, 2291, 2289,   71, 2292, 2294,   71, 2290,
-       71, 2296,   71, 2297,   71,   71, 2299,   71,   71,   71,
-     2302,   71,   71,   71, 2301,   71,   71, 2306,   71, 2295,
-
-       71, 2293,   71,   71, 2300,   71, 2298, 2309,   71, 2310,
-       71, 2311, 2303,   71, 2305,   71, 2304, 2307,   71, 2313,
-     2308, 2316,   71,   71,   71, 2312, 2317, 2314,   71, 2318,
-     2319, 2321, 2324, 2315, 2322,   71,   71,   71,   71, 2323,
-       71,   71,   71,   71, 2320, 2329, 2326, 2327,   71, 2332,
-       71,   71, 2333,   71,   71, 2335,   71,   71, 2325, 2336,
-       71,   71, 2328,   71,   71, 2330, 2331,   71, 2337, 2339,
-       71, 2338, 2343, 2334, 2340,   71, 2341,   71, 2342,   71,
-     2344,   71,   71, 2346,   71, 2347, 2348,   71,   71, 2345,
-       71, 2352,   71,   71, 2355,   71, 2349,   71, 2353, 2351,
-
-       71, 2357,   71,   71,   71, 2356,   71,   71, 2350, 2354,
-       71, 2358, 2361,   71,   71,   71,   71,   71,   71, 2363,
-       71,   71, 2362, 2359, 2360, 2364,   71,   71,   71, 2375,
-       71, 2562, 2373, 2365, 2369, 2366, 2367,   71, 2368, 2376,
-       71, 2377, 2372, 2370, 2371, 2378,   71,   71, 2374, 2379,
-       71, 2380, 2381,   71,   71, 2383,   71, 2382,   71, 2386,
-       71,   71,   71,   71,   71, 2384, 2388,   71, 2387,   71,
-     2392,   71, 2385, 2393,   71,   71, 2391,   71, 2389, 2394,
-       71,   71, 2390,   71, 2397, 2399, 2395, 2398, 2396, 2401,
-     2400,   71,   71,   71,   71,   71, 2403,   71, 2405, 2406,
-
-     2408,   71, 2402, 2409,   71, 2410,   71, 2411,   71, 2412,
-       71,   71,   71, 2404, 2414,   71, 2407, 2415,   71,   71,
-     2413,   71, 2418,   71, 2420,   71,   71, 2416,   71,   71,
-       71, 2417, 2422,   71, 2424, 2427,   71,   71, 2419, 2426,
-       71,   71,   71,   71, 2421, 2429,   71,   71, 2425,   71,
-     2433, 2428,   71,   71, 2423,   71, 2435,   71,   71, 2432,
-       71, 2430,   71, 2440, 2431,   71,   71, 2441,   71, 2437,
-       71, 2439, 2434, 2436,   71, 2443,   71, 2442,   71, 2444,
-     2438,   71,   71,   71, 2452,   71,   71, 2445, 2446, 2454,
-       71,   71, 2447,   71, 2455, 2453, 2449, 2451, 2456,   71,
-
-     2457,   71, 2450, 2448,   71,   71,   71,   71, 2460,   71,
-     2458, 2461, 2462,   71, 2465,   71, 2467,   71,   71,   71,
-       71,   71,   71,   71, 2459, 2471,   71, 2473, 2464, 2466,
-       71, 2472, 2475, 2476, 2463,   71, 2469, 2468,   71,   71,
-     2470,   71, 2474,   71,   71,   71,   71,   71,   71, 2477,
-     2482,   71,   71, 2484, 2478,   71,   71,   71,   71, 2481,
-       71,   71, 2479, 2489, 2480, 2486, 2490, 2483, 2487,   71,
-     2485, 2493,   71, 2495, 2494, 2488, 2492,   71, 2491,   71,
-       71, 2496, 2497,   71,   71,   71, 2501,   71, 2498, 2499,
-       71, 2504,   71, 2503,   71, 2502,   71,   71,   71,   71,
-
-     2509,   71,   71, 2512, 2500, 2506,   71,   71,   71, 2513,
-       71,   71, 2516,   71,   71, 2505, 2507,   71, 2508,   71,
-     2510, 2511, 2514,   71, 2520, 2515,   71,   71,   71, 2524,
-     2517, 2521, 2519, 2518,   71,   71, 2526,   71, 2527,   71,
-     2522,   71,   71, 2523, 2528, 2531,   71,   71, 2529,   71,
-       71, 2533, 2532, 2525, 2534,   71,   71, 2535,   71,   71,
-       71, 2530,   71, 2536, 2538, 2540,   71,   71,   71,   71,
-       71,   71, 2542, 2543,   71, 2546,   71, 2537, 2562, 2539,
-     2562, 2541, 2547,   71,   71, 2550, 2551,   71, 2544, 2545,
-     2548,   71, 2553,   71,   71, 2549, 2554,   71, 2552,   71,
-
-       71, 2555,   71,   71, 2556, 2557, 2560,   71, 2561,   71,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2558, 2559,   43,   43,   43,   43,   43,   43,   43,
-       48,   48,   48,   48,   48,   48,   48,   53,   53,   53,
-       53,   53,   53,   53,   59,   59,   59,   59,   59,   59,
-       59,   64,   64,   64,   64,   64,   64,   64,   74,   74,
-     2562,   74,   74,   74,   74,  139,  139, 2562, 2562, 2562,
-      139,  139,  141,  141, 2562, 2562,  141, 2562,  141,  143,
-     2562, 2562, 2562, 2562, 2562,  143,  146,  146, 2562, 2562,
-     2562,  146,  146,  148, 2562, 2562, 2562, 2562, 2562,  148,
-
-      150,  150, 2562,  150,  150,  150,  150,   75,   75, 2562,
-       75,   75,   75,   75,   13, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562
+      13,   14,   15,   16,   17,   18,   19,   18,   14,   14,
+      14,   14,   14,   18,   20,   21,   22,   23,   24,   25,
+      26,   14,   27,   28,   29,   30,   31,   32,   33,   34,
+      35,   36,   37,   38,   39,   40,   41,   14,   14,   14,
+      42,    0,   43,   43,   44,   45,   46,   43,   43,   43,
+      43,   43,   43,   43,   43,   47,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   44,   45,   46,   43,   43,   43,
+      43,   43,   43,   43,   43,   47,   43,   43,   43,   43,
+
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   48,   48,   49,   50,   48,   48,   51,   48,
+      48,   48,   48,   48,   48,   52,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   49,   50,   48,   48,   51,   48,
+      48,   48,   48,   48,   48,   52,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+      48,   48,   53,   54,   55,   56,   57,   53,   82,   53,
+      53,   53,   53,   53,   53,   58,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   54,   55,   56,   57,   53,  103,   53,
+      53,   53,   53,   53,   53,   58,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   59,   59,   60,   61,   62,   59,   59,   59,
+      59,   59,   59,   59,   59,   63,   59,   59,   59,   59,
+
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   60,   61,   62,   59,   59,   59,
+      59,   59,   59,   59,   59,   63,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   64,  104,  105,  113,   65,   66,   67,   64,
+      64,   64,   64,   64,   64,   68,   64,   64,   64,   64,
+      64,   64,   64,   64,   69,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+
+      64,   64,   64,  119,  162,  141,   65,   66,   67,   64,
+      64,   64,   64,   64,   64,   68,   64,   64,   64,   64,
+      64,   64,   64,   64,   69,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      64,   64,   13,   70,   13,  163,  150,  164,   70,  165,
+      70,   70,   70,   70,   70,  166,   71,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   13,  169,   72,  170,   74,   75,   73,
+      75,   75,   74,   75,   74,   74,   74,   74,   74,   75,
+
+      76,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   77,   77,  171,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   78,   79,   83,
+      92,   80,  174,  175,   94,  110,   84,   87,  176,  111,
+      85,   88,  177,   86,   89,   81,   90,   91,   95,   96,
+      93,   99,  106,   97,  100,  112,  180,   98,  114,  167,
+
+     107,  101,  115,  102,  181,  120,  108,  184,  116,  121,
+     109,  117,  168,  124,  187,  129,  125,  130,  118,  122,
+     185,  133,  123,  126,  182,  183,  131,  127,  128,  186,
+     138,  134,  132,  135,  139,  136,  137,  172,  140,  142,
+     142,  188,  196,  173,  142,  142,  142,  142,  142,  142,
+     142,  142,  143,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  144,
+     144,  189,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  145,
+     145,  199,  203,  145,  145,  200,  145,  145,  145,  145,
+     145,  145,  146,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  147,
+     147,  204,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  148,
+
+     201,  205,  206,  207,  148,  202,  148,  148,  148,  148,
+     148,  148,  149,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  151,
+     151,  208,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  152,
+     152,  209,  210,  211,  152,  152,  152,  152,  152,  152,
+     152,  152,  153,  152,  152,  152,  152,  152,  152,  152,
+
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  154,
+     154,  212,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  155,
+     215,  213,  216,  217,  155,  214,  155,  155,  155,  155,
+     155,  155,  156,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  157,
+
+      75,  221,   75,   75,  157,   75,  157,  157,  157,  157,
+     157,  157,  158,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  159,
+     159,  222,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  155,
+     226,  227,  228,  231,  155,  232,  155,  155,  155,  155,
+     155,  155,  156,  155,  155,  155,  155,  155,  155,  155,
+
+     155,  155,  155,  155,  155,  155,  160,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,   77,
+      77,  233,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   77,
+      77,   77,   77,   77,   77,   77,   77,   77,   77,   75,
+      75,  234,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   74,
+
+      75,  235,   75,   75,   74,   75,   74,   74,   74,   74,
+      74,   75,   76,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   75,
+      75,  238,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,  161,
+     161,  239,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  178,
+     190,  194,  241,  191,  197,  218,  242,  240,  243,  229,
+     244,  247,  223,  236,  219,  257,  192,  193,  179,  255,
+     220,  251,  250,  224,  198,  253,  195,  225,  252,  230,
+     142,  142,  254,  256,  237,  142,  142,  142,  142,  142,
+     142,  142,  142,  143,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     144,  144,  258,  144,  144,  144,  144,  144,  144,  144,
+
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     142,  142,  259,  262,  263,  142,  142,  142,  142,  142,
+     142,  142,  142,  143,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     145,  145,  264,  273,  145,  145,  274,  145,  145,  145,
+     145,  145,  145,  146,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     147,  147,  275,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     145,  145,  276,  277,  145,  145,  280,  145,  145,  145,
+     145,  145,  145,  146,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     148,  281,  282,  283,  287,  148,  284,  148,  148,  148,
+
+     148,  148,  148,  149,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     151,  151,  288,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     148,  285,  289,  294,  286,  148,  295,  148,  148,  148,
+     148,  148,  148,  149,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     152,  152,  296,  297,  298,  152,  152,  152,  152,  152,
+     152,  152,  152,  153,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     154,  154,  301,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     152,  152,  302,  303,  304,  152,  152,  152,  152,  152,
+
+     152,  152,  152,  153,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     155,  305,  306,  307,  308,  155,  309,  155,  155,  155,
+     155,  155,  155,  156,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     159,  159,  310,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     157,   75,  311,   75,   75,  157,   75,  157,  157,  157,
+     157,  157,  157,  158,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     245,  245,  312,  245,  245,  245,  245,  245,  245,  245,
+     245,  245,  245,  245,  245,  245,  245,  245,  245,  245,
+     245,  245,  245,  245,  245,  245,  245,  245,  245,  245,
+     245,  245,  245,  245,  245,  245,  245,  245,  245,  245,
+     155,  313,  314,  316,  315,  155,  317,  155,  155,  155,
+
+     155,  155,  155,  156,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  318,  319,  321,  320,  155,  322,  155,  155,  155,
+     155,  155,  155,  156,  155,  155,  246,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+      74,   75,  323,   75,   75,   74,   75,   74,   74,   74,
+      74,   74,   75,   76,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+     248,  260,  265,  278,  268,  299,  290,  266,  261,  269,
+     325,  291,  324,  326,  270,  249,  329,  300,  330,  331,
+     271,  272,  332,  292,  267,  293,  333,  334,  327,  328,
+     336,  335,  279,  337,  339,  338,  340,  341,  343,  346,
+     344,  353,  349,  350,  347,  351,  352,  354,  357,  360,
+     355,  356,  363,  366,  364,  358,  359,  345,  362,  157,
+      75,  342,   75,   75,  157,   75,  157,  157,  157,  157,
+     157,  157,  158,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  155,
+     361,  365,  367,  368,  155,  369,  155,  155,  155,  155,
+     155,  155,  156,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  348,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  370,
+     371,  372,  373,  375,  374,  376,  377,  378,  379,  380,
+     382,  385,  383,  384,  387,  386,  389,  390,  388,  392,
+     394,  391,  395,  393,  398,  397,  381,  399,  396,  400,
+     409,  415,  401,  402,  407,  408,  411,  403,  413,  414,
+     412,  404,  405,  416,  406,  422,  417,  420,  410,  418,
+
+     419,  421,  423,  424,  425,  426,  427,  429,  430,  431,
+     428,  433,  434,  435,  436,  432,  438,  440,  439,  441,
+     437,  445,  446,  448,  447,  450,  455,  454,  459,  456,
+     475,  449,  442,  470,  457,  443,  473,  444,  451,  458,
+     461,  452,  469,  453,  460,  462,  463,  471,  476,  477,
+     478,  481,  472,  487,  488,  464,  155,  465,  466,  467,
+     479,  155,  468,  155,  155,  155,  155,  155,  155,  156,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     474,  155,  155,  155,  155,  155,  480,  482,  484,  485,
+
+     486,  489,  490,  491,  492,  493,  494,  483,  500,  495,
+     496,  497,  498,  499,  501,  502,  503,  505,  504,  508,
+     509,  506,  511,  510,  512,  513,  518,  519,  514,  517,
+     521,  520,  522,  523,  524,  527,  507,  525,  528,  515,
+     529,  516,  530,  531,  526,  532,  536,  533,  534,  535,
+     538,  540,  541,  537,  542,  539,  545,  543,  546,  549,
+     555,  544,  548,  556,  558,  559,  547,  550,  551,  554,
+     557,  561,  562,  560,  564,  565,  552,  568,  553,  567,
+     571,  659,  563,  573,  572,  574,  569,  570,  587,  575,
+     577,  589,  588,  576,  585,  578,  591,  579,  594,  566,
+
+     586,  590,  584,  593,  596,  580,  597,  592,  581,  582,
+     595,  599,  600,  598,  604,  583,  601,  603,  602,  605,
+     606,  609,  608,  155,  612,  607,  610,  614,  155,  618,
+     155,  155,  155,  155,  155,  155,  156,  155,  155,  155,
+     611,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  613,  615,  616,  617,  619,  620,  621,
+     622,  623,  624,  625,  626,  627,  630,  634,  628,  629,
+     631,  633,  635,  632,  637,  638,  639,  640,  636,  641,
+     642,  643,  644,  651,  647,  645,  657,  646,  650,  649,
+
+     654,  648,  653,  652,  656,  655,  658,  660,  664,  670,
+     666,  663,  661,  667,  672,  665,  662,  668,  671,  675,
+     673,  669,  676,  681,  677,  679,  678,  680,  685,  682,
+     687,  686,  688,  683,  692,  684,  689,  693,  694,  690,
+     691,  695,  674,  697,  696,  703,  699,  704,  698,  700,
+     705,  706,  708,  713,  701,  702,  711,  709,  710,  715,
+     718,  712,  714,  717,  723,  716,  707,  722,  719,  730,
+     737,  725,  720,  724,  721,    0,  770,  726,  728,    0,
+     729,  738,  727,  741,  742,  753,  731,  732,  733,  734,
+     735,  740,  736,  739,  746,  743,  747,  745,  749,  748,
+
+     744,  750,  752,  751,  754,  758,  755,  155,  759,  761,
+     756,  764,  155,  760,  155,  155,  155,  155,  155,  155,
+     156,  155,  155,  155,  155,  757,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  762,  763,  765,
+     767,  768,  771,  769,  772,  773,  774,  766,  775,  777,
+     776,  778,  780,  781,  779,  788,  782,  789,  786,  783,
+     790,  787,  791,  792,  793,  795,  784,  796,  804,  785,
+     805,  794,  797,  798,  808,  799,  806,  809,  800,  810,
+     812,  807,  811,  801,  813,  814,  815,  817,  816,  802,
+
+     803,  818,  821,  825,  834,  819,  820,  828,  822,  824,
+     831,  832,  826,  833,  827,  823,  830,  835,  836,  837,
+     844,  829,  838,  841,  839,  840,  842,  847,  843,  845,
+     846,  851,  853,  849,  850,  854,  848,  852,  856,  861,
+     863,  855,  864,  859,    0,  866,  857,  862,    0,    0,
+       0,  858,  881,  873,    0,    0,  880,  872, 1060,  860,
+     865,  875,  867,  876,  868,  869,  888,  871,  870,  874,
+     877,  878,  890,  879,  891,  882,  883,  884,  887,  892,
+     894,  886,  885,  889,  893,  896,  898,  899,  895,  900,
+     897,  901,  902,  903,  904,  905,  907,  155,  909,  906,
+
+     913,  910,  155,  911,  155,  155,  155,  155,  155,  908,
+     156,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  912,  914,  916,
+     915,  917,  919,  918,  920,  925,  926,  927,  921,  928,
+     922,  929,  930,  931,  932,  923,  933,  935,  936,  937,
+     924,  934,  940,  943,  948,  939,  941,  944,  946,  947,
+     949,  938,  945,  950,  951,  952,  942,  953,  954,  960,
+     961,  963,  962,  955,  964,  956,  965,  966,  968,  971,
+     972,  973,  967,  977,  974,  969,  957,  958,  978,  983,
+
+     976,  970,  996,  959,  975,  980,  993,  979,  982,  981,
+     984,  986,  988,  985, 1002,  987,  990,  991,  992,  998,
+     999,  994,  989, 1000, 1003, 1001,  997, 1006, 1008,  995,
+    1004, 1009, 1007, 1016, 1010, 1005, 1011, 1014, 1015, 1013,
+    1012, 1018, 1020, 1029, 1022, 1017, 1021, 1019, 1023, 1024,
+    1027, 1026, 1025, 1028, 1030, 1031, 1033, 1038, 1039, 1040,
+    1032, 1041, 1043, 1047, 1044, 1037, 1034, 1045, 1051, 1035,
+    1052, 1036, 1048, 1053, 1055, 1042, 1056, 1046, 1050,    0,
+    1049, 1066, 1054, 1073, 1059, 1058, 1071, 1062, 1074, 1057,
+    1070, 1061, 1076, 1075, 1063, 1102, 1069, 1067, 1077,  155,
+
+    1065, 1068, 1080, 1083,  155, 1064,  155,  155,  155,  155,
+     155,  155,  156,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155, 1072,
+    1078, 1079, 1082, 1081, 1084, 1086, 1087, 1089, 1091, 1085,
+    1095, 1088, 1096, 1097, 1090, 1098, 1101, 1092, 1099, 1093,
+    1100, 1104, 1094, 1103, 1105, 1107, 1109, 1110, 1112, 1106,
+    1113, 1265, 1108, 1114, 1111, 1123, 1115, 1116, 1119, 1124,
+    1117, 1130, 1120, 1150, 1118, 1141, 1122, 1129, 1132, 1125,
+    1134, 1121, 1163, 1131, 1135, 1126, 1127, 1128, 1136, 1149,
+
+    1139, 1133, 1138, 1137, 1140, 1142, 1148, 1151, 1143, 1144,
+    1152, 1153, 1154, 1145, 1155, 1156, 1157, 1158, 1160, 1146,
+    1159, 1162, 1161, 1147, 1164, 1165, 1166, 1167, 1172, 1173,
+    1174, 1176, 1168, 1175, 1169, 1177, 1170, 1178, 1171, 1179,
+    1182, 1188, 1184, 1181, 1180, 1185, 1183, 1186, 1187, 1190,
+    1192, 1189, 1193, 1194, 1196, 1197, 1191, 1195, 1201, 1198,
+    1200, 1203, 1199, 1202, 1207, 1204, 1209, 1205, 1210, 1206,
+    1208, 1211, 1212, 1216, 1222, 1214, 1215, 1213, 1223, 1219,
+    1224, 1217, 1218, 1220, 1225, 1229, 1226, 1221, 1233, 1234,
+    1228, 1235,    0, 1242,    0,    0,    0, 1227,    0, 1236,
+
+    1239, 1230, 1231, 1240, 1246, 1237, 1232, 1238, 1247, 1241,
+    1249, 1253, 1251, 1243, 1254, 1261, 1245, 1252, 1255, 1262,
+    1250, 1244, 1256, 1248, 1259, 1257, 1263, 1260, 1258, 1264,
+    1266, 1267, 1271, 1276, 1268, 1270, 1273, 1269, 1274, 1272,
+    1275, 1277, 1279, 1278, 1282, 1280, 1283, 1281, 1285, 1284,
+    1286, 1287, 1288, 1290, 1289, 1291, 1292, 1293, 1294, 1295,
+    1297, 1296, 1298, 1299, 1300, 1302, 1301, 1303, 1304, 1306,
+    1308, 1305, 1307, 1309, 1312, 1314, 1311, 1316, 1310, 1318,
+    1315, 1319, 1317, 1313, 1323, 1326, 1327, 1339,    0, 1335,
+       0, 1320, 1321, 1322, 1336, 1325, 1328, 1329, 1338, 1330,
+
+    1332, 1324, 1340, 1331, 1334, 1337, 1333, 1341, 1343, 1342,
+    1344, 1347, 1348, 1351, 1345, 1352, 1349, 1350, 1358, 1353,
+    1354, 1356, 1355, 1360, 1357, 1359, 1362, 1346, 1361, 1363,
+    1364, 1365, 1366, 1367, 1368, 1372, 1370, 1369, 1373, 1376,
+    1371, 1379, 1374, 1377, 1378, 1375, 1380, 1381, 1382, 1387,
+    1384, 1390, 1389,    0, 1386, 1396, 1405,    0, 1407,    0,
+       0, 1383, 1397,    0, 1385, 1388, 1401, 1392, 1391, 1395,
+    1393, 1394, 1400, 1403, 1404, 1409, 1398, 1428, 1399, 1402,
+    1406, 1408, 1413, 1411, 1410, 1414, 1415, 1419, 1416, 1417,
+    1412, 1418, 1420, 1421, 1424, 1423, 1433, 1425, 1422, 1427,
+
+    1429, 1430, 1431, 1432, 1434, 1435, 1436, 1437, 1439, 1426,
+    1442, 1438, 1443, 1440, 1444, 1445, 1441, 1447, 1448, 1449,
+    1458, 1450, 1462, 1446, 1457, 1452, 1451, 1454, 1453, 1455,
+    1463, 1466, 1456, 1465,    0,    0,    0, 1459, 1461, 1485,
+    1467, 1468, 1460, 1464, 1471, 1473, 1474, 1481, 1472, 1475,
+    1470, 1482, 1476, 1469, 1477, 1487, 1483, 1492, 1486, 1478,
+    1491, 1480, 1484, 1488, 1489, 1479, 1493, 1490, 1496, 1494,
+    1495, 1502, 1497, 1499, 1501, 1498, 1503, 1504, 1505, 1500,
+    1506, 1508, 1510, 1511, 1509, 1513, 1515, 1512, 1517, 1516,
+    1514, 1518, 1519, 1520, 1507, 1522, 1521, 1523, 1524, 1525,
+
+    1528, 1526, 1530, 1529, 1533, 1538, 1531, 1527, 1540, 1532,
+    1575, 1542, 1544, 1534, 1535, 1537,    0, 1551, 1545, 1539,
+    1536, 1546, 1547, 1548, 1541, 1561,    0, 1543, 1565,    0,
+    1550, 1556, 1549, 1553, 1572, 1557, 1555, 1558, 1552, 1554,
+    1562, 1564, 1566, 1567, 1570, 1559, 1568, 1560, 1563, 1569,
+    1571, 1573, 1576, 1574, 1577, 1578, 1580, 1583, 1581, 1584,
+    1579, 1589, 1585, 1587, 1582, 1590, 1588, 1594, 1595, 1596,
+    1603, 1597, 1599, 1602, 1604, 1586, 1591, 1592, 1600, 1593,
+    1598, 1605, 1601, 1606, 1608, 1611, 1607, 1612, 1609, 1610,
+    1614, 1621, 1613, 1615, 1616, 1617, 1619, 1620, 1623, 1622,
+
+    1618, 1625, 1626, 1624, 1627, 1629, 1631, 1628, 1630, 1633,
+    1634, 1640, 1641, 1635, 1638, 1632, 1639, 1637, 1636, 1643,
+    1644, 1645, 1642, 1648, 1646, 1650, 1651, 1652, 1653, 1655,
+    1654, 1656, 1647, 1649, 1658, 1657, 1659, 1662, 1660, 1667,
+    1666, 1663, 1665, 1661, 1664, 1669, 1670, 1673, 1668, 1676,
+    1672, 1675, 1678, 1674, 1679, 1677, 1682, 1687, 1684, 1680,
+    1688, 1683, 1671, 1689, 1681, 1690, 1692, 1693, 1695, 1685,
+    1691, 1686, 1694, 1696, 1698, 1699, 1700, 1701, 1697, 1702,
+    1703, 1704, 1705, 1707, 1708, 1710, 1706, 1713, 1709, 1711,
+    1712, 1714, 1715, 1717, 1721, 1724, 1718, 1716, 1734, 1719,
+
+    1729, 1720, 1722, 1723, 1728, 1732, 1727, 1730, 1725, 1731,
+    1726, 1738, 1741,    0, 1739,    0, 1735, 1740, 1733, 1750,
+    1743,    0, 1746, 1755, 1747, 1742, 1736,    0, 1737, 1749,
+    1758, 1744, 1745, 1748, 1757, 1759, 1760, 1762, 1751, 1752,
+    1753, 1754, 1761, 1756, 1763, 1764, 1772, 1765, 1767, 1776,
+    1771, 1768, 1766, 1780, 1769, 1779, 1782, 1775, 1770, 1773,
+    1783, 1785, 1786, 1774, 1777, 1789, 1791, 1778, 1788, 1781,
+    1787, 1784, 1794, 1793, 1790, 1799, 1795, 1796, 1800, 1797,
+    1792, 1805, 1798, 1802, 1803, 1806, 1808, 1801, 1809, 1811,
+    1804, 1810, 1807, 1812, 1814, 1815, 1826, 1816, 1817, 1818,
+
+    1820, 1813, 1819, 1822, 1824, 1825, 1827, 1830, 1823, 1821,
+    1842, 1834,    0, 1828, 1835, 1843, 1836, 1833, 1838, 1845,
+    1847, 1831, 1829, 1832, 1844, 1854, 1840, 1846, 1849, 1837,
+    1850, 1839, 1851, 1848, 1852, 1855, 1856, 1857, 1841, 1853,
+    1860, 1859, 1858, 1863, 1864, 1865, 1867, 1866, 1868, 1870,
+    1872, 1869, 1871, 1873, 1861, 1875, 1874, 1876, 1878, 1888,
+    1885, 1881, 1909, 1877, 1882, 1862, 1879, 1880, 1889, 1883,
+    1891, 1894, 1895,    0, 1890, 1886, 1884, 1887, 1906, 1953,
+    1912, 1913, 1893, 1907, 1983, 1911, 1896, 1897, 1892, 1902,
+    1900, 1905, 1898, 1901, 1899, 1903, 1908, 1904, 1910, 1916,
+
+    1915, 1914, 1917, 1920, 1918, 1919, 1921, 1922, 1923, 1924,
+    1926, 1925, 1927, 1928, 1929, 1930, 1931, 1932, 1933, 1934,
+    1937, 1936, 1935, 1939, 1941, 1938, 1940, 1943, 1942, 1945,
+    1949, 1954, 1951, 1946, 1958, 1947, 1961, 1963, 1962,    0,
+       0, 1948, 1944, 1950, 1952, 1960, 1955, 1964, 1956, 1957,
+    1987, 1965, 1966, 1967, 1969, 1971, 1959, 1972, 1973, 1974,
+    1975, 1991, 1977, 1970, 1990, 1968, 1978, 1979, 1976, 1980,
+    1981, 1988, 1984, 1982, 1985, 1989, 1992, 1998, 1996, 2006,
+    1997, 2000, 2009, 1986, 1993, 1994, 1999, 1995, 2001, 2002,
+    2005, 2004, 2003, 2008, 2010, 2011, 2012, 2013, 2014, 2015,
+
+    2007, 2016, 2017, 2025, 2021, 2019, 2018, 2069, 2020, 2026,
+    2029, 2022, 2023, 2024, 2027, 2028, 2039, 2031, 2030, 2032,
+    2033, 2034, 2036, 2035, 2038, 2041, 2040, 2045, 2044, 2047,
+    2049, 2050, 2046, 2053, 2037, 2042, 2052, 2043, 2054, 2048,
+    2055, 2057, 2056, 2059, 2058, 2062, 2061, 2064, 2063, 2065,
+    2066, 2075, 2051, 2067, 2060, 2068, 2070, 2071, 2073, 2076,
+    2077, 2072, 2074, 2078, 2081, 2082, 2083, 2084, 2088, 2085,
+    2089, 2090, 2087, 2079, 2086, 2091, 2080, 2118, 2094, 2095,
+    2092, 2097, 2098, 2099,    0, 2096, 2100, 2101, 2093, 2108,
+    2104, 2102, 2107, 2109,    0, 2103, 2161, 2116, 2110,    0,
+
+       0, 2105, 2127, 2128,    0, 2113, 2117, 2106, 2123, 2115,
+       0, 2112, 2125, 2119, 2126, 2129, 2111, 2114, 2120, 2130,
+    2124, 2121, 2132, 2147, 2122, 2140, 2131, 2149, 2138, 2133,
+    2146,    0, 2134, 2135, 2136, 2139, 2143, 2137,    0, 2148,
+    2141, 2152, 2142, 2144, 2145, 2159, 2160, 2171, 2153, 2150,
+    2151, 2158, 2170, 2154, 2155, 2156, 2157, 2163, 2162, 2165,
+    2164, 2168, 2172, 2166, 2167, 2169, 2173, 2175, 2174, 2179,
+    2180, 2176, 2177, 2183, 2181, 2178, 2184, 2185, 2187, 2182,
+    2186, 2188, 2191, 2189, 2190, 2192, 2194, 2195, 2193, 2196,
+    2197, 2199, 2198, 2200, 2201, 2203, 2202, 2204, 2239, 2208,
+
+    2209, 2205, 2207, 2206, 2212, 2213, 2215, 2216, 2217, 2218,
+    2221, 2222, 2211, 2214, 2223, 2225, 2226, 2224, 2227, 2232,
+    2210, 2219, 2228, 2220, 2229, 2230, 2235, 2233, 2234, 2236,
+    2231, 2237, 2238, 2242, 2240, 2241, 2309, 2244, 2245, 2247,
+    2248, 2339, 2246, 2243, 2249, 2254, 2256, 2252, 2260, 2253,
+    2251, 2255, 2250, 2264, 2265, 2262, 2270, 2271,    0,    0,
+    2269, 2276, 2257, 2299, 2273, 2258, 2259, 2261, 2263, 2266,
+    2267, 2272, 2268, 2274, 2275, 2278, 2279, 2280, 2281, 2277,
+    2282, 2285, 2286, 2287, 2289, 2288, 2283, 2284, 2290, 2291,
+    2293, 2292, 2294, 2295, 2296, 2297, 2300, 2308, 2301, 2302,
+
+    2304, 2307, 2298, 2310, 2303, 2311, 2312, 2314, 2313, 2305,
+    2316, 2317, 2306, 2320, 2323, 2324,    0, 2328,    0, 2318,
+    2319, 2341, 2383, 2315, 2322, 2332, 2325, 2321, 2330, 2327,
+    2333, 2326, 2334, 2335, 2349, 2329, 2340, 2344, 2331, 2336,
+    2337, 2347, 2338, 2345, 2348, 2342, 2343, 2350, 2346, 2351,
+    2352, 2354, 2353, 2355, 2357, 2356, 2358, 2362, 2371, 2361,
+    2360, 2359, 2363, 2364, 2367, 2368, 2366, 2365, 2369, 2373,
+    2372, 2374, 2376, 2377, 2375, 2378, 2379, 2382, 2386, 2380,
+    2370, 2393, 2384, 2385, 2381, 2399, 2387, 2390, 2391, 2388,
+    2402, 2394,    0, 2392, 2398,    0, 2401, 2405, 2412, 2389,
+
+    2395, 2403, 2410, 2396, 2406, 2404, 2407, 2397, 2400, 2409,
+    2414, 2415, 2416, 2408, 2418, 2420, 2421, 2413, 2419, 2425,
+    2426, 2417, 2411, 2422, 2424, 2428, 2429, 2423, 2430, 2427,
+    2434, 2437, 2438, 2435, 2431, 2432, 2439, 2440, 2442, 2443,
+    2433, 2444, 2436, 2441, 2445, 2449, 2446, 2447, 2448, 2451,
+    2450, 2452, 2455, 2456, 2453, 2454, 2457, 2458, 2459, 2460,
+    2461, 2462, 2463, 2477, 2467, 2468, 2464, 2465, 2469, 2466,
+    2471, 2474, 2470, 2472, 2475, 2479, 2482, 2473, 2480, 2484,
+    2485, 2478, 2476, 2486,    0, 2483,    0,    0, 2481, 2489,
+       0,    0, 2491,    0, 2536, 2492,    0, 2490,    0, 2487,
+
+    2503, 2506, 2527, 2488, 2510, 2511, 2513, 2493, 2514, 2494,
+    2495, 2496, 2498, 2499, 2502, 2500, 2501, 2507, 2497, 2504,
+    2505, 2508, 2512, 2517, 2509, 2515, 2516, 2520, 2518, 2519,
+    2521, 2522, 2524, 2525, 2523, 2526, 2528, 2529, 2530, 2531,
+    2534, 2532, 2540, 2541, 2533, 2535, 2537, 2538, 2542, 2543,
+    2539, 2549, 2544, 2546, 2547, 2550, 2545, 2551, 2552, 2553,
+    2554, 2548, 2555, 2556, 2557, 2558, 2559, 2560, 2562, 2563,
+    2561, 2564, 2566, 2565, 2570, 2568, 2571, 2579, 2573,    0,
+    2567, 2569,    0, 2577, 2572, 2580, 2574, 2583,    0, 2585,
+       0,    0, 2575, 2576, 2591, 2578, 2590, 2581, 2582, 2593,
+
+    2589, 2587, 2624, 2605, 2584, 2592, 2586, 2595, 2610, 2612,
+    2607, 2588, 2598, 2614, 2596, 2594, 2600, 2597, 2601, 2602,
+    2611, 2613, 2599, 2603, 2604, 2606, 2609, 2608, 2615, 2618,
+    2620, 2619, 2616, 2621, 2623, 2617, 2625, 2629, 2627, 2628,
+    2630, 2622, 2626, 2631, 2633, 2637, 2632, 2639, 2638, 2635,
+    2642, 2643, 2634, 2636, 2640, 2641, 2646, 2644, 2647, 2649,
+    2650, 2645, 2651, 2648, 2654, 2656, 2659, 2655, 2653, 2652,
+    2658, 2664, 2661, 2662, 2665, 2657, 2666, 2660, 2670, 2675,
+    2677, 2663, 2676, 2678, 2683, 2688, 2679, 2667, 2668, 2669,
+    2672, 2674, 2673, 2680, 2681, 2682, 2671, 2684, 2685, 2687,
+
+    2690, 2689, 2691, 2686, 2692, 2694, 2697, 2701, 2702, 2706,
+    2707, 2723, 2710, 2693, 2699, 2695, 2696, 2704, 2698, 2703,
+    2714, 2700,    0, 2715, 2708, 2705, 2724, 2709, 2711, 2712,
+    2713, 2720, 2721, 2717, 2718, 2716, 2722, 2726, 2727, 2728,
+    2729, 2719, 2731, 2725, 2732, 2733, 2736, 2730, 2734, 2735,
+    2737, 2738, 2739, 2740, 2741, 2742, 2746, 2743, 2744, 2749,
+    2752, 2745,    0, 2747, 2748, 2754,    0, 2755, 2758, 2751,
+    2763, 2759, 2765, 2769, 2750, 2764, 2753, 2756, 2757, 2768,
+    2772, 2762, 2760, 2761, 2770, 2773, 2774, 2775, 2777, 2778,
+    2766, 2767, 2779, 2780, 2771, 2776, 2781, 2793, 2782, 2783,
+
+    2785, 2784, 2786, 2787, 2789, 2788, 2790, 2795, 2798, 2799,
+    2801, 2800, 2791, 2792, 2802, 2803, 2804, 2805, 2806, 2794,
+    2809, 2796, 2797, 2810, 2807, 2808, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866,   13,   14,   15,
+      16,   17,   18,   19,   18,   14,   14,   14,   14,   14,
+      18,   20,   21,   22, 2811,   24,   25,   26,   14,   27,
+      28,   29,   30,   31,   32,   33,   34,   35,   36,   37,
+
+      38,   39,   40,   41,   14,   14,   14,   42,   13,   14,
+      15,   16,   17,   18,   19,   18,   14,   14,   14,   14,
+      14,   18,   20,   21,   22, 2811,   24,   25,   26,   14,
+      27,   28,   29,   30,   31,   32,   33,   34,   35,   36,
+      37,   38,   39,   40,   41,   14,   14,   14,   42,   13,
+      70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,
+      70,   70, 2866,   71, 2812,   70,   70,   70,   70,   70,
+      70,   84,   70,   70,   70,   85,   70,   70,   86,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,
+
+      70,   70,   70, 2866,   71,   70,   70, 2813,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+     168,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,
+      70,   70,   70,   70, 2866,   71,   70,   70,   70,   70,
+      70,   70,   70, 2814,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,
+      70,   70,   70,   70,   70, 2866,   71,   70,   70,   70,
+      70, 2815,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,   70,
+    2866, 2816,   70,   70,   70,   70, 2866,   71,   70,   70,
+      70,  483,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,
+      70, 2866,   70,   70,   70,   70,   70, 2866,   71,   70,
+      70,   70,   70,   70,   70,   70, 2817,   70,   70,   70,
+      70,  619,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   13,   70, 2866, 2866, 2866,
+
+    2866,   70, 2866,   70,   70,   70,   70,   70, 2866,   71,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+    2818,   70,   70,   70,   70,   70,   13,   70, 2866, 2866,
+    2866, 2866,   70, 2866,   70,   70,   70,   70,   70, 2866,
+      71,   70,   70,   70,   70,   70,   70, 2819,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   13,   70, 2866,
+    2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,   70,
+    2866,   71,   70,   70,   70,   70, 2820,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   13,   70,
+    2866, 2866, 2866, 2866,   70, 2866, 2821,   70,   70,   70,
+      70, 2866,   71,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   13,
+      70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,
+      70,   70, 2866,   71,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70, 2822,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,
+      70,   70,   70, 2866,   71, 2823,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,
+      70,   70,   70,   70, 2866,   71,   70,   70,   70,   70,
+      70,   70, 2824,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,
+      70,   70,   70,   70,   70, 2866,   71,   70,   70,   70,
+
+      70, 2825,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,   70,
+    2866,   70,   70,   70,   70,   70, 2866,   71,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70, 2826,   70,   70,   70,
+      70,   70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,
+      70, 2866,   70,   70,   70,   70,   70, 2827,   71,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   70, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866,   13,   14,   15,   16,
+      17,   18,   19,   18,   14,   14,   14,   14,   14,   18,
+      20,   21,   22, 2811,   24,   25,   26,   14,   27,   28,
+      29,   30,   31, 2828,   33,   34,   35,   36,   37,   38,
+      39,   40,   41,   14,   14,   14,   42,   13,   14,   15,
+      16,   17,   18,   19,   18,   14,   14,   14,   14,   14,
+
+      18,   20,   21,   22, 2811,   24,   25,   26,   14,   27,
+      28,   29,   30,   31, 2828,   33,   34,   35,   36,   37,
+      38,   39,   40,   41,   14,   14,   14,   42,   13,   70,
+    2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,
+      70, 2866,   71,  106,   70,   70,   70,   70,   70,   70,
+      70,  107,   70,   70,   70,   70,   70,  108,   70,   70,
+      70, 2829,   70,   70,   70,   70,   70,   70,   70,   13,
+      70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,
+      70,   70, 2866,   71,   70,   70,   70,   70,   70,   70,
+    2830,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      13,   70, 2866, 2866, 2866, 2866,   70, 2866, 2831,   70,
+      70,   70,   70, 2866,   71,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,
+      70,   70,   70,   70, 2866,   71,   70,  413, 2832,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,
+
+      70,   70,   70,   70,   70, 2866,   71, 2833,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,   70,
+    2866,   70,   70,   70,   70,   70, 2866,   71,   70,   70,
+    2834,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,
+      70, 2866,   70,   70,   70,   70,   70, 2866,   71,   70,
+      70,   70,   70,   70,   70,   70, 2835,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   13,   70, 2866, 2866, 2866,
+    2866,   70, 2866,   70,   70,   70,   70,   70, 2866,   71,
+      70,   70,   70,   70, 2836,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   13,   70, 2866, 2866,
+    2866, 2866,   70, 2866, 2837,   70,   70,   70,   70, 2866,
+      71,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   13,   70, 2866,
+
+    2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,   70,
+    2866,   71,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+    1328,   70,   70,   70, 2838,   70,   70,   70,   13,   70,
+    2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,
+      70, 2866,   71,   70,   70,   70,   70,   70,   70,   70,
+      70, 2839,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   13,
+      70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,
+      70,   70, 2866,   71,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70, 2840,   70,   70,   70,   70,   70,   70,   70,   70,
+      13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,
+      70,   70,   70, 2866,   71,   70,   70,   70,   70, 2841,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,
+      70,   70,   70,   70, 2866,   71,   70,   70,   70,   70,
+      70, 2842,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,
+      70,   70,   70,   70,   70, 2866,   71,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70, 2843,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,   70,
+    2866,   70,   70,   70,   70,   70, 2866,   71,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70, 2844,   70,   70,   70,   70,
+      70,   70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,
+      70, 2866,   70,   70,   70,   70,   70, 2866,   71,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70, 2845,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   13,   70, 2866, 2866, 2866,
+    2866,   70, 2866,   70,   70,   70,   70,   70, 2866,   71,
+    2846,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   13,   70, 2866, 2866,
+    2866, 2866,   70, 2866,   70,   70,   70,   70,   70, 2866,
+      71,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+    2847,   70,   70,   70,   70,   70,   70,   13,   70, 2866,
+    2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,   70,
+    2848,   71,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,   13,
+      14,   15,   16,   17,   18,   19,   18,   14,   14,   14,
+
+      14,   14,   18,   20,   21,   22, 2811, 2849,   25,   26,
+      14,   27,   28,   29,   30,   31, 2828,   33,   34,   35,
+      36,   37,   38,   39,   40,   41,   14,   14,   14,   42,
+      13,   14,   15,   16,   17,   18,   19,   18,   14,   14,
+      14,   14,   14,   18,   20,   21,   22, 2811, 2849,   25,
+      26,   14,   27,   28,   29,   30,   31, 2828,   33,   34,
+      35,   36,   37,   38,   39,   40,   41,   14,   14,   14,
+      42,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,
+      70,   70,   70,   70, 2866,   71,   70,   70,   70,   70,
+      87,   70,   70,   70,   88,   70,   70,   89,   70, 2850,
+
+      91,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,
+      70,   70,   70,   70,   70, 2866,   71,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70, 2851,   70,   70,   70,   70,
+      70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,   70,
+    2866,   70,   70,   70,   70,  265, 2866,   71,   70,   70,
+     266,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70, 2852,   70,   70,
+      70,   70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,
+
+      70, 2866,   70,   70,   70,   70,   70, 2866,   71, 2853,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   13,   70, 2866, 2866, 2866,
+    2866,   70, 2866,   70,   70,   70,   70,   70, 2866,   71,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70, 2854,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   13,   70, 2866, 2866,
+    2866, 2866,   70, 2866, 2855,   70,   70,   70,   70,  635,
+      71,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   13,   70, 2866,
+    2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,   70,
+    2866,   71,   70,   70,   70,   70,  780,  781,   70,   70,
+     782,   70,   70,  783,   70,   70,   70,   70,   70, 2856,
+     784,   70,   70,  785,   70,   70,   70,   70,   13,   70,
+    2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,   70,
+      70, 2866,   71,   70,   70,   70,   70,   70,   70,   70,
+      70, 2857,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   13,
+
+      70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,   70,
+      70,   70, 2866,   71,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70, 2858,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      13,   70, 2866, 2866, 2866, 2866,   70, 2866,   70,   70,
+      70,   70,   70, 2866,   71,   70,   70,   70,   70,   70,
+      70, 2859,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866, 2860,
+      70,   70,   70,   70, 2866,   71,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   13,   70, 2866, 2866, 2866, 2866,   70, 2866,
+      70,   70,   70,   70,   70, 2866,   71,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70, 2861,   70,   70,   70,   70,
+      70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,   70,
+    2866,   70,   70,   70,   70,   70, 2866,   71,   70,   70,
+      70,   70,   70,   70,   70,   70, 2862,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+
+      70,   70,   70,   70,   13,   70, 2866, 2866, 2866, 2866,
+      70, 2866,   70,   70,   70,   70,   70, 2866,   71,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70, 2863,   13,   70, 2866, 2866, 2866,
+    2866,   70, 2866,   70,   70,   70,   70,   70, 2866,   71,
+      70,   70,   70,   70, 2864,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   13,   70, 2866, 2866,
+    2866, 2866,   70, 2866,   70,   70,   70,   70,   70, 2865,
+
+      71,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70,   70,   70,   70,
+      70,   70,   70,   70,   70,   70,   70, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866
     } ;
 
-static yyconst flex_int16_t yy_chk[5056] =
+static yyconst flex_int16_t yy_chk[7469] =
     {   0,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
-        3,    3,    3,    4,    4,    4,    5,    5,    6,    6,
-        5,    3,    6,   20,    4,   20,   20,    5,   20,    6,
-        7,    7,    7,    7,   20,    7,    8,    8,    8,    8,
-       29,    8,    7,    9,    9,    9,   22,   22,    8,   10,
-       10,   10,   15,   25,    9,   29,   15,   25, 2568,   31,
-       10,   11,   11,   11,   11,   11,   11,   19,   79,   19,
-
-       19,   30,   19,   11,   31,   79,   30,   25,   19,   19,
-       47,   47,   11,   12,   12,   12,   12,   12,   12,   21,
-       23,   23,   21,   21,   24,   12,   21,   88,   23,   24,
-       26,   26,   23,   24,   12,   23,   24,  881,   24,   24,
-       21,   27,   27,   34,   28,   26,   32,   32,   28,   88,
-       27,   28,   33,   33,   35,   32,   36,   33,   28,   35,
-       28,   32,   42,   35,   34,   32,   37,   37,   69,   35,
-       36,   37,   35,   33,   72,   38,  148,   42,   72,   35,
-       38,   37,   69,   38,   37,   39,   39,   40,   39,   52,
-       38,   40,   52,   77,   38,   38,   77,   39,   78,   41,
-
-       41,   40,   78,   39,   41,   40,   40,   58,   41,   58,
-       58,   80,   58,   63,   63,   66,  204,   66,   66,   68,
-       66,   68,   68,   71,   68,   71,   71,   66,   71,   83,
-       74,   80,   74,   74,   71,   74,   81,   82,  204,   81,
-       82,   74,   74,   84,   85,   86,   87,   83,   89,   90,
-       93,   86,   84,   82,   92,   90,   91,   86,   85,   94,
-       95,   93,   93,  146,   87,   87,   97,   89,   90,   96,
-       91,   97,   98,   96,   92,  100,   99,   94,   95,   99,
-      101,  100,   99,  102,  103,  104,   98,  103,  102,  105,
-      106,  103,  111,  108,  106,   99,   99,  110,  107,  101,
-
-      100,  112,  114,  105,  104,  107,  108,  109,  102,  104,
-      110,  113,  111,  115,  109,  113,  116,  118,  115,  112,
-      114,  119,  115,  117,  117,  119,  120,  121,  145,  122,
-      125,  123,  122,  124,  119,  127,  116,  118,  128,  124,
-      119,  120,  125,  122,  123,  129,  121,  122,  126,  126,
-      130,  131,  136,  127,  128,  132,  133,  132,  134,  138,
-      135,  137,  142,  134,  129,  142,  137,  131,  133,  126,
-      136,  130,  135,  138,  140,  140,  153,  144,  132,  144,
-      144,  153,  144,  147,  147,  149,  155,  149,  149,  150,
-      149,  150,  150,  152,  150,  159,  152,  154,  156,  157,
-
-      158,  150,  160,  154,  155,  162,  156,  143,  158,  163,
-      157,  161,  154,  156,  159,  164,  161,  160,  163,  165,
-      171,  164,  164,  167,  165,  162,  166,  166,  168,  167,
-      168,  169,  174,  168,  141,  169,  170,  170,  172,  171,
-      169,  173,  175,  172,  174,  169,  173,  178,  175,  176,
-      168,  169,  169,  176,  177,  179,  181,  180,  182,  177,
-      183,  178,  186,  182,  139,  183,  191,  184,  184,  180,
-      179,  175,  180,  184,  181,  185,  187,  188,  189,  189,
-      185,  194,  186,  188,  190,  184,  191,  184,  192,  193,
-      190,  195,  187,  197,  192,  196,  190,  195,  193,  197,
-
-      196,  198,  194,  199,  200,  201,  202,  198,  203,  206,
-      199,  201,  205,  207,  203,  208,  209,  200,  207,  210,
-      205,  211,  206,  212,  208,  213,  202,  215,  212,  214,
-      216,  209,  217,  214,  218,  210,  216,  219,  221,  224,
-      218,  211,  220,  213,  220,  221,  222,  223,  225,  215,
-      217,  217,  222,  223,  225,  226,  232,  219,  224,  227,
-      227,  228,  228,  229,  230,  234,  231,  226,  231,  229,
-      230,  233,  235,  236,  237,  238,  233,  234,  239,  232,
-      238,  236,  240,  243,  239,  231,  244,  229,  240,  243,
-      241,  235,  242,  245,  237,  241,  246,  242,  247,  249,
-
-      248,  244,  250,  254,  251,  250,  251,  245,  248,  252,
-      252,  257,  247,  253,  246,  258,  253,  255,  255,  256,
-      256,  254,  259,  262,  249,  259,  261,  257,  260,  262,
-      258,  263,  260,  264,  265,  261,  265,  266,  271,  264,
-      269,  266,  267,  267,  268,  263,  269,  270,  272,  268,
-      273,  274,  274,  276,  275,  277,  271,  275,  266,  277,
-      278,  279,  279,  273,  280,  281,  287,  270,  281,  272,
-      283,  276,  282,  285,  284,  287,  283,  284,  278,  286,
-      289,  288,  280,  289,  282,  285,  288,  290,  286,  292,
-      291,  292,  292,  293,  293,  294,  286,  286,  294,  286,
-
-      290,  289,  291,  295,  296,  297,  298,  299,  299,  301,
-      301,  300,  302,  303,  297,  298,  300,  304,  303,  296,
-      295,  305,  306,  295,  307,  308,  309,  302,  310,  304,
-      311,  308,  312,  310,  365,  365,  311,  312,  313,  307,
-      305,  315,  306,  313,  316,  314,  309,  316,  314,  313,
-      314,  318,  317,  319,  320,  315,  322,  318,  319,  323,
-      316,  317,  324,  316,  325,  316,  321,  320,  330,  321,
-      327,   70,  328,  327,  334,  320,  322,  324,  325,  331,
-      323,  339,  321,  330,  335,  321,  328,  321,  331,  327,
-      329,  332,  329,  329,  333,  334,  332,  332,  336,  337,
-
-      333,  338,  329,  335,  329,  329,  329,  339,  337,  329,
-      340,  341,  342,  336,  343,  344,  345,  346,  342,  347,
-      338,  349,  342,  348,  347,  341,  350,  349,  351,  352,
-      340,  354,  346,  353,  355,  344,  345,  343,  348,  353,
-      351,  358,  356,  352,  359,  361,  350,  356,  357,  357,
-      355,  357,  360,  362,  363,  362,  354,  366,  363,  361,
-      359,  358,  364,  367,  368,  370,  364,  371,  360,  369,
-      372,  374,  366,  373,  370,  372,  371,  373,  375,  367,
-      374,  364,  368,  369,  375,  370,  376,  370,  377,  378,
-      379,  380,  382,  378,  377,  379,  381,  381,  383,  384,
-
-      385,  385,  386,  383,  388,  382,  387,  376,  386,  389,
-      387,  380,  384,  390,  389,  391,  392,  393,  397,  394,
-      395,  395,  390,  394,  401,  388,  396,  391,  403,  393,
-      402,  396,  398,  398,  392,  400,  400,  403,  402,  397,
-      404,  405,  408,  407,  409,  401,  410,  411,  412,  415,
-      413,  414,  410,  405,  412,  413,  411,  415,  409,  417,
-      404,  407,  408,  407,  416,  414,  418,  419,  420,  418,
-      416,  421,  422,  419,  423,  425,  421,  424,  426,  417,
-      425,  424,  420,  427,  428,  429,  433,  431,  427,  432,
-       64,  419,  434,  426,  422,  423,  436,  434,  441,  435,
-
-      428,  436,  433,  437,  429,  430,  430,  431,  432,  438,
-      439,  430,  443,  430,  435,  438,  442,  442,  441,  437,
-      438,  430,  444,  444,  430,  430,  439,  440,  445,  446,
-      440,  430,  447,  448,  449,  450,  451,  443,  452,  453,
-      450,  446,  454,  445,  456,  451,  457,  447,  454,  458,
-      457,  459,  448,  456,  453,  458,  449,  452,  460,  461,
-      462,  463,  464,  459,  465,  466,  464,  466,  467,  468,
-      468,  470,  472,  460,  469,  462,  467,  465,  461,  463,
-      469,  471,  473,  470,  472,  473,  474,  471,  475,  476,
-      477,  478,  476,  475,  479,  480,  481,  481,  483,  479,
-
-      479,  474,  482,  482,  483,  487,  477,  478,  480,  477,
-      484,  484,  485,  485,  486,  489,  488,  490,  492,  491,
-      486,  488,  491,  493,  494,  490,  487,  495,  494,  497,
-      499,  496,  498,  495,  489,  496,  504,  498,  500,  502,
-      501,  492,  493,  503,  500,  501,  503,  497,  505,  505,
-      499,  503,  506,  502,  504,  503,  507,  508,  509,  510,
-      511,  507,  508,  514,  512,  513,  511,  514,  513,  517,
-      506,  515,  509,  512,  510,  516,  515,  518,  519,  521,
-      516,  520,  520,  519,  522,  517,  523,  524,  521,  514,
-      518,  525,  526,  524,  529,  526,  527,  525,  523,  527,
-
-      522,  528,  530,  531,  537,  532,  528,  533,  534,  531,
-      532,  534,  529,  533,  535,  536,  530,  537,  538,  535,
-      536,  536,  539,  540,  541,  542,  544,  543,  545,  540,
-      543,  538,  544,  546,  542,  548,  548,  549,  546,  551,
-      545,  539,  539,  541,  547,  543,  550,  553,  550,  547,
-      547,  552,  554,  552,  555,  556,  557,  558,  551,  559,
-      560,  558,  549,  561,  562,  553,  563,  564,  559,  566,
-      554,  565,  555,  567,  556,  560,  557,  565,  563,  568,
-      569,  561,  564,  562,  570,  571,  572,  572,  566,  573,
-      574,  576,  567,  573,  575,  577,  576,  568,  569,  578,
-
-      579,  580,  570,  582,  571,  575,  585,  581,  580,  574,
-      582,  577,  581,  579,  583,  584,  586,  587,  578,  583,
-      584,  588,  589,  586,  585,  590,  587,  591,  594,  596,
-      592,  589,  591,  592,  593,  588,  595,  590,  593,  597,
-      598,  598,  594,  596,  601,  595,  599,  599,  600,  600,
-      603,  604,  605,  601,  606,  599,  607,  604,  606,  608,
-      597,  609,  610,  611,  612,  613,  622,  609,  607,  603,
-      610,  614,  605,  616,  619,  622,  614,  608,  623,  629,
-      614,  611,  624,  614,  623,  613,  624,  627,  616,  612,
-      614,  619,  628,  614,  625,  625,  626,  626,  627,  629,
-
-      632,  630,  633,  634,  635,  632,  628,  630,  631,  631,
-      631,  636,  631,  640,  636,  631,  637,  637,  638,  642,
-      631,  634,  647,  633,  642,  638,  631,  631,  640,  635,
-      639,  639,  641,  641,  643,  644,  645,  643,  645,  646,
-      644,  647,  648,  649,  651,  650,  648,  652,  652,  656,
-      653,  646,  651,  654,  655,  657,  658,  658,  671,  671,
-      657,  656,  661,  649,  650,  653,  660,  654,  661,  662,
-      663,  660,  655,  663,  664,  662,  665,  666,  667,  670,
-      664,  668,  669,  672,  665,  666,  668,  673,  674,  669,
-      675,  677,  672,  678,  674,  673,  667,  680,  670,  679,
-
-      677,  683,  678,  685,  679,  681,  680,  682,  681,  675,
-      684,  684,  682,  686,  687,  683,  688,  689,  685,  691,
-      689,  691,  693,  687,  692,  692,  694,  695,  689,  696,
-      697,  694,  686,  698,  699,  700,  704,  701,  702,  703,
-      688,  701,  706,  693,  700,  704,  707,  705,  695,  696,
-      697,  708,  709,  709,  699,  698,  702,  708,  703,  705,
-      707,  706,  710,  711,  712,  713,  714,  715,  716,  717,
-      718,  719,  720,  721,  716,  719,  718,  723,  724,  724,
-       59,  715,  710,  711,  712,  721,  714,  713,  725,  717,
-      722,  720,  727,  721,  725,  722,  726,  729,  723,  726,
-
-      728,  730,  732,  729,  731,  731,  733,  734,  734,  735,
-      727,  733,  736,  728,  737,  737,  736,  738,  739,  740,
-      732,  730,  742,  739,  735,  745,  743,  746,  748,  748,
-      749,  751,  750,  752,  749,  753,  754,  752,  740,  738,
-      743,  754,  793,  755,   54,  745,  742,  750,  746,  747,
-      753,  793,  747,  759,  747,  757,  751,  755,  747,  758,
-      747,  756,  763,  758,  762,  747,  756,  756,  759,  757,
-      747,  760,  761,  764,  765,  766,  760,  761,  762,  770,
-      765,  766,  771,  763,  767,  767,  760,  764,  768,  769,
-      775,  773,  774,  768,  776,  769,  781,  774,  770,  782,
-
-      771,  772,  772,  773,  775,  780,  776,  772,  778,  772,
-      777,  777,  788,  778,  779,  781,  783,  783,  782,  780,
-      772,  772,  779,  786,  784,  789,  790,  772,  784,  786,
-      787,  788,  790,  787,  791,  792,  794,  795,  789,  791,
-      796,  797,  798,  799,  800,  794,  796,  802,  799,  801,
-      797,  803,  805,  795,  792,  807,  804,  808,  805,  809,
-      803,  798,  814,  801,  800,  804,  810,  802,  811,  807,
-      812,  814,  816,  811,  813,  812,  808,  809,  816,  813,
-      817,  810,  815,  815,  819,  820,  824,  823,  821,  821,
-      820,  820,  821,  817,  822,  825,  826,  822,  828,  827,
-
-      819,  823,  829,  831,  828,  830,  824,  832,  830,  826,
-      833,  834,  832,  825,  827,  833,  835,  837,  836,  839,
-      840,  835,  829,  836,  831,  839,  841,  834,  842,  837,
-      843,  843,  841,  844,  842,  845,  840,  846,  847,  848,
-      846,  849,  844,  851,  850,  852,  856,  853,  857,  851,
-      854,  852,  853,  845,  857,  854,  847,  850,  848,  858,
-      858,  849,  859,  860,  856,  861,  862,  863,  861,  865,
-      864,  859,  866,  867,  868,  865,  870,  862,  866,  868,
-      871,  860,  864,  869,  869,  863,  872,  873,  867,  874,
-      875,  873,  876,  877,  871,  870,  879,  883,  872,  875,
-
-      880,  880,  882,  885,  887,  884,   53,  874,  885,  886,
-      886,  876,  883,  888,  889,  879,  882,  884,  877,  888,
-      889,  890,  892,  891,  887,  891,  890,  892,  893,  894,
-      895,  896,  897,  898,  899,  895,  900,  901,  901,  902,
-      898,  903,  893,  894,  904,  905,  896,  906,  928,  899,
-      904,  897,  906,  902,  911,  900,  908,  908,  913,  903,
-      928,  906,  909,  906,  910,  905,  906,  909,  911,  912,
-      914,  910,  912,  915,  916,  917,  913,  918,  915,  914,
-      917,  920,  920,  921,  922,  923,  925,  924,  921,  927,
-      923,  924,  926,  916,  929,  925,  918,  932,  930,  931,
-
-      933,  934,  936,  937,  922,  930,  935,  926,  927,  929,
-      938,  931,  935,  939,  941,  942,  932,  936,  943,  934,
-      941,  933,  939,  937,  944,  946,  943,  945,  947,  942,
-      938,  948,  945,  947,  947,  949,  954,  946,  950,  951,
-      951,  953,  955,   48,  944,  954,  956,  956,  955,  949,
-      948,  950,  952,  957,  953,  958,  962,  952,  957,  966,
-      952,  952,  959,  960,  958,  952,  965,  959,  960,  961,
-      961,  952,  963,  964,   43,  952,  962,  966,  964,  967,
-      965,  963,  968,  970,  969,  967,  971,  970,  968,  969,
-      972,  972,  973,  976,  973,  971,  974,  976,  977,  978,
-
-      971,  979,  971,  980,  971,  981,  971,  974,  980,  980,
-      979,  982,  983,  977,  984,  985,  982,  978,  987,  988,
-      986,  989,  990,  984,  988,  991,  983,  981,  986,  992,
-      995,  990,  987,  993,  985,  989,  994,  994,  993,  996,
-      996, 1001,  997,  991,  997,  995,  999, 1000, 1003,  999,
-     1002, 1002, 1000, 1005,  992, 1004, 1004, 1006, 1005, 1007,
-     1001, 1008, 1008, 1009, 1010, 1011, 1014, 1011, 1003, 1010,
-     1013, 1014, 1016, 1013, 1015, 1019, 1017, 1016, 1006,   14,
-     1007, 1017, 1015, 1009, 1018, 1018, 1020, 1021, 1022, 1024,
-     1025, 1028, 1020, 1019, 1021, 1024, 1025, 1026, 1027, 1029,
-
-     1028, 1022, 1026, 1030, 1027, 1031, 1031, 1032, 1034, 1035,
-     1036, 1037, 1042, 1039, 1030, 1040, 1036, 1037, 1029, 1039,
-     1041, 1044, 1043, 1046, 1042, 1045, 1045, 1032, 1034, 1040,
-     1047, 1048, 1035, 1049, 1051, 1040, 1043, 1054, 1049, 1044,
-     1041, 1050, 1050, 1046, 1056, 1052, 1055, 1058, 1059, 1048,
-     1052, 1055, 1055, 1056, 1057, 1047, 1054, 1051, 1060, 1061,
-     1063, 1058, 1057, 1059, 1061, 1064, 1062, 1061, 1062, 1066,
-     1067, 1064, 1068, 1060, 1063, 1065, 1060, 1069, 1070, 1065,
-     1066, 1071, 1072, 1070, 1080, 1075, 1074, 1076, 1076, 1067,
-     1077, 1078, 1079, 1081, 1077, 1069, 1080, 1085, 1068, 1071,
-
-     1074, 1082, 1072, 1075, 1083, 1084, 1089, 1087, 1086, 1078,
-     1094, 1079, 1081, 1086, 1087, 1082, 1085, 1088, 1090, 1083,
-     1084, 1092, 1088, 1093, 1089, 1091, 1091, 1090, 1095, 1093,
-     1104, 1094, 1096, 1095, 1097, 1102, 1092, 1105, 1096, 1102,
-     1097, 1098, 1098, 1099, 1099, 1101, 1101, 1103, 1104, 1106,
-     1107, 1105, 1108, 1108, 1109, 1110, 1103, 1107, 1112, 1113,
-     1111, 1114, 1116, 1110, 1106, 1111, 1114, 1114, 1117, 1118,
-     1115, 1119, 1112, 1120, 1109, 1115, 1115, 1121, 1113, 1120,
-     1122, 1125, 1116, 1123, 1129, 1124, 1126, 1117, 1118, 1123,
-     1119, 1124, 1127, 1128, 1130, 1131, 1132, 1132, 1129, 1122,
-
-     1125, 1133, 1134, 1121, 1133, 1126, 1135, 1135, 1136, 1138,
-     1131, 1127, 1128, 1136, 1134, 1130, 1137, 1139, 1140, 1141,
-     1137, 1141, 1138, 1143, 1144, 1141, 1139, 1145, 1143, 1146,
-     1148, 1140, 1147, 1147, 1151, 1148, 1149, 1150, 1141, 1144,
-     1149, 1150, 1152, 1153, 1154, 1146, 1157, 1145, 1155, 1155,
-     1154, 1159, 1160, 1162, 1151, 1161, 1161, 1160, 1167, 1162,
-     1152, 1164, 1164, 1153, 1157, 1166, 1166, 1168, 1170, 1171,
-     1171, 1170, 1159, 1172, 1167, 1173, 1174, 1174, 1175, 1176,
-     1173, 1177, 1177, 1168, 1178, 1179, 1180, 1181, 1181, 1183,
-     1179, 1182, 1185, 1175, 1172, 1182, 1184, 1184, 1178, 1186,
-
-     1188, 1180, 1187, 1189, 1176, 1192, 1187, 1193, 1189, 1183,
-     1186, 1191, 1191, 1194, 1185, 1195, 1196, 1196, 1198, 1188,
-     1197, 1193, 1199, 1192, 1202, 1197, 1200, 1206, 1203, 1195,
-     1203, 1201, 1194, 1194, 1204, 1200, 1201, 1205, 1198, 1204,
-     1207, 1209, 1199, 1205, 1202, 1211, 1207, 1206, 1210, 1210,
-     1212, 1214, 1215, 1215, 1217, 1209, 1212, 1216, 1216, 1218,
-     1220, 1219, 1222, 1220, 1211, 1221, 1221, 1223, 1217, 1229,
-     1232, 1232,   13, 1225, 1222, 1214, 1219, 1218, 1224, 1225,
-     1226, 1224, 1227, 1228, 1224, 1226, 1230, 1223, 1228, 1230,
-     1234, 1227, 1231, 1235, 1229, 1234, 1224, 1236, 1231, 1233,
-
-     1233, 1237, 1238, 1239, 1240, 1242, 1235, 1241, 1243, 1239,
-     1240, 1242, 1241, 1244, 1246, 1236, 1245, 1245, 1244, 1246,
-     1237, 1247, 1238, 1248, 1249, 1252, 1250, 1251, 1254, 1253,
-     1255, 1243, 1256, 1257, 1254, 1258, 1264, 1252, 1261, 1247,
-     1250, 1251, 1253, 1248, 1249, 1260, 1260, 1257, 1262, 1265,
-     1255, 1264, 1256, 1262, 1263, 1263, 1258, 1266, 1261, 1267,
-     1268, 1269, 1276, 1265, 1270, 1274, 1271, 1272, 1282, 1268,
-        0, 1270, 1277, 1277, 1280, 1271, 1269, 1267, 1271, 1279,
-     1274, 1266, 1279, 1272, 1282, 1274, 1281, 1276, 1278, 1278,
-     1283, 1281, 1284, 1280, 1285, 1286, 1287, 1288, 1288, 1283,
-
-     1289, 1290, 1287, 1285, 1286, 1291, 1285, 1292, 1293, 1296,
-     1294, 1284, 1297, 1299, 1290, 1298, 1298, 1300, 1302, 1302,
-     1289, 1292, 1294, 1291, 1293, 1304, 1300, 1301, 1303, 1299,
-     1297, 1305, 1301, 1302, 1296, 1306, 1307, 1303, 1309, 1310,
-     1303, 1307, 1307, 1304, 1309, 1311, 1311, 1317, 1312, 1318,
-     1313, 1324, 1305, 1306, 1312, 1313, 1314, 1310, 1315, 1319,
-     1320, 1325, 1314, 1318, 1315, 1319, 1321, 1317, 1326, 1321,
-     1324, 1327, 1328, 1320, 1330, 1321, 1326, 1329, 1331, 1332,
-     1325, 1333, 1334, 1329, 1327, 1335, 1328, 1330, 1334, 1336,
-     1338, 1338, 1339, 1340, 1333, 1341, 1331, 1340, 1332, 1342,
-
-     1341, 1335, 1344, 1343, 1342, 1345, 1347, 1336, 1343, 1348,
-     1348, 1344, 1339, 1349, 1350, 1351, 1352, 1353, 1356, 1354,
-     1357, 1347,    0, 1355, 1353, 1360, 1350, 1358, 1345, 1359,
-     1352, 1354, 1349, 1358, 1351, 1355, 1361, 1356, 1362, 1362,
-     1357, 1359, 1361, 1360, 1363, 1364, 1364, 1363, 1366, 1367,
-     1368, 1368, 1369, 1366, 1370, 1372, 1370, 1371, 1367, 1373,
-     1371, 1374, 1375, 1376, 1369, 1377, 1378, 1379, 1376, 1382,
-     1383, 1380, 1384, 1384, 1377, 1372, 1380, 1381, 1378, 1374,
-     1375, 1373, 1379, 1386, 1385, 1383, 1381, 1387, 1388, 1382,
-     1385, 1389, 1393, 1389, 1390, 1390, 1391, 1391, 1395, 1381,
-
-     1392, 1392, 1394, 1394, 1386, 1396, 1387, 1398, 1388, 1397,
-     1397, 1398, 1393, 1400, 1399, 1402, 1400, 1403, 1404, 1395,
-     1399, 1402, 1405, 1411, 1404, 1406, 1396, 1409, 1406, 1407,
-     1407, 1408, 1408, 1409, 1412, 1403, 1410, 1414, 1413, 1417,
-     1416, 1419, 1423, 1411, 1413, 1416, 1416, 1405, 1410, 1410,
-     1410, 1420, 1419, 1417, 1412, 1410, 1418, 1414, 1418, 1421,
-     1422, 1424, 1423, 1425, 1425, 1421, 1420, 1426, 1428, 1422,
-     1427, 1427, 1429, 1430, 1430, 1431, 1431, 1434, 1435, 1436,
-     1436, 1437, 1424, 1438, 1440, 1442, 1434, 1443, 1428, 1439,
-     1438, 1441, 1441, 1426, 1429, 1445, 1437, 1447, 1439, 1435,
-
-     1445, 1446, 1448, 1443, 1451, 1451, 1449, 1446, 1450, 1448,
-     1440, 1442, 1449, 1452, 1450, 1453, 1454, 1447, 1452, 1455,
-     1456, 1458, 1457, 1459, 1453, 1457, 1460, 1460, 1461, 1463,
-     1462, 1464, 1456, 1466, 1461, 1464, 1454, 1469, 1455, 1458,
-     1467, 1470, 1471, 1477, 1463, 1470, 1473, 1473, 1471, 1459,
-     1462, 1464, 1466, 1472, 1474, 1467, 1469, 1475, 1474, 1476,
-     1476, 1478, 1472, 1479, 1477, 1480, 1481, 1483, 1475, 1482,
-     1482, 1483, 1481, 1475, 1486, 1478, 1484, 1485, 1485, 1486,
-     1486, 1489, 1487, 1479, 1488, 1480, 1490, 1484, 1487, 1491,
-     1488, 1493, 1484, 1494, 1495, 1491, 1496, 1494, 1490, 1497,
-
-     1498, 1500, 1499, 1493, 1502, 1497, 1495, 1489, 1499, 1503,
-     1504, 1505, 1509, 1500, 1505, 1504, 1502, 1506, 1506, 1507,
-     1507, 1496, 1498, 1508, 1508, 1510, 1514, 1511, 1503, 1512,
-     1513, 1510, 1509, 1511, 1512, 1514, 1513, 1516, 1518, 1519,
-     1521, 1518, 1516, 1522, 1523, 1524, 1524, 1525, 1526, 1523,
-     1529, 1519, 1521, 1526, 1527, 1522, 1525, 1528, 1528, 1527,
-     1530, 1531, 1532, 1533, 1536, 1539, 1534, 1533, 1535, 1530,
-     1529, 1534, 1538, 1538, 1535, 1542, 1540, 1541, 1536, 1531,
-     1543, 1532, 1548, 1539, 1538, 1540, 1541, 1542, 1546, 1546,
-     1549, 1552, 1551, 1543, 1553, 1554, 1555, 1555, 1548, 1556,
-
-     1553, 1556, 1557, 1557, 1560, 1552, 1549, 1551, 1558, 1561,
-     1563, 1560, 1554, 1562, 1562, 1564, 1558, 1568, 1565, 1563,
-     1566, 1567, 1569, 1573, 1575, 1570, 1572, 1574, 1574, 1561,
-     1565, 1570, 1566, 1567, 1576, 1573, 1564, 1569, 1577, 1579,
-     1578, 1577, 1575, 1568, 1570, 1578, 1572, 1581, 1582, 1583,
-     1582, 1584, 1581, 1585, 1576, 1587, 1584, 1590, 1592, 1579,
-     1585, 1588, 1598, 1588, 1587, 1591, 1591, 1583, 1593, 1595,
-     1594, 1590, 1594, 1593, 1595, 1596, 1597, 1599, 1601, 1602,
-     1596, 1600, 1598, 1599, 1592, 1604, 1600, 1602, 1605, 1606,
-     1606, 1601, 1607, 1607, 1597, 1608, 1609, 1610, 1613, 1612,
-
-     1611, 1612, 1605, 1610, 1604, 1611, 1613, 1614, 1614, 1615,
-     1608, 1616, 1616, 1618, 1613, 1620, 1609, 1617, 1617, 1621,
-     1621, 1615, 1618, 1622, 1619, 1618, 1619, 1623, 1625, 1626,
-     1627, 1629, 1622, 1630, 1626, 1627, 1620, 1631, 1632, 1623,
-     1625, 1633, 1635, 1636, 1629, 1637, 1639, 1642, 1636, 1644,
-     1637, 1643, 1639, 1630, 1635, 1631, 1632, 1633, 1641, 1645,
-     1646, 1646, 1647, 1649, 1641, 1639, 1643, 1652, 1645, 1657,
-     1642, 1647, 1648, 1648, 1644, 1650, 1651, 1657, 1653, 1650,
-     1652, 1651, 1649, 1653, 1653, 1654, 1655, 1656, 1658, 1663,
-     1656, 1654, 1655, 1661, 1661, 1662, 1662, 1666, 1663, 1664,
-
-     1664, 1665, 1665, 1681, 1667, 1668, 1675, 1669, 1658, 1666,
-     1662, 1668, 1669, 1670, 1670, 1671, 1678, 1672, 1681, 1680,
-     1671, 1662, 1667, 1672, 1674, 1676, 1675, 1679, 1674, 1676,
-     1682, 1683, 1679, 1687, 1684, 1682, 1685, 1685, 1689, 1686,
-     1688, 1678, 1680, 1686, 1690, 1688, 1691, 1694, 1687, 1683,
-     1684, 1691, 1692, 1692, 1695, 1696, 1697, 1698, 1699, 1700,
-     1701, 1706, 1703, 1690, 1689,    0, 1694, 1704, 1704, 1705,
-     1707, 1700, 1705, 1695, 1706, 1708, 1698, 1703, 1696, 1699,
-     1697, 1701, 1709, 1709, 1707, 1710, 1710, 1712, 1708, 1711,
-     1711, 1713, 1714, 1714, 1715, 1716, 1716, 1720, 1721, 1722,
-
-     1717, 1725, 1712, 1715, 1713, 1717, 1715, 1719, 1723, 1723,
-     1727, 1722, 1719, 1724, 1724, 1726, 1726, 1720, 1721, 1730,
-     1725, 1728, 1728, 1729, 1729, 1731, 1733, 1735, 1727, 1734,
-     1734, 1733, 1737, 1730, 1736, 1736, 1738, 1739, 1740, 1740,
-     1739, 1742, 1738, 1743, 1731, 1744, 1735, 1741, 1741, 1747,
-     1737, 1745, 1745, 1748, 1740, 1749, 1752, 1750, 1743, 1753,
-     1742, 1750, 1751, 1751, 1744, 1754, 1756, 1756, 1757, 1747,
-     1749, 1758, 1759, 1769, 1753, 1752, 1748, 1761, 1758, 1764,
-     1754, 1760, 1760, 1762, 1765, 1762, 1761, 1766, 1757, 1765,
-     1767, 1764, 1766, 1768, 1769, 1770, 1771, 1772, 1759, 1773,
-
-     1770, 1771, 1772, 1774, 1775, 1776, 1768, 1777, 1774, 1781,
-     1778, 1779, 1780, 1783, 1773, 1767, 1777, 1783, 1776, 1778,
-     1779, 1780, 1782, 1781, 1785, 1787, 1788, 1788, 1782, 1775,
-     1789, 1790, 1790, 1791, 1787, 1793, 1789, 1796, 1794, 1797,
-     1790, 1795, 1795, 1800, 1785, 1799, 1801, 1806, 1797, 1857,
-     1802, 1793, 1796, 1791, 1794, 1791, 1807, 1799, 1857, 1800,
-     1804, 1801, 1802, 1804, 1805, 1808, 1808, 1806, 1807, 1805,
-     1810, 1810, 1811, 1812, 1813, 1811, 1814, 1816, 1812, 1820,
-     1813, 1818, 1814, 1815, 1815, 1817, 1817, 1819, 1821, 1821,
-     1823, 1816, 1824, 1818, 1823, 1824, 1825, 1825, 1820, 1826,
-
-     1827, 1819, 1828, 1830, 1826, 1831, 1828, 1832, 1833, 1834,
-     1835, 1836, 1833, 1837, 1838, 1835,    0, 1836, 1840, 1837,
-     1827, 1832, 1841, 1830, 1842, 1831, 1847, 1841, 1843, 1834,
-     1842, 1844, 1838, 1844, 1840, 1850, 1843, 1848, 1848, 1849,
-     1847, 1853, 1849, 1851, 1851, 1853, 1854, 1855, 1856, 1856,
-     1860, 1860, 1854, 1862, 1873, 1865, 1874, 1866,    0, 1855,
-     1865, 1850, 1866, 1867, 1867, 1869, 1869, 1871, 1872, 1872,
-     1873, 1862, 1875, 1871, 1877, 1878, 1881, 1875, 1874, 1879,
-     1879, 1883, 1882, 1884, 1887, 1881, 1888, 1878, 1882, 1886,
-     1886, 1890, 1890, 1877, 1891, 1891, 1892, 1894, 1884, 1883,
-
-     1893, 1892, 1893, 1887, 1888, 1895, 1902, 1896, 1897, 1897,
-     1901, 1894, 1896, 1898, 1898, 1899, 1899, 1900, 1900, 1895,
-     1903, 1903, 1901, 1905, 1902, 1904, 1904, 1906, 1906, 1907,
-     1907, 1908, 1908, 1909, 1910, 1905, 1911, 1912, 1913, 1914,
-     1916, 1910, 1917, 1913, 1918, 1909, 1915, 1915, 1911, 1916,
-     1919, 1920, 1921, 1922, 1922, 1924, 1923, 1912, 1925, 1914,
-     1927, 1928, 1929, 1919, 1918, 1923, 1921, 1931, 1917, 1930,
-     1924, 1932, 1930, 1925, 1933, 1920, 1932, 1940, 1927, 1933,
-     1942, 1931, 1944, 1928, 1946, 1929, 1934, 1934, 1935, 1935,
-     1936, 1936, 1939, 1939, 1941, 1940, 1945, 1947, 1948, 1942,
-
-     1949, 1950, 1944, 1951, 1951, 1941, 1946, 1948, 1953, 1953,
-     1955, 1955, 1954, 1956, 1945, 1957, 1958, 1947, 1960, 1950,
-     1949, 1954, 1959, 1958, 1961, 1962, 1963, 1964, 1964, 1965,
-     1965, 1956, 1966, 1957, 1967, 1968, 1960, 1959, 1966, 1969,
-     1971, 1962, 1961, 1970, 1972, 1963, 1973, 1974, 1970, 1974,
-     1968, 1973, 1967, 1975, 1975, 1976, 1979, 1976, 1969, 1981,
-     1971, 1977, 1977, 1982, 1972, 1983, 1986, 1987, 1981, 1990,
-     1987, 1988, 1988, 1989, 1992, 1979, 1991, 1991, 1992, 1994,
-     1997, 1995, 1999, 1982, 1983, 1995, 1986, 1990, 1989, 1996,
-     1996, 2000, 2013, 1997, 1994, 2001, 2001, 2003, 2003, 2004,
-
-     2005, 2005, 1999, 2006, 2007, 2007, 2012, 2012, 2006, 2014,
-     2015, 2000, 2016, 2021, 2013, 2020, 2024, 2023, 2004, 2022,
-     2020, 2016, 2014, 2015, 2022, 2023, 2025, 2021, 2027, 2030,
-     2035, 2028, 2029, 2036, 2025, 2024, 2028, 2029, 2031, 2031,
-     2032, 2032, 2033, 2027, 2030, 2034, 2037, 2040, 2035, 2033,
-     2034, 2036, 2037, 2038, 2039, 2039, 2041, 2046, 2038, 2042,
-     2042, 2041, 2040, 2043, 2043, 2047, 2048,    0, 2047, 2049,
-     2046, 2048, 2048, 2050, 2049, 2051, 2052, 2053, 2050, 2054,
-     2052, 2051, 2053, 2055, 2056, 2057, 2060, 2058, 2054, 2060,
-     2057, 2062, 2056, 2064, 2065, 2063, 2062, 2066, 2055, 2058,
-
-     2063, 2067, 2068, 2068, 2069, 2072, 2066, 2065, 2073, 2077,
-     2067, 2064, 2074, 2069, 2075, 2075, 2076, 2078, 2077, 2079,
-     2079, 2080, 2082, 2084, 2072, 2085, 2088, 2086, 2073, 2085,
-     2105, 2074, 2078, 2086, 2088, 2076, 2089, 2082, 2087, 2087,
-     2080, 2089, 2091, 2084, 2092, 2094, 2095, 2096, 2107, 2094,
-     2105, 2091, 2098, 2098, 2099, 2099, 2135, 2092, 2100, 2100,
-     2095, 2135, 2096, 2103, 2103, 2108, 2108, 2115, 2107, 2109,
-     2109, 2110, 2110, 2111, 2112, 2112, 2111, 2113, 2113, 2114,
-     2114, 2117, 2115, 2116, 2116, 2119, 2118, 2120, 2120, 2121,
-     2124, 2119, 2125, 2121, 2126, 2124, 2124, 2127, 2128, 2117,
-
-     2118, 2129, 2130, 2137, 2128, 2131, 2137, 2129, 2136, 2131,
-     2132, 2132, 2139, 2141, 2126, 2125, 2136, 2127, 2140, 2142,
-     2143, 2140, 2144,    0, 2142, 2145, 2147, 2130, 2146, 2146,
-     2141, 2141, 2148, 2149, 2150, 2150, 2156, 2139, 2143, 2145,
-     2148, 2154, 2144, 2151, 2151, 2147, 2152, 2152, 2153, 2153,
-     2155, 2157, 2149, 2158, 2159, 2155, 2156, 2154, 2160, 2162,
-     2162, 2163, 2158, 2164, 2163, 2166, 2166, 2169, 2167, 2168,
-     2168, 2170, 2169, 2172, 2159, 2167, 2175, 2157, 2160, 2176,
-     2170, 2164, 2173, 2173, 2174, 2175, 2178, 2177, 2174, 2179,
-     2185, 2172, 2177, 2177, 2176, 2183, 2183, 2184, 2179, 2178,
-
-     2188, 2190, 2185, 2192, 2194, 2196, 2184, 2195, 2195, 2194,
-     2198, 2201, 2201, 2190, 2196, 2198, 2199, 2199, 2202, 2202,
-     2199, 2203, 2203, 2204, 2192, 2188, 2205, 2209, 2206, 2207,
-     2210, 2211, 2204, 2209, 2207, 2210, 2211, 2212, 2212, 2213,
-     2214, 2216, 2218, 2215, 2217, 2221, 2205, 2206, 2215, 2224,
-     2217, 2219, 2219, 2222, 2223, 2223, 2225, 2213, 2228, 2216,
-     2229, 2214, 2224, 2227, 2221, 2230, 2226, 2218, 2222, 2225,
-     2226, 2231, 2227, 2230, 2228, 2232, 2231, 2233, 2233, 2229,
-     2234, 2236, 2236, 2237, 2237, 2239, 2241, 2241, 2242, 2243,
-     2245, 2245, 2246, 2247, 2243, 2248, 2250, 2250, 2253, 2234,
-
-     2258, 2232, 2256, 2251, 2242, 2257, 2239, 2254, 2254, 2255,
-     2255, 2256, 2246, 2260, 2248, 2259, 2247, 2251, 2267, 2258,
-     2253, 2261, 2261, 2262, 2268, 2257, 2262, 2259, 2263, 2263,
-     2267, 2269, 2272, 2260, 2270, 2270, 2271, 2269, 2272, 2271,
-     2273, 2275, 2276, 2277, 2268, 2278, 2275, 2276, 2279, 2280,
-     2280, 2278, 2282, 2282, 2283, 2285, 2285, 2288, 2273, 2286,
-     2286, 2300, 2277, 2287, 2289, 2279, 2279, 2293, 2287, 2289,
-     2298, 2288, 2293, 2283, 2290, 2290, 2291, 2291, 2292, 2292,
-     2295, 2295, 2304, 2300, 2301, 2301, 2303, 2303, 2305, 2298,
-     2306, 2307, 2307, 2308, 2312, 2311, 2304, 2313, 2308, 2306,
-
-     2312, 2314, 2314, 2317, 2318, 2313, 2315, 2319, 2305, 2311,
-     2320, 2315, 2319, 2321, 2324, 2325, 2326, 2323, 2328, 2321,
-     2327, 2330, 2320, 2317, 2318, 2323, 2329, 2331, 2334, 2337,
-     2337,    0, 2331, 2324, 2328, 2325, 2326, 2339, 2327, 2338,
-     2338, 2339, 2330, 2329, 2329, 2343, 2343, 2350, 2334, 2345,
-     2345, 2346, 2346, 2347, 2346, 2349, 2349, 2347, 2351, 2353,
-     2353, 2354, 2355, 2356, 2358, 2350, 2355, 2359, 2354, 2360,
-     2360, 2363, 2351, 2361, 2361, 2365, 2359, 2368, 2356, 2362,
-     2362, 2369, 2358, 2364, 2365, 2366, 2363, 2365, 2364, 2367,
-     2366, 2366, 2370, 2371, 2372, 2367, 2369, 2373, 2371, 2372,
-
-     2374, 2374, 2368, 2377, 2377, 2380, 2380, 2381, 2381, 2382,
-     2382, 2384, 2388, 2370, 2385, 2385, 2373, 2387, 2387, 2389,
-     2384, 2390, 2390, 2391, 2392, 2392, 2395, 2388, 2397, 2396,
-     2399, 2389, 2396, 2398, 2398, 2402, 2401, 2403, 2391, 2401,
-     2404, 2402, 2405, 2407, 2395, 2404, 2406, 2413, 2399, 2416,
-     2413, 2403, 2417, 2418, 2397, 2419, 2417, 2421, 2423, 2407,
-     2422, 2405, 2425, 2423, 2406, 2424, 2427, 2424, 2428, 2419,
-     2429, 2422, 2416, 2418, 2426, 2426, 2430, 2425, 2431, 2427,
-     2421, 2432, 2433, 2434, 2435, 2435, 2436, 2428, 2429, 2437,
-     2437, 2441, 2430, 2438, 2438, 2436, 2432, 2434, 2439, 2439,
-
-     2440, 2440, 2433, 2431, 2442, 2443, 2444, 2445, 2443, 2446,
-     2441, 2444, 2445, 2447, 2448, 2449, 2450, 2450, 2451, 2460,
-     2448, 2453, 2455, 2461, 2442, 2458, 2458, 2460, 2447, 2449,
-     2459, 2459, 2462, 2463, 2446, 2464, 2453, 2451, 2462, 2463,
-     2455, 2465, 2461, 2466, 2468, 2469, 2470, 2472, 2473, 2464,
-     2470, 2474, 2475, 2473, 2465, 2476, 2477, 2481, 2478, 2469,
-     2480, 2479, 2466, 2478, 2468, 2475, 2479, 2472, 2476, 2483,
-     2474, 2482, 2482, 2484, 2483, 2477, 2481, 2486, 2480, 2484,
-     2485, 2485, 2486, 2487, 2488, 2489, 2490, 2494, 2487, 2488,
-     2491, 2494, 2490, 2492, 2492, 2491, 2495, 2497, 2496, 2498,
-
-     2499, 2500, 2502, 2502, 2489, 2496, 2499, 2506, 2501, 2504,
-     2504, 2507, 2506, 2505, 2508, 2495, 2497, 2514, 2498, 2509,
-     2500, 2501, 2505, 2510, 2510, 2505, 2511, 2512, 2515, 2515,
-     2507, 2511, 2509, 2508, 2516, 2517, 2517, 2518, 2518, 2519,
-     2512, 2520, 2521, 2514, 2519, 2522, 2522, 2523, 2520, 2524,
-     2526, 2524, 2523, 2516, 2525, 2525, 2527, 2526, 2528, 2529,
-     2530, 2521, 2533, 2527, 2529, 2532, 2532, 2535, 2536, 2537,
-     2538, 2542, 2535, 2536, 2539, 2539, 2543, 2528,    0, 2530,
-        0, 2533, 2541, 2541, 2544, 2544, 2545, 2545, 2537, 2538,
-     2542, 2546, 2548, 2548, 2550, 2543, 2549, 2549, 2546, 2552,
-
-     2555, 2550, 2556, 2557, 2552, 2555, 2558, 2558, 2559, 2559,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0, 2556, 2557, 2563, 2563, 2563, 2563, 2563, 2563, 2563,
-     2564, 2564, 2564, 2564, 2564, 2564, 2564, 2565, 2565, 2565,
-     2565, 2565, 2565, 2565, 2566, 2566, 2566, 2566, 2566, 2566,
-     2566, 2567, 2567, 2567, 2567, 2567, 2567, 2567, 2569, 2569,
-        0, 2569, 2569, 2569, 2569, 2570, 2570,    0,    0,    0,
-     2570, 2570, 2571, 2571,    0,    0, 2571,    0, 2571, 2572,
-        0,    0,    0,    0,    0, 2572, 2573, 2573,    0,    0,
-        0, 2573, 2573, 2574,    0,    0,    0,    0,    0, 2574,
-
-     2575, 2575,    0, 2575, 2575, 2575, 2575, 2576, 2576,    0,
-     2576, 2576, 2576, 2576, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562, 2562,
-     2562, 2562, 2562, 2562, 2562
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    0,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+       3,    3,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+
+       4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    4,    4,    4,    4,    4,    4,    4,    4,
+       4,    4,    5,    5,    5,    5,    5,    5,    5,    5,
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+       5,    5,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+       6,    6,    6,    6,    6,    6,    6,    6,    6,    6,
+
+       6,    6,    7,    7,    7,    7,    7,    7,   22,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+       7,    7,    8,    8,    8,    8,    8,    8,   29,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    8,    8,    8,    8,    8,    8,    8,    8,
+       8,    8,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+       9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       9,    9,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   10,   10,   10,   10,   10,   10,   10,   10,
+      10,   10,   11,   30,   31,   34,   11,   11,   11,   11,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+      11,   11,   11,   11,   11,   11,   11,   11,   11,   11,
+
+      11,   11,   12,   36,   78,   42,   12,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+      12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+      12,   12,   14,   14,   54,   79,   54,   80,   14,   81,
+      14,   14,   14,   14,   14,   82,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   14,   14,   14,   14,   14,   14,   14,
+      14,   14,   14,   15,   84,   15,   85,   19,   19,   15,
+      19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+
+      19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+      19,   19,   19,   19,   19,   19,   19,   19,   19,   19,
+      19,   19,   19,   19,   19,   19,   19,   20,   20,   86,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   20,   20,   20,
+      20,   20,   20,   20,   20,   20,   20,   21,   21,   23,
+      25,   21,   88,   88,   26,   33,   23,   24,   89,   33,
+      23,   24,   90,   23,   24,   21,   24,   24,   26,   27,
+      25,   28,   32,   27,   28,   33,   92,   27,   35,   83,
+
+      32,   28,   35,   28,   93,   37,   32,   95,   35,   37,
+      32,   35,   83,   38,   98,   39,   38,   39,   35,   37,
+      96,   40,   37,   38,   94,   94,   39,   38,   38,   97,
+      41,   40,   39,   40,   41,   40,   40,   87,   41,   43,
+      43,   99,  103,   87,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   43,
+      43,   43,   43,   43,   43,   43,   43,   43,   43,   47,
+      47,  100,   47,   47,   47,   47,   47,   47,   47,   47,
+      47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+
+      47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+      47,   47,   47,   47,   47,   47,   47,   47,   47,   48,
+      48,  105,  107,   48,   48,  105,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+      48,   48,   48,   48,   48,   48,   48,   48,   48,   52,
+      52,  108,   52,   52,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   52,   52,
+      52,   52,   52,   52,   52,   52,   52,   52,   52,   53,
+
+     106,  109,  110,  111,   53,  106,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   53,
+      53,   53,   53,   53,   53,   53,   53,   53,   53,   58,
+      58,  112,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   58,
+      58,   58,   58,   58,   58,   58,   58,   58,   58,   59,
+      59,  113,  114,  115,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   59,
+      59,   59,   59,   59,   59,   59,   59,   59,   59,   63,
+      63,  116,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   63,
+      63,   63,   63,   63,   63,   63,   63,   63,   63,   64,
+     118,  117,  119,  120,   64,  117,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   64,
+      64,   64,   64,   64,   64,   64,   64,   64,   64,   66,
+
+      66,  122,   66,   66,   66,   66,   66,   66,   66,   66,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   66,
+      66,   66,   66,   66,   66,   66,   66,   66,   66,   68,
+      68,  123,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   68,
+      68,   68,   68,   68,   68,   68,   68,   68,   68,   69,
+     125,  126,  127,  129,   69,  130,   69,   69,   69,   69,
+      69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+
+      69,   69,   69,   69,   69,   69,   69,   69,   69,   69,
+      69,   69,   69,   69,   69,   69,   69,   69,   69,   71,
+      71,  131,   71,   71,   71,   71,   71,   71,   71,   71,
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   71,
+      71,   71,   71,   71,   71,   71,   71,   71,   71,   73,
+      73,  132,   73,   73,   73,   73,   73,   73,   73,   73,
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   73,
+      73,   73,   73,   73,   73,   73,   73,   73,   73,   74,
+
+      74,  133,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   74,
+      74,   74,   74,   74,   74,   74,   74,   74,   74,   75,
+      75,  135,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   75,
+      75,   75,   75,   75,   75,   75,   75,   75,   75,   76,
+      76,  136,   76,   76,   76,   76,   76,   76,   76,   76,
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   76,
+      76,   76,   76,   76,   76,   76,   76,   76,   76,   91,
+     101,  102,  138,  101,  104,  121,  139,  137,  140,  128,
+     141,  162,  124,  134,  121,  170,  101,  101,   91,  168,
+     121,  165,  164,  124,  104,  166,  102,  124,  165,  128,
+     142,  142,  167,  169,  134,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     142,  142,  142,  142,  142,  142,  142,  142,  142,  142,
+     143,  143,  171,  143,  143,  143,  143,  143,  143,  143,
+
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     143,  143,  143,  143,  143,  143,  143,  143,  143,  143,
+     144,  144,  172,  174,  175,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     144,  144,  144,  144,  144,  144,  144,  144,  144,  144,
+     145,  145,  176,  179,  145,  145,  180,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+
+     145,  145,  145,  145,  145,  145,  145,  145,  145,  145,
+     146,  146,  181,  146,  146,  146,  146,  146,  146,  146,
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+     146,  146,  146,  146,  146,  146,  146,  146,  146,  146,
+     147,  147,  182,  183,  147,  147,  185,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     147,  147,  147,  147,  147,  147,  147,  147,  147,  147,
+     148,  186,  187,  188,  191,  148,  189,  148,  148,  148,
+
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     148,  148,  148,  148,  148,  148,  148,  148,  148,  148,
+     149,  149,  192,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+     149,  149,  149,  149,  149,  149,  149,  149,  149,  149,
+     151,  190,  193,  195,  190,  151,  196,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+
+     151,  151,  151,  151,  151,  151,  151,  151,  151,  151,
+     152,  152,  197,  198,  199,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     152,  152,  152,  152,  152,  152,  152,  152,  152,  152,
+     153,  153,  201,  153,  153,  153,  153,  153,  153,  153,
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+     153,  153,  153,  153,  153,  153,  153,  153,  153,  153,
+     154,  154,  202,  203,  204,  154,  154,  154,  154,  154,
+
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     154,  154,  154,  154,  154,  154,  154,  154,  154,  154,
+     155,  205,  206,  207,  208,  155,  209,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     155,  155,  155,  155,  155,  155,  155,  155,  155,  155,
+     156,  156,  210,  156,  156,  156,  156,  156,  156,  156,
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+
+     156,  156,  156,  156,  156,  156,  156,  156,  156,  156,
+     157,  157,  211,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     157,  157,  157,  157,  157,  157,  157,  157,  157,  157,
+     158,  158,  212,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     158,  158,  158,  158,  158,  158,  158,  158,  158,  158,
+     159,  213,  214,  216,  215,  159,  217,  159,  159,  159,
+
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     159,  159,  159,  159,  159,  159,  159,  159,  159,  159,
+     160,  218,  219,  221,  220,  160,  222,  160,  160,  160,
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     160,  160,  160,  160,  160,  160,  160,  160,  160,  160,
+     161,  161,  223,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+
+     161,  161,  161,  161,  161,  161,  161,  161,  161,  161,
+     163,  173,  177,  184,  178,  200,  194,  177,  173,  178,
+     225,  194,  224,  226,  178,  163,  228,  200,  229,  230,
+     178,  178,  231,  194,  177,  194,  232,  233,  227,  227,
+     235,  234,  184,  236,  238,  237,  239,  240,  241,  243,
+     242,  251,  247,  248,  244,  249,  250,  252,  255,  258,
+     253,  254,  261,  264,  262,  256,  257,  242,  260,  245,
+     245,  240,  245,  245,  245,  245,  245,  245,  245,  245,
+     245,  245,  245,  245,  245,  245,  245,  245,  245,  245,
+     245,  245,  245,  245,  245,  245,  245,  245,  245,  245,
+
+     245,  245,  245,  245,  245,  245,  245,  245,  245,  246,
+     259,  263,  265,  266,  246,  267,  246,  246,  246,  246,
+     246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
+     246,  246,  246,  246,  246,  246,  246,  246,  246,  246,
+     246,  246,  246,  246,  246,  246,  246,  246,  246,  268,
+     269,  270,  271,  273,  272,  274,  275,  276,  277,  278,
+     279,  282,  280,  281,  284,  283,  286,  287,  285,  289,
+     291,  288,  292,  290,  295,  294,  278,  296,  293,  297,
+     302,  306,  298,  299,  300,  301,  303,  299,  305,  305,
+     304,  299,  299,  307,  299,  312,  308,  310,  302,  308,
+
+     309,  311,  313,  314,  315,  316,  317,  319,  320,  321,
+     318,  323,  324,  325,  326,  322,  327,  328,  327,  329,
+     326,  330,  331,  333,  332,  334,  336,  335,  341,  337,
+     349,  333,  329,  345,  338,  329,  347,  329,  334,  339,
+     342,  334,  344,  334,  341,  343,  343,  346,  350,  351,
+     352,  355,  346,  360,  361,  343,  348,  343,  343,  343,
+     353,  348,  343,  348,  348,  348,  348,  348,  348,  348,
+     348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+     348,  348,  348,  348,  348,  348,  348,  348,  348,  348,
+     348,  348,  348,  348,  348,  348,  354,  356,  357,  358,
+
+     359,  362,  363,  364,  365,  366,  367,  356,  372,  368,
+     369,  370,  371,  371,  373,  374,  375,  377,  376,  379,
+     380,  378,  382,  381,  383,  384,  387,  388,  385,  386,
+     390,  389,  391,  392,  393,  396,  378,  394,  397,  385,
+     398,  385,  399,  400,  395,  401,  405,  402,  403,  404,
+     407,  409,  410,  406,  411,  408,  414,  412,  416,  419,
+     425,  413,  418,  426,  428,  429,  417,  420,  421,  424,
+     427,  431,  432,  430,  434,  435,  423,  437,  423,  436,
+     440,  520,  433,  442,  441,  443,  438,  439,  450,  444,
+     446,  452,  451,  445,  448,  446,  454,  446,  456,  435,
+
+     449,  453,  447,  455,  458,  446,  459,  454,  446,  446,
+     457,  461,  462,  460,  466,  446,  463,  465,  464,  467,
+     468,  471,  470,  474,  475,  469,  473,  477,  474,  481,
+     474,  474,  474,  474,  474,  474,  474,  474,  474,  474,
+     474,  474,  474,  474,  474,  474,  474,  474,  474,  474,
+     474,  474,  474,  474,  474,  474,  474,  474,  474,  474,
+     474,  474,  474,  476,  478,  479,  480,  482,  483,  484,
+     485,  486,  487,  488,  489,  490,  493,  496,  491,  492,
+     494,  495,  496,  494,  498,  499,  500,  501,  497,  502,
+     503,  504,  505,  512,  508,  506,  518,  507,  511,  510,
+
+     515,  509,  514,  513,  517,  516,  519,  521,  523,  529,
+     525,  522,  521,  526,  531,  524,  521,  527,  530,  533,
+     532,  528,  534,  539,  535,  537,  536,  538,  543,  540,
+     545,  544,  546,  541,  550,  542,  547,  551,  552,  548,
+     549,  553,  532,  555,  554,  559,  556,  560,  555,  557,
+     561,  562,  563,  567,  558,  558,  566,  564,  565,  569,
+     572,  566,  568,  571,  577,  570,  562,  576,  573,  584,
+     591,  579,  574,  578,  575,    0,  624,  580,  582,    0,
+     583,  592,  581,  595,  596,  607,  585,  586,  587,  588,
+     589,  594,  590,  593,  600,  597,  601,  599,  603,  602,
+
+     598,  604,  606,  605,  608,  612,  609,  611,  613,  615,
+     610,  618,  611,  614,  611,  611,  611,  611,  611,  611,
+     611,  611,  611,  611,  611,  611,  611,  611,  611,  611,
+     611,  611,  611,  611,  611,  611,  611,  611,  611,  611,
+     611,  611,  611,  611,  611,  611,  611,  616,  617,  619,
+     620,  621,  625,  623,  626,  627,  628,  619,  629,  631,
+     630,  632,  634,  634,  633,  642,  634,  643,  636,  634,
+     644,  639,  645,  646,  647,  649,  634,  650,  652,  634,
+     653,  648,  651,  651,  656,  651,  654,  657,  651,  658,
+     660,  655,  659,  651,  661,  662,  663,  665,  664,  651,
+
+     651,  666,  669,  673,  683,  667,  668,  676,  670,  672,
+     679,  680,  674,  682,  675,  671,  678,  684,  685,  686,
+     693,  677,  687,  690,  688,  689,  691,  696,  692,  694,
+     695,  701,  703,  699,  700,  704,  697,  702,  706,  711,
+     713,  705,  714,  709,    0,  716,  707,  711,    0,    0,
+       0,  708,  731,  723,    0,    0,  730,  722,  900,  710,
+     715,  725,  717,  726,  718,  719,  738,  721,  720,  724,
+     727,  728,  740,  729,  741,  732,  733,  734,  737,  742,
+     744,  736,  735,  739,  743,  745,  747,  748,  744,  749,
+     746,  750,  751,  752,  753,  754,  756,  757,  758,  755,
+
+     762,  759,  757,  760,  757,  757,  757,  757,  757,  757,
+     757,  757,  757,  757,  757,  757,  757,  757,  757,  757,
+     757,  757,  757,  757,  757,  757,  757,  757,  757,  757,
+     757,  757,  757,  757,  757,  757,  757,  761,  763,  766,
+     765,  768,  770,  769,  770,  771,  772,  773,  770,  774,
+     770,  775,  776,  777,  778,  770,  779,  780,  781,  782,
+     770,  779,  784,  785,  790,  783,  784,  786,  788,  789,
+     791,  782,  787,  792,  793,  794,  784,  795,  796,  797,
+     798,  800,  799,  796,  801,  796,  802,  803,  805,  808,
+     809,  811,  804,  815,  812,  806,  796,  796,  816,  821,
+
+     814,  807,  835,  796,  813,  818,  831,  817,  820,  819,
+     822,  824,  826,  823,  841,  825,  828,  829,  830,  837,
+     838,  833,  827,  839,  842,  840,  836,  846,  847,  834,
+     843,  847,  846,  854,  848,  845,  849,  852,  853,  851,
+     850,  856,  858,  868,  860,  855,  859,  857,  861,  862,
+     866,  865,  863,  867,  869,  870,  872,  877,  878,  879,
+     871,  880,  883,  887,  884,  876,  873,  885,  891,  874,
+     892,  875,  888,  893,  895,  882,  896,  886,  890,    0,
+     889,  907,  894,  915,  899,  898,  913,  902,  916,  897,
+     912,  901,  918,  917,  903,  942,  911,  909,  919,  908,
+
+     906,  910,  922,  925,  908,  904,  908,  908,  908,  908,
+     908,  908,  908,  908,  908,  908,  908,  908,  908,  908,
+     908,  908,  908,  908,  908,  908,  908,  908,  908,  908,
+     908,  908,  908,  908,  908,  908,  908,  908,  908,  914,
+     920,  921,  924,  923,  926,  928,  929,  931,  933,  927,
+     935,  930,  936,  937,  932,  938,  941,  933,  939,  933,
+     940,  944,  933,  943,  945,  947,  950,  951,  953,  946,
+     954, 1100,  948,  955,  952,  964,  956,  957,  960,  965,
+     958,  972,  961,  986,  959,  982,  963,  970,  974,  966,
+     976,  962,  999,  973,  977,  967,  968,  969,  978,  985,
+
+     980,  975,  979,  978,  981,  983,  984,  987,  983,  983,
+     988,  989,  990,  983,  991,  992,  993,  994,  996,  983,
+     995,  998,  997,  983, 1000, 1001, 1002, 1003, 1004, 1005,
+    1006, 1009, 1003, 1008, 1003, 1010, 1003, 1011, 1003, 1012,
+    1014, 1020, 1016, 1013, 1012, 1017, 1015, 1018, 1019, 1022,
+    1024, 1021, 1025, 1026, 1028, 1029, 1023, 1027, 1034, 1031,
+    1033, 1036, 1032, 1035, 1040, 1037, 1042, 1038, 1043, 1039,
+    1041, 1045, 1046, 1050, 1057, 1048, 1049, 1047, 1058, 1053,
+    1059, 1051, 1052, 1054, 1060, 1064, 1061, 1055, 1069, 1070,
+    1063, 1072,    0, 1078,    0,    0,    0, 1062,    0, 1073,
+
+    1075, 1065, 1067, 1076, 1082, 1073, 1068, 1074, 1083, 1077,
+    1085, 1089, 1088, 1079, 1090, 1095, 1081, 1088, 1091, 1096,
+    1087, 1080, 1092, 1084, 1094, 1093, 1097, 1094, 1093, 1099,
+    1101, 1102, 1106, 1112, 1103, 1105, 1108, 1104, 1110, 1107,
+    1111, 1113, 1115, 1114, 1118, 1116, 1119, 1117, 1121, 1120,
+    1122, 1123, 1124, 1126, 1125, 1127, 1128, 1129, 1130, 1131,
+    1133, 1132, 1134, 1135, 1136, 1139, 1138, 1140, 1141, 1143,
+    1145, 1142, 1144, 1146, 1149, 1151, 1148, 1152, 1147, 1153,
+    1151, 1154, 1152, 1150, 1158, 1161, 1162, 1174,    0, 1170,
+       0, 1155, 1156, 1157, 1171, 1160, 1163, 1164, 1173, 1165,
+
+    1167, 1159, 1175, 1166, 1169, 1172, 1168, 1176, 1178, 1177,
+    1179, 1181, 1182, 1185, 1179, 1186, 1183, 1184, 1192, 1187,
+    1188, 1190, 1189, 1195, 1191, 1193, 1198, 1179, 1197, 1199,
+    1200, 1202, 1204, 1205, 1206, 1211, 1209, 1208, 1212, 1215,
+    1210, 1218, 1213, 1216, 1217, 1214, 1219, 1220, 1221, 1226,
+    1223, 1230, 1228,    0, 1225, 1235, 1244,    0, 1246,    0,
+       0, 1222, 1236,    0, 1224, 1227, 1240, 1232, 1231, 1234,
+    1233, 1233, 1239, 1242, 1243, 1249, 1237, 1266, 1238, 1241,
+    1245, 1248, 1254, 1251, 1250, 1255, 1256, 1260, 1257, 1258,
+    1253, 1259, 1261, 1262, 1264, 1263, 1271, 1264, 1262, 1265,
+
+    1267, 1268, 1269, 1270, 1272, 1273, 1274, 1275, 1277, 1264,
+    1280, 1276, 1281, 1278, 1282, 1283, 1279, 1285, 1286, 1287,
+    1296, 1288, 1300, 1284, 1295, 1290, 1289, 1292, 1291, 1293,
+    1302, 1305, 1294, 1304,    0,    0,    0, 1297, 1299, 1324,
+    1306, 1307, 1298, 1303, 1310, 1312, 1313, 1320, 1311, 1313,
+    1309, 1321, 1314, 1308, 1316, 1326, 1322, 1330, 1325, 1316,
+    1329, 1319, 1323, 1327, 1328, 1318, 1331, 1328, 1334, 1332,
+    1333, 1341, 1335, 1337, 1340, 1336, 1342, 1343, 1344, 1339,
+    1345, 1346, 1347, 1348, 1346, 1350, 1352, 1349, 1354, 1353,
+    1350, 1355, 1356, 1357, 1345, 1360, 1358, 1361, 1362, 1363,
+
+    1367, 1364, 1369, 1368, 1372, 1377, 1370, 1364, 1379, 1371,
+    1417, 1382, 1384, 1373, 1374, 1376,    0, 1392, 1385, 1378,
+    1375, 1386, 1387, 1388, 1380, 1402,    0, 1383, 1406,    0,
+    1391, 1397, 1389, 1394, 1414, 1398, 1396, 1399, 1393, 1395,
+    1403, 1405, 1407, 1408, 1412, 1400, 1410, 1401, 1404, 1411,
+    1413, 1415, 1418, 1416, 1419, 1420, 1423, 1426, 1424, 1427,
+    1421, 1431, 1428, 1429, 1425, 1432, 1430, 1436, 1437, 1438,
+    1445, 1439, 1441, 1444, 1446, 1428, 1433, 1434, 1442, 1435,
+    1440, 1447, 1443, 1449, 1451, 1454, 1450, 1455, 1452, 1453,
+    1457, 1461, 1456, 1458, 1458, 1458, 1459, 1460, 1464, 1462,
+
+    1458, 1465, 1466, 1464, 1467, 1469, 1471, 1468, 1470, 1473,
+    1474, 1480, 1483, 1475, 1478, 1472, 1479, 1477, 1476, 1485,
+    1486, 1487, 1484, 1490, 1488, 1492, 1494, 1495, 1496, 1498,
+    1497, 1499, 1489, 1491, 1501, 1500, 1502, 1505, 1503, 1510,
+    1509, 1506, 1508, 1504, 1507, 1512, 1513, 1516, 1511, 1520,
+    1515, 1519, 1522, 1518, 1523, 1521, 1525, 1530, 1527, 1524,
+    1531, 1526, 1513, 1532, 1524, 1533, 1534, 1535, 1536, 1528,
+    1533, 1529, 1535, 1537, 1539, 1540, 1541, 1543, 1538, 1544,
+    1545, 1546, 1547, 1549, 1550, 1553, 1548, 1556, 1552, 1554,
+    1555, 1557, 1558, 1560, 1564, 1569, 1561, 1559, 1580, 1562,
+
+    1575, 1563, 1566, 1568, 1574, 1578, 1573, 1576, 1571, 1577,
+    1572, 1584, 1587,    0, 1585,    0, 1581, 1586, 1579, 1598,
+    1590,    0, 1592, 1605, 1593, 1588, 1582,    0, 1583, 1595,
+    1608, 1590, 1591, 1594, 1607, 1609, 1610, 1613, 1600, 1601,
+    1603, 1604, 1611, 1606, 1614, 1615, 1623, 1616, 1618, 1627,
+    1622, 1619, 1617, 1631, 1620, 1630, 1634, 1626, 1621, 1623,
+    1635, 1637, 1638, 1625, 1628, 1642, 1645, 1629, 1641, 1632,
+    1640, 1636, 1648, 1647, 1644, 1653, 1649, 1650, 1654, 1651,
+    1646, 1660, 1652, 1656, 1658, 1661, 1663, 1655, 1664, 1666,
+    1659, 1665, 1662, 1667, 1668, 1669, 1680, 1670, 1671, 1672,
+
+    1673, 1667, 1672, 1675, 1677, 1679, 1681, 1685, 1676, 1674,
+    1699, 1690,    0, 1683, 1691, 1699, 1693, 1689, 1695, 1701,
+    1703, 1686, 1684, 1687, 1700, 1709, 1697, 1702, 1705, 1693,
+    1706, 1696, 1707, 1704, 1708, 1710, 1711, 1712, 1698, 1708,
+    1717, 1716, 1713, 1718, 1719, 1720, 1722, 1721, 1723, 1725,
+    1727, 1724, 1726, 1729, 1717, 1731, 1730, 1733, 1735, 1742,
+    1739, 1738, 1765, 1734, 1738, 1717, 1736, 1737, 1743, 1738,
+    1745, 1748, 1749,    0, 1744, 1740, 1738, 1741, 1762, 1809,
+    1768, 1769, 1747, 1763, 1841, 1767, 1751, 1752, 1746, 1757,
+    1755, 1761, 1753, 1756, 1754, 1758, 1764, 1759, 1766, 1772,
+
+    1771, 1770, 1773, 1774, 1773, 1773, 1775, 1777, 1778, 1779,
+    1781, 1780, 1782, 1783, 1784, 1785, 1786, 1787, 1788, 1789,
+    1793, 1792, 1790, 1795, 1797, 1794, 1796, 1799, 1798, 1800,
+    1804, 1810, 1807, 1801, 1815, 1802, 1818, 1820, 1819,    0,
+       0, 1803, 1799, 1806, 1808, 1817, 1811, 1821, 1812, 1813,
+    1844, 1823, 1824, 1825, 1827, 1829, 1816, 1830, 1831, 1832,
+    1833, 1850, 1835, 1828, 1849, 1826, 1836, 1837, 1834, 1838,
+    1839, 1846, 1842, 1840, 1842, 1848, 1851, 1856, 1854, 1866,
+    1855, 1858, 1869, 1842, 1851, 1852, 1857, 1852, 1860, 1861,
+    1865, 1863, 1862, 1868, 1871, 1872, 1873, 1874, 1875, 1876,
+
+    1867, 1877, 1878, 1886, 1882, 1880, 1879, 1943, 1881, 1887,
+    1891, 1883, 1884, 1885, 1889, 1890, 1902, 1893, 1892, 1894,
+    1896, 1897, 1899, 1898, 1901, 1904, 1903, 1909, 1908, 1911,
+    1915, 1916, 1910, 1919, 1900, 1905, 1918, 1907, 1921, 1914,
+    1922, 1924, 1923, 1928, 1925, 1934, 1932, 1936, 1935, 1938,
+    1940, 1951, 1917, 1941, 1930, 1942, 1944, 1946, 1948, 1952,
+    1953, 1947, 1950, 1955, 1959, 1960, 1961, 1962, 1966, 1963,
+    1967, 1968, 1965, 1956, 1964, 1969, 1957, 1996, 1972, 1973,
+    1970, 1975, 1976, 1977,    0, 1974, 1978, 1979, 1971, 1986,
+    1982, 1980, 1985, 1987,    0, 1981, 2044, 1994, 1988,    0,
+
+       0, 1983, 2006, 2007,    0, 1991, 1995, 1984, 2002, 1993,
+       0, 1990, 2004, 1997, 2005, 2008, 1989, 1992, 1999, 2011,
+    2003, 2000, 2013, 2030, 2001, 2022, 2012, 2032, 2020, 2014,
+    2028,    0, 2015, 2017, 2018, 2021, 2025, 2019,    0, 2031,
+    2023, 2035, 2024, 2026, 2027, 2042, 2043, 2054, 2036, 2033,
+    2034, 2041, 2053, 2037, 2038, 2039, 2040, 2046, 2045, 2048,
+    2047, 2051, 2055, 2049, 2050, 2052, 2056, 2060, 2058, 2067,
+    2068, 2062, 2063, 2071, 2069, 2066, 2072, 2074, 2076, 2070,
+    2075, 2077, 2081, 2079, 2080, 2083, 2085, 2086, 2084, 2087,
+    2092, 2094, 2093, 2095, 2096, 2101, 2100, 2102, 2139, 2106,
+
+    2107, 2103, 2105, 2104, 2111, 2112, 2114, 2115, 2116, 2117,
+    2120, 2121, 2110, 2113, 2122, 2124, 2125, 2123, 2126, 2132,
+    2108, 2118, 2129, 2119, 2130, 2131, 2135, 2133, 2134, 2136,
+    2131, 2137, 2138, 2142, 2140, 2141, 2223, 2144, 2145, 2148,
+    2150, 2255, 2146, 2143, 2151, 2156, 2158, 2154, 2164, 2155,
+    2153, 2157, 2152, 2168, 2169, 2166, 2176, 2177,    0,    0,
+    2175, 2184, 2161, 2212, 2179, 2162, 2163, 2165, 2167, 2170,
+    2172, 2178, 2174, 2181, 2182, 2186, 2188, 2189, 2190, 2185,
+    2193, 2198, 2199, 2200, 2202, 2201, 2195, 2197, 2203, 2204,
+    2206, 2205, 2207, 2208, 2209, 2210, 2213, 2222, 2214, 2217,
+
+    2218, 2221, 2211, 2224, 2217, 2225, 2228, 2230, 2229, 2219,
+    2233, 2234, 2220, 2236, 2239, 2240,    0, 2244,    0, 2235,
+    2235, 2257, 2312, 2232, 2238, 2248, 2241, 2237, 2246, 2243,
+    2249, 2242, 2250, 2251, 2267, 2245, 2256, 2261, 2247, 2252,
+    2253, 2265, 2254, 2262, 2266, 2258, 2259, 2268, 2263, 2269,
+    2270, 2273, 2272, 2274, 2276, 2275, 2277, 2283, 2298, 2279,
+    2278, 2277, 2284, 2285, 2292, 2294, 2290, 2288, 2295, 2301,
+    2299, 2302, 2304, 2305, 2302, 2306, 2307, 2310, 2315, 2308,
+    2296, 2321, 2313, 2314, 2309, 2327, 2316, 2318, 2319, 2317,
+    2331, 2322,    0, 2320, 2326,    0, 2330, 2334, 2342, 2317,
+
+    2323, 2332, 2339, 2324, 2335, 2333, 2336, 2325, 2329, 2338,
+    2345, 2346, 2347, 2337, 2351, 2353, 2355, 2343, 2352, 2360,
+    2361, 2349, 2341, 2356, 2358, 2364, 2365, 2357, 2366, 2363,
+    2370, 2373, 2374, 2371, 2367, 2368, 2375, 2379, 2381, 2382,
+    2369, 2383, 2372, 2380, 2384, 2389, 2385, 2387, 2388, 2391,
+    2390, 2392, 2394, 2395, 2393, 2393, 2396, 2397, 2398, 2400,
+    2401, 2403, 2404, 2424, 2408, 2409, 2405, 2406, 2410, 2407,
+    2413, 2420, 2411, 2417, 2422, 2426, 2431, 2419, 2427, 2433,
+    2435, 2425, 2423, 2436,    0, 2432,    0,    0, 2430, 2440,
+       0,    0, 2442,    0, 2495, 2444,    0, 2441,    0, 2438,
+
+    2454, 2456, 2488, 2439, 2464, 2465, 2470, 2445, 2472, 2446,
+    2447, 2448, 2450, 2451, 2453, 2452, 2452, 2457, 2449, 2455,
+    2455, 2458, 2466, 2474, 2461, 2473, 2473, 2478, 2476, 2477,
+    2480, 2481, 2483, 2486, 2482, 2487, 2489, 2490, 2491, 2492,
+    2494, 2493, 2499, 2500, 2493, 2494, 2496, 2497, 2501, 2502,
+    2498, 2508, 2503, 2505, 2506, 2509, 2504, 2512, 2515, 2516,
+    2517, 2507, 2519, 2520, 2522, 2523, 2524, 2525, 2527, 2530,
+    2526, 2531, 2533, 2532, 2538, 2536, 2539, 2547, 2541,    0,
+    2534, 2537,    0, 2545, 2540, 2548, 2542, 2555,    0, 2559,
+       0,    0, 2543, 2544, 2566, 2546, 2565, 2549, 2549, 2568,
+
+    2564, 2561, 2599, 2580, 2558, 2567, 2560, 2571, 2585, 2587,
+    2582, 2563, 2574, 2589, 2572, 2569, 2576, 2573, 2577, 2578,
+    2586, 2588, 2575, 2579, 2579, 2581, 2584, 2583, 2590, 2593,
+    2595, 2594, 2591, 2596, 2598, 2592, 2600, 2604, 2602, 2603,
+    2605, 2597, 2601, 2606, 2608, 2616, 2607, 2618, 2617, 2611,
+    2621, 2622, 2609, 2613, 2619, 2620, 2625, 2623, 2626, 2628,
+    2629, 2624, 2630, 2627, 2634, 2636, 2640, 2635, 2632, 2631,
+    2639, 2645, 2642, 2643, 2646, 2638, 2647, 2641, 2651, 2656,
+    2658, 2644, 2657, 2660, 2665, 2671, 2661, 2648, 2649, 2650,
+    2653, 2655, 2654, 2662, 2663, 2664, 2652, 2666, 2667, 2669,
+
+    2673, 2672, 2674, 2668, 2676, 2678, 2681, 2685, 2686, 2690,
+    2692, 2708, 2694, 2677, 2683, 2679, 2680, 2688, 2682, 2687,
+    2698, 2684,    0, 2699, 2693, 2689, 2709, 2693, 2695, 2696,
+    2697, 2704, 2705, 2701, 2702, 2700, 2706, 2711, 2712, 2713,
+    2714, 2703, 2716, 2710, 2717, 2718, 2721, 2715, 2719, 2720,
+    2722, 2723, 2724, 2725, 2726, 2727, 2731, 2728, 2729, 2734,
+    2738, 2730,    0, 2732, 2733, 2741,    0, 2742, 2745, 2736,
+    2750, 2746, 2753, 2757, 2735, 2751, 2739, 2743, 2744, 2756,
+    2760, 2749, 2747, 2748, 2758, 2761, 2762, 2763, 2766, 2767,
+    2754, 2755, 2768, 2770, 2759, 2764, 2771, 2786, 2772, 2773,
+
+    2775, 2774, 2776, 2779, 2782, 2780, 2783, 2788, 2791, 2792,
+    2794, 2793, 2784, 2785, 2796, 2797, 2798, 2800, 2804, 2787,
+    2807, 2789, 2790, 2808, 2805, 2806, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866, 2866,
+    2866, 2866, 2866, 2866, 2866, 2866, 2866,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+       1,    1,    1,    1,    1,    1,    1,    1,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2, 2811,
+    2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811,
+    2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811,
+    2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811,
+    2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811, 2811,
+    2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812,
+
+    2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812,
+    2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812,
+    2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812, 2812,
+    2812, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813,
+    2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813,
+    2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813,
+    2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813, 2813,
+    2813, 2813, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
+    2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
+    2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
+
+    2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814, 2814,
+    2814, 2814, 2814, 2815, 2815, 2815, 2815, 2815, 2815, 2815,
+    2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815,
+    2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815,
+    2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815, 2815,
+    2815, 2815, 2815, 2815, 2816, 2816, 2816, 2816, 2816, 2816,
+    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
+    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
+    2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816, 2816,
+    2816, 2816, 2816, 2816, 2816, 2817, 2817, 2817, 2817, 2817,
+
+    2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817,
+    2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817,
+    2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817, 2817,
+    2817, 2817, 2817, 2817, 2817, 2817, 2818, 2818, 2818, 2818,
+    2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818,
+    2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818,
+    2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818, 2818,
+    2818, 2818, 2818, 2818, 2818, 2818, 2818, 2819, 2819, 2819,
+    2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819,
+    2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819,
+
+    2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819,
+    2819, 2819, 2819, 2819, 2819, 2819, 2819, 2819, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820,
+    2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2820, 2821,
+    2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+    2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+    2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+    2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821, 2821,
+
+    2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822,
+    2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822,
+    2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822,
+    2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822, 2822,
+    2822, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
+    2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
+    2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
+    2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823, 2823,
+    2823, 2823, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824,
+    2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824,
+
+    2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824,
+    2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824, 2824,
+    2824, 2824, 2824, 2825, 2825, 2825, 2825, 2825, 2825, 2825,
+    2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825,
+    2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825,
+    2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825, 2825,
+    2825, 2825, 2825, 2825, 2826, 2826, 2826, 2826, 2826, 2826,
+    2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826,
+    2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826,
+    2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826, 2826,
+
+    2826, 2826, 2826, 2826, 2826, 2827, 2827, 2827, 2827, 2827,
+    2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827,
+    2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827,
+    2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827, 2827,
+    2827, 2827, 2827, 2827, 2827, 2827,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2, 2828, 2828,
+    2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828,
+    2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828,
+    2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828,
+    2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2828, 2829,
+    2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+    2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+    2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+
+    2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829, 2829,
+    2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830,
+    2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830,
+    2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830,
+    2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830, 2830,
+    2830, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831,
+    2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831,
+    2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831,
+    2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831, 2831,
+    2831, 2831, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832,
+
+    2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832,
+    2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832,
+    2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832, 2832,
+    2832, 2832, 2832, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+    2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+    2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+    2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833, 2833,
+    2833, 2833, 2833, 2833, 2834, 2834, 2834, 2834, 2834, 2834,
+    2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834,
+    2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834,
+
+    2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834, 2834,
+    2834, 2834, 2834, 2834, 2834, 2835, 2835, 2835, 2835, 2835,
+    2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835,
+    2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835,
+    2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835, 2835,
+    2835, 2835, 2835, 2835, 2835, 2835, 2836, 2836, 2836, 2836,
+    2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836,
+    2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836,
+    2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836, 2836,
+    2836, 2836, 2836, 2836, 2836, 2836, 2836, 2837, 2837, 2837,
+
+    2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837,
+    2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837,
+    2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837,
+    2837, 2837, 2837, 2837, 2837, 2837, 2837, 2837, 2838, 2838,
+    2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838,
+    2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838,
+    2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838,
+    2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2838, 2839,
+    2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839,
+    2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839,
+
+    2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839,
+    2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839, 2839,
+    2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840,
+    2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840,
+    2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840,
+    2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840, 2840,
+    2840, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841,
+    2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841,
+    2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841,
+    2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841, 2841,
+
+    2841, 2841, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842,
+    2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842,
+    2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842,
+    2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842, 2842,
+    2842, 2842, 2842, 2843, 2843, 2843, 2843, 2843, 2843, 2843,
+    2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843,
+    2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843,
+    2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843, 2843,
+    2843, 2843, 2843, 2843, 2844, 2844, 2844, 2844, 2844, 2844,
+    2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844,
+
+    2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844,
+    2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844, 2844,
+    2844, 2844, 2844, 2844, 2844, 2845, 2845, 2845, 2845, 2845,
+    2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845,
+    2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845,
+    2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845, 2845,
+    2845, 2845, 2845, 2845, 2845, 2845, 2846, 2846, 2846, 2846,
+    2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846,
+    2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846,
+    2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846, 2846,
+
+    2846, 2846, 2846, 2846, 2846, 2846, 2846, 2847, 2847, 2847,
+    2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847,
+    2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847,
+    2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847,
+    2847, 2847, 2847, 2847, 2847, 2847, 2847, 2847, 2848, 2848,
+    2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,
+    2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,
+    2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,
+    2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848, 2848,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2,    2,    2,    2,    2,    2,    2,    2,    2,    2,
+       2, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849,
+    2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849,
+    2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849,
+
+    2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849, 2849,
+    2849, 2849, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850,
+    2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850,
+    2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850,
+    2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850, 2850,
+    2850, 2850, 2850, 2851, 2851, 2851, 2851, 2851, 2851, 2851,
+    2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851,
+    2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851,
+    2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851, 2851,
+    2851, 2851, 2851, 2851, 2852, 2852, 2852, 2852, 2852, 2852,
+
+    2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852,
+    2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852,
+    2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852, 2852,
+    2852, 2852, 2852, 2852, 2852, 2853, 2853, 2853, 2853, 2853,
+    2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853,
+    2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853,
+    2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853, 2853,
+    2853, 2853, 2853, 2853, 2853, 2853, 2854, 2854, 2854, 2854,
+    2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854,
+    2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854,
+
+    2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854, 2854,
+    2854, 2854, 2854, 2854, 2854, 2854, 2854, 2855, 2855, 2855,
+    2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855,
+    2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855,
+    2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855,
+    2855, 2855, 2855, 2855, 2855, 2855, 2855, 2855, 2856, 2856,
+    2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856,
+    2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856,
+    2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856,
+    2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2856, 2857,
+
+    2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857,
+    2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857,
+    2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857,
+    2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857, 2857,
+    2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858,
+    2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858,
+    2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858,
+    2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858, 2858,
+    2858, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859,
+    2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859,
+
+    2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859,
+    2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859, 2859,
+    2859, 2859, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860,
+    2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860,
+    2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860,
+    2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860, 2860,
+    2860, 2860, 2860, 2861, 2861, 2861, 2861, 2861, 2861, 2861,
+    2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861,
+    2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861,
+    2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861, 2861,
+
+    2861, 2861, 2861, 2861, 2862, 2862, 2862, 2862, 2862, 2862,
+    2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
+    2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
+    2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862, 2862,
+    2862, 2862, 2862, 2862, 2862, 2863, 2863, 2863, 2863, 2863,
+    2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863,
+    2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863,
+    2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863, 2863,
+    2863, 2863, 2863, 2863, 2863, 2863, 2864, 2864, 2864, 2864,
+    2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864,
+
+    2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864,
+    2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864, 2864,
+    2864, 2864, 2864, 2864, 2864, 2864, 2864, 2865, 2865, 2865,
+    2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865,
+    2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865,
+    2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865,
+    2865, 2865, 2865, 2865, 2865, 2865, 2865, 2865
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -2599,7 +3226,7 @@ static void config_end_include(void)
 #define YY_NO_INPUT 1
 #endif
 
-#line 2601 "<stdout>"
+#line 3230 "<stdout>"
 
 #define INITIAL 0
 #define quotedstring 1
@@ -2820,9 +3447,9 @@ YY_DECL
 		}
 
 	{
-#line 206 "./util/configlexer.lex"
+#line 207 "./util/configlexer.lex"
 
-#line 2824 "<stdout>"
+#line 3453 "<stdout>"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -2855,13 +3482,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 2563 )
+				if ( yy_current_state >= 2867 )
 					yy_c = yy_meta[(unsigned int) yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
 			++yy_cp;
 			}
-		while ( yy_base[yy_current_state] != 5015 );
+		while ( yy_base[yy_current_state] != 4927 );
 
 yy_find_action:
 		yy_act = yy_accept[yy_current_state];
@@ -2916,1212 +3543,1325 @@ YY_RULE_SETUP
 case 6:
 YY_RULE_SETUP
 #line 215 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_THREADS) }
+{ YDVAR(1, VAR_UPSTREAM_RACE) }
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
 #line 216 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERBOSITY) }
+{ YDVAR(1, VAR_UPSTREAM_RACE_DELAY) }
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
 #line 217 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PORT) }
+{ YDVAR(1, VAR_UPSTREAM_RACE_MAX) }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
 #line 218 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_RANGE) }
+{ YDVAR(1, VAR_UPSTREAM_RACE_BUDGET) }
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
 #line 219 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_PORT_PERMIT) }
+{ YDVAR(1, VAR_NUM_THREADS) }
 	YY_BREAK
 case 11:
 YY_RULE_SETUP
 #line 220 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_PORT_AVOID) }
+{ YDVAR(1, VAR_VERBOSITY) }
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
 #line 221 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_NUM_TCP) }
+{ YDVAR(1, VAR_PORT) }
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
 #line 222 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INCOMING_NUM_TCP) }
+{ YDVAR(1, VAR_OUTGOING_RANGE) }
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
 #line 223 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_IP4) }
+{ YDVAR(1, VAR_OUTGOING_PORT_PERMIT) }
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
 #line 224 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_IP6) }
+{ YDVAR(1, VAR_OUTGOING_PORT_AVOID) }
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
 #line 225 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFER_IP6) }
+{ YDVAR(1, VAR_OUTGOING_NUM_TCP) }
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
 #line 226 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_UDP) }
+{ YDVAR(1, VAR_INCOMING_NUM_TCP) }
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
 #line 227 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_TCP) }
+{ YDVAR(1, VAR_DO_IP4) }
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
 #line 228 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_UPSTREAM) }
+{ YDVAR(1, VAR_DO_IP6) }
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
 #line 229 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TCP_MSS) }
+{ YDVAR(1, VAR_PREFER_IP6) }
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
 #line 230 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_TCP_MSS) }
+{ YDVAR(1, VAR_DO_UDP) }
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
 #line 231 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_DO_TCP) }
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
 #line 232 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_TCP_UPSTREAM) }
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
 #line 233 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
+{ YDVAR(1, VAR_TCP_MSS) }
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
 #line 234 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
+{ YDVAR(1, VAR_OUTGOING_TCP_MSS) }
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
 #line 235 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
+{ YDVAR(1, VAR_SSL_UPSTREAM) }
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
 #line 236 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
+{ YDVAR(1, VAR_SSL_UPSTREAM) }
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
 #line 237 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_PORT) }
+{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
 #line 238 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SSL_PORT) }
+{ YDVAR(1, VAR_SSL_SERVICE_KEY) }
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
 #line 239 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_CERT_BUNDLE) }
+{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
 #line 240 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TLS_CERT_BUNDLE) }
+{ YDVAR(1, VAR_SSL_SERVICE_PEM) }
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
 #line 241 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADDITIONAL_TLS_PORT) }
+{ YDVAR(1, VAR_SSL_PORT) }
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
 #line 242 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADDITIONAL_TLS_PORT) }
+{ YDVAR(1, VAR_SSL_PORT) }
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
 #line 243 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSTEMD) }
+{ YDVAR(1, VAR_TLS_CERT_BUNDLE) }
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
 #line 244 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_DAEMONIZE) }
+{ YDVAR(1, VAR_TLS_CERT_BUNDLE) }
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
 #line 245 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_ADDITIONAL_TLS_PORT) }
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
 #line 246 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE) }
+{ YDVAR(1, VAR_ADDITIONAL_TLS_PORT) }
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
 #line 247 "./util/configlexer.lex"
-{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
+{ YDVAR(1, VAR_USE_SYSTEMD) }
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
 #line 248 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
+{ YDVAR(1, VAR_DO_DAEMONIZE) }
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
 #line 249 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_RCVBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
 #line 250 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_SNDBUF) }
+{ YDVAR(1, VAR_INTERFACE) }
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
 #line 251 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SO_REUSEPORT) }
+{ YDVAR(1, VAR_OUTGOING_INTERFACE) }
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
 #line 252 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_TRANSPARENT) }
+{ YDVAR(1, VAR_INTERFACE_AUTOMATIC) }
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
 #line 253 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IP_FREEBIND) }
+{ YDVAR(1, VAR_SO_RCVBUF) }
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
 #line 254 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CHROOT) }
+{ YDVAR(1, VAR_SO_SNDBUF) }
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
 #line 255 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USERNAME) }
+{ YDVAR(1, VAR_SO_REUSEPORT) }
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
 #line 256 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DIRECTORY) }
+{ YDVAR(1, VAR_IP_TRANSPARENT) }
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
 #line 257 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOGFILE) }
+{ YDVAR(1, VAR_IP_FREEBIND) }
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
 #line 258 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PIDFILE) }
+{ YDVAR(1, VAR_CHROOT) }
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
 #line 259 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ROOT_HINTS) }
+{ YDVAR(1, VAR_USERNAME) }
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
 #line 260 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
+{ YDVAR(1, VAR_DIRECTORY) }
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
 #line 261 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
+{ YDVAR(1, VAR_LOGFILE) }
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
 #line 262 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
+{ YDVAR(1, VAR_PIDFILE) }
 	YY_BREAK
 case 54:
 YY_RULE_SETUP
 #line 263 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
+{ YDVAR(1, VAR_ROOT_HINTS) }
 	YY_BREAK
 case 55:
 YY_RULE_SETUP
 #line 264 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
+{ YDVAR(1, VAR_EDNS_BUFFER_SIZE) }
 	YY_BREAK
 case 56:
 YY_RULE_SETUP
 #line 265 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
+{ YDVAR(1, VAR_MSG_BUFFER_SIZE) }
 	YY_BREAK
 case 57:
 YY_RULE_SETUP
 #line 266 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SIZE) }
 	YY_BREAK
 case 58:
 YY_RULE_SETUP
 #line 267 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_SLABS) }
 	YY_BREAK
 case 59:
 YY_RULE_SETUP
 #line 268 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CACHE_MIN_TTL) }
+{ YDVAR(1, VAR_MSG_CACHE_WIREFORMAT) }
 	YY_BREAK
 case 60:
 YY_RULE_SETUP
 #line 269 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_HOST_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SIZE) }
 	YY_BREAK
 case 61:
 YY_RULE_SETUP
 #line 270 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_LAME_TTL) }
+{ YDVAR(1, VAR_RRSET_CACHE_SLABS) }
 	YY_BREAK
 case 62:
 YY_RULE_SETUP
 #line 271 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
+{ YDVAR(1, VAR_CACHE_HUGE_PAGES) }
 	YY_BREAK
 case 63:
 YY_RULE_SETUP
 #line 272 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
+{ YDVAR(1, VAR_CACHE_MAX_TTL) }
 	YY_BREAK
 case 64:
 YY_RULE_SETUP
 #line 273 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
+{ YDVAR(1, VAR_CACHE_MAX_NEGATIVE_TTL) }
 	YY_BREAK
 case 65:
 YY_RULE_SETUP
 #line 274 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
+{ YDVAR(1, VAR_CACHE_MIN_TTL) }
 	YY_BREAK
 case 66:
 YY_RULE_SETUP
 #line 275 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
+{ YDVAR(1, VAR_INFRA_HOST_TTL) }
 	YY_BREAK
 case 67:
 YY_RULE_SETUP
 #line 276 "./util/configlexer.lex"
-{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
+{ YDVAR(1, VAR_INFRA_LAME_TTL) }
 	YY_BREAK
 case 68:
 YY_RULE_SETUP
 #line 277 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DELAY_CLOSE) }
+{ YDVAR(1, VAR_INFRA_CACHE_SLABS) }
 	YY_BREAK
 case 69:
 YY_RULE_SETUP
 #line 278 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
+{ YDVAR(1, VAR_INFRA_CACHE_NUMHOSTS) }
 	YY_BREAK
 case 70:
 YY_RULE_SETUP
 #line 279 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
+{ YDVAR(1, VAR_INFRA_CACHE_LAME_SIZE) }
 	YY_BREAK
 case 71:
 YY_RULE_SETUP
 #line 280 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
+{ YDVAR(1, VAR_INFRA_CACHE_MIN_RTT) }
 	YY_BREAK
 case 72:
 YY_RULE_SETUP
 #line 281 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_GLUE) }
+{ YDVAR(1, VAR_NUM_QUERIES_PER_THREAD) }
 	YY_BREAK
 case 73:
 YY_RULE_SETUP
 #line 282 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
+{ YDVAR(1, VAR_JOSTLE_TIMEOUT) }
 	YY_BREAK
 case 74:
 YY_RULE_SETUP
 #line 283 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
+{ YDVAR(1, VAR_DELAY_CLOSE) }
 	YY_BREAK
 case 75:
 YY_RULE_SETUP
 #line 284 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
+{ YDVAR(1, VAR_TARGET_FETCH_POLICY) }
 	YY_BREAK
 case 76:
 YY_RULE_SETUP
 #line 285 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
+{ YDVAR(1, VAR_HARDEN_SHORT_BUFSIZE) }
 	YY_BREAK
 case 77:
 YY_RULE_SETUP
 #line 286 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
+{ YDVAR(1, VAR_HARDEN_LARGE_QUERIES) }
 	YY_BREAK
 case 78:
 YY_RULE_SETUP
 #line 287 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CAPS_WHITELIST) }
+{ YDVAR(1, VAR_HARDEN_GLUE) }
 	YY_BREAK
 case 79:
 YY_RULE_SETUP
 #line 288 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
+{ YDVAR(1, VAR_HARDEN_DNSSEC_STRIPPED) }
 	YY_BREAK
 case 80:
 YY_RULE_SETUP
 #line 289 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
+{ YDVAR(1, VAR_HARDEN_BELOW_NXDOMAIN) }
 	YY_BREAK
 case 81:
 YY_RULE_SETUP
 #line 290 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
+{ YDVAR(1, VAR_HARDEN_REFERRAL_PATH) }
 	YY_BREAK
 case 82:
 YY_RULE_SETUP
 #line 291 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH_KEY) }
+{ YDVAR(1, VAR_HARDEN_ALGO_DOWNGRADE) }
 	YY_BREAK
 case 83:
 YY_RULE_SETUP
 #line 292 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PREFETCH) }
+{ YDVAR(1, VAR_USE_CAPS_FOR_ID) }
 	YY_BREAK
 case 84:
 YY_RULE_SETUP
 #line 293 "./util/configlexer.lex"
-{ YDVAR(0, VAR_STUB_ZONE) }
+{ YDVAR(1, VAR_CAPS_WHITELIST) }
 	YY_BREAK
 case 85:
 YY_RULE_SETUP
 #line 294 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NAME) }
+{ YDVAR(1, VAR_UNWANTED_REPLY_THRESHOLD) }
 	YY_BREAK
 case 86:
 YY_RULE_SETUP
 #line 295 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_ADDR) }
+{ YDVAR(1, VAR_PRIVATE_ADDRESS) }
 	YY_BREAK
 case 87:
 YY_RULE_SETUP
 #line 296 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_HOST) }
+{ YDVAR(1, VAR_PRIVATE_DOMAIN) }
 	YY_BREAK
 case 88:
 YY_RULE_SETUP
 #line 297 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_PRIME) }
+{ YDVAR(1, VAR_PREFETCH_KEY) }
 	YY_BREAK
 case 89:
 YY_RULE_SETUP
 #line 298 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_FIRST) }
+{ YDVAR(1, VAR_PREFETCH) }
 	YY_BREAK
 case 90:
 YY_RULE_SETUP
 #line 299 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(0, VAR_STUB_ZONE) }
 	YY_BREAK
 case 91:
 YY_RULE_SETUP
 #line 300 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_NAME) }
 	YY_BREAK
 case 92:
 YY_RULE_SETUP
 #line 301 "./util/configlexer.lex"
-{ YDVAR(0, VAR_FORWARD_ZONE) }
+{ YDVAR(1, VAR_STUB_ADDR) }
 	YY_BREAK
 case 93:
 YY_RULE_SETUP
 #line 302 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_ADDR) }
+{ YDVAR(1, VAR_STUB_HOST) }
 	YY_BREAK
 case 94:
 YY_RULE_SETUP
 #line 303 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_HOST) }
+{ YDVAR(1, VAR_STUB_PRIME) }
 	YY_BREAK
 case 95:
 YY_RULE_SETUP
 #line 304 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_FIRST) }
+{ YDVAR(1, VAR_STUB_FIRST) }
 	YY_BREAK
 case 96:
 YY_RULE_SETUP
 #line 305 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 97:
 YY_RULE_SETUP
 #line 306 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
+{ YDVAR(1, VAR_STUB_SSL_UPSTREAM) }
 	YY_BREAK
 case 98:
 YY_RULE_SETUP
 #line 307 "./util/configlexer.lex"
-{ YDVAR(0, VAR_AUTH_ZONE) }
+{ YDVAR(0, VAR_FORWARD_ZONE) }
 	YY_BREAK
 case 99:
 YY_RULE_SETUP
 #line 308 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ZONEFILE) }
+{ YDVAR(1, VAR_FORWARD_ADDR) }
 	YY_BREAK
 case 100:
 YY_RULE_SETUP
 #line 309 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MASTER) }
+{ YDVAR(1, VAR_FORWARD_HOST) }
 	YY_BREAK
 case 101:
 YY_RULE_SETUP
 #line 310 "./util/configlexer.lex"
-{ YDVAR(1, VAR_URL) }
+{ YDVAR(1, VAR_FORWARD_FIRST) }
 	YY_BREAK
 case 102:
 YY_RULE_SETUP
 #line 311 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 103:
 YY_RULE_SETUP
 #line 312 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FOR_UPSTREAM) }
+{ YDVAR(1, VAR_FORWARD_SSL_UPSTREAM) }
 	YY_BREAK
 case 104:
 YY_RULE_SETUP
 #line 313 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FALLBACK_ENABLED) }
+{ YDVAR(0, VAR_AUTH_ZONE) }
 	YY_BREAK
 case 105:
 YY_RULE_SETUP
 #line 314 "./util/configlexer.lex"
-{ YDVAR(0, VAR_VIEW) }
+{ YDVAR(1, VAR_ZONEFILE) }
 	YY_BREAK
 case 106:
 YY_RULE_SETUP
 #line 315 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VIEW_FIRST) }
+{ YDVAR(1, VAR_MASTER) }
 	YY_BREAK
 case 107:
 YY_RULE_SETUP
 #line 316 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
+{ YDVAR(1, VAR_URL) }
 	YY_BREAK
 case 108:
 YY_RULE_SETUP
 #line 317 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
+{ YDVAR(1, VAR_FOR_DOWNSTREAM) }
 	YY_BREAK
 case 109:
 YY_RULE_SETUP
 #line 318 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL) }
+{ YDVAR(1, VAR_FOR_UPSTREAM) }
 	YY_BREAK
 case 110:
 YY_RULE_SETUP
 #line 319 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
+{ YDVAR(1, VAR_FALLBACK_ENABLED) }
 	YY_BREAK
 case 111:
 YY_RULE_SETUP
 #line 320 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
+{ YDVAR(0, VAR_VIEW) }
 	YY_BREAK
 case 112:
 YY_RULE_SETUP
 #line 321 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
+{ YDVAR(1, VAR_VIEW_FIRST) }
 	YY_BREAK
 case 113:
 YY_RULE_SETUP
 #line 322 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_ADDRESS) }
 	YY_BREAK
 case 114:
 YY_RULE_SETUP
 #line 323 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
+{ YDVAR(1, VAR_DO_NOT_QUERY_LOCALHOST) }
 	YY_BREAK
 case 115:
 YY_RULE_SETUP
 #line 324 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
+{ YDVAR(2, VAR_ACCESS_CONTROL) }
 	YY_BREAK
 case 116:
 YY_RULE_SETUP
 #line 325 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_IDENTITY) }
+{ YDVAR(1, VAR_SEND_CLIENT_SUBNET) }
 	YY_BREAK
 case 117:
 YY_RULE_SETUP
 #line 326 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_VERSION) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ZONE) }
 	YY_BREAK
 case 118:
 YY_RULE_SETUP
 #line 327 "./util/configlexer.lex"
-{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_ALWAYS_FORWARD) }
 	YY_BREAK
 case 119:
 YY_RULE_SETUP
 #line 328 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IDENTITY) }
+{ YDVAR(1, VAR_CLIENT_SUBNET_OPCODE) }
 	YY_BREAK
 case 120:
 YY_RULE_SETUP
 #line 329 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VERSION) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV4) }
 	YY_BREAK
 case 121:
 YY_RULE_SETUP
 #line 330 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MODULE_CONF) }
+{ YDVAR(1, VAR_MAX_CLIENT_SUBNET_IPV6) }
 	YY_BREAK
 case 122:
 YY_RULE_SETUP
 #line 331 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR) }
+{ YDVAR(1, VAR_HIDE_IDENTITY) }
 	YY_BREAK
 case 123:
 YY_RULE_SETUP
 #line 332 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
+{ YDVAR(1, VAR_HIDE_VERSION) }
 	YY_BREAK
 case 124:
 YY_RULE_SETUP
 #line 333 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_HIDE_TRUSTANCHOR) }
 	YY_BREAK
 case 125:
 YY_RULE_SETUP
 #line 334 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
+{ YDVAR(1, VAR_IDENTITY) }
 	YY_BREAK
 case 126:
 YY_RULE_SETUP
 #line 335 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
+{ YDVAR(1, VAR_VERSION) }
 	YY_BREAK
 case 127:
 YY_RULE_SETUP
 #line 336 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR) }
+{ YDVAR(1, VAR_MODULE_CONF) }
 	YY_BREAK
 case 128:
 YY_RULE_SETUP
 #line 337 "./util/configlexer.lex"
-{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
+{ YDVAR(1, VAR_DLV_ANCHOR) }
 	YY_BREAK
 case 129:
 YY_RULE_SETUP
 #line 338 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
+{ YDVAR(1, VAR_DLV_ANCHOR_FILE) }
 	YY_BREAK
 case 130:
 YY_RULE_SETUP
 #line 339 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 131:
 YY_RULE_SETUP
 #line 340 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
+{ YDVAR(1, VAR_AUTO_TRUST_ANCHOR_FILE) }
 	YY_BREAK
 case 132:
 YY_RULE_SETUP
 #line 341 "./util/configlexer.lex"
-{ YDVAR(1, VAR_BOGUS_TTL) }
+{ YDVAR(1, VAR_TRUSTED_KEYS_FILE) }
 	YY_BREAK
 case 133:
 YY_RULE_SETUP
 #line 342 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
+{ YDVAR(1, VAR_TRUST_ANCHOR) }
 	YY_BREAK
 case 134:
 YY_RULE_SETUP
 #line 343 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
+{ YDVAR(1, VAR_TRUST_ANCHOR_SIGNALING) }
 	YY_BREAK
 case 135:
 YY_RULE_SETUP
 #line 344 "./util/configlexer.lex"
-{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
+{ YDVAR(1, VAR_VAL_OVERRIDE_DATE) }
 	YY_BREAK
 case 136:
 YY_RULE_SETUP
 #line 345 "./util/configlexer.lex"
-{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MIN) }
 	YY_BREAK
 case 137:
 YY_RULE_SETUP
 #line 346 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVE_EXPIRED) }
+{ YDVAR(1, VAR_VAL_SIG_SKEW_MAX) }
 	YY_BREAK
 case 138:
 YY_RULE_SETUP
 #line 347 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_DSA) }
+{ YDVAR(1, VAR_BOGUS_TTL) }
 	YY_BREAK
 case 139:
 YY_RULE_SETUP
 #line 348 "./util/configlexer.lex"
-{ YDVAR(1, VAR_FAKE_SHA1) }
+{ YDVAR(1, VAR_VAL_CLEAN_ADDITIONAL) }
 	YY_BREAK
 case 140:
 YY_RULE_SETUP
 #line 349 "./util/configlexer.lex"
-{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
+{ YDVAR(1, VAR_VAL_PERMISSIVE_MODE) }
 	YY_BREAK
 case 141:
 YY_RULE_SETUP
 #line 350 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
+{ YDVAR(1, VAR_AGGRESSIVE_NSEC) }
 	YY_BREAK
 case 142:
 YY_RULE_SETUP
 #line 351 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
+{ YDVAR(1, VAR_IGNORE_CD_FLAG) }
 	YY_BREAK
 case 143:
 YY_RULE_SETUP
 #line 352 "./util/configlexer.lex"
-{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
+{ YDVAR(1, VAR_SERVE_EXPIRED) }
 	YY_BREAK
 case 144:
 YY_RULE_SETUP
 #line 353 "./util/configlexer.lex"
-{ 
-				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
+{ YDVAR(1, VAR_FAKE_DSA) }
 	YY_BREAK
 case 145:
 YY_RULE_SETUP
-#line 355 "./util/configlexer.lex"
-{ YDVAR(1, VAR_ADD_HOLDDOWN) }
+#line 354 "./util/configlexer.lex"
+{ YDVAR(1, VAR_FAKE_SHA1) }
 	YY_BREAK
 case 146:
 YY_RULE_SETUP
-#line 356 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEL_HOLDDOWN) }
+#line 355 "./util/configlexer.lex"
+{ YDVAR(1, VAR_VAL_LOG_LEVEL) }
 	YY_BREAK
 case 147:
 YY_RULE_SETUP
-#line 357 "./util/configlexer.lex"
-{ YDVAR(1, VAR_KEEP_MISSING) }
+#line 356 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SIZE) }
 	YY_BREAK
 case 148:
 YY_RULE_SETUP
-#line 358 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
+#line 357 "./util/configlexer.lex"
+{ YDVAR(1, VAR_KEY_CACHE_SLABS) }
 	YY_BREAK
 case 149:
 YY_RULE_SETUP
-#line 359 "./util/configlexer.lex"
-{ YDVAR(1, VAR_USE_SYSLOG) }
+#line 358 "./util/configlexer.lex"
+{ YDVAR(1, VAR_NEG_CACHE_SIZE) }
 	YY_BREAK
 case 150:
 YY_RULE_SETUP
-#line 360 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_IDENTITY) }
+#line 359 "./util/configlexer.lex"
+{ 
+				  YDVAR(1, VAR_VAL_NSEC3_KEYSIZE_ITERATIONS) }
 	YY_BREAK
 case 151:
 YY_RULE_SETUP
 #line 361 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_TIME_ASCII) }
+{ YDVAR(1, VAR_ADD_HOLDDOWN) }
 	YY_BREAK
 case 152:
 YY_RULE_SETUP
 #line 362 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_QUERIES) }
+{ YDVAR(1, VAR_DEL_HOLDDOWN) }
 	YY_BREAK
 case 153:
 YY_RULE_SETUP
 #line 363 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOG_REPLIES) }
+{ YDVAR(1, VAR_KEEP_MISSING) }
 	YY_BREAK
 case 154:
 YY_RULE_SETUP
 #line 364 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE) }
+{ YDVAR(1, VAR_PERMIT_SMALL_HOLDDOWN) }
 	YY_BREAK
 case 155:
 YY_RULE_SETUP
 #line 365 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA) }
+{ YDVAR(1, VAR_USE_SYSLOG) }
 	YY_BREAK
 case 156:
 YY_RULE_SETUP
 #line 366 "./util/configlexer.lex"
-{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
+{ YDVAR(1, VAR_LOG_IDENTITY) }
 	YY_BREAK
 case 157:
 YY_RULE_SETUP
 #line 367 "./util/configlexer.lex"
-{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
+{ YDVAR(1, VAR_LOG_TIME_ASCII) }
 	YY_BREAK
 case 158:
 YY_RULE_SETUP
 #line 368 "./util/configlexer.lex"
-{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
+{ YDVAR(1, VAR_LOG_QUERIES) }
 	YY_BREAK
 case 159:
 YY_RULE_SETUP
 #line 369 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
+{ YDVAR(1, VAR_LOG_REPLIES) }
 	YY_BREAK
 case 160:
 YY_RULE_SETUP
 #line 370 "./util/configlexer.lex"
-{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
+{ YDVAR(1, VAR_LOG_MODULE_TIME) }
 	YY_BREAK
 case 161:
 YY_RULE_SETUP
 #line 371 "./util/configlexer.lex"
-{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
+{ YDVAR(2, VAR_LOCAL_ZONE) }
 	YY_BREAK
 case 162:
 YY_RULE_SETUP
 #line 372 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_ENABLE) }
+{ YDVAR(1, VAR_LOCAL_DATA) }
 	YY_BREAK
 case 163:
 YY_RULE_SETUP
 #line 373 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SHM_KEY) }
+{ YDVAR(1, VAR_LOCAL_DATA_PTR) }
 	YY_BREAK
 case 164:
 YY_RULE_SETUP
 #line 374 "./util/configlexer.lex"
-{ YDVAR(0, VAR_REMOTE_CONTROL) }
+{ YDVAR(1, VAR_UNBLOCK_LAN_ZONES) }
 	YY_BREAK
 case 165:
 YY_RULE_SETUP
 #line 375 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_ENABLE) }
+{ YDVAR(1, VAR_INSECURE_LAN_ZONES) }
 	YY_BREAK
 case 166:
 YY_RULE_SETUP
 #line 376 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_INTERFACE) }
+{ YDVAR(1, VAR_STATISTICS_INTERVAL) }
 	YY_BREAK
 case 167:
 YY_RULE_SETUP
 #line 377 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_PORT) }
+{ YDVAR(1, VAR_STATISTICS_CUMULATIVE) }
 	YY_BREAK
 case 168:
 YY_RULE_SETUP
 #line 378 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_USE_CERT) }
+{ YDVAR(1, VAR_HEAVY_HITTERS_SIZE) }
 	YY_BREAK
 case 169:
 YY_RULE_SETUP
 #line 379 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_KEY_FILE) }
+{ YDVAR(1, VAR_EXTENDED_STATISTICS) }
 	YY_BREAK
 case 170:
 YY_RULE_SETUP
 #line 380 "./util/configlexer.lex"
-{ YDVAR(1, VAR_SERVER_CERT_FILE) }
+{ YDVAR(1, VAR_SHM_ENABLE) }
 	YY_BREAK
 case 171:
 YY_RULE_SETUP
 #line 381 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
+{ YDVAR(1, VAR_SHM_KEY) }
 	YY_BREAK
 case 172:
 YY_RULE_SETUP
 #line 382 "./util/configlexer.lex"
-{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
+{ YDVAR(0, VAR_REMOTE_CONTROL) }
 	YY_BREAK
 case 173:
 YY_RULE_SETUP
 #line 383 "./util/configlexer.lex"
-{ YDVAR(1, VAR_PYTHON_SCRIPT) }
+{ YDVAR(1, VAR_CONTROL_ENABLE) }
 	YY_BREAK
 case 174:
 YY_RULE_SETUP
 #line 384 "./util/configlexer.lex"
-{ YDVAR(0, VAR_PYTHON) }
+{ YDVAR(1, VAR_CONTROL_INTERFACE) }
 	YY_BREAK
 case 175:
 YY_RULE_SETUP
 #line 385 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DOMAIN_INSECURE) }
+{ YDVAR(1, VAR_CONTROL_PORT) }
 	YY_BREAK
 case 176:
 YY_RULE_SETUP
 #line 386 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+{ YDVAR(1, VAR_CONTROL_USE_CERT) }
 	YY_BREAK
 case 177:
 YY_RULE_SETUP
 #line 387 "./util/configlexer.lex"
-{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+{ YDVAR(1, VAR_SERVER_KEY_FILE) }
 	YY_BREAK
 case 178:
 YY_RULE_SETUP
 #line 388 "./util/configlexer.lex"
-{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+{ YDVAR(1, VAR_SERVER_CERT_FILE) }
 	YY_BREAK
 case 179:
 YY_RULE_SETUP
 #line 389 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_PREFIX) }
+{ YDVAR(1, VAR_CONTROL_KEY_FILE) }
 	YY_BREAK
 case 180:
 YY_RULE_SETUP
 #line 390 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+{ YDVAR(1, VAR_CONTROL_CERT_FILE) }
 	YY_BREAK
 case 181:
 YY_RULE_SETUP
 #line 391 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DEFINE_TAG) }
+{ YDVAR(1, VAR_PYTHON_SCRIPT) }
 	YY_BREAK
 case 182:
 YY_RULE_SETUP
 #line 392 "./util/configlexer.lex"
-{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+{ YDVAR(0, VAR_PYTHON) }
 	YY_BREAK
 case 183:
 YY_RULE_SETUP
 #line 393 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+{ YDVAR(1, VAR_DOMAIN_INSECURE) }
 	YY_BREAK
 case 184:
 YY_RULE_SETUP
 #line 394 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MINIMAL_RESPONSES) }
+	YY_BREAK
+case 185:
+YY_RULE_SETUP
+#line 395 "./util/configlexer.lex"
+{ YDVAR(1, VAR_RRSET_ROUNDROBIN) }
+	YY_BREAK
+case 186:
+YY_RULE_SETUP
+#line 396 "./util/configlexer.lex"
+{ YDVAR(1, VAR_MAX_UDP_SIZE) }
+	YY_BREAK
+case 187:
+YY_RULE_SETUP
+#line 397 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_PREFIX) }
+	YY_BREAK
+case 188:
+YY_RULE_SETUP
+#line 398 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNS64_SYNTHALL) }
+	YY_BREAK
+case 189:
+YY_RULE_SETUP
+#line 399 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DEFINE_TAG) }
+	YY_BREAK
+case 190:
+YY_RULE_SETUP
+#line 400 "./util/configlexer.lex"
+{ YDVAR(2, VAR_LOCAL_ZONE_TAG) }
+	YY_BREAK
+case 191:
+YY_RULE_SETUP
+#line 401 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_TAG) }
+	YY_BREAK
+case 192:
+YY_RULE_SETUP
+#line 402 "./util/configlexer.lex"
 { YDVAR(3, VAR_ACCESS_CONTROL_TAG_ACTION) }
 	YY_BREAK
-case 185:
+case 193:
+YY_RULE_SETUP
+#line 403 "./util/configlexer.lex"
+{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+	YY_BREAK
+case 194:
+YY_RULE_SETUP
+#line 404 "./util/configlexer.lex"
+{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+	YY_BREAK
+case 195:
+YY_RULE_SETUP
+#line 405 "./util/configlexer.lex"
+{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+	YY_BREAK
+case 196:
+YY_RULE_SETUP
+#line 406 "./util/configlexer.lex"
+{ YDVAR(0, VAR_DNSTAP) }
+	YY_BREAK
+case 197:
+YY_RULE_SETUP
+#line 407 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+	YY_BREAK
+case 198:
+YY_RULE_SETUP
+#line 408 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+	YY_BREAK
+case 199:
+YY_RULE_SETUP
+#line 409 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+	YY_BREAK
+case 200:
+YY_RULE_SETUP
+#line 410 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+	YY_BREAK
+case 201:
+YY_RULE_SETUP
+#line 411 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+	YY_BREAK
+case 202:
+YY_RULE_SETUP
+#line 412 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_VERSION) }
+	YY_BREAK
+case 203:
+YY_RULE_SETUP
+#line 413 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+	YY_BREAK
+case 204:
+YY_RULE_SETUP
+#line 415 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
+	YY_BREAK
+case 205:
 YY_RULE_SETUP
-#line 395 "./util/configlexer.lex"
-{ YDVAR(3, VAR_ACCESS_CONTROL_TAG_DATA) }
+#line 417 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 186:
+case 206:
 YY_RULE_SETUP
-#line 396 "./util/configlexer.lex"
-{ YDVAR(2, VAR_ACCESS_CONTROL_VIEW) }
+#line 419 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 187:
+case 207:
 YY_RULE_SETUP
-#line 397 "./util/configlexer.lex"
-{ YDVAR(3, VAR_LOCAL_ZONE_OVERRIDE) }
+#line 421 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 188:
+case 208:
 YY_RULE_SETUP
-#line 398 "./util/configlexer.lex"
-{ YDVAR(0, VAR_DNSTAP) }
+#line 423 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 189:
+case 209:
 YY_RULE_SETUP
-#line 399 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_ENABLE) }
+#line 425 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_IP) }
 	YY_BREAK
-case 190:
+case 210:
 YY_RULE_SETUP
-#line 400 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SOCKET_PATH) }
+#line 426 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_FILE) }
 	YY_BREAK
-case 191:
+case 211:
 YY_RULE_SETUP
-#line 401 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_IDENTITY) }
+#line 427 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_FILE_ROTATE_SIZE) }
 	YY_BREAK
-case 192:
+case 212:
 YY_RULE_SETUP
-#line 402 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_SEND_VERSION) }
+#line 428 "./util/configlexer.lex"
+{ YDVAR(1, VAR_DNSTAP_RING_SIZE) }
 	YY_BREAK
-case 193:
+case 213:
 YY_RULE_SETUP
-#line 403 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_IDENTITY) }
+#line 429 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_FILE_ROTATE_INTERVAL) }
 	YY_BREAK
-case 194:
+case 214:
 YY_RULE_SETUP
-#line 404 "./util/configlexer.lex"
-{ YDVAR(1, VAR_DNSTAP_VERSION) }
+#line 431 "./util/configlexer.lex"
+{
+		YDVAR(1, VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES) }
 	YY_BREAK
-case 195:
+case 215:
 YY_RULE_SETUP
-#line 405 "./util/configlexer.lex"
+#line 433 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 196:
+case 216:
 YY_RULE_SETUP
-#line 407 "./util/configlexer.lex"
+#line 435 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES) }
 	YY_BREAK
-case 197:
+case 217:
 YY_RULE_SETUP
-#line 409 "./util/configlexer.lex"
+#line 437 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 198:
+case 218:
 YY_RULE_SETUP
-#line 411 "./util/configlexer.lex"
+#line 439 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES) }
 	YY_BREAK
-case 199:
+case 219:
 YY_RULE_SETUP
-#line 413 "./util/configlexer.lex"
+#line 441 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES) }
 	YY_BREAK
-case 200:
+case 220:
 YY_RULE_SETUP
-#line 415 "./util/configlexer.lex"
+#line 443 "./util/configlexer.lex"
 {
-		YDVAR(1, VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES) }
+		YDVAR(1, VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL) }
 	YY_BREAK
-case 201:
+case 221:
 YY_RULE_SETUP
-#line 417 "./util/configlexer.lex"
+#line 445 "./util/configlexer.lex"
 { YDVAR(1, VAR_DISABLE_DNSSEC_LAME_CHECK) }
 	YY_BREAK
-case 202:
+case 222:
 YY_RULE_SETUP
-#line 418 "./util/configlexer.lex"
+#line 446 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT) }
 	YY_BREAK
-case 203:
+case 223:
 YY_RULE_SETUP
-#line 419 "./util/configlexer.lex"
+#line 447 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT) }
 	YY_BREAK
-case 204:
+case 224:
 YY_RULE_SETUP
-#line 420 "./util/configlexer.lex"
+#line 448 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SLABS) }
 	YY_BREAK
-case 205:
+case 225:
 YY_RULE_SETUP
-#line 421 "./util/configlexer.lex"
+#line 449 "./util/configlexer.lex"
+{ YDVAR(1, VAR_IP_RATELIMIT_SKETCH) }
+	YY_BREAK
+case 226:
+YY_RULE_SETUP
+#line 450 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SLABS) }
 	YY_BREAK
-case 206:
+case 227:
 YY_RULE_SETUP
-#line 422 "./util/configlexer.lex"
+#line 451 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_SIZE) }
 	YY_BREAK
-case 207:
+case 228:
 YY_RULE_SETUP
-#line 423 "./util/configlexer.lex"
+#line 452 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_SIZE) }
 	YY_BREAK
-case 208:
+case 229:
 YY_RULE_SETUP
-#line 424 "./util/configlexer.lex"
+#line 453 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_FOR_DOMAIN) }
 	YY_BREAK
-case 209:
+case 230:
 YY_RULE_SETUP
-#line 425 "./util/configlexer.lex"
+#line 454 "./util/configlexer.lex"
 { YDVAR(2, VAR_RATELIMIT_BELOW_DOMAIN) }
 	YY_BREAK
-case 210:
+case 231:
 YY_RULE_SETUP
-#line 426 "./util/configlexer.lex"
+#line 455 "./util/configlexer.lex"
 { YDVAR(1, VAR_IP_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 211:
+case 232:
 YY_RULE_SETUP
-#line 427 "./util/configlexer.lex"
+#line 456 "./util/configlexer.lex"
 { YDVAR(1, VAR_RATELIMIT_FACTOR) }
 	YY_BREAK
-case 212:
+case 233:
 YY_RULE_SETUP
-#line 428 "./util/configlexer.lex"
+#line 457 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_TAG) }
 	YY_BREAK
-case 213:
+case 234:
 YY_RULE_SETUP
-#line 429 "./util/configlexer.lex"
+#line 458 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP) }
 	YY_BREAK
-case 214:
+case 235:
 YY_RULE_SETUP
-#line 430 "./util/configlexer.lex"
+#line 459 "./util/configlexer.lex"
 { YDVAR(2, VAR_RESPONSE_IP_DATA) }
 	YY_BREAK
-case 215:
+case 236:
 YY_RULE_SETUP
-#line 431 "./util/configlexer.lex"
+#line 460 "./util/configlexer.lex"
 { YDVAR(0, VAR_DNSCRYPT) }
 	YY_BREAK
-case 216:
+case 237:
 YY_RULE_SETUP
-#line 432 "./util/configlexer.lex"
+#line 461 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_ENABLE) }
 	YY_BREAK
-case 217:
+case 238:
 YY_RULE_SETUP
-#line 433 "./util/configlexer.lex"
+#line 462 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PORT) }
 	YY_BREAK
-case 218:
+case 239:
 YY_RULE_SETUP
-#line 434 "./util/configlexer.lex"
+#line 463 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER) }
 	YY_BREAK
-case 219:
+case 240:
 YY_RULE_SETUP
-#line 435 "./util/configlexer.lex"
+#line 464 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_SECRET_KEY) }
 	YY_BREAK
-case 220:
+case 241:
 YY_RULE_SETUP
-#line 436 "./util/configlexer.lex"
+#line 465 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT) }
 	YY_BREAK
-case 221:
+case 242:
 YY_RULE_SETUP
-#line 437 "./util/configlexer.lex"
+#line 466 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_PROVIDER_CERT_ROTATED) }
 	YY_BREAK
-case 222:
+case 243:
 YY_RULE_SETUP
-#line 438 "./util/configlexer.lex"
+#line 467 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE) }
 	YY_BREAK
-case 223:
+case 244:
 YY_RULE_SETUP
-#line 440 "./util/configlexer.lex"
+#line 469 "./util/configlexer.lex"
 {
 		YDVAR(1, VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS) }
 	YY_BREAK
-case 224:
+case 245:
 YY_RULE_SETUP
-#line 442 "./util/configlexer.lex"
+#line 471 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SIZE) }
 	YY_BREAK
-case 225:
+case 246:
 YY_RULE_SETUP
-#line 443 "./util/configlexer.lex"
+#line 472 "./util/configlexer.lex"
 { YDVAR(1, VAR_DNSCRYPT_NONCE_CACHE_SLABS) }
 	YY_BREAK
-case 226:
+case 247:
 YY_RULE_SETUP
-#line 444 "./util/configlexer.lex"
+#line 473 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_ENABLED) }
 	YY_BREAK
-case 227:
+case 248:
 YY_RULE_SETUP
-#line 445 "./util/configlexer.lex"
+#line 474 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_IGNORE_BOGUS) }
 	YY_BREAK
-case 228:
+case 249:
 YY_RULE_SETUP
-#line 446 "./util/configlexer.lex"
+#line 475 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_HOOK) }
 	YY_BREAK
-case 229:
+case 250:
 YY_RULE_SETUP
-#line 447 "./util/configlexer.lex"
+#line 476 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_MAX_TTL) }
 	YY_BREAK
-case 230:
+case 251:
 YY_RULE_SETUP
-#line 448 "./util/configlexer.lex"
+#line 477 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_WHITELIST) }
 	YY_BREAK
-case 231:
+case 252:
 YY_RULE_SETUP
-#line 449 "./util/configlexer.lex"
+#line 478 "./util/configlexer.lex"
 { YDVAR(1, VAR_IPSECMOD_STRICT) }
 	YY_BREAK
-case 232:
+case 253:
 YY_RULE_SETUP
-#line 450 "./util/configlexer.lex"
+#line 479 "./util/configlexer.lex"
 { YDVAR(0, VAR_CACHEDB) }
 	YY_BREAK
-case 233:
+case 254:
 YY_RULE_SETUP
-#line 451 "./util/configlexer.lex"
+#line 480 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_BACKEND) }
 	YY_BREAK
-case 234:
+case 255:
 YY_RULE_SETUP
-#line 452 "./util/configlexer.lex"
+#line 481 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_SECRETSEED) }
 	YY_BREAK
-case 235:
+case 256:
 YY_RULE_SETUP
-#line 453 "./util/configlexer.lex"
+#line 482 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISHOST) }
 	YY_BREAK
-case 236:
+case 257:
 YY_RULE_SETUP
-#line 454 "./util/configlexer.lex"
+#line 483 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISPORT) }
 	YY_BREAK
-case 237:
+case 258:
 YY_RULE_SETUP
-#line 455 "./util/configlexer.lex"
+#line 484 "./util/configlexer.lex"
 { YDVAR(1, VAR_CACHEDB_REDISTIMEOUT) }
 	YY_BREAK
-case 238:
+case 259:
 YY_RULE_SETUP
-#line 456 "./util/configlexer.lex"
+#line 485 "./util/configlexer.lex"
 { YDVAR(1, VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM) }
 	YY_BREAK
-case 239:
-/* rule 239 can match eol */
+case 260:
+/* rule 257 can match eol */
 YY_RULE_SETUP
-#line 457 "./util/configlexer.lex"
+#line 486 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++; }
 	YY_BREAK
 /* Quoted strings. Strip leading and ending quotes */
-case 240:
+case 261:
 YY_RULE_SETUP
-#line 460 "./util/configlexer.lex"
+#line 489 "./util/configlexer.lex"
 { BEGIN(quotedstring); LEXOUT(("QS ")); }
 	YY_BREAK
 case YY_STATE_EOF(quotedstring):
-#line 461 "./util/configlexer.lex"
+#line 490 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 241:
+case 262:
 YY_RULE_SETUP
-#line 466 "./util/configlexer.lex"
+#line 495 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 242:
-/* rule 242 can match eol */
+case 263:
+/* rule 260 can match eol */
 YY_RULE_SETUP
-#line 467 "./util/configlexer.lex"
+#line 496 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end \""); 
 			  cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 243:
+case 264:
 YY_RULE_SETUP
-#line 469 "./util/configlexer.lex"
+#line 498 "./util/configlexer.lex"
 {
         LEXOUT(("QE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -4134,34 +4874,34 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* Single Quoted strings. Strip leading and ending quotes */
-case 244:
+case 265:
 YY_RULE_SETUP
-#line 481 "./util/configlexer.lex"
+#line 510 "./util/configlexer.lex"
 { BEGIN(singlequotedstr); LEXOUT(("SQS ")); }
 	YY_BREAK
 case YY_STATE_EOF(singlequotedstr):
-#line 482 "./util/configlexer.lex"
+#line 511 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
 	if(--num_args == 0) { BEGIN(INITIAL); }
 	else		    { BEGIN(val); }
 }
 	YY_BREAK
-case 245:
+case 266:
 YY_RULE_SETUP
-#line 487 "./util/configlexer.lex"
+#line 516 "./util/configlexer.lex"
 { LEXOUT(("STR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 246:
-/* rule 246 can match eol */
+case 267:
+/* rule 264 can match eol */
 YY_RULE_SETUP
-#line 488 "./util/configlexer.lex"
+#line 517 "./util/configlexer.lex"
 { yyerror("newline inside quoted string, no end '"); 
 			     cfg_parser->line++; BEGIN(INITIAL); }
 	YY_BREAK
-case 247:
+case 268:
 YY_RULE_SETUP
-#line 490 "./util/configlexer.lex"
+#line 519 "./util/configlexer.lex"
 {
         LEXOUT(("SQE "));
 	if(--num_args == 0) { BEGIN(INITIAL); }
@@ -4174,38 +4914,38 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 /* include: directive */
-case 248:
+case 269:
 YY_RULE_SETUP
-#line 502 "./util/configlexer.lex"
+#line 531 "./util/configlexer.lex"
 { 
 	LEXOUT(("v(%s) ", yytext)); inc_prev = YYSTATE; BEGIN(include); }
 	YY_BREAK
 case YY_STATE_EOF(include):
-#line 504 "./util/configlexer.lex"
+#line 533 "./util/configlexer.lex"
 {
         yyerror("EOF inside include directive");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 249:
+case 270:
 YY_RULE_SETUP
-#line 508 "./util/configlexer.lex"
+#line 537 "./util/configlexer.lex"
 { LEXOUT(("ISP ")); /* ignore */ }
 	YY_BREAK
-case 250:
-/* rule 250 can match eol */
+case 271:
+/* rule 268 can match eol */
 YY_RULE_SETUP
-#line 509 "./util/configlexer.lex"
+#line 538 "./util/configlexer.lex"
 { LEXOUT(("NL\n")); cfg_parser->line++;}
 	YY_BREAK
-case 251:
+case 272:
 YY_RULE_SETUP
-#line 510 "./util/configlexer.lex"
+#line 539 "./util/configlexer.lex"
 { LEXOUT(("IQS ")); BEGIN(include_quoted); }
 	YY_BREAK
-case 252:
+case 273:
 YY_RULE_SETUP
-#line 511 "./util/configlexer.lex"
+#line 540 "./util/configlexer.lex"
 {
 	LEXOUT(("Iunquotedstr(%s) ", yytext));
 	config_start_include_glob(yytext);
@@ -4213,27 +4953,27 @@ YY_RULE_SETUP
 }
 	YY_BREAK
 case YY_STATE_EOF(include_quoted):
-#line 516 "./util/configlexer.lex"
+#line 545 "./util/configlexer.lex"
 {
         yyerror("EOF inside quoted string");
         BEGIN(inc_prev);
 }
 	YY_BREAK
-case 253:
+case 274:
 YY_RULE_SETUP
-#line 520 "./util/configlexer.lex"
+#line 549 "./util/configlexer.lex"
 { LEXOUT(("ISTR(%s) ", yytext)); yymore(); }
 	YY_BREAK
-case 254:
-/* rule 254 can match eol */
+case 275:
+/* rule 272 can match eol */
 YY_RULE_SETUP
-#line 521 "./util/configlexer.lex"
+#line 550 "./util/configlexer.lex"
 { yyerror("newline before \" in include name"); 
 				  cfg_parser->line++; BEGIN(inc_prev); }
 	YY_BREAK
-case 255:
+case 276:
 YY_RULE_SETUP
-#line 523 "./util/configlexer.lex"
+#line 552 "./util/configlexer.lex"
 {
 	LEXOUT(("IQE "));
 	yytext[yyleng - 1] = '\0';
@@ -4243,7 +4983,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
 case YY_STATE_EOF(val):
-#line 529 "./util/configlexer.lex"
+#line 558 "./util/configlexer.lex"
 {
 	LEXOUT(("LEXEOF "));
 	yy_set_bol(1); /* Set beginning of line, so "^" rules match.  */
@@ -4255,33 +4995,33 @@ case YY_STATE_EOF(val):
 	}
 }
 	YY_BREAK
-case 256:
+case 277:
 YY_RULE_SETUP
-#line 540 "./util/configlexer.lex"
+#line 569 "./util/configlexer.lex"
 { LEXOUT(("unquotedstr(%s) ", yytext)); 
 			if(--num_args == 0) { BEGIN(INITIAL); }
 			yylval.str = strdup(yytext); return STRING_ARG; }
 	YY_BREAK
-case 257:
+case 278:
 YY_RULE_SETUP
-#line 544 "./util/configlexer.lex"
+#line 573 "./util/configlexer.lex"
 {
 	ub_c_error_msg("unknown keyword '%s'", yytext);
 	}
 	YY_BREAK
-case 258:
+case 279:
 YY_RULE_SETUP
-#line 548 "./util/configlexer.lex"
+#line 577 "./util/configlexer.lex"
 {
 	ub_c_error_msg("stray '%s'", yytext);
 	}
 	YY_BREAK
-case 259:
+case 280:
 YY_RULE_SETUP
-#line 552 "./util/configlexer.lex"
+#line 581 "./util/configlexer.lex"
 ECHO;
 	YY_BREAK
-#line 4283 "<stdout>"
+#line 5025 "<stdout>"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -4572,7 +5312,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 2563 )
+			if ( yy_current_state >= 2867 )
 				yy_c = yy_meta[(unsigned int) yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
@@ -4600,11 +5340,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 2563 )
+		if ( yy_current_state >= 2867 )
 			yy_c = yy_meta[(unsigned int) yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + (flex_int16_t) yy_c];
-	yy_is_jam = (yy_current_state == 2562);
+	yy_is_jam = (yy_current_state == 2866);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -5243,7 +5983,7 @@ void yyfree (void * ptr )
 
 #define YYTABLES_NAME "yytables"
 
-#line 552 "./util/configlexer.lex"
+#line 555 "./util/configlexer.lex"
 
 
 
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -33,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -40,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "3.0.4"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -61,8 +66,8 @@
 
 
 
-/* Copy the first part of user declarations.  */
-#line 38 "./util/configparser.y" /* yacc.c:339  */
+/* First part of user prologue.  */
+#line 38 "util/configparser.y"
 
 #include "config.h"
 
@@ -80,6 +85,7 @@ int ub_c_lex(void);
 void ub_c_error(const char *message);
 
 static void validate_respip_action(const char* action);
+static void parse_dnstap_sample(const char* str, int* rate);
 
 /* these need to be global, otherwise they cannot be used inside yacc */
 extern struct config_parser_state* cfg_parser;
@@ -91,569 +97,663 @@ extern struct config_parser_state* cfg_parser;
 #endif
 
 
-#line 95 "util/configparser.c" /* yacc.c:339  */
+#line 101 "util/configparser.c"
 
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
 # ifndef YY_NULLPTR
-#  if defined __cplusplus && 201103L <= __cplusplus
-#   define YY_NULLPTR nullptr
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
 #  else
-#   define YY_NULLPTR 0
+#   define YY_NULLPTR ((void*)0)
 #  endif
 # endif
 
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* In a future release of Bison, this section will be replaced
-   by #include "configparser.h".  */
-#ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-# define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
-/* Debug traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-#if YYDEBUG
-extern int yydebug;
-#endif
-
-/* Token type.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-  enum yytokentype
-  {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_CHROOT = 279,
-    VAR_USERNAME = 280,
-    VAR_DIRECTORY = 281,
-    VAR_LOGFILE = 282,
-    VAR_PIDFILE = 283,
-    VAR_MSG_CACHE_SIZE = 284,
-    VAR_MSG_CACHE_SLABS = 285,
-    VAR_NUM_QUERIES_PER_THREAD = 286,
-    VAR_RRSET_CACHE_SIZE = 287,
-    VAR_RRSET_CACHE_SLABS = 288,
-    VAR_OUTGOING_NUM_TCP = 289,
-    VAR_INFRA_HOST_TTL = 290,
-    VAR_INFRA_LAME_TTL = 291,
-    VAR_INFRA_CACHE_SLABS = 292,
-    VAR_INFRA_CACHE_NUMHOSTS = 293,
-    VAR_INFRA_CACHE_LAME_SIZE = 294,
-    VAR_NAME = 295,
-    VAR_STUB_ZONE = 296,
-    VAR_STUB_HOST = 297,
-    VAR_STUB_ADDR = 298,
-    VAR_TARGET_FETCH_POLICY = 299,
-    VAR_HARDEN_SHORT_BUFSIZE = 300,
-    VAR_HARDEN_LARGE_QUERIES = 301,
-    VAR_FORWARD_ZONE = 302,
-    VAR_FORWARD_HOST = 303,
-    VAR_FORWARD_ADDR = 304,
-    VAR_DO_NOT_QUERY_ADDRESS = 305,
-    VAR_HIDE_IDENTITY = 306,
-    VAR_HIDE_VERSION = 307,
-    VAR_IDENTITY = 308,
-    VAR_VERSION = 309,
-    VAR_HARDEN_GLUE = 310,
-    VAR_MODULE_CONF = 311,
-    VAR_TRUST_ANCHOR_FILE = 312,
-    VAR_TRUST_ANCHOR = 313,
-    VAR_VAL_OVERRIDE_DATE = 314,
-    VAR_BOGUS_TTL = 315,
-    VAR_VAL_CLEAN_ADDITIONAL = 316,
-    VAR_VAL_PERMISSIVE_MODE = 317,
-    VAR_INCOMING_NUM_TCP = 318,
-    VAR_MSG_BUFFER_SIZE = 319,
-    VAR_KEY_CACHE_SIZE = 320,
-    VAR_KEY_CACHE_SLABS = 321,
-    VAR_TRUSTED_KEYS_FILE = 322,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 323,
-    VAR_USE_SYSLOG = 324,
-    VAR_OUTGOING_INTERFACE = 325,
-    VAR_ROOT_HINTS = 326,
-    VAR_DO_NOT_QUERY_LOCALHOST = 327,
-    VAR_CACHE_MAX_TTL = 328,
-    VAR_HARDEN_DNSSEC_STRIPPED = 329,
-    VAR_ACCESS_CONTROL = 330,
-    VAR_LOCAL_ZONE = 331,
-    VAR_LOCAL_DATA = 332,
-    VAR_INTERFACE_AUTOMATIC = 333,
-    VAR_STATISTICS_INTERVAL = 334,
-    VAR_DO_DAEMONIZE = 335,
-    VAR_USE_CAPS_FOR_ID = 336,
-    VAR_STATISTICS_CUMULATIVE = 337,
-    VAR_OUTGOING_PORT_PERMIT = 338,
-    VAR_OUTGOING_PORT_AVOID = 339,
-    VAR_DLV_ANCHOR_FILE = 340,
-    VAR_DLV_ANCHOR = 341,
-    VAR_NEG_CACHE_SIZE = 342,
-    VAR_HARDEN_REFERRAL_PATH = 343,
-    VAR_PRIVATE_ADDRESS = 344,
-    VAR_PRIVATE_DOMAIN = 345,
-    VAR_REMOTE_CONTROL = 346,
-    VAR_CONTROL_ENABLE = 347,
-    VAR_CONTROL_INTERFACE = 348,
-    VAR_CONTROL_PORT = 349,
-    VAR_SERVER_KEY_FILE = 350,
-    VAR_SERVER_CERT_FILE = 351,
-    VAR_CONTROL_KEY_FILE = 352,
-    VAR_CONTROL_CERT_FILE = 353,
-    VAR_CONTROL_USE_CERT = 354,
-    VAR_EXTENDED_STATISTICS = 355,
-    VAR_LOCAL_DATA_PTR = 356,
-    VAR_JOSTLE_TIMEOUT = 357,
-    VAR_STUB_PRIME = 358,
-    VAR_UNWANTED_REPLY_THRESHOLD = 359,
-    VAR_LOG_TIME_ASCII = 360,
-    VAR_DOMAIN_INSECURE = 361,
-    VAR_PYTHON = 362,
-    VAR_PYTHON_SCRIPT = 363,
-    VAR_VAL_SIG_SKEW_MIN = 364,
-    VAR_VAL_SIG_SKEW_MAX = 365,
-    VAR_CACHE_MIN_TTL = 366,
-    VAR_VAL_LOG_LEVEL = 367,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 368,
-    VAR_KEEP_MISSING = 369,
-    VAR_ADD_HOLDDOWN = 370,
-    VAR_DEL_HOLDDOWN = 371,
-    VAR_SO_RCVBUF = 372,
-    VAR_EDNS_BUFFER_SIZE = 373,
-    VAR_PREFETCH = 374,
-    VAR_PREFETCH_KEY = 375,
-    VAR_SO_SNDBUF = 376,
-    VAR_SO_REUSEPORT = 377,
-    VAR_HARDEN_BELOW_NXDOMAIN = 378,
-    VAR_IGNORE_CD_FLAG = 379,
-    VAR_LOG_QUERIES = 380,
-    VAR_LOG_REPLIES = 381,
-    VAR_TCP_UPSTREAM = 382,
-    VAR_SSL_UPSTREAM = 383,
-    VAR_SSL_SERVICE_KEY = 384,
-    VAR_SSL_SERVICE_PEM = 385,
-    VAR_SSL_PORT = 386,
-    VAR_FORWARD_FIRST = 387,
-    VAR_STUB_SSL_UPSTREAM = 388,
-    VAR_FORWARD_SSL_UPSTREAM = 389,
-    VAR_TLS_CERT_BUNDLE = 390,
-    VAR_STUB_FIRST = 391,
-    VAR_MINIMAL_RESPONSES = 392,
-    VAR_RRSET_ROUNDROBIN = 393,
-    VAR_MAX_UDP_SIZE = 394,
-    VAR_DELAY_CLOSE = 395,
-    VAR_UNBLOCK_LAN_ZONES = 396,
-    VAR_INSECURE_LAN_ZONES = 397,
-    VAR_INFRA_CACHE_MIN_RTT = 398,
-    VAR_DNS64_PREFIX = 399,
-    VAR_DNS64_SYNTHALL = 400,
-    VAR_DNSTAP = 401,
-    VAR_DNSTAP_ENABLE = 402,
-    VAR_DNSTAP_SOCKET_PATH = 403,
-    VAR_DNSTAP_SEND_IDENTITY = 404,
-    VAR_DNSTAP_SEND_VERSION = 405,
-    VAR_DNSTAP_IDENTITY = 406,
-    VAR_DNSTAP_VERSION = 407,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 408,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 409,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 410,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 411,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 412,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 413,
-    VAR_RESPONSE_IP_TAG = 414,
-    VAR_RESPONSE_IP = 415,
-    VAR_RESPONSE_IP_DATA = 416,
-    VAR_HARDEN_ALGO_DOWNGRADE = 417,
-    VAR_IP_TRANSPARENT = 418,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 419,
-    VAR_IP_RATELIMIT = 420,
-    VAR_IP_RATELIMIT_SLABS = 421,
-    VAR_IP_RATELIMIT_SIZE = 422,
-    VAR_RATELIMIT = 423,
-    VAR_RATELIMIT_SLABS = 424,
-    VAR_RATELIMIT_SIZE = 425,
-    VAR_RATELIMIT_FOR_DOMAIN = 426,
-    VAR_RATELIMIT_BELOW_DOMAIN = 427,
-    VAR_IP_RATELIMIT_FACTOR = 428,
-    VAR_RATELIMIT_FACTOR = 429,
-    VAR_SEND_CLIENT_SUBNET = 430,
-    VAR_CLIENT_SUBNET_ZONE = 431,
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 432,
-    VAR_CLIENT_SUBNET_OPCODE = 433,
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 434,
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 435,
-    VAR_CAPS_WHITELIST = 436,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 437,
-    VAR_PERMIT_SMALL_HOLDDOWN = 438,
-    VAR_QNAME_MINIMISATION = 439,
-    VAR_QNAME_MINIMISATION_STRICT = 440,
-    VAR_IP_FREEBIND = 441,
-    VAR_DEFINE_TAG = 442,
-    VAR_LOCAL_ZONE_TAG = 443,
-    VAR_ACCESS_CONTROL_TAG = 444,
-    VAR_LOCAL_ZONE_OVERRIDE = 445,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 446,
-    VAR_ACCESS_CONTROL_TAG_DATA = 447,
-    VAR_VIEW = 448,
-    VAR_ACCESS_CONTROL_VIEW = 449,
-    VAR_VIEW_FIRST = 450,
-    VAR_SERVE_EXPIRED = 451,
-    VAR_FAKE_DSA = 452,
-    VAR_FAKE_SHA1 = 453,
-    VAR_LOG_IDENTITY = 454,
-    VAR_HIDE_TRUSTANCHOR = 455,
-    VAR_TRUST_ANCHOR_SIGNALING = 456,
-    VAR_AGGRESSIVE_NSEC = 457,
-    VAR_USE_SYSTEMD = 458,
-    VAR_SHM_ENABLE = 459,
-    VAR_SHM_KEY = 460,
-    VAR_DNSCRYPT = 461,
-    VAR_DNSCRYPT_ENABLE = 462,
-    VAR_DNSCRYPT_PORT = 463,
-    VAR_DNSCRYPT_PROVIDER = 464,
-    VAR_DNSCRYPT_SECRET_KEY = 465,
-    VAR_DNSCRYPT_PROVIDER_CERT = 466,
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 467,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 468,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 469,
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 470,
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 471,
-    VAR_IPSECMOD_ENABLED = 472,
-    VAR_IPSECMOD_HOOK = 473,
-    VAR_IPSECMOD_IGNORE_BOGUS = 474,
-    VAR_IPSECMOD_MAX_TTL = 475,
-    VAR_IPSECMOD_WHITELIST = 476,
-    VAR_IPSECMOD_STRICT = 477,
-    VAR_CACHEDB = 478,
-    VAR_CACHEDB_BACKEND = 479,
-    VAR_CACHEDB_SECRETSEED = 480,
-    VAR_CACHEDB_REDISHOST = 481,
-    VAR_CACHEDB_REDISPORT = 482,
-    VAR_CACHEDB_REDISTIMEOUT = 483,
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 484,
-    VAR_FOR_UPSTREAM = 485,
-    VAR_AUTH_ZONE = 486,
-    VAR_ZONEFILE = 487,
-    VAR_MASTER = 488,
-    VAR_URL = 489,
-    VAR_FOR_DOWNSTREAM = 490,
-    VAR_FALLBACK_ENABLED = 491,
-    VAR_ADDITIONAL_TLS_PORT = 492
-  };
-#endif
-/* Tokens.  */
-#define SPACE 258
-#define LETTER 259
-#define NEWLINE 260
-#define COMMENT 261
-#define COLON 262
-#define ANY 263
-#define ZONESTR 264
-#define STRING_ARG 265
-#define VAR_SERVER 266
-#define VAR_VERBOSITY 267
-#define VAR_NUM_THREADS 268
-#define VAR_PORT 269
-#define VAR_OUTGOING_RANGE 270
-#define VAR_INTERFACE 271
-#define VAR_DO_IP4 272
-#define VAR_DO_IP6 273
-#define VAR_PREFER_IP6 274
-#define VAR_DO_UDP 275
-#define VAR_DO_TCP 276
-#define VAR_TCP_MSS 277
-#define VAR_OUTGOING_TCP_MSS 278
-#define VAR_CHROOT 279
-#define VAR_USERNAME 280
-#define VAR_DIRECTORY 281
-#define VAR_LOGFILE 282
-#define VAR_PIDFILE 283
-#define VAR_MSG_CACHE_SIZE 284
-#define VAR_MSG_CACHE_SLABS 285
-#define VAR_NUM_QUERIES_PER_THREAD 286
-#define VAR_RRSET_CACHE_SIZE 287
-#define VAR_RRSET_CACHE_SLABS 288
-#define VAR_OUTGOING_NUM_TCP 289
-#define VAR_INFRA_HOST_TTL 290
-#define VAR_INFRA_LAME_TTL 291
-#define VAR_INFRA_CACHE_SLABS 292
-#define VAR_INFRA_CACHE_NUMHOSTS 293
-#define VAR_INFRA_CACHE_LAME_SIZE 294
-#define VAR_NAME 295
-#define VAR_STUB_ZONE 296
-#define VAR_STUB_HOST 297
-#define VAR_STUB_ADDR 298
-#define VAR_TARGET_FETCH_POLICY 299
-#define VAR_HARDEN_SHORT_BUFSIZE 300
-#define VAR_HARDEN_LARGE_QUERIES 301
-#define VAR_FORWARD_ZONE 302
-#define VAR_FORWARD_HOST 303
-#define VAR_FORWARD_ADDR 304
-#define VAR_DO_NOT_QUERY_ADDRESS 305
-#define VAR_HIDE_IDENTITY 306
-#define VAR_HIDE_VERSION 307
-#define VAR_IDENTITY 308
-#define VAR_VERSION 309
-#define VAR_HARDEN_GLUE 310
-#define VAR_MODULE_CONF 311
-#define VAR_TRUST_ANCHOR_FILE 312
-#define VAR_TRUST_ANCHOR 313
-#define VAR_VAL_OVERRIDE_DATE 314
-#define VAR_BOGUS_TTL 315
-#define VAR_VAL_CLEAN_ADDITIONAL 316
-#define VAR_VAL_PERMISSIVE_MODE 317
-#define VAR_INCOMING_NUM_TCP 318
-#define VAR_MSG_BUFFER_SIZE 319
-#define VAR_KEY_CACHE_SIZE 320
-#define VAR_KEY_CACHE_SLABS 321
-#define VAR_TRUSTED_KEYS_FILE 322
-#define VAR_VAL_NSEC3_KEYSIZE_ITERATIONS 323
-#define VAR_USE_SYSLOG 324
-#define VAR_OUTGOING_INTERFACE 325
-#define VAR_ROOT_HINTS 326
-#define VAR_DO_NOT_QUERY_LOCALHOST 327
-#define VAR_CACHE_MAX_TTL 328
-#define VAR_HARDEN_DNSSEC_STRIPPED 329
-#define VAR_ACCESS_CONTROL 330
-#define VAR_LOCAL_ZONE 331
-#define VAR_LOCAL_DATA 332
-#define VAR_INTERFACE_AUTOMATIC 333
-#define VAR_STATISTICS_INTERVAL 334
-#define VAR_DO_DAEMONIZE 335
-#define VAR_USE_CAPS_FOR_ID 336
-#define VAR_STATISTICS_CUMULATIVE 337
-#define VAR_OUTGOING_PORT_PERMIT 338
-#define VAR_OUTGOING_PORT_AVOID 339
-#define VAR_DLV_ANCHOR_FILE 340
-#define VAR_DLV_ANCHOR 341
-#define VAR_NEG_CACHE_SIZE 342
-#define VAR_HARDEN_REFERRAL_PATH 343
-#define VAR_PRIVATE_ADDRESS 344
-#define VAR_PRIVATE_DOMAIN 345
-#define VAR_REMOTE_CONTROL 346
-#define VAR_CONTROL_ENABLE 347
-#define VAR_CONTROL_INTERFACE 348
-#define VAR_CONTROL_PORT 349
-#define VAR_SERVER_KEY_FILE 350
-#define VAR_SERVER_CERT_FILE 351
-#define VAR_CONTROL_KEY_FILE 352
-#define VAR_CONTROL_CERT_FILE 353
-#define VAR_CONTROL_USE_CERT 354
-#define VAR_EXTENDED_STATISTICS 355
-#define VAR_LOCAL_DATA_PTR 356
-#define VAR_JOSTLE_TIMEOUT 357
-#define VAR_STUB_PRIME 358
-#define VAR_UNWANTED_REPLY_THRESHOLD 359
-#define VAR_LOG_TIME_ASCII 360
-#define VAR_DOMAIN_INSECURE 361
-#define VAR_PYTHON 362
-#define VAR_PYTHON_SCRIPT 363
-#define VAR_VAL_SIG_SKEW_MIN 364
-#define VAR_VAL_SIG_SKEW_MAX 365
-#define VAR_CACHE_MIN_TTL 366
-#define VAR_VAL_LOG_LEVEL 367
-#define VAR_AUTO_TRUST_ANCHOR_FILE 368
-#define VAR_KEEP_MISSING 369
-#define VAR_ADD_HOLDDOWN 370
-#define VAR_DEL_HOLDDOWN 371
-#define VAR_SO_RCVBUF 372
-#define VAR_EDNS_BUFFER_SIZE 373
-#define VAR_PREFETCH 374
-#define VAR_PREFETCH_KEY 375
-#define VAR_SO_SNDBUF 376
-#define VAR_SO_REUSEPORT 377
-#define VAR_HARDEN_BELOW_NXDOMAIN 378
-#define VAR_IGNORE_CD_FLAG 379
-#define VAR_LOG_QUERIES 380
-#define VAR_LOG_REPLIES 381
-#define VAR_TCP_UPSTREAM 382
-#define VAR_SSL_UPSTREAM 383
-#define VAR_SSL_SERVICE_KEY 384
-#define VAR_SSL_SERVICE_PEM 385
-#define VAR_SSL_PORT 386
-#define VAR_FORWARD_FIRST 387
-#define VAR_STUB_SSL_UPSTREAM 388
-#define VAR_FORWARD_SSL_UPSTREAM 389
-#define VAR_TLS_CERT_BUNDLE 390
-#define VAR_STUB_FIRST 391
-#define VAR_MINIMAL_RESPONSES 392
-#define VAR_RRSET_ROUNDROBIN 393
-#define VAR_MAX_UDP_SIZE 394
-#define VAR_DELAY_CLOSE 395
-#define VAR_UNBLOCK_LAN_ZONES 396
-#define VAR_INSECURE_LAN_ZONES 397
-#define VAR_INFRA_CACHE_MIN_RTT 398
-#define VAR_DNS64_PREFIX 399
-#define VAR_DNS64_SYNTHALL 400
-#define VAR_DNSTAP 401
-#define VAR_DNSTAP_ENABLE 402
-#define VAR_DNSTAP_SOCKET_PATH 403
-#define VAR_DNSTAP_SEND_IDENTITY 404
-#define VAR_DNSTAP_SEND_VERSION 405
-#define VAR_DNSTAP_IDENTITY 406
-#define VAR_DNSTAP_VERSION 407
-#define VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES 408
-#define VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES 409
-#define VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES 410
-#define VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES 411
-#define VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES 412
-#define VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES 413
-#define VAR_RESPONSE_IP_TAG 414
-#define VAR_RESPONSE_IP 415
-#define VAR_RESPONSE_IP_DATA 416
-#define VAR_HARDEN_ALGO_DOWNGRADE 417
-#define VAR_IP_TRANSPARENT 418
-#define VAR_DISABLE_DNSSEC_LAME_CHECK 419
-#define VAR_IP_RATELIMIT 420
-#define VAR_IP_RATELIMIT_SLABS 421
-#define VAR_IP_RATELIMIT_SIZE 422
-#define VAR_RATELIMIT 423
-#define VAR_RATELIMIT_SLABS 424
-#define VAR_RATELIMIT_SIZE 425
-#define VAR_RATELIMIT_FOR_DOMAIN 426
-#define VAR_RATELIMIT_BELOW_DOMAIN 427
-#define VAR_IP_RATELIMIT_FACTOR 428
-#define VAR_RATELIMIT_FACTOR 429
-#define VAR_SEND_CLIENT_SUBNET 430
-#define VAR_CLIENT_SUBNET_ZONE 431
-#define VAR_CLIENT_SUBNET_ALWAYS_FORWARD 432
-#define VAR_CLIENT_SUBNET_OPCODE 433
-#define VAR_MAX_CLIENT_SUBNET_IPV4 434
-#define VAR_MAX_CLIENT_SUBNET_IPV6 435
-#define VAR_CAPS_WHITELIST 436
-#define VAR_CACHE_MAX_NEGATIVE_TTL 437
-#define VAR_PERMIT_SMALL_HOLDDOWN 438
-#define VAR_QNAME_MINIMISATION 439
-#define VAR_QNAME_MINIMISATION_STRICT 440
-#define VAR_IP_FREEBIND 441
-#define VAR_DEFINE_TAG 442
-#define VAR_LOCAL_ZONE_TAG 443
-#define VAR_ACCESS_CONTROL_TAG 444
-#define VAR_LOCAL_ZONE_OVERRIDE 445
-#define VAR_ACCESS_CONTROL_TAG_ACTION 446
-#define VAR_ACCESS_CONTROL_TAG_DATA 447
-#define VAR_VIEW 448
-#define VAR_ACCESS_CONTROL_VIEW 449
-#define VAR_VIEW_FIRST 450
-#define VAR_SERVE_EXPIRED 451
-#define VAR_FAKE_DSA 452
-#define VAR_FAKE_SHA1 453
-#define VAR_LOG_IDENTITY 454
-#define VAR_HIDE_TRUSTANCHOR 455
-#define VAR_TRUST_ANCHOR_SIGNALING 456
-#define VAR_AGGRESSIVE_NSEC 457
-#define VAR_USE_SYSTEMD 458
-#define VAR_SHM_ENABLE 459
-#define VAR_SHM_KEY 460
-#define VAR_DNSCRYPT 461
-#define VAR_DNSCRYPT_ENABLE 462
-#define VAR_DNSCRYPT_PORT 463
-#define VAR_DNSCRYPT_PROVIDER 464
-#define VAR_DNSCRYPT_SECRET_KEY 465
-#define VAR_DNSCRYPT_PROVIDER_CERT 466
-#define VAR_DNSCRYPT_PROVIDER_CERT_ROTATED 467
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE 468
-#define VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS 469
-#define VAR_DNSCRYPT_NONCE_CACHE_SIZE 470
-#define VAR_DNSCRYPT_NONCE_CACHE_SLABS 471
-#define VAR_IPSECMOD_ENABLED 472
-#define VAR_IPSECMOD_HOOK 473
-#define VAR_IPSECMOD_IGNORE_BOGUS 474
-#define VAR_IPSECMOD_MAX_TTL 475
-#define VAR_IPSECMOD_WHITELIST 476
-#define VAR_IPSECMOD_STRICT 477
-#define VAR_CACHEDB 478
-#define VAR_CACHEDB_BACKEND 479
-#define VAR_CACHEDB_SECRETSEED 480
-#define VAR_CACHEDB_REDISHOST 481
-#define VAR_CACHEDB_REDISPORT 482
-#define VAR_CACHEDB_REDISTIMEOUT 483
-#define VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM 484
-#define VAR_FOR_UPSTREAM 485
-#define VAR_AUTH_ZONE 486
-#define VAR_ZONEFILE 487
-#define VAR_MASTER 488
-#define VAR_URL 489
-#define VAR_FOR_DOWNSTREAM 490
-#define VAR_FALLBACK_ENABLED 491
-#define VAR_ADDITIONAL_TLS_PORT 492
-
-/* Value type.  */
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
-union YYSTYPE
+#include "configparser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-#line 66 "./util/configparser.y" /* yacc.c:355  */
-
-	char*	str;
-
-#line 613 "util/configparser.c" /* yacc.c:355  */
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_SPACE = 3,                      /* SPACE  */
+  YYSYMBOL_LETTER = 4,                     /* LETTER  */
+  YYSYMBOL_NEWLINE = 5,                    /* NEWLINE  */
+  YYSYMBOL_COMMENT = 6,                    /* COMMENT  */
+  YYSYMBOL_COLON = 7,                      /* COLON  */
+  YYSYMBOL_ANY = 8,                        /* ANY  */
+  YYSYMBOL_ZONESTR = 9,                    /* ZONESTR  */
+  YYSYMBOL_STRING_ARG = 10,                /* STRING_ARG  */
+  YYSYMBOL_VAR_SERVER = 11,                /* VAR_SERVER  */
+  YYSYMBOL_VAR_VERBOSITY = 12,             /* VAR_VERBOSITY  */
+  YYSYMBOL_VAR_NUM_THREADS = 13,           /* VAR_NUM_THREADS  */
+  YYSYMBOL_VAR_PORT = 14,                  /* VAR_PORT  */
+  YYSYMBOL_VAR_OUTGOING_RANGE = 15,        /* VAR_OUTGOING_RANGE  */
+  YYSYMBOL_VAR_INTERFACE = 16,             /* VAR_INTERFACE  */
+  YYSYMBOL_VAR_DO_IP4 = 17,                /* VAR_DO_IP4  */
+  YYSYMBOL_VAR_DO_IP6 = 18,                /* VAR_DO_IP6  */
+  YYSYMBOL_VAR_PREFER_IP6 = 19,            /* VAR_PREFER_IP6  */
+  YYSYMBOL_VAR_DO_UDP = 20,                /* VAR_DO_UDP  */
+  YYSYMBOL_VAR_DO_TCP = 21,                /* VAR_DO_TCP  */
+  YYSYMBOL_VAR_TCP_MSS = 22,               /* VAR_TCP_MSS  */
+  YYSYMBOL_VAR_OUTGOING_TCP_MSS = 23,      /* VAR_OUTGOING_TCP_MSS  */
+  YYSYMBOL_VAR_CHROOT = 24,                /* VAR_CHROOT  */
+  YYSYMBOL_VAR_USERNAME = 25,              /* VAR_USERNAME  */
+  YYSYMBOL_VAR_DIRECTORY = 26,             /* VAR_DIRECTORY  */
+  YYSYMBOL_VAR_LOGFILE = 27,               /* VAR_LOGFILE  */
+  YYSYMBOL_VAR_PIDFILE = 28,               /* VAR_PIDFILE  */
+  YYSYMBOL_VAR_MSG_CACHE_SIZE = 29,        /* VAR_MSG_CACHE_SIZE  */
+  YYSYMBOL_VAR_MSG_CACHE_SLABS = 30,       /* VAR_MSG_CACHE_SLABS  */
+  YYSYMBOL_VAR_NUM_QUERIES_PER_THREAD = 31, /* VAR_NUM_QUERIES_PER_THREAD  */
+  YYSYMBOL_VAR_RRSET_CACHE_SIZE = 32,      /* VAR_RRSET_CACHE_SIZE  */
+  YYSYMBOL_VAR_RRSET_CACHE_SLABS = 33,     /* VAR_RRSET_CACHE_SLABS  */
+  YYSYMBOL_VAR_OUTGOING_NUM_TCP = 34,      /* VAR_OUTGOING_NUM_TCP  */
+  YYSYMBOL_VAR_INFRA_HOST_TTL = 35,        /* VAR_INFRA_HOST_TTL  */
+  YYSYMBOL_VAR_INFRA_LAME_TTL = 36,        /* VAR_INFRA_LAME_TTL  */
+  YYSYMBOL_VAR_INFRA_CACHE_SLABS = 37,     /* VAR_INFRA_CACHE_SLABS  */
+  YYSYMBOL_VAR_INFRA_CACHE_NUMHOSTS = 38,  /* VAR_INFRA_CACHE_NUMHOSTS  */
+  YYSYMBOL_VAR_INFRA_CACHE_LAME_SIZE = 39, /* VAR_INFRA_CACHE_LAME_SIZE  */
+  YYSYMBOL_VAR_NAME = 40,                  /* VAR_NAME  */
+  YYSYMBOL_VAR_STUB_ZONE = 41,             /* VAR_STUB_ZONE  */
+  YYSYMBOL_VAR_STUB_HOST = 42,             /* VAR_STUB_HOST  */
+  YYSYMBOL_VAR_STUB_ADDR = 43,             /* VAR_STUB_ADDR  */
+  YYSYMBOL_VAR_TARGET_FETCH_POLICY = 44,   /* VAR_TARGET_FETCH_POLICY  */
+  YYSYMBOL_VAR_HARDEN_SHORT_BUFSIZE = 45,  /* VAR_HARDEN_SHORT_BUFSIZE  */
+  YYSYMBOL_VAR_HARDEN_LARGE_QUERIES = 46,  /* VAR_HARDEN_LARGE_QUERIES  */
+  YYSYMBOL_VAR_FORWARD_ZONE = 47,          /* VAR_FORWARD_ZONE  */
+  YYSYMBOL_VAR_FORWARD_HOST = 48,          /* VAR_FORWARD_HOST  */
+  YYSYMBOL_VAR_FORWARD_ADDR = 49,          /* VAR_FORWARD_ADDR  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_ADDRESS = 50,  /* VAR_DO_NOT_QUERY_ADDRESS  */
+  YYSYMBOL_VAR_HIDE_IDENTITY = 51,         /* VAR_HIDE_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_VERSION = 52,          /* VAR_HIDE_VERSION  */
+  YYSYMBOL_VAR_IDENTITY = 53,              /* VAR_IDENTITY  */
+  YYSYMBOL_VAR_VERSION = 54,               /* VAR_VERSION  */
+  YYSYMBOL_VAR_HARDEN_GLUE = 55,           /* VAR_HARDEN_GLUE  */
+  YYSYMBOL_VAR_MODULE_CONF = 56,           /* VAR_MODULE_CONF  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_FILE = 57,     /* VAR_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_TRUST_ANCHOR = 58,          /* VAR_TRUST_ANCHOR  */
+  YYSYMBOL_VAR_VAL_OVERRIDE_DATE = 59,     /* VAR_VAL_OVERRIDE_DATE  */
+  YYSYMBOL_VAR_BOGUS_TTL = 60,             /* VAR_BOGUS_TTL  */
+  YYSYMBOL_VAR_VAL_CLEAN_ADDITIONAL = 61,  /* VAR_VAL_CLEAN_ADDITIONAL  */
+  YYSYMBOL_VAR_VAL_PERMISSIVE_MODE = 62,   /* VAR_VAL_PERMISSIVE_MODE  */
+  YYSYMBOL_VAR_INCOMING_NUM_TCP = 63,      /* VAR_INCOMING_NUM_TCP  */
+  YYSYMBOL_VAR_MSG_BUFFER_SIZE = 64,       /* VAR_MSG_BUFFER_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SIZE = 65,        /* VAR_KEY_CACHE_SIZE  */
+  YYSYMBOL_VAR_KEY_CACHE_SLABS = 66,       /* VAR_KEY_CACHE_SLABS  */
+  YYSYMBOL_VAR_TRUSTED_KEYS_FILE = 67,     /* VAR_TRUSTED_KEYS_FILE  */
+  YYSYMBOL_VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 68, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+  YYSYMBOL_VAR_USE_SYSLOG = 69,            /* VAR_USE_SYSLOG  */
+  YYSYMBOL_VAR_OUTGOING_INTERFACE = 70,    /* VAR_OUTGOING_INTERFACE  */
+  YYSYMBOL_VAR_ROOT_HINTS = 71,            /* VAR_ROOT_HINTS  */
+  YYSYMBOL_VAR_DO_NOT_QUERY_LOCALHOST = 72, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+  YYSYMBOL_VAR_CACHE_MAX_TTL = 73,         /* VAR_CACHE_MAX_TTL  */
+  YYSYMBOL_VAR_HARDEN_DNSSEC_STRIPPED = 74, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+  YYSYMBOL_VAR_ACCESS_CONTROL = 75,        /* VAR_ACCESS_CONTROL  */
+  YYSYMBOL_VAR_LOCAL_ZONE = 76,            /* VAR_LOCAL_ZONE  */
+  YYSYMBOL_VAR_LOCAL_DATA = 77,            /* VAR_LOCAL_DATA  */
+  YYSYMBOL_VAR_INTERFACE_AUTOMATIC = 78,   /* VAR_INTERFACE_AUTOMATIC  */
+  YYSYMBOL_VAR_STATISTICS_INTERVAL = 79,   /* VAR_STATISTICS_INTERVAL  */
+  YYSYMBOL_VAR_DO_DAEMONIZE = 80,          /* VAR_DO_DAEMONIZE  */
+  YYSYMBOL_VAR_USE_CAPS_FOR_ID = 81,       /* VAR_USE_CAPS_FOR_ID  */
+  YYSYMBOL_VAR_STATISTICS_CUMULATIVE = 82, /* VAR_STATISTICS_CUMULATIVE  */
+  YYSYMBOL_VAR_OUTGOING_PORT_PERMIT = 83,  /* VAR_OUTGOING_PORT_PERMIT  */
+  YYSYMBOL_VAR_OUTGOING_PORT_AVOID = 84,   /* VAR_OUTGOING_PORT_AVOID  */
+  YYSYMBOL_VAR_DLV_ANCHOR_FILE = 85,       /* VAR_DLV_ANCHOR_FILE  */
+  YYSYMBOL_VAR_DLV_ANCHOR = 86,            /* VAR_DLV_ANCHOR  */
+  YYSYMBOL_VAR_NEG_CACHE_SIZE = 87,        /* VAR_NEG_CACHE_SIZE  */
+  YYSYMBOL_VAR_HARDEN_REFERRAL_PATH = 88,  /* VAR_HARDEN_REFERRAL_PATH  */
+  YYSYMBOL_VAR_PRIVATE_ADDRESS = 89,       /* VAR_PRIVATE_ADDRESS  */
+  YYSYMBOL_VAR_PRIVATE_DOMAIN = 90,        /* VAR_PRIVATE_DOMAIN  */
+  YYSYMBOL_VAR_REMOTE_CONTROL = 91,        /* VAR_REMOTE_CONTROL  */
+  YYSYMBOL_VAR_CONTROL_ENABLE = 92,        /* VAR_CONTROL_ENABLE  */
+  YYSYMBOL_VAR_CONTROL_INTERFACE = 93,     /* VAR_CONTROL_INTERFACE  */
+  YYSYMBOL_VAR_CONTROL_PORT = 94,          /* VAR_CONTROL_PORT  */
+  YYSYMBOL_VAR_SERVER_KEY_FILE = 95,       /* VAR_SERVER_KEY_FILE  */
+  YYSYMBOL_VAR_SERVER_CERT_FILE = 96,      /* VAR_SERVER_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_KEY_FILE = 97,      /* VAR_CONTROL_KEY_FILE  */
+  YYSYMBOL_VAR_CONTROL_CERT_FILE = 98,     /* VAR_CONTROL_CERT_FILE  */
+  YYSYMBOL_VAR_CONTROL_USE_CERT = 99,      /* VAR_CONTROL_USE_CERT  */
+  YYSYMBOL_VAR_EXTENDED_STATISTICS = 100,  /* VAR_EXTENDED_STATISTICS  */
+  YYSYMBOL_VAR_LOCAL_DATA_PTR = 101,       /* VAR_LOCAL_DATA_PTR  */
+  YYSYMBOL_VAR_JOSTLE_TIMEOUT = 102,       /* VAR_JOSTLE_TIMEOUT  */
+  YYSYMBOL_VAR_STUB_PRIME = 103,           /* VAR_STUB_PRIME  */
+  YYSYMBOL_VAR_UNWANTED_REPLY_THRESHOLD = 104, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+  YYSYMBOL_VAR_LOG_TIME_ASCII = 105,       /* VAR_LOG_TIME_ASCII  */
+  YYSYMBOL_VAR_DOMAIN_INSECURE = 106,      /* VAR_DOMAIN_INSECURE  */
+  YYSYMBOL_VAR_PYTHON = 107,               /* VAR_PYTHON  */
+  YYSYMBOL_VAR_PYTHON_SCRIPT = 108,        /* VAR_PYTHON_SCRIPT  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MIN = 109,     /* VAR_VAL_SIG_SKEW_MIN  */
+  YYSYMBOL_VAR_VAL_SIG_SKEW_MAX = 110,     /* VAR_VAL_SIG_SKEW_MAX  */
+  YYSYMBOL_VAR_CACHE_MIN_TTL = 111,        /* VAR_CACHE_MIN_TTL  */
+  YYSYMBOL_VAR_VAL_LOG_LEVEL = 112,        /* VAR_VAL_LOG_LEVEL  */
+  YYSYMBOL_VAR_AUTO_TRUST_ANCHOR_FILE = 113, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+  YYSYMBOL_VAR_KEEP_MISSING = 114,         /* VAR_KEEP_MISSING  */
+  YYSYMBOL_VAR_ADD_HOLDDOWN = 115,         /* VAR_ADD_HOLDDOWN  */
+  YYSYMBOL_VAR_DEL_HOLDDOWN = 116,         /* VAR_DEL_HOLDDOWN  */
+  YYSYMBOL_VAR_SO_RCVBUF = 117,            /* VAR_SO_RCVBUF  */
+  YYSYMBOL_VAR_EDNS_BUFFER_SIZE = 118,     /* VAR_EDNS_BUFFER_SIZE  */
+  YYSYMBOL_VAR_PREFETCH = 119,             /* VAR_PREFETCH  */
+  YYSYMBOL_VAR_PREFETCH_KEY = 120,         /* VAR_PREFETCH_KEY  */
+  YYSYMBOL_VAR_SO_SNDBUF = 121,            /* VAR_SO_SNDBUF  */
+  YYSYMBOL_VAR_SO_REUSEPORT = 122,         /* VAR_SO_REUSEPORT  */
+  YYSYMBOL_VAR_HARDEN_BELOW_NXDOMAIN = 123, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+  YYSYMBOL_VAR_IGNORE_CD_FLAG = 124,       /* VAR_IGNORE_CD_FLAG  */
+  YYSYMBOL_VAR_LOG_QUERIES = 125,          /* VAR_LOG_QUERIES  */
+  YYSYMBOL_VAR_LOG_REPLIES = 126,          /* VAR_LOG_REPLIES  */
+  YYSYMBOL_VAR_TCP_UPSTREAM = 127,         /* VAR_TCP_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_UPSTREAM = 128,         /* VAR_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_SSL_SERVICE_KEY = 129,      /* VAR_SSL_SERVICE_KEY  */
+  YYSYMBOL_VAR_SSL_SERVICE_PEM = 130,      /* VAR_SSL_SERVICE_PEM  */
+  YYSYMBOL_VAR_SSL_PORT = 131,             /* VAR_SSL_PORT  */
+  YYSYMBOL_VAR_FORWARD_FIRST = 132,        /* VAR_FORWARD_FIRST  */
+  YYSYMBOL_VAR_STUB_SSL_UPSTREAM = 133,    /* VAR_STUB_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_FORWARD_SSL_UPSTREAM = 134, /* VAR_FORWARD_SSL_UPSTREAM  */
+  YYSYMBOL_VAR_TLS_CERT_BUNDLE = 135,      /* VAR_TLS_CERT_BUNDLE  */
+  YYSYMBOL_VAR_STUB_FIRST = 136,           /* VAR_STUB_FIRST  */
+  YYSYMBOL_VAR_MINIMAL_RESPONSES = 137,    /* VAR_MINIMAL_RESPONSES  */
+  YYSYMBOL_VAR_RRSET_ROUNDROBIN = 138,     /* VAR_RRSET_ROUNDROBIN  */
+  YYSYMBOL_VAR_MAX_UDP_SIZE = 139,         /* VAR_MAX_UDP_SIZE  */
+  YYSYMBOL_VAR_DELAY_CLOSE = 140,          /* VAR_DELAY_CLOSE  */
+  YYSYMBOL_VAR_UNBLOCK_LAN_ZONES = 141,    /* VAR_UNBLOCK_LAN_ZONES  */
+  YYSYMBOL_VAR_INSECURE_LAN_ZONES = 142,   /* VAR_INSECURE_LAN_ZONES  */
+  YYSYMBOL_VAR_INFRA_CACHE_MIN_RTT = 143,  /* VAR_INFRA_CACHE_MIN_RTT  */
+  YYSYMBOL_VAR_DNS64_PREFIX = 144,         /* VAR_DNS64_PREFIX  */
+  YYSYMBOL_VAR_DNS64_SYNTHALL = 145,       /* VAR_DNS64_SYNTHALL  */
+  YYSYMBOL_VAR_DNSTAP = 146,               /* VAR_DNSTAP  */
+  YYSYMBOL_VAR_DNSTAP_ENABLE = 147,        /* VAR_DNSTAP_ENABLE  */
+  YYSYMBOL_VAR_DNSTAP_SOCKET_PATH = 148,   /* VAR_DNSTAP_SOCKET_PATH  */
+  YYSYMBOL_VAR_DNSTAP_SEND_IDENTITY = 149, /* VAR_DNSTAP_SEND_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_SEND_VERSION = 150,  /* VAR_DNSTAP_SEND_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_IDENTITY = 151,      /* VAR_DNSTAP_IDENTITY  */
+  YYSYMBOL_VAR_DNSTAP_VERSION = 152,       /* VAR_DNSTAP_VERSION  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 153, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 154, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 155, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 156, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 157, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 158, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_RESPONSE_IP_TAG = 159,      /* VAR_RESPONSE_IP_TAG  */
+  YYSYMBOL_VAR_RESPONSE_IP = 160,          /* VAR_RESPONSE_IP  */
+  YYSYMBOL_VAR_RESPONSE_IP_DATA = 161,     /* VAR_RESPONSE_IP_DATA  */
+  YYSYMBOL_VAR_HARDEN_ALGO_DOWNGRADE = 162, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+  YYSYMBOL_VAR_IP_TRANSPARENT = 163,       /* VAR_IP_TRANSPARENT  */
+  YYSYMBOL_VAR_DISABLE_DNSSEC_LAME_CHECK = 164, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+  YYSYMBOL_VAR_IP_RATELIMIT = 165,         /* VAR_IP_RATELIMIT  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SLABS = 166,   /* VAR_IP_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SIZE = 167,    /* VAR_IP_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT = 168,            /* VAR_RATELIMIT  */
+  YYSYMBOL_VAR_RATELIMIT_SLABS = 169,      /* VAR_RATELIMIT_SLABS  */
+  YYSYMBOL_VAR_RATELIMIT_SIZE = 170,       /* VAR_RATELIMIT_SIZE  */
+  YYSYMBOL_VAR_RATELIMIT_FOR_DOMAIN = 171, /* VAR_RATELIMIT_FOR_DOMAIN  */
+  YYSYMBOL_VAR_RATELIMIT_BELOW_DOMAIN = 172, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+  YYSYMBOL_VAR_IP_RATELIMIT_FACTOR = 173,  /* VAR_IP_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_RATELIMIT_FACTOR = 174,     /* VAR_RATELIMIT_FACTOR  */
+  YYSYMBOL_VAR_SEND_CLIENT_SUBNET = 175,   /* VAR_SEND_CLIENT_SUBNET  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ZONE = 176,   /* VAR_CLIENT_SUBNET_ZONE  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 177, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+  YYSYMBOL_VAR_CLIENT_SUBNET_OPCODE = 178, /* VAR_CLIENT_SUBNET_OPCODE  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV4 = 179, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+  YYSYMBOL_VAR_MAX_CLIENT_SUBNET_IPV6 = 180, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+  YYSYMBOL_VAR_CAPS_WHITELIST = 181,       /* VAR_CAPS_WHITELIST  */
+  YYSYMBOL_VAR_CACHE_MAX_NEGATIVE_TTL = 182, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+  YYSYMBOL_VAR_PERMIT_SMALL_HOLDDOWN = 183, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION = 184,   /* VAR_QNAME_MINIMISATION  */
+  YYSYMBOL_VAR_QNAME_MINIMISATION_STRICT = 185, /* VAR_QNAME_MINIMISATION_STRICT  */
+  YYSYMBOL_VAR_IP_FREEBIND = 186,          /* VAR_IP_FREEBIND  */
+  YYSYMBOL_VAR_DEFINE_TAG = 187,           /* VAR_DEFINE_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_TAG = 188,       /* VAR_LOCAL_ZONE_TAG  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG = 189,   /* VAR_ACCESS_CONTROL_TAG  */
+  YYSYMBOL_VAR_LOCAL_ZONE_OVERRIDE = 190,  /* VAR_LOCAL_ZONE_OVERRIDE  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_ACTION = 191, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_TAG_DATA = 192, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+  YYSYMBOL_VAR_VIEW = 193,                 /* VAR_VIEW  */
+  YYSYMBOL_VAR_ACCESS_CONTROL_VIEW = 194,  /* VAR_ACCESS_CONTROL_VIEW  */
+  YYSYMBOL_VAR_VIEW_FIRST = 195,           /* VAR_VIEW_FIRST  */
+  YYSYMBOL_VAR_SERVE_EXPIRED = 196,        /* VAR_SERVE_EXPIRED  */
+  YYSYMBOL_VAR_FAKE_DSA = 197,             /* VAR_FAKE_DSA  */
+  YYSYMBOL_VAR_FAKE_SHA1 = 198,            /* VAR_FAKE_SHA1  */
+  YYSYMBOL_VAR_LOG_IDENTITY = 199,         /* VAR_LOG_IDENTITY  */
+  YYSYMBOL_VAR_HIDE_TRUSTANCHOR = 200,     /* VAR_HIDE_TRUSTANCHOR  */
+  YYSYMBOL_VAR_TRUST_ANCHOR_SIGNALING = 201, /* VAR_TRUST_ANCHOR_SIGNALING  */
+  YYSYMBOL_VAR_AGGRESSIVE_NSEC = 202,      /* VAR_AGGRESSIVE_NSEC  */
+  YYSYMBOL_VAR_USE_SYSTEMD = 203,          /* VAR_USE_SYSTEMD  */
+  YYSYMBOL_VAR_SHM_ENABLE = 204,           /* VAR_SHM_ENABLE  */
+  YYSYMBOL_VAR_SHM_KEY = 205,              /* VAR_SHM_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT = 206,             /* VAR_DNSCRYPT  */
+  YYSYMBOL_VAR_DNSCRYPT_ENABLE = 207,      /* VAR_DNSCRYPT_ENABLE  */
+  YYSYMBOL_VAR_DNSCRYPT_PORT = 208,        /* VAR_DNSCRYPT_PORT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER = 209,    /* VAR_DNSCRYPT_PROVIDER  */
+  YYSYMBOL_VAR_DNSCRYPT_SECRET_KEY = 210,  /* VAR_DNSCRYPT_SECRET_KEY  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT = 211, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+  YYSYMBOL_VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 212, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 213, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 214, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SIZE = 215, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+  YYSYMBOL_VAR_DNSCRYPT_NONCE_CACHE_SLABS = 216, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+  YYSYMBOL_VAR_IPSECMOD_ENABLED = 217,     /* VAR_IPSECMOD_ENABLED  */
+  YYSYMBOL_VAR_IPSECMOD_HOOK = 218,        /* VAR_IPSECMOD_HOOK  */
+  YYSYMBOL_VAR_IPSECMOD_IGNORE_BOGUS = 219, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+  YYSYMBOL_VAR_IPSECMOD_MAX_TTL = 220,     /* VAR_IPSECMOD_MAX_TTL  */
+  YYSYMBOL_VAR_IPSECMOD_WHITELIST = 221,   /* VAR_IPSECMOD_WHITELIST  */
+  YYSYMBOL_VAR_IPSECMOD_STRICT = 222,      /* VAR_IPSECMOD_STRICT  */
+  YYSYMBOL_VAR_CACHEDB = 223,              /* VAR_CACHEDB  */
+  YYSYMBOL_VAR_CACHEDB_BACKEND = 224,      /* VAR_CACHEDB_BACKEND  */
+  YYSYMBOL_VAR_CACHEDB_SECRETSEED = 225,   /* VAR_CACHEDB_SECRETSEED  */
+  YYSYMBOL_VAR_CACHEDB_REDISHOST = 226,    /* VAR_CACHEDB_REDISHOST  */
+  YYSYMBOL_VAR_CACHEDB_REDISPORT = 227,    /* VAR_CACHEDB_REDISPORT  */
+  YYSYMBOL_VAR_CACHEDB_REDISTIMEOUT = 228, /* VAR_CACHEDB_REDISTIMEOUT  */
+  YYSYMBOL_VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 229, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+  YYSYMBOL_VAR_FOR_UPSTREAM = 230,         /* VAR_FOR_UPSTREAM  */
+  YYSYMBOL_VAR_AUTH_ZONE = 231,            /* VAR_AUTH_ZONE  */
+  YYSYMBOL_VAR_ZONEFILE = 232,             /* VAR_ZONEFILE  */
+  YYSYMBOL_VAR_MASTER = 233,               /* VAR_MASTER  */
+  YYSYMBOL_VAR_URL = 234,                  /* VAR_URL  */
+  YYSYMBOL_VAR_FOR_DOWNSTREAM = 235,       /* VAR_FOR_DOWNSTREAM  */
+  YYSYMBOL_VAR_FALLBACK_ENABLED = 236,     /* VAR_FALLBACK_ENABLED  */
+  YYSYMBOL_VAR_ADDITIONAL_TLS_PORT = 237,  /* VAR_ADDITIONAL_TLS_PORT  */
+  YYSYMBOL_VAR_UPSTREAM_RACE = 238,        /* VAR_UPSTREAM_RACE  */
+  YYSYMBOL_VAR_UPSTREAM_RACE_DELAY = 239,  /* VAR_UPSTREAM_RACE_DELAY  */
+  YYSYMBOL_VAR_UPSTREAM_RACE_MAX = 240,    /* VAR_UPSTREAM_RACE_MAX  */
+  YYSYMBOL_VAR_UPSTREAM_RACE_BUDGET = 241, /* VAR_UPSTREAM_RACE_BUDGET  */
+  YYSYMBOL_VAR_LOG_MODULE_TIME = 242,      /* VAR_LOG_MODULE_TIME  */
+  YYSYMBOL_VAR_DNSTAP_IP = 243,            /* VAR_DNSTAP_IP  */
+  YYSYMBOL_VAR_DNSTAP_FILE = 244,          /* VAR_DNSTAP_FILE  */
+  YYSYMBOL_VAR_DNSTAP_FILE_ROTATE_SIZE = 245, /* VAR_DNSTAP_FILE_ROTATE_SIZE  */
+  YYSYMBOL_VAR_DNSTAP_FILE_ROTATE_INTERVAL = 246, /* VAR_DNSTAP_FILE_ROTATE_INTERVAL  */
+  YYSYMBOL_VAR_DNSTAP_RING_SIZE = 247,     /* VAR_DNSTAP_RING_SIZE  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES = 248, /* VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES = 249, /* VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES = 250, /* VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES = 251, /* VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES = 252, /* VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES = 253, /* VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES  */
+  YYSYMBOL_VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL = 254, /* VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL  */
+  YYSYMBOL_VAR_IP_RATELIMIT_SKETCH = 255,  /* VAR_IP_RATELIMIT_SKETCH  */
+  YYSYMBOL_VAR_HEAVY_HITTERS_SIZE = 256,   /* VAR_HEAVY_HITTERS_SIZE  */
+  YYSYMBOL_VAR_CACHE_HUGE_PAGES = 257,     /* VAR_CACHE_HUGE_PAGES  */
+  YYSYMBOL_VAR_MSG_CACHE_WIREFORMAT = 258, /* VAR_MSG_CACHE_WIREFORMAT  */
+  YYSYMBOL_YYACCEPT = 259,                 /* $accept  */
+  YYSYMBOL_toplevelvars = 260,             /* toplevelvars  */
+  YYSYMBOL_toplevelvar = 261,              /* toplevelvar  */
+  YYSYMBOL_serverstart = 262,              /* serverstart  */
+  YYSYMBOL_contents_server = 263,          /* contents_server  */
+  YYSYMBOL_content_server = 264,           /* content_server  */
+  YYSYMBOL_stubstart = 265,                /* stubstart  */
+  YYSYMBOL_contents_stub = 266,            /* contents_stub  */
+  YYSYMBOL_content_stub = 267,             /* content_stub  */
+  YYSYMBOL_forwardstart = 268,             /* forwardstart  */
+  YYSYMBOL_contents_forward = 269,         /* contents_forward  */
+  YYSYMBOL_content_forward = 270,          /* content_forward  */
+  YYSYMBOL_viewstart = 271,                /* viewstart  */
+  YYSYMBOL_contents_view = 272,            /* contents_view  */
+  YYSYMBOL_content_view = 273,             /* content_view  */
+  YYSYMBOL_authstart = 274,                /* authstart  */
+  YYSYMBOL_contents_auth = 275,            /* contents_auth  */
+  YYSYMBOL_content_auth = 276,             /* content_auth  */
+  YYSYMBOL_server_num_threads = 277,       /* server_num_threads  */
+  YYSYMBOL_server_verbosity = 278,         /* server_verbosity  */
+  YYSYMBOL_server_statistics_interval = 279, /* server_statistics_interval  */
+  YYSYMBOL_server_statistics_cumulative = 280, /* server_statistics_cumulative  */
+  YYSYMBOL_server_extended_statistics = 281, /* server_extended_statistics  */
+  YYSYMBOL_server_shm_enable = 282,        /* server_shm_enable  */
+  YYSYMBOL_server_shm_key = 283,           /* server_shm_key  */
+  YYSYMBOL_server_port = 284,              /* server_port  */
+  YYSYMBOL_server_send_client_subnet = 285, /* server_send_client_subnet  */
+  YYSYMBOL_server_client_subnet_zone = 286, /* server_client_subnet_zone  */
+  YYSYMBOL_server_client_subnet_always_forward = 287, /* server_client_subnet_always_forward  */
+  YYSYMBOL_server_client_subnet_opcode = 288, /* server_client_subnet_opcode  */
+  YYSYMBOL_server_max_client_subnet_ipv4 = 289, /* server_max_client_subnet_ipv4  */
+  YYSYMBOL_server_max_client_subnet_ipv6 = 290, /* server_max_client_subnet_ipv6  */
+  YYSYMBOL_server_interface = 291,         /* server_interface  */
+  YYSYMBOL_server_outgoing_interface = 292, /* server_outgoing_interface  */
+  YYSYMBOL_server_outgoing_range = 293,    /* server_outgoing_range  */
+  YYSYMBOL_server_outgoing_port_permit = 294, /* server_outgoing_port_permit  */
+  YYSYMBOL_server_outgoing_port_avoid = 295, /* server_outgoing_port_avoid  */
+  YYSYMBOL_server_outgoing_num_tcp = 296,  /* server_outgoing_num_tcp  */
+  YYSYMBOL_server_incoming_num_tcp = 297,  /* server_incoming_num_tcp  */
+  YYSYMBOL_server_interface_automatic = 298, /* server_interface_automatic  */
+  YYSYMBOL_server_do_ip4 = 299,            /* server_do_ip4  */
+  YYSYMBOL_server_do_ip6 = 300,            /* server_do_ip6  */
+  YYSYMBOL_server_do_udp = 301,            /* server_do_udp  */
+  YYSYMBOL_server_do_tcp = 302,            /* server_do_tcp  */
+  YYSYMBOL_server_prefer_ip6 = 303,        /* server_prefer_ip6  */
+  YYSYMBOL_server_tcp_mss = 304,           /* server_tcp_mss  */
+  YYSYMBOL_server_outgoing_tcp_mss = 305,  /* server_outgoing_tcp_mss  */
+  YYSYMBOL_server_tcp_upstream = 306,      /* server_tcp_upstream  */
+  YYSYMBOL_server_udp_upstream_without_downstream = 307, /* server_udp_upstream_without_downstream  */
+  YYSYMBOL_server_ssl_upstream = 308,      /* server_ssl_upstream  */
+  YYSYMBOL_server_ssl_service_key = 309,   /* server_ssl_service_key  */
+  YYSYMBOL_server_ssl_service_pem = 310,   /* server_ssl_service_pem  */
+  YYSYMBOL_server_ssl_port = 311,          /* server_ssl_port  */
+  YYSYMBOL_server_tls_cert_bundle = 312,   /* server_tls_cert_bundle  */
+  YYSYMBOL_server_additional_tls_port = 313, /* server_additional_tls_port  */
+  YYSYMBOL_server_use_systemd = 314,       /* server_use_systemd  */
+  YYSYMBOL_server_do_daemonize = 315,      /* server_do_daemonize  */
+  YYSYMBOL_server_use_syslog = 316,        /* server_use_syslog  */
+  YYSYMBOL_server_log_time_ascii = 317,    /* server_log_time_ascii  */
+  YYSYMBOL_server_log_queries = 318,       /* server_log_queries  */
+  YYSYMBOL_server_log_replies = 319,       /* server_log_replies  */
+  YYSYMBOL_server_log_module_time = 320,   /* server_log_module_time  */
+  YYSYMBOL_server_ip_ratelimit_sketch = 321, /* server_ip_ratelimit_sketch  */
+  YYSYMBOL_server_heavy_hitters_size = 322, /* server_heavy_hitters_size  */
+  YYSYMBOL_server_chroot = 323,            /* server_chroot  */
+  YYSYMBOL_server_username = 324,          /* server_username  */
+  YYSYMBOL_server_directory = 325,         /* server_directory  */
+  YYSYMBOL_server_logfile = 326,           /* server_logfile  */
+  YYSYMBOL_server_pidfile = 327,           /* server_pidfile  */
+  YYSYMBOL_server_root_hints = 328,        /* server_root_hints  */
+  YYSYMBOL_server_dlv_anchor_file = 329,   /* server_dlv_anchor_file  */
+  YYSYMBOL_server_dlv_anchor = 330,        /* server_dlv_anchor  */
+  YYSYMBOL_server_auto_trust_anchor_file = 331, /* server_auto_trust_anchor_file  */
+  YYSYMBOL_server_trust_anchor_file = 332, /* server_trust_anchor_file  */
+  YYSYMBOL_server_trusted_keys_file = 333, /* server_trusted_keys_file  */
+  YYSYMBOL_server_trust_anchor = 334,      /* server_trust_anchor  */
+  YYSYMBOL_server_trust_anchor_signaling = 335, /* server_trust_anchor_signaling  */
+  YYSYMBOL_server_domain_insecure = 336,   /* server_domain_insecure  */
+  YYSYMBOL_server_hide_identity = 337,     /* server_hide_identity  */
+  YYSYMBOL_server_hide_version = 338,      /* server_hide_version  */
+  YYSYMBOL_server_hide_trustanchor = 339,  /* server_hide_trustanchor  */
+  YYSYMBOL_server_identity = 340,          /* server_identity  */
+  YYSYMBOL_server_version = 341,           /* server_version  */
+  YYSYMBOL_server_so_rcvbuf = 342,         /* server_so_rcvbuf  */
+  YYSYMBOL_server_so_sndbuf = 343,         /* server_so_sndbuf  */
+  YYSYMBOL_server_so_reuseport = 344,      /* server_so_reuseport  */
+  YYSYMBOL_server_ip_transparent = 345,    /* server_ip_transparent  */
+  YYSYMBOL_server_ip_freebind = 346,       /* server_ip_freebind  */
+  YYSYMBOL_server_edns_buffer_size = 347,  /* server_edns_buffer_size  */
+  YYSYMBOL_server_msg_buffer_size = 348,   /* server_msg_buffer_size  */
+  YYSYMBOL_server_msg_cache_size = 349,    /* server_msg_cache_size  */
+  YYSYMBOL_server_msg_cache_slabs = 350,   /* server_msg_cache_slabs  */
+  YYSYMBOL_server_msg_cache_wireformat = 351, /* server_msg_cache_wireformat  */
+  YYSYMBOL_server_num_queries_per_thread = 352, /* server_num_queries_per_thread  */
+  YYSYMBOL_server_jostle_timeout = 353,    /* server_jostle_timeout  */
+  YYSYMBOL_server_delay_close = 354,       /* server_delay_close  */
+  YYSYMBOL_server_unblock_lan_zones = 355, /* server_unblock_lan_zones  */
+  YYSYMBOL_server_insecure_lan_zones = 356, /* server_insecure_lan_zones  */
+  YYSYMBOL_server_rrset_cache_size = 357,  /* server_rrset_cache_size  */
+  YYSYMBOL_server_rrset_cache_slabs = 358, /* server_rrset_cache_slabs  */
+  YYSYMBOL_server_cache_huge_pages = 359,  /* server_cache_huge_pages  */
+  YYSYMBOL_server_infra_host_ttl = 360,    /* server_infra_host_ttl  */
+  YYSYMBOL_server_infra_lame_ttl = 361,    /* server_infra_lame_ttl  */
+  YYSYMBOL_server_infra_cache_numhosts = 362, /* server_infra_cache_numhosts  */
+  YYSYMBOL_server_infra_cache_lame_size = 363, /* server_infra_cache_lame_size  */
+  YYSYMBOL_server_infra_cache_slabs = 364, /* server_infra_cache_slabs  */
+  YYSYMBOL_server_infra_cache_min_rtt = 365, /* server_infra_cache_min_rtt  */
+  YYSYMBOL_server_target_fetch_policy = 366, /* server_target_fetch_policy  */
+  YYSYMBOL_server_harden_short_bufsize = 367, /* server_harden_short_bufsize  */
+  YYSYMBOL_server_harden_large_queries = 368, /* server_harden_large_queries  */
+  YYSYMBOL_server_harden_glue = 369,       /* server_harden_glue  */
+  YYSYMBOL_server_harden_dnssec_stripped = 370, /* server_harden_dnssec_stripped  */
+  YYSYMBOL_server_harden_below_nxdomain = 371, /* server_harden_below_nxdomain  */
+  YYSYMBOL_server_harden_referral_path = 372, /* server_harden_referral_path  */
+  YYSYMBOL_server_harden_algo_downgrade = 373, /* server_harden_algo_downgrade  */
+  YYSYMBOL_server_use_caps_for_id = 374,   /* server_use_caps_for_id  */
+  YYSYMBOL_server_caps_whitelist = 375,    /* server_caps_whitelist  */
+  YYSYMBOL_server_private_address = 376,   /* server_private_address  */
+  YYSYMBOL_server_private_domain = 377,    /* server_private_domain  */
+  YYSYMBOL_server_prefetch = 378,          /* server_prefetch  */
+  YYSYMBOL_server_prefetch_key = 379,      /* server_prefetch_key  */
+  YYSYMBOL_server_unwanted_reply_threshold = 380, /* server_unwanted_reply_threshold  */
+  YYSYMBOL_server_do_not_query_address = 381, /* server_do_not_query_address  */
+  YYSYMBOL_server_do_not_query_localhost = 382, /* server_do_not_query_localhost  */
+  YYSYMBOL_server_access_control = 383,    /* server_access_control  */
+  YYSYMBOL_server_module_conf = 384,       /* server_module_conf  */
+  YYSYMBOL_server_val_override_date = 385, /* server_val_override_date  */
+  YYSYMBOL_server_val_sig_skew_min = 386,  /* server_val_sig_skew_min  */
+  YYSYMBOL_server_val_sig_skew_max = 387,  /* server_val_sig_skew_max  */
+  YYSYMBOL_server_cache_max_ttl = 388,     /* server_cache_max_ttl  */
+  YYSYMBOL_server_cache_max_negative_ttl = 389, /* server_cache_max_negative_ttl  */
+  YYSYMBOL_server_cache_min_ttl = 390,     /* server_cache_min_ttl  */
+  YYSYMBOL_server_bogus_ttl = 391,         /* server_bogus_ttl  */
+  YYSYMBOL_server_val_clean_additional = 392, /* server_val_clean_additional  */
+  YYSYMBOL_server_val_permissive_mode = 393, /* server_val_permissive_mode  */
+  YYSYMBOL_server_aggressive_nsec = 394,   /* server_aggressive_nsec  */
+  YYSYMBOL_server_ignore_cd_flag = 395,    /* server_ignore_cd_flag  */
+  YYSYMBOL_server_serve_expired = 396,     /* server_serve_expired  */
+  YYSYMBOL_server_fake_dsa = 397,          /* server_fake_dsa  */
+  YYSYMBOL_server_fake_sha1 = 398,         /* server_fake_sha1  */
+  YYSYMBOL_server_val_log_level = 399,     /* server_val_log_level  */
+  YYSYMBOL_server_val_nsec3_keysize_iterations = 400, /* server_val_nsec3_keysize_iterations  */
+  YYSYMBOL_server_add_holddown = 401,      /* server_add_holddown  */
+  YYSYMBOL_server_del_holddown = 402,      /* server_del_holddown  */
+  YYSYMBOL_server_keep_missing = 403,      /* server_keep_missing  */
+  YYSYMBOL_server_permit_small_holddown = 404, /* server_permit_small_holddown  */
+  YYSYMBOL_server_key_cache_size = 405,    /* server_key_cache_size  */
+  YYSYMBOL_server_key_cache_slabs = 406,   /* server_key_cache_slabs  */
+  YYSYMBOL_server_neg_cache_size = 407,    /* server_neg_cache_size  */
+  YYSYMBOL_server_local_zone = 408,        /* server_local_zone  */
+  YYSYMBOL_server_local_data = 409,        /* server_local_data  */
+  YYSYMBOL_server_local_data_ptr = 410,    /* server_local_data_ptr  */
+  YYSYMBOL_server_minimal_responses = 411, /* server_minimal_responses  */
+  YYSYMBOL_server_rrset_roundrobin = 412,  /* server_rrset_roundrobin  */
+  YYSYMBOL_server_max_udp_size = 413,      /* server_max_udp_size  */
+  YYSYMBOL_server_dns64_prefix = 414,      /* server_dns64_prefix  */
+  YYSYMBOL_server_dns64_synthall = 415,    /* server_dns64_synthall  */
+  YYSYMBOL_server_define_tag = 416,        /* server_define_tag  */
+  YYSYMBOL_server_local_zone_tag = 417,    /* server_local_zone_tag  */
+  YYSYMBOL_server_access_control_tag = 418, /* server_access_control_tag  */
+  YYSYMBOL_server_access_control_tag_action = 419, /* server_access_control_tag_action  */
+  YYSYMBOL_server_access_control_tag_data = 420, /* server_access_control_tag_data  */
+  YYSYMBOL_server_local_zone_override = 421, /* server_local_zone_override  */
+  YYSYMBOL_server_access_control_view = 422, /* server_access_control_view  */
+  YYSYMBOL_server_response_ip_tag = 423,   /* server_response_ip_tag  */
+  YYSYMBOL_server_ip_ratelimit = 424,      /* server_ip_ratelimit  */
+  YYSYMBOL_server_ratelimit = 425,         /* server_ratelimit  */
+  YYSYMBOL_server_ip_ratelimit_size = 426, /* server_ip_ratelimit_size  */
+  YYSYMBOL_server_ratelimit_size = 427,    /* server_ratelimit_size  */
+  YYSYMBOL_server_ip_ratelimit_slabs = 428, /* server_ip_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_slabs = 429,   /* server_ratelimit_slabs  */
+  YYSYMBOL_server_ratelimit_for_domain = 430, /* server_ratelimit_for_domain  */
+  YYSYMBOL_server_ratelimit_below_domain = 431, /* server_ratelimit_below_domain  */
+  YYSYMBOL_server_ip_ratelimit_factor = 432, /* server_ip_ratelimit_factor  */
+  YYSYMBOL_server_ratelimit_factor = 433,  /* server_ratelimit_factor  */
+  YYSYMBOL_server_qname_minimisation = 434, /* server_qname_minimisation  */
+  YYSYMBOL_server_qname_minimisation_strict = 435, /* server_qname_minimisation_strict  */
+  YYSYMBOL_server_upstream_race = 436,     /* server_upstream_race  */
+  YYSYMBOL_server_upstream_race_delay = 437, /* server_upstream_race_delay  */
+  YYSYMBOL_server_upstream_race_max = 438, /* server_upstream_race_max  */
+  YYSYMBOL_server_upstream_race_budget = 439, /* server_upstream_race_budget  */
+  YYSYMBOL_server_ipsecmod_enabled = 440,  /* server_ipsecmod_enabled  */
+  YYSYMBOL_server_ipsecmod_ignore_bogus = 441, /* server_ipsecmod_ignore_bogus  */
+  YYSYMBOL_server_ipsecmod_hook = 442,     /* server_ipsecmod_hook  */
+  YYSYMBOL_server_ipsecmod_max_ttl = 443,  /* server_ipsecmod_max_ttl  */
+  YYSYMBOL_server_ipsecmod_whitelist = 444, /* server_ipsecmod_whitelist  */
+  YYSYMBOL_server_ipsecmod_strict = 445,   /* server_ipsecmod_strict  */
+  YYSYMBOL_stub_name = 446,                /* stub_name  */
+  YYSYMBOL_stub_host = 447,                /* stub_host  */
+  YYSYMBOL_stub_addr = 448,                /* stub_addr  */
+  YYSYMBOL_stub_first = 449,               /* stub_first  */
+  YYSYMBOL_stub_ssl_upstream = 450,        /* stub_ssl_upstream  */
+  YYSYMBOL_stub_prime = 451,               /* stub_prime  */
+  YYSYMBOL_forward_name = 452,             /* forward_name  */
+  YYSYMBOL_forward_host = 453,             /* forward_host  */
+  YYSYMBOL_forward_addr = 454,             /* forward_addr  */
+  YYSYMBOL_forward_first = 455,            /* forward_first  */
+  YYSYMBOL_forward_ssl_upstream = 456,     /* forward_ssl_upstream  */
+  YYSYMBOL_auth_name = 457,                /* auth_name  */
+  YYSYMBOL_auth_zonefile = 458,            /* auth_zonefile  */
+  YYSYMBOL_auth_master = 459,              /* auth_master  */
+  YYSYMBOL_auth_url = 460,                 /* auth_url  */
+  YYSYMBOL_auth_for_downstream = 461,      /* auth_for_downstream  */
+  YYSYMBOL_auth_for_upstream = 462,        /* auth_for_upstream  */
+  YYSYMBOL_auth_fallback_enabled = 463,    /* auth_fallback_enabled  */
+  YYSYMBOL_view_name = 464,                /* view_name  */
+  YYSYMBOL_view_local_zone = 465,          /* view_local_zone  */
+  YYSYMBOL_view_response_ip = 466,         /* view_response_ip  */
+  YYSYMBOL_view_response_ip_data = 467,    /* view_response_ip_data  */
+  YYSYMBOL_view_local_data = 468,          /* view_local_data  */
+  YYSYMBOL_view_local_data_ptr = 469,      /* view_local_data_ptr  */
+  YYSYMBOL_view_first = 470,               /* view_first  */
+  YYSYMBOL_rcstart = 471,                  /* rcstart  */
+  YYSYMBOL_contents_rc = 472,              /* contents_rc  */
+  YYSYMBOL_content_rc = 473,               /* content_rc  */
+  YYSYMBOL_rc_control_enable = 474,        /* rc_control_enable  */
+  YYSYMBOL_rc_control_port = 475,          /* rc_control_port  */
+  YYSYMBOL_rc_control_interface = 476,     /* rc_control_interface  */
+  YYSYMBOL_rc_control_use_cert = 477,      /* rc_control_use_cert  */
+  YYSYMBOL_rc_server_key_file = 478,       /* rc_server_key_file  */
+  YYSYMBOL_rc_server_cert_file = 479,      /* rc_server_cert_file  */
+  YYSYMBOL_rc_control_key_file = 480,      /* rc_control_key_file  */
+  YYSYMBOL_rc_control_cert_file = 481,     /* rc_control_cert_file  */
+  YYSYMBOL_dtstart = 482,                  /* dtstart  */
+  YYSYMBOL_contents_dt = 483,              /* contents_dt  */
+  YYSYMBOL_content_dt = 484,               /* content_dt  */
+  YYSYMBOL_dt_dnstap_enable = 485,         /* dt_dnstap_enable  */
+  YYSYMBOL_dt_dnstap_socket_path = 486,    /* dt_dnstap_socket_path  */
+  YYSYMBOL_dt_dnstap_send_identity = 487,  /* dt_dnstap_send_identity  */
+  YYSYMBOL_dt_dnstap_send_version = 488,   /* dt_dnstap_send_version  */
+  YYSYMBOL_dt_dnstap_identity = 489,       /* dt_dnstap_identity  */
+  YYSYMBOL_dt_dnstap_version = 490,        /* dt_dnstap_version  */
+  YYSYMBOL_dt_dnstap_log_resolver_query_messages = 491, /* dt_dnstap_log_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_log_resolver_response_messages = 492, /* dt_dnstap_log_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_log_client_query_messages = 493, /* dt_dnstap_log_client_query_messages  */
+  YYSYMBOL_dt_dnstap_log_client_response_messages = 494, /* dt_dnstap_log_client_response_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_query_messages = 495, /* dt_dnstap_log_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_log_forwarder_response_messages = 496, /* dt_dnstap_log_forwarder_response_messages  */
+  YYSYMBOL_dt_dnstap_ip = 497,             /* dt_dnstap_ip  */
+  YYSYMBOL_dt_dnstap_file = 498,           /* dt_dnstap_file  */
+  YYSYMBOL_dt_dnstap_file_rotate_size = 499, /* dt_dnstap_file_rotate_size  */
+  YYSYMBOL_dt_dnstap_file_rotate_interval = 500, /* dt_dnstap_file_rotate_interval  */
+  YYSYMBOL_dt_dnstap_ring_size = 501,      /* dt_dnstap_ring_size  */
+  YYSYMBOL_dt_dnstap_sample_resolver_query_messages = 502, /* dt_dnstap_sample_resolver_query_messages  */
+  YYSYMBOL_dt_dnstap_sample_resolver_response_messages = 503, /* dt_dnstap_sample_resolver_response_messages  */
+  YYSYMBOL_dt_dnstap_sample_client_query_messages = 504, /* dt_dnstap_sample_client_query_messages  */
+  YYSYMBOL_dt_dnstap_sample_client_response_messages = 505, /* dt_dnstap_sample_client_response_messages  */
+  YYSYMBOL_dt_dnstap_sample_forwarder_query_messages = 506, /* dt_dnstap_sample_forwarder_query_messages  */
+  YYSYMBOL_dt_dnstap_sample_forwarder_response_messages = 507, /* dt_dnstap_sample_forwarder_response_messages  */
+  YYSYMBOL_dt_dnstap_sample_keep_servfail = 508, /* dt_dnstap_sample_keep_servfail  */
+  YYSYMBOL_pythonstart = 509,              /* pythonstart  */
+  YYSYMBOL_contents_py = 510,              /* contents_py  */
+  YYSYMBOL_content_py = 511,               /* content_py  */
+  YYSYMBOL_py_script = 512,                /* py_script  */
+  YYSYMBOL_server_disable_dnssec_lame_check = 513, /* server_disable_dnssec_lame_check  */
+  YYSYMBOL_server_log_identity = 514,      /* server_log_identity  */
+  YYSYMBOL_server_response_ip = 515,       /* server_response_ip  */
+  YYSYMBOL_server_response_ip_data = 516,  /* server_response_ip_data  */
+  YYSYMBOL_dnscstart = 517,                /* dnscstart  */
+  YYSYMBOL_contents_dnsc = 518,            /* contents_dnsc  */
+  YYSYMBOL_content_dnsc = 519,             /* content_dnsc  */
+  YYSYMBOL_dnsc_dnscrypt_enable = 520,     /* dnsc_dnscrypt_enable  */
+  YYSYMBOL_dnsc_dnscrypt_port = 521,       /* dnsc_dnscrypt_port  */
+  YYSYMBOL_dnsc_dnscrypt_provider = 522,   /* dnsc_dnscrypt_provider  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert = 523, /* dnsc_dnscrypt_provider_cert  */
+  YYSYMBOL_dnsc_dnscrypt_provider_cert_rotated = 524, /* dnsc_dnscrypt_provider_cert_rotated  */
+  YYSYMBOL_dnsc_dnscrypt_secret_key = 525, /* dnsc_dnscrypt_secret_key  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_size = 526, /* dnsc_dnscrypt_shared_secret_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_shared_secret_cache_slabs = 527, /* dnsc_dnscrypt_shared_secret_cache_slabs  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_size = 528, /* dnsc_dnscrypt_nonce_cache_size  */
+  YYSYMBOL_dnsc_dnscrypt_nonce_cache_slabs = 529, /* dnsc_dnscrypt_nonce_cache_slabs  */
+  YYSYMBOL_cachedbstart = 530,             /* cachedbstart  */
+  YYSYMBOL_contents_cachedb = 531,         /* contents_cachedb  */
+  YYSYMBOL_content_cachedb = 532,          /* content_cachedb  */
+  YYSYMBOL_cachedb_backend_name = 533,     /* cachedb_backend_name  */
+  YYSYMBOL_cachedb_secret_seed = 534,      /* cachedb_secret_seed  */
+  YYSYMBOL_redis_server_host = 535,        /* redis_server_host  */
+  YYSYMBOL_redis_server_port = 536,        /* redis_server_port  */
+  YYSYMBOL_redis_timeout = 537             /* redis_timeout  */
 };
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-typedef union YYSTYPE YYSTYPE;
-# define YYSTYPE_IS_TRIVIAL 1
-# define YYSTYPE_IS_DECLARED 1
-#endif
 
 
-extern YYSTYPE yylval;
 
-int yyparse (void);
+#ifdef short
+# undef short
+#endif
 
-#endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
 
-/* Copy the second part of user declarations.  */
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
+#endif
 
-#line 630 "util/configparser.c" /* yacc.c:358  */
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
 
-#ifdef short
-# undef short
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
+typedef signed char yytype_int8;
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef unsigned char yytype_uint8;
+typedef short yytype_int16;
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#else
-typedef signed char yytype_int8;
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -661,15 +761,28 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int16 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
@@ -683,47 +796,43 @@ typedef short int yytype_int16;
 # endif
 #endif
 
-#ifndef YY_ATTRIBUTE
-# if (defined __GNUC__                                               \
-      && (2 < __GNUC__ || (__GNUC__ == 2 && 96 <= __GNUC_MINOR__)))  \
-     || defined __SUNPRO_C && 0x5110 <= __SUNPRO_C
-#  define YY_ATTRIBUTE(Spec) __attribute__(Spec)
-# else
-#  define YY_ATTRIBUTE(Spec) /* empty */
-# endif
-#endif
 
 #ifndef YY_ATTRIBUTE_PURE
-# define YY_ATTRIBUTE_PURE   YY_ATTRIBUTE ((__pure__))
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
 #endif
 
 #ifndef YY_ATTRIBUTE_UNUSED
-# define YY_ATTRIBUTE_UNUSED YY_ATTRIBUTE ((__unused__))
-#endif
-
-#if !defined _Noreturn \
-     && (!defined __STDC_VERSION__ || __STDC_VERSION__ < 201112)
-# if defined _MSC_VER && 1200 <= _MSC_VER
-#  define _Noreturn __declspec (noreturn)
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
 # else
-#  define _Noreturn YY_ATTRIBUTE ((__noreturn__))
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(E) ((void) (E))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(E) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-#if defined __GNUC__ && 407 <= __GNUC__ * 100 + __GNUC_MINOR__
 /* Suppress an incorrect diagnostic about yylval being uninitialized.  */
-# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN \
-    _Pragma ("GCC diagnostic push") \
-    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")\
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
     _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
-# define YY_IGNORE_MAYBE_UNINITIALIZED_END \
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
     _Pragma ("GCC diagnostic pop")
 #else
 # define YY_INITIAL_VALUE(Value) Value
@@ -736,8 +845,22 @@ typedef short int yytype_int16;
 # define YY_INITIAL_VALUE(Value) /* Nothing. */
 #endif
 
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
+#endif
+
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -802,8 +925,7 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
@@ -812,17 +934,17 @@ void free (void *); /* INFRINGES ON USER NAME SPACE */
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss_alloc;
+  yy_state_t yyss_alloc;
   YYSTYPE yyvs_alloc;
 };
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
 # define YYCOPY_NEEDED 1
@@ -835,11 +957,11 @@ union yyalloc
 # define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
     do                                                                  \
       {                                                                 \
-        YYSIZE_T yynewbytes;                                            \
+        YYPTRDIFF_T yynewbytes;                                         \
         YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
         Stack = &yyptr->Stack_alloc;                                    \
-        yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-        yyptr += yynewbytes / sizeof (*yyptr);                          \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
       }                                                                 \
     while (0)
 
@@ -851,12 +973,12 @@ union yyalloc
 # ifndef YYCOPY
 #  if defined __GNUC__ && 1 < __GNUC__
 #   define YYCOPY(Dst, Src, Count) \
-      __builtin_memcpy (Dst, Src, (Count) * sizeof (*(Src)))
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
 #  else
 #   define YYCOPY(Dst, Src, Count)              \
       do                                        \
         {                                       \
-          YYSIZE_T yyi;                         \
+          YYPTRDIFF_T yyi;                      \
           for (yyi = 0; yyi < (Count); yyi++)   \
             (Dst)[yyi] = (Src)[yyi];            \
         }                                       \
@@ -868,28 +990,31 @@ union yyalloc
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  2
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   481
+#define YYLAST   522
 
 /* YYNTOKENS -- Number of terminals.  */
-#define YYNTOKENS  238
+#define YYNTOKENS  259
 /* YYNNTS -- Number of nonterminals.  */
-#define YYNNTS  258
+#define YYNNTS  279
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  493
+#define YYNRULES  535
 /* YYNSTATES -- Number of states.  */
-#define YYNSTATES  738
+#define YYNSTATES  801
+
+/* YYMAXUTOK -- Last valid token kind.  */
+#define YYMAXUTOK   513
 
-/* YYTRANSLATE[YYX] -- Symbol number corresponding to YYX as returned
-   by yylex, with out-of-bounds checking.  */
-#define YYUNDEFTOK  2
-#define YYMAXUTOK   492
 
-#define YYTRANSLATE(YYX)                                                \
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
 
 /* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
-   as returned by yylex, without out-of-bounds checking.  */
-static const yytype_uint8 yytranslate[] =
+   as returned by yylex.  */
+static const yytype_int16 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -940,77 +1065,91 @@ static const yytype_uint8 yytranslate[] =
      205,   206,   207,   208,   209,   210,   211,   212,   213,   214,
      215,   216,   217,   218,   219,   220,   221,   222,   223,   224,
      225,   226,   227,   228,   229,   230,   231,   232,   233,   234,
-     235,   236,   237
+     235,   236,   237,   238,   239,   240,   241,   242,   243,   244,
+     245,   246,   247,   248,   249,   250,   251,   252,   253,   254,
+     255,   256,   257,   258
 };
 
 #if YYDEBUG
-  /* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,   161,   161,   161,   162,   162,   163,   163,   164,   164,
-     164,   165,   165,   166,   170,   175,   176,   177,   177,   177,
-     178,   178,   179,   179,   180,   180,   181,   181,   182,   182,
-     182,   183,   183,   183,   184,   184,   185,   185,   186,   186,
-     187,   187,   188,   188,   189,   189,   190,   190,   191,   191,
-     192,   192,   192,   193,   193,   193,   194,   194,   194,   195,
-     195,   196,   196,   197,   197,   198,   198,   199,   199,   199,
-     200,   200,   201,   201,   202,   202,   202,   203,   203,   204,
-     204,   205,   205,   206,   206,   206,   207,   207,   208,   208,
-     209,   209,   210,   210,   211,   211,   212,   212,   212,   213,
-     213,   214,   214,   214,   215,   215,   215,   216,   216,   216,
-     217,   217,   217,   217,   218,   218,   218,   219,   219,   219,
-     220,   220,   221,   221,   222,   222,   223,   223,   224,   224,
-     224,   225,   225,   226,   226,   227,   228,   228,   229,   229,
-     230,   230,   231,   232,   232,   233,   233,   234,   234,   235,
-     235,   235,   236,   236,   237,   237,   238,   238,   239,   239,
-     240,   240,   240,   241,   241,   241,   242,   242,   242,   243,
-     243,   244,   244,   245,   245,   246,   246,   247,   247,   248,
-     248,   250,   262,   263,   264,   264,   264,   264,   264,   265,
-     267,   279,   280,   281,   281,   281,   281,   282,   284,   298,
-     299,   300,   300,   300,   300,   301,   301,   301,   303,   319,
-     320,   321,   321,   321,   321,   322,   322,   322,   324,   333,
-     342,   353,   362,   371,   380,   391,   400,   411,   424,   439,
-     450,   467,   484,   497,   512,   521,   530,   539,   548,   557,
-     566,   575,   584,   593,   602,   611,   620,   629,   638,   647,
-     656,   663,   670,   679,   686,   694,   703,   712,   726,   735,
-     744,   753,   760,   767,   793,   801,   808,   815,   822,   829,
-     837,   845,   853,   860,   871,   878,   887,   896,   905,   912,
-     919,   927,   935,   945,   955,   965,   978,   989,   997,  1010,
-    1019,  1028,  1037,  1047,  1057,  1065,  1078,  1087,  1095,  1104,
-    1112,  1125,  1134,  1141,  1151,  1161,  1171,  1181,  1191,  1201,
-    1211,  1221,  1228,  1235,  1242,  1251,  1260,  1269,  1276,  1286,
-    1303,  1310,  1328,  1341,  1354,  1363,  1372,  1381,  1390,  1400,
-    1410,  1421,  1430,  1439,  1452,  1465,  1474,  1481,  1490,  1499,
-    1508,  1517,  1525,  1538,  1546,  1575,  1582,  1597,  1607,  1617,
-    1624,  1631,  1640,  1654,  1673,  1692,  1704,  1716,  1728,  1739,
-    1758,  1768,  1777,  1785,  1793,  1806,  1819,  1832,  1845,  1854,
-    1863,  1873,  1883,  1896,  1909,  1920,  1933,  1944,  1957,  1967,
-    1974,  1981,  1990,  2000,  2010,  2020,  2027,  2034,  2043,  2053,
-    2063,  2070,  2077,  2084,  2094,  2104,  2114,  2124,  2154,  2164,
-    2172,  2181,  2196,  2205,  2210,  2211,  2212,  2212,  2212,  2213,
-    2213,  2213,  2214,  2214,  2216,  2226,  2235,  2242,  2252,  2259,
-    2266,  2273,  2280,  2285,  2286,  2287,  2287,  2288,  2288,  2289,
-    2289,  2290,  2291,  2292,  2293,  2294,  2295,  2297,  2305,  2312,
-    2320,  2328,  2335,  2342,  2351,  2360,  2369,  2378,  2387,  2396,
-    2401,  2402,  2403,  2405,  2411,  2421,  2428,  2437,  2445,  2451,
-    2452,  2454,  2454,  2454,  2455,  2455,  2456,  2457,  2458,  2459,
-    2460,  2462,  2472,  2482,  2489,  2498,  2505,  2514,  2522,  2535,
-    2543,  2556,  2561,  2562,  2563,  2563,  2564,  2564,  2564,  2566,
-    2580,  2595,  2607,  2622
+       0,   174,   174,   174,   175,   175,   176,   176,   177,   177,
+     177,   178,   178,   179,   183,   188,   189,   190,   190,   190,
+     191,   191,   192,   192,   193,   193,   194,   194,   195,   195,
+     195,   196,   196,   196,   197,   197,   198,   198,   199,   199,
+     200,   200,   201,   201,   202,   202,   203,   203,   204,   204,
+     205,   205,   205,   206,   206,   206,   207,   207,   207,   208,
+     208,   209,   209,   210,   210,   211,   211,   212,   212,   212,
+     213,   213,   214,   214,   215,   215,   215,   216,   216,   217,
+     217,   218,   218,   219,   219,   219,   220,   220,   221,   221,
+     222,   222,   223,   223,   224,   224,   225,   225,   225,   226,
+     226,   227,   227,   227,   228,   228,   228,   229,   229,   229,
+     230,   230,   230,   230,   231,   231,   231,   232,   232,   232,
+     233,   233,   234,   234,   235,   235,   236,   236,   237,   237,
+     237,   238,   238,   239,   239,   240,   241,   241,   242,   242,
+     243,   243,   244,   245,   245,   246,   246,   247,   247,   248,
+     248,   248,   249,   249,   250,   250,   251,   251,   252,   252,
+     253,   253,   253,   254,   254,   254,   255,   255,   255,   256,
+     256,   257,   257,   258,   258,   259,   259,   260,   260,   261,
+     261,   262,   262,   263,   263,   264,   264,   265,   265,   266,
+     268,   280,   281,   282,   282,   282,   282,   282,   283,   285,
+     297,   298,   299,   299,   299,   299,   300,   302,   316,   317,
+     318,   318,   318,   318,   319,   319,   319,   321,   337,   338,
+     339,   339,   339,   339,   340,   340,   340,   342,   351,   360,
+     371,   380,   389,   398,   409,   418,   429,   442,   457,   468,
+     485,   502,   515,   530,   539,   548,   557,   566,   575,   584,
+     593,   602,   611,   620,   629,   638,   647,   656,   665,   674,
+     681,   688,   697,   704,   712,   721,   730,   744,   753,   762,
+     771,   780,   789,   798,   805,   812,   838,   846,   853,   860,
+     867,   874,   882,   890,   898,   905,   916,   923,   932,   941,
+     950,   957,   964,   972,   980,   990,  1000,  1010,  1023,  1034,
+    1042,  1055,  1065,  1074,  1083,  1092,  1102,  1112,  1120,  1133,
+    1143,  1152,  1160,  1169,  1177,  1190,  1199,  1206,  1216,  1226,
+    1236,  1246,  1256,  1266,  1276,  1286,  1293,  1300,  1307,  1316,
+    1325,  1334,  1341,  1351,  1368,  1375,  1393,  1406,  1419,  1428,
+    1437,  1446,  1455,  1465,  1475,  1486,  1495,  1504,  1517,  1530,
+    1539,  1546,  1555,  1564,  1573,  1582,  1590,  1603,  1611,  1640,
+    1647,  1662,  1672,  1682,  1689,  1696,  1705,  1719,  1738,  1757,
+    1769,  1781,  1793,  1804,  1823,  1833,  1842,  1850,  1858,  1871,
+    1884,  1897,  1910,  1919,  1928,  1938,  1948,  1958,  1967,  1976,
+    1985,  1998,  2011,  2022,  2035,  2046,  2059,  2069,  2076,  2083,
+    2092,  2102,  2112,  2122,  2129,  2136,  2145,  2155,  2165,  2172,
+    2179,  2186,  2196,  2206,  2216,  2226,  2256,  2266,  2274,  2283,
+    2298,  2307,  2312,  2313,  2314,  2314,  2314,  2315,  2315,  2315,
+    2316,  2316,  2318,  2328,  2337,  2344,  2354,  2361,  2368,  2375,
+    2382,  2387,  2388,  2389,  2389,  2390,  2390,  2391,  2391,  2392,
+    2393,  2394,  2395,  2396,  2397,  2398,  2398,  2398,  2399,  2399,
+    2400,  2401,  2402,  2403,  2404,  2405,  2406,  2408,  2416,  2423,
+    2431,  2439,  2446,  2453,  2462,  2471,  2480,  2489,  2498,  2507,
+    2519,  2526,  2535,  2544,  2553,  2561,  2569,  2577,  2585,  2593,
+    2601,  2611,  2616,  2617,  2618,  2620,  2626,  2636,  2643,  2652,
+    2660,  2666,  2667,  2669,  2669,  2669,  2670,  2670,  2671,  2672,
+    2673,  2674,  2675,  2677,  2687,  2697,  2704,  2713,  2720,  2729,
+    2737,  2750,  2758,  2771,  2776,  2777,  2778,  2778,  2779,  2779,
+    2779,  2781,  2795,  2810,  2822,  2837
 };
 #endif
 
-#if YYDEBUG || YYERROR_VERBOSE || 0
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
+
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
+
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "SPACE", "LETTER", "NEWLINE", "COMMENT",
-  "COLON", "ANY", "ZONESTR", "STRING_ARG", "VAR_SERVER", "VAR_VERBOSITY",
-  "VAR_NUM_THREADS", "VAR_PORT", "VAR_OUTGOING_RANGE", "VAR_INTERFACE",
-  "VAR_DO_IP4", "VAR_DO_IP6", "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP",
-  "VAR_TCP_MSS", "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME",
-  "VAR_DIRECTORY", "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
+  "\"end of file\"", "error", "\"invalid token\"", "SPACE", "LETTER",
+  "NEWLINE", "COMMENT", "COLON", "ANY", "ZONESTR", "STRING_ARG",
+  "VAR_SERVER", "VAR_VERBOSITY", "VAR_NUM_THREADS", "VAR_PORT",
+  "VAR_OUTGOING_RANGE", "VAR_INTERFACE", "VAR_DO_IP4", "VAR_DO_IP6",
+  "VAR_PREFER_IP6", "VAR_DO_UDP", "VAR_DO_TCP", "VAR_TCP_MSS",
+  "VAR_OUTGOING_TCP_MSS", "VAR_CHROOT", "VAR_USERNAME", "VAR_DIRECTORY",
+  "VAR_LOGFILE", "VAR_PIDFILE", "VAR_MSG_CACHE_SIZE",
   "VAR_MSG_CACHE_SLABS", "VAR_NUM_QUERIES_PER_THREAD",
   "VAR_RRSET_CACHE_SIZE", "VAR_RRSET_CACHE_SLABS", "VAR_OUTGOING_NUM_TCP",
   "VAR_INFRA_HOST_TTL", "VAR_INFRA_LAME_TTL", "VAR_INFRA_CACHE_SLABS",
@@ -1091,7 +1230,20 @@ static const char *const yytname[] =
   "VAR_CACHEDB_REDISTIMEOUT", "VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM",
   "VAR_FOR_UPSTREAM", "VAR_AUTH_ZONE", "VAR_ZONEFILE", "VAR_MASTER",
   "VAR_URL", "VAR_FOR_DOWNSTREAM", "VAR_FALLBACK_ENABLED",
-  "VAR_ADDITIONAL_TLS_PORT", "$accept", "toplevelvars", "toplevelvar",
+  "VAR_ADDITIONAL_TLS_PORT", "VAR_UPSTREAM_RACE",
+  "VAR_UPSTREAM_RACE_DELAY", "VAR_UPSTREAM_RACE_MAX",
+  "VAR_UPSTREAM_RACE_BUDGET", "VAR_LOG_MODULE_TIME", "VAR_DNSTAP_IP",
+  "VAR_DNSTAP_FILE", "VAR_DNSTAP_FILE_ROTATE_SIZE",
+  "VAR_DNSTAP_FILE_ROTATE_INTERVAL", "VAR_DNSTAP_RING_SIZE",
+  "VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES",
+  "VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES",
+  "VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES",
+  "VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES",
+  "VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES",
+  "VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES",
+  "VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL", "VAR_IP_RATELIMIT_SKETCH",
+  "VAR_HEAVY_HITTERS_SIZE", "VAR_CACHE_HUGE_PAGES",
+  "VAR_MSG_CACHE_WIREFORMAT", "$accept", "toplevelvars", "toplevelvar",
   "serverstart", "contents_server", "content_server", "stubstart",
   "contents_stub", "content_stub", "forwardstart", "contents_forward",
   "content_forward", "viewstart", "contents_view", "content_view",
@@ -1113,20 +1265,23 @@ static const char *const yytname[] =
   "server_tls_cert_bundle", "server_additional_tls_port",
   "server_use_systemd", "server_do_daemonize", "server_use_syslog",
   "server_log_time_ascii", "server_log_queries", "server_log_replies",
-  "server_chroot", "server_username", "server_directory", "server_logfile",
-  "server_pidfile", "server_root_hints", "server_dlv_anchor_file",
-  "server_dlv_anchor", "server_auto_trust_anchor_file",
-  "server_trust_anchor_file", "server_trusted_keys_file",
-  "server_trust_anchor", "server_trust_anchor_signaling",
-  "server_domain_insecure", "server_hide_identity", "server_hide_version",
-  "server_hide_trustanchor", "server_identity", "server_version",
-  "server_so_rcvbuf", "server_so_sndbuf", "server_so_reuseport",
-  "server_ip_transparent", "server_ip_freebind", "server_edns_buffer_size",
+  "server_log_module_time", "server_ip_ratelimit_sketch",
+  "server_heavy_hitters_size", "server_chroot", "server_username",
+  "server_directory", "server_logfile", "server_pidfile",
+  "server_root_hints", "server_dlv_anchor_file", "server_dlv_anchor",
+  "server_auto_trust_anchor_file", "server_trust_anchor_file",
+  "server_trusted_keys_file", "server_trust_anchor",
+  "server_trust_anchor_signaling", "server_domain_insecure",
+  "server_hide_identity", "server_hide_version", "server_hide_trustanchor",
+  "server_identity", "server_version", "server_so_rcvbuf",
+  "server_so_sndbuf", "server_so_reuseport", "server_ip_transparent",
+  "server_ip_freebind", "server_edns_buffer_size",
   "server_msg_buffer_size", "server_msg_cache_size",
-  "server_msg_cache_slabs", "server_num_queries_per_thread",
-  "server_jostle_timeout", "server_delay_close",
-  "server_unblock_lan_zones", "server_insecure_lan_zones",
-  "server_rrset_cache_size", "server_rrset_cache_slabs",
+  "server_msg_cache_slabs", "server_msg_cache_wireformat",
+  "server_num_queries_per_thread", "server_jostle_timeout",
+  "server_delay_close", "server_unblock_lan_zones",
+  "server_insecure_lan_zones", "server_rrset_cache_size",
+  "server_rrset_cache_slabs", "server_cache_huge_pages",
   "server_infra_host_ttl", "server_infra_lame_ttl",
   "server_infra_cache_numhosts", "server_infra_cache_lame_size",
   "server_infra_cache_slabs", "server_infra_cache_min_rtt",
@@ -1161,7 +1316,9 @@ static const char *const yytname[] =
   "server_ratelimit_slabs", "server_ratelimit_for_domain",
   "server_ratelimit_below_domain", "server_ip_ratelimit_factor",
   "server_ratelimit_factor", "server_qname_minimisation",
-  "server_qname_minimisation_strict", "server_ipsecmod_enabled",
+  "server_qname_minimisation_strict", "server_upstream_race",
+  "server_upstream_race_delay", "server_upstream_race_max",
+  "server_upstream_race_budget", "server_ipsecmod_enabled",
   "server_ipsecmod_ignore_bogus", "server_ipsecmod_hook",
   "server_ipsecmod_max_ttl", "server_ipsecmod_whitelist",
   "server_ipsecmod_strict", "stub_name", "stub_host", "stub_addr",
@@ -1183,11 +1340,19 @@ static const char *const yytname[] =
   "dt_dnstap_log_client_query_messages",
   "dt_dnstap_log_client_response_messages",
   "dt_dnstap_log_forwarder_query_messages",
-  "dt_dnstap_log_forwarder_response_messages", "pythonstart",
-  "contents_py", "content_py", "py_script",
-  "server_disable_dnssec_lame_check", "server_log_identity",
-  "server_response_ip", "server_response_ip_data", "dnscstart",
-  "contents_dnsc", "content_dnsc", "dnsc_dnscrypt_enable",
+  "dt_dnstap_log_forwarder_response_messages", "dt_dnstap_ip",
+  "dt_dnstap_file", "dt_dnstap_file_rotate_size",
+  "dt_dnstap_file_rotate_interval", "dt_dnstap_ring_size",
+  "dt_dnstap_sample_resolver_query_messages",
+  "dt_dnstap_sample_resolver_response_messages",
+  "dt_dnstap_sample_client_query_messages",
+  "dt_dnstap_sample_client_response_messages",
+  "dt_dnstap_sample_forwarder_query_messages",
+  "dt_dnstap_sample_forwarder_response_messages",
+  "dt_dnstap_sample_keep_servfail", "pythonstart", "contents_py",
+  "content_py", "py_script", "server_disable_dnssec_lame_check",
+  "server_log_identity", "server_response_ip", "server_response_ip_data",
+  "dnscstart", "contents_dnsc", "content_dnsc", "dnsc_dnscrypt_enable",
   "dnsc_dnscrypt_port", "dnsc_dnscrypt_provider",
   "dnsc_dnscrypt_provider_cert", "dnsc_dnscrypt_provider_cert_rotated",
   "dnsc_dnscrypt_secret_key", "dnsc_dnscrypt_shared_secret_cache_size",
@@ -1197,138 +1362,119 @@ static const char *const yytname[] =
   "cachedb_backend_name", "cachedb_secret_seed", "redis_server_host",
   "redis_server_port", "redis_timeout", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[NUM] -- (External) token number corresponding to the
-   (internal) symbol number NUM (which must be that of a token).  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,   281,   282,   283,   284,
-     285,   286,   287,   288,   289,   290,   291,   292,   293,   294,
-     295,   296,   297,   298,   299,   300,   301,   302,   303,   304,
-     305,   306,   307,   308,   309,   310,   311,   312,   313,   314,
-     315,   316,   317,   318,   319,   320,   321,   322,   323,   324,
-     325,   326,   327,   328,   329,   330,   331,   332,   333,   334,
-     335,   336,   337,   338,   339,   340,   341,   342,   343,   344,
-     345,   346,   347,   348,   349,   350,   351,   352,   353,   354,
-     355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
-     365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
-     375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397,   398,   399,   400,   401,   402,   403,   404,
-     405,   406,   407,   408,   409,   410,   411,   412,   413,   414,
-     415,   416,   417,   418,   419,   420,   421,   422,   423,   424,
-     425,   426,   427,   428,   429,   430,   431,   432,   433,   434,
-     435,   436,   437,   438,   439,   440,   441,   442,   443,   444,
-     445,   446,   447,   448,   449,   450,   451,   452,   453,   454,
-     455,   456,   457,   458,   459,   460,   461,   462,   463,   464,
-     465,   466,   467,   468,   469,   470,   471,   472,   473,   474,
-     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   488,   489,   490,   491,   492
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-#define YYPACT_NINF -195
+#define YYPACT_NINF (-145)
 
-#define yypact_value_is_default(Yystate) \
-  (!!((Yystate) == (-195)))
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-#define YYTABLE_NINF -1
+#define YYTABLE_NINF (-1)
 
-#define yytable_value_is_error(Yytable_value) \
+#define yytable_value_is_error(Yyn) \
   0
 
-  /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
-     STATE-NUM.  */
+/* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
+   STATE-NUM.  */
 static const yytype_int16 yypact[] =
 {
-    -195,     0,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,   220,   -37,   -32,   -39,   -38,   -25,
-    -129,  -104,  -159,  -194,    -3,    -1,     2,     3,     4,     5,
-      25,    26,    29,    30,    32,    33,    34,    35,    36,    48,
-      49,    50,    51,    53,    54,    55,    65,    66,    67,    68,
-      69,    70,    71,    72,    73,    74,    75,    76,    77,    78,
-      79,    80,    82,    83,    84,    85,    87,    88,    91,    93,
-      94,    95,    96,    98,    99,   100,   101,   102,   103,   104,
-     105,   106,   107,   108,   109,   110,   113,   114,   115,   116,
-     117,   118,   119,   120,   121,   122,   123,   124,   125,   126,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   137,
-     138,   139,   140,   141,   142,   143,   144,   145,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     159,   160,   161,   162,   163,   164,   165,   166,   167,   168,
-     169,   170,   171,   172,   173,   174,   175,   176,   177,   178,
-     179,   180,   181,   189,   190,   191,   192,   193,   194,   195,
-     197,   198,   199,   200,   201,   202,   203,   204,   205,   206,
-     207,   208,   209,   210,   211,   212,   214,   215,   216,   217,
-     218,   219,   250,   251,   252,   253,   257,   258,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,   259,   301,   302,   303,   304,   305,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,   306,   307,   308,   309,
-     313,  -195,  -195,  -195,  -195,  -195,  -195,   317,   318,   342,
-     343,   344,   346,   356,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,   357,   358,   359,   360,   361,   362,   363,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,   364,   365,   366,
-     367,   368,   403,   405,   416,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,   417,   418,   419,   420,   421,   422,
-     423,   424,   425,   426,   433,   434,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,   435,
-    -195,  -195,   436,   437,   438,   440,   441,   442,   443,   444,
-     445,   446,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,   448,   449,   450,   451,   452,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-     453,   454,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,   455,   456,   457,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,   458,   459,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,   460,   461,   462,   463,   464,   465,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-     466,  -195,  -195,   467,   468,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,   469,   470,
-     471,  -195,  -195,  -195,  -195,  -195,  -195,  -195
+    -145,   200,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,   -12,   100,   164,   155,    39,   156,
+     110,   -80,    69,  -144,    19,    20,    21,    25,    26,    27,
+      75,    76,    77,    81,    85,    86,   111,   112,   114,   124,
+     125,   126,   127,   128,   129,   131,   134,   135,   136,   171,
+     173,   184,   186,   187,   188,   189,   191,   192,   204,   205,
+     206,   208,   209,   210,   211,   212,   213,   214,   224,   225,
+     227,   228,   229,   230,   232,   260,   276,   277,   278,   279,
+     280,   282,   283,   284,   285,   287,   289,   290,   291,   292,
+     293,   294,   295,   296,   298,   299,   300,   301,   302,   303,
+     304,   307,   308,   309,   310,   311,   312,   313,   314,   315,
+     316,   317,   318,   319,   320,   321,   322,   323,   324,   325,
+     326,   327,   328,   329,   330,   331,   332,   333,   334,   335,
+     337,   338,   339,   341,   342,   355,   356,   357,   358,   359,
+     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   384,   385,   386,   387,   388,   389,   390,
+     391,   392,   393,   394,   395,   397,   398,   399,   400,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   414,   415,   416,   417,   418,   419,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,   420,   422,   423,   424,   425,   426,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,   427,   428,   429,   430,   431,  -145,
+    -145,  -145,  -145,  -145,  -145,   432,   433,   434,   435,   436,
+     437,   438,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+     439,   440,   441,   442,   443,   444,   445,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,   446,   447,   448,   449,   450,
+     451,   452,   453,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,   454,   455,   456,   457,   458,   459,   460,   461,
+     462,   463,   464,   465,   466,   467,   468,   469,   470,   471,
+     472,   473,   474,   475,   476,   477,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,   478,  -145,  -145,   479,   480,   481,   482,   483,   484,
+     485,   486,   487,   488,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,   489,   490,   491,   492,   493,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,   494,   495,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,   496,   497,   498,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,   499,
+     500,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,   501,   502,   503,   504,
+     505,   506,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,   507,  -145,  -145,   508,   509,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,   510,   511,   512,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145
 };
 
-  /* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
-     Performed when YYTABLE does not specify something else to do.  Zero
-     means the default is an error.  */
-static const yytype_uint16 yydefact[] =
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int16 yydefact[] =
 {
-       2,     0,     1,    14,   181,   190,   403,   449,   422,   198,
-     458,   481,   208,     3,    16,   183,   192,   200,   210,   405,
-     424,   451,   460,   483,     4,     5,     6,    10,    13,     8,
+       2,     0,     1,    14,   190,   199,   421,   491,   440,   207,
+     500,   523,   217,     3,    16,   192,   201,   209,   219,   423,
+     442,   493,   502,   525,     4,     5,     6,    10,    13,     8,
        9,     7,    11,    12,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
@@ -1345,242 +1491,261 @@ static const yytype_uint16 yydefact[] =
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,    15,    17,
-      18,    77,    80,    89,   166,   167,    19,   139,   140,   141,
-     142,   143,   144,    28,    68,    20,    81,    82,    39,    61,
-      76,    21,    22,    24,    25,    23,    26,    27,   112,   177,
-     113,   114,   115,   116,   179,   180,   162,    78,    67,    93,
-     110,   111,    29,    30,    31,    32,    33,    69,    83,    84,
-      99,    55,    65,    56,   170,    94,    49,    50,   169,    51,
-      52,   103,   107,   120,   128,   149,   104,    62,    34,    35,
-      36,    91,   121,   122,   123,    37,    38,    40,    41,    43,
-      44,    42,   126,    45,    46,    47,    53,    72,   108,    86,
-     127,    79,   145,    87,    88,   105,   106,    92,    48,    70,
-      73,    54,    57,    95,    96,    71,   146,    97,    58,    59,
-      60,   178,   109,   159,   160,   168,    98,    66,   100,   101,
-     102,   147,    63,    64,    85,    74,    75,    90,   117,   118,
-     119,   124,   125,   150,   151,   153,   155,   156,   154,   157,
-     163,   129,   130,   133,   134,   131,   132,   135,   136,   138,
-     137,   148,   158,   171,   173,   172,   174,   175,   176,   152,
-     161,   164,   165,     0,     0,     0,     0,     0,     0,   182,
-     184,   185,   186,   188,   189,   187,     0,     0,     0,     0,
-       0,   191,   193,   194,   195,   196,   197,     0,     0,     0,
-       0,     0,     0,     0,   199,   201,   202,   205,   206,   203,
-     207,   204,     0,     0,     0,     0,     0,     0,     0,   209,
-     211,   212,   213,   214,   215,   216,   217,     0,     0,     0,
-       0,     0,     0,     0,     0,   404,   406,   408,   407,   413,
-     409,   410,   411,   412,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   423,   425,   426,   427,
-     428,   429,   430,   431,   432,   433,   434,   435,   436,     0,
-     450,   452,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   459,   461,   462,   463,   465,   466,   464,   467,
-     468,   469,   470,     0,     0,     0,     0,     0,   482,   484,
-     485,   486,   487,   488,   219,   218,   225,   234,   232,   240,
-     241,   244,   242,   243,   245,   246,   261,   262,   263,   264,
-     265,   287,   288,   289,   294,   295,   237,   296,   297,   300,
-     298,   299,   302,   303,   304,   317,   275,   276,   278,   279,
-     305,   320,   270,   272,   321,   327,   328,   329,   238,   286,
-     341,   342,   271,   336,   257,   233,   266,   318,   324,   306,
-       0,     0,   345,   239,   220,   256,   310,   221,   235,   236,
-     267,   268,   343,   308,   312,   313,   222,   346,   290,   316,
-     258,   274,   322,   323,   326,   335,   269,   339,   337,   338,
-     280,   285,   314,   315,   281,   282,   307,   331,   259,   260,
-     247,   249,   250,   251,   252,   253,   347,   348,   349,   291,
-     292,   293,   301,   350,   351,     0,     0,     0,   309,   283,
-     454,   360,   364,   362,   361,   365,   363,     0,     0,   368,
-     369,   226,   227,   228,   229,   230,   231,   311,   325,   340,
-     370,   371,   284,   352,     0,     0,     0,     0,     0,     0,
-     332,   333,   334,   455,   277,   273,   330,   255,   223,   224,
-     372,   374,   373,   375,   376,   377,   248,   254,   378,   379,
-     380,   383,   382,   381,   384,   385,   386,   387,   388,   396,
-       0,   400,   401,     0,     0,   402,   389,   394,   390,   391,
-     392,   393,   395,   414,   416,   415,   418,   419,   420,   421,
-     417,   437,   438,   439,   440,   441,   442,   443,   444,   445,
-     446,   447,   448,   453,   471,   472,   473,   476,   474,   475,
-     477,   478,   479,   480,   489,   490,   491,   492,   493,   319,
-     344,   359,   456,   457,   366,   367,   353,   354,     0,     0,
-       0,   358,   397,   398,   399,   357,   355,   356
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,    15,    17,    18,
+      77,    80,    89,   166,   167,    19,   139,   140,   141,   142,
+     143,   144,    28,    68,    20,    81,    82,    39,    61,    76,
+      21,    22,    24,    25,    23,    26,    27,   112,   177,   113,
+     114,   115,   116,   179,   180,   162,    78,    67,    93,   110,
+     111,   185,   186,   187,    29,    30,    31,    32,    33,    69,
+      83,    84,    99,    55,    65,    56,   170,    94,    49,    50,
+     169,    51,    52,   103,   107,   120,   128,   149,   104,    62,
+      34,    35,   189,    36,    91,   121,   122,   123,    37,    38,
+     188,    40,    41,    43,    44,    42,   126,    45,    46,    47,
+      53,    72,   108,    86,   127,    79,   145,    87,    88,   105,
+     106,    92,    48,    70,    73,    54,    57,    95,    96,    71,
+     146,    97,    58,    59,    60,   178,   109,   159,   160,   168,
+      98,    66,   100,   101,   102,   147,    63,    64,    85,    74,
+      75,    90,   117,   118,   119,   124,   125,   150,   151,   153,
+     155,   156,   154,   157,   163,   129,   130,   133,   134,   131,
+     132,   135,   136,   138,   137,   148,   158,   181,   182,   183,
+     184,   171,   173,   172,   174,   175,   176,   152,   161,   164,
+     165,     0,     0,     0,     0,     0,     0,   191,   193,   194,
+     195,   197,   198,   196,     0,     0,     0,     0,     0,   200,
+     202,   203,   204,   205,   206,     0,     0,     0,     0,     0,
+       0,     0,   208,   210,   211,   214,   215,   212,   216,   213,
+       0,     0,     0,     0,     0,     0,     0,   218,   220,   221,
+     222,   223,   224,   225,   226,     0,     0,     0,     0,     0,
+       0,     0,     0,   422,   424,   426,   425,   431,   427,   428,
+     429,   430,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,     0,   441,   443,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,   458,   459,   460,   461,   462,   463,   464,   465,
+     466,     0,   492,   494,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,   501,   503,   504,   505,   507,   508,
+     506,   509,   510,   511,   512,     0,     0,     0,     0,     0,
+     524,   526,   527,   528,   529,   530,   228,   227,   234,   243,
+     241,   249,   250,   253,   251,   252,   254,   255,   273,   274,
+     275,   276,   277,   299,   300,   302,   307,   308,   246,   310,
+     311,   314,   312,   313,   316,   317,   318,   331,   287,   288,
+     290,   291,   319,   334,   282,   284,   335,   341,   342,   343,
+     247,   298,   355,   356,   283,   350,   266,   242,   278,   332,
+     338,   320,     0,     0,   359,   248,   229,   265,   324,   230,
+     244,   245,   279,   280,   357,   322,   326,   327,   231,   360,
+     303,   330,   267,   286,   336,   337,   340,   349,   281,   353,
+     351,   352,   292,   297,   328,   329,   293,   294,   321,   345,
+     268,   269,   256,   258,   259,   260,   261,   262,   361,   362,
+     363,   304,   305,   306,   315,   364,   365,     0,     0,     0,
+     323,   295,   496,   374,   378,   376,   375,   379,   377,     0,
+       0,   382,   383,   235,   236,   237,   238,   239,   240,   325,
+     339,   354,   384,   385,   296,   366,     0,     0,     0,     0,
+       0,     0,   346,   347,   348,   497,   289,   285,   344,   264,
+     232,   233,   390,   392,   391,   393,   394,   395,   257,   263,
+     386,   387,   388,   389,   270,   271,   272,   309,   301,   396,
+     397,   398,   401,   400,   399,   402,   403,   404,   405,   406,
+     414,     0,   418,   419,     0,     0,   420,   407,   412,   408,
+     409,   410,   411,   413,   432,   434,   433,   436,   437,   438,
+     439,   435,   467,   468,   469,   470,   471,   472,   473,   474,
+     475,   476,   477,   478,   479,   480,   481,   482,   483,   484,
+     485,   486,   487,   488,   489,   490,   495,   513,   514,   515,
+     518,   516,   517,   519,   520,   521,   522,   531,   532,   533,
+     534,   535,   333,   358,   373,   498,   499,   380,   381,   367,
+     368,     0,     0,     0,   372,   415,   416,   417,   371,   369,
+     370
 };
 
-  /* YYPGOTO[NTERM-NUM].  */
+/* YYPGOTO[NTERM-NUM].  */
 static const yytype_int16 yypgoto[] =
 {
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195,
-    -195,  -195,  -195,  -195,  -195,  -195,  -195,  -195
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,
+    -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145,  -145
 };
 
-  /* YYDEFGOTO[NTERM-NUM].  */
+/* YYDEFGOTO[NTERM-NUM].  */
 static const yytype_int16 yydefgoto[] =
 {
-      -1,     1,    13,    14,    24,   198,    15,    25,   369,    16,
-      26,   381,    17,    27,   394,    18,    28,   409,   199,   200,
-     201,   202,   203,   204,   205,   206,   207,   208,   209,   210,
-     211,   212,   213,   214,   215,   216,   217,   218,   219,   220,
-     221,   222,   223,   224,   225,   226,   227,   228,   229,   230,
-     231,   232,   233,   234,   235,   236,   237,   238,   239,   240,
-     241,   242,   243,   244,   245,   246,   247,   248,   249,   250,
-     251,   252,   253,   254,   255,   256,   257,   258,   259,   260,
-     261,   262,   263,   264,   265,   266,   267,   268,   269,   270,
-     271,   272,   273,   274,   275,   276,   277,   278,   279,   280,
-     281,   282,   283,   284,   285,   286,   287,   288,   289,   290,
-     291,   292,   293,   294,   295,   296,   297,   298,   299,   300,
-     301,   302,   303,   304,   305,   306,   307,   308,   309,   310,
-     311,   312,   313,   314,   315,   316,   317,   318,   319,   320,
-     321,   322,   323,   324,   325,   326,   327,   328,   329,   330,
-     331,   332,   333,   334,   335,   336,   337,   338,   339,   340,
-     341,   342,   343,   344,   345,   346,   347,   348,   349,   350,
-     351,   352,   353,   354,   355,   356,   357,   358,   370,   371,
-     372,   373,   374,   375,   382,   383,   384,   385,   386,   410,
-     411,   412,   413,   414,   415,   416,   395,   396,   397,   398,
-     399,   400,   401,    19,    29,   425,   426,   427,   428,   429,
-     430,   431,   432,   433,    20,    30,   446,   447,   448,   449,
-     450,   451,   452,   453,   454,   455,   456,   457,   458,    21,
-      31,   460,   461,   359,   360,   361,   362,    22,    32,   472,
-     473,   474,   475,   476,   477,   478,   479,   480,   481,   482,
-      23,    33,   488,   489,   490,   491,   492,   493
+       0,     1,    13,    14,    24,   207,    15,    25,   387,    16,
+      26,   399,    17,    27,   412,    18,    28,   427,   208,   209,
+     210,   211,   212,   213,   214,   215,   216,   217,   218,   219,
+     220,   221,   222,   223,   224,   225,   226,   227,   228,   229,
+     230,   231,   232,   233,   234,   235,   236,   237,   238,   239,
+     240,   241,   242,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,   263,   264,   265,   266,   267,   268,   269,
+     270,   271,   272,   273,   274,   275,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
+     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   388,   389,   390,
+     391,   392,   393,   400,   401,   402,   403,   404,   428,   429,
+     430,   431,   432,   433,   434,   413,   414,   415,   416,   417,
+     418,   419,    19,    29,   443,   444,   445,   446,   447,   448,
+     449,   450,   451,    20,    30,   476,   477,   478,   479,   480,
+     481,   482,   483,   484,   485,   486,   487,   488,   489,   490,
+     491,   492,   493,   494,   495,   496,   497,   498,   499,   500,
+      21,    31,   502,   503,   377,   378,   379,   380,    22,    32,
+     514,   515,   516,   517,   518,   519,   520,   521,   522,   523,
+     524,    23,    33,   530,   531,   532,   533,   534,   535
 };
 
-  /* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
-     positive, shift that token.  If negative, reduce the rule whose
-     number is the opposite.  If YYTABLE_NINF, syntax error.  */
-static const yytype_uint16 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int16 yytable[] =
 {
-       2,   387,   402,   363,   459,   364,   365,   494,   376,   495,
-       0,     3,   496,   497,   498,   499,   377,   378,   434,   435,
-     436,   437,   438,   439,   440,   441,   442,   443,   444,   445,
-     483,   484,   485,   486,   487,   500,   501,   388,   389,   502,
-     503,     4,   504,   505,   506,   507,   508,     5,   462,   463,
-     464,   465,   466,   467,   468,   469,   470,   471,   509,   510,
-     511,   512,   390,   513,   514,   515,   366,   417,   418,   419,
-     420,   421,   422,   423,   424,   516,   517,   518,   519,   520,
-     521,   522,   523,   524,   525,   526,   527,   528,   529,   530,
-     531,     6,   532,   533,   534,   535,   367,   536,   537,   368,
-     379,   538,   380,   539,   540,   541,   542,     7,   543,   544,
-     545,   546,   547,   548,   549,   550,   551,   552,   553,   554,
-     555,   391,   392,   556,   557,   558,   559,   560,   561,   562,
-     563,   564,   565,   566,   567,   568,   569,   570,   571,   572,
-     573,   574,   575,   576,   577,   578,     8,   579,   580,   581,
-     582,   583,   584,   585,   586,   587,   393,   588,   589,   590,
-     591,   592,   593,   594,   595,   596,   597,   598,   599,   600,
-     601,   602,   603,   604,   605,   606,   607,   608,   609,   610,
-     611,   612,   613,   614,   615,   616,   617,   618,   619,   620,
-     621,   622,   403,     9,   404,   405,   406,   407,   408,   623,
-     624,   625,   626,   627,   628,   629,    10,   630,   631,   632,
-     633,   634,   635,   636,   637,   638,   639,   640,   641,   642,
-     643,   644,   645,    11,   646,   647,   648,   649,   650,   651,
-       0,    12,    34,    35,    36,    37,    38,    39,    40,    41,
-      42,    43,    44,    45,    46,    47,    48,    49,    50,    51,
-      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
-     652,   653,   654,   655,    62,    63,    64,   656,   657,   658,
-      65,    66,    67,    68,    69,    70,    71,    72,    73,    74,
-      75,    76,    77,    78,    79,    80,    81,    82,    83,    84,
-      85,    86,    87,    88,    89,    90,    91,    92,    93,    94,
-      95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
-     105,   659,   660,   661,   662,   663,   664,   665,   666,   667,
-     106,   107,   108,   668,   109,   110,   111,   669,   670,   112,
-     113,   114,   115,   116,   117,   118,   119,   120,   121,   122,
-     123,   124,   125,   126,   127,   128,   129,   130,   131,   132,
-     133,   134,   671,   672,   673,   135,   674,   136,   137,   138,
-     139,   140,   141,   142,   143,   144,   675,   676,   677,   678,
-     679,   680,   681,   682,   683,   684,   685,   686,   687,   145,
-     146,   147,   148,   149,   150,   151,   152,   153,   154,   155,
-     156,   157,   158,   159,   160,   161,   162,   163,   164,   165,
-     166,   167,   168,   169,   170,   171,   172,   173,   174,   175,
-     176,   177,   178,   688,   179,   689,   180,   181,   182,   183,
-     184,   185,   186,   187,   188,   189,   690,   691,   692,   693,
-     694,   695,   696,   697,   698,   699,   700,   190,   191,   192,
-     193,   194,   195,   701,   702,   703,   704,   705,   706,   196,
-     707,   708,   709,   710,   711,   712,   713,   197,   714,   715,
-     716,   717,   718,   719,   720,   721,   722,   723,   724,   725,
-     726,   727,   728,   729,   730,   731,   732,   733,   734,   735,
-     736,   737
+      34,    35,    36,    37,    38,    39,    40,    41,    42,    43,
+      44,    45,    46,    47,    48,    49,    50,    51,    52,    53,
+      54,    55,    56,    57,    58,    59,    60,    61,   501,   536,
+     537,   538,    62,    63,    64,   539,   540,   541,    65,    66,
+      67,    68,    69,    70,    71,    72,    73,    74,    75,    76,
+      77,    78,    79,    80,    81,    82,    83,    84,    85,    86,
+      87,    88,    89,    90,    91,    92,    93,    94,    95,    96,
+      97,    98,    99,   100,   101,   102,   103,   104,   105,   420,
+     525,   526,   527,   528,   529,   542,   543,   544,   106,   107,
+     108,   545,   109,   110,   111,   546,   547,   112,   113,   114,
+     115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+       0,   548,   549,   135,   550,   136,   137,   138,   139,   140,
+     141,   142,   143,   144,   551,   552,   553,   554,   555,   556,
+     381,   557,   382,   383,   558,   559,   560,   145,   146,   147,
+     148,   149,   150,   151,   152,   153,   154,   155,   156,   157,
+     158,   159,   160,   161,   162,   163,   164,   165,   166,   167,
+     168,   169,   170,   171,   172,   173,   174,   175,   176,   177,
+     178,   561,   179,   562,   180,   181,   182,   183,   184,   185,
+     186,   187,   188,   189,   563,   405,   564,   565,   566,   567,
+       2,   568,   569,   384,   394,   190,   191,   192,   193,   194,
+     195,     3,   395,   396,   570,   571,   572,   196,   573,   574,
+     575,   576,   577,   578,   579,   197,   198,   199,   200,   201,
+     202,   406,   407,   385,   580,   581,   386,   582,   583,   584,
+     585,     4,   586,   203,   204,   205,   206,     5,   435,   436,
+     437,   438,   439,   440,   441,   442,   408,   452,   453,   454,
+     455,   456,   457,   458,   459,   460,   461,   462,   463,   421,
+     587,   422,   423,   424,   425,   426,   504,   505,   506,   507,
+     508,   509,   510,   511,   512,   513,   588,   589,   590,   591,
+     592,     6,   593,   594,   595,   596,   397,   597,   398,   598,
+     599,   600,   601,   602,   603,   604,   605,     7,   606,   607,
+     608,   609,   610,   611,   612,   409,   410,   613,   614,   615,
+     616,   617,   618,   619,   620,   621,   622,   623,   624,   625,
+     626,   627,   628,   629,   630,   631,   632,   633,   634,   635,
+     636,   637,   638,   639,   640,   641,     8,   642,   643,   644,
+     411,   645,   646,   464,   465,   466,   467,   468,   469,   470,
+     471,   472,   473,   474,   475,   647,   648,   649,   650,   651,
+     652,   653,   654,   655,   656,   657,   658,   659,   660,   661,
+     662,   663,   664,   665,   666,   667,   668,   669,   670,   671,
+     672,   673,   674,     9,   675,   676,   677,   678,   679,   680,
+     681,   682,   683,   684,   685,   686,    10,   687,   688,   689,
+     690,   691,   692,   693,   694,   695,   696,   697,   698,   699,
+     700,   701,   702,    11,   703,   704,   705,   706,   707,   708,
+     709,    12,   710,   711,   712,   713,   714,   715,   716,   717,
+     718,   719,   720,   721,   722,   723,   724,   725,   726,   727,
+     728,   729,   730,   731,   732,   733,   734,   735,   736,   737,
+     738,   739,   740,   741,   742,   743,   744,   745,   746,   747,
+     748,   749,   750,   751,   752,   753,   754,   755,   756,   757,
+     758,   759,   760,   761,   762,   763,   764,   765,   766,   767,
+     768,   769,   770,   771,   772,   773,   774,   775,   776,   777,
+     778,   779,   780,   781,   782,   783,   784,   785,   786,   787,
+     788,   789,   790,   791,   792,   793,   794,   795,   796,   797,
+     798,   799,   800
 };
 
 static const yytype_int16 yycheck[] =
 {
-       0,    40,    40,    40,   108,    42,    43,    10,    40,    10,
-      -1,    11,    10,    10,    10,    10,    48,    49,   147,   148,
-     149,   150,   151,   152,   153,   154,   155,   156,   157,   158,
-     224,   225,   226,   227,   228,    10,    10,    76,    77,    10,
-      10,    41,    10,    10,    10,    10,    10,    47,   207,   208,
-     209,   210,   211,   212,   213,   214,   215,   216,    10,    10,
-      10,    10,   101,    10,    10,    10,   103,    92,    93,    94,
-      95,    96,    97,    98,    99,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    91,    10,    10,    10,    10,   133,    10,    10,   136,
-     132,    10,   134,    10,    10,    10,    10,   107,    10,    10,
+      12,    13,    14,    15,    16,    17,    18,    19,    20,    21,
+      22,    23,    24,    25,    26,    27,    28,    29,    30,    31,
+      32,    33,    34,    35,    36,    37,    38,    39,   108,    10,
+      10,    10,    44,    45,    46,    10,    10,    10,    50,    51,
+      52,    53,    54,    55,    56,    57,    58,    59,    60,    61,
+      62,    63,    64,    65,    66,    67,    68,    69,    70,    71,
+      72,    73,    74,    75,    76,    77,    78,    79,    80,    81,
+      82,    83,    84,    85,    86,    87,    88,    89,    90,    40,
+     224,   225,   226,   227,   228,    10,    10,    10,   100,   101,
+     102,    10,   104,   105,   106,    10,    10,   109,   110,   111,
+     112,   113,   114,   115,   116,   117,   118,   119,   120,   121,
+     122,   123,   124,   125,   126,   127,   128,   129,   130,   131,
+      -1,    10,    10,   135,    10,   137,   138,   139,   140,   141,
+     142,   143,   144,   145,    10,    10,    10,    10,    10,    10,
+      40,    10,    42,    43,    10,    10,    10,   159,   160,   161,
+     162,   163,   164,   165,   166,   167,   168,   169,   170,   171,
+     172,   173,   174,   175,   176,   177,   178,   179,   180,   181,
+     182,   183,   184,   185,   186,   187,   188,   189,   190,   191,
+     192,    10,   194,    10,   196,   197,   198,   199,   200,   201,
+     202,   203,   204,   205,    10,    40,    10,    10,    10,    10,
+       0,    10,    10,   103,    40,   217,   218,   219,   220,   221,
+     222,    11,    48,    49,    10,    10,    10,   229,    10,    10,
+      10,    10,    10,    10,    10,   237,   238,   239,   240,   241,
+     242,    76,    77,   133,    10,    10,   136,    10,    10,    10,
+      10,    41,    10,   255,   256,   257,   258,    47,    92,    93,
+      94,    95,    96,    97,    98,    99,   101,   147,   148,   149,
+     150,   151,   152,   153,   154,   155,   156,   157,   158,   230,
+      10,   232,   233,   234,   235,   236,   207,   208,   209,   210,
+     211,   212,   213,   214,   215,   216,    10,    10,    10,    10,
+      10,    91,    10,    10,    10,    10,   132,    10,   134,    10,
+      10,    10,    10,    10,    10,    10,    10,   107,    10,    10,
+      10,    10,    10,    10,    10,   160,   161,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,   160,   161,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,   146,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,   195,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+     195,    10,    10,   243,   244,   245,   246,   247,   248,   249,
+     250,   251,   252,   253,   254,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,   230,   193,   232,   233,   234,   235,   236,    10,
+      10,    10,    10,   193,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,   206,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,   223,    10,    10,    10,    10,    10,    10,
-      -1,   231,    12,    13,    14,    15,    16,    17,    18,    19,
-      20,    21,    22,    23,    24,    25,    26,    27,    28,    29,
-      30,    31,    32,    33,    34,    35,    36,    37,    38,    39,
-      10,    10,    10,    10,    44,    45,    46,    10,    10,    10,
-      50,    51,    52,    53,    54,    55,    56,    57,    58,    59,
-      60,    61,    62,    63,    64,    65,    66,    67,    68,    69,
-      70,    71,    72,    73,    74,    75,    76,    77,    78,    79,
-      80,    81,    82,    83,    84,    85,    86,    87,    88,    89,
-      90,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-     100,   101,   102,    10,   104,   105,   106,    10,    10,   109,
-     110,   111,   112,   113,   114,   115,   116,   117,   118,   119,
-     120,   121,   122,   123,   124,   125,   126,   127,   128,   129,
-     130,   131,    10,    10,    10,   135,    10,   137,   138,   139,
-     140,   141,   142,   143,   144,   145,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10,    10,   159,
-     160,   161,   162,   163,   164,   165,   166,   167,   168,   169,
-     170,   171,   172,   173,   174,   175,   176,   177,   178,   179,
-     180,   181,   182,   183,   184,   185,   186,   187,   188,   189,
-     190,   191,   192,    10,   194,    10,   196,   197,   198,   199,
-     200,   201,   202,   203,   204,   205,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,   217,   218,   219,
-     220,   221,   222,    10,    10,    10,    10,    10,    10,   229,
-      10,    10,    10,    10,    10,    10,    10,   237,    10,    10,
+      10,   231,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10
 };
 
-  /* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-     symbol of state STATE-NUM.  */
-static const yytype_uint16 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int16 yystos[] =
 {
-       0,   239,     0,    11,    41,    47,    91,   107,   146,   193,
-     206,   223,   231,   240,   241,   244,   247,   250,   253,   441,
-     452,   467,   475,   488,   242,   245,   248,   251,   254,   442,
-     453,   468,   476,   489,    12,    13,    14,    15,    16,    17,
+       0,   260,     0,    11,    41,    47,    91,   107,   146,   193,
+     206,   223,   231,   261,   262,   265,   268,   271,   274,   471,
+     482,   509,   517,   530,   263,   266,   269,   272,   275,   472,
+     483,   510,   518,   531,    12,    13,    14,    15,    16,    17,
       18,    19,    20,    21,    22,    23,    24,    25,    26,    27,
       28,    29,    30,    31,    32,    33,    34,    35,    36,    37,
       38,    39,    44,    45,    46,    50,    51,    52,    53,    54,
@@ -1596,37 +1761,41 @@ static const yytype_uint16 yystos[] =
      174,   175,   176,   177,   178,   179,   180,   181,   182,   183,
      184,   185,   186,   187,   188,   189,   190,   191,   192,   194,
      196,   197,   198,   199,   200,   201,   202,   203,   204,   205,
-     217,   218,   219,   220,   221,   222,   229,   237,   243,   256,
-     257,   258,   259,   260,   261,   262,   263,   264,   265,   266,
-     267,   268,   269,   270,   271,   272,   273,   274,   275,   276,
-     277,   278,   279,   280,   281,   282,   283,   284,   285,   286,
-     287,   288,   289,   290,   291,   292,   293,   294,   295,   296,
-     297,   298,   299,   300,   301,   302,   303,   304,   305,   306,
-     307,   308,   309,   310,   311,   312,   313,   314,   315,   316,
-     317,   318,   319,   320,   321,   322,   323,   324,   325,   326,
-     327,   328,   329,   330,   331,   332,   333,   334,   335,   336,
-     337,   338,   339,   340,   341,   342,   343,   344,   345,   346,
-     347,   348,   349,   350,   351,   352,   353,   354,   355,   356,
-     357,   358,   359,   360,   361,   362,   363,   364,   365,   366,
-     367,   368,   369,   370,   371,   372,   373,   374,   375,   376,
-     377,   378,   379,   380,   381,   382,   383,   384,   385,   386,
-     387,   388,   389,   390,   391,   392,   393,   394,   395,   396,
-     397,   398,   399,   400,   401,   402,   403,   404,   405,   406,
-     407,   408,   409,   410,   411,   412,   413,   414,   415,   471,
-     472,   473,   474,    40,    42,    43,   103,   133,   136,   246,
-     416,   417,   418,   419,   420,   421,    40,    48,    49,   132,
-     134,   249,   422,   423,   424,   425,   426,    40,    76,    77,
-     101,   160,   161,   195,   252,   434,   435,   436,   437,   438,
-     439,   440,    40,   230,   232,   233,   234,   235,   236,   255,
-     427,   428,   429,   430,   431,   432,   433,    92,    93,    94,
-      95,    96,    97,    98,    99,   443,   444,   445,   446,   447,
-     448,   449,   450,   451,   147,   148,   149,   150,   151,   152,
-     153,   154,   155,   156,   157,   158,   454,   455,   456,   457,
-     458,   459,   460,   461,   462,   463,   464,   465,   466,   108,
-     469,   470,   207,   208,   209,   210,   211,   212,   213,   214,
-     215,   216,   477,   478,   479,   480,   481,   482,   483,   484,
-     485,   486,   487,   224,   225,   226,   227,   228,   490,   491,
-     492,   493,   494,   495,    10,    10,    10,    10,    10,    10,
+     217,   218,   219,   220,   221,   222,   229,   237,   238,   239,
+     240,   241,   242,   255,   256,   257,   258,   264,   277,   278,
+     279,   280,   281,   282,   283,   284,   285,   286,   287,   288,
+     289,   290,   291,   292,   293,   294,   295,   296,   297,   298,
+     299,   300,   301,   302,   303,   304,   305,   306,   307,   308,
+     309,   310,   311,   312,   313,   314,   315,   316,   317,   318,
+     319,   320,   321,   322,   323,   324,   325,   326,   327,   328,
+     329,   330,   331,   332,   333,   334,   335,   336,   337,   338,
+     339,   340,   341,   342,   343,   344,   345,   346,   347,   348,
+     349,   350,   351,   352,   353,   354,   355,   356,   357,   358,
+     359,   360,   361,   362,   363,   364,   365,   366,   367,   368,
+     369,   370,   371,   372,   373,   374,   375,   376,   377,   378,
+     379,   380,   381,   382,   383,   384,   385,   386,   387,   388,
+     389,   390,   391,   392,   393,   394,   395,   396,   397,   398,
+     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
+     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
+     419,   420,   421,   422,   423,   424,   425,   426,   427,   428,
+     429,   430,   431,   432,   433,   434,   435,   436,   437,   438,
+     439,   440,   441,   442,   443,   444,   445,   513,   514,   515,
+     516,    40,    42,    43,   103,   133,   136,   267,   446,   447,
+     448,   449,   450,   451,    40,    48,    49,   132,   134,   270,
+     452,   453,   454,   455,   456,    40,    76,    77,   101,   160,
+     161,   195,   273,   464,   465,   466,   467,   468,   469,   470,
+      40,   230,   232,   233,   234,   235,   236,   276,   457,   458,
+     459,   460,   461,   462,   463,    92,    93,    94,    95,    96,
+      97,    98,    99,   473,   474,   475,   476,   477,   478,   479,
+     480,   481,   147,   148,   149,   150,   151,   152,   153,   154,
+     155,   156,   157,   158,   243,   244,   245,   246,   247,   248,
+     249,   250,   251,   252,   253,   254,   484,   485,   486,   487,
+     488,   489,   490,   491,   492,   493,   494,   495,   496,   497,
+     498,   499,   500,   501,   502,   503,   504,   505,   506,   507,
+     508,   108,   511,   512,   207,   208,   209,   210,   211,   212,
+     213,   214,   215,   216,   519,   520,   521,   522,   523,   524,
+     525,   526,   527,   528,   529,   224,   225,   226,   227,   228,
+     532,   533,   534,   535,   536,   537,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
@@ -1650,66 +1819,73 @@ static const yytype_uint16 yystos[] =
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
       10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
-      10,    10,    10,    10,    10,    10,    10,    10
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10,    10,    10,    10,    10,    10,    10,    10,    10,    10,
+      10
 };
 
-  /* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint16 yyr1[] =
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int16 yyr1[] =
 {
-       0,   238,   239,   239,   240,   240,   240,   240,   240,   240,
-     240,   240,   240,   240,   241,   242,   242,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   243,   243,   243,   243,   243,   243,   243,   243,   243,
-     243,   244,   245,   245,   246,   246,   246,   246,   246,   246,
-     247,   248,   248,   249,   249,   249,   249,   249,   250,   251,
-     251,   252,   252,   252,   252,   252,   252,   252,   253,   254,
-     254,   255,   255,   255,   255,   255,   255,   255,   256,   257,
-     258,   259,   260,   261,   262,   263,   264,   265,   266,   267,
-     268,   269,   270,   271,   272,   273,   274,   275,   276,   277,
-     278,   279,   280,   281,   282,   283,   284,   285,   286,   287,
-     288,   289,   290,   291,   292,   293,   294,   295,   296,   297,
-     298,   299,   300,   301,   302,   303,   304,   305,   306,   307,
-     308,   309,   310,   311,   312,   313,   314,   315,   316,   317,
-     318,   319,   320,   321,   322,   323,   324,   325,   326,   327,
-     328,   329,   330,   331,   332,   333,   334,   335,   336,   337,
-     338,   339,   340,   341,   342,   343,   344,   345,   346,   347,
-     348,   349,   350,   351,   352,   353,   354,   355,   356,   357,
-     358,   359,   360,   361,   362,   363,   364,   365,   366,   367,
-     368,   369,   370,   371,   372,   373,   374,   375,   376,   377,
-     378,   379,   380,   381,   382,   383,   384,   385,   386,   387,
-     388,   389,   390,   391,   392,   393,   394,   395,   396,   397,
-     398,   399,   400,   401,   402,   403,   404,   405,   406,   407,
-     408,   409,   410,   411,   412,   413,   414,   415,   416,   417,
-     418,   419,   420,   421,   422,   423,   424,   425,   426,   427,
-     428,   429,   430,   431,   432,   433,   434,   435,   436,   437,
-     438,   439,   440,   441,   442,   442,   443,   443,   443,   443,
-     443,   443,   443,   443,   444,   445,   446,   447,   448,   449,
-     450,   451,   452,   453,   453,   454,   454,   454,   454,   454,
-     454,   454,   454,   454,   454,   454,   454,   455,   456,   457,
-     458,   459,   460,   461,   462,   463,   464,   465,   466,   467,
-     468,   468,   469,   470,   471,   472,   473,   474,   475,   476,
-     476,   477,   477,   477,   477,   477,   477,   477,   477,   477,
-     477,   478,   479,   480,   481,   482,   483,   484,   485,   486,
-     487,   488,   489,   489,   490,   490,   490,   490,   490,   491,
-     492,   493,   494,   495
+       0,   259,   260,   260,   261,   261,   261,   261,   261,   261,
+     261,   261,   261,   261,   262,   263,   263,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     264,   264,   264,   264,   264,   264,   264,   264,   264,   264,
+     265,   266,   266,   267,   267,   267,   267,   267,   267,   268,
+     269,   269,   270,   270,   270,   270,   270,   271,   272,   272,
+     273,   273,   273,   273,   273,   273,   273,   274,   275,   275,
+     276,   276,   276,   276,   276,   276,   276,   277,   278,   279,
+     280,   281,   282,   283,   284,   285,   286,   287,   288,   289,
+     290,   291,   292,   293,   294,   295,   296,   297,   298,   299,
+     300,   301,   302,   303,   304,   305,   306,   307,   308,   309,
+     310,   311,   312,   313,   314,   315,   316,   317,   318,   319,
+     320,   321,   322,   323,   324,   325,   326,   327,   328,   329,
+     330,   331,   332,   333,   334,   335,   336,   337,   338,   339,
+     340,   341,   342,   343,   344,   345,   346,   347,   348,   349,
+     350,   351,   352,   353,   354,   355,   356,   357,   358,   359,
+     360,   361,   362,   363,   364,   365,   366,   367,   368,   369,
+     370,   371,   372,   373,   374,   375,   376,   377,   378,   379,
+     380,   381,   382,   383,   384,   385,   386,   387,   388,   389,
+     390,   391,   392,   393,   394,   395,   396,   397,   398,   399,
+     400,   401,   402,   403,   404,   405,   406,   407,   408,   409,
+     410,   411,   412,   413,   414,   415,   416,   417,   418,   419,
+     420,   421,   422,   423,   424,   425,   426,   427,   428,   429,
+     430,   431,   432,   433,   434,   435,   436,   437,   438,   439,
+     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
+     450,   451,   452,   453,   454,   455,   456,   457,   458,   459,
+     460,   461,   462,   463,   464,   465,   466,   467,   468,   469,
+     470,   471,   472,   472,   473,   473,   473,   473,   473,   473,
+     473,   473,   474,   475,   476,   477,   478,   479,   480,   481,
+     482,   483,   483,   484,   484,   484,   484,   484,   484,   484,
+     484,   484,   484,   484,   484,   484,   484,   484,   484,   484,
+     484,   484,   484,   484,   484,   484,   484,   485,   486,   487,
+     488,   489,   490,   491,   492,   493,   494,   495,   496,   497,
+     498,   499,   500,   501,   502,   503,   504,   505,   506,   507,
+     508,   509,   510,   510,   511,   512,   513,   514,   515,   516,
+     517,   518,   518,   519,   519,   519,   519,   519,   519,   519,
+     519,   519,   519,   520,   521,   522,   523,   524,   525,   526,
+     527,   528,   529,   530,   531,   531,   532,   532,   532,   532,
+     532,   533,   534,   535,   536,   537
 };
 
-  /* YYR2[YYN] -- Number of symbols on the right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
 {
        0,     2,     0,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     1,     2,     0,     1,     1,     1,
@@ -1729,10 +1905,11 @@ static const yytype_uint8 yyr2[] =
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     2,     0,     1,     1,     1,     1,     1,     1,
-       1,     2,     0,     1,     1,     1,     1,     1,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     2,     2,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
+       2,     0,     1,     1,     1,     1,     1,     1,     2,     0,
+       1,     1,     1,     1,     1,     1,     1,     1,     2,     0,
+       1,     1,     1,     1,     1,     1,     1,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -1742,61 +1919,64 @@ static const yytype_uint8 yyr2[] =
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     3,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     3,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     3,     2,     2,     2,     2,     2,
-       2,     2,     2,     3,     3,     4,     4,     4,     3,     3,
-       2,     2,     2,     2,     2,     2,     3,     3,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     3,     2,
+       2,     2,     2,     2,     2,     2,     2,     3,     3,     4,
+       4,     4,     3,     3,     2,     2,     2,     2,     2,     2,
+       3,     3,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     3,     3,     3,
-       2,     2,     2,     1,     2,     0,     1,     1,     1,     1,
-       1,     1,     1,     1,     2,     2,     2,     2,     2,     2,
-       2,     2,     1,     2,     0,     1,     1,     1,     1,     1,
+       2,     2,     2,     2,     2,     3,     3,     3,     2,     2,
+       2,     1,     2,     0,     1,     1,     1,     1,     1,     1,
+       1,     1,     2,     2,     2,     2,     2,     2,     2,     2,
+       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     2,     2,     2,
-       2,     2,     2,     2,     2,     2,     2,     2,     2,     1,
-       2,     0,     1,     2,     2,     2,     3,     3,     1,     2,
-       0,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     2,     2,     2,     2,     2,     2,     2,     2,     2,
-       2,     1,     2,     0,     1,     1,     1,     1,     1,     2,
-       2,     2,     2,     2
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
+       2,     1,     2,     0,     1,     2,     2,     2,     3,     3,
+       1,     2,     0,     1,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     2,     2,     2,     2,     2,     2,     2,
+       2,     2,     2,     1,     2,     0,     1,     1,     1,     1,
+       1,     2,     2,     2,     2,     2
 };
 
 
+enum { YYENOMEM = -2 };
+
 #define yyerrok         (yyerrstatus = 0)
 #define yyclearin       (yychar = YYEMPTY)
-#define YYEMPTY         (-2)
-#define YYEOF           0
 
 #define YYACCEPT        goto yyacceptlab
 #define YYABORT         goto yyabortlab
 #define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
 
 #define YYRECOVERING()  (!!yyerrstatus)
 
-#define YYBACKUP(Token, Value)                                  \
-do                                                              \
-  if (yychar == YYEMPTY)                                        \
-    {                                                           \
-      yychar = (Token);                                         \
-      yylval = (Value);                                         \
-      YYPOPSTACK (yylen);                                       \
-      yystate = *yyssp;                                         \
-      goto yybackup;                                            \
-    }                                                           \
-  else                                                          \
-    {                                                           \
-      yyerror (YY_("syntax error: cannot back up")); \
-      YYERROR;                                                  \
-    }                                                           \
-while (0)
-
-/* Error token number */
-#define YYTERROR        1
-#define YYERRCODE       256
-
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
 
 /* Enable debugging if requested.  */
@@ -1813,55 +1993,52 @@ do {                                            \
     YYFPRINTF Args;                             \
 } while (0)
 
-/* This macro is provided for backward compatibility. */
-#ifndef YY_LOCATION_PRINT
-# define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-#endif
 
 
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)                    \
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
 do {                                                                      \
   if (yydebug)                                                            \
     {                                                                     \
       YYFPRINTF (stderr, "%s ", Title);                                   \
       yy_symbol_print (stderr,                                            \
-                  Type, Value); \
+                  Kind, Value); \
       YYFPRINTF (stderr, "\n");                                           \
     }                                                                     \
 } while (0)
 
 
-/*----------------------------------------.
-| Print this symbol's value on YYOUTPUT.  |
-`----------------------------------------*/
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
 
 static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  FILE *yyo = yyoutput;
-  YYUSE (yyo);
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
   if (!yyvaluep)
     return;
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# endif
-  YYUSE (yytype);
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
 static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep)
 {
-  YYFPRINTF (yyoutput, "%s %s (",
-             yytype < YYNTOKENS ? "token" : "nterm", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -1870,7 +2047,7 @@ yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep)
 `------------------------------------------------------------------*/
 
 static void
-yy_stack_print (yytype_int16 *yybottom, yytype_int16 *yytop)
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
   for (; yybottom <= yytop; yybottom++)
@@ -1893,21 +2070,21 @@ do {                                                            \
 `------------------------------------------------*/
 
 static void
-yy_reduce_print (yytype_int16 *yyssp, YYSTYPE *yyvsp, int yyrule)
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule)
 {
-  unsigned long int yylno = yyrline[yyrule];
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
              yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
       YYFPRINTF (stderr, "   $%d = ", yyi + 1);
       yy_symbol_print (stderr,
-                       yystos[yyssp[yyi + 1 - yynrhs]],
-                       &(yyvsp[(yyi + 1) - (yynrhs)])
-                                              );
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)]);
       YYFPRINTF (stderr, "\n");
     }
 }
@@ -1922,8 +2099,8 @@ do {                                    \
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
@@ -1946,249 +2123,30 @@ int yydebug;
 #endif
 
 
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-static YYSIZE_T
-yystrlen (const char *yystr)
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-        switch (*++yyp)
-          {
-          case '\'':
-          case ',':
-            goto do_not_strip_quotes;
-
-          case '\\':
-            if (*++yyp != '\\')
-              goto do_not_strip_quotes;
-            /* Fall through.  */
-          default:
-            if (yyres)
-              yyres[yyn] = *yyp;
-            yyn++;
-            break;
-
-          case '"':
-            if (yyres)
-              yyres[yyn] = '\0';
-            return yyn;
-          }
-    do_not_strip_quotes: ;
-    }
-
-  if (! yyres)
-    return yystrlen (yystr);
-
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
-
-/* Copy into *YYMSG, which is of size *YYMSG_ALLOC, an error message
-   about the unexpected token YYTOKEN for the state stack whose top is
-   YYSSP.
-
-   Return 0 if *YYMSG was successfully written.  Return 1 if *YYMSG is
-   not large enough to hold the message.  In that case, also set
-   *YYMSG_ALLOC to the required number of bytes.  Return 2 if the
-   required number of bytes is too large to store.  */
-static int
-yysyntax_error (YYSIZE_T *yymsg_alloc, char **yymsg,
-                yytype_int16 *yyssp, int yytoken)
-{
-  YYSIZE_T yysize0 = yytnamerr (YY_NULLPTR, yytname[yytoken]);
-  YYSIZE_T yysize = yysize0;
-  enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-  /* Internationalized format string. */
-  const char *yyformat = YY_NULLPTR;
-  /* Arguments of yyformat. */
-  char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-  /* Number of reported tokens (one for the "unexpected", one per
-     "expected"). */
-  int yycount = 0;
-
-  /* There are many possibilities here to consider:
-     - If this state is a consistent state with a default action, then
-       the only way this function was invoked is if the default action
-       is an error action.  In that case, don't check for expected
-       tokens because there are none.
-     - The only way there can be no lookahead present (in yychar) is if
-       this state is a consistent state with a default action.  Thus,
-       detecting the absence of a lookahead is sufficient to determine
-       that there is no unexpected or expected token to report.  In that
-       case, just report a simple "syntax error".
-     - Don't assume there isn't a lookahead just because this state is a
-       consistent state with a default action.  There might have been a
-       previous inconsistent state, consistent state with a non-default
-       action, or user semantic action that manipulated yychar.
-     - Of course, the expected token list depends on states to have
-       correct lookahead information, and it depends on the parser not
-       to perform extra reductions after fetching a lookahead from the
-       scanner and before detecting a syntax error.  Thus, state merging
-       (from LALR or IELR) and default reductions corrupt the expected
-       token list.  However, the list is correct for canonical LR with
-       one exception: it will still contain any token that will not be
-       accepted due to an error action in a later state.
-  */
-  if (yytoken != YYEMPTY)
-    {
-      int yyn = yypact[*yyssp];
-      yyarg[yycount++] = yytname[yytoken];
-      if (!yypact_value_is_default (yyn))
-        {
-          /* Start YYX at -YYN if negative to avoid negative indexes in
-             YYCHECK.  In other words, skip the first -YYN actions for
-             this state because they are default actions.  */
-          int yyxbegin = yyn < 0 ? -yyn : 0;
-          /* Stay within bounds of both yycheck and yytname.  */
-          int yychecklim = YYLAST - yyn + 1;
-          int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-          int yyx;
-
-          for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-            if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR
-                && !yytable_value_is_error (yytable[yyx + yyn]))
-              {
-                if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-                  {
-                    yycount = 1;
-                    yysize = yysize0;
-                    break;
-                  }
-                yyarg[yycount++] = yytname[yyx];
-                {
-                  YYSIZE_T yysize1 = yysize + yytnamerr (YY_NULLPTR, yytname[yyx]);
-                  if (! (yysize <= yysize1
-                         && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-                    return 2;
-                  yysize = yysize1;
-                }
-              }
-        }
-    }
-
-  switch (yycount)
-    {
-# define YYCASE_(N, S)                      \
-      case N:                               \
-        yyformat = S;                       \
-      break
-      YYCASE_(0, YY_("syntax error"));
-      YYCASE_(1, YY_("syntax error, unexpected %s"));
-      YYCASE_(2, YY_("syntax error, unexpected %s, expecting %s"));
-      YYCASE_(3, YY_("syntax error, unexpected %s, expecting %s or %s"));
-      YYCASE_(4, YY_("syntax error, unexpected %s, expecting %s or %s or %s"));
-      YYCASE_(5, YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s"));
-# undef YYCASE_
-    }
 
-  {
-    YYSIZE_T yysize1 = yysize + yystrlen (yyformat);
-    if (! (yysize <= yysize1 && yysize1 <= YYSTACK_ALLOC_MAXIMUM))
-      return 2;
-    yysize = yysize1;
-  }
 
-  if (*yymsg_alloc < yysize)
-    {
-      *yymsg_alloc = 2 * yysize;
-      if (! (yysize <= *yymsg_alloc
-             && *yymsg_alloc <= YYSTACK_ALLOC_MAXIMUM))
-        *yymsg_alloc = YYSTACK_ALLOC_MAXIMUM;
-      return 1;
-    }
 
-  /* Avoid sprintf, as that infringes on the user's name space.
-     Don't have undefined behavior even if the translation
-     produced a string with the wrong number of "%s"s.  */
-  {
-    char *yyp = *yymsg;
-    int yyi = 0;
-    while ((*yyp = *yyformat) != '\0')
-      if (*yyp == '%' && yyformat[1] == 's' && yyi < yycount)
-        {
-          yyp += yytnamerr (yyp, yyarg[yyi++]);
-          yyformat += 2;
-        }
-      else
-        {
-          yyp++;
-          yyformat++;
-        }
-  }
-  return 0;
-}
-#endif /* YYERROR_VERBOSE */
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep)
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep)
 {
-  YYUSE (yyvaluep);
+  YY_USE (yyvaluep);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
-  YYUSE (yytype);
+  YY_USE (yykind);
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-
-
-/* The lookahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
 /* The semantic value of the lookahead symbol.  */
@@ -2197,6 +2155,8 @@ YYSTYPE yylval;
 int yynerrs;
 
 
+
+
 /*----------.
 | yyparse.  |
 `----------*/
@@ -2204,43 +2164,36 @@ int yynerrs;
 int
 yyparse (void)
 {
-    int yystate;
+    yy_state_fast_t yystate = 0;
     /* Number of tokens to shift before error messages enabled.  */
-    int yyerrstatus;
-
-    /* The stacks and their tools:
-       'yyss': related to states.
-       'yyvs': related to semantic values.
+    int yyerrstatus = 0;
 
-       Refer to the stacks through separate pointers, to allow yyoverflow
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
        to reallocate them elsewhere.  */
 
-    /* The state stack.  */
-    yytype_int16 yyssa[YYINITDEPTH];
-    yytype_int16 *yyss;
-    yytype_int16 *yyssp;
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-    /* The semantic value stack.  */
-    YYSTYPE yyvsa[YYINITDEPTH];
-    YYSTYPE *yyvs;
-    YYSTYPE *yyvsp;
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-    YYSIZE_T yystacksize;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
   int yyn;
+  /* The return value of yyparse.  */
   int yyresult;
-  /* Lookahead token as an internal (translated) token number.  */
-  int yytoken = 0;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
+
 
 #define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
 
@@ -2248,71 +2201,75 @@ yyparse (void)
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
-  yyssp = yyss = yyssa;
-  yyvsp = yyvs = yyvsa;
-  yystacksize = YYINITDEPTH;
-
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
   yychar = YYEMPTY; /* Cause a token to be read.  */
+
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
         /* Give user a chance to reallocate the stack.  Use copies of
            these so that the &'s don't force the real ones into
            memory.  */
+        yy_state_t *yyss1 = yyss;
         YYSTYPE *yyvs1 = yyvs;
-        yytype_int16 *yyss1 = yyss;
 
         /* Each stack pointer address is followed by the size of the
            data in use in that stack, in bytes.  This used to be a
            conditional around just the two extra args, but that might
            be undefined if yyoverflow is a macro.  */
         yyoverflow (YY_("memory exhausted"),
-                    &yyss1, yysize * sizeof (*yyssp),
-                    &yyvs1, yysize * sizeof (*yyvsp),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
                     &yystacksize);
-
         yyss = yyss1;
         yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-        goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
         yystacksize = YYMAXDEPTH;
 
       {
-        yytype_int16 *yyss1 = yyss;
+        yy_state_t *yyss1 = yyss;
         union yyalloc *yyptr =
-          (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
         if (! yyptr)
-          goto yyexhaustedlab;
+          YYNOMEM;
         YYSTACK_RELOCATE (yyss_alloc, yyss);
         YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
@@ -2320,30 +2277,31 @@ yyparse (void)
           YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-                  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
         YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
 
   if (yystate == YYFINAL)
     YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
      lookahead token if we need one and don't already have one.  */
 
@@ -2354,18 +2312,29 @@ yybackup:
 
   /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid lookahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
+      YYDPRINTF ((stderr, "Reading a token\n"));
       yychar = yylex ();
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -2393,15 +2362,13 @@ yybackup:
 
   /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token.  */
-  yychar = YYEMPTY;
-
   yystate = yyn;
   YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
   YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -2416,7 +2383,7 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
@@ -2436,17 +2403,17 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 14:
-#line 171 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 14: /* serverstart: VAR_SERVER  */
+#line 184 "util/configparser.y"
+        { 
 		OUTYY(("\nP(server:)\n")); 
 	}
-#line 2445 "util/configparser.c" /* yacc.c:1646  */
+#line 2412 "util/configparser.c"
     break;
 
-  case 181:
-#line 251 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 190: /* stubstart: VAR_STUB_ZONE  */
+#line 269 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(stub_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2456,12 +2423,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2460 "util/configparser.c" /* yacc.c:1646  */
+#line 2427 "util/configparser.c"
     break;
 
-  case 190:
-#line 268 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 199: /* forwardstart: VAR_FORWARD_ZONE  */
+#line 286 "util/configparser.y"
+        {
 		struct config_stub* s;
 		OUTYY(("\nP(forward_zone:)\n")); 
 		s = (struct config_stub*)calloc(1, sizeof(struct config_stub));
@@ -2471,12 +2438,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2475 "util/configparser.c" /* yacc.c:1646  */
+#line 2442 "util/configparser.c"
     break;
 
-  case 198:
-#line 285 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 207: /* viewstart: VAR_VIEW  */
+#line 303 "util/configparser.y"
+        {
 		struct config_view* s;
 		OUTYY(("\nP(view:)\n")); 
 		s = (struct config_view*)calloc(1, sizeof(struct config_view));
@@ -2488,12 +2455,12 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2492 "util/configparser.c" /* yacc.c:1646  */
+#line 2459 "util/configparser.c"
     break;
 
-  case 208:
-#line 304 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 217: /* authstart: VAR_AUTH_ZONE  */
+#line 322 "util/configparser.y"
+        {
 		struct config_auth* s;
 		OUTYY(("\nP(auth_zone:)\n")); 
 		s = (struct config_auth*)calloc(1, sizeof(struct config_auth));
@@ -2507,36 +2474,36 @@ yyreduce:
 		} else 
 			yyerror("out of memory");
 	}
-#line 2511 "util/configparser.c" /* yacc.c:1646  */
+#line 2478 "util/configparser.c"
     break;
 
-  case 218:
-#line 325 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 227: /* server_num_threads: VAR_NUM_THREADS STRING_ARG  */
+#line 343 "util/configparser.y"
+        { 
 		OUTYY(("P(server_num_threads:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_threads = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2523 "util/configparser.c" /* yacc.c:1646  */
+#line 2490 "util/configparser.c"
     break;
 
-  case 219:
-#line 334 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 228: /* server_verbosity: VAR_VERBOSITY STRING_ARG  */
+#line 352 "util/configparser.y"
+        { 
 		OUTYY(("P(server_verbosity:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->verbosity = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2535 "util/configparser.c" /* yacc.c:1646  */
+#line 2502 "util/configparser.c"
     break;
 
-  case 220:
-#line 343 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 229: /* server_statistics_interval: VAR_STATISTICS_INTERVAL STRING_ARG  */
+#line 361 "util/configparser.y"
+        { 
 		OUTYY(("P(server_statistics_interval:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->stat_interval = 0;
@@ -2545,48 +2512,48 @@ yyreduce:
 		else cfg_parser->cfg->stat_interval = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2549 "util/configparser.c" /* yacc.c:1646  */
+#line 2516 "util/configparser.c"
     break;
 
-  case 221:
-#line 354 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 230: /* server_statistics_cumulative: VAR_STATISTICS_CUMULATIVE STRING_ARG  */
+#line 372 "util/configparser.y"
+        {
 		OUTYY(("P(server_statistics_cumulative:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_cumulative = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2561 "util/configparser.c" /* yacc.c:1646  */
+#line 2528 "util/configparser.c"
     break;
 
-  case 222:
-#line 363 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 231: /* server_extended_statistics: VAR_EXTENDED_STATISTICS STRING_ARG  */
+#line 381 "util/configparser.y"
+        {
 		OUTYY(("P(server_extended_statistics:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stat_extended = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2573 "util/configparser.c" /* yacc.c:1646  */
+#line 2540 "util/configparser.c"
     break;
 
-  case 223:
-#line 372 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 232: /* server_shm_enable: VAR_SHM_ENABLE STRING_ARG  */
+#line 390 "util/configparser.y"
+        {
 		OUTYY(("P(server_shm_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->shm_enable = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2585 "util/configparser.c" /* yacc.c:1646  */
+#line 2552 "util/configparser.c"
     break;
 
-  case 224:
-#line 381 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 233: /* server_shm_key: VAR_SHM_KEY STRING_ARG  */
+#line 399 "util/configparser.y"
+        { 
 		OUTYY(("P(server_shm_key:%s)\n", (yyvsp[0].str))); 
 		if(strcmp((yyvsp[0].str), "") == 0 || strcmp((yyvsp[0].str), "0") == 0)
 			cfg_parser->cfg->shm_key = 0;
@@ -2595,24 +2562,24 @@ yyreduce:
 		else cfg_parser->cfg->shm_key = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2599 "util/configparser.c" /* yacc.c:1646  */
+#line 2566 "util/configparser.c"
     break;
 
-  case 225:
-#line 392 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 234: /* server_port: VAR_PORT STRING_ARG  */
+#line 410 "util/configparser.y"
+        {
 		OUTYY(("P(server_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2611 "util/configparser.c" /* yacc.c:1646  */
+#line 2578 "util/configparser.c"
     break;
 
-  case 226:
-#line 401 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 235: /* server_send_client_subnet: VAR_SEND_CLIENT_SUBNET STRING_ARG  */
+#line 419 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_send_client_subnet:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet, (yyvsp[0].str)))
@@ -2621,12 +2588,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2625 "util/configparser.c" /* yacc.c:1646  */
+#line 2592 "util/configparser.c"
     break;
 
-  case 227:
-#line 412 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 236: /* server_client_subnet_zone: VAR_CLIENT_SUBNET_ZONE STRING_ARG  */
+#line 430 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_zone:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->client_subnet_zone,
@@ -2636,12 +2603,12 @@ yyreduce:
 		OUTYY(("P(Compiled without edns subnet option, ignoring)\n"));
 	#endif
 	}
-#line 2640 "util/configparser.c" /* yacc.c:1646  */
+#line 2607 "util/configparser.c"
     break;
 
-  case 228:
-#line 425 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 237: /* server_client_subnet_always_forward: VAR_CLIENT_SUBNET_ALWAYS_FORWARD STRING_ARG  */
+#line 443 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(server_client_subnet_always_forward:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -2654,12 +2621,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2658 "util/configparser.c" /* yacc.c:1646  */
+#line 2625 "util/configparser.c"
     break;
 
-  case 229:
-#line 440 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 238: /* server_client_subnet_opcode: VAR_CLIENT_SUBNET_OPCODE STRING_ARG  */
+#line 458 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(client_subnet_opcode:%s)\n", (yyvsp[0].str)));
 		OUTYY(("P(Deprecated option, ignoring)\n"));
@@ -2668,12 +2635,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2672 "util/configparser.c" /* yacc.c:1646  */
+#line 2639 "util/configparser.c"
     break;
 
-  case 230:
-#line 451 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 239: /* server_max_client_subnet_ipv4: VAR_MAX_CLIENT_SUBNET_IPV4 STRING_ARG  */
+#line 469 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv4:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2688,12 +2655,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2692 "util/configparser.c" /* yacc.c:1646  */
+#line 2659 "util/configparser.c"
     break;
 
-  case 231:
-#line 468 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 240: /* server_max_client_subnet_ipv6: VAR_MAX_CLIENT_SUBNET_IPV6 STRING_ARG  */
+#line 486 "util/configparser.y"
+        {
 	#ifdef CLIENT_SUBNET
 		OUTYY(("P(max_client_subnet_ipv6:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -2708,12 +2675,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 2712 "util/configparser.c" /* yacc.c:1646  */
+#line 2679 "util/configparser.c"
     break;
 
-  case 232:
-#line 485 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 241: /* server_interface: VAR_INTERFACE STRING_ARG  */
+#line 503 "util/configparser.y"
+        {
 		OUTYY(("P(server_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_ifs == 0)
 			cfg_parser->cfg->ifs = calloc(1, sizeof(char*));
@@ -2724,12 +2691,12 @@ yyreduce:
 		else
 			cfg_parser->cfg->ifs[cfg_parser->cfg->num_ifs++] = (yyvsp[0].str);
 	}
-#line 2728 "util/configparser.c" /* yacc.c:1646  */
+#line 2695 "util/configparser.c"
     break;
 
-  case 233:
-#line 498 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 242: /* server_outgoing_interface: VAR_OUTGOING_INTERFACE STRING_ARG  */
+#line 516 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_interface:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->num_out_ifs == 0)
 			cfg_parser->cfg->out_ifs = calloc(1, sizeof(char*));
@@ -2742,281 +2709,281 @@ yyreduce:
 			cfg_parser->cfg->out_ifs[
 				cfg_parser->cfg->num_out_ifs++] = (yyvsp[0].str);
 	}
-#line 2746 "util/configparser.c" /* yacc.c:1646  */
+#line 2713 "util/configparser.c"
     break;
 
-  case 234:
-#line 513 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 243: /* server_outgoing_range: VAR_OUTGOING_RANGE STRING_ARG  */
+#line 531 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_range:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_ports = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2758 "util/configparser.c" /* yacc.c:1646  */
+#line 2725 "util/configparser.c"
     break;
 
-  case 235:
-#line 522 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 244: /* server_outgoing_port_permit: VAR_OUTGOING_PORT_PERMIT STRING_ARG  */
+#line 540 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_permit:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 1, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2770 "util/configparser.c" /* yacc.c:1646  */
+#line 2737 "util/configparser.c"
     break;
 
-  case 236:
-#line 531 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 245: /* server_outgoing_port_avoid: VAR_OUTGOING_PORT_AVOID STRING_ARG  */
+#line 549 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_port_avoid:%s)\n", (yyvsp[0].str)));
 		if(!cfg_mark_ports((yyvsp[0].str), 0, 
 			cfg_parser->cfg->outgoing_avail_ports, 65536))
 			yyerror("port number or range (\"low-high\") expected");
 		free((yyvsp[0].str));
 	}
-#line 2782 "util/configparser.c" /* yacc.c:1646  */
+#line 2749 "util/configparser.c"
     break;
 
-  case 237:
-#line 540 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 246: /* server_outgoing_num_tcp: VAR_OUTGOING_NUM_TCP STRING_ARG  */
+#line 558 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2794 "util/configparser.c" /* yacc.c:1646  */
+#line 2761 "util/configparser.c"
     break;
 
-  case 238:
-#line 549 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 247: /* server_incoming_num_tcp: VAR_INCOMING_NUM_TCP STRING_ARG  */
+#line 567 "util/configparser.y"
+        {
 		OUTYY(("P(server_incoming_num_tcp:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->incoming_num_tcp = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2806 "util/configparser.c" /* yacc.c:1646  */
+#line 2773 "util/configparser.c"
     break;
 
-  case 239:
-#line 558 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 248: /* server_interface_automatic: VAR_INTERFACE_AUTOMATIC STRING_ARG  */
+#line 576 "util/configparser.y"
+        {
 		OUTYY(("P(server_interface_automatic:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->if_automatic = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2818 "util/configparser.c" /* yacc.c:1646  */
+#line 2785 "util/configparser.c"
     break;
 
-  case 240:
-#line 567 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 249: /* server_do_ip4: VAR_DO_IP4 STRING_ARG  */
+#line 585 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip4:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip4 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2830 "util/configparser.c" /* yacc.c:1646  */
+#line 2797 "util/configparser.c"
     break;
 
-  case 241:
-#line 576 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 250: /* server_do_ip6: VAR_DO_IP6 STRING_ARG  */
+#line 594 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2842 "util/configparser.c" /* yacc.c:1646  */
+#line 2809 "util/configparser.c"
     break;
 
-  case 242:
-#line 585 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 251: /* server_do_udp: VAR_DO_UDP STRING_ARG  */
+#line 603 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_udp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_udp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2854 "util/configparser.c" /* yacc.c:1646  */
+#line 2821 "util/configparser.c"
     break;
 
-  case 243:
-#line 594 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 252: /* server_do_tcp: VAR_DO_TCP STRING_ARG  */
+#line 612 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_tcp:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_tcp = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2866 "util/configparser.c" /* yacc.c:1646  */
+#line 2833 "util/configparser.c"
     break;
 
-  case 244:
-#line 603 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 253: /* server_prefer_ip6: VAR_PREFER_IP6 STRING_ARG  */
+#line 621 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefer_ip6:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefer_ip6 = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2878 "util/configparser.c" /* yacc.c:1646  */
+#line 2845 "util/configparser.c"
     break;
 
-  case 245:
-#line 612 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 254: /* server_tcp_mss: VAR_TCP_MSS STRING_ARG  */
+#line 630 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_mss:%s)\n", (yyvsp[0].str)));
                 if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
                         yyerror("number expected");
                 else cfg_parser->cfg->tcp_mss = atoi((yyvsp[0].str));
                 free((yyvsp[0].str));
 	}
-#line 2890 "util/configparser.c" /* yacc.c:1646  */
+#line 2857 "util/configparser.c"
     break;
 
-  case 246:
-#line 621 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 255: /* server_outgoing_tcp_mss: VAR_OUTGOING_TCP_MSS STRING_ARG  */
+#line 639 "util/configparser.y"
+        {
 		OUTYY(("P(server_outgoing_tcp_mss:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->outgoing_tcp_mss = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2902 "util/configparser.c" /* yacc.c:1646  */
+#line 2869 "util/configparser.c"
     break;
 
-  case 247:
-#line 630 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 256: /* server_tcp_upstream: VAR_TCP_UPSTREAM STRING_ARG  */
+#line 648 "util/configparser.y"
+        {
 		OUTYY(("P(server_tcp_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->tcp_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2914 "util/configparser.c" /* yacc.c:1646  */
+#line 2881 "util/configparser.c"
     break;
 
-  case 248:
-#line 639 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 257: /* server_udp_upstream_without_downstream: VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM STRING_ARG  */
+#line 657 "util/configparser.y"
+        {
 		OUTYY(("P(server_udp_upstream_without_downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->udp_upstream_without_downstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2926 "util/configparser.c" /* yacc.c:1646  */
+#line 2893 "util/configparser.c"
     break;
 
-  case 249:
-#line 648 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 258: /* server_ssl_upstream: VAR_SSL_UPSTREAM STRING_ARG  */
+#line 666 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ssl_upstream = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 2938 "util/configparser.c" /* yacc.c:1646  */
+#line 2905 "util/configparser.c"
     break;
 
-  case 250:
-#line 657 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 259: /* server_ssl_service_key: VAR_SSL_SERVICE_KEY STRING_ARG  */
+#line 675 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_key:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_key);
 		cfg_parser->cfg->ssl_service_key = (yyvsp[0].str);
 	}
-#line 2948 "util/configparser.c" /* yacc.c:1646  */
+#line 2915 "util/configparser.c"
     break;
 
-  case 251:
-#line 664 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 260: /* server_ssl_service_pem: VAR_SSL_SERVICE_PEM STRING_ARG  */
+#line 682 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_service_pem:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ssl_service_pem);
 		cfg_parser->cfg->ssl_service_pem = (yyvsp[0].str);
 	}
-#line 2958 "util/configparser.c" /* yacc.c:1646  */
+#line 2925 "util/configparser.c"
     break;
 
-  case 252:
-#line 671 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 261: /* server_ssl_port: VAR_SSL_PORT STRING_ARG  */
+#line 689 "util/configparser.y"
+        {
 		OUTYY(("P(server_ssl_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("port number expected");
 		else cfg_parser->cfg->ssl_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 2970 "util/configparser.c" /* yacc.c:1646  */
+#line 2937 "util/configparser.c"
     break;
 
-  case 253:
-#line 680 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 262: /* server_tls_cert_bundle: VAR_TLS_CERT_BUNDLE STRING_ARG  */
+#line 698 "util/configparser.y"
+        {
 		OUTYY(("P(server_tls_cert_bundle:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->tls_cert_bundle);
 		cfg_parser->cfg->tls_cert_bundle = (yyvsp[0].str);
 	}
-#line 2980 "util/configparser.c" /* yacc.c:1646  */
+#line 2947 "util/configparser.c"
     break;
 
-  case 254:
-#line 687 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 263: /* server_additional_tls_port: VAR_ADDITIONAL_TLS_PORT STRING_ARG  */
+#line 705 "util/configparser.y"
+        {
 		OUTYY(("P(server_additional_tls_port:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->additional_tls_port,
 			(yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 2991 "util/configparser.c" /* yacc.c:1646  */
+#line 2958 "util/configparser.c"
     break;
 
-  case 255:
-#line 695 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 264: /* server_use_systemd: VAR_USE_SYSTEMD STRING_ARG  */
+#line 713 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_systemd:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->use_systemd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3003 "util/configparser.c" /* yacc.c:1646  */
+#line 2970 "util/configparser.c"
     break;
 
-  case 256:
-#line 704 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 265: /* server_do_daemonize: VAR_DO_DAEMONIZE STRING_ARG  */
+#line 722 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_daemonize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->do_daemonize = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3015 "util/configparser.c" /* yacc.c:1646  */
+#line 2982 "util/configparser.c"
     break;
 
-  case 257:
-#line 713 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 266: /* server_use_syslog: VAR_USE_SYSLOG STRING_ARG  */
+#line 731 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_syslog:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3028,68 +2995,104 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3032 "util/configparser.c" /* yacc.c:1646  */
+#line 2999 "util/configparser.c"
     break;
 
-  case 258:
-#line 727 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 267: /* server_log_time_ascii: VAR_LOG_TIME_ASCII STRING_ARG  */
+#line 745 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_time_ascii:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_time_ascii = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3044 "util/configparser.c" /* yacc.c:1646  */
+#line 3011 "util/configparser.c"
     break;
 
-  case 259:
-#line 736 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 268: /* server_log_queries: VAR_LOG_QUERIES STRING_ARG  */
+#line 754 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->log_queries = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3056 "util/configparser.c" /* yacc.c:1646  */
+#line 3023 "util/configparser.c"
     break;
 
-  case 260:
-#line 745 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 269: /* server_log_replies: VAR_LOG_REPLIES STRING_ARG  */
+#line 763 "util/configparser.y"
+  {
   	OUTYY(("P(server_log_replies:%s)\n", (yyvsp[0].str)));
   	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
   		yyerror("expected yes or no.");
   	else cfg_parser->cfg->log_replies = (strcmp((yyvsp[0].str), "yes")==0);
   	free((yyvsp[0].str));
   }
-#line 3068 "util/configparser.c" /* yacc.c:1646  */
+#line 3035 "util/configparser.c"
     break;
 
-  case 261:
-#line 754 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 270: /* server_log_module_time: VAR_LOG_MODULE_TIME STRING_ARG  */
+#line 772 "util/configparser.y"
+  {
+  	OUTYY(("P(server_log_module_time:%s)\n", (yyvsp[0].str)));
+  	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+  		yyerror("expected yes or no.");
+  	else cfg_parser->cfg->log_module_time = (strcmp((yyvsp[0].str), "yes")==0);
+  	free((yyvsp[0].str));
+  }
+#line 3047 "util/configparser.c"
+    break;
+
+  case 271: /* server_ip_ratelimit_sketch: VAR_IP_RATELIMIT_SKETCH STRING_ARG  */
+#line 781 "util/configparser.y"
+  {
+  	OUTYY(("P(server_ip_ratelimit_sketch:%s)\n", (yyvsp[0].str)));
+  	if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+  		yyerror("expected yes or no.");
+  	else cfg_parser->cfg->ip_ratelimit_sketch = (strcmp((yyvsp[0].str), "yes")==0);
+  	free((yyvsp[0].str));
+  }
+#line 3059 "util/configparser.c"
+    break;
+
+  case 272: /* server_heavy_hitters_size: VAR_HEAVY_HITTERS_SIZE STRING_ARG  */
+#line 790 "util/configparser.y"
+  {
+  	OUTYY(("P(server_heavy_hitters_size:%s)\n", (yyvsp[0].str)));
+  	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+  		yyerror("number expected");
+  	else cfg_parser->cfg->heavy_hitters_size = atoi((yyvsp[0].str));
+  	free((yyvsp[0].str));
+  }
+#line 3071 "util/configparser.c"
+    break;
+
+  case 273: /* server_chroot: VAR_CHROOT STRING_ARG  */
+#line 799 "util/configparser.y"
+        {
 		OUTYY(("P(server_chroot:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->chrootdir);
 		cfg_parser->cfg->chrootdir = (yyvsp[0].str);
 	}
-#line 3078 "util/configparser.c" /* yacc.c:1646  */
+#line 3081 "util/configparser.c"
     break;
 
-  case 262:
-#line 761 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 274: /* server_username: VAR_USERNAME STRING_ARG  */
+#line 806 "util/configparser.y"
+        {
 		OUTYY(("P(server_username:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->username);
 		cfg_parser->cfg->username = (yyvsp[0].str);
 	}
-#line 3088 "util/configparser.c" /* yacc.c:1646  */
+#line 3091 "util/configparser.c"
     break;
 
-  case 263:
-#line 768 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 275: /* server_directory: VAR_DIRECTORY STRING_ARG  */
+#line 813 "util/configparser.y"
+        {
 		OUTYY(("P(server_directory:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->directory);
 		cfg_parser->cfg->directory = (yyvsp[0].str);
@@ -3113,106 +3116,106 @@ yyreduce:
 			}
 		}
 	}
-#line 3117 "util/configparser.c" /* yacc.c:1646  */
+#line 3120 "util/configparser.c"
     break;
 
-  case 264:
-#line 794 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 276: /* server_logfile: VAR_LOGFILE STRING_ARG  */
+#line 839 "util/configparser.y"
+        {
 		OUTYY(("P(server_logfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->logfile);
 		cfg_parser->cfg->logfile = (yyvsp[0].str);
 		cfg_parser->cfg->use_syslog = 0;
 	}
-#line 3128 "util/configparser.c" /* yacc.c:1646  */
+#line 3131 "util/configparser.c"
     break;
 
-  case 265:
-#line 802 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 277: /* server_pidfile: VAR_PIDFILE STRING_ARG  */
+#line 847 "util/configparser.y"
+        {
 		OUTYY(("P(server_pidfile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->pidfile);
 		cfg_parser->cfg->pidfile = (yyvsp[0].str);
 	}
-#line 3138 "util/configparser.c" /* yacc.c:1646  */
+#line 3141 "util/configparser.c"
     break;
 
-  case 266:
-#line 809 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 278: /* server_root_hints: VAR_ROOT_HINTS STRING_ARG  */
+#line 854 "util/configparser.y"
+        {
 		OUTYY(("P(server_root_hints:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->root_hints, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3148 "util/configparser.c" /* yacc.c:1646  */
+#line 3151 "util/configparser.c"
     break;
 
-  case 267:
-#line 816 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 279: /* server_dlv_anchor_file: VAR_DLV_ANCHOR_FILE STRING_ARG  */
+#line 861 "util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dlv_anchor_file);
 		cfg_parser->cfg->dlv_anchor_file = (yyvsp[0].str);
 	}
-#line 3158 "util/configparser.c" /* yacc.c:1646  */
+#line 3161 "util/configparser.c"
     break;
 
-  case 268:
-#line 823 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 280: /* server_dlv_anchor: VAR_DLV_ANCHOR STRING_ARG  */
+#line 868 "util/configparser.y"
+        {
 		OUTYY(("P(server_dlv_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dlv_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3168 "util/configparser.c" /* yacc.c:1646  */
+#line 3171 "util/configparser.c"
     break;
 
-  case 269:
-#line 830 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 281: /* server_auto_trust_anchor_file: VAR_AUTO_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 875 "util/configparser.y"
+        {
 		OUTYY(("P(server_auto_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			auto_trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3179 "util/configparser.c" /* yacc.c:1646  */
+#line 3182 "util/configparser.c"
     break;
 
-  case 270:
-#line 838 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 282: /* server_trust_anchor_file: VAR_TRUST_ANCHOR_FILE STRING_ARG  */
+#line 883 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trust_anchor_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3190 "util/configparser.c" /* yacc.c:1646  */
+#line 3193 "util/configparser.c"
     break;
 
-  case 271:
-#line 846 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 283: /* server_trusted_keys_file: VAR_TRUSTED_KEYS_FILE STRING_ARG  */
+#line 891 "util/configparser.y"
+        {
 		OUTYY(("P(server_trusted_keys_file:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->
 			trusted_keys_file_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3201 "util/configparser.c" /* yacc.c:1646  */
+#line 3204 "util/configparser.c"
     break;
 
-  case 272:
-#line 854 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 284: /* server_trust_anchor: VAR_TRUST_ANCHOR STRING_ARG  */
+#line 899 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->trust_anchor_list, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3211 "util/configparser.c" /* yacc.c:1646  */
+#line 3214 "util/configparser.c"
     break;
 
-  case 273:
-#line 861 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 285: /* server_trust_anchor_signaling: VAR_TRUST_ANCHOR_SIGNALING STRING_ARG  */
+#line 906 "util/configparser.y"
+        {
 		OUTYY(("P(server_trust_anchor_signaling:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3221,99 +3224,99 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3225 "util/configparser.c" /* yacc.c:1646  */
+#line 3228 "util/configparser.c"
     break;
 
-  case 274:
-#line 872 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 286: /* server_domain_insecure: VAR_DOMAIN_INSECURE STRING_ARG  */
+#line 917 "util/configparser.y"
+        {
 		OUTYY(("P(server_domain_insecure:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->domain_insecure, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3235 "util/configparser.c" /* yacc.c:1646  */
+#line 3238 "util/configparser.c"
     break;
 
-  case 275:
-#line 879 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 287: /* server_hide_identity: VAR_HIDE_IDENTITY STRING_ARG  */
+#line 924 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_identity = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3247 "util/configparser.c" /* yacc.c:1646  */
+#line 3250 "util/configparser.c"
     break;
 
-  case 276:
-#line 888 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 288: /* server_hide_version: VAR_HIDE_VERSION STRING_ARG  */
+#line 933 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_version = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3259 "util/configparser.c" /* yacc.c:1646  */
+#line 3262 "util/configparser.c"
     break;
 
-  case 277:
-#line 897 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 289: /* server_hide_trustanchor: VAR_HIDE_TRUSTANCHOR STRING_ARG  */
+#line 942 "util/configparser.y"
+        {
 		OUTYY(("P(server_hide_trustanchor:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->hide_trustanchor = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3271 "util/configparser.c" /* yacc.c:1646  */
+#line 3274 "util/configparser.c"
     break;
 
-  case 278:
-#line 906 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 290: /* server_identity: VAR_IDENTITY STRING_ARG  */
+#line 951 "util/configparser.y"
+        {
 		OUTYY(("P(server_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->identity);
 		cfg_parser->cfg->identity = (yyvsp[0].str);
 	}
-#line 3281 "util/configparser.c" /* yacc.c:1646  */
+#line 3284 "util/configparser.c"
     break;
 
-  case 279:
-#line 913 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 291: /* server_version: VAR_VERSION STRING_ARG  */
+#line 958 "util/configparser.y"
+        {
 		OUTYY(("P(server_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->version);
 		cfg_parser->cfg->version = (yyvsp[0].str);
 	}
-#line 3291 "util/configparser.c" /* yacc.c:1646  */
+#line 3294 "util/configparser.c"
     break;
 
-  case 280:
-#line 920 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 292: /* server_so_rcvbuf: VAR_SO_RCVBUF STRING_ARG  */
+#line 965 "util/configparser.y"
+        {
 		OUTYY(("P(server_so_rcvbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_rcvbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3302 "util/configparser.c" /* yacc.c:1646  */
+#line 3305 "util/configparser.c"
     break;
 
-  case 281:
-#line 928 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 293: /* server_so_sndbuf: VAR_SO_SNDBUF STRING_ARG  */
+#line 973 "util/configparser.y"
+        {
 		OUTYY(("P(server_so_sndbuf:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->so_sndbuf))
 			yyerror("buffer size expected");
 		free((yyvsp[0].str));
 	}
-#line 3313 "util/configparser.c" /* yacc.c:1646  */
+#line 3316 "util/configparser.c"
     break;
 
-  case 282:
-#line 936 "./util/configparser.y" /* yacc.c:1646  */
+  case 294: /* server_so_reuseport: VAR_SO_REUSEPORT STRING_ARG  */
+#line 981 "util/configparser.y"
     {
         OUTYY(("P(server_so_reuseport:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3322,11 +3325,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3326 "util/configparser.c" /* yacc.c:1646  */
+#line 3329 "util/configparser.c"
     break;
 
-  case 283:
-#line 946 "./util/configparser.y" /* yacc.c:1646  */
+  case 295: /* server_ip_transparent: VAR_IP_TRANSPARENT STRING_ARG  */
+#line 991 "util/configparser.y"
     {
         OUTYY(("P(server_ip_transparent:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3335,11 +3338,11 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3339 "util/configparser.c" /* yacc.c:1646  */
+#line 3342 "util/configparser.c"
     break;
 
-  case 284:
-#line 956 "./util/configparser.y" /* yacc.c:1646  */
+  case 296: /* server_ip_freebind: VAR_IP_FREEBIND STRING_ARG  */
+#line 1001 "util/configparser.y"
     {
         OUTYY(("P(server_ip_freebind:%s)\n", (yyvsp[0].str)));
         if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -3348,12 +3351,12 @@ yyreduce:
             (strcmp((yyvsp[0].str), "yes")==0);
         free((yyvsp[0].str));
     }
-#line 3352 "util/configparser.c" /* yacc.c:1646  */
+#line 3355 "util/configparser.c"
     break;
 
-  case 285:
-#line 966 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 297: /* server_edns_buffer_size: VAR_EDNS_BUFFER_SIZE STRING_ARG  */
+#line 1011 "util/configparser.y"
+        {
 		OUTYY(("P(server_edns_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3364,12 +3367,12 @@ yyreduce:
 		else cfg_parser->cfg->edns_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3368 "util/configparser.c" /* yacc.c:1646  */
+#line 3371 "util/configparser.c"
     break;
 
-  case 286:
-#line 979 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 298: /* server_msg_buffer_size: VAR_MSG_BUFFER_SIZE STRING_ARG  */
+#line 1024 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_buffer_size:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3378,23 +3381,23 @@ yyreduce:
 		else cfg_parser->cfg->msg_buffer_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3382 "util/configparser.c" /* yacc.c:1646  */
+#line 3385 "util/configparser.c"
     break;
 
-  case 287:
-#line 990 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 299: /* server_msg_cache_size: VAR_MSG_CACHE_SIZE STRING_ARG  */
+#line 1035 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->msg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3393 "util/configparser.c" /* yacc.c:1646  */
+#line 3396 "util/configparser.c"
     break;
 
-  case 288:
-#line 998 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 300: /* server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG  */
+#line 1043 "util/configparser.y"
+        {
 		OUTYY(("P(server_msg_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3405,48 +3408,61 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3409 "util/configparser.c" /* yacc.c:1646  */
+#line 3412 "util/configparser.c"
     break;
 
-  case 289:
-#line 1011 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 301: /* server_msg_cache_wireformat: VAR_MSG_CACHE_WIREFORMAT STRING_ARG  */
+#line 1056 "util/configparser.y"
+        {
+		OUTYY(("P(server_msg_cache_wireformat:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->msg_cache_wireformat =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3425 "util/configparser.c"
+    break;
+
+  case 302: /* server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG  */
+#line 1066 "util/configparser.y"
+        {
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->num_queries_per_thread = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3421 "util/configparser.c" /* yacc.c:1646  */
+#line 3437 "util/configparser.c"
     break;
 
-  case 290:
-#line 1020 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 303: /* server_jostle_timeout: VAR_JOSTLE_TIMEOUT STRING_ARG  */
+#line 1075 "util/configparser.y"
+        {
 		OUTYY(("P(server_jostle_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->jostle_time = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3433 "util/configparser.c" /* yacc.c:1646  */
+#line 3449 "util/configparser.c"
     break;
 
-  case 291:
-#line 1029 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 304: /* server_delay_close: VAR_DELAY_CLOSE STRING_ARG  */
+#line 1084 "util/configparser.y"
+        {
 		OUTYY(("P(server_delay_close:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->delay_close = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3445 "util/configparser.c" /* yacc.c:1646  */
+#line 3461 "util/configparser.c"
     break;
 
-  case 292:
-#line 1038 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 305: /* server_unblock_lan_zones: VAR_UNBLOCK_LAN_ZONES STRING_ARG  */
+#line 1093 "util/configparser.y"
+        {
 		OUTYY(("P(server_unblock_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3454,12 +3470,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3458 "util/configparser.c" /* yacc.c:1646  */
+#line 3474 "util/configparser.c"
     break;
 
-  case 293:
-#line 1048 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 306: /* server_insecure_lan_zones: VAR_INSECURE_LAN_ZONES STRING_ARG  */
+#line 1103 "util/configparser.y"
+        {
 		OUTYY(("P(server_insecure_lan_zones:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3467,23 +3483,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3471 "util/configparser.c" /* yacc.c:1646  */
+#line 3487 "util/configparser.c"
     break;
 
-  case 294:
-#line 1058 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 307: /* server_rrset_cache_size: VAR_RRSET_CACHE_SIZE STRING_ARG  */
+#line 1113 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->rrset_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 3482 "util/configparser.c" /* yacc.c:1646  */
+#line 3498 "util/configparser.c"
     break;
 
-  case 295:
-#line 1066 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 308: /* server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG  */
+#line 1121 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3494,58 +3510,71 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3498 "util/configparser.c" /* yacc.c:1646  */
+#line 3514 "util/configparser.c"
     break;
 
-  case 296:
-#line 1079 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 309: /* server_cache_huge_pages: VAR_CACHE_HUGE_PAGES STRING_ARG  */
+#line 1134 "util/configparser.y"
+        {
+		OUTYY(("P(server_cache_huge_pages:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_huge_pages =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 3527 "util/configparser.c"
+    break;
+
+  case 310: /* server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG  */
+#line 1144 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_host_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->host_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3510 "util/configparser.c" /* yacc.c:1646  */
+#line 3539 "util/configparser.c"
     break;
 
-  case 297:
-#line 1088 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 311: /* server_infra_lame_ttl: VAR_INFRA_LAME_TTL STRING_ARG  */
+#line 1153 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_lame_ttl:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-lame-ttl: %s (option "
 			"removed, use infra-host-ttl)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3521 "util/configparser.c" /* yacc.c:1646  */
+#line 3550 "util/configparser.c"
     break;
 
-  case 298:
-#line 1096 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 312: /* server_infra_cache_numhosts: VAR_INFRA_CACHE_NUMHOSTS STRING_ARG  */
+#line 1161 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_numhosts:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_numhosts = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3533 "util/configparser.c" /* yacc.c:1646  */
+#line 3562 "util/configparser.c"
     break;
 
-  case 299:
-#line 1105 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 313: /* server_infra_cache_lame_size: VAR_INFRA_CACHE_LAME_SIZE STRING_ARG  */
+#line 1170 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_lame_size:%s)\n", (yyvsp[0].str)));
 		verbose(VERB_DETAIL, "ignored infra-cache-lame-size: %s "
 			"(option removed, use infra-cache-numhosts)", (yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3544 "util/configparser.c" /* yacc.c:1646  */
+#line 3573 "util/configparser.c"
     break;
 
-  case 300:
-#line 1113 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 314: /* server_infra_cache_slabs: VAR_INFRA_CACHE_SLABS STRING_ARG  */
+#line 1178 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -3556,34 +3585,34 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3560 "util/configparser.c" /* yacc.c:1646  */
+#line 3589 "util/configparser.c"
     break;
 
-  case 301:
-#line 1126 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 315: /* server_infra_cache_min_rtt: VAR_INFRA_CACHE_MIN_RTT STRING_ARG  */
+#line 1191 "util/configparser.y"
+        {
 		OUTYY(("P(server_infra_cache_min_rtt:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->infra_cache_min_rtt = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3572 "util/configparser.c" /* yacc.c:1646  */
+#line 3601 "util/configparser.c"
     break;
 
-  case 302:
-#line 1135 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 316: /* server_target_fetch_policy: VAR_TARGET_FETCH_POLICY STRING_ARG  */
+#line 1200 "util/configparser.y"
+        {
 		OUTYY(("P(server_target_fetch_policy:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->target_fetch_policy);
 		cfg_parser->cfg->target_fetch_policy = (yyvsp[0].str);
 	}
-#line 3582 "util/configparser.c" /* yacc.c:1646  */
+#line 3611 "util/configparser.c"
     break;
 
-  case 303:
-#line 1142 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 317: /* server_harden_short_bufsize: VAR_HARDEN_SHORT_BUFSIZE STRING_ARG  */
+#line 1207 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_short_bufsize:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3591,12 +3620,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3595 "util/configparser.c" /* yacc.c:1646  */
+#line 3624 "util/configparser.c"
     break;
 
-  case 304:
-#line 1152 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 318: /* server_harden_large_queries: VAR_HARDEN_LARGE_QUERIES STRING_ARG  */
+#line 1217 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_large_queries:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3604,12 +3633,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3608 "util/configparser.c" /* yacc.c:1646  */
+#line 3637 "util/configparser.c"
     break;
 
-  case 305:
-#line 1162 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 319: /* server_harden_glue: VAR_HARDEN_GLUE STRING_ARG  */
+#line 1227 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_glue:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3617,12 +3646,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3621 "util/configparser.c" /* yacc.c:1646  */
+#line 3650 "util/configparser.c"
     break;
 
-  case 306:
-#line 1172 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 320: /* server_harden_dnssec_stripped: VAR_HARDEN_DNSSEC_STRIPPED STRING_ARG  */
+#line 1237 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_dnssec_stripped:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3630,12 +3659,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3634 "util/configparser.c" /* yacc.c:1646  */
+#line 3663 "util/configparser.c"
     break;
 
-  case 307:
-#line 1182 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 321: /* server_harden_below_nxdomain: VAR_HARDEN_BELOW_NXDOMAIN STRING_ARG  */
+#line 1247 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_below_nxdomain:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3643,12 +3672,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3647 "util/configparser.c" /* yacc.c:1646  */
+#line 3676 "util/configparser.c"
     break;
 
-  case 308:
-#line 1192 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 322: /* server_harden_referral_path: VAR_HARDEN_REFERRAL_PATH STRING_ARG  */
+#line 1257 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_referral_path:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3656,12 +3685,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3660 "util/configparser.c" /* yacc.c:1646  */
+#line 3689 "util/configparser.c"
     break;
 
-  case 309:
-#line 1202 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 323: /* server_harden_algo_downgrade: VAR_HARDEN_ALGO_DOWNGRADE STRING_ARG  */
+#line 1267 "util/configparser.y"
+        {
 		OUTYY(("P(server_harden_algo_downgrade:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3669,12 +3698,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3673 "util/configparser.c" /* yacc.c:1646  */
+#line 3702 "util/configparser.c"
     break;
 
-  case 310:
-#line 1212 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 324: /* server_use_caps_for_id: VAR_USE_CAPS_FOR_ID STRING_ARG  */
+#line 1277 "util/configparser.y"
+        {
 		OUTYY(("P(server_use_caps_for_id:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3682,88 +3711,88 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3686 "util/configparser.c" /* yacc.c:1646  */
+#line 3715 "util/configparser.c"
     break;
 
-  case 311:
-#line 1222 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 325: /* server_caps_whitelist: VAR_CAPS_WHITELIST STRING_ARG  */
+#line 1287 "util/configparser.y"
+        {
 		OUTYY(("P(server_caps_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->caps_whitelist, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3696 "util/configparser.c" /* yacc.c:1646  */
+#line 3725 "util/configparser.c"
     break;
 
-  case 312:
-#line 1229 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 326: /* server_private_address: VAR_PRIVATE_ADDRESS STRING_ARG  */
+#line 1294 "util/configparser.y"
+        {
 		OUTYY(("P(server_private_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_address, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3706 "util/configparser.c" /* yacc.c:1646  */
+#line 3735 "util/configparser.c"
     break;
 
-  case 313:
-#line 1236 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 327: /* server_private_domain: VAR_PRIVATE_DOMAIN STRING_ARG  */
+#line 1301 "util/configparser.y"
+        {
 		OUTYY(("P(server_private_domain:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->private_domain, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3716 "util/configparser.c" /* yacc.c:1646  */
+#line 3745 "util/configparser.c"
     break;
 
-  case 314:
-#line 1243 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 328: /* server_prefetch: VAR_PREFETCH STRING_ARG  */
+#line 1308 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3728 "util/configparser.c" /* yacc.c:1646  */
+#line 3757 "util/configparser.c"
     break;
 
-  case 315:
-#line 1252 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 329: /* server_prefetch_key: VAR_PREFETCH_KEY STRING_ARG  */
+#line 1317 "util/configparser.y"
+        {
 		OUTYY(("P(server_prefetch_key:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->prefetch_key = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3740 "util/configparser.c" /* yacc.c:1646  */
+#line 3769 "util/configparser.c"
     break;
 
-  case 316:
-#line 1261 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 330: /* server_unwanted_reply_threshold: VAR_UNWANTED_REPLY_THRESHOLD STRING_ARG  */
+#line 1326 "util/configparser.y"
+        {
 		OUTYY(("P(server_unwanted_reply_threshold:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->unwanted_threshold = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3752 "util/configparser.c" /* yacc.c:1646  */
+#line 3781 "util/configparser.c"
     break;
 
-  case 317:
-#line 1270 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 331: /* server_do_not_query_address: VAR_DO_NOT_QUERY_ADDRESS STRING_ARG  */
+#line 1335 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_address:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->donotqueryaddrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 3762 "util/configparser.c" /* yacc.c:1646  */
+#line 3791 "util/configparser.c"
     break;
 
-  case 318:
-#line 1277 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 332: /* server_do_not_query_localhost: VAR_DO_NOT_QUERY_LOCALHOST STRING_ARG  */
+#line 1342 "util/configparser.y"
+        {
 		OUTYY(("P(server_do_not_query_localhost:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3771,12 +3800,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3775 "util/configparser.c" /* yacc.c:1646  */
+#line 3804 "util/configparser.c"
     break;
 
-  case 319:
-#line 1287 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 333: /* server_access_control: VAR_ACCESS_CONTROL STRING_ARG STRING_ARG  */
+#line 1352 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "deny")!=0 && strcmp((yyvsp[0].str), "refuse")!=0 &&
 			strcmp((yyvsp[0].str), "deny_non_local")!=0 &&
@@ -3791,22 +3820,22 @@ yyreduce:
 				fatal_exit("out of memory adding acl");
 		}
 	}
-#line 3795 "util/configparser.c" /* yacc.c:1646  */
+#line 3824 "util/configparser.c"
     break;
 
-  case 320:
-#line 1304 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 334: /* server_module_conf: VAR_MODULE_CONF STRING_ARG  */
+#line 1369 "util/configparser.y"
+        {
 		OUTYY(("P(server_module_conf:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->module_conf);
 		cfg_parser->cfg->module_conf = (yyvsp[0].str);
 	}
-#line 3805 "util/configparser.c" /* yacc.c:1646  */
+#line 3834 "util/configparser.c"
     break;
 
-  case 321:
-#line 1311 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 335: /* server_val_override_date: VAR_VAL_OVERRIDE_DATE STRING_ARG  */
+#line 1376 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_override_date:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_date_override = 0;
@@ -3822,12 +3851,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3826 "util/configparser.c" /* yacc.c:1646  */
+#line 3855 "util/configparser.c"
     break;
 
-  case 322:
-#line 1329 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 336: /* server_val_sig_skew_min: VAR_VAL_SIG_SKEW_MIN STRING_ARG  */
+#line 1394 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_min:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_min = 0;
@@ -3838,12 +3867,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3842 "util/configparser.c" /* yacc.c:1646  */
+#line 3871 "util/configparser.c"
     break;
 
-  case 323:
-#line 1342 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 337: /* server_val_sig_skew_max: VAR_VAL_SIG_SKEW_MAX STRING_ARG  */
+#line 1407 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_sig_skew_max:%s)\n", (yyvsp[0].str)));
 		if(*(yyvsp[0].str) == '\0' || strcmp((yyvsp[0].str), "0") == 0) {
 			cfg_parser->cfg->val_sig_skew_max = 0;
@@ -3854,60 +3883,60 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 3858 "util/configparser.c" /* yacc.c:1646  */
+#line 3887 "util/configparser.c"
     break;
 
-  case 324:
-#line 1355 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 338: /* server_cache_max_ttl: VAR_CACHE_MAX_TTL STRING_ARG  */
+#line 1420 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3870 "util/configparser.c" /* yacc.c:1646  */
+#line 3899 "util/configparser.c"
     break;
 
-  case 325:
-#line 1364 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 339: /* server_cache_max_negative_ttl: VAR_CACHE_MAX_NEGATIVE_TTL STRING_ARG  */
+#line 1429 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_max_negative_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->max_negative_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3882 "util/configparser.c" /* yacc.c:1646  */
+#line 3911 "util/configparser.c"
     break;
 
-  case 326:
-#line 1373 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 340: /* server_cache_min_ttl: VAR_CACHE_MIN_TTL STRING_ARG  */
+#line 1438 "util/configparser.y"
+        {
 		OUTYY(("P(server_cache_min_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->min_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3894 "util/configparser.c" /* yacc.c:1646  */
+#line 3923 "util/configparser.c"
     break;
 
-  case 327:
-#line 1382 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 341: /* server_bogus_ttl: VAR_BOGUS_TTL STRING_ARG  */
+#line 1447 "util/configparser.y"
+        {
 		OUTYY(("P(server_bogus_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->bogus_ttl = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 3906 "util/configparser.c" /* yacc.c:1646  */
+#line 3935 "util/configparser.c"
     break;
 
-  case 328:
-#line 1391 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 342: /* server_val_clean_additional: VAR_VAL_CLEAN_ADDITIONAL STRING_ARG  */
+#line 1456 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_clean_additional:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3915,12 +3944,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3919 "util/configparser.c" /* yacc.c:1646  */
+#line 3948 "util/configparser.c"
     break;
 
-  case 329:
-#line 1401 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 343: /* server_val_permissive_mode: VAR_VAL_PERMISSIVE_MODE STRING_ARG  */
+#line 1466 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_permissive_mode:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3928,12 +3957,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3932 "util/configparser.c" /* yacc.c:1646  */
+#line 3961 "util/configparser.c"
     break;
 
-  case 330:
-#line 1411 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 344: /* server_aggressive_nsec: VAR_AGGRESSIVE_NSEC STRING_ARG  */
+#line 1476 "util/configparser.y"
+        {
 		OUTYY(("P(server_aggressive_nsec:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3942,36 +3971,36 @@ yyreduce:
 				(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3946 "util/configparser.c" /* yacc.c:1646  */
+#line 3975 "util/configparser.c"
     break;
 
-  case 331:
-#line 1422 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 345: /* server_ignore_cd_flag: VAR_IGNORE_CD_FLAG STRING_ARG  */
+#line 1487 "util/configparser.y"
+        {
 		OUTYY(("P(server_ignore_cd_flag:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->ignore_cd = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3958 "util/configparser.c" /* yacc.c:1646  */
+#line 3987 "util/configparser.c"
     break;
 
-  case 332:
-#line 1431 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 346: /* server_serve_expired: VAR_SERVE_EXPIRED STRING_ARG  */
+#line 1496 "util/configparser.y"
+        {
 		OUTYY(("P(server_serve_expired:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->serve_expired = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 3970 "util/configparser.c" /* yacc.c:1646  */
+#line 3999 "util/configparser.c"
     break;
 
-  case 333:
-#line 1440 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 347: /* server_fake_dsa: VAR_FAKE_DSA STRING_ARG  */
+#line 1505 "util/configparser.y"
+        {
 		OUTYY(("P(server_fake_dsa:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3982,12 +4011,12 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 3986 "util/configparser.c" /* yacc.c:1646  */
+#line 4015 "util/configparser.c"
     break;
 
-  case 334:
-#line 1453 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 348: /* server_fake_sha1: VAR_FAKE_SHA1 STRING_ARG  */
+#line 1518 "util/configparser.y"
+        {
 		OUTYY(("P(server_fake_sha1:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -3998,70 +4027,70 @@ yyreduce:
 #endif
 		free((yyvsp[0].str));
 	}
-#line 4002 "util/configparser.c" /* yacc.c:1646  */
+#line 4031 "util/configparser.c"
     break;
 
-  case 335:
-#line 1466 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 349: /* server_val_log_level: VAR_VAL_LOG_LEVEL STRING_ARG  */
+#line 1531 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_log_level:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->val_log_level = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4014 "util/configparser.c" /* yacc.c:1646  */
+#line 4043 "util/configparser.c"
     break;
 
-  case 336:
-#line 1475 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 350: /* server_val_nsec3_keysize_iterations: VAR_VAL_NSEC3_KEYSIZE_ITERATIONS STRING_ARG  */
+#line 1540 "util/configparser.y"
+        {
 		OUTYY(("P(server_val_nsec3_keysize_iterations:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->val_nsec3_key_iterations);
 		cfg_parser->cfg->val_nsec3_key_iterations = (yyvsp[0].str);
 	}
-#line 4024 "util/configparser.c" /* yacc.c:1646  */
+#line 4053 "util/configparser.c"
     break;
 
-  case 337:
-#line 1482 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 351: /* server_add_holddown: VAR_ADD_HOLDDOWN STRING_ARG  */
+#line 1547 "util/configparser.y"
+        {
 		OUTYY(("P(server_add_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->add_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4036 "util/configparser.c" /* yacc.c:1646  */
+#line 4065 "util/configparser.c"
     break;
 
-  case 338:
-#line 1491 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 352: /* server_del_holddown: VAR_DEL_HOLDDOWN STRING_ARG  */
+#line 1556 "util/configparser.y"
+        {
 		OUTYY(("P(server_del_holddown:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->del_holddown = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4048 "util/configparser.c" /* yacc.c:1646  */
+#line 4077 "util/configparser.c"
     break;
 
-  case 339:
-#line 1500 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 353: /* server_keep_missing: VAR_KEEP_MISSING STRING_ARG  */
+#line 1565 "util/configparser.y"
+        {
 		OUTYY(("P(server_keep_missing:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->keep_missing = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4060 "util/configparser.c" /* yacc.c:1646  */
+#line 4089 "util/configparser.c"
     break;
 
-  case 340:
-#line 1509 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 354: /* server_permit_small_holddown: VAR_PERMIT_SMALL_HOLDDOWN STRING_ARG  */
+#line 1574 "util/configparser.y"
+        {
 		OUTYY(("P(server_permit_small_holddown:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4069,23 +4098,23 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4073 "util/configparser.c" /* yacc.c:1646  */
+#line 4102 "util/configparser.c"
     break;
 
-  case 341:
-#line 1518 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 355: /* server_key_cache_size: VAR_KEY_CACHE_SIZE STRING_ARG  */
+#line 1583 "util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->key_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4084 "util/configparser.c" /* yacc.c:1646  */
+#line 4113 "util/configparser.c"
     break;
 
-  case 342:
-#line 1526 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 356: /* server_key_cache_slabs: VAR_KEY_CACHE_SLABS STRING_ARG  */
+#line 1591 "util/configparser.y"
+        {
 		OUTYY(("P(server_key_cache_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4096,23 +4125,23 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4100 "util/configparser.c" /* yacc.c:1646  */
+#line 4129 "util/configparser.c"
     break;
 
-  case 343:
-#line 1539 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 357: /* server_neg_cache_size: VAR_NEG_CACHE_SIZE STRING_ARG  */
+#line 1604 "util/configparser.y"
+        {
 		OUTYY(("P(server_neg_cache_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->neg_cache_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4111 "util/configparser.c" /* yacc.c:1646  */
+#line 4140 "util/configparser.c"
     break;
 
-  case 344:
-#line 1547 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 358: /* server_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 1612 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4139,22 +4168,22 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4143 "util/configparser.c" /* yacc.c:1646  */
+#line 4172 "util/configparser.c"
     break;
 
-  case 345:
-#line 1576 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 359: /* server_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 1641 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->local_data, (yyvsp[0].str)))
 			fatal_exit("out of memory adding local-data");
 	}
-#line 4153 "util/configparser.c" /* yacc.c:1646  */
+#line 4182 "util/configparser.c"
     break;
 
-  case 346:
-#line 1583 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 360: /* server_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 1648 "util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(server_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -4167,12 +4196,12 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 4171 "util/configparser.c" /* yacc.c:1646  */
+#line 4200 "util/configparser.c"
     break;
 
-  case 347:
-#line 1598 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 361: /* server_minimal_responses: VAR_MINIMAL_RESPONSES STRING_ARG  */
+#line 1663 "util/configparser.y"
+        {
 		OUTYY(("P(server_minimal_responses:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4180,12 +4209,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4184 "util/configparser.c" /* yacc.c:1646  */
+#line 4213 "util/configparser.c"
     break;
 
-  case 348:
-#line 1608 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 362: /* server_rrset_roundrobin: VAR_RRSET_ROUNDROBIN STRING_ARG  */
+#line 1673 "util/configparser.y"
+        {
 		OUTYY(("P(server_rrset_roundrobin:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4193,44 +4222,44 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4197 "util/configparser.c" /* yacc.c:1646  */
+#line 4226 "util/configparser.c"
     break;
 
-  case 349:
-#line 1618 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 363: /* server_max_udp_size: VAR_MAX_UDP_SIZE STRING_ARG  */
+#line 1683 "util/configparser.y"
+        {
 		OUTYY(("P(server_max_udp_size:%s)\n", (yyvsp[0].str)));
 		cfg_parser->cfg->max_udp_size = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4207 "util/configparser.c" /* yacc.c:1646  */
+#line 4236 "util/configparser.c"
     break;
 
-  case 350:
-#line 1625 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 364: /* server_dns64_prefix: VAR_DNS64_PREFIX STRING_ARG  */
+#line 1690 "util/configparser.y"
+        {
 		OUTYY(("P(dns64_prefix:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dns64_prefix);
 		cfg_parser->cfg->dns64_prefix = (yyvsp[0].str);
 	}
-#line 4217 "util/configparser.c" /* yacc.c:1646  */
+#line 4246 "util/configparser.c"
     break;
 
-  case 351:
-#line 1632 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 365: /* server_dns64_synthall: VAR_DNS64_SYNTHALL STRING_ARG  */
+#line 1697 "util/configparser.y"
+        {
 		OUTYY(("P(server_dns64_synthall:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dns64_synthall = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4229 "util/configparser.c" /* yacc.c:1646  */
+#line 4258 "util/configparser.c"
     break;
 
-  case 352:
-#line 1641 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 366: /* server_define_tag: VAR_DEFINE_TAG STRING_ARG  */
+#line 1706 "util/configparser.y"
+        {
 		char* p, *s = (yyvsp[0].str);
 		OUTYY(("P(server_define_tag:%s)\n", (yyvsp[0].str)));
 		while((p=strsep(&s, " \t\n")) != NULL) {
@@ -4242,12 +4271,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4246 "util/configparser.c" /* yacc.c:1646  */
+#line 4275 "util/configparser.c"
     break;
 
-  case 353:
-#line 1655 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 367: /* server_local_zone_tag: VAR_LOCAL_ZONE_TAG STRING_ARG STRING_ARG  */
+#line 1720 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4264,12 +4293,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4268 "util/configparser.c" /* yacc.c:1646  */
+#line 4297 "util/configparser.c"
     break;
 
-  case 354:
-#line 1674 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 368: /* server_access_control_tag: VAR_ACCESS_CONTROL_TAG STRING_ARG STRING_ARG  */
+#line 1739 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4286,12 +4315,12 @@ yyreduce:
 			}
 		}
 	}
-#line 4290 "util/configparser.c" /* yacc.c:1646  */
+#line 4319 "util/configparser.c"
     break;
 
-  case 355:
-#line 1693 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 369: /* server_access_control_tag_action: VAR_ACCESS_CONTROL_TAG_ACTION STRING_ARG STRING_ARG STRING_ARG  */
+#line 1758 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_action:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_actions,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4301,12 +4330,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4305 "util/configparser.c" /* yacc.c:1646  */
+#line 4334 "util/configparser.c"
     break;
 
-  case 356:
-#line 1705 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 370: /* server_access_control_tag_data: VAR_ACCESS_CONTROL_TAG_DATA STRING_ARG STRING_ARG STRING_ARG  */
+#line 1770 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_tag_data:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->acl_tag_datas,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4316,12 +4345,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4320 "util/configparser.c" /* yacc.c:1646  */
+#line 4349 "util/configparser.c"
     break;
 
-  case 357:
-#line 1717 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 371: /* server_local_zone_override: VAR_LOCAL_ZONE_OVERRIDE STRING_ARG STRING_ARG STRING_ARG  */
+#line 1782 "util/configparser.y"
+        {
 		OUTYY(("P(server_local_zone_override:%s %s %s)\n", (yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str3list_insert(&cfg_parser->cfg->local_zone_overrides,
 			(yyvsp[-2].str), (yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4331,12 +4360,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4335 "util/configparser.c" /* yacc.c:1646  */
+#line 4364 "util/configparser.c"
     break;
 
-  case 358:
-#line 1729 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 372: /* server_access_control_view: VAR_ACCESS_CONTROL_VIEW STRING_ARG STRING_ARG  */
+#line 1794 "util/configparser.y"
+        {
 		OUTYY(("P(server_access_control_view:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->acl_view,
 			(yyvsp[-1].str), (yyvsp[0].str))) {
@@ -4345,12 +4374,12 @@ yyreduce:
 			free((yyvsp[0].str));
 		}
 	}
-#line 4349 "util/configparser.c" /* yacc.c:1646  */
+#line 4378 "util/configparser.c"
     break;
 
-  case 359:
-#line 1740 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 373: /* server_response_ip_tag: VAR_RESPONSE_IP_TAG STRING_ARG STRING_ARG  */
+#line 1805 "util/configparser.y"
+        {
 		size_t len = 0;
 		uint8_t* bitlist = config_parse_taglist(cfg_parser->cfg, (yyvsp[0].str),
 			&len);
@@ -4367,58 +4396,58 @@ yyreduce:
 			}
 		}
 	}
-#line 4371 "util/configparser.c" /* yacc.c:1646  */
+#line 4400 "util/configparser.c"
     break;
 
-  case 360:
-#line 1759 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 374: /* server_ip_ratelimit: VAR_IP_RATELIMIT STRING_ARG  */
+#line 1824 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ip_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ip_ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4383 "util/configparser.c" /* yacc.c:1646  */
+#line 4412 "util/configparser.c"
     break;
 
-  case 361:
-#line 1769 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 375: /* server_ratelimit: VAR_RATELIMIT STRING_ARG  */
+#line 1834 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4395 "util/configparser.c" /* yacc.c:1646  */
+#line 4424 "util/configparser.c"
     break;
 
-  case 362:
-#line 1778 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 376: /* server_ip_ratelimit_size: VAR_IP_RATELIMIT_SIZE STRING_ARG  */
+#line 1843 "util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ip_ratelimit_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 4406 "util/configparser.c" /* yacc.c:1646  */
+#line 4435 "util/configparser.c"
     break;
 
-  case 363:
-#line 1786 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 377: /* server_ratelimit_size: VAR_RATELIMIT_SIZE STRING_ARG  */
+#line 1851 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_size:%s)\n", (yyvsp[0].str)));
 		if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->ratelimit_size))
 			yyerror("memory size expected");
 		free((yyvsp[0].str));
 	}
-#line 4417 "util/configparser.c" /* yacc.c:1646  */
+#line 4446 "util/configparser.c"
     break;
 
-  case 364:
-#line 1794 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 378: /* server_ip_ratelimit_slabs: VAR_IP_RATELIMIT_SLABS STRING_ARG  */
+#line 1859 "util/configparser.y"
+  {
   	OUTYY(("P(server_ip_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -4429,12 +4458,12 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 4433 "util/configparser.c" /* yacc.c:1646  */
+#line 4462 "util/configparser.c"
     break;
 
-  case 365:
-#line 1807 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 379: /* server_ratelimit_slabs: VAR_RATELIMIT_SLABS STRING_ARG  */
+#line 1872 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_slabs:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("number expected");
@@ -4445,12 +4474,12 @@ yyreduce:
 		}
 		free((yyvsp[0].str));
 	}
-#line 4449 "util/configparser.c" /* yacc.c:1646  */
+#line 4478 "util/configparser.c"
     break;
 
-  case 366:
-#line 1820 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 380: /* server_ratelimit_for_domain: VAR_RATELIMIT_FOR_DOMAIN STRING_ARG STRING_ARG  */
+#line 1885 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_for_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4461,12 +4490,12 @@ yyreduce:
 					"ratelimit-for-domain");
 		}
 	}
-#line 4465 "util/configparser.c" /* yacc.c:1646  */
+#line 4494 "util/configparser.c"
     break;
 
-  case 367:
-#line 1833 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 381: /* server_ratelimit_below_domain: VAR_RATELIMIT_BELOW_DOMAIN STRING_ARG STRING_ARG  */
+#line 1898 "util/configparser.y"
+        {
 		OUTYY(("P(server_ratelimit_below_domain:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0) {
 			yyerror("number expected");
@@ -4477,36 +4506,36 @@ yyreduce:
 					"ratelimit-below-domain");
 		}
 	}
-#line 4481 "util/configparser.c" /* yacc.c:1646  */
+#line 4510 "util/configparser.c"
     break;
 
-  case 368:
-#line 1846 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 382: /* server_ip_ratelimit_factor: VAR_IP_RATELIMIT_FACTOR STRING_ARG  */
+#line 1911 "util/configparser.y"
+  { 
   	OUTYY(("P(server_ip_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
   	if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
   		yyerror("number expected");
   	else cfg_parser->cfg->ip_ratelimit_factor = atoi((yyvsp[0].str));
   	free((yyvsp[0].str));
 	}
-#line 4493 "util/configparser.c" /* yacc.c:1646  */
+#line 4522 "util/configparser.c"
     break;
 
-  case 369:
-#line 1855 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 383: /* server_ratelimit_factor: VAR_RATELIMIT_FACTOR STRING_ARG  */
+#line 1920 "util/configparser.y"
+        { 
 		OUTYY(("P(server_ratelimit_factor:%s)\n", (yyvsp[0].str))); 
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
 			yyerror("number expected");
 		else cfg_parser->cfg->ratelimit_factor = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4505 "util/configparser.c" /* yacc.c:1646  */
+#line 4534 "util/configparser.c"
     break;
 
-  case 370:
-#line 1864 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 384: /* server_qname_minimisation: VAR_QNAME_MINIMISATION STRING_ARG  */
+#line 1929 "util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4514,12 +4543,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4518 "util/configparser.c" /* yacc.c:1646  */
+#line 4547 "util/configparser.c"
     break;
 
-  case 371:
-#line 1874 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 385: /* server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG  */
+#line 1939 "util/configparser.y"
+        {
 		OUTYY(("P(server_qname_minimisation_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4527,28 +4556,77 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4531 "util/configparser.c" /* yacc.c:1646  */
+#line 4560 "util/configparser.c"
     break;
 
-  case 372:
-#line 1884 "./util/configparser.y" /* yacc.c:1646  */
-    {
-	#ifdef USE_IPSECMOD
-		OUTYY(("P(server_ipsecmod_enabled:%s)\n", (yyvsp[0].str)));
+  case 386: /* server_upstream_race: VAR_UPSTREAM_RACE STRING_ARG  */
+#line 1949 "util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_race:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
-		else cfg_parser->cfg->ipsecmod_enabled = (strcmp((yyvsp[0].str), "yes")==0);
+		else cfg_parser->cfg->upstream_race = 
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 4573 "util/configparser.c"
+    break;
+
+  case 387: /* server_upstream_race_delay: VAR_UPSTREAM_RACE_DELAY STRING_ARG  */
+#line 1959 "util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_race_delay:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_race_delay = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4585 "util/configparser.c"
+    break;
+
+  case 388: /* server_upstream_race_max: VAR_UPSTREAM_RACE_MAX STRING_ARG  */
+#line 1968 "util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_race_max:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_race_max = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4597 "util/configparser.c"
+    break;
+
+  case 389: /* server_upstream_race_budget: VAR_UPSTREAM_RACE_BUDGET STRING_ARG  */
+#line 1977 "util/configparser.y"
+        {
+		OUTYY(("P(server_upstream_race_budget:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_race_budget = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 4609 "util/configparser.c"
+    break;
+
+  case 390: /* server_ipsecmod_enabled: VAR_IPSECMOD_ENABLED STRING_ARG  */
+#line 1986 "util/configparser.y"
+        {
+	#ifdef USE_IPSECMOD
+		OUTYY(("P(server_ipsecmod_enabled:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->ipsecmod_enabled = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	#else
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4547 "util/configparser.c" /* yacc.c:1646  */
+#line 4625 "util/configparser.c"
     break;
 
-  case 373:
-#line 1897 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 391: /* server_ipsecmod_ignore_bogus: VAR_IPSECMOD_IGNORE_BOGUS STRING_ARG  */
+#line 1999 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_ignore_bogus:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4559,12 +4637,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4563 "util/configparser.c" /* yacc.c:1646  */
+#line 4641 "util/configparser.c"
     break;
 
-  case 374:
-#line 1910 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 392: /* server_ipsecmod_hook: VAR_IPSECMOD_HOOK STRING_ARG  */
+#line 2012 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_hook:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->ipsecmod_hook);
@@ -4573,12 +4651,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4577 "util/configparser.c" /* yacc.c:1646  */
+#line 4655 "util/configparser.c"
     break;
 
-  case 375:
-#line 1921 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 393: /* server_ipsecmod_max_ttl: VAR_IPSECMOD_MAX_TTL STRING_ARG  */
+#line 2023 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_max_ttl:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
@@ -4589,12 +4667,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4593 "util/configparser.c" /* yacc.c:1646  */
+#line 4671 "util/configparser.c"
     break;
 
-  case 376:
-#line 1934 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 394: /* server_ipsecmod_whitelist: VAR_IPSECMOD_WHITELIST STRING_ARG  */
+#line 2036 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_whitelist:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->ipsecmod_whitelist, (yyvsp[0].str)))
@@ -4603,12 +4681,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4607 "util/configparser.c" /* yacc.c:1646  */
+#line 4685 "util/configparser.c"
     break;
 
-  case 377:
-#line 1945 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 395: /* server_ipsecmod_strict: VAR_IPSECMOD_STRICT STRING_ARG  */
+#line 2047 "util/configparser.y"
+        {
 	#ifdef USE_IPSECMOD
 		OUTYY(("P(server_ipsecmod_strict:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
@@ -4619,12 +4697,12 @@ yyreduce:
 		OUTYY(("P(Compiled without IPsec module, ignoring)\n"));
 	#endif
 	}
-#line 4623 "util/configparser.c" /* yacc.c:1646  */
+#line 4701 "util/configparser.c"
     break;
 
-  case 378:
-#line 1958 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 396: /* stub_name: VAR_NAME STRING_ARG  */
+#line 2060 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->stubs->name)
 			yyerror("stub name override, there must be one name "
@@ -4632,44 +4710,44 @@ yyreduce:
 		free(cfg_parser->cfg->stubs->name);
 		cfg_parser->cfg->stubs->name = (yyvsp[0].str);
 	}
-#line 4636 "util/configparser.c" /* yacc.c:1646  */
+#line 4714 "util/configparser.c"
     break;
 
-  case 379:
-#line 1968 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 397: /* stub_host: VAR_STUB_HOST STRING_ARG  */
+#line 2070 "util/configparser.y"
+        {
 		OUTYY(("P(stub-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4646 "util/configparser.c" /* yacc.c:1646  */
+#line 4724 "util/configparser.c"
     break;
 
-  case 380:
-#line 1975 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 398: /* stub_addr: VAR_STUB_ADDR STRING_ARG  */
+#line 2077 "util/configparser.y"
+        {
 		OUTYY(("P(stub-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->stubs->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4656 "util/configparser.c" /* yacc.c:1646  */
+#line 4734 "util/configparser.c"
     break;
 
-  case 381:
-#line 1982 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 399: /* stub_first: VAR_STUB_FIRST STRING_ARG  */
+#line 2084 "util/configparser.y"
+        {
 		OUTYY(("P(stub-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->stubs->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4668 "util/configparser.c" /* yacc.c:1646  */
+#line 4746 "util/configparser.c"
     break;
 
-  case 382:
-#line 1991 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 400: /* stub_ssl_upstream: VAR_STUB_SSL_UPSTREAM STRING_ARG  */
+#line 2093 "util/configparser.y"
+        {
 		OUTYY(("P(stub-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4677,12 +4755,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4681 "util/configparser.c" /* yacc.c:1646  */
+#line 4759 "util/configparser.c"
     break;
 
-  case 383:
-#line 2001 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 401: /* stub_prime: VAR_STUB_PRIME STRING_ARG  */
+#line 2103 "util/configparser.y"
+        {
 		OUTYY(("P(stub-prime:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4690,12 +4768,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4694 "util/configparser.c" /* yacc.c:1646  */
+#line 4772 "util/configparser.c"
     break;
 
-  case 384:
-#line 2011 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 402: /* forward_name: VAR_NAME STRING_ARG  */
+#line 2113 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->forwards->name)
 			yyerror("forward name override, there must be one "
@@ -4703,44 +4781,44 @@ yyreduce:
 		free(cfg_parser->cfg->forwards->name);
 		cfg_parser->cfg->forwards->name = (yyvsp[0].str);
 	}
-#line 4707 "util/configparser.c" /* yacc.c:1646  */
+#line 4785 "util/configparser.c"
     break;
 
-  case 385:
-#line 2021 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 403: /* forward_host: VAR_FORWARD_HOST STRING_ARG  */
+#line 2123 "util/configparser.y"
+        {
 		OUTYY(("P(forward-host:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->hosts, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4717 "util/configparser.c" /* yacc.c:1646  */
+#line 4795 "util/configparser.c"
     break;
 
-  case 386:
-#line 2028 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 404: /* forward_addr: VAR_FORWARD_ADDR STRING_ARG  */
+#line 2130 "util/configparser.y"
+        {
 		OUTYY(("P(forward-addr:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->forwards->addrs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4727 "util/configparser.c" /* yacc.c:1646  */
+#line 4805 "util/configparser.c"
     break;
 
-  case 387:
-#line 2035 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 405: /* forward_first: VAR_FORWARD_FIRST STRING_ARG  */
+#line 2137 "util/configparser.y"
+        {
 		OUTYY(("P(forward-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->forwards->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4739 "util/configparser.c" /* yacc.c:1646  */
+#line 4817 "util/configparser.c"
     break;
 
-  case 388:
-#line 2044 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 406: /* forward_ssl_upstream: VAR_FORWARD_SSL_UPSTREAM STRING_ARG  */
+#line 2146 "util/configparser.y"
+        {
 		OUTYY(("P(forward-ssl-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4748,12 +4826,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4752 "util/configparser.c" /* yacc.c:1646  */
+#line 4830 "util/configparser.c"
     break;
 
-  case 389:
-#line 2054 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 407: /* auth_name: VAR_NAME STRING_ARG  */
+#line 2156 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->auths->name)
 			yyerror("auth name override, there must be one name "
@@ -4761,42 +4839,42 @@ yyreduce:
 		free(cfg_parser->cfg->auths->name);
 		cfg_parser->cfg->auths->name = (yyvsp[0].str);
 	}
-#line 4765 "util/configparser.c" /* yacc.c:1646  */
+#line 4843 "util/configparser.c"
     break;
 
-  case 390:
-#line 2064 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 408: /* auth_zonefile: VAR_ZONEFILE STRING_ARG  */
+#line 2166 "util/configparser.y"
+        {
 		OUTYY(("P(zonefile:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->auths->zonefile);
 		cfg_parser->cfg->auths->zonefile = (yyvsp[0].str);
 	}
-#line 4775 "util/configparser.c" /* yacc.c:1646  */
+#line 4853 "util/configparser.c"
     break;
 
-  case 391:
-#line 2071 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 409: /* auth_master: VAR_MASTER STRING_ARG  */
+#line 2173 "util/configparser.y"
+        {
 		OUTYY(("P(master:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->masters, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4785 "util/configparser.c" /* yacc.c:1646  */
+#line 4863 "util/configparser.c"
     break;
 
-  case 392:
-#line 2078 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 410: /* auth_url: VAR_URL STRING_ARG  */
+#line 2180 "util/configparser.y"
+        {
 		OUTYY(("P(url:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->auths->urls, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4795 "util/configparser.c" /* yacc.c:1646  */
+#line 4873 "util/configparser.c"
     break;
 
-  case 393:
-#line 2085 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 411: /* auth_for_downstream: VAR_FOR_DOWNSTREAM STRING_ARG  */
+#line 2187 "util/configparser.y"
+        {
 		OUTYY(("P(for-downstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4804,12 +4882,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4808 "util/configparser.c" /* yacc.c:1646  */
+#line 4886 "util/configparser.c"
     break;
 
-  case 394:
-#line 2095 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 412: /* auth_for_upstream: VAR_FOR_UPSTREAM STRING_ARG  */
+#line 2197 "util/configparser.y"
+        {
 		OUTYY(("P(for-upstream:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4817,12 +4895,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4821 "util/configparser.c" /* yacc.c:1646  */
+#line 4899 "util/configparser.c"
     break;
 
-  case 395:
-#line 2105 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 413: /* auth_fallback_enabled: VAR_FALLBACK_ENABLED STRING_ARG  */
+#line 2207 "util/configparser.y"
+        {
 		OUTYY(("P(fallback-enabled:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4830,12 +4908,12 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4834 "util/configparser.c" /* yacc.c:1646  */
+#line 4912 "util/configparser.c"
     break;
 
-  case 396:
-#line 2115 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 414: /* view_name: VAR_NAME STRING_ARG  */
+#line 2217 "util/configparser.y"
+        {
 		OUTYY(("P(name:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->views->name)
 			yyerror("view name override, there must be one "
@@ -4843,12 +4921,12 @@ yyreduce:
 		free(cfg_parser->cfg->views->name);
 		cfg_parser->cfg->views->name = (yyvsp[0].str);
 	}
-#line 4847 "util/configparser.c" /* yacc.c:1646  */
+#line 4925 "util/configparser.c"
     break;
 
-  case 397:
-#line 2125 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 415: /* view_local_zone: VAR_LOCAL_ZONE STRING_ARG STRING_ARG  */
+#line 2227 "util/configparser.y"
+        {
 		OUTYY(("P(view_local_zone:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "static")!=0 && strcmp((yyvsp[0].str), "deny")!=0 &&
 		   strcmp((yyvsp[0].str), "refuse")!=0 && strcmp((yyvsp[0].str), "redirect")!=0 &&
@@ -4876,12 +4954,12 @@ yyreduce:
 				fatal_exit("out of memory adding local-zone");
 		}
 	}
-#line 4880 "util/configparser.c" /* yacc.c:1646  */
+#line 4958 "util/configparser.c"
     break;
 
-  case 398:
-#line 2155 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 416: /* view_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2257 "util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(
@@ -4889,35 +4967,35 @@ yyreduce:
 			fatal_exit("out of memory adding per-view "
 				"response-ip action");
 	}
-#line 4893 "util/configparser.c" /* yacc.c:1646  */
+#line 4971 "util/configparser.c"
     break;
 
-  case 399:
-#line 2165 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 417: /* view_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2267 "util/configparser.y"
+        {
 		OUTYY(("P(view_response_ip_data:%s)\n", (yyvsp[-1].str)));
 		if(!cfg_str2list_insert(
 			&cfg_parser->cfg->views->respip_data, (yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip-data");
 	}
-#line 4904 "util/configparser.c" /* yacc.c:1646  */
+#line 4982 "util/configparser.c"
     break;
 
-  case 400:
-#line 2173 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 418: /* view_local_data: VAR_LOCAL_DATA STRING_ARG  */
+#line 2275 "util/configparser.y"
+        {
 		OUTYY(("P(view_local_data:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->views->local_data, (yyvsp[0].str))) {
 			fatal_exit("out of memory adding local-data");
 			free((yyvsp[0].str));
 		}
 	}
-#line 4916 "util/configparser.c" /* yacc.c:1646  */
+#line 4994 "util/configparser.c"
     break;
 
-  case 401:
-#line 2182 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 419: /* view_local_data_ptr: VAR_LOCAL_DATA_PTR STRING_ARG  */
+#line 2284 "util/configparser.y"
+        {
 		char* ptr;
 		OUTYY(("P(view_local_data_ptr:%s)\n", (yyvsp[0].str)));
 		ptr = cfg_ptr_reverse((yyvsp[0].str));
@@ -4930,32 +5008,32 @@ yyreduce:
 			yyerror("local-data-ptr could not be reversed");
 		}
 	}
-#line 4934 "util/configparser.c" /* yacc.c:1646  */
+#line 5012 "util/configparser.c"
     break;
 
-  case 402:
-#line 2197 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 420: /* view_first: VAR_VIEW_FIRST STRING_ARG  */
+#line 2299 "util/configparser.y"
+        {
 		OUTYY(("P(view-first:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->views->isfirst=(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4946 "util/configparser.c" /* yacc.c:1646  */
+#line 5024 "util/configparser.c"
     break;
 
-  case 403:
-#line 2206 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 421: /* rcstart: VAR_REMOTE_CONTROL  */
+#line 2308 "util/configparser.y"
+        { 
 		OUTYY(("\nP(remote-control:)\n")); 
 	}
-#line 4954 "util/configparser.c" /* yacc.c:1646  */
+#line 5032 "util/configparser.c"
     break;
 
-  case 414:
-#line 2217 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 432: /* rc_control_enable: VAR_CONTROL_ENABLE STRING_ARG  */
+#line 2319 "util/configparser.y"
+        {
 		OUTYY(("P(control_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4963,34 +5041,34 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 4967 "util/configparser.c" /* yacc.c:1646  */
+#line 5045 "util/configparser.c"
     break;
 
-  case 415:
-#line 2227 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 433: /* rc_control_port: VAR_CONTROL_PORT STRING_ARG  */
+#line 2329 "util/configparser.y"
+        {
 		OUTYY(("P(control_port:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
 			yyerror("control port number expected");
 		else cfg_parser->cfg->control_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 4979 "util/configparser.c" /* yacc.c:1646  */
+#line 5057 "util/configparser.c"
     break;
 
-  case 416:
-#line 2236 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 434: /* rc_control_interface: VAR_CONTROL_INTERFACE STRING_ARG  */
+#line 2338 "util/configparser.y"
+        {
 		OUTYY(("P(control_interface:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->control_ifs, (yyvsp[0].str)))
 			yyerror("out of memory");
 	}
-#line 4989 "util/configparser.c" /* yacc.c:1646  */
+#line 5067 "util/configparser.c"
     break;
 
-  case 417:
-#line 2243 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 435: /* rc_control_use_cert: VAR_CONTROL_USE_CERT STRING_ARG  */
+#line 2345 "util/configparser.y"
+        {
 		OUTYY(("P(control_use_cert:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -4998,213 +5076,353 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5002 "util/configparser.c" /* yacc.c:1646  */
+#line 5080 "util/configparser.c"
     break;
 
-  case 418:
-#line 2253 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 436: /* rc_server_key_file: VAR_SERVER_KEY_FILE STRING_ARG  */
+#line 2355 "util/configparser.y"
+        {
 		OUTYY(("P(rc_server_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_key_file);
 		cfg_parser->cfg->server_key_file = (yyvsp[0].str);
 	}
-#line 5012 "util/configparser.c" /* yacc.c:1646  */
+#line 5090 "util/configparser.c"
     break;
 
-  case 419:
-#line 2260 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 437: /* rc_server_cert_file: VAR_SERVER_CERT_FILE STRING_ARG  */
+#line 2362 "util/configparser.y"
+        {
 		OUTYY(("P(rc_server_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->server_cert_file);
 		cfg_parser->cfg->server_cert_file = (yyvsp[0].str);
 	}
-#line 5022 "util/configparser.c" /* yacc.c:1646  */
+#line 5100 "util/configparser.c"
     break;
 
-  case 420:
-#line 2267 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 438: /* rc_control_key_file: VAR_CONTROL_KEY_FILE STRING_ARG  */
+#line 2369 "util/configparser.y"
+        {
 		OUTYY(("P(rc_control_key_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_key_file);
 		cfg_parser->cfg->control_key_file = (yyvsp[0].str);
 	}
-#line 5032 "util/configparser.c" /* yacc.c:1646  */
+#line 5110 "util/configparser.c"
     break;
 
-  case 421:
-#line 2274 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 439: /* rc_control_cert_file: VAR_CONTROL_CERT_FILE STRING_ARG  */
+#line 2376 "util/configparser.y"
+        {
 		OUTYY(("P(rc_control_cert_file:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->control_cert_file);
 		cfg_parser->cfg->control_cert_file = (yyvsp[0].str);
 	}
-#line 5042 "util/configparser.c" /* yacc.c:1646  */
+#line 5120 "util/configparser.c"
     break;
 
-  case 422:
-#line 2281 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 440: /* dtstart: VAR_DNSTAP  */
+#line 2383 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnstap:)\n"));
 	}
-#line 5050 "util/configparser.c" /* yacc.c:1646  */
+#line 5128 "util/configparser.c"
     break;
 
-  case 437:
-#line 2298 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 467: /* dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG  */
+#line 2409 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5061 "util/configparser.c" /* yacc.c:1646  */
+#line 5139 "util/configparser.c"
     break;
 
-  case 438:
-#line 2306 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 468: /* dt_dnstap_socket_path: VAR_DNSTAP_SOCKET_PATH STRING_ARG  */
+#line 2417 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_socket_path:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_socket_path);
 		cfg_parser->cfg->dnstap_socket_path = (yyvsp[0].str);
 	}
-#line 5071 "util/configparser.c" /* yacc.c:1646  */
+#line 5149 "util/configparser.c"
     break;
 
-  case 439:
-#line 2313 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 469: /* dt_dnstap_send_identity: VAR_DNSTAP_SEND_IDENTITY STRING_ARG  */
+#line 2424 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_identity:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_identity = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5082 "util/configparser.c" /* yacc.c:1646  */
+#line 5160 "util/configparser.c"
     break;
 
-  case 440:
-#line 2321 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 470: /* dt_dnstap_send_version: VAR_DNSTAP_SEND_VERSION STRING_ARG  */
+#line 2432 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_send_version:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_send_version = (strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5093 "util/configparser.c" /* yacc.c:1646  */
+#line 5171 "util/configparser.c"
     break;
 
-  case 441:
-#line 2329 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 471: /* dt_dnstap_identity: VAR_DNSTAP_IDENTITY STRING_ARG  */
+#line 2440 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_identity);
 		cfg_parser->cfg->dnstap_identity = (yyvsp[0].str);
 	}
-#line 5103 "util/configparser.c" /* yacc.c:1646  */
+#line 5181 "util/configparser.c"
     break;
 
-  case 442:
-#line 2336 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 472: /* dt_dnstap_version: VAR_DNSTAP_VERSION STRING_ARG  */
+#line 2447 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_version:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnstap_version);
 		cfg_parser->cfg->dnstap_version = (yyvsp[0].str);
 	}
-#line 5113 "util/configparser.c" /* yacc.c:1646  */
+#line 5191 "util/configparser.c"
     break;
 
-  case 443:
-#line 2343 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 473: /* dt_dnstap_log_resolver_query_messages: VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 2454 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5125 "util/configparser.c" /* yacc.c:1646  */
+#line 5203 "util/configparser.c"
     break;
 
-  case 444:
-#line 2352 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 474: /* dt_dnstap_log_resolver_response_messages: VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2463 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_resolver_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_resolver_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5137 "util/configparser.c" /* yacc.c:1646  */
+#line 5215 "util/configparser.c"
     break;
 
-  case 445:
-#line 2361 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 475: /* dt_dnstap_log_client_query_messages: VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 2472 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5149 "util/configparser.c" /* yacc.c:1646  */
+#line 5227 "util/configparser.c"
     break;
 
-  case 446:
-#line 2370 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 476: /* dt_dnstap_log_client_response_messages: VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 2481 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_client_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_client_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5161 "util/configparser.c" /* yacc.c:1646  */
+#line 5239 "util/configparser.c"
     break;
 
-  case 447:
-#line 2379 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 477: /* dt_dnstap_log_forwarder_query_messages: VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 2490 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_query_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5173 "util/configparser.c" /* yacc.c:1646  */
+#line 5251 "util/configparser.c"
     break;
 
-  case 448:
-#line 2388 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 478: /* dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2499 "util/configparser.y"
+        {
 		OUTYY(("P(dt_dnstap_log_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnstap_log_forwarder_response_messages =
 			(strcmp((yyvsp[0].str), "yes")==0);
 	}
-#line 5185 "util/configparser.c" /* yacc.c:1646  */
+#line 5263 "util/configparser.c"
     break;
 
-  case 449:
-#line 2397 "./util/configparser.y" /* yacc.c:1646  */
-    { 
+  case 479: /* dt_dnstap_ip: VAR_DNSTAP_IP STRING_ARG  */
+#line 2508 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_ip:%s)\n", (yyvsp[0].str)));
+	#if defined(USE_DNSTAP) && !defined(HAVE_FSTRM_TCP_WRITER_OPTIONS_INIT)
+		if((yyvsp[0].str)[0] != 0)
+			yyerror("dnstap-ip needs fstrm 0.4 or later, it was "
+				"not found when unbound was compiled");
+	#endif
+		free(cfg_parser->cfg->dnstap_ip);
+		cfg_parser->cfg->dnstap_ip = (yyvsp[0].str);
+	}
+#line 5278 "util/configparser.c"
+    break;
+
+  case 480: /* dt_dnstap_file: VAR_DNSTAP_FILE STRING_ARG  */
+#line 2520 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_file:%s)\n", (yyvsp[0].str)));
+		free(cfg_parser->cfg->dnstap_file);
+		cfg_parser->cfg->dnstap_file = (yyvsp[0].str);
+	}
+#line 5288 "util/configparser.c"
+    break;
+
+  case 481: /* dt_dnstap_file_rotate_size: VAR_DNSTAP_FILE_ROTATE_SIZE STRING_ARG  */
+#line 2527 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_file_rotate_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_file_rotate_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 5300 "util/configparser.c"
+    break;
+
+  case 482: /* dt_dnstap_file_rotate_interval: VAR_DNSTAP_FILE_ROTATE_INTERVAL STRING_ARG  */
+#line 2536 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_file_rotate_interval:%s)\n", (yyvsp[0].str)));
+		if(atoi((yyvsp[0].str)) == 0 && strcmp((yyvsp[0].str), "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->dnstap_file_rotate_interval = atoi((yyvsp[0].str));
+		free((yyvsp[0].str));
+	}
+#line 5312 "util/configparser.c"
+    break;
+
+  case 483: /* dt_dnstap_ring_size: VAR_DNSTAP_RING_SIZE STRING_ARG  */
+#line 2545 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_ring_size:%s)\n", (yyvsp[0].str)));
+		if(!cfg_parse_memsize((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_ring_size))
+			yyerror("memory size expected");
+		free((yyvsp[0].str));
+	}
+#line 5324 "util/configparser.c"
+    break;
+
+  case 484: /* dt_dnstap_sample_resolver_query_messages: VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES STRING_ARG  */
+#line 2554 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_resolver_query_messages:%s)\n", (yyvsp[0].str)));
+		parse_dnstap_sample((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_sample_resolver_query_messages);
+		free((yyvsp[0].str));
+	}
+#line 5335 "util/configparser.c"
+    break;
+
+  case 485: /* dt_dnstap_sample_resolver_response_messages: VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2562 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_resolver_response_messages:%s)\n", (yyvsp[0].str)));
+		parse_dnstap_sample((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_sample_resolver_response_messages);
+		free((yyvsp[0].str));
+	}
+#line 5346 "util/configparser.c"
+    break;
+
+  case 486: /* dt_dnstap_sample_client_query_messages: VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES STRING_ARG  */
+#line 2570 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_client_query_messages:%s)\n", (yyvsp[0].str)));
+		parse_dnstap_sample((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_sample_client_query_messages);
+		free((yyvsp[0].str));
+	}
+#line 5357 "util/configparser.c"
+    break;
+
+  case 487: /* dt_dnstap_sample_client_response_messages: VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES STRING_ARG  */
+#line 2578 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_client_response_messages:%s)\n", (yyvsp[0].str)));
+		parse_dnstap_sample((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_sample_client_response_messages);
+		free((yyvsp[0].str));
+	}
+#line 5368 "util/configparser.c"
+    break;
+
+  case 488: /* dt_dnstap_sample_forwarder_query_messages: VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES STRING_ARG  */
+#line 2586 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_forwarder_query_messages:%s)\n", (yyvsp[0].str)));
+		parse_dnstap_sample((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_sample_forwarder_query_messages);
+		free((yyvsp[0].str));
+	}
+#line 5379 "util/configparser.c"
+    break;
+
+  case 489: /* dt_dnstap_sample_forwarder_response_messages: VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES STRING_ARG  */
+#line 2594 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_forwarder_response_messages:%s)\n", (yyvsp[0].str)));
+		parse_dnstap_sample((yyvsp[0].str),
+			&cfg_parser->cfg->dnstap_sample_forwarder_response_messages);
+		free((yyvsp[0].str));
+	}
+#line 5390 "util/configparser.c"
+    break;
+
+  case 490: /* dt_dnstap_sample_keep_servfail: VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL STRING_ARG  */
+#line 2602 "util/configparser.y"
+        {
+		OUTYY(("P(dt_dnstap_sample_keep_servfail:%s)\n", (yyvsp[0].str)));
+		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->dnstap_sample_keep_servfail =
+			(strcmp((yyvsp[0].str), "yes")==0);
+		free((yyvsp[0].str));
+	}
+#line 5403 "util/configparser.c"
+    break;
+
+  case 491: /* pythonstart: VAR_PYTHON  */
+#line 2612 "util/configparser.y"
+        { 
 		OUTYY(("\nP(python:)\n")); 
 	}
-#line 5193 "util/configparser.c" /* yacc.c:1646  */
+#line 5411 "util/configparser.c"
     break;
 
-  case 453:
-#line 2406 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 495: /* py_script: VAR_PYTHON_SCRIPT STRING_ARG  */
+#line 2621 "util/configparser.y"
+        {
 		OUTYY(("P(python-script:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->python_script);
 		cfg_parser->cfg->python_script = (yyvsp[0].str);
 	}
-#line 5203 "util/configparser.c" /* yacc.c:1646  */
+#line 5421 "util/configparser.c"
     break;
 
-  case 454:
-#line 2412 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 496: /* server_disable_dnssec_lame_check: VAR_DISABLE_DNSSEC_LAME_CHECK STRING_ARG  */
+#line 2627 "util/configparser.y"
+        {
 		OUTYY(("P(disable_dnssec_lame_check:%s)\n", (yyvsp[0].str)));
 		if (strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
@@ -5212,66 +5430,66 @@ yyreduce:
 			(strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5216 "util/configparser.c" /* yacc.c:1646  */
+#line 5434 "util/configparser.c"
     break;
 
-  case 455:
-#line 2422 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 497: /* server_log_identity: VAR_LOG_IDENTITY STRING_ARG  */
+#line 2637 "util/configparser.y"
+        {
 		OUTYY(("P(server_log_identity:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->log_identity);
 		cfg_parser->cfg->log_identity = (yyvsp[0].str);
 	}
-#line 5226 "util/configparser.c" /* yacc.c:1646  */
+#line 5444 "util/configparser.c"
     break;
 
-  case 456:
-#line 2429 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 498: /* server_response_ip: VAR_RESPONSE_IP STRING_ARG STRING_ARG  */
+#line 2644 "util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip:%s %s)\n", (yyvsp[-1].str), (yyvsp[0].str)));
 		validate_respip_action((yyvsp[0].str));
 		if(!cfg_str2list_insert(&cfg_parser->cfg->respip_actions,
 			(yyvsp[-1].str), (yyvsp[0].str)))
 			fatal_exit("out of memory adding response-ip");
 	}
-#line 5238 "util/configparser.c" /* yacc.c:1646  */
+#line 5456 "util/configparser.c"
     break;
 
-  case 457:
-#line 2438 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 499: /* server_response_ip_data: VAR_RESPONSE_IP_DATA STRING_ARG STRING_ARG  */
+#line 2653 "util/configparser.y"
+        {
 		OUTYY(("P(server_response_ip_data:%s)\n", (yyvsp[-1].str)));
 			if(!cfg_str2list_insert(&cfg_parser->cfg->respip_data,
 				(yyvsp[-1].str), (yyvsp[0].str)))
 				fatal_exit("out of memory adding response-ip-data");
 	}
-#line 5249 "util/configparser.c" /* yacc.c:1646  */
+#line 5467 "util/configparser.c"
     break;
 
-  case 458:
-#line 2446 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 500: /* dnscstart: VAR_DNSCRYPT  */
+#line 2661 "util/configparser.y"
+        {
 		OUTYY(("\nP(dnscrypt:)\n"));
 		OUTYY(("\nP(dnscrypt:)\n"));
 	}
-#line 5258 "util/configparser.c" /* yacc.c:1646  */
+#line 5476 "util/configparser.c"
     break;
 
-  case 471:
-#line 2463 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 513: /* dnsc_dnscrypt_enable: VAR_DNSCRYPT_ENABLE STRING_ARG  */
+#line 2678 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_enable:%s)\n", (yyvsp[0].str)));
 		if(strcmp((yyvsp[0].str), "yes") != 0 && strcmp((yyvsp[0].str), "no") != 0)
 			yyerror("expected yes or no.");
 		else cfg_parser->cfg->dnscrypt = (strcmp((yyvsp[0].str), "yes")==0);
 		free((yyvsp[0].str));
 	}
-#line 5270 "util/configparser.c" /* yacc.c:1646  */
+#line 5488 "util/configparser.c"
     break;
 
-  case 472:
-#line 2473 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 514: /* dnsc_dnscrypt_port: VAR_DNSCRYPT_PORT STRING_ARG  */
+#line 2688 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_port:%s)\n", (yyvsp[0].str)));
 
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5279,67 +5497,67 @@ yyreduce:
 		else cfg_parser->cfg->dnscrypt_port = atoi((yyvsp[0].str));
 		free((yyvsp[0].str));
 	}
-#line 5283 "util/configparser.c" /* yacc.c:1646  */
+#line 5501 "util/configparser.c"
     break;
 
-  case 473:
-#line 2483 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 515: /* dnsc_dnscrypt_provider: VAR_DNSCRYPT_PROVIDER STRING_ARG  */
+#line 2698 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->dnscrypt_provider);
 		cfg_parser->cfg->dnscrypt_provider = (yyvsp[0].str);
 	}
-#line 5293 "util/configparser.c" /* yacc.c:1646  */
+#line 5511 "util/configparser.c"
     break;
 
-  case 474:
-#line 2490 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 516: /* dnsc_dnscrypt_provider_cert: VAR_DNSCRYPT_PROVIDER_CERT STRING_ARG  */
+#line 2705 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			log_warn("dnscrypt-provider-cert %s is a duplicate", (yyvsp[0].str));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert");
 	}
-#line 5305 "util/configparser.c" /* yacc.c:1646  */
+#line 5523 "util/configparser.c"
     break;
 
-  case 475:
-#line 2499 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 517: /* dnsc_dnscrypt_provider_cert_rotated: VAR_DNSCRYPT_PROVIDER_CERT_ROTATED STRING_ARG  */
+#line 2714 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_provider_cert_rotated:%s)\n", (yyvsp[0].str)));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_provider_cert_rotated, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-provider-cert-rotated");
 	}
-#line 5315 "util/configparser.c" /* yacc.c:1646  */
+#line 5533 "util/configparser.c"
     break;
 
-  case 476:
-#line 2506 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 518: /* dnsc_dnscrypt_secret_key: VAR_DNSCRYPT_SECRET_KEY STRING_ARG  */
+#line 2721 "util/configparser.y"
+        {
 		OUTYY(("P(dnsc_dnscrypt_secret_key:%s)\n", (yyvsp[0].str)));
 		if(cfg_strlist_find(cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			log_warn("dnscrypt-secret-key: %s is a duplicate", (yyvsp[0].str));
 		if(!cfg_strlist_insert(&cfg_parser->cfg->dnscrypt_secret_key, (yyvsp[0].str)))
 			fatal_exit("out of memory adding dnscrypt-secret-key");
 	}
-#line 5327 "util/configparser.c" /* yacc.c:1646  */
+#line 5545 "util/configparser.c"
     break;
 
-  case 477:
-#line 2515 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 519: /* dnsc_dnscrypt_shared_secret_cache_size: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE STRING_ARG  */
+#line 2730 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_shared_secret_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_shared_secret_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5338 "util/configparser.c" /* yacc.c:1646  */
+#line 5556 "util/configparser.c"
     break;
 
-  case 478:
-#line 2523 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 520: /* dnsc_dnscrypt_shared_secret_cache_slabs: VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS STRING_ARG  */
+#line 2738 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_shared_secret_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -5350,23 +5568,23 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5354 "util/configparser.c" /* yacc.c:1646  */
+#line 5572 "util/configparser.c"
     break;
 
-  case 479:
-#line 2536 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 521: /* dnsc_dnscrypt_nonce_cache_size: VAR_DNSCRYPT_NONCE_CACHE_SIZE STRING_ARG  */
+#line 2751 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_nonce_cache_size:%s)\n", (yyvsp[0].str)));
   	if(!cfg_parse_memsize((yyvsp[0].str), &cfg_parser->cfg->dnscrypt_nonce_cache_size))
   		yyerror("memory size expected");
   	free((yyvsp[0].str));
   }
-#line 5365 "util/configparser.c" /* yacc.c:1646  */
+#line 5583 "util/configparser.c"
     break;
 
-  case 480:
-#line 2544 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 522: /* dnsc_dnscrypt_nonce_cache_slabs: VAR_DNSCRYPT_NONCE_CACHE_SLABS STRING_ARG  */
+#line 2759 "util/configparser.y"
+  {
   	OUTYY(("P(dnscrypt_nonce_cache_slabs:%s)\n", (yyvsp[0].str)));
   	if(atoi((yyvsp[0].str)) == 0)
   		yyerror("number expected");
@@ -5377,20 +5595,20 @@ yyreduce:
   	}
   	free((yyvsp[0].str));
   }
-#line 5381 "util/configparser.c" /* yacc.c:1646  */
+#line 5599 "util/configparser.c"
     break;
 
-  case 481:
-#line 2557 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 523: /* cachedbstart: VAR_CACHEDB  */
+#line 2772 "util/configparser.y"
+        {
 		OUTYY(("\nP(cachedb:)\n"));
 	}
-#line 5389 "util/configparser.c" /* yacc.c:1646  */
+#line 5607 "util/configparser.c"
     break;
 
-  case 489:
-#line 2567 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 531: /* cachedb_backend_name: VAR_CACHEDB_BACKEND STRING_ARG  */
+#line 2782 "util/configparser.y"
+        {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(backend:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->cachedb_backend)
@@ -5402,12 +5620,12 @@ yyreduce:
 		OUTYY(("P(Compiled without cachedb, ignoring)\n"));
 	#endif
 	}
-#line 5406 "util/configparser.c" /* yacc.c:1646  */
+#line 5624 "util/configparser.c"
     break;
 
-  case 490:
-#line 2581 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 532: /* cachedb_secret_seed: VAR_CACHEDB_SECRETSEED STRING_ARG  */
+#line 2796 "util/configparser.y"
+        {
 	#ifdef USE_CACHEDB
 		OUTYY(("P(secret-seed:%s)\n", (yyvsp[0].str)));
 		if(cfg_parser->cfg->cachedb_secret)
@@ -5420,12 +5638,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5424 "util/configparser.c" /* yacc.c:1646  */
+#line 5642 "util/configparser.c"
     break;
 
-  case 491:
-#line 2596 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 533: /* redis_server_host: VAR_CACHEDB_REDISHOST STRING_ARG  */
+#line 2811 "util/configparser.y"
+        {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_server_host:%s)\n", (yyvsp[0].str)));
 		free(cfg_parser->cfg->redis_server_host);
@@ -5435,12 +5653,12 @@ yyreduce:
 		free((yyvsp[0].str));
 	#endif
 	}
-#line 5439 "util/configparser.c" /* yacc.c:1646  */
+#line 5657 "util/configparser.c"
     break;
 
-  case 492:
-#line 2608 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 534: /* redis_server_port: VAR_CACHEDB_REDISPORT STRING_ARG  */
+#line 2823 "util/configparser.y"
+        {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		int port;
 		OUTYY(("P(redis_server_port:%s)\n", (yyvsp[0].str)));
@@ -5453,12 +5671,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 5457 "util/configparser.c" /* yacc.c:1646  */
+#line 5675 "util/configparser.c"
     break;
 
-  case 493:
-#line 2623 "./util/configparser.y" /* yacc.c:1646  */
-    {
+  case 535: /* redis_timeout: VAR_CACHEDB_REDISTIMEOUT STRING_ARG  */
+#line 2838 "util/configparser.y"
+        {
 	#if defined(USE_CACHEDB) && defined(USE_REDIS)
 		OUTYY(("P(redis_timeout:%s)\n", (yyvsp[0].str)));
 		if(atoi((yyvsp[0].str)) == 0)
@@ -5469,11 +5687,12 @@ yyreduce:
 	#endif
 		free((yyvsp[0].str));
 	}
-#line 5473 "util/configparser.c" /* yacc.c:1646  */
+#line 5691 "util/configparser.c"
     break;
 
 
-#line 5477 "util/configparser.c" /* yacc.c:1646  */
+#line 5695 "util/configparser.c"
+
       default: break;
     }
   /* User semantic actions sometimes alter yychar, and that requires
@@ -5487,25 +5706,23 @@ yyreduce:
      case of YYERROR or YYBACKUP, subsequent parser actions might lead
      to an incorrect destructor call or verbose syntax error message
      before the lookahead is translated.  */
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
   /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
@@ -5516,50 +5733,14 @@ yyreduce:
 yyerrlab:
   /* Make sure we have latest lookahead translation.  See comments at
      user semantic actions for why this is necessary.  */
-  yytoken = yychar == YYEMPTY ? YYEMPTY : YYTRANSLATE (yychar);
-
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (YY_("syntax error"));
-#else
-# define YYSYNTAX_ERROR yysyntax_error (&yymsg_alloc, &yymsg, \
-                                        yyssp, yytoken)
-      {
-        char const *yymsgp = YY_("syntax error");
-        int yysyntax_error_status;
-        yysyntax_error_status = YYSYNTAX_ERROR;
-        if (yysyntax_error_status == 0)
-          yymsgp = yymsg;
-        else if (yysyntax_error_status == 1)
-          {
-            if (yymsg != yymsgbuf)
-              YYSTACK_FREE (yymsg);
-            yymsg = (char *) YYSTACK_ALLOC (yymsg_alloc);
-            if (!yymsg)
-              {
-                yymsg = yymsgbuf;
-                yymsg_alloc = sizeof yymsgbuf;
-                yysyntax_error_status = 2;
-              }
-            else
-              {
-                yysyntax_error_status = YYSYNTAX_ERROR;
-                yymsgp = yymsg;
-              }
-          }
-        yyerror (yymsgp);
-        if (yysyntax_error_status == 2)
-          goto yyexhaustedlab;
-      }
-# undef YYSYNTAX_ERROR
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
       /* If just tried and failed to reuse lookahead token after an
@@ -5588,12 +5769,11 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
-
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
   /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
@@ -5610,13 +5790,14 @@ yyerrorlab:
 yyerrlab1:
   yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
       if (!yypact_value_is_default (yyn))
         {
-          yyn += YYTERROR;
-          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
             {
               yyn = yytable[yyn];
               if (0 < yyn)
@@ -5630,7 +5811,7 @@ yyerrlab1:
 
 
       yydestruct ("Error: popping",
-                  yystos[yystate], yyvsp);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
@@ -5642,7 +5823,7 @@ yyerrlab1:
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -5653,26 +5834,30 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#if !defined yyoverflow || YYERROR_VERBOSE
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
 
-yyreturn:
+
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
   if (yychar != YYEMPTY)
     {
       /* Make sure we have latest lookahead translation.  See comments at
@@ -5688,20 +5873,18 @@ yyreturn:
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-                  yystos[*yyssp], yyvsp);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
+
   return yyresult;
 }
-#line 2635 "./util/configparser.y" /* yacc.c:1906  */
+
+#line 2850 "util/configparser.y"
 
 
 /* parse helper routines could be here */
@@ -5721,3 +5904,13 @@ validate_respip_action(const char* action)
 			"always_refuse or always_nxdomain");
 	}
 }
+
+/** parse a dnstap-sample percentage into rate */
+static void
+parse_dnstap_sample(const char* str, int* rate)
+{
+	if((atoi(str) == 0 && strcmp(str, "0") != 0) || atoi(str) < 0 ||
+		atoi(str) > 100)
+		yyerror("percentage from 0 to 100 expected");
+	else *rate = atoi(str);
+}
@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.4.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
 # define YY_YY_UTIL_CONFIGPARSER_H_INCLUDED
 /* Debug traces.  */
@@ -40,249 +45,279 @@
 extern int yydebug;
 #endif
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    SPACE = 258,
-    LETTER = 259,
-    NEWLINE = 260,
-    COMMENT = 261,
-    COLON = 262,
-    ANY = 263,
-    ZONESTR = 264,
-    STRING_ARG = 265,
-    VAR_SERVER = 266,
-    VAR_VERBOSITY = 267,
-    VAR_NUM_THREADS = 268,
-    VAR_PORT = 269,
-    VAR_OUTGOING_RANGE = 270,
-    VAR_INTERFACE = 271,
-    VAR_DO_IP4 = 272,
-    VAR_DO_IP6 = 273,
-    VAR_PREFER_IP6 = 274,
-    VAR_DO_UDP = 275,
-    VAR_DO_TCP = 276,
-    VAR_TCP_MSS = 277,
-    VAR_OUTGOING_TCP_MSS = 278,
-    VAR_CHROOT = 279,
-    VAR_USERNAME = 280,
-    VAR_DIRECTORY = 281,
-    VAR_LOGFILE = 282,
-    VAR_PIDFILE = 283,
-    VAR_MSG_CACHE_SIZE = 284,
-    VAR_MSG_CACHE_SLABS = 285,
-    VAR_NUM_QUERIES_PER_THREAD = 286,
-    VAR_RRSET_CACHE_SIZE = 287,
-    VAR_RRSET_CACHE_SLABS = 288,
-    VAR_OUTGOING_NUM_TCP = 289,
-    VAR_INFRA_HOST_TTL = 290,
-    VAR_INFRA_LAME_TTL = 291,
-    VAR_INFRA_CACHE_SLABS = 292,
-    VAR_INFRA_CACHE_NUMHOSTS = 293,
-    VAR_INFRA_CACHE_LAME_SIZE = 294,
-    VAR_NAME = 295,
-    VAR_STUB_ZONE = 296,
-    VAR_STUB_HOST = 297,
-    VAR_STUB_ADDR = 298,
-    VAR_TARGET_FETCH_POLICY = 299,
-    VAR_HARDEN_SHORT_BUFSIZE = 300,
-    VAR_HARDEN_LARGE_QUERIES = 301,
-    VAR_FORWARD_ZONE = 302,
-    VAR_FORWARD_HOST = 303,
-    VAR_FORWARD_ADDR = 304,
-    VAR_DO_NOT_QUERY_ADDRESS = 305,
-    VAR_HIDE_IDENTITY = 306,
-    VAR_HIDE_VERSION = 307,
-    VAR_IDENTITY = 308,
-    VAR_VERSION = 309,
-    VAR_HARDEN_GLUE = 310,
-    VAR_MODULE_CONF = 311,
-    VAR_TRUST_ANCHOR_FILE = 312,
-    VAR_TRUST_ANCHOR = 313,
-    VAR_VAL_OVERRIDE_DATE = 314,
-    VAR_BOGUS_TTL = 315,
-    VAR_VAL_CLEAN_ADDITIONAL = 316,
-    VAR_VAL_PERMISSIVE_MODE = 317,
-    VAR_INCOMING_NUM_TCP = 318,
-    VAR_MSG_BUFFER_SIZE = 319,
-    VAR_KEY_CACHE_SIZE = 320,
-    VAR_KEY_CACHE_SLABS = 321,
-    VAR_TRUSTED_KEYS_FILE = 322,
-    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 323,
-    VAR_USE_SYSLOG = 324,
-    VAR_OUTGOING_INTERFACE = 325,
-    VAR_ROOT_HINTS = 326,
-    VAR_DO_NOT_QUERY_LOCALHOST = 327,
-    VAR_CACHE_MAX_TTL = 328,
-    VAR_HARDEN_DNSSEC_STRIPPED = 329,
-    VAR_ACCESS_CONTROL = 330,
-    VAR_LOCAL_ZONE = 331,
-    VAR_LOCAL_DATA = 332,
-    VAR_INTERFACE_AUTOMATIC = 333,
-    VAR_STATISTICS_INTERVAL = 334,
-    VAR_DO_DAEMONIZE = 335,
-    VAR_USE_CAPS_FOR_ID = 336,
-    VAR_STATISTICS_CUMULATIVE = 337,
-    VAR_OUTGOING_PORT_PERMIT = 338,
-    VAR_OUTGOING_PORT_AVOID = 339,
-    VAR_DLV_ANCHOR_FILE = 340,
-    VAR_DLV_ANCHOR = 341,
-    VAR_NEG_CACHE_SIZE = 342,
-    VAR_HARDEN_REFERRAL_PATH = 343,
-    VAR_PRIVATE_ADDRESS = 344,
-    VAR_PRIVATE_DOMAIN = 345,
-    VAR_REMOTE_CONTROL = 346,
-    VAR_CONTROL_ENABLE = 347,
-    VAR_CONTROL_INTERFACE = 348,
-    VAR_CONTROL_PORT = 349,
-    VAR_SERVER_KEY_FILE = 350,
-    VAR_SERVER_CERT_FILE = 351,
-    VAR_CONTROL_KEY_FILE = 352,
-    VAR_CONTROL_CERT_FILE = 353,
-    VAR_CONTROL_USE_CERT = 354,
-    VAR_EXTENDED_STATISTICS = 355,
-    VAR_LOCAL_DATA_PTR = 356,
-    VAR_JOSTLE_TIMEOUT = 357,
-    VAR_STUB_PRIME = 358,
-    VAR_UNWANTED_REPLY_THRESHOLD = 359,
-    VAR_LOG_TIME_ASCII = 360,
-    VAR_DOMAIN_INSECURE = 361,
-    VAR_PYTHON = 362,
-    VAR_PYTHON_SCRIPT = 363,
-    VAR_VAL_SIG_SKEW_MIN = 364,
-    VAR_VAL_SIG_SKEW_MAX = 365,
-    VAR_CACHE_MIN_TTL = 366,
-    VAR_VAL_LOG_LEVEL = 367,
-    VAR_AUTO_TRUST_ANCHOR_FILE = 368,
-    VAR_KEEP_MISSING = 369,
-    VAR_ADD_HOLDDOWN = 370,
-    VAR_DEL_HOLDDOWN = 371,
-    VAR_SO_RCVBUF = 372,
-    VAR_EDNS_BUFFER_SIZE = 373,
-    VAR_PREFETCH = 374,
-    VAR_PREFETCH_KEY = 375,
-    VAR_SO_SNDBUF = 376,
-    VAR_SO_REUSEPORT = 377,
-    VAR_HARDEN_BELOW_NXDOMAIN = 378,
-    VAR_IGNORE_CD_FLAG = 379,
-    VAR_LOG_QUERIES = 380,
-    VAR_LOG_REPLIES = 381,
-    VAR_TCP_UPSTREAM = 382,
-    VAR_SSL_UPSTREAM = 383,
-    VAR_SSL_SERVICE_KEY = 384,
-    VAR_SSL_SERVICE_PEM = 385,
-    VAR_SSL_PORT = 386,
-    VAR_FORWARD_FIRST = 387,
-    VAR_STUB_SSL_UPSTREAM = 388,
-    VAR_FORWARD_SSL_UPSTREAM = 389,
-    VAR_TLS_CERT_BUNDLE = 390,
-    VAR_STUB_FIRST = 391,
-    VAR_MINIMAL_RESPONSES = 392,
-    VAR_RRSET_ROUNDROBIN = 393,
-    VAR_MAX_UDP_SIZE = 394,
-    VAR_DELAY_CLOSE = 395,
-    VAR_UNBLOCK_LAN_ZONES = 396,
-    VAR_INSECURE_LAN_ZONES = 397,
-    VAR_INFRA_CACHE_MIN_RTT = 398,
-    VAR_DNS64_PREFIX = 399,
-    VAR_DNS64_SYNTHALL = 400,
-    VAR_DNSTAP = 401,
-    VAR_DNSTAP_ENABLE = 402,
-    VAR_DNSTAP_SOCKET_PATH = 403,
-    VAR_DNSTAP_SEND_IDENTITY = 404,
-    VAR_DNSTAP_SEND_VERSION = 405,
-    VAR_DNSTAP_IDENTITY = 406,
-    VAR_DNSTAP_VERSION = 407,
-    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 408,
-    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 409,
-    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 410,
-    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 411,
-    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 412,
-    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 413,
-    VAR_RESPONSE_IP_TAG = 414,
-    VAR_RESPONSE_IP = 415,
-    VAR_RESPONSE_IP_DATA = 416,
-    VAR_HARDEN_ALGO_DOWNGRADE = 417,
-    VAR_IP_TRANSPARENT = 418,
-    VAR_DISABLE_DNSSEC_LAME_CHECK = 419,
-    VAR_IP_RATELIMIT = 420,
-    VAR_IP_RATELIMIT_SLABS = 421,
-    VAR_IP_RATELIMIT_SIZE = 422,
-    VAR_RATELIMIT = 423,
-    VAR_RATELIMIT_SLABS = 424,
-    VAR_RATELIMIT_SIZE = 425,
-    VAR_RATELIMIT_FOR_DOMAIN = 426,
-    VAR_RATELIMIT_BELOW_DOMAIN = 427,
-    VAR_IP_RATELIMIT_FACTOR = 428,
-    VAR_RATELIMIT_FACTOR = 429,
-    VAR_SEND_CLIENT_SUBNET = 430,
-    VAR_CLIENT_SUBNET_ZONE = 431,
-    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 432,
-    VAR_CLIENT_SUBNET_OPCODE = 433,
-    VAR_MAX_CLIENT_SUBNET_IPV4 = 434,
-    VAR_MAX_CLIENT_SUBNET_IPV6 = 435,
-    VAR_CAPS_WHITELIST = 436,
-    VAR_CACHE_MAX_NEGATIVE_TTL = 437,
-    VAR_PERMIT_SMALL_HOLDDOWN = 438,
-    VAR_QNAME_MINIMISATION = 439,
-    VAR_QNAME_MINIMISATION_STRICT = 440,
-    VAR_IP_FREEBIND = 441,
-    VAR_DEFINE_TAG = 442,
-    VAR_LOCAL_ZONE_TAG = 443,
-    VAR_ACCESS_CONTROL_TAG = 444,
-    VAR_LOCAL_ZONE_OVERRIDE = 445,
-    VAR_ACCESS_CONTROL_TAG_ACTION = 446,
-    VAR_ACCESS_CONTROL_TAG_DATA = 447,
-    VAR_VIEW = 448,
-    VAR_ACCESS_CONTROL_VIEW = 449,
-    VAR_VIEW_FIRST = 450,
-    VAR_SERVE_EXPIRED = 451,
-    VAR_FAKE_DSA = 452,
-    VAR_FAKE_SHA1 = 453,
-    VAR_LOG_IDENTITY = 454,
-    VAR_HIDE_TRUSTANCHOR = 455,
-    VAR_TRUST_ANCHOR_SIGNALING = 456,
-    VAR_AGGRESSIVE_NSEC = 457,
-    VAR_USE_SYSTEMD = 458,
-    VAR_SHM_ENABLE = 459,
-    VAR_SHM_KEY = 460,
-    VAR_DNSCRYPT = 461,
-    VAR_DNSCRYPT_ENABLE = 462,
-    VAR_DNSCRYPT_PORT = 463,
-    VAR_DNSCRYPT_PROVIDER = 464,
-    VAR_DNSCRYPT_SECRET_KEY = 465,
-    VAR_DNSCRYPT_PROVIDER_CERT = 466,
-    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 467,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 468,
-    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 469,
-    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 470,
-    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 471,
-    VAR_IPSECMOD_ENABLED = 472,
-    VAR_IPSECMOD_HOOK = 473,
-    VAR_IPSECMOD_IGNORE_BOGUS = 474,
-    VAR_IPSECMOD_MAX_TTL = 475,
-    VAR_IPSECMOD_WHITELIST = 476,
-    VAR_IPSECMOD_STRICT = 477,
-    VAR_CACHEDB = 478,
-    VAR_CACHEDB_BACKEND = 479,
-    VAR_CACHEDB_SECRETSEED = 480,
-    VAR_CACHEDB_REDISHOST = 481,
-    VAR_CACHEDB_REDISPORT = 482,
-    VAR_CACHEDB_REDISTIMEOUT = 483,
-    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 484,
-    VAR_FOR_UPSTREAM = 485,
-    VAR_AUTH_ZONE = 486,
-    VAR_ZONEFILE = 487,
-    VAR_MASTER = 488,
-    VAR_URL = 489,
-    VAR_FOR_DOWNSTREAM = 490,
-    VAR_FALLBACK_ENABLED = 491,
-    VAR_ADDITIONAL_TLS_PORT = 492
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    SPACE = 258,                   /* SPACE  */
+    LETTER = 259,                  /* LETTER  */
+    NEWLINE = 260,                 /* NEWLINE  */
+    COMMENT = 261,                 /* COMMENT  */
+    COLON = 262,                   /* COLON  */
+    ANY = 263,                     /* ANY  */
+    ZONESTR = 264,                 /* ZONESTR  */
+    STRING_ARG = 265,              /* STRING_ARG  */
+    VAR_SERVER = 266,              /* VAR_SERVER  */
+    VAR_VERBOSITY = 267,           /* VAR_VERBOSITY  */
+    VAR_NUM_THREADS = 268,         /* VAR_NUM_THREADS  */
+    VAR_PORT = 269,                /* VAR_PORT  */
+    VAR_OUTGOING_RANGE = 270,      /* VAR_OUTGOING_RANGE  */
+    VAR_INTERFACE = 271,           /* VAR_INTERFACE  */
+    VAR_DO_IP4 = 272,              /* VAR_DO_IP4  */
+    VAR_DO_IP6 = 273,              /* VAR_DO_IP6  */
+    VAR_PREFER_IP6 = 274,          /* VAR_PREFER_IP6  */
+    VAR_DO_UDP = 275,              /* VAR_DO_UDP  */
+    VAR_DO_TCP = 276,              /* VAR_DO_TCP  */
+    VAR_TCP_MSS = 277,             /* VAR_TCP_MSS  */
+    VAR_OUTGOING_TCP_MSS = 278,    /* VAR_OUTGOING_TCP_MSS  */
+    VAR_CHROOT = 279,              /* VAR_CHROOT  */
+    VAR_USERNAME = 280,            /* VAR_USERNAME  */
+    VAR_DIRECTORY = 281,           /* VAR_DIRECTORY  */
+    VAR_LOGFILE = 282,             /* VAR_LOGFILE  */
+    VAR_PIDFILE = 283,             /* VAR_PIDFILE  */
+    VAR_MSG_CACHE_SIZE = 284,      /* VAR_MSG_CACHE_SIZE  */
+    VAR_MSG_CACHE_SLABS = 285,     /* VAR_MSG_CACHE_SLABS  */
+    VAR_NUM_QUERIES_PER_THREAD = 286, /* VAR_NUM_QUERIES_PER_THREAD  */
+    VAR_RRSET_CACHE_SIZE = 287,    /* VAR_RRSET_CACHE_SIZE  */
+    VAR_RRSET_CACHE_SLABS = 288,   /* VAR_RRSET_CACHE_SLABS  */
+    VAR_OUTGOING_NUM_TCP = 289,    /* VAR_OUTGOING_NUM_TCP  */
+    VAR_INFRA_HOST_TTL = 290,      /* VAR_INFRA_HOST_TTL  */
+    VAR_INFRA_LAME_TTL = 291,      /* VAR_INFRA_LAME_TTL  */
+    VAR_INFRA_CACHE_SLABS = 292,   /* VAR_INFRA_CACHE_SLABS  */
+    VAR_INFRA_CACHE_NUMHOSTS = 293, /* VAR_INFRA_CACHE_NUMHOSTS  */
+    VAR_INFRA_CACHE_LAME_SIZE = 294, /* VAR_INFRA_CACHE_LAME_SIZE  */
+    VAR_NAME = 295,                /* VAR_NAME  */
+    VAR_STUB_ZONE = 296,           /* VAR_STUB_ZONE  */
+    VAR_STUB_HOST = 297,           /* VAR_STUB_HOST  */
+    VAR_STUB_ADDR = 298,           /* VAR_STUB_ADDR  */
+    VAR_TARGET_FETCH_POLICY = 299, /* VAR_TARGET_FETCH_POLICY  */
+    VAR_HARDEN_SHORT_BUFSIZE = 300, /* VAR_HARDEN_SHORT_BUFSIZE  */
+    VAR_HARDEN_LARGE_QUERIES = 301, /* VAR_HARDEN_LARGE_QUERIES  */
+    VAR_FORWARD_ZONE = 302,        /* VAR_FORWARD_ZONE  */
+    VAR_FORWARD_HOST = 303,        /* VAR_FORWARD_HOST  */
+    VAR_FORWARD_ADDR = 304,        /* VAR_FORWARD_ADDR  */
+    VAR_DO_NOT_QUERY_ADDRESS = 305, /* VAR_DO_NOT_QUERY_ADDRESS  */
+    VAR_HIDE_IDENTITY = 306,       /* VAR_HIDE_IDENTITY  */
+    VAR_HIDE_VERSION = 307,        /* VAR_HIDE_VERSION  */
+    VAR_IDENTITY = 308,            /* VAR_IDENTITY  */
+    VAR_VERSION = 309,             /* VAR_VERSION  */
+    VAR_HARDEN_GLUE = 310,         /* VAR_HARDEN_GLUE  */
+    VAR_MODULE_CONF = 311,         /* VAR_MODULE_CONF  */
+    VAR_TRUST_ANCHOR_FILE = 312,   /* VAR_TRUST_ANCHOR_FILE  */
+    VAR_TRUST_ANCHOR = 313,        /* VAR_TRUST_ANCHOR  */
+    VAR_VAL_OVERRIDE_DATE = 314,   /* VAR_VAL_OVERRIDE_DATE  */
+    VAR_BOGUS_TTL = 315,           /* VAR_BOGUS_TTL  */
+    VAR_VAL_CLEAN_ADDITIONAL = 316, /* VAR_VAL_CLEAN_ADDITIONAL  */
+    VAR_VAL_PERMISSIVE_MODE = 317, /* VAR_VAL_PERMISSIVE_MODE  */
+    VAR_INCOMING_NUM_TCP = 318,    /* VAR_INCOMING_NUM_TCP  */
+    VAR_MSG_BUFFER_SIZE = 319,     /* VAR_MSG_BUFFER_SIZE  */
+    VAR_KEY_CACHE_SIZE = 320,      /* VAR_KEY_CACHE_SIZE  */
+    VAR_KEY_CACHE_SLABS = 321,     /* VAR_KEY_CACHE_SLABS  */
+    VAR_TRUSTED_KEYS_FILE = 322,   /* VAR_TRUSTED_KEYS_FILE  */
+    VAR_VAL_NSEC3_KEYSIZE_ITERATIONS = 323, /* VAR_VAL_NSEC3_KEYSIZE_ITERATIONS  */
+    VAR_USE_SYSLOG = 324,          /* VAR_USE_SYSLOG  */
+    VAR_OUTGOING_INTERFACE = 325,  /* VAR_OUTGOING_INTERFACE  */
+    VAR_ROOT_HINTS = 326,          /* VAR_ROOT_HINTS  */
+    VAR_DO_NOT_QUERY_LOCALHOST = 327, /* VAR_DO_NOT_QUERY_LOCALHOST  */
+    VAR_CACHE_MAX_TTL = 328,       /* VAR_CACHE_MAX_TTL  */
+    VAR_HARDEN_DNSSEC_STRIPPED = 329, /* VAR_HARDEN_DNSSEC_STRIPPED  */
+    VAR_ACCESS_CONTROL = 330,      /* VAR_ACCESS_CONTROL  */
+    VAR_LOCAL_ZONE = 331,          /* VAR_LOCAL_ZONE  */
+    VAR_LOCAL_DATA = 332,          /* VAR_LOCAL_DATA  */
+    VAR_INTERFACE_AUTOMATIC = 333, /* VAR_INTERFACE_AUTOMATIC  */
+    VAR_STATISTICS_INTERVAL = 334, /* VAR_STATISTICS_INTERVAL  */
+    VAR_DO_DAEMONIZE = 335,        /* VAR_DO_DAEMONIZE  */
+    VAR_USE_CAPS_FOR_ID = 336,     /* VAR_USE_CAPS_FOR_ID  */
+    VAR_STATISTICS_CUMULATIVE = 337, /* VAR_STATISTICS_CUMULATIVE  */
+    VAR_OUTGOING_PORT_PERMIT = 338, /* VAR_OUTGOING_PORT_PERMIT  */
+    VAR_OUTGOING_PORT_AVOID = 339, /* VAR_OUTGOING_PORT_AVOID  */
+    VAR_DLV_ANCHOR_FILE = 340,     /* VAR_DLV_ANCHOR_FILE  */
+    VAR_DLV_ANCHOR = 341,          /* VAR_DLV_ANCHOR  */
+    VAR_NEG_CACHE_SIZE = 342,      /* VAR_NEG_CACHE_SIZE  */
+    VAR_HARDEN_REFERRAL_PATH = 343, /* VAR_HARDEN_REFERRAL_PATH  */
+    VAR_PRIVATE_ADDRESS = 344,     /* VAR_PRIVATE_ADDRESS  */
+    VAR_PRIVATE_DOMAIN = 345,      /* VAR_PRIVATE_DOMAIN  */
+    VAR_REMOTE_CONTROL = 346,      /* VAR_REMOTE_CONTROL  */
+    VAR_CONTROL_ENABLE = 347,      /* VAR_CONTROL_ENABLE  */
+    VAR_CONTROL_INTERFACE = 348,   /* VAR_CONTROL_INTERFACE  */
+    VAR_CONTROL_PORT = 349,        /* VAR_CONTROL_PORT  */
+    VAR_SERVER_KEY_FILE = 350,     /* VAR_SERVER_KEY_FILE  */
+    VAR_SERVER_CERT_FILE = 351,    /* VAR_SERVER_CERT_FILE  */
+    VAR_CONTROL_KEY_FILE = 352,    /* VAR_CONTROL_KEY_FILE  */
+    VAR_CONTROL_CERT_FILE = 353,   /* VAR_CONTROL_CERT_FILE  */
+    VAR_CONTROL_USE_CERT = 354,    /* VAR_CONTROL_USE_CERT  */
+    VAR_EXTENDED_STATISTICS = 355, /* VAR_EXTENDED_STATISTICS  */
+    VAR_LOCAL_DATA_PTR = 356,      /* VAR_LOCAL_DATA_PTR  */
+    VAR_JOSTLE_TIMEOUT = 357,      /* VAR_JOSTLE_TIMEOUT  */
+    VAR_STUB_PRIME = 358,          /* VAR_STUB_PRIME  */
+    VAR_UNWANTED_REPLY_THRESHOLD = 359, /* VAR_UNWANTED_REPLY_THRESHOLD  */
+    VAR_LOG_TIME_ASCII = 360,      /* VAR_LOG_TIME_ASCII  */
+    VAR_DOMAIN_INSECURE = 361,     /* VAR_DOMAIN_INSECURE  */
+    VAR_PYTHON = 362,              /* VAR_PYTHON  */
+    VAR_PYTHON_SCRIPT = 363,       /* VAR_PYTHON_SCRIPT  */
+    VAR_VAL_SIG_SKEW_MIN = 364,    /* VAR_VAL_SIG_SKEW_MIN  */
+    VAR_VAL_SIG_SKEW_MAX = 365,    /* VAR_VAL_SIG_SKEW_MAX  */
+    VAR_CACHE_MIN_TTL = 366,       /* VAR_CACHE_MIN_TTL  */
+    VAR_VAL_LOG_LEVEL = 367,       /* VAR_VAL_LOG_LEVEL  */
+    VAR_AUTO_TRUST_ANCHOR_FILE = 368, /* VAR_AUTO_TRUST_ANCHOR_FILE  */
+    VAR_KEEP_MISSING = 369,        /* VAR_KEEP_MISSING  */
+    VAR_ADD_HOLDDOWN = 370,        /* VAR_ADD_HOLDDOWN  */
+    VAR_DEL_HOLDDOWN = 371,        /* VAR_DEL_HOLDDOWN  */
+    VAR_SO_RCVBUF = 372,           /* VAR_SO_RCVBUF  */
+    VAR_EDNS_BUFFER_SIZE = 373,    /* VAR_EDNS_BUFFER_SIZE  */
+    VAR_PREFETCH = 374,            /* VAR_PREFETCH  */
+    VAR_PREFETCH_KEY = 375,        /* VAR_PREFETCH_KEY  */
+    VAR_SO_SNDBUF = 376,           /* VAR_SO_SNDBUF  */
+    VAR_SO_REUSEPORT = 377,        /* VAR_SO_REUSEPORT  */
+    VAR_HARDEN_BELOW_NXDOMAIN = 378, /* VAR_HARDEN_BELOW_NXDOMAIN  */
+    VAR_IGNORE_CD_FLAG = 379,      /* VAR_IGNORE_CD_FLAG  */
+    VAR_LOG_QUERIES = 380,         /* VAR_LOG_QUERIES  */
+    VAR_LOG_REPLIES = 381,         /* VAR_LOG_REPLIES  */
+    VAR_TCP_UPSTREAM = 382,        /* VAR_TCP_UPSTREAM  */
+    VAR_SSL_UPSTREAM = 383,        /* VAR_SSL_UPSTREAM  */
+    VAR_SSL_SERVICE_KEY = 384,     /* VAR_SSL_SERVICE_KEY  */
+    VAR_SSL_SERVICE_PEM = 385,     /* VAR_SSL_SERVICE_PEM  */
+    VAR_SSL_PORT = 386,            /* VAR_SSL_PORT  */
+    VAR_FORWARD_FIRST = 387,       /* VAR_FORWARD_FIRST  */
+    VAR_STUB_SSL_UPSTREAM = 388,   /* VAR_STUB_SSL_UPSTREAM  */
+    VAR_FORWARD_SSL_UPSTREAM = 389, /* VAR_FORWARD_SSL_UPSTREAM  */
+    VAR_TLS_CERT_BUNDLE = 390,     /* VAR_TLS_CERT_BUNDLE  */
+    VAR_STUB_FIRST = 391,          /* VAR_STUB_FIRST  */
+    VAR_MINIMAL_RESPONSES = 392,   /* VAR_MINIMAL_RESPONSES  */
+    VAR_RRSET_ROUNDROBIN = 393,    /* VAR_RRSET_ROUNDROBIN  */
+    VAR_MAX_UDP_SIZE = 394,        /* VAR_MAX_UDP_SIZE  */
+    VAR_DELAY_CLOSE = 395,         /* VAR_DELAY_CLOSE  */
+    VAR_UNBLOCK_LAN_ZONES = 396,   /* VAR_UNBLOCK_LAN_ZONES  */
+    VAR_INSECURE_LAN_ZONES = 397,  /* VAR_INSECURE_LAN_ZONES  */
+    VAR_INFRA_CACHE_MIN_RTT = 398, /* VAR_INFRA_CACHE_MIN_RTT  */
+    VAR_DNS64_PREFIX = 399,        /* VAR_DNS64_PREFIX  */
+    VAR_DNS64_SYNTHALL = 400,      /* VAR_DNS64_SYNTHALL  */
+    VAR_DNSTAP = 401,              /* VAR_DNSTAP  */
+    VAR_DNSTAP_ENABLE = 402,       /* VAR_DNSTAP_ENABLE  */
+    VAR_DNSTAP_SOCKET_PATH = 403,  /* VAR_DNSTAP_SOCKET_PATH  */
+    VAR_DNSTAP_SEND_IDENTITY = 404, /* VAR_DNSTAP_SEND_IDENTITY  */
+    VAR_DNSTAP_SEND_VERSION = 405, /* VAR_DNSTAP_SEND_VERSION  */
+    VAR_DNSTAP_IDENTITY = 406,     /* VAR_DNSTAP_IDENTITY  */
+    VAR_DNSTAP_VERSION = 407,      /* VAR_DNSTAP_VERSION  */
+    VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES = 408, /* VAR_DNSTAP_LOG_RESOLVER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES = 409, /* VAR_DNSTAP_LOG_RESOLVER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES = 410, /* VAR_DNSTAP_LOG_CLIENT_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES = 411, /* VAR_DNSTAP_LOG_CLIENT_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES = 412, /* VAR_DNSTAP_LOG_FORWARDER_QUERY_MESSAGES  */
+    VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES = 413, /* VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MESSAGES  */
+    VAR_RESPONSE_IP_TAG = 414,     /* VAR_RESPONSE_IP_TAG  */
+    VAR_RESPONSE_IP = 415,         /* VAR_RESPONSE_IP  */
+    VAR_RESPONSE_IP_DATA = 416,    /* VAR_RESPONSE_IP_DATA  */
+    VAR_HARDEN_ALGO_DOWNGRADE = 417, /* VAR_HARDEN_ALGO_DOWNGRADE  */
+    VAR_IP_TRANSPARENT = 418,      /* VAR_IP_TRANSPARENT  */
+    VAR_DISABLE_DNSSEC_LAME_CHECK = 419, /* VAR_DISABLE_DNSSEC_LAME_CHECK  */
+    VAR_IP_RATELIMIT = 420,        /* VAR_IP_RATELIMIT  */
+    VAR_IP_RATELIMIT_SLABS = 421,  /* VAR_IP_RATELIMIT_SLABS  */
+    VAR_IP_RATELIMIT_SIZE = 422,   /* VAR_IP_RATELIMIT_SIZE  */
+    VAR_RATELIMIT = 423,           /* VAR_RATELIMIT  */
+    VAR_RATELIMIT_SLABS = 424,     /* VAR_RATELIMIT_SLABS  */
+    VAR_RATELIMIT_SIZE = 425,      /* VAR_RATELIMIT_SIZE  */
+    VAR_RATELIMIT_FOR_DOMAIN = 426, /* VAR_RATELIMIT_FOR_DOMAIN  */
+    VAR_RATELIMIT_BELOW_DOMAIN = 427, /* VAR_RATELIMIT_BELOW_DOMAIN  */
+    VAR_IP_RATELIMIT_FACTOR = 428, /* VAR_IP_RATELIMIT_FACTOR  */
+    VAR_RATELIMIT_FACTOR = 429,    /* VAR_RATELIMIT_FACTOR  */
+    VAR_SEND_CLIENT_SUBNET = 430,  /* VAR_SEND_CLIENT_SUBNET  */
+    VAR_CLIENT_SUBNET_ZONE = 431,  /* VAR_CLIENT_SUBNET_ZONE  */
+    VAR_CLIENT_SUBNET_ALWAYS_FORWARD = 432, /* VAR_CLIENT_SUBNET_ALWAYS_FORWARD  */
+    VAR_CLIENT_SUBNET_OPCODE = 433, /* VAR_CLIENT_SUBNET_OPCODE  */
+    VAR_MAX_CLIENT_SUBNET_IPV4 = 434, /* VAR_MAX_CLIENT_SUBNET_IPV4  */
+    VAR_MAX_CLIENT_SUBNET_IPV6 = 435, /* VAR_MAX_CLIENT_SUBNET_IPV6  */
+    VAR_CAPS_WHITELIST = 436,      /* VAR_CAPS_WHITELIST  */
+    VAR_CACHE_MAX_NEGATIVE_TTL = 437, /* VAR_CACHE_MAX_NEGATIVE_TTL  */
+    VAR_PERMIT_SMALL_HOLDDOWN = 438, /* VAR_PERMIT_SMALL_HOLDDOWN  */
+    VAR_QNAME_MINIMISATION = 439,  /* VAR_QNAME_MINIMISATION  */
+    VAR_QNAME_MINIMISATION_STRICT = 440, /* VAR_QNAME_MINIMISATION_STRICT  */
+    VAR_IP_FREEBIND = 441,         /* VAR_IP_FREEBIND  */
+    VAR_DEFINE_TAG = 442,          /* VAR_DEFINE_TAG  */
+    VAR_LOCAL_ZONE_TAG = 443,      /* VAR_LOCAL_ZONE_TAG  */
+    VAR_ACCESS_CONTROL_TAG = 444,  /* VAR_ACCESS_CONTROL_TAG  */
+    VAR_LOCAL_ZONE_OVERRIDE = 445, /* VAR_LOCAL_ZONE_OVERRIDE  */
+    VAR_ACCESS_CONTROL_TAG_ACTION = 446, /* VAR_ACCESS_CONTROL_TAG_ACTION  */
+    VAR_ACCESS_CONTROL_TAG_DATA = 447, /* VAR_ACCESS_CONTROL_TAG_DATA  */
+    VAR_VIEW = 448,                /* VAR_VIEW  */
+    VAR_ACCESS_CONTROL_VIEW = 449, /* VAR_ACCESS_CONTROL_VIEW  */
+    VAR_VIEW_FIRST = 450,          /* VAR_VIEW_FIRST  */
+    VAR_SERVE_EXPIRED = 451,       /* VAR_SERVE_EXPIRED  */
+    VAR_FAKE_DSA = 452,            /* VAR_FAKE_DSA  */
+    VAR_FAKE_SHA1 = 453,           /* VAR_FAKE_SHA1  */
+    VAR_LOG_IDENTITY = 454,        /* VAR_LOG_IDENTITY  */
+    VAR_HIDE_TRUSTANCHOR = 455,    /* VAR_HIDE_TRUSTANCHOR  */
+    VAR_TRUST_ANCHOR_SIGNALING = 456, /* VAR_TRUST_ANCHOR_SIGNALING  */
+    VAR_AGGRESSIVE_NSEC = 457,     /* VAR_AGGRESSIVE_NSEC  */
+    VAR_USE_SYSTEMD = 458,         /* VAR_USE_SYSTEMD  */
+    VAR_SHM_ENABLE = 459,          /* VAR_SHM_ENABLE  */
+    VAR_SHM_KEY = 460,             /* VAR_SHM_KEY  */
+    VAR_DNSCRYPT = 461,            /* VAR_DNSCRYPT  */
+    VAR_DNSCRYPT_ENABLE = 462,     /* VAR_DNSCRYPT_ENABLE  */
+    VAR_DNSCRYPT_PORT = 463,       /* VAR_DNSCRYPT_PORT  */
+    VAR_DNSCRYPT_PROVIDER = 464,   /* VAR_DNSCRYPT_PROVIDER  */
+    VAR_DNSCRYPT_SECRET_KEY = 465, /* VAR_DNSCRYPT_SECRET_KEY  */
+    VAR_DNSCRYPT_PROVIDER_CERT = 466, /* VAR_DNSCRYPT_PROVIDER_CERT  */
+    VAR_DNSCRYPT_PROVIDER_CERT_ROTATED = 467, /* VAR_DNSCRYPT_PROVIDER_CERT_ROTATED  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE = 468, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SIZE  */
+    VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS = 469, /* VAR_DNSCRYPT_SHARED_SECRET_CACHE_SLABS  */
+    VAR_DNSCRYPT_NONCE_CACHE_SIZE = 470, /* VAR_DNSCRYPT_NONCE_CACHE_SIZE  */
+    VAR_DNSCRYPT_NONCE_CACHE_SLABS = 471, /* VAR_DNSCRYPT_NONCE_CACHE_SLABS  */
+    VAR_IPSECMOD_ENABLED = 472,    /* VAR_IPSECMOD_ENABLED  */
+    VAR_IPSECMOD_HOOK = 473,       /* VAR_IPSECMOD_HOOK  */
+    VAR_IPSECMOD_IGNORE_BOGUS = 474, /* VAR_IPSECMOD_IGNORE_BOGUS  */
+    VAR_IPSECMOD_MAX_TTL = 475,    /* VAR_IPSECMOD_MAX_TTL  */
+    VAR_IPSECMOD_WHITELIST = 476,  /* VAR_IPSECMOD_WHITELIST  */
+    VAR_IPSECMOD_STRICT = 477,     /* VAR_IPSECMOD_STRICT  */
+    VAR_CACHEDB = 478,             /* VAR_CACHEDB  */
+    VAR_CACHEDB_BACKEND = 479,     /* VAR_CACHEDB_BACKEND  */
+    VAR_CACHEDB_SECRETSEED = 480,  /* VAR_CACHEDB_SECRETSEED  */
+    VAR_CACHEDB_REDISHOST = 481,   /* VAR_CACHEDB_REDISHOST  */
+    VAR_CACHEDB_REDISPORT = 482,   /* VAR_CACHEDB_REDISPORT  */
+    VAR_CACHEDB_REDISTIMEOUT = 483, /* VAR_CACHEDB_REDISTIMEOUT  */
+    VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM = 484, /* VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM  */
+    VAR_FOR_UPSTREAM = 485,        /* VAR_FOR_UPSTREAM  */
+    VAR_AUTH_ZONE = 486,           /* VAR_AUTH_ZONE  */
+    VAR_ZONEFILE = 487,            /* VAR_ZONEFILE  */
+    VAR_MASTER = 488,              /* VAR_MASTER  */
+    VAR_URL = 489,                 /* VAR_URL  */
+    VAR_FOR_DOWNSTREAM = 490,      /* VAR_FOR_DOWNSTREAM  */
+    VAR_FALLBACK_ENABLED = 491,    /* VAR_FALLBACK_ENABLED  */
+    VAR_ADDITIONAL_TLS_PORT = 492, /* VAR_ADDITIONAL_TLS_PORT  */
+    VAR_UPSTREAM_RACE = 493,       /* VAR_UPSTREAM_RACE  */
+    VAR_UPSTREAM_RACE_DELAY = 494, /* VAR_UPSTREAM_RACE_DELAY  */
+    VAR_UPSTREAM_RACE_MAX = 495,   /* VAR_UPSTREAM_RACE_MAX  */
+    VAR_UPSTREAM_RACE_BUDGET = 496, /* VAR_UPSTREAM_RACE_BUDGET  */
+    VAR_LOG_MODULE_TIME = 497,     /* VAR_LOG_MODULE_TIME  */
+    VAR_DNSTAP_IP = 498,           /* VAR_DNSTAP_IP  */
+    VAR_DNSTAP_FILE = 499,         /* VAR_DNSTAP_FILE  */
+    VAR_DNSTAP_FILE_ROTATE_SIZE = 500, /* VAR_DNSTAP_FILE_ROTATE_SIZE  */
+    VAR_DNSTAP_FILE_ROTATE_INTERVAL = 501, /* VAR_DNSTAP_FILE_ROTATE_INTERVAL  */
+    VAR_DNSTAP_RING_SIZE = 502,    /* VAR_DNSTAP_RING_SIZE  */
+    VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES = 503, /* VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES  */
+    VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES = 504, /* VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES = 505, /* VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES  */
+    VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES = 506, /* VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES = 507, /* VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES  */
+    VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES = 508, /* VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES  */
+    VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL = 509, /* VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL  */
+    VAR_IP_RATELIMIT_SKETCH = 510, /* VAR_IP_RATELIMIT_SKETCH  */
+    VAR_HEAVY_HITTERS_SIZE = 511,  /* VAR_HEAVY_HITTERS_SIZE  */
+    VAR_CACHE_HUGE_PAGES = 512,    /* VAR_CACHE_HUGE_PAGES  */
+    VAR_MSG_CACHE_WIREFORMAT = 513 /* VAR_MSG_CACHE_WIREFORMAT  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
-/* Tokens.  */
+/* Token kinds.  */
+#define YYEMPTY -2
+#define YYEOF 0
+#define YYerror 256
+#define YYUNDEF 257
 #define SPACE 258
 #define LETTER 259
 #define NEWLINE 260
@@ -518,19 +553,39 @@ extern int yydebug;
 #define VAR_FOR_DOWNSTREAM 490
 #define VAR_FALLBACK_ENABLED 491
 #define VAR_ADDITIONAL_TLS_PORT 492
+#define VAR_UPSTREAM_RACE 493
+#define VAR_UPSTREAM_RACE_DELAY 494
+#define VAR_UPSTREAM_RACE_MAX 495
+#define VAR_UPSTREAM_RACE_BUDGET 496
+#define VAR_LOG_MODULE_TIME 497
+#define VAR_DNSTAP_IP 498
+#define VAR_DNSTAP_FILE 499
+#define VAR_DNSTAP_FILE_ROTATE_SIZE 500
+#define VAR_DNSTAP_FILE_ROTATE_INTERVAL 501
+#define VAR_DNSTAP_RING_SIZE 502
+#define VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES 503
+#define VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES 504
+#define VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES 505
+#define VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES 506
+#define VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES 507
+#define VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES 508
+#define VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL 509
+#define VAR_IP_RATELIMIT_SKETCH 510
+#define VAR_HEAVY_HITTERS_SIZE 511
+#define VAR_CACHE_HUGE_PAGES 512
+#define VAR_MSG_CACHE_WIREFORMAT 513
 
 /* Value type.  */
 #if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-
 union YYSTYPE
 {
-#line 66 "./util/configparser.y" /* yacc.c:1909  */
+#line 67 "util/configparser.y"
 
 	char*	str;
 
-#line 532 "util/configparser.h" /* yacc.c:1909  */
-};
+#line 587 "util/configparser.h"
 
+};
 typedef union YYSTYPE YYSTYPE;
 # define YYSTYPE_IS_TRIVIAL 1
 # define YYSTYPE_IS_DECLARED 1
@@ -539,6 +594,8 @@ typedef union YYSTYPE YYSTYPE;
 
 extern YYSTYPE yylval;
 
+
 int yyparse (void);
 
+
 #endif /* !YY_YY_UTIL_CONFIGPARSER_H_INCLUDED  */
@@ -52,6 +52,7 @@ int ub_c_lex(void);
 void ub_c_error(const char *message);
 
 static void validate_respip_action(const char* action);
+static void parse_dnstap_sample(const char* str, int* rate);
 
 /* these need to be global, otherwise they cannot be used inside yacc */
 extern struct config_parser_state* cfg_parser;
@@ -156,6 +157,18 @@ extern struct config_parser_state* cfg_parser;
 %token VAR_UDP_UPSTREAM_WITHOUT_DOWNSTREAM VAR_FOR_UPSTREAM
 %token VAR_AUTH_ZONE VAR_ZONEFILE VAR_MASTER VAR_URL VAR_FOR_DOWNSTREAM
 %token VAR_FALLBACK_ENABLED VAR_ADDITIONAL_TLS_PORT
+%token VAR_UPSTREAM_RACE VAR_UPSTREAM_RACE_DELAY VAR_UPSTREAM_RACE_MAX
+%token VAR_UPSTREAM_RACE_BUDGET VAR_LOG_MODULE_TIME
+%token VAR_DNSTAP_IP VAR_DNSTAP_FILE VAR_DNSTAP_FILE_ROTATE_SIZE
+%token VAR_DNSTAP_FILE_ROTATE_INTERVAL VAR_DNSTAP_RING_SIZE
+%token VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES
+%token VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES
+%token VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES
+%token VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES
+%token VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES
+%token VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES
+%token VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL VAR_IP_RATELIMIT_SKETCH
+%token VAR_HEAVY_HITTERS_SIZE VAR_CACHE_HUGE_PAGES VAR_MSG_CACHE_WIREFORMAT
 
 %%
 toplevelvars: /* empty */ | toplevelvars toplevelvar ;
@@ -245,7 +258,12 @@ content_server: server_num_threads | server_verbosity | server_port |
 	server_ipsecmod_ignore_bogus | server_ipsecmod_max_ttl |
 	server_ipsecmod_whitelist | server_ipsecmod_strict |
 	server_udp_upstream_without_downstream | server_aggressive_nsec |
-	server_tls_cert_bundle | server_additional_tls_port
+	server_tls_cert_bundle | server_additional_tls_port |
+	server_upstream_race | server_upstream_race_delay |
+	server_upstream_race_max | server_upstream_race_budget |
+	server_log_module_time | server_ip_ratelimit_sketch |
+	server_heavy_hitters_size | server_cache_huge_pages |
+	server_msg_cache_wireformat
 	;
 stubstart: VAR_STUB_ZONE
 	{
@@ -750,6 +768,33 @@ server_log_replies: VAR_LOG_REPLIES STRING_ARG
   	free($2);
   }
   ;
+server_log_module_time: VAR_LOG_MODULE_TIME STRING_ARG
+  {
+  	OUTYY(("P(server_log_module_time:%s)\n", $2));
+  	if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+  		yyerror("expected yes or no.");
+  	else cfg_parser->cfg->log_module_time = (strcmp($2, "yes")==0);
+  	free($2);
+  }
+  ;
+server_ip_ratelimit_sketch: VAR_IP_RATELIMIT_SKETCH STRING_ARG
+  {
+  	OUTYY(("P(server_ip_ratelimit_sketch:%s)\n", $2));
+  	if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+  		yyerror("expected yes or no.");
+  	else cfg_parser->cfg->ip_ratelimit_sketch = (strcmp($2, "yes")==0);
+  	free($2);
+  }
+  ;
+server_heavy_hitters_size: VAR_HEAVY_HITTERS_SIZE STRING_ARG
+  {
+  	OUTYY(("P(server_heavy_hitters_size:%s)\n", $2));
+  	if(atoi($2) == 0 && strcmp($2, "0") != 0)
+  		yyerror("number expected");
+  	else cfg_parser->cfg->heavy_hitters_size = atoi($2);
+  	free($2);
+  }
+  ;
 server_chroot: VAR_CHROOT STRING_ARG
 	{
 		OUTYY(("P(server_chroot:%s)\n", $2));
@@ -1007,6 +1052,16 @@ server_msg_cache_slabs: VAR_MSG_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_msg_cache_wireformat: VAR_MSG_CACHE_WIREFORMAT STRING_ARG
+	{
+		OUTYY(("P(server_msg_cache_wireformat:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->msg_cache_wireformat =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_num_queries_per_thread: VAR_NUM_QUERIES_PER_THREAD STRING_ARG
 	{
 		OUTYY(("P(server_num_queries_per_thread:%s)\n", $2));
@@ -1075,6 +1130,16 @@ server_rrset_cache_slabs: VAR_RRSET_CACHE_SLABS STRING_ARG
 		free($2);
 	}
 	;
+server_cache_huge_pages: VAR_CACHE_HUGE_PAGES STRING_ARG
+	{
+		OUTYY(("P(server_cache_huge_pages:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->cache_huge_pages =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 server_infra_host_ttl: VAR_INFRA_HOST_TTL STRING_ARG
 	{
 		OUTYY(("P(server_infra_host_ttl:%s)\n", $2));
@@ -1880,6 +1945,43 @@ server_qname_minimisation_strict: VAR_QNAME_MINIMISATION_STRICT STRING_ARG
 		free($2);
 	}
 	;
+server_upstream_race: VAR_UPSTREAM_RACE STRING_ARG
+	{
+		OUTYY(("P(server_upstream_race:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->upstream_race = 
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
+server_upstream_race_delay: VAR_UPSTREAM_RACE_DELAY STRING_ARG
+	{
+		OUTYY(("P(server_upstream_race_delay:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_race_delay = atoi($2);
+		free($2);
+	}
+	;
+server_upstream_race_max: VAR_UPSTREAM_RACE_MAX STRING_ARG
+	{
+		OUTYY(("P(server_upstream_race_max:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_race_max = atoi($2);
+		free($2);
+	}
+	;
+server_upstream_race_budget: VAR_UPSTREAM_RACE_BUDGET STRING_ARG
+	{
+		OUTYY(("P(server_upstream_race_budget:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->upstream_race_budget = atoi($2);
+		free($2);
+	}
+	;
 server_ipsecmod_enabled: VAR_IPSECMOD_ENABLED STRING_ARG
 	{
 	#ifdef USE_IPSECMOD
@@ -2292,7 +2394,16 @@ content_dt: dt_dnstap_enable | dt_dnstap_socket_path |
 	dt_dnstap_log_client_query_messages |
 	dt_dnstap_log_client_response_messages |
 	dt_dnstap_log_forwarder_query_messages |
-	dt_dnstap_log_forwarder_response_messages
+	dt_dnstap_log_forwarder_response_messages |
+	dt_dnstap_ip | dt_dnstap_file | dt_dnstap_file_rotate_size |
+	dt_dnstap_file_rotate_interval | dt_dnstap_ring_size |
+	dt_dnstap_sample_resolver_query_messages |
+	dt_dnstap_sample_resolver_response_messages |
+	dt_dnstap_sample_client_query_messages |
+	dt_dnstap_sample_client_response_messages |
+	dt_dnstap_sample_forwarder_query_messages |
+	dt_dnstap_sample_forwarder_response_messages |
+	dt_dnstap_sample_keep_servfail
 	;
 dt_dnstap_enable: VAR_DNSTAP_ENABLE STRING_ARG
 	{
@@ -2393,6 +2504,110 @@ dt_dnstap_log_forwarder_response_messages: VAR_DNSTAP_LOG_FORWARDER_RESPONSE_MES
 			(strcmp($2, "yes")==0);
 	}
 	;
+dt_dnstap_ip: VAR_DNSTAP_IP STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_ip:%s)\n", $2));
+	#if defined(USE_DNSTAP) && !defined(HAVE_FSTRM_TCP_WRITER_OPTIONS_INIT)
+		if($2[0] != 0)
+			yyerror("dnstap-ip needs fstrm 0.4 or later, it was "
+				"not found when unbound was compiled");
+	#endif
+		free(cfg_parser->cfg->dnstap_ip);
+		cfg_parser->cfg->dnstap_ip = $2;
+	}
+	;
+dt_dnstap_file: VAR_DNSTAP_FILE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_file:%s)\n", $2));
+		free(cfg_parser->cfg->dnstap_file);
+		cfg_parser->cfg->dnstap_file = $2;
+	}
+	;
+dt_dnstap_file_rotate_size: VAR_DNSTAP_FILE_ROTATE_SIZE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_file_rotate_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2,
+			&cfg_parser->cfg->dnstap_file_rotate_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+dt_dnstap_file_rotate_interval: VAR_DNSTAP_FILE_ROTATE_INTERVAL STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_file_rotate_interval:%s)\n", $2));
+		if(atoi($2) == 0 && strcmp($2, "0") != 0)
+			yyerror("number expected");
+		else cfg_parser->cfg->dnstap_file_rotate_interval = atoi($2);
+		free($2);
+	}
+	;
+dt_dnstap_ring_size: VAR_DNSTAP_RING_SIZE STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_ring_size:%s)\n", $2));
+		if(!cfg_parse_memsize($2,
+			&cfg_parser->cfg->dnstap_ring_size))
+			yyerror("memory size expected");
+		free($2);
+	}
+	;
+dt_dnstap_sample_resolver_query_messages: VAR_DNSTAP_SAMPLE_RESOLVER_QUERY_MESSAGES STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_resolver_query_messages:%s)\n", $2));
+		parse_dnstap_sample($2,
+			&cfg_parser->cfg->dnstap_sample_resolver_query_messages);
+		free($2);
+	}
+	;
+dt_dnstap_sample_resolver_response_messages: VAR_DNSTAP_SAMPLE_RESOLVER_RESPONSE_MESSAGES STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_resolver_response_messages:%s)\n", $2));
+		parse_dnstap_sample($2,
+			&cfg_parser->cfg->dnstap_sample_resolver_response_messages);
+		free($2);
+	}
+	;
+dt_dnstap_sample_client_query_messages: VAR_DNSTAP_SAMPLE_CLIENT_QUERY_MESSAGES STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_client_query_messages:%s)\n", $2));
+		parse_dnstap_sample($2,
+			&cfg_parser->cfg->dnstap_sample_client_query_messages);
+		free($2);
+	}
+	;
+dt_dnstap_sample_client_response_messages: VAR_DNSTAP_SAMPLE_CLIENT_RESPONSE_MESSAGES STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_client_response_messages:%s)\n", $2));
+		parse_dnstap_sample($2,
+			&cfg_parser->cfg->dnstap_sample_client_response_messages);
+		free($2);
+	}
+	;
+dt_dnstap_sample_forwarder_query_messages: VAR_DNSTAP_SAMPLE_FORWARDER_QUERY_MESSAGES STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_forwarder_query_messages:%s)\n", $2));
+		parse_dnstap_sample($2,
+			&cfg_parser->cfg->dnstap_sample_forwarder_query_messages);
+		free($2);
+	}
+	;
+dt_dnstap_sample_forwarder_response_messages: VAR_DNSTAP_SAMPLE_FORWARDER_RESPONSE_MESSAGES STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_forwarder_response_messages:%s)\n", $2));
+		parse_dnstap_sample($2,
+			&cfg_parser->cfg->dnstap_sample_forwarder_response_messages);
+		free($2);
+	}
+	;
+dt_dnstap_sample_keep_servfail: VAR_DNSTAP_SAMPLE_KEEP_SERVFAIL STRING_ARG
+	{
+		OUTYY(("P(dt_dnstap_sample_keep_servfail:%s)\n", $2));
+		if(strcmp($2, "yes") != 0 && strcmp($2, "no") != 0)
+			yyerror("expected yes or no.");
+		else cfg_parser->cfg->dnstap_sample_keep_servfail =
+			(strcmp($2, "yes")==0);
+		free($2);
+	}
+	;
 pythonstart: VAR_PYTHON
 	{ 
 		OUTYY(("\nP(python:)\n")); 
@@ -2651,3 +2866,13 @@ validate_respip_action(const char* action)
 			"always_refuse or always_nxdomain");
 	}
 }
+
+/** parse a dnstap-sample percentage into rate */
+static void
+parse_dnstap_sample(const char* str, int* rate)
+{
+	if((atoi(str) == 0 && strcmp(str, "0") != 0) || atoi(str) < 0 ||
+		atoi(str) > 100)
+		yyerror("percentage from 0 to 100 expected");
+	else *rate = atoi(str);
+}
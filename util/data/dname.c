@@ -177,13 +177,45 @@ pkt_dname_tolower(sldns_buffer* pkt, uint8_t* dname)
 }
 
 
-size_t
-pkt_dname_len(sldns_buffer* pkt)
+/** lowercase the octets of a label, eight octets at a time.  For every
+ * octet the result is that of tolower in the C locale.  The octets are
+ * copied to another buffer. */
+static void
+label_tolower(uint8_t* to, uint8_t* from, size_t len)
+{
+	const uint64_t ones = (uint64_t)0x0101010101010101ULL;
+	uint64_t w, low, upper;
+	while(len >= 8) {
+		memcpy(&w, from, sizeof(w));
+		low = w & (ones*0x7f);
+		/* the top bit of the octet is set for 'A'-'Z' */
+		upper = ((low + ones*(0x80-'A')) ^ (low + ones*(0x7f-'Z'))) &
+			~w & (ones*0x80);
+		w |= upper >> 2;
+		memcpy(to, &w, sizeof(w));
+		to += 8;
+		from += 8;
+		len -= 8;
+	}
+	while(len--)
+		*to++ = (uint8_t)tolower((unsigned char)*from++);
+}
+
+/**
+ * Walk a compressed dname in the packet, check it and determine length.
+ * @param pkt: packet, at the start of the dname.
+ * @param h: if not NULL, the labels are hashed into this value.
+ * @param ptrs: returns the number of compression pointers followed.
+ * @return 0 on parse error, or the uncompressed length.
+ */
+static size_t
+pkt_dname_walk(sldns_buffer* pkt, hashvalue_type* h, int* ptrs)
 {
 	size_t len = 0;
 	int ptrcount = 0;
 	uint8_t labellen;
 	size_t endpos = 0;
+	uint8_t labuf[LDNS_MAX_LABELLEN+1];
 
 	/* read dname and determine length */
 	/* check compression pointers, loops, out of bounds */
@@ -218,15 +250,35 @@ pkt_dname_len(sldns_buffer* pkt)
 			}
 			if(sldns_buffer_remaining(pkt) < labellen)
 				return 0;
+			if(h) {
+				labuf[0] = labellen;
+				label_tolower(labuf+1, sldns_buffer_current(pkt),
+					labellen);
+				*h = hashlittle(labuf, (size_t)labellen + 1, *h);
+			}
 			sldns_buffer_skip(pkt, (ssize_t)labellen);
 		}
 	}
 	if(endpos)
 		sldns_buffer_set_position(pkt, endpos);
+	*ptrs = ptrcount;
 
 	return len;
 }
 
+size_t
+pkt_dname_len(sldns_buffer* pkt)
+{
+	int ptrs;
+	return pkt_dname_walk(pkt, NULL, &ptrs);
+}
+
+size_t
+pkt_dname_len_hash(sldns_buffer* pkt, hashvalue_type* h, int* ptrs)
+{
+	return pkt_dname_walk(pkt, h, ptrs);
+}
+
 int 
 dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 {
@@ -246,6 +298,9 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 			len2 = *d2++;
 			continue;
 		}
+		/* at the same name in the packet, the rest is equal */
+		if(d1 == d2)
+			return 0;
 		/* check label length */
 		log_assert(len1 <= LDNS_MAX_LABELLEN);
 		log_assert(len2 <= LDNS_MAX_LABELLEN);
@@ -254,8 +309,12 @@ dname_pkt_compare(sldns_buffer* pkt, uint8_t* d1, uint8_t* d2)
 			return 1;
 		}
 		log_assert(len1 == len2 && len1 != 0);
-		/* compare labels */
-		while(len1--) {
+		/* compare labels, the octets first, and lowercased if
+		 * they differ */
+		if(memcmp(d1, d2, len1) == 0) {
+			d1 += len1;
+			d2 += len1;
+		} else while(len1--) {
 			if(tolower((unsigned char)*d1) != tolower((unsigned char)*d2)) {
 				if(tolower((unsigned char)*d1) < tolower((unsigned char)*d2))
 					return -1;
@@ -275,18 +334,14 @@ dname_query_hash(uint8_t* dname, hashvalue_type h)
 {
 	uint8_t labuf[LDNS_MAX_LABELLEN+1];
 	uint8_t lablen;
-	int i;
 
 	/* preserve case of query, make hash label by label */
 	lablen = *dname++;
 	while(lablen) {
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
 		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
+		label_tolower(labuf+1, dname, lablen);
+		dname += lablen;
 		h = hashlittle(labuf, labuf[0] + 1, h);
 		lablen = *dname++;
 	}
@@ -299,7 +354,6 @@ dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
 {
 	uint8_t labuf[LDNS_MAX_LABELLEN+1];
 	uint8_t lablen;
-	int i;
 
 	/* preserve case of query, make hash label by label */
 	lablen = *dname++;
@@ -312,11 +366,8 @@ dname_pkt_hash(sldns_buffer* pkt, uint8_t* dname, hashvalue_type h)
 		}
 		log_assert(lablen <= LDNS_MAX_LABELLEN);
 		labuf[0] = lablen;
-		i=0;
-		while(lablen--) {
-			labuf[++i] = (uint8_t)tolower((unsigned char)*dname);
-			dname++;
-		}
+		label_tolower(labuf+1, dname, lablen);
+		dname += lablen;
 		h = hashlittle(labuf, labuf[0] + 1, h);
 		lablen = *dname++;
 	}
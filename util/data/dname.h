@@ -109,6 +109,18 @@ int query_dname_compare(uint8_t* d1, uint8_t* d2);
  */
 size_t pkt_dname_len(struct sldns_buffer* pkt);
 
+/**
+ * Determine correct, compressed, dname present in packet, and hash it,
+ * in one pass over the labels.
+ * @param pkt: packet to read from (from current start position).
+ * @param h: initial hash value, returns the hash value, the same as
+ *	dname_pkt_hash.  Undefined on parse error.
+ * @param ptrs: returns the number of compression pointers followed.
+ * @return: 0 on parse error, or the length, like pkt_dname_len.
+ */
+size_t pkt_dname_len_hash(struct sldns_buffer* pkt, hashvalue_type* h,
+	int* ptrs);
+
 /**
  * Compare dnames in packet (compressed). Dnames must be valid.
  * routine performs lowercasing, so the packet casing is preserved.
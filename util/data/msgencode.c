@@ -40,6 +40,7 @@
  */
 
 #include "config.h"
+#include <ctype.h>
 #include "util/data/msgencode.h"
 #include "util/data/msgreply.h"
 #include "util/data/msgparse.h"
@@ -57,6 +58,8 @@
 #define RETVAL_TRUNC	-4
 /** return code that means all is peachy keen. Equal to DNS rcode NOERROR */
 #define RETVAL_OK	0
+/** size of the buffer that the precomputed wireformat is made in */
+#define REPLY_WIRE_MAX	65535
 
 /**
  * Data structure to help domain name compression in outgoing messages.
@@ -634,10 +637,12 @@ positive_answer(struct reply_info* rep, uint16_t qtype) {
 	return 0;
 }
 
-int 
-reply_info_encode(struct query_info* qinfo, struct reply_info* rep, 
+/** encode the reply with the compression tree, return 0 on alloc failure.
+ * If minimal, the authority and additional sections are left out. */
+static int
+reply_encode_tree(struct query_info* qinfo, struct reply_info* rep, 
 	uint16_t id, uint16_t flags, sldns_buffer* buffer, time_t timenow, 
-	struct regional* region, uint16_t udpsize, int dnssec)
+	struct regional* region, uint16_t udpsize, int dnssec, int minimal)
 {
 	uint16_t ancount=0, nscount=0, arcount=0;
 	struct compress_tree_node* tree = 0;
@@ -719,7 +724,7 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	sldns_buffer_write_u16_at(buffer, 6, ancount);
 
 	/* if response is positive answer, auth/add sections are not required */
-	if( ! (MINIMAL_RESPONSES && positive_answer(rep, qinfo->qtype)) ) {
+	if(!minimal) {
 		/* insert auth section */
 		if((r=insert_section(rep, rep->ns_numrrsets, &nscount, buffer, 
 			rep->an_numrrsets, timenow, region, &tree,
@@ -755,6 +760,410 @@ reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	return 1;
 }
 
+/**
+ * Compare a domain name in the packet, that can be compressed, with an
+ * uncompressed domain name.  The labels before the first compression
+ * pointer must be equal.  The labels after it are compared case
+ * insensitive, like the compression tree compares them.
+ * @param pkt: start of the packet.
+ * @param p: the name in the packet.
+ * @param d: the uncompressed name.
+ * @param len: returns the length of the name at p.
+ * @return true if equal.
+ */
+static int
+wire_dname_equal(uint8_t* pkt, uint8_t* p, uint8_t* d, size_t* len)
+{
+	uint8_t* start = p;
+	uint8_t* ptr = NULL;
+	uint8_t lablen;
+	int ci = 0;
+	while(1) {
+		if(LABEL_IS_PTR(*p)) {
+			/* the encoder points to earlier names only */
+			if(ptr && p >= ptr)
+				return 0;
+			if(!ptr)
+				*len = (size_t)(p - start) + 2;
+			ptr = p;
+			p = pkt + PTR_OFFSET(p[0], p[1]);
+			if(p >= ptr)
+				return 0;
+			ci = 1;
+			continue;
+		}
+		lablen = *p;
+		if(lablen != *d)
+			return 0;
+		if(lablen == 0)
+			break;
+		p++;
+		d++;
+		if(ci) {
+			while(lablen--) {
+				if(tolower((unsigned char)*p) !=
+					tolower((unsigned char)*d))
+					return 0;
+				p++;
+				d++;
+			}
+		} else {
+			if(memcmp(p, d, lablen) != 0)
+				return 0;
+			p += lablen;
+			d += lablen;
+		}
+	}
+	if(!ptr)
+		*len = (size_t)(p - start) + 1;
+	return 1;
+}
+
+/**
+ * Copy rdata with domain names into the precomputed wireformat.  The
+ * domain names are compared, they are compressed in the wireformat, the
+ * other fields are copied.
+ * @param pkt: start of the packet.
+ * @param p: the rdata length in the packet, followed by the rdata.
+ * @param rdata: the rdata of the RR, with the rdata length.
+ * @param todolen: length of rdata.
+ * @param desc: the descriptor of the type.
+ * @return false if the rdata does not fit the wireformat.
+ */
+static int
+wire_rdata_copy(uint8_t* pkt, uint8_t* p, uint8_t* rdata, size_t todolen,
+	const sldns_rr_descriptor* desc)
+{
+	int rdf = 0;
+	size_t dname_len, len, plen;
+	uint8_t* end = p + 2 + sldns_read_uint16(p);
+	uint8_t count = desc->_dname_count;
+
+	p += 2;
+	rdata += 2;
+	todolen -= 2;
+	while(todolen > 0 && count) {
+		switch(desc->_wireformat[rdf]) {
+		case LDNS_RDF_TYPE_DNAME:
+			(void)dname_count_size_labels(rdata, &dname_len);
+			if(dname_len > todolen || p >= end ||
+				!wire_dname_equal(pkt, p, rdata, &plen))
+				return 0;
+			p += plen;
+			rdata += dname_len;
+			todolen -= dname_len;
+			count--;
+			len = 0;
+			break;
+		case LDNS_RDF_TYPE_STR:
+			len = *rdata + 1;
+			break;
+		default:
+			len = get_rdf_size(desc->_wireformat[rdf]);
+		}
+		if(len) {
+			if(len > todolen || (size_t)(end - p) < len)
+				return 0;
+			memcpy(p, rdata, len);
+			todolen -= len;
+			rdata += len;
+			p += len;
+		}
+		rdf++;
+	}
+	if(p > end || (size_t)(end - p) != todolen)
+		return 0;
+	memcpy(p, rdata, todolen);
+	return 1;
+}
+
+/**
+ * Encode the reply with its precomputed wireformat.
+ * @param qinfo: the query.
+ * @param rep: the reply, with the wireformat, and the rrsets locked.
+ * @param id: id value, network order.
+ * @param flags: flags value, host order.
+ * @param buffer: buffer to store the packet into.
+ * @param timenow: time now, to adjust the TTLs.
+ * @param udpsize: size of the answer.
+ * @param dnssec: if 0 DNSSEC records are omitted.
+ * @param minimal: if the authority and additional sections are left out.
+ * @return false if the wireformat cannot be used, and the reply has to
+ *	be encoded with the compression tree.
+ */
+static int
+reply_wire_encode(struct query_info* qinfo, struct reply_info* rep,
+	uint16_t id, uint16_t flags, sldns_buffer* buffer, time_t timenow,
+	uint16_t udpsize, int dnssec, int minimal)
+{
+	struct reply_wire* w;
+	struct reply_wire_rr* rr;
+	struct ub_packed_rrset_key* k;
+	struct packed_rrset_data* d;
+	size_t i, num, len, start;
+	uint8_t* p;
+
+	for(w = rep->wire; w; w = w->next)
+		if(w->both || w->dnssec == dnssec)
+			break;
+	if(!w || w->qtype != qinfo->qtype || w->qname_len != qinfo->qname_len
+		|| w->num_sets != rep->rrset_count
+		|| (RRSET_ROUNDROBIN && w->multi))
+		return 0;
+	for(i=0; i<w->num_sets; i++) {
+		d = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
+		if(d->count != w->counts[i*2] ||
+			d->rrsig_count != w->counts[i*2+1])
+			return 0;
+	}
+	len = minimal?w->an_len:w->len;
+	num = minimal?w->an_rrs:w->num_rrs;
+
+	sldns_buffer_clear(buffer);
+	if(udpsize < sldns_buffer_limit(buffer))
+		sldns_buffer_set_limit(buffer, udpsize);
+	start = LDNS_HEADER_SIZE + qinfo->qname_len + 4;
+	if(sldns_buffer_remaining(buffer) < start + len)
+		return 0;
+	sldns_buffer_write(buffer, &id, sizeof(uint16_t));
+	sldns_buffer_write_u16(buffer, flags);
+	sldns_buffer_write_u16(buffer, rep->qdcount);
+	sldns_buffer_write_u16(buffer, w->ancount);
+	sldns_buffer_write_u16(buffer, minimal?0:w->nscount);
+	sldns_buffer_write_u16(buffer, minimal?0:w->arcount);
+	if(sldns_buffer_current(buffer) == qinfo->qname)
+		sldns_buffer_skip(buffer, (ssize_t)qinfo->qname_len);
+	else	sldns_buffer_write(buffer, qinfo->qname, qinfo->qname_len);
+	sldns_buffer_write_u16(buffer, qinfo->qtype);
+	sldns_buffer_write_u16(buffer, qinfo->qclass);
+	sldns_buffer_write(buffer, w->data, len);
+
+	/* copy the TTLs and the rdata of the rrsets */
+	for(i=0; i<num; i++) {
+		rr = &w->rrs[i];
+		k = rep->rrsets[rr->rrset];
+		d = (struct packed_rrset_data*)k->entry.data;
+		p = sldns_buffer_at(buffer, start + rr->pos);
+		if(d->rr_ttl[rr->rr] < timenow)
+			sldns_write_uint32(p, 0);
+		else	sldns_write_uint32(p, d->rr_ttl[rr->rr]-timenow);
+		p += 4;
+		if(rr->compress) {
+			if(!wire_rdata_copy(sldns_buffer_begin(buffer), p,
+				d->rr_data[rr->rr], d->rr_len[rr->rr],
+				type_rdata_compressable(k)))
+				return 0;
+		} else {
+			if((size_t)sldns_read_uint16(p)+2 != d->rr_len[rr->rr])
+				return 0;
+			memcpy(p+2, d->rr_data[rr->rr]+2, d->rr_len[rr->rr]-2);
+		}
+	}
+	sldns_buffer_flip(buffer);
+	return 1;
+}
+
+int 
+reply_info_encode(struct query_info* qinfo, struct reply_info* rep, 
+	uint16_t id, uint16_t flags, sldns_buffer* buffer, time_t timenow, 
+	struct regional* region, uint16_t udpsize, int dnssec)
+{
+	/* if response is positive answer, auth/add sections are not required */
+	int minimal = MINIMAL_RESPONSES && positive_answer(rep, qinfo->qtype);
+	if(rep->wire && rep->qdcount && !qinfo->local_alias &&
+		reply_wire_encode(qinfo, rep, id, flags, buffer, timenow,
+		udpsize, dnssec, minimal))
+		return 1;
+	return reply_encode_tree(qinfo, rep, id, flags, buffer, timenow,
+		region, udpsize, dnssec, minimal);
+}
+
+/** add RRs of an rrset to the list of RRs of the wireformat */
+static void
+wire_list_add(struct reply_wire_rr* rrs, size_t* n, size_t rrset,
+	size_t from, size_t to)
+{
+	size_t j;
+	for(j=from; j<to; j++) {
+		if(rrs) {
+			rrs[*n].rrset = (uint16_t)rrset;
+			rrs[*n].rr = (uint16_t)j;
+		}
+		(*n)++;
+	}
+}
+
+/**
+ * List the RRs of the reply in the order that the encoder writes them.
+ * @param rep: the reply.
+ * @param qtype: the query type.
+ * @param dnssec: if DNSSEC records are included.
+ * @param rrs: the list is stored here, if NULL the RRs are counted.
+ * @return number of RRs.
+ */
+static size_t
+wire_list(struct reply_info* rep, uint16_t qtype, int dnssec,
+	struct reply_wire_rr* rrs)
+{
+	size_t n = 0, i, num, before = 0;
+	int s, sec;
+	struct packed_rrset_data* d;
+	for(s = LDNS_SECTION_ANSWER; s <= LDNS_SECTION_ADDITIONAL; s++) {
+		if(s == LDNS_SECTION_ANSWER)
+			num = rep->an_numrrsets;
+		else if(s == LDNS_SECTION_AUTHORITY)
+			num = rep->ns_numrrsets;
+		else	num = rep->ar_numrrsets;
+		sec = dnssec || (s == LDNS_SECTION_ANSWER &&
+			qtype == LDNS_RR_TYPE_ANY);
+		for(i=before; i<before+num; i++) {
+			if(!rrset_belongs_in_reply((sldns_pkt_section)s,
+				ntohs(rep->rrsets[i]->rk.type), qtype, sec))
+				continue;
+			d = (struct packed_rrset_data*)rep->rrsets[i]->
+				entry.data;
+			wire_list_add(rrs, &n, i, 0, d->count);
+			if(sec && s != LDNS_SECTION_ADDITIONAL)
+				wire_list_add(rrs, &n, i, d->count,
+					d->count + d->rrsig_count);
+		}
+		if(sec && s == LDNS_SECTION_ADDITIONAL) {
+			for(i=before; i<before+num; i++) {
+				d = (struct packed_rrset_data*)rep->rrsets[i]->
+					entry.data;
+				wire_list_add(rrs, &n, i, d->count,
+					d->count + d->rrsig_count);
+			}
+		}
+		before += num;
+	}
+	return n;
+}
+
+/** make the wireformat of the reply for a value of the DO bit, in the
+ * buffer, return malloced wireformat or NULL */
+static struct reply_wire*
+reply_wire_make(struct query_info* qinfo, struct reply_info* rep,
+	sldns_buffer* buf, struct regional* region, int dnssec)
+{
+	struct reply_wire* w;
+	struct reply_wire_rr* rr;
+	struct ub_packed_rrset_key* k;
+	struct packed_rrset_data* d;
+	size_t i, num, len, start = LDNS_HEADER_SIZE + qinfo->qname_len + 4;
+	uint8_t *body, *p, *end;
+	uint16_t ancount;
+
+	if(!reply_encode_tree(qinfo, rep, 0, rep->flags, buf, 0, region,
+		(uint16_t)sldns_buffer_capacity(buf), dnssec, 0))
+		return NULL;
+	if(LDNS_TC_WIRE(sldns_buffer_begin(buf)) ||
+		sldns_buffer_limit(buf) < start)
+		return NULL;
+	ancount = LDNS_ANCOUNT(sldns_buffer_begin(buf));
+	num = (size_t)ancount + LDNS_NSCOUNT(sldns_buffer_begin(buf)) +
+		LDNS_ARCOUNT(sldns_buffer_begin(buf));
+	/* if the additional section did not fit, RRs are missing */
+	if(num != wire_list(rep, qinfo->qtype, dnssec, NULL))
+		return NULL;
+	len = sldns_buffer_limit(buf) - start;
+	w = (struct reply_wire*)malloc(sizeof(*w) + num*sizeof(*rr) +
+		rep->rrset_count*2*sizeof(uint32_t) + len);
+	if(!w)
+		return NULL;
+	memset(w, 0, sizeof(*w));
+	w->dnssec = dnssec;
+	w->qtype = qinfo->qtype;
+	w->qname_len = qinfo->qname_len;
+	w->ancount = ancount;
+	w->nscount = LDNS_NSCOUNT(sldns_buffer_begin(buf));
+	w->arcount = LDNS_ARCOUNT(sldns_buffer_begin(buf));
+	w->an_rrs = ancount;
+	w->len = len;
+	w->num_rrs = num;
+	w->rrs = (struct reply_wire_rr*)((uint8_t*)w + sizeof(*w));
+	w->num_sets = rep->rrset_count;
+	w->counts = (uint32_t*)((uint8_t*)w->rrs + num*sizeof(*rr));
+	w->data = (uint8_t*)w->counts + rep->rrset_count*2*sizeof(uint32_t);
+	body = sldns_buffer_at(buf, start);
+	memcpy(w->data, body, len);
+	for(i=0; i<rep->rrset_count; i++) {
+		d = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
+		w->counts[i*2] = d->count;
+		w->counts[i*2+1] = d->rrsig_count;
+		if(d->count > 1)
+			w->multi = 1;
+	}
+	(void)wire_list(rep, qinfo->qtype, dnssec, w->rrs);
+
+	/* find the TTL of every RR in the wireformat */
+	p = body;
+	end = body + len;
+	for(i=0; i<num; i++) {
+		rr = &w->rrs[i];
+		k = rep->rrsets[rr->rrset];
+		d = (struct packed_rrset_data*)k->entry.data;
+		while(p < end && *p && !LABEL_IS_PTR(*p))
+			p += *p + 1;
+		if(p >= end)
+			break;
+		p += (*p)?2:1;
+		if(end - p < 10)
+			break;
+		if(rr->rr < d->count) {
+			if(memcmp(p, &k->rk.type, 2) != 0)
+				break;
+			rr->compress = (type_rdata_compressable(k) != NULL);
+		} else if(sldns_read_uint16(p) != LDNS_RR_TYPE_RRSIG)
+			break;
+		/* the TTL is after the type and class */
+		rr->pos = (uint16_t)(p + 4 - body);
+		p += 10 + sldns_read_uint16(p + 8);
+		if(i+1 == ancount)
+			w->an_len = (size_t)(p - body);
+	}
+	if(i != num || p != end) {
+		free(w);
+		return NULL;
+	}
+	return w;
+}
+
+struct reply_wire*
+reply_wire_create(struct query_info* qinfo, struct reply_info* rep,
+	struct regional* region)
+{
+	struct reply_wire* w, *w2;
+	struct packed_rrset_data* d;
+	sldns_buffer buf;
+	uint8_t* data;
+	size_t i;
+
+	if(!rep->qdcount || qinfo->local_alias || rep->rrset_count >= 0xffff)
+		return NULL;
+	for(i=0; i<rep->rrset_count; i++) {
+		d = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
+		if((rep->rrsets[i]->rk.flags & PACKED_RRSET_FIXEDTTL) ||
+			(size_t)d->count + d->rrsig_count > 0xffff)
+			return NULL;
+	}
+	if(!(data = regional_alloc(region, REPLY_WIRE_MAX)))
+		return NULL;
+	sldns_buffer_init_frm_data(&buf, data, REPLY_WIRE_MAX);
+	if(!(w = reply_wire_make(qinfo, rep, &buf, region, 0)))
+		return NULL;
+	if(!(w2 = reply_wire_make(qinfo, rep, &buf, region, 1))) {
+		free(w);
+		return NULL;
+	}
+	/* the RRs with the DO bit are a superset, in the same order */
+	if(w->num_rrs == w2->num_rrs) {
+		w->both = 1;
+		free(w2);
+	} else	w->next = w2;
+	return w;
+}
+
 uint16_t
 calc_edns_field_size(struct edns_data* edns)
 {
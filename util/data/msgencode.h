@@ -47,6 +47,7 @@ struct query_info;
 struct reply_info;
 struct regional;
 struct edns_data;
+struct reply_wire;
 
 /** 
  * Generate answer from reply_info.
@@ -92,6 +93,19 @@ int reply_info_encode(struct query_info* qinfo, struct reply_info* rep,
 	uint16_t id, uint16_t flags, struct sldns_buffer* buffer, time_t timenow, 
 	struct regional* region, uint16_t udpsize, int dnssec);
 
+/**
+ * Make the precomputed wireformat of a reply that is stored in the
+ * message cache, so that it is encoded faster.  The rrsets of the reply
+ * must be locked.
+ * @param qinfo: the query of the reply.
+ * @param rep: the reply, its rrsets point to the cached rrsets.
+ * @param region: to store temporary data in.
+ * @return malloced wireformat, to set in rep->wire, or NULL if the reply
+ *	cannot use it, or on alloc failure.
+ */
+struct reply_wire* reply_wire_create(struct query_info* qinfo,
+	struct reply_info* rep, struct regional* region);
+
 /**
  * Encode query packet. Assumes the buffer is large enough.
  * @param pkt: where to store the packet.
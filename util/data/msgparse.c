@@ -173,16 +173,50 @@ pkt_hash_rrset(sldns_buffer* pkt, uint8_t* dname, uint16_t type,
 	return h;
 }
 
-/** create partial dname hash for rrset hash */
-static hashvalue_type
-pkt_hash_rrset_first(sldns_buffer* pkt, uint8_t* dname)
+/**
+ * Check the owner name at the current position, and create the partial
+ * dname hash for the rrset hash.  The names are stored by position, and
+ * an owner name that is a compression pointer to a name that has been
+ * checked is not walked again.
+ * @param msg: the parse, with the owner names.
+ * @param pkt: packet, at the owner name. At exit after the name.
+ * @param dnamelen: returns the uncompressed length of the name.
+ * @param dname_h: returns the partial dname hash.
+ * @return false on parse error.
+ */
+static int
+pkt_hash_rrset_first(struct msg_parse* msg, sldns_buffer* pkt,
+	size_t* dnamelen, hashvalue_type* dname_h)
 {
 	/* works together with pkt_hash_rrset_rest */
 	/* note this MUST be identical to rrset_key_hash in packed_rrset.c */
 	/* this routine handles compressed names */
-	hashvalue_type h = 0xab;
-	h = dname_pkt_hash(pkt, dname, h);
-	return h;
+	uint8_t* dname = sldns_buffer_current(pkt);
+	uint16_t pos = (uint16_t)sldns_buffer_position(pkt);
+	struct parse_name* n;
+	int ptrs;
+	if(sldns_buffer_remaining(pkt) >= 2 && LABEL_IS_PTR(dname[0])) {
+		pos = PTR_OFFSET(dname[0], dname[1]);
+		n = &msg->names[pos & (PARSE_NAME_SIZE-1)];
+		/* the name has been checked, with one pointer less */
+		if(n->pos == pos && pos != 0 && n->ptrs <= MAX_COMPRESS_PTRS) {
+			sldns_buffer_skip(pkt, 2);
+			*dnamelen = n->len;
+			*dname_h = n->hash;
+			return 1;
+		}
+	}
+	*dname_h = 0xab;
+	if((*dnamelen = pkt_dname_len_hash(pkt, dname_h, &ptrs)) == 0)
+		return 0;
+	if(LABEL_IS_PTR(dname[0]))
+		ptrs--;
+	n = &msg->names[pos & (PARSE_NAME_SIZE-1)];
+	n->pos = pos;
+	n->ptrs = (uint16_t)ptrs;
+	n->len = *dnamelen;
+	n->hash = *dname_h;
+	return 1;
 }
 
 /** create a rrset hash from a partial dname hash */
@@ -439,6 +473,7 @@ change_rrsig_rrset(struct rrset_parse* sigset, struct msg_parse* msg,
  * @param pkt: the packet in wireformat (needed for compression ptrs).
  * @param dname: pointer to start of dname (compressed) in packet.
  * @param dnamelen: uncompressed wirefmt length of dname.
+ * @param dname_h: partial dname hash, from pkt_hash_rrset_first.
  * @param type: type of current rr.
  * @param dclass: class of current rr.
  * @param hash: hash value is returned if the rrset could not be found.
@@ -455,14 +490,13 @@ change_rrsig_rrset(struct rrset_parse* sigset, struct msg_parse* msg,
  */
 static int
 find_rrset(struct msg_parse* msg, sldns_buffer* pkt, uint8_t* dname, 
-	size_t dnamelen, uint16_t type, uint16_t dclass, hashvalue_type* hash, 
-	uint32_t* rrset_flags,
+	size_t dnamelen, hashvalue_type dname_h, uint16_t type, uint16_t dclass,
+	hashvalue_type* hash, uint32_t* rrset_flags,
 	uint8_t** prev_dname_first, uint8_t** prev_dname_last,
 	size_t* prev_dnamelen, uint16_t* prev_type,
 	uint16_t* prev_dclass, struct rrset_parse** rrset_prev,
 	sldns_pkt_section section, struct regional* region)
 {
-	hashvalue_type dname_h = pkt_hash_rrset_first(pkt, dname);
 	uint16_t covtype;
 	if(*rrset_prev) {
 		/* check if equal to previous item */
@@ -824,7 +858,7 @@ parse_section(sldns_buffer* pkt, struct msg_parse* msg,
 	uint16_t type, prev_type = 0;
 	uint16_t dclass, prev_dclass = 0;
 	uint32_t rrset_flags = 0;
-	hashvalue_type hash = 0;
+	hashvalue_type hash = 0, dname_h;
 	struct rrset_parse* rrset = NULL;
 	int r;
 
@@ -835,7 +869,7 @@ parse_section(sldns_buffer* pkt, struct msg_parse* msg,
 	for(i=0; i<num_rrs; i++) {
 		/* parse this RR. */
 		dname = sldns_buffer_current(pkt);
-		if((dnamelen = pkt_dname_len(pkt)) == 0)
+		if(!pkt_hash_rrset_first(msg, pkt, &dnamelen, &dname_h))
 			return LDNS_RCODE_FORMERR;
 		if(sldns_buffer_remaining(pkt) < 10) /* type, class, ttl, len */
 			return LDNS_RCODE_FORMERR;
@@ -869,8 +903,8 @@ parse_section(sldns_buffer* pkt, struct msg_parse* msg,
 		}
 
 		/* see if it is part of an existing RR set */
-		if(!find_rrset(msg, pkt, dname, dnamelen, type, dclass, &hash, 
-			&rrset_flags, &prev_dname_f, &prev_dname_l, 
+		if(!find_rrset(msg, pkt, dname, dnamelen, dname_h, type,
+			dclass, &hash, &rrset_flags, &prev_dname_f, &prev_dname_l, 
 			&prev_dnamelen, &prev_type, &prev_dclass, &rrset, 
 			section, region))
 			return LDNS_RCODE_SERVFAIL;
@@ -911,6 +945,7 @@ parse_packet(sldns_buffer* pkt, struct msg_parse* msg, struct regional* region)
 	msg->ancount = sldns_buffer_read_u16(pkt);
 	msg->nscount = sldns_buffer_read_u16(pkt);
 	msg->arcount = sldns_buffer_read_u16(pkt);
+	memset(msg->names, 0, sizeof(msg->names));
 	if(msg->qdcount > 1)
 		return LDNS_RCODE_FORMERR;
 	if((ret = parse_query_section(pkt, msg)) != 0)
@@ -1073,6 +1108,80 @@ parse_edns_from_pkt(sldns_buffer* pkt, struct edns_data* edns,
 	return 0;
 }
 
+int
+parse_query_fast(sldns_buffer* pkt, struct query_info* qinfo,
+	struct edns_data* edns, hashvalue_type* h, struct regional* region)
+{
+	uint8_t* p = sldns_buffer_begin(pkt);
+	size_t len = sldns_buffer_limit(pkt);
+	size_t pos = LDNS_HEADER_SIZE, qname_len = 0;
+	uint8_t labellen;
+	uint16_t rdata_len;
+	/* a query with one question, and perhaps the OPT record */
+	if(len < LDNS_HEADER_SIZE + 5 || sldns_buffer_position(pkt) != 0 ||
+		LDNS_QR_WIRE(p) || LDNS_TC_WIRE(p) ||
+		LDNS_OPCODE_WIRE(p) != LDNS_PACKET_QUERY ||
+		LDNS_QDCOUNT(p) != 1 || LDNS_ANCOUNT(p) != 0 ||
+		LDNS_NSCOUNT(p) != 0 || LDNS_ARCOUNT(p) > 1)
+		return 0;
+	/* the query name, no compression allowed, only the label lengths
+	 * are read here, the hash reads the labels */
+	do {
+		if(pos >= len)
+			return 0;
+		labellen = p[pos];
+		if(labellen&0xc0)
+			return 0;
+		qname_len += labellen + 1;
+		if(qname_len > LDNS_MAX_DOMAINLEN)
+			return 0;
+		pos += labellen + 1;
+	} while(labellen != 0);
+	if(pos + 4 > len)
+		return 0;
+	qinfo->qname = p + LDNS_HEADER_SIZE;
+	qinfo->qname_len = qname_len;
+	qinfo->qtype = sldns_read_uint16(p + pos);
+	qinfo->qclass = sldns_read_uint16(p + pos + 2);
+	qinfo->local_alias = NULL;
+	pos += 4;
+	/* the general parse gives the errors for these */
+	if(qinfo->qtype == LDNS_RR_TYPE_AXFR ||
+		qinfo->qtype == LDNS_RR_TYPE_IXFR ||
+		qinfo->qtype == LDNS_RR_TYPE_OPT ||
+		qinfo->qtype == LDNS_RR_TYPE_TSIG ||
+		qinfo->qtype == LDNS_RR_TYPE_TKEY ||
+		qinfo->qtype == LDNS_RR_TYPE_MAILA ||
+		qinfo->qtype == LDNS_RR_TYPE_MAILB ||
+		(qinfo->qtype >= 128 && qinfo->qtype <= 248))
+		return 0;
+	if(LDNS_ARCOUNT(p) == 0) {
+		memset(edns, 0, sizeof(*edns));
+		edns->udp_size = 512;
+	} else {
+		/* root owner name, type OPT, class, ttl, rdatalen */
+		if(pos + 11 > len || p[pos] != 0 ||
+			sldns_read_uint16(p + pos + 1) != LDNS_RR_TYPE_OPT)
+			return 0;
+		rdata_len = sldns_read_uint16(p + pos + 9);
+		if(pos + 11 + rdata_len > len)
+			return 0;
+		edns->edns_present = 1;
+		edns->udp_size = sldns_read_uint16(p + pos + 3);
+		edns->ext_rcode = p[pos + 5];
+		edns->edns_version = p[pos + 6];
+		edns->bits = sldns_read_uint16(p + pos + 7);
+		edns->opt_list = NULL;
+		pos += 11;
+		if(!parse_edns_options(p + pos, rdata_len, edns, region))
+			return 0;
+	}
+	/* the position is where parse_edns_from_pkt leaves it */
+	sldns_buffer_set_position(pkt, pos);
+	*h = query_info_hash(qinfo, sldns_read_uint16(p + 2));
+	return 1;
+}
+
 void
 log_edns_opt_list(enum verbosity_value level, const char* info_str,
 	struct edns_option* list)
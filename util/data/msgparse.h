@@ -70,9 +70,12 @@ struct rrset_parse;
 struct rr_parse;
 struct regional;
 struct edns_option;
+struct query_info;
 
 /** number of buckets in parse rrset hash table. Must be power of 2. */
 #define PARSE_TABLE_SIZE 32
+/** number of entries in the owner name cache of the parse. Power of 2. */
+#define PARSE_NAME_SIZE 32
 /** Maximum TTL that is allowed. */
 extern time_t MAX_TTL;
 /** Minimum TTL that is allowed. */
@@ -82,6 +85,23 @@ extern time_t MAX_NEG_TTL;
 /** Negative cache time (for entries without any RRs.) */
 #define NORR_TTL 5 /* seconds */
 
+/**
+ * Owner name that has been checked and hashed during parsing.  Stored by
+ * the position of the name in the packet, where compression pointers
+ * of later owner names point to, so that the name is checked and hashed
+ * once.
+ */
+struct parse_name {
+	/** position of the name in the packet, 0 if the entry is empty */
+	uint16_t pos;
+	/** number of compression pointers followed for the name */
+	uint16_t ptrs;
+	/** uncompressed length of the name */
+	size_t len;
+	/** hash of the name, as pkt_hash_rrset starts with */
+	hashvalue_type hash;
+};
+
 /**
  * Data stored in scratch pad memory during parsing.
  * Stores the data that will enter into the msgreply and packet result.
@@ -122,6 +142,9 @@ struct msg_parse {
 	 * Based on name, type, class.  Same hash value as in rrset cache.
 	 */
 	struct rrset_parse* hashtable[PARSE_TABLE_SIZE];
+
+	/** owner names that have been hashed, by position in the packet */
+	struct parse_name names[PARSE_NAME_SIZE];
 	
 	/** linked list of rrsets that have been found (in order). */
 	struct rrset_parse* rrset_first;
@@ -287,6 +310,26 @@ int parse_extract_edns(struct msg_parse* msg, struct edns_data* edns,
 int parse_edns_from_pkt(struct sldns_buffer* pkt, struct edns_data* edns,
 	struct regional* region);
 
+/**
+ * Parse a query with one question and no other records than perhaps an
+ * OPT record, in one pass over the packet.  It checks the header like
+ * worker_check_request, gets the query like query_info_parse and the
+ * EDNS data like parse_edns_from_pkt, and hashes the query for the
+ * message cache.  Other packets, and meta query types, are left for the
+ * general parse, that also gives the errors.
+ * @param pkt: the packet, position at start must be 0.  At end, like
+ *	parse_edns_from_pkt, or no movement if it fails.
+ * @param qinfo: the query info is returned, qname points in the packet.
+ * @param edns: the edns data is returned.
+ * @param h: the hash of the query for the message cache is returned, as
+ *	query_info_hash with the query flags.
+ * @param region: region to alloc results in (edns option contents)
+ * @return: 0 if the packet is not of this form, or on alloc failure,
+ *	then the general parse must be used.  1 on success.
+ */
+int parse_query_fast(struct sldns_buffer* pkt, struct query_info* qinfo,
+	struct edns_data* edns, hashvalue_type* h, struct regional* region);
+
 /**
  * Calculate hash value for rrset in packet.
  * @param pkt: the packet.
@@ -109,6 +109,7 @@ construct_reply_info_base(struct regional* region, uint16_t flags, size_t qd,
 	rep->rrset_count = total;
 	rep->security = sec;
 	rep->authoritative = 0;
+	rep->wire = NULL;
 	/* array starts after the refs */
 	if(region)
 		rep->rrsets = (struct ub_packed_rrset_key**)&(rep->ref[0]);
@@ -300,7 +301,8 @@ parse_rr_copy(sldns_buffer* pkt, struct rrset_parse* pset,
 /** create rrset return 0 on failure */
 static int
 parse_create_rrset(sldns_buffer* pkt, struct rrset_parse* pset,
-	struct packed_rrset_data** data, struct regional* region)
+	struct packed_rrset_data** data, struct alloc_cache* alloc,
+	struct regional* region)
 {
 	/* allocate */
 	size_t s;
@@ -313,14 +315,16 @@ parse_create_rrset(sldns_buffer* pkt, struct rrset_parse* pset,
 		pset->size;
 	if(region)
 		*data = regional_alloc(region, s);
-	else	*data = malloc(s);
+	else	*data = alloc_data_obtain(alloc, s);
 	if(!*data)
 		return 0;
 	/* copy & decompress */
 	if(!parse_rr_copy(pkt, pset, *data)) {
-		if(!region) free(*data);
+		if(!region) alloc_data_release(alloc, *data, s);
 		return 0;
 	}
+	/* the data is released with its packed size */
+	log_assert(region || packed_rrset_sizeof(*data) == s);
 	return 1;
 }
 
@@ -364,8 +368,8 @@ get_rrset_trust(struct msg_parse* msg, struct rrset_parse* rrset)
 
 int
 parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
-	struct rrset_parse *pset, struct regional* region, 
-	struct ub_packed_rrset_key* pk)
+	struct rrset_parse *pset, struct alloc_cache* alloc,
+	struct regional* region, struct ub_packed_rrset_key* pk)
 {
 	struct packed_rrset_data* data;
 	pk->rk.flags = pset->flags;
@@ -374,7 +378,7 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 		pk->rk.dname = (uint8_t*)regional_alloc(
 			region, pset->dname_len);
 	else	pk->rk.dname = 
-			(uint8_t*)malloc(pset->dname_len);
+			(uint8_t*)alloc_data_obtain(alloc, pset->dname_len);
 	if(!pk->rk.dname)
 		return 0;
 	/** copy & decompress dname */
@@ -383,7 +387,7 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
 	pk->rk.type = htons(pset->type);
 	pk->rk.rrset_class = pset->rrset_class;
 	/** read data part. */
-	if(!parse_create_rrset(pkt, pset, &data, region))
+	if(!parse_create_rrset(pkt, pset, &data, alloc, region))
 		return 0;
 	pk->entry.data = (void*)data;
 	pk->entry.key = (void*)pk;
@@ -397,12 +401,14 @@ parse_copy_decompress_rrset(sldns_buffer* pkt, struct msg_parse* msg,
  * @param pkt: the packet for compression pointer resolution.
  * @param msg: the parsed message
  * @param rep: reply info to put rrs into.
+ * @param alloc: used for allocation if region is NULL.
  * @param region: if not NULL, used for allocation.
  * @return 0 on failure.
  */
 static int
 parse_copy_decompress(sldns_buffer* pkt, struct msg_parse* msg,
-	struct reply_info* rep, struct regional* region)
+	struct reply_info* rep, struct alloc_cache* alloc,
+	struct regional* region)
 {
 	size_t i;
 	struct rrset_parse *pset = msg->rrset_first;
@@ -414,8 +420,8 @@ parse_copy_decompress(sldns_buffer* pkt, struct msg_parse* msg,
 		rep->ttl = NORR_TTL;
 
 	for(i=0; i<rep->rrset_count; i++) {
-		if(!parse_copy_decompress_rrset(pkt, msg, pset, region,
-			rep->rrsets[i]))
+		if(!parse_copy_decompress_rrset(pkt, msg, pset, alloc,
+			region, rep->rrsets[i]))
 			return 0;
 		data = (struct packed_rrset_data*)rep->rrsets[i]->entry.data;
 		if(data->ttl < rep->ttl)
@@ -439,7 +445,7 @@ parse_create_msg(sldns_buffer* pkt, struct msg_parse* msg,
 		return 0;
 	if(!reply_info_alloc_rrset_keys(*rep, alloc, region))
 		return 0;
-	if(!parse_copy_decompress(pkt, msg, *rep, region))
+	if(!parse_copy_decompress(pkt, msg, *rep, alloc, region))
 		return 0;
 	return 1;
 }
@@ -588,6 +594,7 @@ msgreply_sizefunc(void* k, void* d)
 		- sizeof(struct rrset_ref);
 	s += r->rrset_count * sizeof(struct rrset_ref);
 	s += r->rrset_count * sizeof(struct ub_packed_rrset_key*);
+	s += reply_wire_get_mem(r->wire);
 	return s;
 }
 
@@ -604,9 +611,32 @@ void
 reply_info_delete(void* d, void* ATTR_UNUSED(arg))
 {
 	struct reply_info* r = (struct reply_info*)d;
+	reply_wire_delete(r->wire);
 	free(r);
 }
 
+void
+reply_wire_delete(struct reply_wire* wire)
+{
+	struct reply_wire* n;
+	while(wire) {
+		n = wire->next;
+		free(wire);
+		wire = n;
+	}
+}
+
+size_t
+reply_wire_get_mem(struct reply_wire* wire)
+{
+	size_t s = 0;
+	for(; wire; wire = wire->next) {
+		s += sizeof(*wire) + wire->num_rrs*sizeof(struct reply_wire_rr)
+			+ wire->num_sets*2*sizeof(uint32_t) + wire->len;
+	}
+	return s;
+}
+
 hashvalue_type
 query_info_hash(struct query_info *q, uint16_t flags)
 {
@@ -647,7 +677,7 @@ query_info_entrysetup(struct query_info* q, struct reply_info* r,
 /** copy rrsets from replyinfo to dest replyinfo */
 static int
 repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from, 
-	struct regional* region)
+	struct alloc_cache* alloc, struct regional* region)
 {
 	size_t i, s;
 	struct packed_rrset_data* fd, *dd;
@@ -663,15 +693,16 @@ repinfo_copy_rrsets(struct reply_info* dest, struct reply_info* from,
 			dk->rk.dname = (uint8_t*)regional_alloc_init(region,
 				fk->rk.dname, fk->rk.dname_len);
 		} else	
-			dk->rk.dname = (uint8_t*)memdup(fk->rk.dname, 
-				fk->rk.dname_len);
+			dk->rk.dname = (uint8_t*)alloc_data_dup(alloc,
+				fk->rk.dname, fk->rk.dname_len);
 		if(!dk->rk.dname)
 			return 0;
 		s = packed_rrset_sizeof(fd);
 		if(region)
 			dd = (struct packed_rrset_data*)regional_alloc_init(
 				region, fd, s);
-		else	dd = (struct packed_rrset_data*)memdup(fd, s);
+		else	dd = (struct packed_rrset_data*)alloc_data_dup(alloc,
+				fd, s);
 		if(!dd) 
 			return 0;
 		packed_rrset_ptr_fixup(dd);
@@ -697,7 +728,7 @@ reply_info_copy(struct reply_info* rep, struct alloc_cache* alloc,
 			reply_info_parsedelete(cp, alloc);
 		return NULL;
 	}
-	if(!repinfo_copy_rrsets(cp, rep, region)) {
+	if(!repinfo_copy_rrsets(cp, rep, alloc, region)) {
 		if(!region)
 			reply_info_parsedelete(cp, alloc);
 		return NULL;
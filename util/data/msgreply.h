@@ -108,6 +108,66 @@ struct rrset_ref {
 	rrset_id_type id;
 };
 
+/**
+ * An RR in the precomputed wireformat of a reply.
+ */
+struct reply_wire_rr {
+	/** offset of the TTL of the RR in the wireformat, the type and
+	 * class are before it, the rdata length and rdata after it */
+	uint16_t pos;
+	/** index of the rrset in the reply_info */
+	uint16_t rrset;
+	/** index of the RR in the rrset data, RRSIGs after the RRs */
+	uint16_t rr;
+	/** if the rdata has domain names that are compressed */
+	uint16_t compress;
+};
+
+/**
+ * The precomputed wireformat of the sections after the query section, of
+ * a reply in the message cache, with the owner names and the domain names
+ * in the rdata compressed.  It is made when the reply is stored, and it is
+ * read only after that.  To encode the reply, the header and the query are
+ * written, the sections are copied, and the TTLs and rdata are copied
+ * over from the rrsets, that are locked.  The rdata of the rrsets can
+ * change when they are updated, if the length of the rdata, or a domain
+ * name in compressed rdata, changes, the wireformat cannot be used and
+ * the generic encoder is used.
+ */
+struct reply_wire {
+	/** next wireformat, of the reply for the other DO bit, or NULL */
+	struct reply_wire* next;
+	/** the DO bit that the wireformat is for */
+	int dnssec;
+	/** if the wireformat is the same for both values of the DO bit */
+	int both;
+	/** if an rrset has more than one RR, and round robin changes the
+	 * order of the RRs */
+	int multi;
+	/** qtype of the query */
+	uint16_t qtype;
+	/** length of the qname */
+	size_t qname_len;
+	/** number of RRs in the answer, authority and additional section */
+	uint16_t ancount, nscount, arcount;
+	/** length of the answer section, for minimal responses */
+	size_t an_len;
+	/** number of RRs in the answer section */
+	size_t an_rrs;
+	/** length of the wireformat */
+	size_t len;
+	/** number of RRs */
+	size_t num_rrs;
+	/** the RRs, in order */
+	struct reply_wire_rr* rrs;
+	/** number of rrsets */
+	size_t num_sets;
+	/** the RR count and RRSIG count of the rrsets, two per rrset */
+	uint32_t* counts;
+	/** the wireformat */
+	uint8_t* data;
+};
+
 /**
  * Structure to store DNS query and the reply packet.
  * To use it, copy over the flags from reply and modify using flags from
@@ -186,7 +246,13 @@ struct reply_info {
 	 */
 	struct ub_packed_rrset_key** rrsets;
 
-	/** 
+	/**
+	 * Precomputed wireformat of the reply, or NULL.  Only set for a
+	 * reply in the message cache, it is freed with the reply.
+	 */
+	struct reply_wire* wire;
+
+	/**
 	 * Packed array of ids (see counts) and pointers to packed_rrset_key.
 	 * The number equals ancount+nscount+arcount RRsets. 
 	 * These are sorted in ascending pointer, the locking order. So
@@ -332,6 +398,20 @@ void query_entry_delete(void *q, void* arg);
 /** delete reply_info data structure */
 void reply_info_delete(void* d, void* arg);
 
+/**
+ * Delete the precomputed wireformat of a reply.
+ * @param wire: the wireformat, and the one for the other DO bit.
+ *	If NULL nothing happens.
+ */
+void reply_wire_delete(struct reply_wire* wire);
+
+/**
+ * Get the memory used by the precomputed wireformat of a reply.
+ * @param wire: the wireformat, and the one for the other DO bit, or NULL.
+ * @return memory in bytes.
+ */
+size_t reply_wire_get_mem(struct reply_wire* wire);
+
 /** calculate hash value of query_info, lowercases the qname,
  * uses CD flag for AAAA qtype */
 hashvalue_type query_info_hash(struct query_info *q, uint16_t flags);
@@ -380,15 +460,17 @@ int reply_info_alloc_rrset_keys(struct reply_info* rep,
  * @param pkt: packet for decompression
  * @param msg: the parser message (for flags for trust).
  * @param pset: the parsed rrset to copy.
- * @param region: if NULL - malloc, else data is allocated in this region.
+ * @param alloc: if region is NULL, the data is allocated with this alloc,
+ *	from the cache storage slabs.
+ * @param region: if NULL - alloc, else data is allocated in this region.
  * @param pk: a freshly obtained rrsetkey structure. No dname is set yet,
  *	will be set on return.
  *	Note that TTL will still be relative on return.
  * @return false on alloc failure.
  */
 int parse_copy_decompress_rrset(struct sldns_buffer* pkt, struct msg_parse* msg,
-	struct rrset_parse *pset, struct regional* region, 
-	struct ub_packed_rrset_key* pk);
+	struct rrset_parse *pset, struct alloc_cache* alloc,
+	struct regional* region, struct ub_packed_rrset_key* pk);
 
 /**
  * Find final cname target in reply, the one matching qinfo. Follows CNAMEs.
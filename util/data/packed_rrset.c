@@ -57,9 +57,11 @@ ub_packed_rrset_parsedelete(struct ub_packed_rrset_key* pkey,
 {
 	if(!pkey)
 		return;
-	free(pkey->entry.data);
+	if(pkey->entry.data)
+		alloc_data_release(alloc, pkey->entry.data, packed_rrset_sizeof(
+			(struct packed_rrset_data*)pkey->entry.data));
 	pkey->entry.data = NULL;
-	free(pkey->rk.dname);
+	alloc_data_release(alloc, pkey->rk.dname, pkey->rk.dname_len);
 	pkey->rk.dname = NULL;
 	pkey->id = 0;
 	alloc_special_release(alloc, pkey);
@@ -70,8 +72,10 @@ ub_rrset_sizefunc(void* key, void* data)
 {
 	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
 	struct packed_rrset_data* d = (struct packed_rrset_data*)data;
-	size_t s = sizeof(struct ub_packed_rrset_key) + k->rk.dname_len;
-	s += packed_rrset_sizeof(d) + lock_get_mem(&k->entry.lock);
+	size_t s = sizeof(struct ub_packed_rrset_key) +
+		slab_obj_size(k->rk.dname_len);
+	s += slab_obj_size(packed_rrset_sizeof(d)) +
+		lock_get_mem(&k->entry.lock);
 	return s;
 }
 
@@ -129,16 +133,17 @@ ub_rrset_key_delete(void* key, void* userdata)
 	struct ub_packed_rrset_key* k = (struct ub_packed_rrset_key*)key;
 	struct alloc_cache* a = (struct alloc_cache*)userdata;
 	k->id = 0;
-	free(k->rk.dname);
+	alloc_data_release(a, k->rk.dname, k->rk.dname_len);
 	k->rk.dname = NULL;
 	alloc_special_release(a, k);
 }
 
 void 
-rrset_data_delete(void* data, void* ATTR_UNUSED(userdata))
+rrset_data_delete(void* data, void* userdata)
 {
 	struct packed_rrset_data* d = (struct packed_rrset_data*)data;
-	free(d);
+	struct alloc_cache* a = (struct alloc_cache*)userdata;
+	alloc_data_release(a, d, packed_rrset_sizeof(d));
 }
 
 int 
@@ -369,14 +374,16 @@ packed_rrset_copy_alloc(struct ub_packed_rrset_key* key,
 	fd = (struct packed_rrset_data*)key->entry.data;
 	dk->entry.hash = key->entry.hash;
 	dk->rk = key->rk;
-	dk->rk.dname = (uint8_t*)memdup(key->rk.dname, key->rk.dname_len);
+	dk->rk.dname = (uint8_t*)alloc_data_dup(alloc, key->rk.dname,
+		key->rk.dname_len);
 	if(!dk->rk.dname) {
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
-	dd = (struct packed_rrset_data*)memdup(fd, packed_rrset_sizeof(fd));
+	dd = (struct packed_rrset_data*)alloc_data_dup(alloc, fd,
+		packed_rrset_sizeof(fd));
 	if(!dd) {
-		free(dk->rk.dname);
+		alloc_data_release(alloc, dk->rk.dname, dk->rk.dname_len);
 		alloc_special_release(alloc, dk);
 		return NULL;
 	}
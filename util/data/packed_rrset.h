@@ -217,6 +217,11 @@ enum sec_status {
  *
  * RRSIGs are stored in the arrays after the regular rrs.
  *
+ * A one-RR rrset has the same layout, with arrays of one element.  There
+ * is no inline form without the arrays, the rr_len, rr_data and rr_ttl
+ * pointers are how all users index the RRs, and the key stays a separate
+ * allocation because it is reused by id after the data is deleted.
+ *
  * You need the packed_rrset_key to know dname, type, class of the
  * resource records in this RRset. (if signed the rrsig gives the type too).
  *
@@ -232,10 +237,12 @@ struct packed_rrset_data {
 	/** TTL (in seconds like time()) of the rrset.
 	 * Same for all RRs see rfc2181(5.2).  */
 	time_t ttl;
-	/** number of rrs. */
-	size_t count;
+	/** number of rrs. 32 bit, with rrsig_count, trust and security
+	 * it packs in 16 bytes, and the data of small rrsets fits in a
+	 * smaller size class of the slab allocator. */
+	uint32_t count;
 	/** number of rrsigs, if 0 no rrsigs */
-	size_t rrsig_count;
+	uint32_t rrsig_count;
 	/** the trustworthiness of the rrset data */
 	enum rrset_trust trust; 
 	/** security status of the rrset data */
@@ -336,7 +343,7 @@ void ub_rrset_key_delete(void* key, void* userdata);
 /**
  * Old data to be deleted.
  * @param data: what to delete.
- * @param userdata: user data ptr.
+ * @param userdata: alloc, to release the memory.
  */
 void rrset_data_delete(void* data, void* userdata);
 
@@ -0,0 +1,216 @@
+/*
+ * util/hugepage.c - huge page memory for the caches.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Huge page memory for the caches, with fallback to malloc.
+ */
+#include "config.h"
+#include "util/hugepage.h"
+#include "util/log.h"
+#ifndef USE_WINSOCK
+#include <sys/mman.h>
+#endif
+
+#if !defined(MAP_ANONYMOUS) && defined(MAP_ANON)
+#define MAP_ANONYMOUS MAP_ANON
+#endif
+
+/** round up to a multiple of the huge page size */
+static size_t
+hugepage_round(size_t size)
+{
+	return (size + HUGEPAGE_SIZE - 1) & ~((size_t)HUGEPAGE_SIZE - 1);
+}
+
+/**
+ * Map memory from huge pages, aligned to HUGEPAGE_SIZE.
+ * @param size: multiple of HUGEPAGE_SIZE.
+ * @param type: returns HUGEPAGE_TLB or HUGEPAGE_THP.
+ * @return zeroed memory or NULL if no huge pages can be used.
+ */
+static void*
+hugepage_map(size_t size, int* type)
+{
+#if defined(MAP_ANONYMOUS) && defined(MADV_HUGEPAGE)
+	uint8_t* p, *start;
+#ifdef MAP_HUGETLB
+	p = (uint8_t*)mmap(NULL, size, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS|MAP_HUGETLB, -1, 0);
+	if(p != (uint8_t*)MAP_FAILED) {
+		*type = HUGEPAGE_TLB;
+		return p;
+	}
+	verbose(VERB_ALGO, "hugepage: no explicit huge pages for %u "
+		"bytes: %s", (unsigned)size, strerror(errno));
+#endif /* MAP_HUGETLB */
+	/* map more, so that the start can be aligned to a huge page, and
+	 * unmap the part before and after the aligned region */
+	p = (uint8_t*)mmap(NULL, size + HUGEPAGE_SIZE, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if(p == (uint8_t*)MAP_FAILED) {
+		log_err("hugepage: mmap %u bytes: %s", (unsigned)size,
+			strerror(errno));
+		return NULL;
+	}
+	start = (uint8_t*)(((size_t)p + HUGEPAGE_SIZE - 1) &
+		~((size_t)HUGEPAGE_SIZE - 1));
+	if(start != p)
+		(void)munmap(p, (size_t)(start - p));
+	if(start + size != p + size + HUGEPAGE_SIZE)
+		(void)munmap(start + size, (size_t)(p + HUGEPAGE_SIZE - start));
+	if(madvise(start, size, MADV_HUGEPAGE) != 0) {
+		verbose(VERB_ALGO, "hugepage: no transparent huge pages: %s",
+			strerror(errno));
+		(void)munmap(start, size);
+		return NULL;
+	}
+	*type = HUGEPAGE_THP;
+	return start;
+#else
+	(void)size;
+	(void)type;
+	return NULL;
+#endif /* MAP_ANONYMOUS && MADV_HUGEPAGE */
+}
+
+/** unmap memory from hugepage_map */
+static void
+hugepage_unmap(void* p, size_t size)
+{
+#if defined(MAP_ANONYMOUS) && defined(MADV_HUGEPAGE)
+	if(munmap(p, size) != 0)
+		log_err("hugepage: munmap: %s", strerror(errno));
+#else
+	(void)p;
+	(void)size;
+#endif
+}
+
+struct hugepage_arena*
+hugepage_arena_create(size_t size, size_t chunk)
+{
+	struct hugepage_arena* a;
+	log_assert(chunk >= sizeof(void*) && chunk <= HUGEPAGE_SIZE &&
+		(chunk & (chunk-1)) == 0);
+	a = (struct hugepage_arena*)calloc(1, sizeof(*a));
+	if(!a)
+		return NULL;
+	a->size = hugepage_round(size);
+	a->chunk = chunk;
+	if(!(a->base = (uint8_t*)hugepage_map(a->size, &a->type))) {
+		free(a);
+		return NULL;
+	}
+	a->unused = a->base;
+	return a;
+}
+
+void
+hugepage_arena_delete(struct hugepage_arena* a)
+{
+	if(!a)
+		return;
+	hugepage_unmap(a->base, a->size);
+	free(a);
+}
+
+void*
+hugepage_arena_alloc(struct hugepage_arena* a)
+{
+	void* p;
+	if(a->free_list) {
+		p = a->free_list;
+		a->free_list = *(void**)p;
+	} else if(a->unused < a->base + a->size) {
+		p = a->unused;
+		a->unused += a->chunk;
+	} else	return NULL;
+	a->num_used++;
+	return p;
+}
+
+int
+hugepage_arena_free(struct hugepage_arena* a, void* p)
+{
+	if((uint8_t*)p < a->base || (uint8_t*)p >= a->base + a->size)
+		return 0;
+	log_assert(((size_t)((uint8_t*)p - a->base) & (a->chunk-1)) == 0);
+	*(void**)p = a->free_list;
+	a->free_list = p;
+	a->num_used--;
+	return 1;
+}
+
+size_t
+hugepage_arena_get_used(struct hugepage_arena* a)
+{
+	if(!a)
+		return 0;
+	return a->num_used * a->chunk;
+}
+
+void*
+hugepage_calloc(size_t size, int* type)
+{
+	void* p;
+	if(size >= HUGEPAGE_SIZE &&
+		(p = hugepage_map(hugepage_round(size), type)) != NULL)
+		return p;
+	*type = HUGEPAGE_NONE;
+	return calloc(1, size);
+}
+
+void
+hugepage_free(void* p, size_t size, int type)
+{
+	if(!p)
+		return;
+	if(type == HUGEPAGE_NONE)
+		free(p);
+	else	hugepage_unmap(p, hugepage_round(size));
+}
+
+const char*
+hugepage_type_str(int type)
+{
+	switch(type) {
+	case HUGEPAGE_TLB: return "hugetlb";
+	case HUGEPAGE_THP: return "thp";
+	default: break;
+	}
+	return "none";
+}
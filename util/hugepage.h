@@ -0,0 +1,146 @@
+/*
+ * util/hugepage.h - huge page memory for the caches.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Memory for the caches from 2 MB huge pages, so that the lookups in a
+ * large cache take fewer TLB misses.  Explicit huge pages (MAP_HUGETLB)
+ * are used if the system has them reserved, otherwise the memory is
+ * mapped at a huge page boundary and advised for transparent huge pages.
+ * If that is not possible either, the callers use malloc.
+ *
+ * An arena is a region sized from the cache limits, that is cut in
+ * chunks of one size, for the slabs of the slab allocator.  Large
+ * arrays, the hash bins of the caches, are mapped on their own.
+ */
+
+#ifndef UTIL_HUGEPAGE_H
+#define UTIL_HUGEPAGE_H
+
+/** size of a huge page */
+#define HUGEPAGE_SIZE (2*1024*1024)
+
+/** memory from malloc, no huge pages */
+#define HUGEPAGE_NONE 0
+/** memory mapped and advised for transparent huge pages */
+#define HUGEPAGE_THP 1
+/** memory mapped from explicit huge pages */
+#define HUGEPAGE_TLB 2
+
+/**
+ * A huge page arena, cut in chunks of one size.  It has no lock, the
+ * caller locks it.
+ */
+struct hugepage_arena {
+	/** start of the region, aligned to HUGEPAGE_SIZE */
+	uint8_t* base;
+	/** size of the region */
+	size_t size;
+	/** type of memory, HUGEPAGE_THP or HUGEPAGE_TLB */
+	int type;
+	/** size of the chunks */
+	size_t chunk;
+	/** start of the part that has never been handed out */
+	uint8_t* unused;
+	/** list of free chunks, next pointer at the start of the chunk */
+	void* free_list;
+	/** number of chunks in use */
+	size_t num_used;
+};
+
+/**
+ * Create a huge page arena.
+ * @param size: size of the arena, it is rounded up to HUGEPAGE_SIZE.
+ * @param chunk: size of the chunks, a power of two that is at most
+ *	HUGEPAGE_SIZE.  The chunks are aligned to their size.
+ * @return new arena or NULL if huge pages are not available, or on
+ *	alloc failure.
+ */
+struct hugepage_arena* hugepage_arena_create(size_t size, size_t chunk);
+
+/**
+ * Delete a huge page arena, and unmap its memory.
+ * @param a: the arena, if NULL nothing happens.
+ */
+void hugepage_arena_delete(struct hugepage_arena* a);
+
+/**
+ * Get a chunk from the arena.
+ * @param a: the arena.
+ * @return chunk (not zeroed) or NULL if the arena is full.
+ */
+void* hugepage_arena_alloc(struct hugepage_arena* a);
+
+/**
+ * Return a chunk to the arena.
+ * @param a: the arena.
+ * @param p: the chunk.
+ * @return false if p is not from the arena, and nothing happened.
+ */
+int hugepage_arena_free(struct hugepage_arena* a, void* p);
+
+/**
+ * Get the memory of the arena that is in use.
+ * @param a: the arena, or NULL.
+ * @return bytes in the chunks that are in use.
+ */
+size_t hugepage_arena_get_used(struct hugepage_arena* a);
+
+/**
+ * Allocate zeroed memory, from huge pages if it is at least HUGEPAGE_SIZE.
+ * @param size: size of the memory.
+ * @param type: returns how the memory was obtained, HUGEPAGE_NONE if
+ *	it was calloced.  Pass it to hugepage_free.
+ * @return memory or NULL on alloc failure.
+ */
+void* hugepage_calloc(size_t size, int* type);
+
+/**
+ * Free memory from hugepage_calloc.
+ * @param p: the memory, if NULL nothing happens.
+ * @param size: size of the memory, as passed to hugepage_calloc.
+ * @param type: the type from hugepage_calloc.
+ */
+void hugepage_free(void* p, size_t size, int type);
+
+/**
+ * Name of the type of memory, for statistics and logs.
+ * @param type: HUGEPAGE_NONE, _THP or _TLB.
+ * @return a static string.
+ */
+const char* hugepage_type_str(int type);
+
+#endif /* UTIL_HUGEPAGE_H */
@@ -299,6 +299,39 @@ typedef void* ub_thread_key_type;
 #endif /* HAVE_PTHREAD */
 #endif /* USE_THREAD_DEBUG */
 
+/**
+ * Statistics counters, that are written only by the thread that owns them,
+ * and read by other threads without a lock, with STATS_SHARED.  They are
+ * accessed with relaxed atomic loads and stores, so the reads are not torn
+ * and the writes need no lock instruction.  The generation number of the
+ * counters uses acquire and release, for a reader that has to see that a
+ * clear of the counters happened while it read them.
+ * Without atomics, or without threads, the counters are plain values and
+ * the stats are obtained from the thread itself.
+ */
+#if defined(HAVE_ATOMIC_BUILTINS) && !defined(THREADS_DISABLED)
+#define STATS_SHARED 1
+#define stat_get(x) __atomic_load_n(&(x), __ATOMIC_RELAXED)
+#define stat_set(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELAXED)
+#define stat_get_acquire(x) __atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define stat_set_release(x, v) __atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
+#define stat_fence_acquire() __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define stat_fence_release() __atomic_thread_fence(__ATOMIC_RELEASE)
+#else
+#define stat_get(x) (x)
+#define stat_set(x, v) ((x) = (v))
+#define stat_get_acquire(x) (x)
+#define stat_set_release(x, v) ((x) = (v))
+#define stat_fence_acquire() /* nop */
+#define stat_fence_release() /* nop */
+#endif
+/** add to a statistics counter, by its owner thread */
+#define stat_add(x, n) stat_set(x, stat_get(x) + (n))
+/** increment a statistics counter, by its owner thread */
+#define stat_inc(x) stat_add(x, 1)
+/** decrement a statistics counter, by its owner thread */
+#define stat_dec(x) stat_set(x, stat_get(x) - 1)
+
 /**
  * Block all signals for this thread.
  * fatal exit on error.
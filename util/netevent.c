@@ -41,9 +41,11 @@
 #include "config.h"
 #include "util/netevent.h"
 #include "util/ub_event.h"
+#include "util/uring_event.h"
 #include "util/log.h"
 #include "util/net_help.h"
 #include "util/fptr_wlist.h"
+#include "util/locks.h"
 #include "sldns/pkthdr.h"
 #include "sldns/sbuffer.h"
 #include "sldns/str2wire.h"
@@ -152,8 +154,10 @@ static struct comm_point* comm_point_create_tcp_handler(
 
 /* -------- End of local definitions -------- */
 
-struct comm_base* 
-comm_base_create(int sigs)
+/** create a comm base, with the event base of the daemon if daemon is
+ * true, otherwise with the default event base */
+static struct comm_base* 
+comm_base_create_base(int sigs, int daemon)
 {
 	struct comm_base* b = (struct comm_base*)calloc(1,
 		sizeof(struct comm_base));
@@ -166,7 +170,11 @@ comm_base_create(int sigs)
 		free(b);
 		return NULL;
 	}
-	b->eb->base = ub_default_event_base(sigs, &b->eb->secs, &b->eb->now);
+	if(daemon)
+		b->eb->base = ub_daemon_event_base(sigs, &b->eb->secs,
+			&b->eb->now);
+	else	b->eb->base = ub_default_event_base(sigs, &b->eb->secs,
+			&b->eb->now);
 	if(!b->eb->base) {
 		free(b->eb);
 		free(b);
@@ -178,6 +186,18 @@ comm_base_create(int sigs)
 	return b;
 }
 
+struct comm_base* 
+comm_base_create(int sigs)
+{
+	return comm_base_create_base(sigs, 0);
+}
+
+struct comm_base* 
+comm_base_create_daemon(int sigs)
+{
+	return comm_base_create_base(sigs, 1);
+}
+
 struct comm_base*
 comm_base_create_event(struct ub_event_base* base)
 {
@@ -667,6 +687,19 @@ comm_point_udp_ancil_callback(int fd, short event, void* arg)
 #endif /* AF_INET6 && IPV6_PKTINFO && HAVE_RECVMSG */
 }
 
+/** send the reply to a UDP query, it is queued by the event backend if
+ * that can batch the replies */
+static int
+comm_point_send_udp_reply(struct comm_point* c, sldns_buffer* packet,
+	struct sockaddr* addr, socklen_t addrlen)
+{
+#ifdef USE_IO_URING
+	if(ub_uring_send_udp(c->ev->ev, packet, addr, addrlen))
+		return 1;
+#endif
+	return comm_point_send_udp_msg(c, packet, addr, addrlen);
+}
+
 void 
 comm_point_udp_callback(int fd, short event, void* arg)
 {
@@ -715,7 +748,7 @@ comm_point_udp_callback(int fd, short event, void* arg)
 #else
 			buffer = rep.c->buffer;
 #endif
-			(void)comm_point_send_udp_msg(rep.c, buffer,
+			(void)comm_point_send_udp_reply(rep.c, buffer,
 				(struct sockaddr*)&rep.addr, rep.addrlen);
 		}
 		if(!rep.c || rep.c->fd != fd) /* commpoint closed to -1 or reused for
@@ -724,6 +757,39 @@ comm_point_udp_callback(int fd, short event, void* arg)
 	}
 }
 
+void
+comm_point_udp_recv(struct comm_point* c, uint8_t* data, size_t len,
+	struct sockaddr* addr, socklen_t addrlen)
+{
+	struct comm_reply rep;
+	struct sldns_buffer *buffer;
+
+	rep.c = c;
+	log_assert(rep.c->type == comm_udp);
+	sldns_buffer_clear(rep.c->buffer);
+	/* like recvfrom, the datagram is truncated to the buffer */
+	if(len > sldns_buffer_remaining(rep.c->buffer))
+		len = sldns_buffer_remaining(rep.c->buffer);
+	sldns_buffer_write(rep.c->buffer, data, len);
+	sldns_buffer_flip(rep.c->buffer);
+	if(addrlen > (socklen_t)sizeof(rep.addr))
+		addrlen = (socklen_t)sizeof(rep.addr);
+	memmove(&rep.addr, addr, addrlen);
+	rep.addrlen = addrlen;
+	rep.srctype = 0;
+	fptr_ok(fptr_whitelist_comm_point(rep.c->callback));
+	if((*rep.c->callback)(rep.c, rep.c->cb_arg, NETEVENT_NOERROR, &rep)) {
+		/* send back immediate reply */
+#ifdef USE_DNSCRYPT
+		buffer = rep.c->dnscrypt_buffer;
+#else
+		buffer = rep.c->buffer;
+#endif
+		(void)comm_point_send_udp_reply(rep.c, buffer,
+			(struct sockaddr*)&rep.addr, rep.addrlen);
+	}
+}
+
 /** Use a new tcp handler for new query fd, set to read query */
 static void
 setup_tcp_handler(struct comm_point* c, int fd, int cur, int max) 
@@ -907,7 +973,7 @@ comm_point_tcp_accept_callback(int fd, short event, void* arg)
 	}
 
 	/* grab the tcp handler buffers */
-	c->cur_tcp_count++;
+	stat_inc(c->cur_tcp_count);
 	c->tcp_free = c_hdl->tcp_free;
 	if(!c->tcp_free) {
 		/* stop accepting incoming queries for now. */
@@ -930,7 +996,7 @@ reclaim_tcp_handler(struct comm_point* c)
 	}
 	comm_point_close(c);
 	if(c->tcp_parent) {
-		c->tcp_parent->cur_tcp_count--;
+		stat_dec(c->tcp_parent->cur_tcp_count);
 		c->tcp_free = c->tcp_parent->tcp_free;
 		c->tcp_parent->tcp_free = c;
 		if(!c->tcp_free) {
@@ -1705,7 +1771,7 @@ reclaim_http_handler(struct comm_point* c)
 	}
 	comm_point_close(c);
 	if(c->tcp_parent) {
-		c->tcp_parent->cur_tcp_count--;
+		stat_dec(c->tcp_parent->cur_tcp_count);
 		c->tcp_free = c->tcp_parent->tcp_free;
 		c->tcp_parent->tcp_free = c;
 		if(!c->tcp_free) {
@@ -2954,7 +3020,7 @@ comm_point_send_reply(struct comm_reply *repinfo)
 			buffer, (struct sockaddr*)&repinfo->addr, 
 			repinfo->addrlen, repinfo);
 		else
-			comm_point_send_udp_msg(repinfo->c, buffer,
+			comm_point_send_udp_reply(repinfo->c, buffer,
 			(struct sockaddr*)&repinfo->addr, repinfo->addrlen);
 #ifdef USE_DNSTAP
 		if(repinfo->c->dtenv != NULL &&
@@ -342,6 +342,15 @@ struct comm_signal {
  */
 struct comm_base* comm_base_create(int sigs);
 
+/**
+ * Create a new comm base for a thread of the daemon. It uses the io_uring
+ * event base if that is compiled in, libunbound uses comm_base_create.
+ * @param sigs: if true it attempts to create a default loop for 
+ *   signal handling.
+ * @return: the new comm base. NULL on error.
+ */
+struct comm_base* comm_base_create_daemon(int sigs);
+
 /**
  * Create comm base that uses the given ub_event_base (underlying pluggable 
  * event mechanism pointer).
@@ -666,6 +675,19 @@ int comm_point_perform_accept(struct comm_point* c,
  */
 void comm_point_udp_callback(int fd, short event, void* arg);
 
+/**
+ * This routine is published for the event backend, and is only used
+ * internally.  Handle a datagram that the event backend received for the
+ * udp comm point, like the udp callback does after the recvfrom.
+ * @param c: the comm_point structure.
+ * @param data: the datagram.
+ * @param len: length of the datagram.
+ * @param addr: address it was received from.
+ * @param addrlen: length of addr.
+ */
+void comm_point_udp_recv(struct comm_point* c, uint8_t* data, size_t len,
+	struct sockaddr* addr, socklen_t addrlen);
+
 /**
  * This routine is published for checks and tests, and is only used internally.
  * handle libevent callback for udp ancillary data comm point.
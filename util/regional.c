@@ -43,6 +43,7 @@
 #include "config.h"
 #include "util/log.h"
 #include "util/regional.h"
+#include "util/locks.h"
 
 #ifdef ALIGNMENT
 #  undef ALIGNMENT
@@ -87,17 +88,62 @@ regional_create_custom(size_t size)
 	log_assert(sizeof(struct regional) <= size);
 	if(!r) return NULL;
 	r->first_size = size;
+	r->cache = NULL;
 	regional_init(r);
 	return r;
 }
 
+void
+regional_set_cache(struct regional* r, struct regional_cache* cache)
+{
+	log_assert(r->next == NULL);
+	r->cache = cache;
+}
+
+/** get a chunk, from the chunk cache if it has one */
+static char*
+regional_chunk_get(struct regional* r)
+{
+	struct regional_cache* c = r->cache;
+	char* s;
+	if(!c)
+		return (char*)malloc(REGIONAL_CHUNK_SIZE);
+	if(c->list) {
+		s = c->list;
+		c->list = *(char**)s;
+		c->num--;
+		stat_inc(c->reused);
+		return s;
+	}
+	stat_inc(c->malloced);
+	return (char*)malloc(REGIONAL_CHUNK_SIZE);
+}
+
+/** return a chunk to the chunk cache, or free it if that is full */
+static void
+regional_chunk_put(struct regional_cache* c, char* s)
+{
+	if(!c) {
+		free(s);
+		return;
+	}
+	if(c->num >= c->max) {
+		stat_inc(c->freed);
+		free(s);
+		return;
+	}
+	*(char**)s = c->list;
+	c->list = s;
+	c->num++;
+}
+
 void 
 regional_free_all(struct regional *r)
 {
 	char* p = r->next, *np;
 	while(p) {
 		np = *(char**)p;
-		free(p);
+		regional_chunk_put(r->cache, p);
 		p = np;
 	}
 	p = r->large_list;
@@ -124,6 +170,22 @@ regional_alloc(struct regional *r, size_t size)
 	void *s;
 	/* large objects */
 	if(a > REGIONAL_LARGE_OBJECT_SIZE) {
+#ifndef UNBOUND_ALLOC_NONREGIONAL
+		if(r->cache && a <= REGIONAL_CHUNK_SIZE - ALIGNMENT) {
+			/* a chunk of its own, linked after the current
+			 * chunk, so that it is returned to the cache */
+			s = regional_chunk_get(r);
+			if(!s) return NULL;
+			if(r->next) {
+				*(char**)s = *(char**)r->next;
+				*(char**)r->next = (char*)s;
+			} else {
+				*(char**)s = NULL;
+				r->next = (char*)s;
+			}
+			return (char*)s+ALIGNMENT;
+		}
+#endif
 		s = malloc(ALIGNMENT + size);
 		if(!s) return NULL;
 		r->total_large += ALIGNMENT+size;
@@ -133,7 +195,7 @@ regional_alloc(struct regional *r, size_t size)
 	}
 	/* create a new chunk */
 	if(a > r->available) {
-		s = malloc(REGIONAL_CHUNK_SIZE);
+		s = regional_chunk_get(r);
 		if(!s) return NULL;
 		*(char**)s = r->next;
 		r->next = (char*)s;
@@ -221,3 +283,29 @@ regional_get_mem(struct regional* r)
 	return r->first_size + (count_chunks(r)-1)*REGIONAL_CHUNK_SIZE 
 		+ r->total_large;
 }
+
+void
+regional_cache_init(struct regional_cache* cache, size_t max)
+{
+	memset(cache, 0, sizeof(*cache));
+	cache->max = max;
+}
+
+void
+regional_cache_clear(struct regional_cache* cache)
+{
+	char* p = cache->list, *np;
+	while(p) {
+		np = *(char**)p;
+		free(p);
+		p = np;
+	}
+	cache->list = NULL;
+	cache->num = 0;
+}
+
+size_t
+regional_cache_get_mem(struct regional_cache* cache)
+{
+	return cache->num * REGIONAL_CHUNK_SIZE;
+}
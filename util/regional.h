@@ -39,7 +39,8 @@
  * Based on region-allocator from NSD, but rewritten to be light.
  *
  * Different from (nsd) region-allocator.h
- * 	o does not have recycle bin
+ * 	o does not have recycle bin, but can take chunks from a chunk cache
+ * 	  that is shared by the regionals of a thread.
  * 	o does not collect stats; just enough to answer get_mem() in use.
  * 	o does not keep cleanup list
  * 	o does not have function pointers to setup
@@ -51,6 +52,26 @@
 #ifndef UTIL_REGIONAL_H_
 #define UTIL_REGIONAL_H_
 
+/**
+ * Cache of free chunks, for the regionals of one thread.  The chunks of
+ * regional_free_all are kept, up to a maximum, and handed out to the
+ * next regional that needs a chunk.  It has no lock.
+ */
+struct regional_cache {
+	/** list of free chunks, next pointer in the first bytes */
+	char* list;
+	/** number of chunks in the list */
+	size_t num;
+	/** max number of chunks to keep in the list */
+	size_t max;
+	/** stats, number of chunks handed out from the list */
+	size_t reused;
+	/** stats, number of chunks that had to be malloced */
+	size_t malloced;
+	/** stats, number of chunks freed because the list was full */
+	size_t freed;
+};
+
 /** 
  * the regional* is the first block*.
  * every block has a ptr to the next in first bytes.
@@ -74,6 +95,9 @@ struct regional
 	size_t available;
 	/** current chunk data position. */
 	char* data;
+	/** chunk cache to get chunks from and return them to, or NULL
+	 * for malloc and free. */
+	struct regional_cache* cache;
 };
 
 /**
@@ -141,6 +165,32 @@ void *regional_alloc_zero(struct regional *r, size_t size);
  */
 char *regional_strdup(struct regional *r, const char *string);
 
+/**
+ * Set the chunk cache of a regional.  Its chunks, except the first,
+ * and large objects that fit in a chunk, are taken from the cache and
+ * returned to it by regional_free_all.
+ * @param r: the region, it must have no chunks except the first.
+ * @param cache: the chunk cache, or NULL to use malloc and free.
+ */
+void regional_set_cache(struct regional* r, struct regional_cache* cache);
+
+/**
+ * Init a chunk cache.
+ * @param cache: the chunk cache, allocated by the caller.
+ * @param max: max number of chunks to keep.
+ */
+void regional_cache_init(struct regional_cache* cache, size_t max);
+
+/**
+ * Free the chunks in a chunk cache.  The regionals that use it must
+ * have been freed.
+ * @param cache: the chunk cache.
+ */
+void regional_cache_clear(struct regional_cache* cache);
+
+/** get memory size of the free chunks in the chunk cache */
+size_t regional_cache_get_mem(struct regional_cache* cache);
+
 /** Debug print regional statistics to log */
 void regional_log_stats(struct regional *r);
 
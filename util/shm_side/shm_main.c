@@ -61,6 +61,7 @@
 #include "util/config_file.h"
 #include "util/fptr_wlist.h"
 #include "util/log.h"
+#include "util/storage/topk.h"
 
 #ifdef HAVE_SHMGET
 /** subtract timers and the values do not overflow or become negative */
@@ -78,6 +79,32 @@ stat_timeval_subtract(long long *d_sec, long long *d_usec, const struct timeval*
 	*d_usec = end_usec - start->tv_usec;
 #endif
 }
+
+/** copy the heavy hitters of all threads to shm */
+static void
+shm_heavy_hitters(struct worker* worker, struct ub_shm_stat_info* shm_stat)
+{
+	struct topk* merged[UB_STATS_HEAVY_CAT_NUM];
+	struct topk_entry** list;
+	size_t i, n;
+	int c;
+	memset(shm_stat->heavy, 0, sizeof(shm_stat->heavy));
+	if(!server_stats_heavy_merge(worker, merged))
+		return;
+	list = (struct topk_entry**)malloc(sizeof(*list)*merged[0]->max);
+	for(c=0; c<UB_STATS_HEAVY_CAT_NUM; c++) {
+		n = list?topk_sorted(merged[c], list):0;
+		for(i=0; i<n && i<UB_STATS_HEAVY_NUM; i++) {
+			server_stats_heavy_str(c, list[i],
+				shm_stat->heavy[c][i].name,
+				sizeof(shm_stat->heavy[c][i].name));
+			shm_stat->heavy[c][i].count = list[i]->count;
+			shm_stat->heavy[c][i].err = list[i]->err;
+		}
+		topk_delete(merged[c]);
+	}
+	free(list);
+}
 #endif /* HAVE_SHMGET */
 
 int shm_main_init(struct daemon* daemon)
@@ -96,6 +123,9 @@ int shm_main_init(struct daemon* daemon)
 
 	/* Statistics to maintain the number of thread + total */
 	shm_size = (sizeof(struct ub_stats_info) * (daemon->num + 1));
+	/* followed by the extended statistics, for thread + total */
+	if(daemon->cfg->stat_extended)
+		shm_size += (sizeof(struct ub_stats_ext) * (daemon->num + 1));
 
 	/* Allocation of needed memory */
 	daemon->shm_info = (struct shm_main_info*)calloc(1, shm_size);
@@ -174,6 +204,10 @@ int shm_main_init(struct daemon* daemon)
 		return 0;
 	}
 
+	if(daemon->cfg->stat_extended)
+		daemon->shm_info->ptr_ext = (struct ub_stats_ext*)
+			(daemon->shm_info->ptr_arr + daemon->num + 1);
+
 	/* Zero fill SHM to stand clean while is not filled by other events */
 	memset(daemon->shm_info->ptr_ctl, 0, sizeof(struct ub_shm_stat_info));
 	memset(daemon->shm_info->ptr_arr, 0, shm_size);
@@ -221,6 +255,7 @@ void shm_main_run(struct worker *worker)
 	struct ub_shm_stat_info *shm_stat;
 	struct ub_stats_info *stat_total;
 	struct ub_stats_info *stat_info;
+	struct ub_stats_ext *ext_total = NULL, *ext_info = NULL;
 	int offset;
 
 	verbose(VERB_DETAIL, "SHM run - worker [%d] - daemon [%p] - timenow(%u) - timeboot(%u)",
@@ -229,15 +264,23 @@ void shm_main_run(struct worker *worker)
 	offset = worker->thread_num + 1;
 	stat_total = worker->daemon->shm_info->ptr_arr;
 	stat_info = worker->daemon->shm_info->ptr_arr + offset;
+	if(worker->daemon->shm_info->ptr_ext) {
+		ext_total = worker->daemon->shm_info->ptr_ext;
+		ext_info = worker->daemon->shm_info->ptr_ext + offset;
+	}
 
+#ifndef STATS_SHARED
 	/* Copy data to the current position */
-	server_stats_compile(worker, stat_info, 0);
+	server_stats_compile(worker, stat_info, ext_info, 0);
+#endif
 
 	/* First thread, zero fill total, and copy general info */
 	if (worker->thread_num == 0) {
 
 		/* Copy data to the current position */
 		memset(stat_total, 0, sizeof(struct ub_stats_info));
+		if(ext_total)
+			memset(ext_total, 0, sizeof(struct ub_stats_ext));
 
 		/* Point to data into SHM */
 		shm_stat = worker->daemon->shm_info->ptr_ctl;
@@ -249,6 +292,8 @@ void shm_main_run(struct worker *worker)
 
 		shm_stat->mem.msg = (long long)slabhash_get_mem(worker->env.msg_cache);
 		shm_stat->mem.rrset = (long long)slabhash_get_mem(&worker->env.rrset_cache->table);
+		shm_stat->mem.hugepage = (long long)daemon_get_hugepage_mem(
+			worker->daemon);
 		shm_stat->mem.dnscrypt_shared_secret = 0;
 #ifdef USE_DNSCRYPT
 		if(worker->daemon->dnscenv) {
@@ -281,9 +326,27 @@ void shm_main_run(struct worker *worker)
 		shm_stat->mem.ipsecmod = (long long)mod_get_mem(&worker->env,
 			"ipsecmod");
 #endif
+		shm_heavy_hitters(worker, shm_stat);
 	}
 
+#ifdef STATS_SHARED
+	/* The first thread reads the counters of every thread, the
+	 * threads keep running */
+	for(offset=1; offset<=worker->daemon->num; offset++) {
+		stat_info = worker->daemon->shm_info->ptr_arr + offset;
+		if(ext_total)
+			ext_info = worker->daemon->shm_info->ptr_ext + offset;
+		server_stats_shm(worker->daemon->workers[offset-1], stat_info,
+			ext_info);
+		server_stats_add(stat_total, stat_info);
+		if(ext_total)
+			server_stats_ext_add(ext_total, ext_info);
+	}
+#else
 	server_stats_add(stat_total, stat_info);
+	if(ext_total)
+		server_stats_ext_add(ext_total, ext_info);
+#endif
 
 	/* print the thread statistics */
 	stat_total->mesh_time_median /= (double)worker->daemon->num;
@@ -54,6 +54,10 @@ struct shm_main_info {
 	/** stats_info array, shared memory segment.
 	 * [0] is totals, [1..thread_num] are per-thread stats */
 	struct ub_stats_info* ptr_arr;
+	/** extended stats array, in the same segment after ptr_arr, with
+	 * extended-statistics, or NULL.
+	 * [0] is totals, [1..thread_num] are per-thread stats */
+	struct ub_stats_ext* ptr_ext;
 	/** the global stats block, shared memory segment */
 	struct ub_shm_stat_info* ptr_ctl;
 	int key;
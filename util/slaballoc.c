@@ -0,0 +1,490 @@
+/*
+ * util/slaballoc.c - size class slab allocator for cache storage.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Slab allocator for the cache storage, with per thread magazines.
+ */
+#include "config.h"
+#include "util/slaballoc.h"
+#include "util/hugepage.h"
+#include "util/log.h"
+
+/** size of the slab header, objects start after it */
+#define SLAB_HDR_SIZE ((sizeof(struct slab)+15)&~((size_t)15))
+
+/** size class for an object size, size is at most SLAB_OBJ_MAX */
+static int
+slab_cls(size_t size)
+{
+	size_t base = 128, step;
+	int c = 8;
+	if(size <= 128)
+		return size==0?0:(int)((size+15)/16) - 1;
+	/* four classes per power of two */
+	while(size > base*2) {
+		base *= 2;
+		c += 4;
+	}
+	step = base/4;
+	return c + (int)((size - base + step - 1)/step) - 1;
+}
+
+/** object size of a size class */
+static size_t
+slab_cls_size(int c)
+{
+	size_t base;
+	if(c < 8)
+		return ((size_t)c+1)*16;
+	base = ((size_t)128) << ((c-8)/4);
+	return base + ((size_t)((c-8)%4)+1)*(base/4);
+}
+
+size_t
+slab_obj_size(size_t size)
+{
+	if(size > SLAB_OBJ_MAX)
+		return size;
+	return slab_cls_size(slab_cls(size));
+}
+
+int
+slab_cmp(const void* a, const void* b)
+{
+	if((const uint8_t*)a < (const uint8_t*)b)
+		return -1;
+	if((const uint8_t*)a > (const uint8_t*)b)
+		return 1;
+	return 0;
+}
+
+struct slab_depot*
+slab_depot_create(void)
+{
+	struct slab_depot* d = (struct slab_depot*)calloc(1, sizeof(*d));
+	int c;
+	if(!d)
+		return NULL;
+	lock_quick_init(&d->lock);
+	rbtree_init(&d->slabs, &slab_cmp);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		d->cls[c].size = slab_cls_size(c);
+		d->cls[c].per_slab = (SLAB_SIZE - SLAB_HDR_SIZE) /
+			d->cls[c].size;
+	}
+	lock_protect(&d->lock, d, sizeof(*d));
+	return d;
+}
+
+/** release the memory of a slab, to the arena or with free */
+static void
+slab_release(struct slab_depot* d, struct slab* s)
+{
+	if(!d->arena || !hugepage_arena_free(d->arena, s))
+		free(s);
+}
+
+/** delete a slab, in tree traversal */
+static void
+slab_del(rbnode_type* n, void* arg)
+{
+	slab_release((struct slab_depot*)arg, (struct slab*)n);
+}
+
+/** delete list of magazines */
+static void
+slab_mag_list_del(struct slab_mag* m)
+{
+	struct slab_mag* nm;
+	while(m) {
+		nm = m->next;
+		free(m);
+		m = nm;
+	}
+}
+
+void
+slab_depot_delete(struct slab_depot* d)
+{
+	int c;
+	if(!d)
+		return;
+	lock_quick_destroy(&d->lock);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		slab_mag_list_del(d->cls[c].full);
+		slab_mag_list_del(d->cls[c].empty);
+	}
+	traverse_postorder(&d->slabs, &slab_del, d);
+	hugepage_arena_delete(d->arena);
+	free(d);
+}
+
+/** remove slab from the list of slabs with free objects */
+static void
+slab_unlink(struct slab_class* cl, struct slab* s)
+{
+	if(s->prev)
+		s->prev->next = s->next;
+	else	cl->partial = s->next;
+	if(s->next)
+		s->next->prev = s->prev;
+	s->next = NULL;
+	s->prev = NULL;
+}
+
+/** add slab to the list of slabs with free objects */
+static void
+slab_link(struct slab_class* cl, struct slab* s)
+{
+	s->prev = NULL;
+	s->next = cl->partial;
+	if(cl->partial)
+		cl->partial->prev = s;
+	cl->partial = s;
+}
+
+/** create a new slab for a size class, with the depot locked */
+static struct slab*
+slab_create(struct slab_depot* d, int c)
+{
+	struct slab_class* cl = &d->cls[c];
+	struct slab* s = NULL;
+	if(d->arena)
+		s = (struct slab*)hugepage_arena_alloc(d->arena);
+	if(!s && !(s = (struct slab*)malloc(SLAB_SIZE)))
+		return NULL;
+	s->node.key = s;
+	s->cls = c;
+	s->num_free = cl->per_slab;
+	s->free_list = NULL;
+	s->unused = (uint8_t*)s + SLAB_HDR_SIZE;
+	(void)rbtree_insert(&d->slabs, &s->node);
+	slab_link(cl, s);
+	cl->num_slabs++;
+	cl->num_free += cl->per_slab;
+	d->slabs_created++;
+	return s;
+}
+
+/** get an object from the slabs, with the depot locked */
+static void*
+slab_get(struct slab_depot* d, int c)
+{
+	struct slab_class* cl = &d->cls[c];
+	struct slab* s = cl->partial;
+	void* p;
+	if(!s && !(s = slab_create(d, c)))
+		return NULL;
+	if(s->free_list) {
+		p = s->free_list;
+		s->free_list = *(void**)p;
+	} else {
+		p = s->unused;
+		s->unused += cl->size;
+	}
+	s->num_free--;
+	cl->num_free--;
+	if(s->num_free == 0)
+		slab_unlink(cl, s);
+	return p;
+}
+
+/** put an object back in its slab, with the depot locked */
+static void
+slab_put(struct slab_depot* d, int c, void* p)
+{
+	struct slab_class* cl = &d->cls[c];
+	rbnode_type* n = NULL;
+	struct slab* s;
+	(void)rbtree_find_less_equal(&d->slabs, p, &n);
+	if(!n || (uint8_t*)p >= (uint8_t*)n->key + SLAB_SIZE) {
+		log_assert(0); /* not allocated from this depot */
+		return;
+	}
+	s = (struct slab*)n->key;
+	log_assert(s->cls == c);
+	*(void**)p = s->free_list;
+	s->free_list = p;
+	if(s->num_free == 0)
+		slab_link(cl, s);
+	s->num_free++;
+	cl->num_free++;
+	/* release an empty slab, if there is enough free space in the
+	 * other slabs, so that a slab is not created and released for
+	 * every couple of objects */
+	if(s->num_free == cl->per_slab && cl->num_free >= 2*cl->per_slab) {
+		slab_unlink(cl, s);
+		(void)rbtree_delete(&d->slabs, s);
+		cl->num_slabs--;
+		cl->num_free -= cl->per_slab;
+		d->slabs_released++;
+		slab_release(d, s);
+	}
+}
+
+/** get an empty magazine, with the depot locked */
+static struct slab_mag*
+slab_mag_get(struct slab_class* cl)
+{
+	struct slab_mag* m = cl->empty;
+	if(m) {
+		cl->empty = m->next;
+		cl->num_empty--;
+	} else if(!(m = (struct slab_mag*)malloc(sizeof(*m))))
+		return NULL;
+	m->next = NULL;
+	m->num = 0;
+	return m;
+}
+
+/** keep an empty magazine in the depot, with the depot locked */
+static void
+slab_mag_put(struct slab_class* cl, struct slab_mag* m)
+{
+	if(cl->num_empty >= SLAB_DEPOT_MAGS) {
+		free(m);
+		return;
+	}
+	m->next = cl->empty;
+	cl->empty = m;
+	cl->num_empty++;
+}
+
+void
+slab_cache_init(struct slab_cache* sc, struct slab_depot* depot, int shared)
+{
+	memset(sc, 0, sizeof(*sc));
+	sc->depot = depot;
+	sc->shared = shared;
+}
+
+void
+slab_cache_clear(struct slab_cache* sc)
+{
+	struct slab_class* cl;
+	struct slab_mag* m;
+	int c;
+	if(!sc->depot)
+		return;
+	lock_quick_lock(&sc->depot->lock);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		cl = &sc->depot->cls[c];
+		if((m = sc->mag[c]) != NULL) {
+			while(m->num > 0)
+				slab_put(sc->depot, c, m->obj[--m->num]);
+			slab_mag_put(cl, m);
+			sc->mag[c] = NULL;
+		}
+		/* also return the objects in the depot magazines, they
+		 * keep slabs from being released, the thread that put
+		 * them there may be gone */
+		while((m = cl->full) != NULL) {
+			cl->full = m->next;
+			cl->num_full--;
+			while(m->num > 0)
+				slab_put(sc->depot, c, m->obj[--m->num]);
+			slab_mag_put(cl, m);
+		}
+	}
+	lock_quick_unlock(&sc->depot->lock);
+}
+
+void*
+slab_alloc(struct slab_cache* sc, size_t size)
+{
+	struct slab_depot* d = sc->depot;
+	struct slab_class* cl;
+	struct slab_mag* m;
+	void* p;
+	int c;
+	if(!d || size > SLAB_OBJ_MAX)
+		return malloc(size);
+	c = slab_cls(size);
+	if(sc->shared) {
+		lock_quick_lock(&d->lock);
+		p = slab_get(d, c);
+		lock_quick_unlock(&d->lock);
+		return p;
+	}
+	m = sc->mag[c];
+	if(m && m->num > 0)
+		return m->obj[--m->num];
+
+	/* the magazine is empty, exchange it with the depot */
+	lock_quick_lock(&d->lock);
+	cl = &d->cls[c];
+	if(cl->full) {
+		if(m)
+			slab_mag_put(cl, m);
+		m = cl->full;
+		cl->full = m->next;
+		cl->num_full--;
+	} else {
+		if(!m && !(m = slab_mag_get(cl))) {
+			p = slab_get(d, c);
+			lock_quick_unlock(&d->lock);
+			return p;
+		}
+		/* fill half of it from the slabs */
+		while(m->num < SLAB_MAG_SIZE/2 && (p = slab_get(d, c)))
+			m->obj[m->num++] = p;
+	}
+	lock_quick_unlock(&d->lock);
+	sc->mag[c] = m;
+	if(m->num == 0)
+		return NULL;
+	return m->obj[--m->num];
+}
+
+void
+slab_free(struct slab_cache* sc, void* p, size_t size)
+{
+	struct slab_depot* d = sc->depot;
+	struct slab_class* cl;
+	struct slab_mag* m;
+	int c;
+	if(!p)
+		return;
+	if(!d || size > SLAB_OBJ_MAX) {
+		free(p);
+		return;
+	}
+	c = slab_cls(size);
+	if(sc->shared) {
+		lock_quick_lock(&d->lock);
+		slab_put(d, c, p);
+		lock_quick_unlock(&d->lock);
+		return;
+	}
+	m = sc->mag[c];
+	if(m && m->num < SLAB_MAG_SIZE) {
+		m->obj[m->num++] = p;
+		return;
+	}
+
+	/* the magazine is full, exchange it with the depot */
+	lock_quick_lock(&d->lock);
+	cl = &d->cls[c];
+	if(m && cl->num_full < SLAB_DEPOT_MAGS) {
+		m->next = cl->full;
+		cl->full = m;
+		cl->num_full++;
+		m = NULL;
+	} else if(m) {
+		/* the depot is full, return objects to the slabs */
+		while(m->num > SLAB_MAG_SIZE/2)
+			slab_put(d, c, m->obj[--m->num]);
+	}
+	if(!m && !(m = slab_mag_get(cl))) {
+		slab_put(d, c, p);
+		lock_quick_unlock(&d->lock);
+		sc->mag[c] = NULL;
+		return;
+	}
+	lock_quick_unlock(&d->lock);
+	sc->mag[c] = m;
+	m->obj[m->num++] = p;
+}
+
+void
+slab_depot_stats(struct slab_depot* d, struct slab_class_stats* st)
+{
+	int c;
+	lock_quick_lock(&d->lock);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		struct slab_class* cl = &d->cls[c];
+		st[c].size = cl->size;
+		st[c].slabs = cl->num_slabs;
+		st[c].objects = cl->num_slabs * cl->per_slab;
+		st[c].free_slab = cl->num_free;
+		st[c].free_mag = cl->num_full * SLAB_MAG_SIZE;
+	}
+	lock_quick_unlock(&d->lock);
+}
+
+int
+slab_depot_set_arena(struct slab_depot* d, size_t size)
+{
+	struct hugepage_arena* a;
+	lock_quick_lock(&d->lock);
+	if(d->arena) {
+		lock_quick_unlock(&d->lock);
+		return 1;
+	}
+	lock_quick_unlock(&d->lock);
+	/* map it without the lock, it takes time for a large arena.
+	 * An eighth more, for the free objects in partly used slabs. */
+	if(!(a = hugepage_arena_create(size + size/8, SLAB_SIZE)))
+		return 0;
+	lock_quick_lock(&d->lock);
+	if(d->arena) {
+		lock_quick_unlock(&d->lock);
+		hugepage_arena_delete(a);
+		return 1;
+	}
+	d->arena = a;
+	lock_quick_unlock(&d->lock);
+	verbose(VERB_OPS, "cache slabs in %u MB of huge pages (%s)",
+		(unsigned)(a->size/(1024*1024)), hugepage_type_str(a->type));
+	return 1;
+}
+
+void
+slab_depot_hugepage(struct slab_depot* d, size_t* size, size_t* used,
+	int* type)
+{
+	lock_quick_lock(&d->lock);
+	*size = d->arena?d->arena->size:0;
+	*used = hugepage_arena_get_used(d->arena);
+	*type = d->arena?d->arena->type:HUGEPAGE_NONE;
+	lock_quick_unlock(&d->lock);
+}
+
+size_t
+slab_depot_get_mem(struct slab_depot* d)
+{
+	size_t s = sizeof(*d);
+	int c;
+	lock_quick_lock(&d->lock);
+	for(c=0; c<SLAB_CLASSES; c++) {
+		struct slab_class* cl = &d->cls[c];
+		s += cl->num_slabs * SLAB_SIZE;
+		s += (cl->num_full + cl->num_empty) * sizeof(struct slab_mag);
+	}
+	lock_quick_unlock(&d->lock);
+	return s;
+}
@@ -0,0 +1,274 @@
+/*
+ * util/slaballoc.h - size class slab allocator for cache storage.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Slab allocator for the cache storage, the rrset data and owner names
+ * that are kept in the rrset cache.  Objects are rounded up to a size
+ * class and carved from slabs that contain only that size class, so
+ * that freed memory is reused for objects of the same size and the heap
+ * does not fragment when the cache contents change over time.
+ *
+ * There is one depot per super alloc, with a lock.  Every thread has a
+ * magazine (a small stack of free objects) per size class, so that most
+ * allocations and frees, also of objects that another thread allocated,
+ * do not take a lock.  Full and empty magazines are exchanged with the
+ * depot.  When the depot has enough full magazines, objects are returned
+ * to their slabs, and slabs that are entirely free are released.
+ *
+ * Objects are freed with their size, the same size that was passed to
+ * the allocation, that selects the size class.  Objects that are larger
+ * than the biggest size class are passed to malloc and free.
+ *
+ * The slabs can be carved from a huge page arena, so that a large cache
+ * takes fewer TLB misses.
+ */
+
+#ifndef UTIL_SLABALLOC_H
+#define UTIL_SLABALLOC_H
+#include "util/locks.h"
+#include "util/rbtree.h"
+struct hugepage_arena;
+
+/** size of a slab, that holds objects of one size class */
+#define SLAB_SIZE 65536
+/** number of size classes; 16 byte steps up to 128, then four classes
+ * per power of two up to SLAB_OBJ_MAX */
+#define SLAB_CLASSES 28
+/** largest object size that is allocated in slabs */
+#define SLAB_OBJ_MAX 4096
+/** number of objects in a magazine */
+#define SLAB_MAG_SIZE 32
+/** number of full magazines kept by the depot per size class */
+#define SLAB_DEPOT_MAGS 8
+
+/**
+ * A slab. It is a block of SLAB_SIZE, malloced or from the huge page
+ * arena, with this header at the start, followed by the objects.
+ */
+struct slab {
+	/** node in the depot tree of slabs, by address. key is the slab. */
+	rbnode_type node;
+	/** next slab in the list of slabs with free objects */
+	struct slab* next;
+	/** previous slab in the list of slabs with free objects */
+	struct slab* prev;
+	/** size class */
+	int cls;
+	/** number of free objects */
+	size_t num_free;
+	/** list of free objects that have been used, the next pointer is
+	 * stored at the start of the object */
+	void* free_list;
+	/** start of the unused part of the slab, the objects that have
+	 * never been handed out */
+	uint8_t* unused;
+};
+
+/** A magazine, a stack of free objects of one size class */
+struct slab_mag {
+	/** next magazine in the depot list */
+	struct slab_mag* next;
+	/** number of objects */
+	size_t num;
+	/** the objects */
+	void* obj[SLAB_MAG_SIZE];
+};
+
+/** The slabs and magazines of a size class, in the depot */
+struct slab_class {
+	/** object size */
+	size_t size;
+	/** number of objects per slab */
+	size_t per_slab;
+	/** doubly linked list of slabs with free objects */
+	struct slab* partial;
+	/** number of slabs */
+	size_t num_slabs;
+	/** number of free objects in the slabs */
+	size_t num_free;
+	/** list of full magazines */
+	struct slab_mag* full;
+	/** number of full magazines */
+	size_t num_full;
+	/** list of empty magazines */
+	struct slab_mag* empty;
+	/** number of empty magazines */
+	size_t num_empty;
+};
+
+/**
+ * The depot, with the slabs. Shared by the threads.
+ */
+struct slab_depot {
+	/** lock on the depot */
+	lock_quick_type lock;
+	/** the slabs, by address, to find the slab for an object */
+	rbtree_type slabs;
+	/** the size classes */
+	struct slab_class cls[SLAB_CLASSES];
+	/** number of slabs created */
+	size_t slabs_created;
+	/** number of slabs released */
+	size_t slabs_released;
+	/** huge page arena the slabs are carved from, or NULL.  When it
+	 * is full, slabs are malloced. */
+	struct hugepage_arena* arena;
+};
+
+/**
+ * The thread cache of magazines, one loaded magazine per size class.
+ * If it is shared, it has no magazines and goes to the depot, with
+ * the lock, for every object.
+ */
+struct slab_cache {
+	/** the depot, if NULL malloc and free are used */
+	struct slab_depot* depot;
+	/** if shared by threads, no magazines are used */
+	int shared;
+	/** the loaded magazine per size class, or NULL */
+	struct slab_mag* mag[SLAB_CLASSES];
+};
+
+/** Statistics for a size class */
+struct slab_class_stats {
+	/** object size */
+	size_t size;
+	/** number of slabs */
+	size_t slabs;
+	/** number of objects in the slabs, used and free */
+	size_t objects;
+	/** number of free objects in the slabs */
+	size_t free_slab;
+	/** number of free objects in magazines in the depot */
+	size_t free_mag;
+};
+
+/**
+ * Create a depot.
+ * @return new depot or NULL on alloc failure.
+ */
+struct slab_depot* slab_depot_create(void);
+
+/**
+ * Delete depot, and release all slabs. All thread caches must have
+ * been cleared, and the objects are no longer usable.
+ * @param depot: to delete.
+ */
+void slab_depot_delete(struct slab_depot* depot);
+
+/**
+ * Init a thread cache.
+ * @param sc: the thread cache, allocated by the caller.
+ * @param depot: the depot, if NULL, malloc and free are used.
+ * @param shared: if true, it is used by several threads, and does not
+ *	keep magazines.
+ */
+void slab_cache_init(struct slab_cache* sc, struct slab_depot* depot,
+	int shared);
+
+/**
+ * Clear a thread cache, the objects in its magazines and in the full
+ * magazines of the depot are returned to the slabs.
+ * @param sc: the thread cache.
+ */
+void slab_cache_clear(struct slab_cache* sc);
+
+/**
+ * Allocate an object.
+ * @param sc: thread cache to allocate from.
+ * @param size: size of the object.
+ * @return object (not zeroed) or NULL on alloc failure.
+ */
+void* slab_alloc(struct slab_cache* sc, size_t size);
+
+/**
+ * Free an object.
+ * @param sc: a thread cache with the same depot as the one the object
+ *	was allocated from.
+ * @param p: the object, if NULL nothing happens.
+ * @param size: size of the object, as passed to slab_alloc.
+ */
+void slab_free(struct slab_cache* sc, void* p, size_t size);
+
+/**
+ * The memory that an object takes up, its size rounded up to the size
+ * class. For accounting in the caches.
+ * @param size: size of the object.
+ * @return the memory size.
+ */
+size_t slab_obj_size(size_t size);
+
+/**
+ * Get the statistics of the depot.
+ * @param depot: the depot.
+ * @param st: array of SLAB_CLASSES elements that is filled in.
+ */
+void slab_depot_stats(struct slab_depot* depot, struct slab_class_stats* st);
+
+/**
+ * Carve the slabs from a huge page arena.  If the depot has an arena
+ * already, nothing happens, the slabs in it may still be in use.
+ * @param depot: the depot.
+ * @param size: memory for the objects, the cache size.  Room for the
+ *	free objects in the slabs is added to the size of the arena.
+ * @return false if no huge pages could be obtained, and the slabs are
+ *	malloced.
+ */
+int slab_depot_set_arena(struct slab_depot* depot, size_t size);
+
+/**
+ * Get the huge page use of the depot.
+ * @param depot: the depot.
+ * @param size: returns the size of the arena, 0 if there is none.
+ * @param used: returns the memory of the slabs in the arena.
+ * @param type: returns the type of the huge pages, HUGEPAGE_NONE if
+ *	there is no arena.
+ */
+void slab_depot_hugepage(struct slab_depot* depot, size_t* size,
+	size_t* used, int* type);
+
+/**
+ * Get memory used by the depot, slabs and magazines.
+ * @param depot: the depot.
+ * @return memory in bytes.
+ */
+size_t slab_depot_get_mem(struct slab_depot* depot);
+
+/** compare slabs by address, for the rbtree */
+int slab_cmp(const void* a, const void* b);
+
+#endif /* UTIL_SLABALLOC_H */
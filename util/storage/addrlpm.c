@@ -0,0 +1,362 @@
+/*
+ * util/storage/addrlpm.c - compiled longest prefix match for address trees.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Implementation of the compiled longest prefix match.  The trie is made
+ * with leaf pushing, the leaf of a slot is the longest netblock that
+ * covers the whole slot, so the lookup does not need to remember matches
+ * on the way down, it ends at the first slot without a child.
+ */
+
+#include "config.h"
+#include "util/storage/addrlpm.h"
+#include "util/log.h"
+#include "util/net_help.h"
+
+/** the address bytes, with room to read the bits past the end */
+#define LPM_KEY_LEN 18
+/** number of slots in a node */
+#define LPM_SLOTS (1<<ADDR_LPM_STRIDE)
+
+/** the slot for the address in the node at the depth, in bits */
+#define LPM_SLOT(key, depth) ((unsigned)((((unsigned)(key)[(depth)>>3]<<8) | \
+	(unsigned)(key)[((depth)>>3)+1]) >> (16-ADDR_LPM_STRIDE-((depth)&7))) \
+	& (LPM_SLOTS-1))
+
+/** bitmask of the slot and the slots before it */
+#define LPM_MASK(bit) (((bit)<<1)-1)
+
+#if defined(__GNUC__) || defined(__clang__)
+/** number of bits set */
+#define lpm_popcount(x) __builtin_popcountll(x)
+#else
+/** number of bits set */
+static int
+lpm_popcount(uint64_t x)
+{
+	x = x - ((x >> 1) & (uint64_t)0x5555555555555555ULL);
+	x = (x & (uint64_t)0x3333333333333333ULL) +
+		((x >> 2) & (uint64_t)0x3333333333333333ULL);
+	x = (x + (x >> 4)) & (uint64_t)0x0f0f0f0f0f0f0f0fULL;
+	return (int)((x * (uint64_t)0x0101010101010101ULL) >> 56);
+}
+#endif
+
+/** a netblock of the tree, while the trie is made */
+struct lpm_prefix {
+	/** the address bytes, masked to the netblock size */
+	uint8_t key[LPM_KEY_LEN];
+	/** netblock size */
+	int net;
+	/** the node of the tree */
+	struct addr_tree_node* node;
+};
+
+/** get the trie and the address bytes for the address, or NULL if it is
+ * not IPv4 or IPv6, the tree lookup does not match those either */
+static struct addr_lpm_trie*
+lpm_key(struct addr_lpm* lpm, struct sockaddr_storage* addr,
+	socklen_t addrlen, uint8_t* key)
+{
+	memset(key, 0, LPM_KEY_LEN);
+	if(addr_is_ip6(addr, addrlen)) {
+		memmove(key, &((struct sockaddr_in6*)addr)->sin6_addr, 16);
+		return &lpm->ip6;
+	}
+	if(addrlen == (socklen_t)sizeof(struct sockaddr_in) &&
+		((struct sockaddr_in*)addr)->sin_family == AF_INET) {
+		memmove(key, &((struct sockaddr_in*)addr)->sin_addr, 4);
+		return &lpm->ip4;
+	}
+	return NULL;
+}
+
+/** compare netblocks for qsort, by address and then by size, a netblock
+ * sorts before the netblocks inside it */
+static int
+lpm_prefix_cmp(const void* a, const void* b)
+{
+	const struct lpm_prefix* x = (const struct lpm_prefix*)a;
+	const struct lpm_prefix* y = (const struct lpm_prefix*)b;
+	int r = memcmp(x->key, y->key, LPM_KEY_LEN);
+	if(r != 0)
+		return r;
+	if(x->net < y->net)
+		return -1;
+	if(x->net > y->net)
+		return 1;
+	return 0;
+}
+
+/** add a leaf to the trie */
+static int
+lpm_add_leaf(struct addr_lpm_trie* t, struct addr_tree_node* leaf)
+{
+	if(t->num_leaves == t->max_leaves) {
+		size_t m = t->max_leaves?t->max_leaves*2:LPM_SLOTS;
+		struct addr_tree_node** l = (struct addr_tree_node**)realloc(
+			t->leaves, m*sizeof(*l));
+		if(!l)
+			return 0;
+		t->leaves = l;
+		t->max_leaves = m;
+	}
+	t->leaves[t->num_leaves++] = leaf;
+	return 1;
+}
+
+/** add zeroed nodes to the trie, the first is at the old num_nodes */
+static int
+lpm_add_nodes(struct addr_lpm_trie* t, size_t num)
+{
+	if(t->num_nodes + num > t->max_nodes) {
+		size_t m = t->max_nodes?t->max_nodes:16;
+		struct addr_lpm_node* n;
+		while(m < t->num_nodes + num)
+			m *= 2;
+		n = (struct addr_lpm_node*)realloc(t->nodes, m*sizeof(*n));
+		if(!n)
+			return 0;
+		t->nodes = n;
+		t->max_nodes = m;
+	}
+	memset(&t->nodes[t->num_nodes], 0, num*sizeof(*t->nodes));
+	t->num_nodes += num;
+	return 1;
+}
+
+/**
+ * Fill a node of the trie.
+ * @param t: the trie.
+ * @param idx: index of the node.
+ * @param p: the netblocks, sorted.
+ * @param a: first netblock that is inside the node.
+ * @param b: end of the netblocks inside the node.
+ * @param depth: bits of the address before this node.
+ * @param def: longest netblock that covers the node, or NULL.
+ * @return false on malloc failure.
+ */
+static int
+lpm_build_node(struct addr_lpm_trie* t, size_t idx, struct lpm_prefix* p,
+	size_t a, size_t b, int depth, struct addr_tree_node* def)
+{
+	struct addr_tree_node* slot[LPM_SLOTS];
+	struct addr_tree_node* prev = NULL;
+	uint64_t vec = 0, leafvec = 0;
+	uint32_t base0, base1;
+	size_t i, start, c = 0;
+	unsigned s, first, n;
+
+	for(s=0; s<LPM_SLOTS; s++)
+		slot[s] = def;
+	/* the netblocks that end in this node, in sorted order a netblock
+	 * inside another is set after it */
+	for(i=a; i<b; i++) {
+		if(p[i].net <= depth || p[i].net > depth+ADDR_LPM_STRIDE)
+			continue;
+		first = LPM_SLOT(p[i].key, depth);
+		n = 1u << (depth+ADDR_LPM_STRIDE-p[i].net);
+		for(s=first; s<first+n; s++)
+			slot[s] = p[i].node;
+	}
+	/* the slots with longer netblocks get a child */
+	for(i=a; i<b; i++) {
+		if(p[i].net > depth+ADDR_LPM_STRIDE)
+			vec |= ((uint64_t)1) << LPM_SLOT(p[i].key, depth);
+	}
+	/* the leaves of the other slots, a run of the same leaf once */
+	base0 = (uint32_t)t->num_leaves;
+	for(s=0; s<LPM_SLOTS; s++) {
+		if((vec & (((uint64_t)1)<<s)))
+			continue;
+		if(leafvec == 0 || slot[s] != prev) {
+			if(!lpm_add_leaf(t, slot[s]))
+				return 0;
+			leafvec |= ((uint64_t)1)<<s;
+			prev = slot[s];
+		}
+	}
+	base1 = (uint32_t)t->num_nodes;
+	if(!lpm_add_nodes(t, (size_t)lpm_popcount(vec)))
+		return 0;
+	t->nodes[idx].vec = vec;
+	t->nodes[idx].leafvec = leafvec;
+	t->nodes[idx].base0 = base0;
+	t->nodes[idx].base1 = base1;
+	/* fill the children, the netblocks of a slot are next to each
+	 * other in the sorted list */
+	i = a;
+	for(s=0; s<LPM_SLOTS; s++) {
+		if(!(vec & (((uint64_t)1)<<s)))
+			continue;
+		while(LPM_SLOT(p[i].key, depth) < s)
+			i++;
+		start = i;
+		while(i < b && LPM_SLOT(p[i].key, depth) == s)
+			i++;
+		if(!lpm_build_node(t, base1+c, p, start, i,
+			depth+ADDR_LPM_STRIDE, slot[s]))
+			return 0;
+		c++;
+	}
+	return 1;
+}
+
+/** make the trie from the netblocks */
+static int
+lpm_build(struct addr_lpm_trie* t, struct lpm_prefix* p, size_t num)
+{
+	struct addr_tree_node* def = NULL;
+	size_t i;
+	qsort(p, num, sizeof(*p), lpm_prefix_cmp);
+	/* the /0 netblock covers the root */
+	for(i=0; i<num && p[i].net == 0; i++)
+		def = p[i].node;
+	if(!lpm_add_nodes(t, 1))
+		return 0;
+	if(!lpm_build_node(t, 0, p, 0, num, 0, def))
+		return 0;
+	/* it is not changed after this, give back the unused space */
+	if(t->num_nodes < t->max_nodes) {
+		struct addr_lpm_node* n = (struct addr_lpm_node*)realloc(
+			t->nodes, t->num_nodes*sizeof(*n));
+		if(n) {
+			t->nodes = n;
+			t->max_nodes = t->num_nodes;
+		}
+	}
+	if(t->num_leaves < t->max_leaves) {
+		struct addr_tree_node** l = (struct addr_tree_node**)realloc(
+			t->leaves, t->num_leaves*sizeof(*l));
+		if(l) {
+			t->leaves = l;
+			t->max_leaves = t->num_leaves;
+		}
+	}
+	return 1;
+}
+
+struct addr_lpm* addr_lpm_create(rbtree_type* tree)
+{
+	struct addr_lpm* lpm = (struct addr_lpm*)calloc(1, sizeof(*lpm));
+	struct lpm_prefix* p4, *p6;
+	struct addr_tree_node* node;
+	size_t n4 = 0, n6 = 0;
+	int i, ok;
+	if(!lpm)
+		return NULL;
+	p4 = (struct lpm_prefix*)malloc(sizeof(*p4)*(tree->count+1));
+	p6 = (struct lpm_prefix*)malloc(sizeof(*p6)*(tree->count+1));
+	if(!p4 || !p6) {
+		free(p4);
+		free(p6);
+		free(lpm);
+		return NULL;
+	}
+	RBTREE_FOR(node, struct addr_tree_node*, tree) {
+		struct lpm_prefix* x;
+		struct addr_lpm_trie* t;
+		uint8_t key[LPM_KEY_LEN];
+		if(!(t = lpm_key(lpm, &node->addr, node->addrlen, key)))
+			continue;
+		if(node->net < 0 || node->net > (t==&lpm->ip6?128:32))
+			continue;
+		x = (t==&lpm->ip6)?&p6[n6++]:&p4[n4++];
+		memmove(x->key, key, LPM_KEY_LEN);
+		x->net = node->net;
+		x->node = node;
+		/* the tree is masked already, this makes sure */
+		for(i=0; i<16; i++) {
+			if(i*8 >= x->net)
+				x->key[i] = 0;
+			else if(i*8+8 > x->net)
+				x->key[i] &= (uint8_t)(0xff << (i*8+8-x->net));
+		}
+	}
+	ok = lpm_build(&lpm->ip4, p4, n4) && lpm_build(&lpm->ip6, p6, n6);
+	free(p4);
+	free(p6);
+	if(!ok) {
+		addr_lpm_delete(lpm);
+		return NULL;
+	}
+	return lpm;
+}
+
+void addr_lpm_delete(struct addr_lpm* lpm)
+{
+	if(!lpm)
+		return;
+	free(lpm->ip4.nodes);
+	free(lpm->ip4.leaves);
+	free(lpm->ip6.nodes);
+	free(lpm->ip6.leaves);
+	free(lpm);
+}
+
+struct addr_tree_node* addr_lpm_lookup(struct addr_lpm* lpm,
+	struct sockaddr_storage* addr, socklen_t addrlen)
+{
+	uint8_t key[LPM_KEY_LEN];
+	struct addr_lpm_trie* t = lpm_key(lpm, addr, addrlen, key);
+	struct addr_lpm_node* n;
+	unsigned depth = 0;
+	uint64_t bit;
+	if(!t)
+		return NULL;
+	n = &t->nodes[0];
+	for(;;) {
+		bit = ((uint64_t)1) << LPM_SLOT(key, depth);
+		if(!(n->vec & bit))
+			return t->leaves[n->base0 +
+				lpm_popcount(n->leafvec & LPM_MASK(bit)) - 1];
+		n = &t->nodes[n->base1 + lpm_popcount(n->vec & LPM_MASK(bit))
+			- 1];
+		depth += ADDR_LPM_STRIDE;
+	}
+}
+
+size_t addr_lpm_get_mem(struct addr_lpm* lpm)
+{
+	if(!lpm)
+		return 0;
+	return sizeof(*lpm) +
+		lpm->ip4.max_nodes*sizeof(struct addr_lpm_node) +
+		lpm->ip4.max_leaves*sizeof(struct addr_tree_node*) +
+		lpm->ip6.max_nodes*sizeof(struct addr_lpm_node) +
+		lpm->ip6.max_leaves*sizeof(struct addr_tree_node*);
+}
@@ -0,0 +1,132 @@
+/*
+ * util/storage/addrlpm.h - compiled longest prefix match for address trees.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Compiled longest prefix match for an address tree.  The netblocks of an
+ * addr_tree are compiled into a multibit trie with compressed nodes, like
+ * poptrie: every node looks at 6 bits of the address, and has bitmaps of
+ * the slots with a child node and of the slots where a new leaf starts,
+ * the children and the leaves are stored in arrays and found with a
+ * population count.  The leaves point to the addr_tree_node that is the
+ * longest match, so a lookup returns the same as addr_tree_lookup.
+ * The trie is read only after it is made, for a change of the tree a new
+ * one is compiled.
+ */
+
+#ifndef UTIL_STORAGE_ADDRLPM_H
+#define UTIL_STORAGE_ADDRLPM_H
+#include "util/storage/dnstree.h"
+
+/** number of address bits that a node of the trie looks at */
+#define ADDR_LPM_STRIDE 6
+
+/**
+ * A node of the trie, with 64 slots.
+ */
+struct addr_lpm_node {
+	/** bitmap of the slots that have a child node */
+	uint64_t vec;
+	/** bitmap of the slots, without a child node, where the leaf is
+	 * different from the leaf of the slot before it */
+	uint64_t leafvec;
+	/** index of the first leaf of the node */
+	uint32_t base0;
+	/** index of the first child of the node */
+	uint32_t base1;
+};
+
+/**
+ * The trie for one address family.
+ */
+struct addr_lpm_trie {
+	/** the nodes, the first is the root, the children of a node are
+	 * next to each other */
+	struct addr_lpm_node* nodes;
+	/** number of nodes */
+	size_t num_nodes;
+	/** allocated size of nodes */
+	size_t max_nodes;
+	/** the leaves, the longest matching netblock or NULL */
+	struct addr_tree_node** leaves;
+	/** number of leaves */
+	size_t num_leaves;
+	/** allocated size of leaves */
+	size_t max_leaves;
+};
+
+/**
+ * Compiled address tree.
+ */
+struct addr_lpm {
+	/** trie for IPv4 */
+	struct addr_lpm_trie ip4;
+	/** trie for IPv6 */
+	struct addr_lpm_trie ip6;
+};
+
+/**
+ * Compile the address tree.
+ * @param tree: the addr_tree, the nodes must stay unchanged while the
+ *	compiled version is in use.
+ * @return new structure or NULL on malloc failure.
+ */
+struct addr_lpm* addr_lpm_create(rbtree_type* tree);
+
+/**
+ * Delete the compiled address tree.
+ * @param lpm: to delete, or NULL.
+ */
+void addr_lpm_delete(struct addr_lpm* lpm);
+
+/**
+ * Lookup the longest matching netblock for the address.
+ * @param lpm: the compiled address tree.
+ * @param addr: address to look up.
+ * @param addrlen: length of addr.
+ * @return the addr_tree_node, like addr_tree_lookup, or NULL.
+ */
+struct addr_tree_node* addr_lpm_lookup(struct addr_lpm* lpm,
+	struct sockaddr_storage* addr, socklen_t addrlen);
+
+/**
+ * Get the memory used by the compiled address tree.
+ * @param lpm: the compiled address tree, or NULL.
+ * @return the size in bytes.
+ */
+size_t addr_lpm_get_mem(struct addr_lpm* lpm);
+
+#endif /* UTIL_STORAGE_ADDRLPM_H */
@@ -42,6 +42,7 @@
 
 #include "config.h"
 #include "util/storage/lruhash.h"
+#include "util/hugepage.h"
 #include "util/fptr_wlist.h"
 
 void
@@ -82,6 +83,7 @@ lruhash_create(size_t start_size, size_t maxmem,
 	table->space_used = 0;
 	table->space_max = maxmem;
 	table->array = calloc(table->size, sizeof(struct lruhash_bin));
+	table->array_type = HUGEPAGE_NONE;
 	if(!table->array) {
 		lock_quick_destroy(&table->lock);
 		free(table);
@@ -159,7 +161,8 @@ lruhash_delete(struct lruhash* table)
 	lock_quick_destroy(&table->lock);
 	for(i=0; i<table->size; i++)
 		bin_delete(table, &table->array[i]);
-	free(table->array);
+	hugepage_free(table->array, table->size*sizeof(struct lruhash_bin),
+		table->array_type);
 	free(table);
 }
 
@@ -231,14 +234,17 @@ void
 table_grow(struct lruhash* table)
 {
 	struct lruhash_bin* newa;
-	int newmask;
+	int newmask, newtype = HUGEPAGE_NONE;
 	size_t i;
 	if(table->size_mask == (int)(((size_t)-1)>>1)) {
 		log_err("hash array malloc: size_t too small");
 		return;
 	}
 	/* try to allocate new array, if not fail */
-	newa = calloc(table->size*2, sizeof(struct lruhash_bin));
+	if(table->hugepage)
+		newa = hugepage_calloc(table->size*2*sizeof(struct lruhash_bin),
+			&newtype);
+	else	newa = calloc(table->size*2, sizeof(struct lruhash_bin));
 	if(!newa) {
 		log_err("hash grow: malloc failed");
 		/* continue with smaller array. Though its slower. */
@@ -252,11 +258,13 @@ table_grow(struct lruhash* table)
 	for(i=0; i<table->size; i++) {
 		lock_quick_destroy(&table->array[i].lock);
 	}
-	free(table->array);
+	hugepage_free(table->array, table->size*sizeof(struct lruhash_bin),
+		table->array_type);
 	
 	table->size *= 2;
 	table->size_mask = newmask;
 	table->array = newa;
+	table->array_type = newtype;
 	lock_protect(&table->lock, table->array, 
 		table->size*sizeof(struct lruhash_bin));
 	return;
@@ -512,6 +520,25 @@ lruhash_get_mem(struct lruhash* table)
 	return s;
 }
 
+void
+lruhash_set_hugepage(struct lruhash* table, int on)
+{
+	lock_quick_lock(&table->lock);
+	table->hugepage = on;
+	lock_quick_unlock(&table->lock);
+}
+
+size_t
+lruhash_get_hugepage_mem(struct lruhash* table)
+{
+	size_t s = 0;
+	lock_quick_lock(&table->lock);
+	if(table->array_type != HUGEPAGE_NONE)
+		s = table->size*sizeof(struct lruhash_bin);
+	lock_quick_unlock(&table->lock);
+	return s;
+}
+
 void 
 lruhash_setmarkdel(struct lruhash* table, lruhash_markdelfunc_type md)
 {
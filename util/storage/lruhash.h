@@ -166,6 +166,10 @@ struct lruhash {
 	int size_mask;
 	/** lookup array of bins */
 	struct lruhash_bin* array;
+	/** how the array was allocated, HUGEPAGE_NONE, _THP or _TLB */
+	int array_type;
+	/** if true, large arrays are allocated from huge pages */
+	int hugepage;
 
 	/** the lru list, start and end, noncyclical double linked list. */
 	struct lruhash_entry* lru_start;
@@ -433,6 +437,21 @@ void lruhash_status(struct lruhash* table, const char* id, int extended);
  */
 size_t lruhash_get_mem(struct lruhash* table);
 
+/**
+ * Allocate the lookup array from huge pages, when it is large enough.
+ * The array is moved to huge pages when the table grows.
+ * @param table: hash table. Will be locked before use. And unlocked after.
+ * @param on: if true, use huge pages, if false, malloc.
+ */
+void lruhash_set_hugepage(struct lruhash* table, int on);
+
+/**
+ * Get memory of the lruhash table that is in huge pages.
+ * @param table: hash table. Will be locked before use. And unlocked after.
+ * @return size in bytes of the lookup array, if it is in huge pages.
+ */
+size_t lruhash_get_hugepage_mem(struct lruhash* table);
+
 /**
  * Traverse a lruhash. Call back for every element in the table.
  * @param h: hash table.  Locked before use.
@@ -0,0 +1,208 @@
+/*
+ * util/storage/ratesketch.c - count-min sketch for rates per key.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Implementation of the count-min sketch for rates.  The counters are
+ * updated conservatively, only the rows that have the lowest count for the
+ * key are incremented, that keeps the overestimate small.
+ */
+
+#include "config.h"
+#include "util/storage/ratesketch.h"
+
+/** the counters for the second are in this slot */
+#define RATE_SKETCH_SLOT(t) ((int)((t)&1))
+
+struct rate_sketch* rate_sketch_create(size_t numslabs, size_t maxmem)
+{
+	size_t i, w;
+	struct rate_sketch* sk = (struct rate_sketch*)calloc(1, sizeof(*sk));
+	if(!sk) return NULL;
+	sk->size = numslabs;
+	log_assert(sk->size > 0);
+	/* the width that fits in the memory, with two slots per slab */
+	w = RATE_SKETCH_MIN_WIDTH;
+	while(w*2*sizeof(uint32_t)*RATE_SKETCH_DEPTH*2*numslabs <= maxmem)
+		w *= 2;
+	sk->width = w;
+	sk->slabs = (struct rate_sketch_slab*)calloc(sk->size,
+		sizeof(struct rate_sketch_slab));
+	if(!sk->slabs) {
+		free(sk);
+		return NULL;
+	}
+	for(i=0; i<sk->size; i++) {
+		struct rate_sketch_slab* s = &sk->slabs[i];
+		lock_basic_init(&s->lock);
+		lock_protect(&s->lock, s->sec, sizeof(s->sec));
+		s->cnt[0] = (uint32_t*)calloc(RATE_SKETCH_DEPTH*w,
+			sizeof(uint32_t));
+		s->cnt[1] = (uint32_t*)calloc(RATE_SKETCH_DEPTH*w,
+			sizeof(uint32_t));
+		if(!s->cnt[0] || !s->cnt[1]) {
+			sk->size = i+1;
+			rate_sketch_delete(sk);
+			return NULL;
+		}
+	}
+	sk->mask = (uint32_t)(sk->size - 1);
+	if(sk->mask == 0) {
+		sk->shift = 0;
+	} else {
+		log_assert( (sk->size & sk->mask) == 0
+			/* size must be power of 2 */ );
+		sk->shift = 0;
+		while(!(sk->mask & 0x80000000)) {
+			sk->mask <<= 1;
+			sk->shift ++;
+		}
+	}
+	return sk;
+}
+
+void rate_sketch_delete(struct rate_sketch* sk)
+{
+	size_t i;
+	if(!sk)
+		return;
+	for(i=0; i<sk->size; i++) {
+		lock_basic_destroy(&sk->slabs[i].lock);
+		free(sk->slabs[i].cnt[0]);
+		free(sk->slabs[i].cnt[1]);
+	}
+	free(sk->slabs);
+	free(sk);
+}
+
+/** the slab for the hash */
+static struct rate_sketch_slab*
+rate_sketch_slab(struct rate_sketch* sk, hashvalue_type h)
+{
+	return &sk->slabs[(h & sk->mask) >> sk->shift];
+}
+
+/** the counter positions of the key in the rows; the high bits of the
+ * hash select the slab, the positions are mixed from the whole hash
+ * with a different constant for every row */
+static void
+rate_sketch_pos(struct rate_sketch* sk, hashvalue_type h,
+	size_t pos[RATE_SKETCH_DEPTH])
+{
+	int i;
+	uint32_t x;
+	for(i=0; i<RATE_SKETCH_DEPTH; i++) {
+		x = (uint32_t)h + (uint32_t)(i+1)*0x9e3779b9U;
+		x ^= x >> 16;
+		x *= 0x85ebca6bU;
+		x ^= x >> 13;
+		x *= 0xc2b2ae35U;
+		x ^= x >> 16;
+		pos[i] = (size_t)i*sk->width + (x & (sk->width-1));
+	}
+}
+
+/** the lowest counter of the key in the slot */
+static uint32_t
+rate_sketch_min(uint32_t* cnt, size_t pos[RATE_SKETCH_DEPTH])
+{
+	int i;
+	uint32_t m = cnt[pos[0]];
+	for(i=1; i<RATE_SKETCH_DEPTH; i++)
+		if(cnt[pos[i]] < m)
+			m = cnt[pos[i]];
+	return m;
+}
+
+/** the count in the other slot, if it is recent enough, same window as
+ * the rate_data of the infra cache */
+static uint32_t
+rate_sketch_prev(struct rate_sketch_slab* s, size_t pos[RATE_SKETCH_DEPTH],
+	time_t now)
+{
+	int p = RATE_SKETCH_SLOT(now)^1;
+	if(s->sec[p] == 0 || now - s->sec[p] > 2)
+		return 0;
+	return rate_sketch_min(s->cnt[p], pos);
+}
+
+int rate_sketch_inc(struct rate_sketch* sk, hashvalue_type h, time_t now,
+	int* premax)
+{
+	struct rate_sketch_slab* s = rate_sketch_slab(sk, h);
+	size_t pos[RATE_SKETCH_DEPTH];
+	int i, c = RATE_SKETCH_SLOT(now);
+	uint32_t cur, prev;
+	rate_sketch_pos(sk, h, pos);
+	lock_basic_lock(&s->lock);
+	if(s->sec[c] != now) {
+		/* a new second, start counting again in this slot */
+		memset(s->cnt[c], 0, RATE_SKETCH_DEPTH*sk->width*
+			sizeof(uint32_t));
+		s->sec[c] = now;
+	}
+	cur = rate_sketch_min(s->cnt[c], pos);
+	prev = rate_sketch_prev(s, pos, now);
+	for(i=0; i<RATE_SKETCH_DEPTH; i++)
+		if(s->cnt[c][pos[i]] == cur)
+			s->cnt[c][pos[i]]++;
+	lock_basic_unlock(&s->lock);
+	if(premax)
+		*premax = (int)(cur>prev?cur:prev);
+	cur++;
+	return (int)(cur>prev?cur:prev);
+}
+
+int rate_sketch_get(struct rate_sketch* sk, hashvalue_type h, time_t now)
+{
+	struct rate_sketch_slab* s = rate_sketch_slab(sk, h);
+	size_t pos[RATE_SKETCH_DEPTH];
+	int c = RATE_SKETCH_SLOT(now);
+	uint32_t cur = 0, prev;
+	rate_sketch_pos(sk, h, pos);
+	lock_basic_lock(&s->lock);
+	if(s->sec[c] == now)
+		cur = rate_sketch_min(s->cnt[c], pos);
+	prev = rate_sketch_prev(s, pos, now);
+	lock_basic_unlock(&s->lock);
+	return (int)(cur>prev?cur:prev);
+}
+
+size_t rate_sketch_get_mem(struct rate_sketch* sk)
+{
+	return sizeof(*sk) + sk->size*(sizeof(struct rate_sketch_slab) +
+		2*RATE_SKETCH_DEPTH*sk->width*sizeof(uint32_t));
+}
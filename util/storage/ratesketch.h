@@ -0,0 +1,131 @@
+/*
+ * util/storage/ratesketch.h - count-min sketch for rates per key.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Count-min sketch that counts the rate per second for keys, in a fixed
+ * amount of memory.  It is used for the rates of client addresses, where
+ * the number of keys is not under our control.  The counts are an upper
+ * bound of the real rate, that is exact unless the sketch is too small for
+ * the number of active keys.  The sketch is partitioned in slabs with a
+ * lock each, selected by the high bits of the hash, like the slabhash.
+ */
+
+#ifndef UTIL_STORAGE_RATESKETCH_H
+#define UTIL_STORAGE_RATESKETCH_H
+#include "util/locks.h"
+#include "util/storage/lruhash.h"
+
+/** number of rows, each key has a counter in every row */
+#define RATE_SKETCH_DEPTH 4
+/** minimum number of counters in a row */
+#define RATE_SKETCH_MIN_WIDTH 64
+
+/**
+ * A slab of the sketch, with counters for the current and the previous
+ * second.
+ */
+struct rate_sketch_slab {
+	/** lock on the counters */
+	lock_basic_type lock;
+	/** the second that the counters in the slot are for, slot is the
+	 * second modulo 2 */
+	time_t sec[2];
+	/** the counters, for each slot RATE_SKETCH_DEPTH rows of width */
+	uint32_t* cnt[2];
+};
+
+/**
+ * Count-min sketch for rates.
+ * The structure itself is not changed after creation, only the slabs.
+ */
+struct rate_sketch {
+	/** number of slabs, power of 2 */
+	size_t size;
+	/** size bitmask, uses the high bits of the hash */
+	uint32_t mask;
+	/** shift right this many bits to get the slab number */
+	unsigned int shift;
+	/** number of counters in a row, power of 2 */
+	size_t width;
+	/** the slabs */
+	struct rate_sketch_slab* slabs;
+};
+
+/**
+ * Create a rate sketch.
+ * @param numslabs: number of slabs, power of 2.
+ * @param maxmem: memory to use for the counters, the width of the rows
+ *	is the largest power of 2 that fits.
+ * @return new sketch or NULL on malloc failure.
+ */
+struct rate_sketch* rate_sketch_create(size_t numslabs, size_t maxmem);
+
+/**
+ * Delete the rate sketch.
+ * @param sk: sketch to delete, or NULL.
+ */
+void rate_sketch_delete(struct rate_sketch* sk);
+
+/**
+ * Count one for the key in the current second.
+ * @param sk: the sketch.
+ * @param h: hash of the key.
+ * @param now: the current time.
+ * @param premax: if not NULL, the rate of the key before the increment.
+ * @return the rate of the key, the highest of the current and the
+ *	previous second, after the increment.
+ */
+int rate_sketch_inc(struct rate_sketch* sk, hashvalue_type h, time_t now,
+	int* premax);
+
+/**
+ * Get the rate of the key.
+ * @param sk: the sketch.
+ * @param h: hash of the key.
+ * @param now: the current time.
+ * @return the rate, the highest of the current and the previous second.
+ */
+int rate_sketch_get(struct rate_sketch* sk, hashvalue_type h, time_t now);
+
+/**
+ * Get the memory used by the sketch.
+ * @param sk: the sketch.
+ * @return the size in bytes.
+ */
+size_t rate_sketch_get_mem(struct rate_sketch* sk);
+
+#endif /* UTIL_STORAGE_RATESKETCH_H */
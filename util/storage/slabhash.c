@@ -163,6 +163,21 @@ size_t slabhash_get_mem(struct slabhash* sl)
 	return total;
 }
 
+void slabhash_set_hugepage(struct slabhash* sl, int on)
+{
+	size_t i;
+	for(i=0; i<sl->size; i++)
+		lruhash_set_hugepage(sl->array[i], on);
+}
+
+size_t slabhash_get_hugepage_mem(struct slabhash* sl)
+{
+	size_t i, total = 0;
+	for(i=0; i<sl->size; i++)
+		total += lruhash_get_hugepage_mem(sl->array[i]);
+	return total;
+}
+
 struct lruhash* slabhash_gettable(struct slabhash* sl, hashvalue_type hash)
 {
 	return sl->array[slab_idx(sl, hash)];
@@ -159,6 +159,21 @@ size_t slabhash_get_size(struct slabhash* table);
  */
 size_t slabhash_get_mem(struct slabhash* table);
 
+/**
+ * Allocate the lookup arrays of the tables from huge pages, when they
+ * are large enough.
+ * @param table: hash table.
+ * @param on: if true, use huge pages, if false, malloc.
+ */
+void slabhash_set_hugepage(struct slabhash* table, int on);
+
+/**
+ * Retrieve slab hash memory in huge pages, of the lookup arrays.
+ * @param table: hash table.
+ * @return memory in huge pages.
+ */
+size_t slabhash_get_hugepage_mem(struct slabhash* table);
+
 /**
  * Get lruhash table for a given hash value
  * @param table: slabbed hash table.
@@ -0,0 +1,239 @@
+/*
+ * util/storage/topk.c - streaming top-K tracker for heavy hitters.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Implementation of the Space-Saving top-K tracker.
+ */
+
+#include "config.h"
+#include "util/storage/topk.h"
+#include "util/storage/lookup3.h"
+#include "util/log.h"
+
+struct topk* topk_create(size_t max)
+{
+	size_t tsize = 4;
+	struct topk* t = (struct topk*)calloc(1, sizeof(*t));
+	if(!t) return NULL;
+	log_assert(max > 0);
+	t->max = max;
+	/* keep the table at most half full */
+	while(tsize < max*2)
+		tsize *= 2;
+	t->tablemask = tsize-1;
+	t->entries = (struct topk_entry*)calloc(max, sizeof(*t->entries));
+	t->heap = (size_t*)calloc(max, sizeof(*t->heap));
+	t->table = (int*)malloc(tsize*sizeof(*t->table));
+	if(!t->entries || !t->heap || !t->table) {
+		topk_delete(t);
+		return NULL;
+	}
+	topk_clear(t);
+	return t;
+}
+
+void topk_delete(struct topk* t)
+{
+	if(!t) return;
+	free(t->entries);
+	free(t->heap);
+	free(t->table);
+	free(t);
+}
+
+void topk_clear(struct topk* t)
+{
+	size_t i;
+	t->num = 0;
+	for(i=0; i<=t->tablemask; i++)
+		t->table[i] = -1;
+}
+
+/** swap two elements in the heap */
+static void
+heap_swap(struct topk* t, size_t a, size_t b)
+{
+	size_t x = t->heap[a];
+	t->heap[a] = t->heap[b];
+	t->heap[b] = x;
+	t->entries[t->heap[a]].heap = a;
+	t->entries[t->heap[b]].heap = b;
+}
+
+/** count of the entry at the heap position */
+#define HEAP_CNT(t, i) ((t)->entries[(t)->heap[i]].count)
+
+/** move the heap element up while it is lower than its parent */
+static void
+heap_up(struct topk* t, size_t i)
+{
+	while(i > 0 && HEAP_CNT(t, i) < HEAP_CNT(t, (i-1)/2)) {
+		heap_swap(t, i, (i-1)/2);
+		i = (i-1)/2;
+	}
+}
+
+/** move the heap element down while it is higher than a child */
+static void
+heap_down(struct topk* t, size_t i)
+{
+	size_t c;
+	while((c = i*2+1) < t->num) {
+		if(c+1 < t->num && HEAP_CNT(t, c+1) < HEAP_CNT(t, c))
+			c++;
+		if(HEAP_CNT(t, i) <= HEAP_CNT(t, c))
+			return;
+		heap_swap(t, i, c);
+		i = c;
+	}
+}
+
+/** find the table slot for the key, or the empty slot where it goes */
+static size_t
+table_find(struct topk* t, uint8_t* key, size_t len, uint32_t h)
+{
+	size_t i = h & t->tablemask;
+	while(t->table[i] != -1) {
+		struct topk_entry* e = &t->entries[t->table[i]];
+		if(e->hash == h && e->len == len &&
+			memcmp(e->key, key, len) == 0)
+			return i;
+		i = (i+1) & t->tablemask;
+	}
+	return i;
+}
+
+/** remove the entry from the hash table, and shift the entries after it
+ * back, so that no lookup stops at the hole */
+static void
+table_remove(struct topk* t, struct topk_entry* e)
+{
+	size_t j = table_find(t, e->key, e->len, e->hash), k = j, home;
+	t->table[j] = -1;
+	for(;;) {
+		k = (k+1) & t->tablemask;
+		if(t->table[k] == -1)
+			return;
+		home = t->entries[t->table[k]].hash & t->tablemask;
+		/* the entry can move to j if its home is not in (j, k] */
+		if((j < k)?(home <= j || home > k):(home <= j && home > k)) {
+			t->table[j] = t->table[k];
+			t->table[k] = -1;
+			j = k;
+		}
+	}
+}
+
+void topk_add(struct topk* t, uint8_t* key, size_t len, long long count,
+	long long err)
+{
+	uint32_t h;
+	size_t i, n;
+	struct topk_entry* e;
+	if(len > TOPK_KEY_MAX)
+		len = TOPK_KEY_MAX;
+	h = hashlittle(key, len, 0x7a3c);
+	i = table_find(t, key, len, h);
+	if(t->table[i] != -1) {
+		e = &t->entries[t->table[i]];
+		e->count += count;
+		e->err += err;
+		heap_down(t, e->heap);
+		return;
+	}
+	if(t->num < t->max) {
+		/* a free entry, at the end of the heap */
+		n = t->num++;
+		e = &t->entries[n];
+		t->table[i] = (int)n;
+		t->heap[n] = n;
+		e->heap = n;
+		e->count = count;
+		e->err = err;
+		memmove(e->key, key, len);
+		e->len = len;
+		e->hash = h;
+		heap_up(t, n);
+		return;
+	}
+	/* replace the entry with the lowest count, the new key could have
+	 * been seen that many times while it was not tracked */
+	e = &t->entries[t->heap[0]];
+	table_remove(t, e);
+	e->count += count;
+	e->err = e->count - count + err;
+	memmove(e->key, key, len);
+	e->len = len;
+	e->hash = h;
+	t->table[table_find(t, key, len, h)] = (int)t->heap[0];
+	heap_down(t, 0);
+}
+
+void topk_merge(struct topk* dest, struct topk* src)
+{
+	size_t i;
+	for(i=0; i<src->num; i++)
+		topk_add(dest, src->entries[i].key, src->entries[i].len,
+			src->entries[i].count, src->entries[i].err);
+}
+
+/** compare entries for qsort, highest count first */
+static int
+topk_cmp(const void* a, const void* b)
+{
+	const struct topk_entry* x = *(struct topk_entry* const*)a;
+	const struct topk_entry* y = *(struct topk_entry* const*)b;
+	if(x->count > y->count) return -1;
+	if(x->count < y->count) return 1;
+	return 0;
+}
+
+size_t topk_sorted(struct topk* t, struct topk_entry** list)
+{
+	size_t i;
+	for(i=0; i<t->num; i++)
+		list[i] = &t->entries[i];
+	qsort(list, t->num, sizeof(*list), topk_cmp);
+	return t->num;
+}
+
+size_t topk_get_mem(struct topk* t)
+{
+	if(!t) return 0;
+	return sizeof(*t) + t->max*(sizeof(*t->entries) + sizeof(*t->heap)) +
+		(t->tablemask+1)*sizeof(*t->table);
+}
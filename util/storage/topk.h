@@ -0,0 +1,145 @@
+/*
+ * util/storage/topk.h - streaming top-K tracker for heavy hitters.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ * 
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ * 
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ * 
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ * 
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Space-Saving top-K tracker.  It keeps a fixed number of keys with a
+ * count, and when a key is seen that is not tracked, it takes the place of
+ * the key with the lowest count and starts from that count.  The count is
+ * then an overestimate by at most the recorded error, and every key that
+ * is seen more often than the lowest count in the tracker is in it.
+ * The keys are found with a small open addressing hash table, and the
+ * lowest count with a min-heap.  An update is a hash lookup, a +1 only
+ * moves the entry down the heap past entries with the same count.  The
+ * tracker has no lock, the caller protects it.
+ */
+
+#ifndef UTIL_STORAGE_TOPK_H
+#define UTIL_STORAGE_TOPK_H
+
+/** largest key that can be tracked, a domain name or a sockaddr */
+#define TOPK_KEY_MAX 256
+
+/**
+ * A key that is tracked.
+ */
+struct topk_entry {
+	/** the key */
+	uint8_t key[TOPK_KEY_MAX];
+	/** length of the key */
+	size_t len;
+	/** hash of the key */
+	uint32_t hash;
+	/** index in the heap */
+	size_t heap;
+	/** the count, an upper bound of the number of times it was seen */
+	long long count;
+	/** the count can be this much too high */
+	long long err;
+};
+
+/**
+ * The top-K tracker.
+ */
+struct topk {
+	/** number of keys that are tracked, K */
+	size_t max;
+	/** number of entries in use */
+	size_t num;
+	/** the entries, array of max */
+	struct topk_entry* entries;
+	/** min-heap of entry numbers, by count */
+	size_t* heap;
+	/** hash table of entry numbers, -1 for an empty slot */
+	int* table;
+	/** size of the hash table minus one, size is a power of 2 */
+	size_t tablemask;
+};
+
+/**
+ * Create a top-K tracker.
+ * @param max: number of keys to track, K.
+ * @return new tracker or NULL on malloc failure.
+ */
+struct topk* topk_create(size_t max);
+
+/**
+ * Delete the tracker.
+ * @param t: tracker to delete, or NULL.
+ */
+void topk_delete(struct topk* t);
+
+/**
+ * Remove all entries from the tracker.
+ * @param t: the tracker.
+ */
+void topk_clear(struct topk* t);
+
+/**
+ * Count a key.
+ * @param t: the tracker.
+ * @param key: the key, if longer than TOPK_KEY_MAX it is truncated.
+ * @param len: length of the key.
+ * @param count: the number of times it is seen, 1 per query.
+ * @param err: error on the count, 0 per query.
+ */
+void topk_add(struct topk* t, uint8_t* key, size_t len, long long count,
+	long long err);
+
+/**
+ * Add the entries of a tracker to another tracker, to combine the
+ * counts of several threads.
+ * @param dest: the tracker that is added to.
+ * @param src: the entries of this tracker are added.
+ */
+void topk_merge(struct topk* dest, struct topk* src);
+
+/**
+ * Get the entries sorted from the highest count down.
+ * @param t: the tracker.
+ * @param list: array of t->max pointers, filled with the entries.
+ * @return the number of entries in the list.
+ */
+size_t topk_sorted(struct topk* t, struct topk_entry** list);
+
+/**
+ * Get the memory used by the tracker.
+ * @param t: the tracker.
+ * @return the size in bytes.
+ */
+size_t topk_get_mem(struct topk* t);
+
+#endif /* UTIL_STORAGE_TOPK_H */
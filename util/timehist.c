@@ -46,6 +46,7 @@
 #include <sys/types.h>
 #include "util/timehist.h"
 #include "util/log.h"
+#include "util/locks.h"
 
 /** special timestwo operation for time values in histogram setup */
 static void
@@ -111,7 +112,7 @@ void timehist_clear(struct timehist* hist)
 {
 	size_t i;
 	for(i=0; i<hist->num; i++)
-		hist->buckets[i].count = 0;
+		stat_set(hist->buckets[i].count, 0);
 }
 
 /** histogram compare of time values */
@@ -136,12 +137,12 @@ void timehist_insert(struct timehist* hist, struct timeval* tv)
 	size_t i;
 	for(i=0; i<hist->num; i++) {
 		if(timeval_smaller(tv, &hist->buckets[i].upper)) {
-			hist->buckets[i].count++;
+			stat_inc(hist->buckets[i].count);
 			return;
 		}
 	}
 	/* dump in last bucket */
-	hist->buckets[hist->num-1].count++;
+	stat_inc(hist->buckets[hist->num-1].count);
 }
 
 void timehist_print(struct timehist* hist)
@@ -232,7 +233,7 @@ timehist_export(struct timehist* hist, long long* array, size_t sz)
 	if(sz > hist->num)
 		sz = hist->num;
 	for(i=0; i<sz; i++)
-		array[i] = (long long)hist->buckets[i].count;
+		array[i] = (long long)stat_get(hist->buckets[i].count);
 }
 
 void 
@@ -245,3 +246,88 @@ timehist_import(struct timehist* hist, long long* array, size_t sz)
 	for(i=0; i<sz; i++)
 		hist->buckets[i].count = (size_t)array[i];
 }
+
+size_t
+lathist_bucket(unsigned long long usec)
+{
+	int shift = 0;
+	if(usec < (2<<LATHIST_SUB_BITS))
+		return (size_t)usec;
+	/* shift the value down to the sub bucket bits */
+	while((usec>>shift) >= (2<<LATHIST_SUB_BITS))
+		shift++;
+	if(shift > 30-LATHIST_SUB_BITS)
+		return NUM_BUCKETS_LATHIST-1;
+	return ((size_t)shift<<LATHIST_SUB_BITS) + (size_t)(usec>>shift);
+}
+
+unsigned long long
+lathist_lower(size_t i)
+{
+	size_t shift;
+	if(i < (2<<LATHIST_SUB_BITS))
+		return (unsigned long long)i;
+	shift = (i>>LATHIST_SUB_BITS) - 1;
+	return ((unsigned long long)(i&((1<<LATHIST_SUB_BITS)-1)) +
+		(1<<LATHIST_SUB_BITS)) << shift;
+}
+
+void
+lathist_insert(long long* array, struct timeval* tv)
+{
+	unsigned long long usec = 0;
+#ifndef S_SPLINT_S
+	if(tv->tv_sec > 0 || (tv->tv_sec == 0 && tv->tv_usec > 0))
+		usec = (unsigned long long)tv->tv_sec*1000000 +
+			(unsigned long long)tv->tv_usec;
+#endif
+	stat_inc(array[lathist_bucket(usec)]);
+}
+
+void
+lathist_insert_diff(long long* array, struct timeval* start,
+	struct timeval* end)
+{
+	struct timeval d;
+#ifndef S_SPLINT_S
+	d.tv_sec = end->tv_sec - start->tv_sec;
+	d.tv_usec = end->tv_usec - start->tv_usec;
+	if(d.tv_usec < 0) {
+		d.tv_sec--;
+		d.tv_usec += 1000000;
+	}
+#endif
+	lathist_insert(array, &d);
+}
+
+long long
+lathist_count(long long* array)
+{
+	long long n = 0;
+	size_t i;
+	for(i=0; i<NUM_BUCKETS_LATHIST; i++)
+		n += array[i];
+	return n;
+}
+
+double
+lathist_quantile(long long* array, double q)
+{
+	double lookfor, passed, low, up;
+	size_t i = 0;
+	long long n = lathist_count(array);
+	if(n == 0)
+		return 0.;
+	lookfor = (double)n * q;
+	passed = 0;
+	while(i+1 < NUM_BUCKETS_LATHIST &&
+		passed+(double)array[i] < lookfor) {
+		passed += (double)array[i++];
+	}
+	if(array[i] == 0)
+		return (double)lathist_lower(i)/1000000.;
+	/* interpolate in the bucket */
+	low = (double)lathist_lower(i);
+	up = (double)lathist_lower(i+1);
+	return (low + (lookfor - passed)*(up-low)/(double)array[i])/1000000.;
+}
@@ -45,6 +45,13 @@
 /** Number of buckets in a histogram */
 #define NUM_BUCKETS_HIST 40
 
+/** log2 of the number of sub buckets per power of two in a log-linear
+ * histogram, 8 sub buckets is a precision of 12.5% */
+#define LATHIST_SUB_BITS 3
+/** Number of buckets in a log-linear histogram, microseconds up to
+ * 2**30, about 18 minutes; larger values are counted in the last bucket */
+#define NUM_BUCKETS_LATHIST ((30-LATHIST_SUB_BITS+2)<<LATHIST_SUB_BITS)
+
 /**
  * Bucket of time history information
  */
@@ -131,4 +138,58 @@ void timehist_export(struct timehist* hist, long long* array, size_t sz);
  */
 void timehist_import(struct timehist* hist, long long* array, size_t sz);
 
+/**
+ * Log-linear histograms count time values in microseconds, in an array of
+ * NUM_BUCKETS_LATHIST counters. Below 16 usec every bucket is 1 usec wide,
+ * above that every power of two is split in 8 buckets. The arrays are kept
+ * per thread and added together on read.
+ */
+
+/**
+ * Bucket number for a time value in a log-linear histogram.
+ * @param usec: time in microseconds.
+ * @return index in the array.
+ */
+size_t lathist_bucket(unsigned long long usec);
+
+/**
+ * Lower bound of a bucket in a log-linear histogram, its upper bound is
+ * the lower bound of the next bucket.
+ * @param i: bucket number.
+ * @return time in microseconds.
+ */
+unsigned long long lathist_lower(size_t i);
+
+/**
+ * Count a time value in a log-linear histogram.
+ * @param array: the NUM_BUCKETS_LATHIST counters.
+ * @param tv: the time value, negative is counted as zero.
+ */
+void lathist_insert(long long* array, struct timeval* tv);
+
+/**
+ * Count the time between start and end in a log-linear histogram.
+ * @param array: the NUM_BUCKETS_LATHIST counters.
+ * @param start: start time.
+ * @param end: end time.
+ */
+void lathist_insert_diff(long long* array, struct timeval* start,
+	struct timeval* end);
+
+/**
+ * Find the time value for the given quantile, in a log-linear histogram,
+ * interpolated in its bucket.
+ * @param array: the NUM_BUCKETS_LATHIST counters.
+ * @param q: quantile, 0.99 gives the p99 value. Must be >0 and <1.
+ * @return the time in seconds, or 0 if the histogram is empty.
+ */
+double lathist_quantile(long long* array, double q);
+
+/**
+ * Total number of values in a log-linear histogram.
+ * @param array: the NUM_BUCKETS_LATHIST counters.
+ * @return the count.
+ */
+long long lathist_count(long long* array);
+
 #endif /* UTIL_TIMEHIST_H */
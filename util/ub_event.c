@@ -231,6 +231,12 @@ ub_default_event_base(int sigs, time_t* time_secs, struct timeval* time_tv)
 	return (struct ub_event_base*)base;
 }
 
+struct ub_event_base*
+ub_daemon_event_base(int sigs, time_t* time_secs, struct timeval* time_tv)
+{
+	return ub_default_event_base(sigs, time_secs, time_tv);
+}
+
 struct ub_event_base *
 ub_libevent_event_base(struct event_base* libevent_base)
 {
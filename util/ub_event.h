@@ -71,6 +71,11 @@ void ub_get_event_sys(struct ub_event_base*, const char** n, const char** s,
  * bases used.
  */
 struct ub_event_base* ub_default_event_base(int, time_t*, struct timeval*);
+/** Return the event base for the threads of the daemon. That is the
+ * io_uring event base if it is compiled in, otherwise the default event
+ * base.
+ */
+struct ub_event_base* ub_daemon_event_base(int, time_t*, struct timeval*);
 /** Return an ub_event_base constructed for the given libevent event base */
 struct ub_event_base* ub_libevent_event_base(struct event_base*);
 /** Return the libevent base underlying the given ub_event_base.  Will return
@@ -48,6 +48,7 @@
 #include "util/netevent.h"
 #include "util/log.h"
 #include "util/fptr_wlist.h"
+#include "util/uring_event.h"
 
 /* We define libevent structures here to hide the libevent stuff. */
 
@@ -387,6 +388,19 @@ ub_default_event_base(int sigs, time_t* time_secs, struct timeval* time_tv)
 	return &my_base->super;
 }
 
+struct ub_event_base*
+ub_daemon_event_base(int sigs, time_t* time_secs, struct timeval* time_tv)
+{
+#ifdef USE_IO_URING
+	/* io_uring, that falls back to epoll, libunbound contexts get the
+	 * default event base */
+	(void)sigs;
+	return ub_uring_event_base(time_secs, time_tv, 1);
+#else
+	return ub_default_event_base(sigs, time_secs, time_tv);
+#endif
+}
+
 struct ub_event_base*
 ub_libevent_event_base(struct event_base* base)
 {
@@ -437,6 +451,14 @@ void
 ub_get_event_sys(struct ub_event_base* ub_base, const char** n, const char** s,
 	const char** m)
 {
+#ifdef USE_IO_URING
+	if(ub_uring_event_method(ub_base)) {
+		*n = "pluggable-event";
+		*s = "uring-event-"PACKAGE_VERSION;
+		*m = ub_uring_event_method(ub_base);
+		return;
+	}
+#endif
 #ifdef USE_WINSOCK
 	(void)ub_base;
 	*n = "pluggable-event";
@@ -681,6 +703,11 @@ void ub_comm_base_now(struct comm_base* cb)
 	    comm_base_internal(cb)->vmt == &default_event_base_vmt)
 		return; /* Actually using mini event, so do not set time */
 #endif /* USE_MINI_EVENT */
+#ifdef USE_IO_URING
+/** the io_uring event base updates the time when it blocks. */
+	if(ub_uring_event_method(comm_base_internal(cb)))
+		return;
+#endif /* USE_IO_URING */
 
 /** fillup the time values in the event base */
 	comm_base_timept(cb, &tt, &tv);
@@ -0,0 +1,1527 @@
+/*
+ * util/uring_event.c - io_uring and epoll event backend for the comm_base.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * Event base for the pluggable event interface, with io_uring or epoll.
+ * The operations on the ring are tagged with the slot number of the event
+ * and a tag that changes every time the event is armed, so that the
+ * completions of operations that have been cancelled, or of events that
+ * have been freed, are recognized and ignored.
+ */
+
+#include "config.h"
+#ifdef HAVE_TIME_H
+#include <time.h>
+#endif
+#include <sys/time.h>
+#include "util/uring_event.h"
+
+#ifdef USE_IO_URING
+#include <signal.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <endian.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/epoll.h>
+#include <linux/io_uring.h>
+#include "libunbound/unbound-event.h"
+#include "util/netevent.h"
+#include "util/net_help.h"
+#include "util/log.h"
+#include "util/fptr_wlist.h"
+#include "util/rbtree.h"
+#include "sldns/sbuffer.h"
+
+/** number of entries in the submission queue */
+#define URING_ENTRIES 256
+/** number of entries in the completion queue, a burst of datagrams on
+ * the multishot receives makes many completions */
+#define URING_CQ_ENTRIES 2048
+/** number of provided buffers for the UDP receives, a power of two */
+#define URING_BUF_NUM 256
+/** size of a provided buffer, room for the recvmsg header, the address
+ * and a datagram of the maximum size */
+#define URING_BUF_SIZE 69632
+/** buffer group of the provided buffers */
+#define URING_BUF_GROUP 0
+/** number of UDP replies that can be in flight */
+#define URING_SEND_NUM 256
+/** largest UDP reply that is queued, larger ones are sent with sendto */
+#define URING_SEND_SIZE 4096
+/** number of registered files, for the UDP listening sockets */
+#define URING_FILES 64
+/** max number of epoll events per wait */
+#define URING_EPOLL_EVENTS 128
+/** max number of signals to support */
+#define URING_MAX_SIG 32
+/** slot number for operations whose completion is not used, cancels */
+#define URING_SLOT_NONE 0xffffffff
+/** slot number for the UDP replies, the tag is the index of the reply */
+#define URING_SLOT_SEND 0xfffffffe
+/** the user data of an operation, from the slot and the tag */
+#define URING_UDATA(slot, tag) ((((uint64_t)(tag))<<32) | (uint64_t)(slot))
+
+/** the method that the event base uses */
+enum uring_method {
+	/** io_uring */
+	uring_method_io_uring = 0,
+	/** epoll */
+	uring_method_epoll
+};
+
+/** A UDP reply that is queued */
+struct uring_send {
+	/** next in the free list */
+	struct uring_send* next;
+	/** message header for the sendmsg */
+	struct msghdr msg;
+	/** the io vector with the data */
+	struct iovec iov;
+	/** destination address */
+	struct sockaddr_storage addr;
+	/** the reply */
+	uint8_t data[URING_SEND_SIZE];
+};
+
+struct uring_event;
+
+/** The event base */
+struct uring_base {
+	/** the pluggable event base, first in the struct */
+	struct ub_event_base super;
+	/** io_uring or epoll */
+	enum uring_method method;
+	/** sorted by timeout (absolute), ptr */
+	rbtree_type times;
+	/** if we need to exit */
+	int need_to_exit;
+	/** where to store time in seconds */
+	time_t* time_secs;
+	/** where to store time in microseconds */
+	struct timeval* time_tv;
+	/** the events, by slot number, NULL for free slots */
+	struct uring_event** slots;
+	/** stack of free slot numbers */
+	uint32_t* free_slots;
+	/** number of free slot numbers on the stack */
+	uint32_t num_free;
+	/** number of slots */
+	uint32_t num_slots;
+	/** the last tag that was used, the tag 0 is not used */
+	uint32_t last_tag;
+	/** the signal events, by signal number */
+	struct uring_event* signals[URING_MAX_SIG];
+	/** pipe that the signal handler writes to, -1 if not created */
+	int sigpipe[2];
+	/** event on the read end of the signal pipe */
+	struct uring_event* sigev;
+
+	/** epoll fd, or -1 */
+	int epfd;
+
+	/** io_uring fd, or -1 */
+	int ring_fd;
+	/** fd for io_uring_enter, the ring fd or the registered ring fd */
+	int enter_fd;
+	/** flags for io_uring_enter, for a registered ring fd */
+	unsigned enter_flags;
+	/** if the registration of the ring fd is done */
+	int ring_fd_done;
+	/** mmapped submission queue ring, or NULL */
+	void* sq_ring;
+	/** size of the sq ring */
+	size_t sq_ring_size;
+	/** mmapped completion queue ring, can be the same as the sq ring */
+	void* cq_ring;
+	/** size of the cq ring */
+	size_t cq_ring_size;
+	/** mmapped submission queue entries, or NULL */
+	struct io_uring_sqe* sqes;
+	/** size of the sqes */
+	size_t sqes_size;
+	/** head of the sq, in the ring */
+	unsigned* sq_khead;
+	/** tail of the sq, in the ring */
+	unsigned* sq_ktail;
+	/** mask for the sq */
+	unsigned sq_mask;
+	/** number of entries in the sq */
+	unsigned sq_entries;
+	/** our tail of the sq */
+	unsigned sq_tail;
+	/** number of entries that are not submitted */
+	unsigned sq_pending;
+	/** head of the cq, in the ring */
+	unsigned* cq_khead;
+	/** tail of the cq, in the ring */
+	unsigned* cq_ktail;
+	/** mask for the cq */
+	unsigned cq_mask;
+	/** the completion queue entries */
+	struct io_uring_cqe* cqes;
+	/** the provided buffer ring, or NULL */
+	struct io_uring_buf_ring* br;
+	/** size of the provided buffer ring */
+	size_t br_size;
+	/** our tail of the provided buffer ring */
+	uint16_t br_tail;
+	/** the provided buffers, or NULL */
+	uint8_t* bufs;
+	/** message header for the multishot recvmsg, with the size of the
+	 * address and no control data */
+	struct msghdr recv_msg;
+	/** if the registered files are available */
+	int have_files;
+	/** the registered files that are in use */
+	uint8_t files[URING_FILES];
+	/** the UDP replies, URING_SEND_NUM of them */
+	struct uring_send* sends;
+	/** the free UDP replies */
+	struct uring_send* send_free;
+	/** if the kernel has no multishot recvmsg, poll is used */
+	int no_multishot;
+	/** events that could not be armed again after a completion,
+	 * because the submission queue was full, they are armed before
+	 * the next wait */
+	struct uring_event* rearm_list;
+};
+
+/** An event */
+struct uring_event {
+	/** the pluggable event, first in the struct */
+	struct ub_event super;
+	/** node in timeout rbtree, the key is the event */
+	rbnode_type node;
+	/** event base it belongs to */
+	struct uring_base* base;
+	/** fd to poll or -1 for timeouts. signal number for sigs. */
+	int fd;
+	/** what events this event is interested in, see UB_EV_.. */
+	short bits;
+	/** callback to call: fd, eventbits, userarg */
+	void (*cb)(int, short, void*);
+	/** callback user arg */
+	void* arg;
+	/** is event added */
+	int added;
+	/** is the timeout in the tree */
+	int timer_set;
+	/** timeout value, absolute */
+	struct timeval timeout;
+	/** slot number of the event */
+	uint32_t slot;
+	/** tag of the poll or recvmsg in flight, or of the epoll
+	 * registration, 0 if there is none */
+	uint32_t tag;
+	/** if the fd is a UDP listening socket, that is received with a
+	 * multishot recvmsg */
+	int recv_udp;
+	/** index in the registered files, or -1 */
+	int fixed;
+	/** if the event is in the rearm list */
+	int rearm;
+	/** next in the rearm list */
+	struct uring_event* rearm_next;
+};
+
+#define AS_URING_BASE(x) ((struct uring_base*)x)
+#define AS_URING_EVENT(x) ((struct uring_event*)x)
+
+/** which base gets to handle signals */
+static struct uring_base* uring_signal_base = NULL;
+/** signals that have been caught and need their callback */
+static volatile sig_atomic_t uring_signal_caught[URING_MAX_SIG];
+
+static struct ub_event_vmt uring_event_vmt;
+static struct ub_event_base_vmt uring_event_base_vmt;
+
+/** compare events in tree, based on timevalue, ptr for uniqueness */
+int uring_ev_cmp(const void* a, const void* b)
+{
+	const struct uring_event *e = (const struct uring_event*)a;
+	const struct uring_event *f = (const struct uring_event*)b;
+	if(e->timeout.tv_sec < f->timeout.tv_sec)
+		return -1;
+	if(e->timeout.tv_sec > f->timeout.tv_sec)
+		return 1;
+	if(e->timeout.tv_usec < f->timeout.tv_usec)
+		return -1;
+	if(e->timeout.tv_usec > f->timeout.tv_usec)
+		return 1;
+	if(e < f)
+		return -1;
+	if(e > f)
+		return 1;
+	return 0;
+}
+
+/** set time */
+static int
+settime(struct uring_base* b)
+{
+	if(gettimeofday(b->time_tv, NULL) < 0) {
+		return -1;
+	}
+	*b->time_secs = (time_t)b->time_tv->tv_sec;
+	return 0;
+}
+
+/** io_uring_setup system call */
+static int
+sys_io_uring_setup(unsigned entries, struct io_uring_params* p)
+{
+	return (int)syscall(__NR_io_uring_setup, entries, p);
+}
+
+/** io_uring_enter system call */
+static int
+sys_io_uring_enter(int fd, unsigned to_submit, unsigned min_complete,
+	unsigned flags, void* arg, size_t argsz)
+{
+	return (int)syscall(__NR_io_uring_enter, fd, to_submit, min_complete,
+		flags, arg, argsz);
+}
+
+/** io_uring_register system call */
+static int
+sys_io_uring_register(int fd, unsigned opcode, void* arg, unsigned nr_args)
+{
+	return (int)syscall(__NR_io_uring_register, fd, opcode, arg, nr_args);
+}
+
+/** get a new tag, it is not 0 */
+static uint32_t
+uring_tag(struct uring_base* b)
+{
+	if(++b->last_tag == 0)
+		b->last_tag = 1;
+	return b->last_tag;
+}
+
+/** give the event a slot number, false on alloc failure */
+static int
+uring_slot_new(struct uring_base* b, struct uring_event* ev)
+{
+	if(b->num_free == 0) {
+		uint32_t i, num = (b->num_slots?b->num_slots*2:64);
+		struct uring_event** s;
+		uint32_t* f;
+		if(num >= URING_SLOT_SEND)
+			return 0;
+		s = (struct uring_event**)reallocarray(b->slots, num,
+			sizeof(*s));
+		if(!s)
+			return 0;
+		b->slots = s;
+		f = (uint32_t*)reallocarray(b->free_slots, num, sizeof(*f));
+		if(!f)
+			return 0;
+		b->free_slots = f;
+		/* push the new slots, the lowest on top */
+		for(i=num; i>b->num_slots; i--) {
+			b->slots[i-1] = NULL;
+			b->free_slots[b->num_free++] = i-1;
+		}
+		b->num_slots = num;
+	}
+	ev->slot = b->free_slots[--b->num_free];
+	b->slots[ev->slot] = ev;
+	return 1;
+}
+
+/** submit the queued entries to the ring */
+static void
+uring_submit(struct uring_base* b)
+{
+	int ret;
+	if(b->sq_pending == 0)
+		return;
+	ret = sys_io_uring_enter(b->enter_fd, b->sq_pending, 0,
+		b->enter_flags, NULL, 0);
+	if(ret < 0) {
+		if(errno != EINTR && errno != EAGAIN && errno != EBUSY)
+			log_err("io_uring_enter: %s", strerror(errno));
+		return;
+	}
+	if((unsigned)ret > b->sq_pending)
+		ret = (int)b->sq_pending;
+	b->sq_pending -= (unsigned)ret;
+}
+
+/** get a submission queue entry, it is zeroed, or NULL if the queue is
+ * full */
+static struct io_uring_sqe*
+uring_get_sqe(struct uring_base* b)
+{
+	struct io_uring_sqe* sqe;
+	unsigned head = __atomic_load_n(b->sq_khead, __ATOMIC_ACQUIRE);
+	if(b->sq_tail - head >= b->sq_entries) {
+		/* the queue is full, submit it now */
+		uring_submit(b);
+		head = __atomic_load_n(b->sq_khead, __ATOMIC_ACQUIRE);
+		if(b->sq_tail - head >= b->sq_entries) {
+			verbose(VERB_ALGO, "io_uring submission queue is "
+				"full");
+			return NULL;
+		}
+	}
+	sqe = &b->sqes[b->sq_tail & b->sq_mask];
+	memset(sqe, 0, sizeof(*sqe));
+	return sqe;
+}
+
+/** queue the entry from uring_get_sqe, it is submitted with the next
+ * wait for events */
+static void
+uring_queue_sqe(struct uring_base* b)
+{
+	b->sq_tail++;
+	__atomic_store_n(b->sq_ktail, b->sq_tail, __ATOMIC_RELEASE);
+	b->sq_pending++;
+}
+
+/** give a provided buffer back to the ring */
+static void
+uring_buf_put(struct uring_base* b, uint16_t bid)
+{
+	struct io_uring_buf* buf = &b->br->bufs[b->br_tail&(URING_BUF_NUM-1)];
+	if(bid >= URING_BUF_NUM)
+		return;
+	buf->addr = (uint64_t)(uintptr_t)(b->bufs + (size_t)bid*URING_BUF_SIZE);
+	buf->len = URING_BUF_SIZE;
+	buf->bid = bid;
+	b->br_tail++;
+	__atomic_store_n(&b->br->tail, b->br_tail, __ATOMIC_RELEASE);
+}
+
+/** register the fd of the event in the files of the ring */
+static void
+uring_file_register(struct uring_base* b, struct uring_event* ev)
+{
+	struct io_uring_files_update up;
+	int i, fd = ev->fd;
+	if(!b->have_files || ev->fixed != -1)
+		return;
+	for(i=0; i<URING_FILES; i++)
+		if(!b->files[i])
+			break;
+	if(i == URING_FILES)
+		return;
+	memset(&up, 0, sizeof(up));
+	up.offset = (uint32_t)i;
+	up.fds = (uint64_t)(uintptr_t)&fd;
+	if(sys_io_uring_register(b->ring_fd, IORING_REGISTER_FILES_UPDATE,
+		&up, 1) != 1) {
+		verbose(VERB_ALGO, "io_uring register file: %s",
+			strerror(errno));
+		return;
+	}
+	b->files[i] = 1;
+	ev->fixed = i;
+}
+
+/** remove the fd of the event from the files of the ring, so that the
+ * socket is closed when the fd is closed */
+static void
+uring_file_unregister(struct uring_base* b, struct uring_event* ev)
+{
+	struct io_uring_files_update up;
+	int fd = -1;
+	if(ev->fixed == -1)
+		return;
+	/* queued replies refer to the file index, send them first */
+	uring_submit(b);
+	memset(&up, 0, sizeof(up));
+	up.offset = (uint32_t)ev->fixed;
+	up.fds = (uint64_t)(uintptr_t)&fd;
+	if(sys_io_uring_register(b->ring_fd, IORING_REGISTER_FILES_UPDATE,
+		&up, 1) != 1)
+		log_err("io_uring unregister file: %s", strerror(errno));
+	b->files[ev->fixed] = 0;
+	ev->fixed = -1;
+}
+
+/** arm the poll, or the multishot recvmsg, for the event */
+static int
+uring_arm(struct uring_base* b, struct uring_event* ev)
+{
+	struct io_uring_sqe* sqe = uring_get_sqe(b);
+	if(!sqe)
+		return 0;
+	ev->tag = uring_tag(b);
+	if(ev->recv_udp) {
+		sqe->opcode = IORING_OP_RECVMSG;
+		if(ev->fixed != -1) {
+			sqe->fd = ev->fixed;
+			sqe->flags |= IOSQE_FIXED_FILE;
+		} else	sqe->fd = ev->fd;
+		sqe->flags |= IOSQE_BUFFER_SELECT;
+		sqe->buf_group = URING_BUF_GROUP;
+		sqe->ioprio = IORING_RECV_MULTISHOT;
+		sqe->addr = (uint64_t)(uintptr_t)&b->recv_msg;
+		sqe->len = 1;
+	} else {
+		uint32_t mask = 0;
+		if(ev->bits & UB_EV_READ)
+			mask |= POLLIN;
+		if(ev->bits & UB_EV_WRITE)
+			mask |= POLLOUT;
+#if __BYTE_ORDER == __BIG_ENDIAN
+		mask = (mask << 16) | (mask >> 16);
+#endif
+		sqe->opcode = IORING_OP_POLL_ADD;
+		sqe->fd = ev->fd;
+		sqe->poll32_events = mask;
+	}
+	sqe->user_data = URING_UDATA(ev->slot, ev->tag);
+	uring_queue_sqe(b);
+	return 1;
+}
+
+/** arm the event again after a completion, if that fails it is put in
+ * the rearm list, and armed again before the next wait */
+static void
+uring_rearm(struct uring_base* b, struct uring_event* ev)
+{
+	if(uring_arm(b, ev) || ev->rearm)
+		return;
+	verbose(VERB_OPS, "io_uring submission queue full, arm fd %d later",
+		ev->fd);
+	ev->rearm = 1;
+	ev->rearm_next = b->rearm_list;
+	b->rearm_list = ev;
+}
+
+/** remove the event from the rearm list */
+static void
+uring_rearm_remove(struct uring_base* b, struct uring_event* ev)
+{
+	struct uring_event** pp;
+	if(!ev->rearm)
+		return;
+	for(pp = &b->rearm_list; *pp; pp = &(*pp)->rearm_next) {
+		if(*pp == ev) {
+			*pp = ev->rearm_next;
+			break;
+		}
+	}
+	ev->rearm = 0;
+	ev->rearm_next = NULL;
+}
+
+/** arm the events in the rearm list, the ones that fail stay in it */
+static void
+uring_rearm_list(struct uring_base* b)
+{
+	struct uring_event** pp = &b->rearm_list, *ev;
+	while((ev = *pp) != NULL) {
+		if(!uring_arm(b, ev)) {
+			pp = &ev->rearm_next;
+			continue;
+		}
+		*pp = ev->rearm_next;
+		ev->rearm = 0;
+		ev->rearm_next = NULL;
+	}
+}
+
+/** cancel the operation in flight for the event */
+static void
+uring_cancel(struct uring_base* b, struct uring_event* ev)
+{
+	struct io_uring_sqe* sqe;
+	if(ev->tag == 0)
+		return;
+	/* if the cancel is not queued, the completion is ignored because
+	 * the tag is gone */
+	sqe = uring_get_sqe(b);
+	if(sqe) {
+		sqe->opcode = IORING_OP_ASYNC_CANCEL;
+		sqe->fd = -1;
+		sqe->addr = URING_UDATA(ev->slot, ev->tag);
+		sqe->user_data = URING_UDATA(URING_SLOT_NONE, 0);
+		uring_queue_sqe(b);
+	}
+	ev->tag = 0;
+}
+
+/** add the fd of the event to epoll */
+static int
+uring_epoll_add(struct uring_base* b, struct uring_event* ev)
+{
+	struct epoll_event ee;
+	memset(&ee, 0, sizeof(ee));
+	if(ev->bits & UB_EV_READ)
+		ee.events |= EPOLLIN;
+	if(ev->bits & UB_EV_WRITE)
+		ee.events |= EPOLLOUT;
+	ev->tag = uring_tag(b);
+	ee.data.u64 = URING_UDATA(ev->slot, ev->tag);
+	if(epoll_ctl(b->epfd, EPOLL_CTL_ADD, ev->fd, &ee) == -1) {
+		/* the fd is there for an event that has not removed it,
+		 * it is replaced by this event */
+		if(errno != EEXIST ||
+			epoll_ctl(b->epfd, EPOLL_CTL_MOD, ev->fd, &ee) == -1) {
+			log_err("epoll_ctl add fd %d: %s", ev->fd,
+				strerror(errno));
+			ev->tag = 0;
+			return 0;
+		}
+	}
+	return 1;
+}
+
+/** remove the fd of the event from epoll */
+static void
+uring_epoll_del(struct uring_base* b, struct uring_event* ev)
+{
+	struct epoll_event ee;
+	if(ev->tag == 0)
+		return;
+	memset(&ee, 0, sizeof(ee));
+	/* it fails if the fd is closed already, then it is removed */
+	(void)epoll_ctl(b->epfd, EPOLL_CTL_DEL, ev->fd, &ee);
+	ev->tag = 0;
+}
+
+/** remove event, you may change it again */
+static int
+uring_event_del(struct ub_event* ev)
+{
+	struct uring_event* e = AS_URING_EVENT(ev);
+	struct uring_base* b = e->base;
+	if(e->timer_set) {
+		(void)rbtree_delete(&b->times, e);
+		e->timer_set = 0;
+	}
+	if(b->method == uring_method_epoll) {
+		uring_epoll_del(b, e);
+	} else {
+		uring_rearm_remove(b, e);
+		uring_cancel(b, e);
+		uring_file_unregister(b, e);
+	}
+	e->added = 0;
+	return 0;
+}
+
+/** add event to make it active, with a timeout if it has UB_EV_TIMEOUT */
+static int
+uring_event_add(struct ub_event* ev, struct timeval* tv)
+{
+	struct uring_event* e = AS_URING_EVENT(ev);
+	struct uring_base* b = e->base;
+	if(e->added)
+		(void)uring_event_del(ev);
+	if((e->bits&(UB_EV_READ|UB_EV_WRITE)) && e->fd != -1) {
+		if(b->method == uring_method_epoll) {
+			if(!uring_epoll_add(b, e))
+				return -1;
+		} else {
+			if(e->recv_udp)
+				uring_file_register(b, e);
+			if(!uring_arm(b, e))
+				return -1;
+		}
+	}
+	if(tv && (e->bits&UB_EV_TIMEOUT)) {
+		struct timeval *now = b->time_tv;
+		e->timeout.tv_sec = tv->tv_sec + now->tv_sec;
+		e->timeout.tv_usec = tv->tv_usec + now->tv_usec;
+		while(e->timeout.tv_usec >= 1000000) {
+			e->timeout.tv_usec -= 1000000;
+			e->timeout.tv_sec++;
+		}
+		(void)rbtree_insert(&b->times, &e->node);
+		e->timer_set = 1;
+	}
+	e->added = 1;
+	return 0;
+}
+
+/** call the callback of the event */
+static void
+uring_event_callback(struct uring_event* ev, short bits)
+{
+	fptr_ok(fptr_whitelist_event(ev->cb));
+	(*ev->cb)(ev->fd, bits, ev->arg);
+}
+
+/** handle the completion of a poll */
+static void
+uring_poll_done(struct uring_base* b, struct uring_event* ev, int res)
+{
+	short bits = 0;
+	ev->tag = 0;
+	if(res < 0) {
+		/* the fd is not usable, it is reported to the callback like
+		 * epoll reports an error, the read or write fails there */
+		verbose(VERB_ALGO, "io_uring poll fd %d: %s", ev->fd,
+			strerror(-res));
+		res = POLLERR;
+	}
+	if((res&(POLLIN|POLLERR|POLLHUP)))
+		bits |= UB_EV_READ;
+	if((res&(POLLOUT|POLLERR|POLLHUP)))
+		bits |= UB_EV_WRITE;
+	bits &= ev->bits;
+	/* arm it again before the callback, the callback can delete or
+	 * free the event, and that cancels it */
+	if((ev->bits&UB_EV_PERSIST) || !bits)
+		uring_rearm(b, ev);
+	else	(void)uring_event_del(&ev->super);
+	if(bits)
+		uring_event_callback(ev, bits);
+}
+
+/** handle the completion of the multishot recvmsg */
+static void
+uring_recv_done(struct uring_base* b, struct uring_event* ev, int res,
+	uint32_t flags)
+{
+	struct io_uring_recvmsg_out* out;
+	uint8_t* buf, *payload;
+	size_t hdr, len;
+	socklen_t namelen;
+	uint16_t bid;
+	if(!(flags&IORING_CQE_F_MORE)) {
+		/* the multishot recvmsg has stopped, if it ran out of
+		 * buffers it is started again, for other errors it falls
+		 * back to poll */
+		ev->tag = 0;
+		if(res == -EINVAL && !(flags&IORING_CQE_F_BUFFER)) {
+			verbose(VERB_ALGO, "io_uring has no multishot "
+				"recvmsg, use poll");
+			b->no_multishot = 1;
+			ev->recv_udp = 0;
+		} else if(res < 0 && res != -ENOBUFS && res != -EINTR) {
+			log_err("io_uring recvmsg fd %d: %s, use poll", ev->fd,
+				strerror(-res));
+			ev->recv_udp = 0;
+		}
+		uring_rearm(b, ev);
+	}
+	if(!(flags&IORING_CQE_F_BUFFER))
+		return;
+	bid = (uint16_t)(flags >> IORING_CQE_BUFFER_SHIFT);
+	buf = b->bufs + (size_t)bid*URING_BUF_SIZE;
+	out = (struct io_uring_recvmsg_out*)buf;
+	hdr = sizeof(*out) + b->recv_msg.msg_namelen +
+		b->recv_msg.msg_controllen;
+	if(res < (int)hdr || bid >= URING_BUF_NUM) {
+		uring_buf_put(b, bid);
+		return;
+	}
+	payload = buf + hdr;
+	len = (size_t)res - hdr;
+	namelen = (socklen_t)out->namelen;
+	if(namelen > (socklen_t)b->recv_msg.msg_namelen)
+		namelen = (socklen_t)b->recv_msg.msg_namelen;
+	comm_point_udp_recv((struct comm_point*)ev->arg, payload, len,
+		(struct sockaddr*)(buf + sizeof(*out)), namelen);
+	uring_buf_put(b, bid);
+}
+
+/** handle the completion of a UDP reply */
+static void
+uring_send_done(struct uring_base* b, uint32_t idx, int res)
+{
+	struct uring_send* s;
+	if(idx >= URING_SEND_NUM)
+		return;
+	s = &b->sends[idx];
+	if(res < 0) {
+		verbose(VERB_OPS, "sendmsg failed: %s", strerror(-res));
+		log_addr(VERB_OPS, "remote address is", &s->addr,
+			s->msg.msg_namelen);
+	}
+	s->next = b->send_free;
+	b->send_free = s;
+}
+
+/** handle a completion */
+static void
+uring_handle_cqe(struct uring_base* b, uint64_t udata, int res,
+	uint32_t flags)
+{
+	uint32_t slot = (uint32_t)(udata&0xffffffff);
+	uint32_t tag = (uint32_t)(udata>>32);
+	struct uring_event* ev;
+	if(slot == URING_SLOT_SEND) {
+		uring_send_done(b, tag, res);
+		return;
+	}
+	ev = (slot < b->num_slots ? b->slots[slot] : NULL);
+	if(!ev || tag == 0 || ev->tag != tag) {
+		/* the operation was cancelled or the event was freed */
+		if((flags&IORING_CQE_F_BUFFER))
+			uring_buf_put(b, (uint16_t)(flags >>
+				IORING_CQE_BUFFER_SHIFT));
+		return;
+	}
+	if(ev->recv_udp)
+		uring_recv_done(b, ev, res, flags);
+	else	uring_poll_done(b, ev, res);
+}
+
+/** handle the completions that are in the completion queue */
+static void
+uring_handle_cqes(struct uring_base* b)
+{
+	unsigned head = *b->cq_khead;
+	unsigned tail = __atomic_load_n(b->cq_ktail, __ATOMIC_ACQUIRE);
+	while(head != tail) {
+		struct io_uring_cqe* cqe = &b->cqes[head&b->cq_mask];
+		uint64_t udata = cqe->user_data;
+		int res = cqe->res;
+		uint32_t flags = cqe->flags;
+		/* the entry is free before the callback, that can submit
+		 * and make completions */
+		head++;
+		__atomic_store_n(b->cq_khead, head, __ATOMIC_RELEASE);
+		uring_handle_cqe(b, udata, res, flags);
+	}
+}
+
+/** submit the queue and wait for completions, false on failure */
+static int
+uring_wait(struct uring_base* b, struct timeval* wait)
+{
+	struct io_uring_getevents_arg arg;
+	struct __kernel_timespec ts;
+	int ret;
+	memset(&arg, 0, sizeof(arg));
+	arg.sigmask_sz = _NSIG/8;
+	if(wait->tv_sec != (time_t)-1) {
+		ts.tv_sec = (long long)wait->tv_sec;
+		ts.tv_nsec = (long long)wait->tv_usec*1000;
+		arg.ts = (uint64_t)(uintptr_t)&ts;
+	}
+	ret = sys_io_uring_enter(b->enter_fd, b->sq_pending, 1,
+		b->enter_flags|IORING_ENTER_GETEVENTS|IORING_ENTER_EXT_ARG,
+		&arg, sizeof(arg));
+	if(ret < 0) {
+		if(errno == EINTR || errno == ETIME || errno == EAGAIN ||
+			errno == EBUSY)
+			return 1;
+		return 0;
+	}
+	if((unsigned)ret > b->sq_pending)
+		ret = (int)b->sq_pending;
+	b->sq_pending -= (unsigned)ret;
+	return 1;
+}
+
+/** wait for epoll and call the callbacks, false on failure */
+static int
+uring_epoll_wait(struct uring_base* b, struct timeval* wait)
+{
+	struct epoll_event evs[URING_EPOLL_EVENTS];
+	int n, i, ms = -1;
+	if(wait->tv_sec != (time_t)-1) {
+		if(wait->tv_sec > 86400)
+			ms = 86400*1000;
+		else	ms = (int)wait->tv_sec*1000 +
+				(int)(wait->tv_usec+999)/1000;
+	}
+	n = epoll_wait(b->epfd, evs, URING_EPOLL_EVENTS, ms);
+	if(n == -1) {
+		int e = errno;
+		if(settime(b) < 0)
+			return 0;
+		return (e == EINTR || e == EAGAIN);
+	}
+	if(settime(b) < 0)
+		return 0;
+	for(i=0; i<n; i++) {
+		uint32_t slot = (uint32_t)(evs[i].data.u64&0xffffffff);
+		uint32_t tag = (uint32_t)(evs[i].data.u64>>32);
+		struct uring_event* ev = (slot < b->num_slots ?
+			b->slots[slot] : NULL);
+		short bits = 0;
+		/* an earlier callback can have removed the event */
+		if(!ev || tag == 0 || ev->tag != tag)
+			continue;
+		if((evs[i].events&(EPOLLIN|EPOLLERR|EPOLLHUP)))
+			bits |= UB_EV_READ;
+		if((evs[i].events&(EPOLLOUT|EPOLLERR|EPOLLHUP)))
+			bits |= UB_EV_WRITE;
+		bits &= ev->bits;
+		if(!bits)
+			continue;
+		if(!(ev->bits&UB_EV_PERSIST))
+			(void)uring_event_del(&ev->super);
+		uring_event_callback(ev, bits);
+	}
+	return 1;
+}
+
+/** call timeouts handlers, and return how long to wait for next one or -1 */
+static void
+handle_timeouts(struct uring_base* b, struct timeval* now,
+	struct timeval* wait)
+{
+	rbnode_type* n;
+	struct uring_event* p;
+	wait->tv_sec = (time_t)-1;
+	wait->tv_usec = 0;
+
+	while((n = rbtree_first(&b->times)) != RBTREE_NULL) {
+		p = (struct uring_event*)n->key;
+		if(p->timeout.tv_sec > now->tv_sec ||
+			(p->timeout.tv_sec==now->tv_sec &&
+			p->timeout.tv_usec > now->tv_usec)) {
+			/* there is a next larger timeout. wait for it */
+			wait->tv_sec = p->timeout.tv_sec - now->tv_sec;
+			if(now->tv_usec > p->timeout.tv_usec) {
+				wait->tv_sec--;
+				wait->tv_usec = 1000000 - (now->tv_usec -
+					p->timeout.tv_usec);
+			} else {
+				wait->tv_usec = p->timeout.tv_usec
+					- now->tv_usec;
+			}
+			return;
+		}
+		/* event times out, remove it */
+		(void)rbtree_delete(&b->times, p);
+		p->timer_set = 0;
+		if(!(p->bits&UB_EV_PERSIST))
+			(void)uring_event_del(&p->super);
+		uring_event_callback(p, UB_EV_TIMEOUT);
+	}
+}
+
+/** register the ring fd, so that io_uring_enter does not look it up,
+ * the registration is for the thread that runs the event loop */
+static void
+uring_register_ring(struct uring_base* b)
+{
+	struct io_uring_rsrc_update up;
+	if(b->ring_fd_done)
+		return;
+	b->ring_fd_done = 1;
+	memset(&up, 0, sizeof(up));
+	up.offset = (uint32_t)-1;
+	up.data = (uint64_t)b->ring_fd;
+	if(sys_io_uring_register(b->ring_fd, IORING_REGISTER_RING_FDS, &up, 1)
+		!= 1) {
+		verbose(VERB_ALGO, "io_uring register ring fd: %s",
+			strerror(errno));
+		return;
+	}
+	b->enter_fd = (int)up.offset;
+	b->enter_flags = IORING_ENTER_REGISTERED_RING;
+}
+
+/** run the event loop */
+static int
+uring_event_base_dispatch(struct ub_event_base* base)
+{
+	struct uring_base* b = AS_URING_BASE(base);
+	struct timeval wait;
+	if(settime(b) < 0)
+		return -1;
+	if(b->method == uring_method_io_uring)
+		uring_register_ring(b);
+	while(!b->need_to_exit)
+	{
+		/* see if timeouts need handling */
+		handle_timeouts(b, b->time_tv, &wait);
+		if(b->need_to_exit)
+			break;
+		if(b->method == uring_method_epoll) {
+			if(!uring_epoll_wait(b, &wait)) {
+				if(b->need_to_exit)
+					break;
+				return -1;
+			}
+			continue;
+		}
+		/* events that could not be armed, are armed now, and if
+		 * the queue is still full, the wait does not block */
+		if(b->rearm_list) {
+			uring_rearm_list(b);
+			if(b->rearm_list) {
+				wait.tv_sec = 0;
+				wait.tv_usec = 0;
+			}
+		}
+		/* submit the queued entries and wait */
+		if(!uring_wait(b, &wait)) {
+			log_err("io_uring_enter: %s", strerror(errno));
+			if(b->need_to_exit)
+				break;
+			return -1;
+		}
+		if(settime(b) < 0)
+			return -1;
+		uring_handle_cqes(b);
+	}
+	/* like libevent, the exit is done and the base can be dispatched
+	 * again */
+	b->need_to_exit = 0;
+	return 0;
+}
+
+/** exit that loop */
+static int
+uring_event_base_loopexit(struct ub_event_base* base,
+	struct timeval* ATTR_UNUSED(tv))
+{
+	AS_URING_BASE(base)->need_to_exit = 1;
+	return 0;
+}
+
+/** create an event */
+static struct uring_event*
+uring_event_create(struct uring_base* b, int fd, short bits,
+	void (*cb)(int, short, void*), void* arg)
+{
+	struct uring_event* ev = (struct uring_event*)calloc(1,
+		sizeof(struct uring_event));
+	if(!ev)
+		return NULL;
+	ev->super.magic = UB_EVENT_MAGIC;
+	ev->super.vmt = &uring_event_vmt;
+	ev->node.key = ev;
+	ev->base = b;
+	ev->fd = fd;
+	ev->bits = bits;
+	ev->cb = cb;
+	ev->arg = arg;
+	ev->fixed = -1;
+	if(!uring_slot_new(b, ev)) {
+		free(ev);
+		return NULL;
+	}
+	return ev;
+}
+
+static struct ub_event*
+uring_event_new(struct ub_event_base* base, int fd, short bits,
+	void (*cb)(int, short, void*), void* arg)
+{
+	struct uring_base* b = AS_URING_BASE(base);
+	struct uring_event* ev = uring_event_create(b, fd, bits, cb, arg);
+	if(!ev)
+		return NULL;
+	/* the UDP listening sockets, they are created with their fd, are
+	 * received with the multishot recvmsg, the outgoing sockets get
+	 * their fd later */
+	ev->recv_udp = (b->method == uring_method_io_uring &&
+		!b->no_multishot && cb == comm_point_udp_callback &&
+		fd != -1 && (bits&UB_EV_READ) && (bits&UB_EV_PERSIST));
+	return &ev->super;
+}
+
+static struct ub_event*
+uring_signal_new(struct ub_event_base* base, int fd,
+	void (*cb)(int, short, void*), void* arg)
+{
+	struct uring_event* ev = uring_event_create(AS_URING_BASE(base), fd,
+		UB_EV_SIGNAL|UB_EV_PERSIST, cb, arg);
+	if(!ev)
+		return NULL;
+	return &ev->super;
+}
+
+static struct ub_event*
+uring_winsock_register_wsaevent(struct ub_event_base* ATTR_UNUSED(base),
+	void* ATTR_UNUSED(wsaevent), void (*cb)(int, short, void*),
+	void* ATTR_UNUSED(arg))
+{
+	(void)cb;
+	return NULL;
+}
+
+static void
+uring_event_add_bits(struct ub_event* ev, short bits)
+{
+	AS_URING_EVENT(ev)->bits |= bits;
+}
+
+static void
+uring_event_del_bits(struct ub_event* ev, short bits)
+{
+	AS_URING_EVENT(ev)->bits &= ~bits;
+}
+
+static void
+uring_event_set_fd(struct ub_event* ev, int fd)
+{
+	AS_URING_EVENT(ev)->fd = fd;
+}
+
+static void
+uring_event_free(struct ub_event* ev)
+{
+	struct uring_event* e = AS_URING_EVENT(ev);
+	struct uring_base* b;
+	if(!e)
+		return;
+	b = e->base;
+	if(e->added)
+		(void)uring_event_del(ev);
+	if((e->bits&UB_EV_SIGNAL) && e->fd >= 0 && e->fd < URING_MAX_SIG &&
+		b->signals[e->fd] == e)
+		b->signals[e->fd] = NULL;
+	b->slots[e->slot] = NULL;
+	b->free_slots[b->num_free++] = e->slot;
+	free(e);
+}
+
+static int
+uring_timer_add(struct ub_event* ev, struct ub_event_base* ATTR_UNUSED(base),
+	void (*cb)(int, short, void*), void* arg, struct timeval* tv)
+{
+	struct uring_event* e = AS_URING_EVENT(ev);
+	if(e->added)
+		(void)uring_event_del(ev);
+	e->fd = -1;
+	e->bits = UB_EV_TIMEOUT;
+	e->cb = cb;
+	e->arg = arg;
+	return uring_event_add(ev, tv);
+}
+
+static int
+uring_timer_del(struct ub_event* ev)
+{
+	return uring_event_del(ev);
+}
+
+/** signal handler, the signal is handled by the event loop */
+static RETSIGTYPE
+uring_sigh(int sig)
+{
+	struct uring_base* b = uring_signal_base;
+	int e = errno;
+	if(!b || sig < 0 || sig >= URING_MAX_SIG)
+		return;
+	uring_signal_caught[sig] = 1;
+	if(b->sigpipe[1] != -1) {
+		ssize_t r = write(b->sigpipe[1], "", 1);
+		(void)r;
+	}
+	errno = e;
+}
+
+void
+uring_signal_callback(int fd, short ATTR_UNUSED(bits), void* arg)
+{
+	struct uring_base* b = (struct uring_base*)arg;
+	char buf[64];
+	int sig;
+	while(read(fd, buf, sizeof(buf)) > 0)
+		;
+	for(sig=0; sig<URING_MAX_SIG; sig++) {
+		struct uring_event* ev;
+		if(!uring_signal_caught[sig])
+			continue;
+		uring_signal_caught[sig] = 0;
+		if((ev = b->signals[sig]) != NULL) {
+			fptr_ok(fptr_whitelist_event(ev->cb));
+			(*ev->cb)(sig, UB_EV_SIGNAL, ev->arg);
+		}
+	}
+}
+
+/** create the signal pipe, and the event for it */
+static int
+uring_sigpipe_create(struct uring_base* b)
+{
+	if(b->sigev)
+		return 1;
+	if(pipe2(b->sigpipe, O_NONBLOCK|O_CLOEXEC) == -1) {
+		log_err("pipe: %s", strerror(errno));
+		b->sigpipe[0] = -1;
+		b->sigpipe[1] = -1;
+		return 0;
+	}
+	b->sigev = uring_event_create(b, b->sigpipe[0],
+		UB_EV_READ|UB_EV_PERSIST, uring_signal_callback, b);
+	if(!b->sigev || uring_event_add(&b->sigev->super, NULL) != 0) {
+		log_err("could not add signal pipe event");
+		return 0;
+	}
+	return 1;
+}
+
+static int
+uring_signal_add(struct ub_event* ev, struct timeval* ATTR_UNUSED(tv))
+{
+	struct uring_event* e = AS_URING_EVENT(ev);
+	if(e->fd < 0 || e->fd >= URING_MAX_SIG)
+		return -1;
+	if(!uring_sigpipe_create(e->base))
+		return -1;
+	uring_signal_base = e->base;
+	e->base->signals[e->fd] = e;
+	e->added = 1;
+	if(signal(e->fd, uring_sigh) == SIG_ERR) {
+		return -1;
+	}
+	return 0;
+}
+
+static int
+uring_signal_del(struct ub_event* ev)
+{
+	struct uring_event* e = AS_URING_EVENT(ev);
+	if(e->fd < 0 || e->fd >= URING_MAX_SIG)
+		return -1;
+	e->base->signals[e->fd] = NULL;
+	e->added = 0;
+	return 0;
+}
+
+static void
+uring_winsock_unregister_wsaevent(struct ub_event* ATTR_UNUSED(ev))
+{
+}
+
+static void
+uring_winsock_tcp_wouldblock(struct ub_event* ATTR_UNUSED(ev),
+	int ATTR_UNUSED(eventbits))
+{
+}
+
+/** free the io_uring parts of the event base */
+static void
+uring_free_ring(struct uring_base* b)
+{
+	if(b->ring_fd != -1) {
+		/* send the queued replies and cancels */
+		uring_submit(b);
+		if(b->enter_flags&IORING_ENTER_REGISTERED_RING) {
+			struct io_uring_rsrc_update up;
+			memset(&up, 0, sizeof(up));
+			up.offset = (uint32_t)b->enter_fd;
+			(void)sys_io_uring_register(b->ring_fd,
+				IORING_UNREGISTER_RING_FDS, &up, 1);
+		}
+		close(b->ring_fd);
+		b->ring_fd = -1;
+	}
+	if(b->sqes)
+		munmap(b->sqes, b->sqes_size);
+	if(b->cq_ring && b->cq_ring != b->sq_ring)
+		munmap(b->cq_ring, b->cq_ring_size);
+	if(b->sq_ring)
+		munmap(b->sq_ring, b->sq_ring_size);
+	if(b->br)
+		munmap(b->br, b->br_size);
+	if(b->bufs)
+		munmap(b->bufs, (size_t)URING_BUF_NUM*URING_BUF_SIZE);
+	free(b->sends);
+	b->sqes = NULL;
+	b->cq_ring = NULL;
+	b->sq_ring = NULL;
+	b->br = NULL;
+	b->bufs = NULL;
+	b->sends = NULL;
+	b->send_free = NULL;
+}
+
+/** mmap a part of the ring, NULL on failure */
+static void*
+uring_mmap(struct uring_base* b, size_t size, off_t offset)
+{
+	void* p = mmap(NULL, size, PROT_READ|PROT_WRITE,
+		MAP_SHARED|MAP_POPULATE, b->ring_fd, offset);
+	if(p == MAP_FAILED) {
+		verbose(VERB_ALGO, "io_uring mmap: %s", strerror(errno));
+		return NULL;
+	}
+	return p;
+}
+
+/** mmap anonymous memory, NULL on failure */
+static void*
+uring_mmap_anon(size_t size)
+{
+	void* p = mmap(NULL, size, PROT_READ|PROT_WRITE,
+		MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+	if(p == MAP_FAILED)
+		return NULL;
+	return p;
+}
+
+/** set up the ring, false if io_uring is not usable */
+static int
+uring_setup(struct uring_base* b)
+{
+	struct io_uring_params p;
+	struct io_uring_buf_reg reg;
+	int fds[URING_FILES];
+	unsigned i;
+	unsigned* array;
+
+	memset(&p, 0, sizeof(p));
+	p.flags = IORING_SETUP_CQSIZE|IORING_SETUP_COOP_TASKRUN;
+	p.cq_entries = URING_CQ_ENTRIES;
+	b->ring_fd = sys_io_uring_setup(URING_ENTRIES, &p);
+	if(b->ring_fd == -1 && errno == EINVAL) {
+		/* older kernel, without the task run flag */
+		memset(&p, 0, sizeof(p));
+		p.flags = IORING_SETUP_CQSIZE;
+		p.cq_entries = URING_CQ_ENTRIES;
+		b->ring_fd = sys_io_uring_setup(URING_ENTRIES, &p);
+	}
+	if(b->ring_fd == -1) {
+		verbose(VERB_ALGO, "io_uring_setup: %s", strerror(errno));
+		return 0;
+	}
+	b->enter_fd = b->ring_fd;
+	if(!(p.features&IORING_FEAT_EXT_ARG) ||
+		!(p.features&IORING_FEAT_NODROP)) {
+		verbose(VERB_ALGO, "io_uring is too old");
+		return 0;
+	}
+
+	/* the rings */
+	b->sq_ring_size = p.sq_off.array + p.sq_entries*sizeof(unsigned);
+	b->cq_ring_size = p.cq_off.cqes +
+		p.cq_entries*sizeof(struct io_uring_cqe);
+	if((p.features&IORING_FEAT_SINGLE_MMAP)) {
+		if(b->cq_ring_size > b->sq_ring_size)
+			b->sq_ring_size = b->cq_ring_size;
+		b->cq_ring_size = b->sq_ring_size;
+	}
+	if(!(b->sq_ring = uring_mmap(b, b->sq_ring_size, IORING_OFF_SQ_RING)))
+		return 0;
+	if((p.features&IORING_FEAT_SINGLE_MMAP))
+		b->cq_ring = b->sq_ring;
+	else if(!(b->cq_ring = uring_mmap(b, b->cq_ring_size,
+		IORING_OFF_CQ_RING)))
+		return 0;
+	b->sqes_size = p.sq_entries*sizeof(struct io_uring_sqe);
+	if(!(b->sqes = (struct io_uring_sqe*)uring_mmap(b, b->sqes_size,
+		IORING_OFF_SQES)))
+		return 0;
+	b->sq_khead = (unsigned*)((uint8_t*)b->sq_ring + p.sq_off.head);
+	b->sq_ktail = (unsigned*)((uint8_t*)b->sq_ring + p.sq_off.tail);
+	b->sq_mask = *(unsigned*)((uint8_t*)b->sq_ring + p.sq_off.ring_mask);
+	b->sq_entries = p.sq_entries;
+	b->sq_tail = *b->sq_ktail;
+	array = (unsigned*)((uint8_t*)b->sq_ring + p.sq_off.array);
+	for(i=0; i<p.sq_entries; i++)
+		array[i] = i;
+	b->cq_khead = (unsigned*)((uint8_t*)b->cq_ring + p.cq_off.head);
+	b->cq_ktail = (unsigned*)((uint8_t*)b->cq_ring + p.cq_off.tail);
+	b->cq_mask = *(unsigned*)((uint8_t*)b->cq_ring + p.cq_off.ring_mask);
+	b->cqes = (struct io_uring_cqe*)((uint8_t*)b->cq_ring +
+		p.cq_off.cqes);
+
+	/* the provided buffers for the UDP receives */
+	b->br_size = URING_BUF_NUM*sizeof(struct io_uring_buf);
+	if(!(b->br = (struct io_uring_buf_ring*)uring_mmap_anon(b->br_size)))
+		return 0;
+	memset(&reg, 0, sizeof(reg));
+	reg.ring_addr = (uint64_t)(uintptr_t)b->br;
+	reg.ring_entries = URING_BUF_NUM;
+	reg.bgid = URING_BUF_GROUP;
+	if(sys_io_uring_register(b->ring_fd, IORING_REGISTER_PBUF_RING,
+		&reg, 1) == -1) {
+		verbose(VERB_ALGO, "io_uring register buffer ring: %s",
+			strerror(errno));
+		return 0;
+	}
+	if(!(b->bufs = (uint8_t*)uring_mmap_anon((size_t)URING_BUF_NUM*
+		URING_BUF_SIZE)))
+		return 0;
+	for(i=0; i<URING_BUF_NUM; i++)
+		uring_buf_put(b, (uint16_t)i);
+	b->recv_msg.msg_namelen = (socklen_t)sizeof(struct sockaddr_storage);
+
+	/* the registered files, all empty */
+	for(i=0; i<URING_FILES; i++)
+		fds[i] = -1;
+	if(sys_io_uring_register(b->ring_fd, IORING_REGISTER_FILES, fds,
+		URING_FILES) == 0)
+		b->have_files = 1;
+	else	verbose(VERB_ALGO, "io_uring register files: %s",
+			strerror(errno));
+
+	/* the UDP replies */
+	b->sends = (struct uring_send*)calloc(URING_SEND_NUM,
+		sizeof(struct uring_send));
+	if(!b->sends)
+		return 0;
+	for(i=URING_SEND_NUM; i>0; i--) {
+		b->sends[i-1].next = b->send_free;
+		b->send_free = &b->sends[i-1];
+	}
+	return 1;
+}
+
+static void
+uring_event_base_free(struct ub_event_base* base)
+{
+	struct uring_base* b = AS_URING_BASE(base);
+	if(!b)
+		return;
+	if(uring_signal_base == b)
+		uring_signal_base = NULL;
+	if(b->sigev)
+		uring_event_free(&b->sigev->super);
+	if(b->sigpipe[0] != -1)
+		close(b->sigpipe[0]);
+	if(b->sigpipe[1] != -1)
+		close(b->sigpipe[1]);
+	uring_free_ring(b);
+	if(b->epfd != -1)
+		close(b->epfd);
+	free(b->slots);
+	free(b->free_slots);
+	free(b);
+}
+
+static struct ub_event_vmt uring_event_vmt = {
+	uring_event_add_bits, uring_event_del_bits, uring_event_set_fd,
+	uring_event_free, uring_event_add, uring_event_del,
+	uring_timer_add, uring_timer_del, uring_signal_add, uring_signal_del,
+	uring_winsock_unregister_wsaevent, uring_winsock_tcp_wouldblock
+};
+
+static struct ub_event_base_vmt uring_event_base_vmt = {
+	uring_event_base_free, uring_event_base_dispatch,
+	uring_event_base_loopexit, uring_event_new, uring_signal_new,
+	uring_winsock_register_wsaevent
+};
+
+struct ub_event_base*
+ub_uring_event_base(time_t* time_secs, struct timeval* time_tv,
+	int try_uring)
+{
+	struct uring_base* b = (struct uring_base*)calloc(1,
+		sizeof(struct uring_base));
+	if(!b)
+		return NULL;
+	b->super.magic = UB_EVENT_MAGIC;
+	b->super.vmt = &uring_event_base_vmt;
+	b->time_secs = time_secs;
+	b->time_tv = time_tv;
+	b->sigpipe[0] = -1;
+	b->sigpipe[1] = -1;
+	b->epfd = -1;
+	b->ring_fd = -1;
+	rbtree_init(&b->times, uring_ev_cmp);
+	if(settime(b) < 0) {
+		free(b);
+		return NULL;
+	}
+	b->method = uring_method_epoll;
+	if(try_uring) {
+		if(uring_setup(b))
+			b->method = uring_method_io_uring;
+		else {
+			verbose(VERB_ALGO, "io_uring is not usable, use epoll");
+			uring_free_ring(b);
+		}
+	}
+	if(b->method == uring_method_epoll) {
+		b->epfd = epoll_create1(EPOLL_CLOEXEC);
+		if(b->epfd == -1) {
+			log_err("epoll_create: %s", strerror(errno));
+			free(b);
+			return NULL;
+		}
+	}
+	return &b->super;
+}
+
+const char*
+ub_uring_event_method(struct ub_event_base* base)
+{
+	if(!base || base->magic != UB_EVENT_MAGIC ||
+		base->vmt != &uring_event_base_vmt)
+		return NULL;
+	if(AS_URING_BASE(base)->method == uring_method_io_uring)
+		return "io_uring";
+	return "epoll";
+}
+
+int
+ub_uring_send_udp(struct ub_event* ev, struct sldns_buffer* packet,
+	struct sockaddr* addr, socklen_t addrlen)
+{
+	struct uring_event* e;
+	struct uring_base* b;
+	struct uring_send* s;
+	struct io_uring_sqe* sqe;
+	size_t len = sldns_buffer_remaining(packet);
+	if(!ev || ev->magic != UB_EVENT_MAGIC || ev->vmt != &uring_event_vmt)
+		return 0;
+	e = AS_URING_EVENT(ev);
+	b = e->base;
+	if(!e->recv_udp || !e->added || len > URING_SEND_SIZE ||
+		addrlen > (socklen_t)sizeof(s->addr) || !b->send_free)
+		return 0;
+	if(!(sqe = uring_get_sqe(b)))
+		return 0;
+	s = b->send_free;
+	b->send_free = s->next;
+	memmove(s->data, sldns_buffer_begin(packet), len);
+	memmove(&s->addr, addr, addrlen);
+	s->iov.iov_base = s->data;
+	s->iov.iov_len = len;
+	memset(&s->msg, 0, sizeof(s->msg));
+	s->msg.msg_name = &s->addr;
+	s->msg.msg_namelen = addrlen;
+	s->msg.msg_iov = &s->iov;
+	s->msg.msg_iovlen = 1;
+	sqe->opcode = IORING_OP_SENDMSG;
+	if(e->fixed != -1) {
+		sqe->fd = e->fixed;
+		sqe->flags |= IOSQE_FIXED_FILE;
+	} else	sqe->fd = e->fd;
+	sqe->addr = (uint64_t)(uintptr_t)&s->msg;
+	sqe->len = 1;
+	sqe->user_data = URING_UDATA(URING_SLOT_SEND, (uint32_t)(s-b->sends));
+	uring_queue_sqe(b);
+	return 1;
+}
+
+#else /* USE_IO_URING */
+int uring_ev_cmp(const void* ATTR_UNUSED(a), const void* ATTR_UNUSED(b))
+{
+	return 0;
+}
+#endif /* USE_IO_URING */
@@ -0,0 +1,105 @@
+/*
+ * util/uring_event.h - io_uring and epoll event backend for the comm_base.
+ *
+ * Copyright (c) 2026, NLnet Labs. All rights reserved.
+ *
+ * This software is open source.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ *
+ * Redistributions of source code must retain the above copyright notice,
+ * this list of conditions and the following disclaimer.
+ *
+ * Redistributions in binary form must reproduce the above copyright notice,
+ * this list of conditions and the following disclaimer in the documentation
+ * and/or other materials provided with the distribution.
+ *
+ * Neither the name of the NLNET LABS nor the names of its contributors may
+ * be used to endorse or promote products derived from this software without
+ * specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED
+ * TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR
+ * PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+ * NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * \file
+ *
+ * An event base for the pluggable event interface that uses io_uring on
+ * Linux, with a fallback to epoll when io_uring is not available.
+ *
+ * Events on file descriptors are oneshot polls that are armed again after
+ * they fire, so they behave level triggered, like select and epoll.  The
+ * UDP listening sockets are received with a multishot recvmsg, into the
+ * buffers of a provided buffer ring, and the datagrams are passed to the
+ * comm point without a recvfrom call.  The replies to them are queued as
+ * sendmsg operations, and are submitted together with the wait for the
+ * next events, in one system call.  The listening sockets are registered
+ * files of the ring.
+ *
+ * Timeouts are kept in a redblack tree, like the mini event does.  Signal
+ * handlers write to a pipe that is polled by the event base, the signal
+ * callbacks are called from the event loop.  Only one event base handles
+ * signals.
+ */
+
+#ifndef UTIL_URING_EVENT_H
+#define UTIL_URING_EVENT_H
+struct ub_event_base;
+struct ub_event;
+struct sldns_buffer;
+struct sockaddr;
+
+#ifdef USE_IO_URING
+/**
+ * Create an event base that uses io_uring, or epoll.
+ * @param time_secs: time in seconds is stored there, after the wait.
+ * @param time_tv: time in microseconds is stored there.
+ * @param try_uring: if false, epoll is used, otherwise io_uring is used
+ *	if the kernel supports it.
+ * @return the event base, or NULL on failure.
+ */
+struct ub_event_base* ub_uring_event_base(time_t* time_secs,
+	struct timeval* time_tv, int try_uring);
+
+/**
+ * Get the method of the event base.
+ * @param base: an event base.
+ * @return "io_uring" or "epoll", or NULL if the event base is not made
+ *	by ub_uring_event_base.
+ */
+const char* ub_uring_event_method(struct ub_event_base* base);
+
+/**
+ * Queue a UDP reply on the event of a UDP listening socket, it is sent
+ * with the next submission to the ring.
+ * @param ev: the event of the comm point.
+ * @param packet: the reply, from position to limit, it is copied.
+ * @param addr: where to send it to.
+ * @param addrlen: length of addr.
+ * @return false if the reply is not queued, and should be sent with
+ *	sendto.  This is the case for events that are not received with
+ *	the multishot recvmsg, and for large replies.
+ */
+int ub_uring_send_udp(struct ub_event* ev, struct sldns_buffer* packet,
+	struct sockaddr* addr, socklen_t addrlen);
+
+/** callback for the signal pipe of the event base */
+void uring_signal_callback(int fd, short bits, void* arg);
+#endif /* USE_IO_URING */
+
+/** compare events in tree, based on timevalue, ptr for uniqueness */
+int uring_ev_cmp(const void* a, const void* b);
+
+#endif /* UTIL_URING_EVENT_H */